@@ -22,6 +22,7 @@
 SOAGEN_DISABLE_WARNINGS;
 #include <string>
 #include <tuple>
+#include <vector>
 SOAGEN_ENABLE_WARNINGS;
 
 SOAGEN_PUSH_WARNINGS;
@@ -192,6 +193,11 @@ namespace soagen::detail
 	{
 		using type = table<table_traits_type<soagen::examples::employees>, allocator_type<soagen::examples::employees>>;
 	};
+
+	template <>
+	struct schema_hash_<soagen::examples::employees>
+		: std::integral_constant<std::uint64_t, 0x3D4EF72B8C1044C0ull>
+	{};
 }
 
 // clang-format on
@@ -552,6 +558,41 @@ namespace soagen::examples
             return *this;
         }
 
+        /// @brief Assigns a value to every element of a column (or some range of them).
+        ///
+        /// @details Trivially-copyable columns are filled with a single `memset()` when every byte of the value is
+        /// the same (e.g. zeroing), and with a loop the compiler can vectorize otherwise.
+        ///
+        /// @param value	The value to assign. It may be one of the column's own elements.
+        /// @param first	The first row to assign.
+        /// @param count	The number of rows to assign. Clamped to the end of the table.
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        employees& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        /// @brief Assigns the elements of a range to a column, starting at the given row.
+        ///
+        /// @details Contiguous ranges of a trivially-copyable column's own type (anything with `data()` and `size()`,
+        /// e.g. a `std::vector`) are copied with a single `memmove()`.
+        ///
+        /// @param values	The range of values to assign. Must not run past the end of the table.
+        /// @param first	The first row to assign.
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        employees& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
 #if SOAGEN_DOXYGEN
 
         /// @brief Removes the last row(s) from the table.
@@ -567,6 +608,24 @@ namespace soagen::examples
         employees& resize(size_type new_size) //
             noexcept(soagen::has_nothrow_resize_member<table_type>);
 
+        /// @brief Resizes the table to the given number of rows, copy-constructing any new rows from the given values.
+        ///
+        /// @details New rows are constructed a column at a time, so trivially-copyable columns are filled in bulk.
+        ///
+        /// @param new_size The new number of rows.
+        /// @param values	One value per column.
+        template <typename... Values>
+        employees& resize(size_type new_size, const Values&... values) noexcept(...);
+
+        /// @brief Appends `num` rows and returns a span over them, ready to be written directly into column memory.
+        ///
+        /// @details Trivially default-constructible columns are left uninitialized; all others are value-initialized.
+        ///
+        /// @returns A span over the new rows (empty if `num` is zero).
+        ///
+        /// @availability This method is only available when all the column types are default-constructible.
+        span_type append_uninitialized(size_type num) noexcept(...);
+
         /// @brief Swaps the contents of the table with another.
         ///
         /// @availability This method is only available when #allocator_type is swappable or non-propagating.
@@ -979,11 +1038,15 @@ namespace soagen::examples
 
         /// @brief Returns a pointer to the raw byte backing array.
         ///
+        /// @note Columns moved out of the main buffer by soagen::exchange_column() are not part of it.
+        ///
         /// @availability This method is only available when all the column types are trivially-copyable.
         constexpr std::byte* data() noexcept;
 
         /// @brief Returns a pointer to the raw byte backing array.
         ///
+        /// @note Columns moved out of the main buffer by soagen::exchange_column() are not part of it.
+        ///
         /// @availability This method is only available when all the column types are trivially-copyable.
         constexpr const std::byte* data() const noexcept;
 
@@ -1073,6 +1136,7 @@ namespace soagen::examples
         /// @warning This value is `capacity() * (sizeof() for every column) + (alignment padding)`.
         /// It is **not** based on `size()`! If you are using the value returned by this function
         /// in conjunction with `data()` to do serialization, hashing, etc, use `shrink_to_fit()` first.
+        /// Columns moved out of the main buffer by soagen::exchange_column() are not included.
         constexpr size_type allocation_size() const noexcept;
 
         /// @brief Reserves storage for (at least) the given number of rows.
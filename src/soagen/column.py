@@ -22,6 +22,7 @@ class Column(Configurable):
         self.pointer_type = var.pointer_type
         self.const_pointer_type = var.const_pointer_type
         self.default = var.default
+        self.index_type = var.index_type
 
 
 __all__ = [r'Column']
@@ -776,6 +776,8 @@ RESERVED_CPP_KEYWORDS = make_regex(
 RESERVED_SOAGEN = make_regex(
     # std::vector-like interface:
     r'allocator_type',
+    r'append_from_aos',
+    r'append_uninitialized',
     r'assign',
     r'at',
     r'begin',
@@ -783,6 +785,7 @@ RESERVED_SOAGEN = make_regex(
     r'cbegin',
     r'cend',
     r'clear',
+    r'const_iterator',
     r'data',
     r'difference_type',
     r'emplace_back',
@@ -792,9 +795,12 @@ RESERVED_SOAGEN = make_regex(
     r'erase',
     r'get_allocator',
     r'insert',
+    r'iterator',
     r'max_size',
+    r'pop_back',
     r'push_back',
     r'reserve',
+    r'resize_for_overwrite',
     r'resize',
     r'shrink_to_fit',
     r'size_type',
@@ -805,25 +811,40 @@ RESERVED_SOAGEN = make_regex(
     r'aligned_stride',
     r'allocation_size',
     r'allocator_traits',
+    r'assign_column',
+    r'can_insert_',
+    r'can_insert_rvalues_',
+    r'column_count',
     r'column_indices',
     r'column_name',
     r'column_traits',
     r'column_type',
     r'column',
     r'columns',
+    r'const_row_type',
+    r'const_span_type',
     r'emplacer',
+    r'fill',
     r'for_each_column',
     r'for_each',
     r'forward_type',
     r'get',
+    r'indexes_are_nothrow_',
     r'param_type',
+    r'rebuild_handles',
+    r'rebuild_indexes',
     r'row_type',
     r'row',
+    r'rvalue_iterator',
+    r'rvalue_row_type',
+    r'rvalue_span_type',
     r'rvalue_type',
     r'sfinae',
+    r'span_type',
     r'table_',
     r'table_traits',
     r'table_type',
+    r'table',
     r'value_type',
     # 'unnamed' columns:
     r'first',
@@ -845,10 +866,20 @@ RESERVED_SOAGEN = make_regex(
     # future-proofing:
     r'column_span',
     r'const_span',
+    r'contains',
+    r'copy_to_aos',
     r'copy',
+    r'emplace_back_handle',
+    r'equal_range',
     r'find',
+    r'handle_of',
+    r'handle_type',
+    r'handles_',
+    r'index_of',
     r'index_type',
+    r'matching',
     r'move',
+    r'range',
     r'reset',
     r'row_view',
     r'size_bytes',
@@ -878,7 +909,7 @@ def is_valid_identifier(s: str) -> tuple[bool, str]:
         return (False, 'may contain only a-z, A-Z, 0-9, and underscores')
     if RESERVED_CPP_KEYWORDS.fullmatch(s):
         return (False, 'may not be a C++ keyword')
-    if RESERVED_SOAGEN.fullmatch(s):
+    if RESERVED_SOAGEN.fullmatch(s) or s.endswith('_index_'):
         return (False, 'reserved by soagen')
     return (True, '')
 
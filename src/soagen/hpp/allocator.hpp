@@ -56,6 +56,21 @@ namespace soagen
     /// 	@ecpp
     ///
     /// 	Soagen will choose this overload over any others if it is present.
+    ///
+    /// @subsection customizing_allocators_column_alignment Specifying a column_alignment
+    /// 	If your allocator hands out memory in units larger than an element (e.g. pages), you can have tables
+    /// 	start each large column on a boundary of that size by adding a constexpr constant called
+    /// 	`column_alignment`. Any column occupying at least that many bytes will then begin at an offset from
+    /// 	the start of the buffer that is a multiple of it:
+    ///
+    /// 	@cpp
+    /// 	struct my_allocator
+    /// 	{
+    /// 		static constexpr std::size_t column_alignment = 4096;
+    /// 	}
+    /// 	@ecpp
+    ///
+    /// 	Smaller columns are packed as normal, so small tables don't pay for the padding.
     struct allocator
     {
         /// @brief The value type allocated by this allocator.
@@ -183,6 +198,19 @@ namespace soagen::detail
     template <typename Allocator>
     inline constexpr size_t alloc_min_alignment<Allocator, false> = alignof(typename Allocator::value_type);
 
+    // does the allocator want large columns to start on a particular boundary?
+
+    template <typename Allocator>
+    using has_column_alignment_ = decltype(Allocator::column_alignment);
+
+    template <typename Allocator>
+    inline constexpr bool has_column_alignment = is_detected<has_column_alignment_, Allocator>::value;
+
+    template <typename Allocator, bool = has_column_alignment<Allocator>>
+    inline constexpr size_t alloc_column_alignment = Allocator::column_alignment;
+    template <typename Allocator>
+    inline constexpr size_t alloc_column_alignment<Allocator, false> = 0;
+
     //--- base traits --------------------------------------------------------------------------------------------------
 
     template <typename Allocator>
@@ -199,6 +227,10 @@ namespace soagen::detail
         static constexpr size_t min_alignment = detail::alloc_min_alignment<Allocator>;
         static_assert(has_single_bit(min_alignment), "allocator min_alignment must be a power of two");
 
+        static constexpr size_t column_alignment = detail::alloc_column_alignment<Allocator>;
+        static_assert(!column_alignment || has_single_bit(column_alignment),
+                      "allocator column_alignment must be a power of two");
+
         SOAGEN_PURE_INLINE_GETTER
         static constexpr bool equal([[maybe_unused]] const Allocator& a, [[maybe_unused]] const Allocator& b) noexcept
         {
@@ -0,0 +1,272 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <tuple>
+#include <utility>
+#if SOAGEN_ISET_SSE
+    #include <xmmintrin.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    // rows transposed per block; small enough that a block of source structs is still in L1 by the time the last
+    // column has been written
+    inline constexpr size_t aos_block_rows = 256;
+
+    template <typename T, typename... Members>
+    SOAGEN_PURE_GETTER
+    inline bool aos_members_are_sequential(const T& obj, Members T::*... members) noexcept
+    {
+        size_t expected = 0;
+        return ((reinterpret_cast<const std::byte*>(&(obj.*members)) - reinterpret_cast<const std::byte*>(&obj)
+                     == static_cast<std::ptrdiff_t>((expected++) * sizeof(Members)))
+                && ...);
+    }
+
+    // structs of exactly four packed floats going to/from four float columns can be transposed with SSE shuffles
+    template <typename Soa, typename T, typename... Members>
+    inline constexpr bool aos_is_float4 = sizeof...(Members) == 4                         //
+                                       && sizeof(T) == 4u * sizeof(float)                 //
+                                       && std::is_standard_layout_v<T>                    //
+                                       && (std::is_same_v<remove_cvref<Members>, float> && ...);
+
+    template <typename Soa, size_t... Columns>
+    inline constexpr bool aos_columns_are_float =
+        (std::is_same_v<typename table_traits_type<Soa>::template storage_type<Columns>, float> && ...);
+
+    template <typename Soa, typename T, typename... Members, size_t... Columns>
+    SOAGEN_NEVER_INLINE
+    void aos_append(Soa& soa, const T* src, size_t count, std::index_sequence<Columns...>, Members T::*... members)
+    {
+        using traits = table_traits_type<Soa>;
+        using table  = table_type<Soa>;
+
+        auto& tbl         = static_cast<table&>(soa);
+        const size_t base = tbl.size();
+
+        size_t new_size = base;
+        if SOAGEN_UNLIKELY(!add_without_overflowing(new_size, count, new_size) || new_size > tbl.max_size())
+            SOAGEN_THROW(std::bad_alloc{});
+        if (new_size > tbl.capacity())
+            tbl.reserve(max(new_size, min(tbl.capacity() * 2u, tbl.max_size())));
+
+        const auto& alloc = table_storage_access::allocation(tbl);
+        const std::tuple<Members T::*...> member_ptrs{ members... };
+
+        // destroys a partially-written block and pops any previously-committed ones if a copy throws,
+        // leaving the table as it was on entry
+        struct block_guard
+        {
+            table& tbl;
+            size_t base;
+            size_t start;
+            size_t constructed[traits::column_count] = {};
+            bool committed                           = false;
+
+            ~block_guard() noexcept
+            {
+                if (committed)
+                    return;
+                const auto& a       = table_storage_access::allocation(tbl);
+                const auto destruct = [&](auto ic) noexcept
+                {
+                    constexpr size_t column = decltype(ic)::value;
+                    for (size_t i = 0; i < constructed[column]; i++)
+                        traits::template column<column>::destruct(a.columns[column], start + i);
+                };
+                (destruct(index_constant<Columns>{}), ...);
+                tbl.pop_back(tbl.size() - base);
+            }
+        };
+
+        for (size_t block = 0; block < count; block += aos_block_rows)
+        {
+            const size_t rows  = min(count - block, aos_block_rows);
+            const size_t start = base + block;
+            const T* const in  = src + block;
+
+            block_guard guard{ tbl, base, start };
+            size_t done = 0;
+
+#if SOAGEN_ISET_SSE
+            if constexpr (aos_is_float4<Soa, T, Members...> && aos_columns_are_float<Soa, Columns...>)
+            {
+                if (aos_members_are_sequential(*src, members...))
+                {
+                    float* const out[] = { traits::template column<Columns>::ptr(alloc.columns[Columns]) + start... };
+                    for (; done + 4u <= rows; done += 4u)
+                    {
+                        const float* const f = reinterpret_cast<const float*>(in + done);
+
+                        __m128 r0 = _mm_loadu_ps(f);
+                        __m128 r1 = _mm_loadu_ps(f + 4);
+                        __m128 r2 = _mm_loadu_ps(f + 8);
+                        __m128 r3 = _mm_loadu_ps(f + 12);
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        _mm_storeu_ps(out[0] + done, r0);
+                        _mm_storeu_ps(out[1] + done, r1);
+                        _mm_storeu_ps(out[2] + done, r2);
+                        _mm_storeu_ps(out[3] + done, r3);
+                    }
+                    ((guard.constructed[Columns] = done), ...);
+                }
+            }
+#endif
+
+            const auto copy_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                using column_traits     = typename traits::template column<column>;
+                const auto member       = std::get<column>(member_ptrs);
+                std::byte* const buf    = alloc.columns[column];
+
+                if constexpr (noexcept(column_traits::construct_at(buf, size_t{}, in->*member)))
+                {
+                    for (size_t i = done; i < rows; i++)
+                        column_traits::construct_at(buf, start + i, in[i].*member);
+                    guard.constructed[column] = rows;
+                }
+                else
+                {
+                    for (size_t i = done; i < rows; i++)
+                    {
+                        column_traits::construct_at(buf, start + i, in[i].*member);
+                        guard.constructed[column]++;
+                    }
+                }
+            };
+            (copy_column(index_constant<Columns>{}), ...);
+
+            guard.committed = true;
+            table_storage_access::set_size(tbl, start + rows);
+        }
+    }
+
+    template <typename Soa, typename T, typename... Members, size_t... Columns>
+    SOAGEN_NEVER_INLINE
+    void aos_copy(const Soa& soa,
+                  T* dest,
+                  size_t start,
+                  size_t count,
+                  std::index_sequence<Columns...>,
+                  Members T::*... members)
+    {
+        using table = table_type<Soa>;
+
+        const auto& tbl = static_cast<const table&>(soa);
+        SOAGEN_ASSERT(start <= tbl.size());
+        SOAGEN_ASSERT(count <= tbl.size() - start);
+
+        const std::tuple<Members T::*...> member_ptrs{ members... };
+
+        for (size_t block = 0; block < count; block += aos_block_rows)
+        {
+            const size_t rows = min(count - block, aos_block_rows);
+            const size_t from = start + block;
+            T* const out      = dest + block;
+            size_t done       = 0;
+
+#if SOAGEN_ISET_SSE
+            if constexpr (aos_is_float4<Soa, T, Members...> && aos_columns_are_float<Soa, Columns...>)
+            {
+                if (aos_members_are_sequential(*dest, members...))
+                {
+                    const float* const in[] = { tbl.template column<Columns>() + from... };
+                    for (; done + 4u <= rows; done += 4u)
+                    {
+                        float* const f = reinterpret_cast<float*>(out + done);
+
+                        __m128 r0 = _mm_loadu_ps(in[0] + done);
+                        __m128 r1 = _mm_loadu_ps(in[1] + done);
+                        __m128 r2 = _mm_loadu_ps(in[2] + done);
+                        __m128 r3 = _mm_loadu_ps(in[3] + done);
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        _mm_storeu_ps(f, r0);
+                        _mm_storeu_ps(f + 4, r1);
+                        _mm_storeu_ps(f + 8, r2);
+                        _mm_storeu_ps(f + 12, r3);
+                    }
+                }
+            }
+#endif
+
+            const auto copy_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                const auto member       = std::get<column>(member_ptrs);
+                const auto* const in    = tbl.template column<column>() + from;
+
+                for (size_t i = done; i < rows; i++)
+                    out[i].*member = in[i];
+            };
+            (copy_column(index_constant<Columns>{}), ...);
+        }
+    }
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief Appends rows to an SoA container by transposing an array of structs.
+    ///
+    /// @details Rows are copied in blocks, one column at a time, rather than one `push_back()` per struct.
+    ///          Storage is grown once up-front. Structs of exactly four `float` members being appended to four `float`
+    ///          columns are transposed four rows at a time using SSE shuffles (when available).
+    ///
+    /// @param soa		The container to append to.
+    /// @param src		The structs to copy from.
+    /// @param count	The number of structs to copy.
+    /// @param members	One pointer-to-member per column, in column order.
+    ///
+    /// @returns `soa`.
+    ///
+    /// @note If a copy throws, any rows appended by this call are removed again before the exception propagates.
+    template <typename Soa, typename T, typename... Members>
+    Soa& append_from_aos(Soa& soa, const T* src, size_t count, Members T::*... members)
+    {
+        static_assert(sizeof...(Members) == table_traits_type<Soa>::column_count,
+                      "a member pointer must be provided for each column");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "SoA types with indexes or handles must use their append_from_aos() member function");
+
+        if (count)
+        {
+            SOAGEN_ASSERT(src);
+            detail::aos_append(soa, src, count, std::make_index_sequence<sizeof...(Members)>{}, members...);
+        }
+        return soa;
+    }
+
+    /// @brief Copies rows from an SoA container out to an array of structs.
+    ///
+    /// @details The inverse of #soagen::append_from_aos(). The destination structs must already exist;
+    ///          their members are assigned.
+    ///
+    /// @param soa		The container to copy from.
+    /// @param dest		The structs to copy to.
+    /// @param start	The index of the first row to copy.
+    /// @param count	The number of rows to copy.
+    /// @param members	One pointer-to-member per column, in column order.
+    template <typename Soa, typename T, typename... Members>
+    void copy_to_aos(const Soa& soa, T* dest, size_t start, size_t count, Members T::*... members)
+    {
+        static_assert(sizeof...(Members) == table_traits_type<Soa>::column_count,
+                      "a member pointer must be provided for each column");
+
+        if (count)
+        {
+            SOAGEN_ASSERT(dest);
+            detail::aos_copy(soa, dest, start, count, std::make_index_sequence<sizeof...(Members)>{}, members...);
+        }
+    }
+}
+
+#include "header_end.hpp"
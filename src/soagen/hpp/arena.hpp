@@ -0,0 +1,290 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "allocator.hpp"
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	A monotonic memory region that hands out allocations by bumping a pointer.
+    ///
+    /// @details	Memory is never returned to the arena individually; everything allocated from it is reclaimed
+    ///				at once by #reset() (which keeps the initial block for reuse) or #release(). This makes it a good
+    ///				fit for per-frame or per-request temporary tables. Use it via #soagen::arena_allocator.
+    ///
+    /// @details	The arena either owns its initial block (allocated from #soagen::allocator) or wraps a
+    ///				caller-supplied buffer. When a block runs out a new one is allocated upstream, each larger than
+    ///				the last.
+    ///
+    /// @attention	Not thread-safe. Any table allocating from an arena must be destroyed (or cleared and
+    ///				shrunk) before the arena is reset.
+    class arena
+    {
+      public:
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The minimum alignment of any allocation handed out by the arena.
+        static constexpr size_type min_alignment = allocator::min_alignment;
+
+      private:
+        // upstream blocks are singly-linked through a header at their start
+        struct block
+        {
+            block* next;
+            size_type size;
+        };
+
+        static constexpr size_type header_size = (sizeof(block) + min_alignment - 1u) & ~(min_alignment - 1u);
+
+        block* blocks_            = {}; // owned upstream blocks, most recent first
+        std::byte* initial_       = {};
+        size_type initial_size_   = {};
+        bool owns_initial_        = {};
+        std::byte* cursor_        = {};
+        std::byte* end_           = {};
+        size_type next_size_      = {};
+        size_type bytes_used_     = {};
+        size_type bytes_reserved_ = {};
+
+        SOAGEN_NODISCARD
+        static std::byte* align_up(std::byte* ptr, size_type alignment) noexcept
+        {
+            const auto p = reinterpret_cast<uintptr_t>(ptr);
+            return ptr + (((p + alignment - 1u) & ~static_cast<uintptr_t>(alignment - 1u)) - p);
+        }
+
+        block* new_block(size_type usable)
+        {
+            const auto size = header_size + usable;
+            auto b = reinterpret_cast<block*>(allocator{}.allocate(size, std::align_val_t{ min_alignment }));
+            b->next = blocks_;
+            b->size = size;
+            blocks_ = b;
+            bytes_reserved_ += size;
+            return b;
+        }
+
+        void free_blocks(block* keep) noexcept
+        {
+            while (blocks_ != keep)
+            {
+                const auto next = blocks_->next;
+                bytes_reserved_ -= blocks_->size;
+                allocator{}.deallocate(reinterpret_cast<std::byte*>(blocks_), blocks_->size);
+                blocks_ = next;
+            }
+        }
+
+        void rewind() noexcept
+        {
+            cursor_     = initial_;
+            end_        = initial_ + initial_size_;
+            bytes_used_ = {};
+        }
+
+      public:
+        /// @brief Creates an arena that allocates an initial block of `initial_size` bytes on first use.
+        SOAGEN_NODISCARD_CTOR
+        explicit arena(size_type initial_size = 64u * 1024u) noexcept //
+            : next_size_{ max(initial_size, size_type{ 256 }) }
+        {}
+
+        /// @brief Creates an arena whose initial block is a caller-supplied buffer.
+        ///
+        /// @details The buffer must outlive the arena. It is never freed by the arena.
+        SOAGEN_NODISCARD_CTOR
+        arena(void* buffer, size_type size) noexcept //
+            : initial_{ static_cast<std::byte*>(buffer) },
+              initial_size_{ size },
+              next_size_{ max(size * 2u, size_type{ 256 }) }
+        {
+            rewind();
+            bytes_reserved_ = size;
+        }
+
+        arena(const arena&)            = delete;
+        arena& operator=(const arena&) = delete;
+
+        /// @brief Destructor. Releases all memory owned by the arena.
+        ~arena() noexcept
+        {
+            release();
+        }
+
+        /// @brief Allocates `size` bytes aligned to (at least) `alignment`.
+        ///
+        /// @throws std::bad_alloc If an upstream allocation failed.
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        std::byte* allocate(size_type size, size_type alignment = min_alignment)
+        {
+            alignment = max(alignment, min_alignment);
+            SOAGEN_ASSERT(has_single_bit(alignment));
+
+            std::byte* ptr = cursor_ ? align_up(cursor_, alignment) : nullptr;
+            if SOAGEN_UNLIKELY(!ptr || ptr > end_ || static_cast<size_type>(end_ - ptr) < size)
+            {
+                // the first owned block becomes the initial block that reset() keeps
+                const auto usable = max(next_size_, size + alignment);
+                const auto b      = new_block(usable);
+                if (!initial_)
+                {
+                    initial_      = reinterpret_cast<std::byte*>(b) + header_size;
+                    initial_size_ = usable;
+                    owns_initial_ = true;
+                }
+                else
+                    next_size_ = max(next_size_, usable) * 2u;
+
+                cursor_ = reinterpret_cast<std::byte*>(b) + header_size;
+                end_    = cursor_ + usable;
+                ptr     = align_up(cursor_, alignment);
+            }
+
+            cursor_ = ptr + size;
+            bytes_used_ += size;
+            return ptr;
+        }
+
+        /// @brief Reclaims every allocation at once, keeping the initial block for reuse.
+        ///
+        /// @details Blocks allocated after the initial one are returned upstream. If the arena needed more than its
+        ///          initial block, subsequent new blocks will be larger to reduce future overflows.
+        void reset() noexcept
+        {
+            if (!initial_)
+                return;
+
+            // the initial owned block is the last one in the list
+            block* keep = {};
+            if (owns_initial_)
+            {
+                keep = blocks_;
+                while (keep && keep->next)
+                    keep = keep->next;
+            }
+            free_blocks(keep);
+            rewind();
+        }
+
+        /// @brief Returns all memory owned by the arena upstream.
+        void release() noexcept
+        {
+            free_blocks(nullptr);
+            if (owns_initial_)
+            {
+                initial_      = {};
+                initial_size_ = {};
+                owns_initial_ = {};
+                cursor_       = {};
+                end_          = {};
+                bytes_used_   = {};
+            }
+            else if (initial_)
+                rewind();
+        }
+
+        /// @brief Returns the number of bytes handed out since the last #reset().
+        SOAGEN_PURE_INLINE_GETTER
+        size_type bytes_used() const noexcept
+        {
+            return bytes_used_;
+        }
+
+        /// @brief Returns the total size of the memory blocks held by the arena.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type bytes_reserved() const noexcept
+        {
+            return bytes_reserved_;
+        }
+    };
+
+    /// @brief	An allocator that allocates from a #soagen::arena.
+    ///
+    /// @details	Allocation is a pointer bump and deallocation is a no-op; memory is reclaimed when the arena is
+    ///				reset. Implements both of soagen's allocator extensions (`min_alignment` and an
+    ///				alignment-aware `allocate()`).
+    ///
+    /// @details	Allocators compare equal if they refer to the same arena, and propagate with the tables that use
+    ///				them, so moving tables between arena-backed containers never copies elements.
+    class arena_allocator
+    {
+        arena* arena_;
+
+      public:
+        /// @brief The value type allocated by this allocator.
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
+
+        /// @brief Instances of this allocator are equal only if they refer to the same arena.
+        using is_always_equal = std::false_type;
+
+        /// @brief Instances of this allocator propagate on copy-assignment.
+        using propagate_on_container_copy_assignment = std::true_type;
+
+        /// @brief Instances of this allocator propagate on move-assignment.
+        using propagate_on_container_move_assignment = std::true_type;
+
+        /// @brief Instances of this allocator propagate on swap.
+        using propagate_on_container_swap = std::true_type;
+
+        /// @brief The minimum alignment of any allocations created by this allocator.
+        static constexpr size_type min_alignment = arena::min_alignment;
+
+        /// @brief Creates an allocator that allocates from the given arena.
+        SOAGEN_NODISCARD_CTOR
+        explicit arena_allocator(arena& a) noexcept //
+            : arena_{ &a }
+        {}
+
+        /// @brief Returns the arena this allocator allocates from.
+        SOAGEN_PURE_INLINE_GETTER
+        arena& get_arena() const noexcept
+        {
+            return *arena_;
+        }
+
+        /// @brief Alignment-aware allocation.
+        /// @param size The size of the allocation, in bytes.
+        /// @param alignment The minimum alignment, in bytes. Must be a power-of-two.
+        /// @return A new allocation.
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
+        {
+            return soagen::assume_aligned<min_alignment>(arena_->allocate(size, static_cast<size_type>(alignment)));
+        }
+
+        /// @brief Deallocation (a no-op; the memory is reclaimed when the arena is reset).
+        void deallocate(value_type*, size_type) noexcept
+        {}
+
+        /// @brief Equality operator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena_;
+        }
+
+        /// @brief Inequality operator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena_;
+        }
+    };
+    static_assert(std::is_nothrow_copy_constructible_v<arena_allocator>);
+    static_assert(std::is_nothrow_move_constructible_v<arena_allocator>);
+}
+
+#include "header_end.hpp"
@@ -0,0 +1,559 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "names.hpp"
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+
+//# the Arrow C Data Interface structs, exactly as specified by https://arrow.apache.org/docs/format/CDataInterface.html
+//# (guarded so they don't conflict with arrow/c/abi.h or nanoarrow)
+#ifndef ARROW_C_DATA_INTERFACE
+    #define ARROW_C_DATA_INTERFACE
+
+    #define ARROW_FLAG_DICTIONARY_ORDERED 1
+    #define ARROW_FLAG_NULLABLE           2
+    #define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+extern "C"
+{
+    struct ArrowSchema
+    {
+        const char* format;
+        const char* name;
+        const char* metadata;
+        int64_t flags;
+        int64_t n_children;
+        struct ArrowSchema** children;
+        struct ArrowSchema* dictionary;
+        void (*release)(struct ArrowSchema*);
+        void* private_data;
+    };
+
+    struct ArrowArray
+    {
+        int64_t length;
+        int64_t null_count;
+        int64_t offset;
+        int64_t n_buffers;
+        int64_t n_children;
+        const void** buffers;
+        struct ArrowArray** children;
+        struct ArrowArray* dictionary;
+        void (*release)(struct ArrowArray*);
+        void* private_data;
+    };
+}
+
+#endif
+
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    //--- per-type formats ---------------------------------------------------------------------------------------------
+
+    template <typename T, typename = void>
+    struct arrow_format_
+    {
+        static constexpr const char* value = nullptr;
+    };
+    template <>
+    struct arrow_format_<bool>
+    {
+        static constexpr const char* value = "b";
+    };
+    template <typename T>
+    struct arrow_format_<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr const char* value = sizeof(T) == 1 ? (std::is_signed_v<T> ? "c" : "C")
+                                           : sizeof(T) == 2 ? (std::is_signed_v<T> ? "s" : "S")
+                                           : sizeof(T) == 4 ? (std::is_signed_v<T> ? "i" : "I")
+                                           : sizeof(T) == 8 ? (std::is_signed_v<T> ? "l" : "L")
+                                                            : nullptr;
+    };
+    template <>
+    struct arrow_format_<float>
+    {
+        static constexpr const char* value = "f";
+    };
+    template <>
+    struct arrow_format_<double>
+    {
+        static constexpr const char* value = "g";
+    };
+    template <typename Traits, typename Allocator>
+    struct arrow_format_<std::basic_string<char, Traits, Allocator>>
+    {
+        static constexpr const char* value = "U"; // exported as large_utf8; "u" is also accepted on import
+    };
+    template <typename T>
+    inline constexpr const char* arrow_format = arrow_format_<T>::value;
+
+    template <typename T>
+    inline constexpr bool is_arrow_primitive = arrow_format<T> != nullptr
+                                            && (std::is_integral_v<T> || std::is_floating_point_v<T>)
+                                            && !std::is_same_v<T, bool>;
+
+    template <typename T>
+    inline constexpr bool is_arrow_string = arrow_format<T> != nullptr && !std::is_arithmetic_v<T>;
+
+    template <typename Soa, size_t Column>
+    using arrow_column_type = std::remove_cv_t<value_type<Soa, Column>>;
+
+    template <typename Soa, size_t... Columns>
+    SOAGEN_CONST_GETTER
+    constexpr bool arrow_exportable(std::index_sequence<Columns...>) noexcept
+    {
+        return (true && ... && (arrow_format<arrow_column_type<Soa, Columns>> != nullptr));
+    }
+
+    inline constexpr std::int64_t arrow_zeros[2] = {}; // stand-in for the buffers of empty columns
+
+    //--- release callbacks --------------------------------------------------------------------------------------------
+
+    // every exported struct (parent and children alike) holds a reference to the shared export state so children
+    // can be moved out of their parent and released independently, as permitted by the spec.
+
+    template <typename Holder>
+    void arrow_release(ArrowArray* array) noexcept
+    {
+        SOAGEN_ASSUME(array != nullptr);
+
+        for (int64_t i = 0; i < array->n_children; i++)
+            if (auto child = array->children[i]; child->release)
+                child->release(child);
+
+        delete static_cast<std::shared_ptr<Holder>*>(array->private_data);
+        array->release = nullptr;
+    }
+
+    template <typename Holder>
+    void arrow_release(ArrowSchema* schema) noexcept
+    {
+        SOAGEN_ASSUME(schema != nullptr);
+
+        for (int64_t i = 0; i < schema->n_children; i++)
+            if (auto child = schema->children[i]; child->release)
+                child->release(child);
+
+        delete static_cast<std::shared_ptr<Holder>*>(schema->private_data);
+        schema->release = nullptr;
+    }
+
+    //--- export state -------------------------------------------------------------------------------------------------
+
+    template <typename Soa>
+    struct arrow_array_export
+    {
+        static constexpr size_t column_count = table_traits_type<Soa>::column_count;
+
+        std::shared_ptr<const Soa> soa;
+        ArrowArray children[column_count];
+        ArrowArray* child_pointers[column_count];
+        const void* buffers[1]                     = {}; // struct arrays have only a validity buffer
+        const void* child_buffers[column_count][3] = {};
+        std::vector<std::byte> converted[column_count]; // columns that can't be exported zero-copy (bool, strings)
+    };
+
+    template <size_t ColumnCount>
+    struct arrow_schema_export
+    {
+        ArrowSchema children[ColumnCount];
+        ArrowSchema* child_pointers[ColumnCount];
+        std::string names[ColumnCount];
+    };
+
+    template <typename Soa, size_t Column>
+    void arrow_export_column(arrow_array_export<Soa>& state, ArrowArray& array)
+    {
+        using type = arrow_column_type<Soa, Column>;
+
+        const auto& soa   = *state.soa;
+        const auto count  = static_cast<size_t>(soa.size());
+        auto& buffers     = state.child_buffers[Column];
+        const auto* zeros = static_cast<const void*>(arrow_zeros);
+
+        array.length     = static_cast<int64_t>(count);
+        array.null_count = 0;
+        array.offset     = 0;
+        array.n_buffers  = 2;
+        array.n_children = 0;
+        array.buffers    = buffers;
+        array.children   = nullptr;
+        array.dictionary = nullptr;
+        buffers[0]       = nullptr; // validity
+
+        if constexpr (is_arrow_primitive<type>)
+        {
+            // zero-copy
+            buffers[1] = count ? static_cast<const void*>(soa.template column<Column>()) : zeros;
+        }
+        else if constexpr (std::is_same_v<type, bool>)
+        {
+            auto& bits = state.converted[Column];
+            bits.resize((count + 7u) / 8u + 1u);
+            const auto values = soa.template column<Column>();
+            for (size_t i = 0; i < count; i++)
+                if (values[i])
+                    bits[i / 8u] |= static_cast<std::byte>(1u << (i % 8u));
+            buffers[1] = bits.data();
+        }
+        else
+        {
+            static_assert(is_arrow_string<type>);
+
+            const auto values = soa.template column<Column>();
+            size_t total      = {};
+            for (size_t i = 0; i < count; i++)
+                total += values[i].size();
+
+            // [ int64 offsets (count + 1) | character data ]
+            auto& buf = state.converted[Column];
+            buf.resize(sizeof(std::int64_t) * (count + 1u) + total + 1u);
+            auto offsets = reinterpret_cast<std::int64_t*>(buf.data());
+            auto chars   = buf.data() + sizeof(std::int64_t) * (count + 1u);
+            offsets[0]   = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                std::memcpy(chars + offsets[i], values[i].data(), values[i].size());
+                offsets[i + 1u] = offsets[i] + static_cast<std::int64_t>(values[i].size());
+            }
+
+            array.n_buffers = 3;
+            buffers[1]      = offsets;
+            buffers[2]      = chars;
+        }
+    }
+
+    template <typename Soa, size_t... Columns>
+    void arrow_export(std::shared_ptr<const Soa> soa,
+                      ArrowArray* out_array,
+                      ArrowSchema* out_schema,
+                      std::index_sequence<Columns...>)
+    {
+        static constexpr size_t column_count = sizeof...(Columns);
+
+        // array
+        if (out_array)
+        {
+            using state_type = arrow_array_export<Soa>;
+
+            auto state = std::make_shared<state_type>();
+            state->soa = static_cast<std::shared_ptr<const Soa>&&>(soa);
+            (arrow_export_column<Soa, Columns>(*state, state->children[Columns]), ...);
+
+            const auto count = static_cast<int64_t>(state->soa->size());
+            for (size_t i = 0; i < column_count; i++)
+            {
+                state->child_pointers[i]         = &state->children[i];
+                state->children[i].release       = arrow_release<state_type>;
+                state->children[i].private_data  = new std::shared_ptr<state_type>(state);
+            }
+
+            *out_array = ArrowArray{ count,
+                                     0,
+                                     0,
+                                     1,
+                                     static_cast<int64_t>(column_count),
+                                     state->buffers,
+                                     state->child_pointers,
+                                     nullptr,
+                                     arrow_release<state_type>,
+                                     nullptr };
+            out_array->private_data = new std::shared_ptr<state_type>(static_cast<std::shared_ptr<state_type>&&>(state));
+        }
+
+        // schema
+        if (out_schema)
+        {
+            using state_type = arrow_schema_export<column_count>;
+
+            auto state = std::make_shared<state_type>();
+            const auto make_child = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+
+                auto& name = state->names[column];
+                name       = column_name<Soa, column>::value;
+                if (name.empty())
+                    name = std::to_string(column);
+
+                state->child_pointers[column] = &state->children[column];
+                state->children[column]       = ArrowSchema{ arrow_format<arrow_column_type<Soa, column>>,
+                                                       name.c_str(),
+                                                       nullptr,
+                                                       0,
+                                                       0,
+                                                       nullptr,
+                                                       nullptr,
+                                                       arrow_release<state_type>,
+                                                       new std::shared_ptr<state_type>(state) };
+            };
+            (make_child(index_constant<Columns>{}), ...);
+
+            *out_schema = ArrowSchema{ "+s",
+                                       "",
+                                       nullptr,
+                                       0,
+                                       static_cast<int64_t>(column_count),
+                                       state->child_pointers,
+                                       nullptr,
+                                       arrow_release<state_type>,
+                                       nullptr };
+            out_schema->private_data =
+                new std::shared_ptr<state_type>(static_cast<std::shared_ptr<state_type>&&>(state));
+        }
+    }
+
+    //--- import -------------------------------------------------------------------------------------------------------
+
+    // soagen columns can't represent nulls, so any array that might have some is rejected. a null_count of -1 means
+    // "not computed", in which case a validity bitmap has to be assumed to mark some.
+    SOAGEN_PURE_GETTER
+    inline bool arrow_may_have_nulls(const ArrowArray& array) noexcept
+    {
+        return array.null_count > 0
+            || (array.null_count && array.n_buffers > 0 && array.buffers && array.buffers[0]);
+    }
+
+    template <typename T>
+    SOAGEN_NODISCARD
+    bool arrow_validate_column(const ArrowArray& array, const ArrowSchema& schema, size_t length) noexcept
+    {
+        if (!schema.format || array.length < 0 || array.offset < 0 || static_cast<size_t>(array.length) != length
+            || arrow_may_have_nulls(array) || !array.buffers)
+            return false;
+
+        const std::string_view format{ schema.format };
+        if constexpr (is_arrow_string<T>)
+            return (format == "U" || format == "u") && array.n_buffers == 3
+                && (!length || (array.buffers[1] && array.buffers[2]));
+        else
+            return format == arrow_format<T> && array.n_buffers == 2 && (!length || array.buffers[1]);
+    }
+
+    template <typename Soa, size_t Column>
+    void arrow_import_column(Soa& soa, const ArrowArray& array, const ArrowSchema& schema, size_t& constructed)
+    {
+        using column = typename table_traits_type<Soa>::template column<Column>;
+        using type   = arrow_column_type<Soa, Column>;
+
+        auto dest = table_storage_access::allocation(static_cast<table_type<Soa>&>(soa)).columns[Column];
+        const auto count  = static_cast<size_t>(array.length);
+        const auto offset = static_cast<size_t>(array.offset);
+        if (!count)
+            return;
+
+        if constexpr (is_arrow_primitive<type>)
+        {
+            std::memcpy(dest, static_cast<const type*>(array.buffers[1]) + offset, sizeof(type) * count);
+            constructed = count;
+        }
+        else if constexpr (std::is_same_v<type, bool>)
+        {
+            const auto bits = static_cast<const std::uint8_t*>(array.buffers[1]);
+            for (; constructed < count; constructed++)
+            {
+                const auto bit = offset + constructed;
+                column::construct_at(dest, constructed, ((bits[bit / 8u] >> (bit % 8u)) & 1u) != 0u);
+            }
+        }
+        else
+        {
+            const auto chars = static_cast<const char*>(array.buffers[2]);
+            const auto read  = [&](const auto* offsets)
+            {
+                for (; constructed < count; constructed++)
+                {
+                    const auto start = static_cast<size_t>(offsets[offset + constructed]);
+                    const auto end   = static_cast<size_t>(offsets[offset + constructed + 1u]);
+                    column::construct_at(dest, constructed, chars + start, end - start);
+                }
+            };
+
+            // large_utf8 ("U") has 64-bit offsets, utf8 ("u") 32-bit
+            if (schema.format[0] == 'U')
+                read(static_cast<const std::int64_t*>(array.buffers[1]));
+            else
+                read(static_cast<const std::int32_t*>(array.buffers[1]));
+        }
+    }
+
+    template <typename Soa, size_t... Columns>
+    SOAGEN_NODISCARD
+    bool arrow_import(Soa& soa, const ArrowArray& array, const ArrowSchema& schema, std::index_sequence<Columns...>)
+    {
+        using traits = table_traits_type<Soa>;
+        using table  = table_type<Soa>;
+
+        if (!schema.format || std::string_view{ schema.format } != "+s"
+            || schema.n_children != static_cast<int64_t>(traits::column_count)
+            || array.n_children != static_cast<int64_t>(traits::column_count) || array.length < 0
+            || array.offset != 0 || arrow_may_have_nulls(array))
+            return false;
+
+        const auto count = static_cast<size_t>(array.length);
+        if (!(arrow_validate_column<arrow_column_type<Soa, Columns>>(*array.children[Columns],
+                                                                                      *schema.children[Columns],
+                                                                                      count)
+              && ...))
+            return false;
+
+        if (!count)
+            return true;
+
+        auto& tbl = static_cast<table&>(soa);
+        tbl.reserve(count);
+
+        // destroys any constructed elements if a later column throws
+        struct columns_guard
+        {
+            table& tbl;
+            size_t constructed[traits::column_count] = {};
+            bool committed                           = false;
+
+            ~columns_guard() noexcept
+            {
+                if (committed)
+                    return;
+                const auto& alloc = table_storage_access::allocation(tbl);
+                const auto destruct = [&](auto ic) noexcept
+                {
+                    constexpr size_t column = decltype(ic)::value;
+                    for (size_t i = 0; i < constructed[column]; i++)
+                        traits::template column<column>::destruct(alloc.columns[column], i);
+                };
+                (destruct(index_constant<Columns>{}), ...);
+            }
+        } guard{ tbl };
+
+        (arrow_import_column<Soa, Columns>(soa, *array.children[Columns], *schema.children[Columns], guard.constructed[Columns]),
+         ...);
+
+        guard.committed = true;
+        table_storage_access::set_size(tbl, count);
+        return true;
+    }
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief True if every column of an SoA type can be exchanged via the Arrow C Data Interface.
+    ///
+    /// @details Supported column types are integers, `float`, `double`, `bool` and `std::string`.
+    template <typename T>
+    inline constexpr bool is_arrow_exportable =
+        POXY_IMPLEMENTATION_DETAIL(detail::arrow_exportable<soa_type<T>>(column_indices<soa_type<T>>{}));
+
+    /// @brief Exports an SoA container as an Arrow struct array via the
+    ///        <a href="https://arrow.apache.org/docs/format/CDataInterface.html">Arrow C Data Interface</a>.
+    ///
+    /// @details Each column becomes one child array (named after the column). Integer and floating-point columns are
+    ///          exported zero-copy; their Arrow buffers point directly at the container's columns, which are kept alive
+    ///          until every exported array (the parent and any children moved out of it) has been released.
+    ///          `bool` columns are bit-packed and `std::string` columns are converted to `large_utf8`.
+    ///
+    /// @param soa			The container to export. It must not be modified until the array has been released.
+    /// @param out_array	The array to initialize. May be `nullptr` if only the schema is needed.
+    /// @param out_schema	The schema to initialize. May be `nullptr` if only the array is needed.
+    template <typename Soa>
+    void to_arrow(std::shared_ptr<Soa> soa, ArrowArray* out_array, ArrowSchema* out_schema = nullptr)
+    {
+        using soa_type = std::remove_cv_t<Soa>;
+        static_assert(is_soa<soa_type>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<soa_type>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(soa != nullptr);
+
+        detail::arrow_export<soa_type>(std::shared_ptr<const soa_type>{ static_cast<std::shared_ptr<Soa>&&>(soa) },
+                                       out_array,
+                                       out_schema,
+                                       std::make_index_sequence<table_traits_type<soa_type>::column_count>{});
+    }
+
+    /// @brief Exports an SoA container as an Arrow struct array, taking ownership of it.
+    ///
+    /// @details The container is moved into the exported array's private data and destroyed when the array is
+    ///          released. See the `shared_ptr` overload for details.
+    SOAGEN_CONSTRAINED_TEMPLATE(is_soa<Soa>, typename Soa)
+    void to_arrow(Soa&& soa, ArrowArray* out_array, ArrowSchema* out_schema = nullptr)
+    {
+        to_arrow(std::make_shared<Soa>(static_cast<Soa&&>(soa)), out_array, out_schema);
+    }
+
+    /// @brief Exports the Arrow schema for an SoA type.
+    template <typename Soa>
+    void to_arrow_schema(ArrowSchema* out_schema)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<Soa>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(out_schema != nullptr);
+
+        detail::arrow_export<Soa>(nullptr,
+                                  nullptr,
+                                  out_schema,
+                                  std::make_index_sequence<table_traits_type<Soa>::column_count>{});
+    }
+
+    /// @brief Imports an Arrow struct array into an SoA container, replacing its contents.
+    ///
+    /// @details The array must have one child per column, in column order, with formats matching the column types
+    ///          (`std::string` columns accept both `utf8` and `large_utf8`) and no nulls. Column data is copied
+    ///          into the container with a single `reserve()`; primitive columns are copied with one `memcpy` each.
+    ///          The indexes and handles of soagen-generated types are rebuilt once all rows have been imported.
+    ///
+    /// @param soa		The container to import into.
+    /// @param array	The array to import. It is always released by this function (as per the C Data Interface's
+    ///					ownership rules), whether or not the import succeeded.
+    /// @param schema	The schema describing `array`. It is not released.
+    ///
+    /// @returns True if the array was imported. Returns false (leaving `soa` empty) if the array's shape or types do
+    ///          not match the SoA type.
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool from_arrow(Soa& soa, ArrowArray* array, const ArrowSchema* schema)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<Soa>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(array != nullptr);
+        SOAGEN_ASSUME(schema != nullptr);
+
+        struct array_releaser
+        {
+            ArrowArray* array;
+
+            ~array_releaser() noexcept
+            {
+                if (array->release)
+                    array->release(array);
+            }
+        } releaser{ array };
+
+        soa.clear();
+        if (!array->release)
+            return false;
+
+        if (!detail::arrow_import(soa,
+                                  *array,
+                                  *schema,
+                                  std::make_index_sequence<table_traits_type<Soa>::column_count>{}))
+            return false;
+
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
+}
+
+#include "header_end.hpp"
@@ -0,0 +1,690 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <functional>
+#include <iterator>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    template <typename, typename>
+    class bitmap_index;
+
+    /// @brief	A set of row indices stored as a bitmask, one bit per row.
+    ///
+    /// @details	Returned by queries on a #soagen::bitmap_index. Sets describing the same table can be combined
+    ///				with `&`, `|`, `^` and `~` a word at a time, and iterating over one yields the indices of the
+    ///				rows in the set in ascending order. Can be passed directly to the constructor of a
+    ///				#soagen::selection (or its words to #soagen::selection::from_bitmask()).
+    ///
+    /// @attention	A set describes the table as it was when the set was created; sets of different sizes may not
+    ///				be combined.
+    class row_bitset
+    {
+      public:
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief Iterates over the indices of the rows in a #soagen::row_bitset.
+        class iterator
+        {
+          public:
+            using value_type        = size_type;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = size_type;
+            using pointer           = void;
+            using iterator_category = std::forward_iterator_tag;
+
+          private:
+            const std::uint64_t* words_ = {};
+            size_type word_count_       = {};
+            size_type word_             = {};
+            std::uint64_t bits_         = {};
+
+            void skip_empty_words() noexcept
+            {
+                while (!bits_ && ++word_ < word_count_)
+                    bits_ = words_[word_];
+            }
+
+            friend class row_bitset;
+
+            SOAGEN_NODISCARD_CTOR
+            iterator(const std::uint64_t* words, size_type word_count, size_type word) noexcept //
+                : words_{ words },
+                  word_count_{ word_count },
+                  word_{ word },
+                  bits_{ word < word_count ? words[word] : 0u }
+            {
+                if (word_ < word_count_)
+                    skip_empty_words();
+            }
+
+          public:
+            /// @brief Default constructor.
+            SOAGEN_NODISCARD_CTOR
+            iterator() noexcept = default;
+
+            /// @brief Returns the index of the current row.
+            SOAGEN_PURE_INLINE_GETTER
+            size_type operator*() const noexcept
+            {
+                SOAGEN_ASSUME(bits_ != 0u);
+
+                return word_ * 64u + static_cast<size_type>(countr_zero(bits_));
+            }
+
+            /// @brief Pre-increment operator.
+            iterator& operator++() noexcept
+            {
+                bits_ &= bits_ - 1u;
+                skip_empty_words();
+                return *this;
+            }
+
+            /// @brief Post-increment operator.
+            iterator operator++(int) noexcept
+            {
+                iterator prev = *this;
+                ++(*this);
+                return prev;
+            }
+
+            /// @brief Returns true if two iterators refer to the same position.
+            SOAGEN_PURE_INLINE_GETTER
+            friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return lhs.word_ == rhs.word_ && lhs.bits_ == rhs.bits_;
+            }
+
+            /// @brief Returns true if two iterators refer to different positions.
+            SOAGEN_PURE_INLINE_GETTER
+            friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+        };
+
+        /// @brief The const iterator type.
+        using const_iterator = iterator;
+
+      private:
+        std::vector<std::uint64_t> words_;
+        size_type size_ = {};
+
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type words_for(size_type rows) noexcept
+        {
+            return (rows + 63u) / 64u;
+        }
+
+        void mask_tail() noexcept
+        {
+            if (const auto bits = size_ % 64u; bits)
+                words_.back() &= (std::uint64_t{ 1 } << bits) - 1u;
+        }
+
+        // adjusts the number of rows; new rows are not in the set. doesn't allocate if reserve()'d.
+        void resize(size_type rows)
+        {
+            words_.resize(words_for(rows));
+            size_ = rows;
+            mask_tail();
+        }
+
+        void reserve(size_type rows)
+        {
+            words_.reserve(words_for(rows));
+        }
+
+        // inserts a row that is not in the set before row `pos`, shifting subsequent rows up by one
+        void insert_row(size_type pos)
+        {
+            SOAGEN_ASSERT(pos <= size_);
+
+            resize(size_ + 1u);
+            const size_type first = pos / 64u;
+            for (size_type w = words_.size() - 1u; w > first; w--)
+                words_[w] = (words_[w] << 1) | (words_[w - 1u] >> 63);
+
+            const std::uint64_t low = (std::uint64_t{ 1 } << (pos % 64u)) - 1u;
+            words_[first]           = (words_[first] & low) | ((words_[first] & ~low) << 1);
+        }
+
+        // removes row `pos`, shifting subsequent rows down by one
+        void erase_row(size_type pos) noexcept
+        {
+            SOAGEN_ASSERT(pos < size_);
+
+            const size_type first   = pos / 64u;
+            const size_type last    = words_.size() - 1u;
+            const std::uint64_t low = (std::uint64_t{ 1 } << (pos % 64u)) - 1u;
+
+            words_[first] = (words_[first] & low) | ((words_[first] >> 1) & ~low);
+            for (size_type w = first + 1u; w <= last; w++)
+            {
+                words_[w - 1u] |= words_[w] << 63;
+                words_[w] >>= 1;
+            }
+
+            words_.resize(words_for(size_ - 1u));
+            size_--;
+            mask_tail();
+        }
+
+        template <typename, typename>
+        friend class bitmap_index;
+
+      public:
+        /// @brief Default constructor. Creates an empty set describing zero rows.
+        SOAGEN_NODISCARD_CTOR
+        row_bitset() noexcept = default;
+
+        /// @brief Creates an empty set describing `rows` rows.
+        SOAGEN_NODISCARD_CTOR
+        explicit row_bitset(size_type rows) //
+            : words_(words_for(rows)),
+              size_{ rows }
+        {}
+
+        /// @brief Returns the number of rows the set describes (not the number of rows in the set).
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns a pointer to the set's underlying words, least-significant-bit first.
+        SOAGEN_PURE_INLINE_GETTER
+        const std::uint64_t* words() const noexcept
+        {
+            return words_.data();
+        }
+
+        /// @brief Returns the number of 64-bit words in the set.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type word_count() const noexcept
+        {
+            return words_.size();
+        }
+
+        /// @brief Returns the number of rows in the set.
+        SOAGEN_PURE_GETTER
+        size_type count() const noexcept
+        {
+            size_type n = 0;
+            for (auto w : words_)
+                n += static_cast<size_type>(popcount(w));
+            return n;
+        }
+
+        /// @brief Returns true if any rows are in the set.
+        SOAGEN_PURE_GETTER
+        bool any() const noexcept
+        {
+            for (auto w : words_)
+                if (w)
+                    return true;
+            return false;
+        }
+
+        /// @brief Returns true if no rows are in the set.
+        SOAGEN_PURE_INLINE_GETTER
+        bool none() const noexcept
+        {
+            return !any();
+        }
+
+        /// @brief Returns true if a row is in the set.
+        SOAGEN_PURE_INLINE_GETTER
+        bool test(size_type row) const noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
+
+            return (words_[row / 64u] >> (row % 64u)) & 1u;
+        }
+
+        /// @brief Adds a row to the set.
+        row_bitset& set(size_type row) noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
+
+            words_[row / 64u] |= std::uint64_t{ 1 } << (row % 64u);
+            return *this;
+        }
+
+        /// @brief Removes a row from the set.
+        row_bitset& reset(size_type row) noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
+
+            words_[row / 64u] &= ~(std::uint64_t{ 1 } << (row % 64u));
+            return *this;
+        }
+
+        /// @brief Returns the index of the first row in the set, or an empty optional.
+        SOAGEN_PURE_GETTER
+        optional<size_type> first() const noexcept
+        {
+            for (size_type w = 0; w < words_.size(); w++)
+                if (words_[w])
+                    return w * 64u + static_cast<size_type>(countr_zero(words_[w]));
+            return {};
+        }
+
+        /// @brief Inverts the set, so it contains exactly the rows it didn't before.
+        row_bitset& flip() noexcept
+        {
+            for (auto& w : words_)
+                w = ~w;
+            if (!words_.empty())
+                mask_tail();
+            return *this;
+        }
+
+        /// @brief Intersects this set with another.
+        row_bitset& operator&=(const row_bitset& rhs) noexcept
+        {
+            SOAGEN_ASSERT(size_ == rhs.size_);
+
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] &= rhs.words_[w];
+            return *this;
+        }
+
+        /// @brief Unites this set with another.
+        row_bitset& operator|=(const row_bitset& rhs) noexcept
+        {
+            SOAGEN_ASSERT(size_ == rhs.size_);
+
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] |= rhs.words_[w];
+            return *this;
+        }
+
+        /// @brief Sets this set to the symmetric difference of itself and another.
+        row_bitset& operator^=(const row_bitset& rhs) noexcept
+        {
+            SOAGEN_ASSERT(size_ == rhs.size_);
+
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] ^= rhs.words_[w];
+            return *this;
+        }
+
+        /// @brief Returns the intersection of two sets.
+        SOAGEN_NODISCARD
+        friend row_bitset operator&(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs &= rhs);
+        }
+
+        /// @brief Returns the union of two sets.
+        SOAGEN_NODISCARD
+        friend row_bitset operator|(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs |= rhs);
+        }
+
+        /// @brief Returns the symmetric difference of two sets.
+        SOAGEN_NODISCARD
+        friend row_bitset operator^(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs ^= rhs);
+        }
+
+        /// @brief Returns the complement of a set.
+        SOAGEN_NODISCARD
+        friend row_bitset operator~(row_bitset set) noexcept
+        {
+            return static_cast<row_bitset&&>(set.flip());
+        }
+
+        /// @brief Returns true if two sets describe the same number of rows and contain the same rows.
+        SOAGEN_PURE_GETTER
+        friend bool operator==(const row_bitset& lhs, const row_bitset& rhs) noexcept
+        {
+            return lhs.size_ == rhs.size_ && lhs.words_ == rhs.words_;
+        }
+
+        /// @brief Returns true if two sets describe a different number of rows or contain different rows.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const row_bitset& lhs, const row_bitset& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        /// @brief Returns an iterator to the first row in the set.
+        SOAGEN_PURE_INLINE_GETTER
+        iterator begin() const noexcept
+        {
+            return { words_.data(), words_.size(), 0u };
+        }
+
+        /// @brief Returns an iterator to one-past-the-last row in the set.
+        SOAGEN_PURE_INLINE_GETTER
+        iterator end() const noexcept
+        {
+            return { words_.data(), words_.size(), words_.size() };
+        }
+    };
+
+    /// @brief	A bitmap index over the values of a single low-cardinality column (e.g. an enum).
+    ///
+    /// @details	The index keeps one #soagen::row_bitset per distinct value in the column, so equality predicates
+    ///				on several indexed columns can be combined a 64-bit word at a time. Values no longer present in
+    ///				the column are dropped from the index. Each mutation touches every distinct value's bitset, and
+    ///				looking up a value's bitset is a linear search through the distinct values, so both queries and
+    ///				mutations are O(cardinality) and the index is a poor fit for columns with many distinct values.
+    ///
+    /// @details	Notification functions follow the same protocol as #soagen::hash_index: those describing rows being
+    ///				removed must be called <i>before</i> the table is modified; those describing rows being added must
+    ///				be called <i>after</i>, having first called #reserve(). Passing the new row's value to #reserve()
+    ///				adds it to the index up-front, so the #push_back() or #insert() that follows can't throw.
+    ///
+    /// @tparam Key			The column's value type.
+    /// @tparam KeyEqual	The key equality predicate.
+    template <typename Key, typename KeyEqual = std::equal_to<Key>>
+    class bitmap_index
+    {
+      public:
+        /// @brief The key (column value) type.
+        using key_type = Key;
+
+        /// @brief The key equality predicate type.
+        using key_equal = KeyEqual;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        std::vector<key_type> values_;
+        std::vector<row_bitset> bitsets_;
+        std::vector<size_type> counts_;
+        row_bitset spare_; // storage for the next new value, so adding one after reserve() doesn't allocate
+        size_type rows_ = {};
+        key_equal key_equal_;
+
+        SOAGEN_PURE_GETTER
+        size_type slot_of(const key_type& key) const noexcept
+        {
+            for (size_type i = 0; i < values_.size(); i++)
+                if (key_equal_(values_[i], key))
+                    return i;
+            return npos;
+        }
+
+        size_type slot_for(const key_type& key)
+        {
+            if (const auto slot = slot_of(key); slot != npos)
+                return slot;
+
+            // everything that can throw happens before any of the vectors are grown, so they stay in step
+            values_.reserve(values_.size() + 1u);
+            counts_.reserve(values_.size() + 1u);
+            bitsets_.reserve(values_.size() + 1u);
+            spare_.resize(rows_);
+            for (auto& w : spare_.words_)
+                w = 0u;
+
+            values_.push_back(key);
+            counts_.push_back(0u);
+            bitsets_.push_back(static_cast<row_bitset&&>(spare_));
+            spare_ = row_bitset{};
+            return values_.size() - 1u;
+        }
+
+        void drop_empty_values() noexcept
+        {
+            for (size_type i = values_.size(); i-- > 0u;)
+            {
+                if (counts_[i])
+                    continue;
+
+                if (i + 1u < values_.size())
+                {
+                    using std::swap;
+                    swap(values_[i], values_.back());
+                    swap(counts_[i], counts_.back());
+                    swap(bitsets_[i], bitsets_.back());
+                }
+                values_.pop_back();
+                counts_.pop_back();
+                if (bitsets_.back().words_.capacity() > spare_.words_.capacity())
+                    spare_ = static_cast<row_bitset&&>(bitsets_.back());
+                bitsets_.pop_back();
+            }
+        }
+
+        void resize_all(size_type rows)
+        {
+            rows_ = rows;
+            for (auto& b : bitsets_)
+                b.resize(rows);
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        bitmap_index() = default;
+
+        /// @brief Constructs with the given equality predicate.
+        SOAGEN_NODISCARD_CTOR
+        explicit bitmap_index(const key_equal& eq) //
+            : key_equal_{ eq }
+        {}
+
+        /// @brief Returns the number of rows in the index.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return rows_;
+        }
+
+        /// @brief Returns true if the index is empty.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !rows_;
+        }
+
+        /// @brief Returns the number of distinct values in the column.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type cardinality() const noexcept
+        {
+            return values_.size();
+        }
+
+        /// @brief Ensures the index can hold at least `rows` rows and one new distinct value without allocating.
+        void reserve(size_type rows)
+        {
+            drop_empty_values(); // left behind by the two-argument overload if the table modification threw
+
+            values_.reserve(values_.size() + 1u);
+            counts_.reserve(values_.size() + 1u);
+            bitsets_.reserve(values_.size() + 1u);
+            spare_.reserve(rows);
+            for (auto& b : bitsets_)
+                b.reserve(rows);
+        }
+
+        /// @brief Ensures the index can hold at least `rows` rows, and adds `key` to it ahead of a row with that
+        ///        value being added to the table.
+        ///
+        /// @details Adding a new distinct value copies it; doing so here, before the table is modified, means the
+        ///          #push_back() or #insert() that follows can't throw. Keys of any other type only reserve.
+        template <typename K>
+        void reserve(size_type rows, const K& key)
+        {
+            reserve(rows);
+            if constexpr (std::is_same_v<K, key_type>)
+                slot_for(key);
+        }
+
+        /// @brief Returns the rows whose column value is equal to `key`.
+        SOAGEN_NODISCARD
+        row_bitset matching(const key_type& key) const
+        {
+            if (const auto slot = slot_of(key); slot != npos)
+                return bitsets_[slot];
+            return row_bitset{ rows_ };
+        }
+
+        /// @brief Returns the number of rows whose column value is equal to `key`.
+        SOAGEN_PURE_GETTER
+        size_type count(const key_type& key) const noexcept
+        {
+            const auto slot = slot_of(key);
+            return slot != npos ? counts_[slot] : 0u;
+        }
+
+        /// @brief Finds a row whose column value is equal to `key`.
+        ///
+        /// @returns The index of the first matching row, or an empty optional.
+        SOAGEN_NODISCARD
+        optional<size_type> find(const key_type* /* keys */, const key_type& key) const noexcept
+        {
+            if (const auto slot = slot_of(key); slot != npos)
+                return bitsets_[slot].first();
+            return {};
+        }
+
+        /// @brief Discards the index's contents and re-indexes the first `count` rows of a column.
+        void rebuild(const key_type* keys, size_type count)
+        {
+            clear();
+            rows_ = count;
+            for (size_type row = 0; row < count; row++)
+            {
+                const auto slot = slot_for(keys[row]);
+                bitsets_[slot].set(row);
+                counts_[slot]++;
+            }
+        }
+
+        /// @brief Removes all rows from the index.
+        void clear() noexcept
+        {
+            values_.clear();
+            bitsets_.clear();
+            counts_.clear();
+            rows_ = 0;
+        }
+
+        /// @brief Notifies the index that a row was appended to the table.
+        ///
+        /// @param keys	The column's data.
+        /// @param row	The index of the new row (i.e. the table's new size, minus one).
+        void push_back(const key_type* keys, size_type row)
+        {
+            const auto slot = slot_for(keys[row]);
+            resize_all(row + 1u);
+            bitsets_[slot].set(row);
+            counts_[slot]++;
+        }
+
+        /// @brief Notifies the index that a row was inserted into the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the new row.
+        /// @param count	The table's new size.
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            const auto slot = slot_for(keys[row]);
+            for (auto& b : bitsets_)
+                b.insert_row(row);
+            rows_ = count;
+
+            bitsets_[slot].set(row);
+            counts_[slot]++;
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table (preserving order).
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            static_cast<void>(count);
+            SOAGEN_ASSERT(count == rows_);
+
+            counts_[slot_of(keys[row])]--;
+            for (auto& b : bitsets_)
+                b.erase_row(row);
+            rows_--;
+            drop_empty_values();
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table using the swap-and-pop idiom.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            SOAGEN_ASSERT(count == rows_);
+
+            const auto slot = slot_of(keys[row]);
+            bitsets_[slot].reset(row);
+            counts_[slot]--;
+
+            if (row + 1u < count)
+            {
+                auto& last = bitsets_[slot_of(keys[count - 1u])];
+                last.reset(count - 1u);
+                last.set(row);
+            }
+
+            for (auto& b : bitsets_)
+                b.resize(count - 1u); // shrinking; doesn't allocate
+            rows_--;
+            drop_empty_values();
+        }
+
+        /// @brief Notifies the index that rows are about to be removed from the end of the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param num		The number of rows being removed.
+        /// @param count	The table's current size.
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
+            {
+                clear();
+                return;
+            }
+
+            for (size_type row = count - num; row < count; row++)
+                counts_[slot_of(keys[row])]--;
+            for (auto& b : bitsets_)
+                b.resize(count - num);
+            rows_ = count - num;
+            drop_empty_values();
+        }
+
+        /// @brief Swaps the contents of the index with another.
+        void swap(bitmap_index& other) noexcept
+        {
+            using std::swap;
+            values_.swap(other.values_);
+            bitsets_.swap(other.bitsets_);
+            counts_.swap(other.counts_);
+            swap(spare_, other.spare_);
+            swap(rows_, other.rows_);
+            swap(key_equal_, other.key_equal_);
+        }
+    };
+}
+
+#include "header_end.hpp"
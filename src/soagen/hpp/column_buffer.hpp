@@ -0,0 +1,383 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <cstring>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    template <typename Allocator>
+    std::byte* allocate_column(Allocator& alloc, size_t bytes, size_t alignment)
+    {
+        return reinterpret_cast<std::byte*>(
+            allocator_traits<Allocator>::allocate(alloc, bytes, std::align_val_t{ alignment }));
+    }
+
+    template <typename Allocator>
+    void deallocate_column(Allocator& alloc, std::byte* ptr, size_t bytes) noexcept
+    {
+        using pointer = std::remove_reference_t<
+            decltype(allocator_traits<Allocator>::allocate(alloc, size_t{}, std::align_val_t{}))>;
+
+        allocator_traits<Allocator>::deallocate(alloc, reinterpret_cast<pointer>(ptr), bytes);
+    }
+
+    // moves a column out of a table's main buffer into an allocation of its own so it can change hands.
+    // this is the only part of an exchange that touches elements, and only happens once per column per allocation.
+    template <typename Table, size_t Column>
+    void separate_column(Table& tbl)
+    {
+        using column = typename table_traits_type<Table>::template column<Column>;
+
+        auto& alloc = table_storage_access::allocation(tbl);
+        if (!alloc || (alloc.separate && alloc.separate[Column]))
+            return;
+
+#if SOAGEN_INSTRUMENT
+        const table_event_timer timer;
+        const auto old_bytes = alloc.total_size();
+#endif
+
+        auto& allocator = table_storage_access::allocator(tbl);
+        if (!alloc.separate)
+        {
+            constexpr size_t count = table_traits_type<Table>::column_count;
+            alloc.separate         = reinterpret_cast<size_t*>(allocate_column(
+                allocator,
+                sizeof(size_t) * count,
+                max(alignof(size_t), allocator_traits<allocator_type<Table>>::min_alignment)));
+            for (size_t i = 0; i < count; i++)
+                alloc.separate[i] = 0u;
+        }
+
+        const size_t bytes = sizeof(typename column::storage_type) * tbl.capacity();
+        std::byte* buf     = allocate_column(allocator, bytes, actual_alignment<Table, Column>);
+        std::byte* src     = alloc.columns[Column];
+
+        if constexpr (column::is_trivially_copyable)
+        {
+            if (tbl.size())
+                std::memcpy(buf, src, sizeof(typename column::storage_type) * tbl.size());
+        }
+        else
+        {
+            size_t i = 0;
+#if SOAGEN_HAS_EXCEPTIONS
+            try
+            {
+#endif
+                for (; i < tbl.size(); i++)
+                    column::move_or_copy_construct(buf, i, src, i);
+#if SOAGEN_HAS_EXCEPTIONS
+            }
+            catch (...)
+            {
+                while (i)
+                    column::destruct(buf, --i);
+                deallocate_column(allocator, buf, bytes);
+                throw;
+            }
+#endif
+            for (i = tbl.size(); i-- > 0u;)
+                column::destruct(src, i);
+        }
+
+        alloc.columns[Column]  = buf;
+        alloc.separate[Column] = bytes;
+
+#if SOAGEN_INSTRUMENT
+        raise_table_event<Table, table_traits_type<Table>>(table_event::allocate,
+                                                           &tbl,
+                                                           tbl.capacity(),
+                                                           tbl.capacity(),
+                                                           old_bytes,
+                                                           alloc.total_size(),
+                                                           tbl.size(),
+                                                           timer.elapsed());
+#endif
+    }
+
+    template <typename A, size_t ColumnA, typename B, size_t ColumnB>
+    inline constexpr bool columns_exchangeable =
+        std::is_same_v<typename table_traits_type<A>::template storage_type<ColumnA>,
+                       typename table_traits_type<B>::template storage_type<ColumnB>>
+        && actual_alignment<A, ColumnA> == actual_alignment<B, ColumnB>
+        && std::is_same_v<allocator_type<A>, allocator_type<B>>;
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief	A standalone, fixed-capacity buffer holding the elements of one column.
+    ///
+    /// @details	Column buffers are laid out and allocated exactly like the corresponding column of a table, so
+    ///				they can be swapped in and out of tables with #soagen::exchange_column() by pointer. Use them to
+    ///				compute a column outside of a table (or to adopt one computed elsewhere) and hand it off without
+    ///				copying.
+    ///
+    /// @tparam Soa		The table or generated SoA type whose column this buffer is laid out like.
+    /// @tparam Column	The column index.
+    template <typename Soa, auto Column>
+    class column_buffer
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
+      public:
+        /// @brief The table type whose column this buffer is laid out like.
+        using table_type = soagen::table_type<Soa>;
+
+        /// @brief The column's value type.
+        using value_type = soagen::value_type<Soa, Column>;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The allocator type.
+        using allocator_type = soagen::allocator_type<Soa>;
+
+        /// @brief The alignment of the buffer.
+        static constexpr size_t alignment = actual_alignment<table_type, Column>;
+
+      private:
+        template <auto, typename Table, typename BufferSoa, auto BufferColumn>
+        friend void exchange_column(Table&, column_buffer<BufferSoa, BufferColumn>&);
+
+        using column       = typename table_traits_type<Soa>::template column<static_cast<size_t>(Column)>;
+        using storage_type = typename column::storage_type;
+
+        std::byte* data_    = {};
+        size_type size_     = {};
+        size_type capacity_ = {};
+        allocator_type alloc_;
+
+        void release() noexcept
+        {
+            clear();
+            if (data_)
+                detail::deallocate_column(alloc_, data_, sizeof(storage_type) * capacity_);
+            data_     = {};
+            capacity_ = {};
+        }
+
+      public:
+        /// @brief Creates a buffer with room for `capacity` elements.
+        ///
+        /// @details To exchange the buffer with a table column, `capacity` must match the table's `capacity()`.
+        SOAGEN_NODISCARD_CTOR
+        explicit column_buffer(size_type capacity = 0, const allocator_type& alloc = allocator_type{}) //
+            : capacity_{ capacity },
+              alloc_{ alloc }
+        {
+            if (capacity_)
+                data_ = detail::allocate_column(alloc_, sizeof(storage_type) * capacity_, alignment);
+        }
+
+        /// @brief Move constructor.
+        SOAGEN_NODISCARD_CTOR
+        column_buffer(column_buffer&& other) noexcept //
+            : data_{ std::exchange(other.data_, nullptr) },
+              size_{ std::exchange(other.size_, size_type{}) },
+              capacity_{ std::exchange(other.capacity_, size_type{}) },
+              alloc_{ other.alloc_ }
+        {}
+
+        /// @brief Move-assignment operator.
+        column_buffer& operator=(column_buffer&& other) noexcept
+        {
+            if (&other != this)
+            {
+                release();
+                data_     = std::exchange(other.data_, nullptr);
+                size_     = std::exchange(other.size_, size_type{});
+                capacity_ = std::exchange(other.capacity_, size_type{});
+                alloc_    = other.alloc_;
+            }
+            return *this;
+        }
+
+        column_buffer(const column_buffer&)            = delete;
+        column_buffer& operator=(const column_buffer&) = delete;
+
+        /// @brief Destructor.
+        ~column_buffer() noexcept
+        {
+            release();
+        }
+
+        /// @brief Returns the number of elements in the buffer.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns true if the buffer has no elements.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !size_;
+        }
+
+        /// @brief Returns the number of elements the buffer can hold.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /// @brief Returns a pointer to the elements.
+        SOAGEN_PURE_GETTER
+        value_type* data() noexcept
+        {
+            if constexpr (std::is_pointer_v<storage_type>)
+                return SOAGEN_LAUNDER(reinterpret_cast<value_type*>(data_));
+            else
+                return column::ptr(data_);
+        }
+
+        /// @brief Returns a pointer to the elements.
+        SOAGEN_PURE_GETTER
+        const value_type* data() const noexcept
+        {
+            return const_cast<column_buffer&>(*this).data();
+        }
+
+        /// @brief Returns the element at the given index.
+        SOAGEN_PURE_GETTER
+        value_type& operator[](size_type index) noexcept
+        {
+            SOAGEN_ASSERT(index < size_);
+
+            return data()[index];
+        }
+
+        /// @brief Returns the element at the given index.
+        SOAGEN_PURE_GETTER
+        const value_type& operator[](size_type index) const noexcept
+        {
+            SOAGEN_ASSERT(index < size_);
+
+            return data()[index];
+        }
+
+        /// @brief Constructs a new element at the end of the buffer.
+        ///
+        /// @attention The buffer does not grow; `size()` must be less than `capacity()`.
+        template <typename... Args>
+        value_type& emplace_back(Args&&... args)
+        {
+            SOAGEN_ASSERT(size_ < capacity_);
+
+            column::construct_at(data_, size_, static_cast<Args&&>(args)...);
+            return data()[size_++];
+        }
+
+        /// @brief Destroys all elements (the capacity is unchanged).
+        void clear() noexcept
+        {
+            while (size_)
+                column::destruct(data_, --size_);
+        }
+    };
+
+    /// @brief	Exchanges a column of one table with a column of another, by pointer.
+    ///
+    /// @details	The first exchange involving a particular column moves that column out of its table's main
+    ///				buffer into an allocation of its own (one pass over the elements). After that, exchanges are
+    ///				constant-time for as long as neither table reallocates.
+    ///
+    ///				Generated types with indexes have them rebuilt afterwards; if that throws, the table whose index
+    ///				failed is cleared.
+    ///
+    /// @attention	Both tables must have the same `size()` and `capacity()`, the two columns must have the same
+    ///				storage type and alignment, and the tables' allocators must compare equal. While a column is held
+    ///				separately it is not covered by `data()` and `allocation_size()`.
+    ///
+    /// @tparam ColumnA	The column of `a` to exchange.
+    /// @tparam ColumnB	The column of `b` to exchange.
+    SOAGEN_CONSTRAINED_TEMPLATE(is_soa<SoaB>, auto ColumnA, auto ColumnB = ColumnA, typename SoaA, typename SoaB)
+    void exchange_column(SoaA& a, SoaB& b)
+    {
+        static_assert(is_soa<SoaA>, "SoaA must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<SoaA> && !std::is_const_v<SoaB>, "tables may not be const");
+
+        using table_a          = table_type<SoaA>;
+        using table_b          = table_type<SoaB>;
+        constexpr size_t col_a = static_cast<size_t>(ColumnA);
+        constexpr size_t col_b = static_cast<size_t>(ColumnB);
+        static_assert(detail::columns_exchangeable<table_a, col_a, table_b, col_b>,
+                      "columns must have the same storage type, alignment and allocator type");
+
+        auto& ta = static_cast<table_a&>(a);
+        auto& tb = static_cast<table_b&>(b);
+        if constexpr (std::is_same_v<table_a, table_b>)
+        {
+            if (&ta == &tb)
+            {
+                ta.template swap_columns<col_a, col_b>();
+                detail::rebuild_value_indexes(a);
+                return;
+            }
+        }
+
+        SOAGEN_ASSERT(ta.size() == tb.size());
+        SOAGEN_ASSERT(ta.capacity() == tb.capacity());
+        SOAGEN_ASSERT(allocator_traits<allocator_type<table_a>>::equal(ta.get_allocator(), tb.get_allocator()));
+        if (!ta.capacity())
+            return;
+
+        detail::separate_column<table_a, col_a>(ta);
+        detail::separate_column<table_b, col_b>(tb);
+
+        auto& alloc_a = detail::table_storage_access::allocation(ta);
+        auto& alloc_b = detail::table_storage_access::allocation(tb);
+        std::swap(alloc_a.columns[col_a], alloc_b.columns[col_b]);
+        std::swap(alloc_a.separate[col_a], alloc_b.separate[col_b]);
+
+        detail::rebuild_value_indexes(a);
+        detail::rebuild_value_indexes(b);
+    }
+
+    /// @brief	Exchanges a column of a table with the contents of a #soagen::column_buffer, by pointer.
+    ///
+    /// @details	Use this to adopt a column computed outside of the table; afterwards the buffer holds the table's
+    ///				previous column. The same caveats as for exchanging with another table apply.
+    ///
+    /// @attention	The buffer's `size()` and `capacity()` must match the table's.
+    ///
+    /// @tparam Column	The column of `soa` to exchange.
+    template <auto Column, typename Soa, typename BufferSoa, auto BufferColumn>
+    void exchange_column(Soa& soa, column_buffer<BufferSoa, BufferColumn>& buffer)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<Soa>, "Soa may not be const");
+
+        using table          = table_type<Soa>;
+        constexpr size_t col = static_cast<size_t>(Column);
+        static_assert(detail::columns_exchangeable<table, col, BufferSoa, static_cast<size_t>(BufferColumn)>,
+                      "columns must have the same storage type, alignment and allocator type");
+
+        auto& tbl = static_cast<table&>(soa);
+        SOAGEN_ASSERT(tbl.size() == buffer.size());
+        SOAGEN_ASSERT(tbl.capacity() == buffer.capacity());
+        SOAGEN_ASSERT(allocator_traits<allocator_type<table>>::equal(tbl.get_allocator(), buffer.alloc_));
+        if (!tbl.capacity())
+            return;
+
+        detail::separate_column<table, col>(tbl);
+
+        auto& alloc = detail::table_storage_access::allocation(tbl);
+        std::swap(alloc.columns[col], buffer.data_);
+
+        detail::rebuild_value_indexes(soa);
+    }
+}
+
+#include "header_end.hpp"
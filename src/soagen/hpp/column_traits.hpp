@@ -8,6 +8,7 @@
 #include "emplacer.hpp"
 #include "enable_if.hpp"
 #include "tuples.hpp"
+#include "nontemporal.hpp"
 SOAGEN_DISABLE_WARNINGS;
 #include <new>
 SOAGEN_ENABLE_WARNINGS;
@@ -123,6 +124,22 @@ namespace soagen::detail
             SOAGEN_ASSUME(buffer != nullptr);
             SOAGEN_ASSUME(count);
 
+            // trivially-copyable types with a non-trivial constructor (e.g. default member initializers) all end up
+            // with the same bytes, so big runs of them can be stamped out from one without polluting the cache
+            if constexpr (std::is_trivially_copyable_v<storage_type>
+                          && !std::is_trivially_default_constructible_v<storage_type>
+                          && std::is_nothrow_default_constructible_v<storage_type>
+                          && can_nontemporal_fill<sizeof(storage_type)>)
+            {
+                if (count * sizeof(storage_type) >= nontemporal_threshold)
+                {
+                    const auto first = buffer + index * sizeof(storage_type);
+                    default_construct(first);
+                    nontemporal_fill<sizeof(storage_type)>(first + sizeof(storage_type), first, count - 1u);
+                    return;
+                }
+            }
+
 #if defined(__cpp_lib_start_lifetime_as) && __cpp_lib_start_lifetime_as >= 202207
             if constexpr (is_implicit_lifetime_type<storage_type>::value)
             {
@@ -182,6 +199,84 @@ namespace soagen::detail
             }
         }
 
+        //--- value construction ---------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        static constexpr storage_type& value_construct(std::byte* destination) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(destination != nullptr);
+
+            return *(::new (static_cast<void*>(destination)) storage_type());
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct(std::byte* buffer, size_t index, size_t count) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (std::is_trivially_copyable_v<storage_type>
+                          && std::is_nothrow_default_constructible_v<storage_type>)
+            {
+                // every element ends up with the same bytes, so construct one and stamp out the rest
+                const auto first = buffer + index * sizeof(storage_type);
+                value_construct(first);
+                broadcast(first + sizeof(storage_type), first, count - 1u);
+            }
+            else if constexpr (std::is_nothrow_default_constructible_v<storage_type>
+                               || std::is_trivially_destructible_v<storage_type>)
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    value_construct(buffer + index * sizeof(storage_type));
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                size_t i = index;
+
+                SOAGEN_TRY
+                {
+                    for (const size_t e = index + count; i < e; i++)
+                        value_construct(buffer + i * sizeof(storage_type));
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    for (; i-- > index;)
+                        destruct(buffer, i);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        // leaves trivially-default-constructible elements uninitialized (to be written directly, e.g. by read()) and
+        // value-initializes everything else
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct_for_overwrite(std::byte* buffer, size_t index, size_t count) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (std::is_trivially_default_constructible_v<storage_type>)
+            {
+                default_construct_for_overwrite(buffer, index, count);
+            }
+            else
+            {
+                value_construct(buffer, index, count);
+            }
+        }
+
         //--- construction ---------------------------------------------------------------------------------------------
 
         static constexpr bool is_trivially_copyable = std::is_trivially_copyable_v<storage_type>;
@@ -950,6 +1045,139 @@ namespace soagen::detail
                          count * sizeof(storage_type));
         }
 
+        //--- memcpy ---------------------------------------------------------------------------------
+
+        // like memmove() but the ranges mustn't overlap; big copies bypass the cache (see nontemporal_copy())
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_trivially_copyable)
+        static void memcpy(std::byte* dest_buffer,
+                           size_t dest_index,
+                           const std::byte* source_buffer,
+                           size_t source_index,
+                           size_t count = 1) noexcept
+        {
+            SOAGEN_ASSUME(dest_buffer != nullptr);
+            SOAGEN_ASSUME(source_buffer != nullptr);
+
+            const auto dest   = soagen_aligned_storage(dest_buffer + dest_index * sizeof(storage_type));
+            const auto source = soagen_aligned_storage(source_buffer + source_index * sizeof(storage_type));
+            const auto bytes  = count * sizeof(storage_type);
+            if constexpr (has_nontemporal_stores)
+            {
+                if (bytes >= nontemporal_threshold)
+                {
+                    nontemporal_copy(dest, source, bytes);
+                    return;
+                }
+            }
+            std::memcpy(dest, source, bytes);
+        }
+
+        //--- fill -----------------------------------------------------------------------------------------------------
+
+        // writes count copies of a trivially-copyable value: one memset() when its bytes are all the same (e.g. zero),
+        // otherwise fixed-size copies of a block of them (which compile to unrolled vector stores even at -O2, unlike
+        // a plain loop of element assignments)
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_trivially_copyable)
+        SOAGEN_GNU_ATTR(nonnull)
+        static void broadcast(std::byte* destination, const std::byte* value, size_t count) noexcept
+        {
+            SOAGEN_ASSUME(destination != nullptr);
+            SOAGEN_ASSUME(value != nullptr);
+
+            bool uniform = true;
+            for (size_t i = 1; i < sizeof(storage_type); i++)
+                uniform = uniform && value[i] == value[0];
+            if (uniform)
+            {
+                std::memset(destination, static_cast<int>(value[0]), count * sizeof(storage_type));
+                return;
+            }
+
+            constexpr size_t block_count = max(size_t{ 256 } / sizeof(storage_type), size_t{ 1 });
+            alignas(max(alignof(storage_type), size_t{ 16 })) std::byte block[block_count * sizeof(storage_type)];
+            for (size_t i = 0; i < block_count; i++)
+                std::memcpy(block + i * sizeof(storage_type), value, sizeof(storage_type));
+
+            for (; count >= block_count; destination += sizeof(block), count -= block_count)
+                std::memcpy(destination, block, sizeof(block));
+            std::memcpy(destination, block, count * sizeof(storage_type));
+        }
+
+        template <typename Arg>
+        static constexpr bool is_fillable_from =
+            is_trivially_copyable ? is_constructible<Arg> : std::is_assignable_v<storage_type&, Arg>;
+
+        template <typename Arg>
+        static constexpr bool is_nothrow_fillable_from =
+            is_trivially_copyable ? is_nothrow_constructible<Arg> : std::is_nothrow_assignable_v<storage_type&, Arg>;
+
+        // assigns value to count existing elements
+        SOAGEN_CONSTRAINED_TEMPLATE(is_fillable_from<const Arg&>, typename Arg)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void fill(std::byte* buffer, size_t index, size_t count, const Arg& value) //
+            noexcept(is_nothrow_fillable_from<const Arg&>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+
+            if constexpr (is_trivially_copyable)
+            {
+                // converted up-front since value may be one of the elements being overwritten
+                alignas(storage_type) std::byte converted[sizeof(storage_type)] = {};
+                construct(converted, value);
+                broadcast(buffer + index * sizeof(storage_type), converted, count);
+            }
+            else
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    get(buffer + index * sizeof(storage_type)) = value;
+            }
+        }
+
+        // constructs count elements from value
+        SOAGEN_CONSTRAINED_TEMPLATE(is_constructible<const Arg&>, typename Arg)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void fill_construct(std::byte* buffer, size_t index, size_t count, const Arg& value) //
+            noexcept(is_nothrow_constructible<const Arg&>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (is_trivially_copyable)
+            {
+                // every element ends up with the same bytes, so construct one and stamp out the rest
+                const auto first = buffer + index * sizeof(storage_type);
+                construct(first, value);
+                broadcast(first + sizeof(storage_type), first, count - 1u);
+            }
+            else if constexpr (is_nothrow_constructible<const Arg&> || std::is_trivially_destructible_v<storage_type>)
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    construct_at(buffer, index, value);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                size_t i = index;
+
+                SOAGEN_TRY
+                {
+                    for (const size_t e = index + count; i < e; i++)
+                        construct_at(buffer, i, value);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    for (; i-- > index;)
+                        destruct(buffer, i);
+                    throw;
+                }
+#endif
+            }
+        }
+
         //--- equality -------------------------------------------------------------------------------------------------
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_equality_comparable<storage_type>::value)
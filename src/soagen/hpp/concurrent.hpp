@@ -0,0 +1,239 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	Appends rows to a table from multiple threads at once.
+    ///
+    /// @details	Each call to #emplace_back() claims a row with a single atomic increment and constructs the row's
+    ///				elements in place, so producers don't serialize on a lock. Rows become visible to readers in
+    ///				order: #committed_size() is the length of the longest prefix of claimed rows that have been fully
+    ///				constructed, and can be read safely while appends are in progress.
+    ///
+    /// @details	When the reserved capacity runs out, the thread that notices takes a lock, waits for in-flight
+    ///				appends to finish, and grows the table. This is the only point at which producers block.
+    ///				Reserve enough rows up-front (via the constructor) to stay on the lock-free path.
+    ///
+    /// @details	The table's own size is updated by #commit() (called by the destructor), or whenever the table grows.
+    ///
+    /// @attention	While an appender is active the table must not be modified or resized through any other means, and
+    ///				readers must not hold on to column pointers across a growth. Each column must be nothrow-constructible
+    ///				from the corresponding argument to #emplace_back() (construct strings etc. beforehand and move them in).
+    ///
+    /// @tparam Soa	A table or generated SoA type without indexes or handles.
+    template <typename Soa>
+    class concurrent_appender
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<Soa>, "Soa may not be const.");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "concurrent_appender can't be used with types that have indexes or handles.");
+
+      public:
+        /// @brief The SoA type being appended to.
+        using soa_type = Soa;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        table& table_;
+        std::atomic<size_type> claimed_;   // next row to hand out (may overshoot capacity_)
+        std::atomic<size_type> committed_; // every row below this is fully constructed
+        std::atomic<size_type> capacity_;
+        std::atomic<size_type> writers_ = 0; // threads between claiming a row and publishing it
+        std::atomic<bool> growing_      = false;
+        std::unique_ptr<std::atomic<bool>[]> ready_; // indexed by row
+        std::mutex grow_mutex_;
+
+        void reset_ready_flags(size_type capacity)
+        {
+            ready_.reset(new std::atomic<bool>[capacity]);
+            for (size_type i = 0; i < capacity; i++)
+                ready_[i].store(false, std::memory_order_relaxed);
+        }
+
+        void publish() noexcept
+        {
+            // advance the watermark over any contiguous run of finished rows; whichever thread finishes the row at the
+            // watermark carries it forward over rows finished out-of-order by others
+            auto c             = committed_.load();
+            const auto max_row = capacity_.load();
+            while (c < max_row && ready_[c].load())
+            {
+                if (committed_.compare_exchange_weak(c, c + 1u))
+                    c++;
+            }
+        }
+
+        void grow()
+        {
+            std::lock_guard<std::mutex> lock{ grow_mutex_ };
+            if (claimed_.load() < capacity_.load())
+                return; // another thread got here first
+
+            growing_.store(true);
+            while (writers_.load())
+                std::this_thread::yield();
+
+            // nobody is mid-row, so every claimed row below capacity has been constructed
+            const auto cap       = capacity_.load();
+            const auto committed = min(claimed_.load(), cap);
+            detail::table_storage_access::set_size(table_, committed);
+            committed_.store(committed);
+            claimed_.store(committed);
+
+            const auto new_cap = cap > table_.max_size() / 2u ? table_.max_size() : max(cap * 2u, size_type{ 64 });
+            if SOAGEN_UNLIKELY(new_cap <= committed)
+            {
+                growing_.store(false);
+                SOAGEN_THROW(std::bad_alloc{});
+            }
+
+#if SOAGEN_HAS_EXCEPTIONS
+            try
+            {
+                table_.reserve(new_cap);
+                reset_ready_flags(new_cap);
+            }
+            catch (...)
+            {
+                growing_.store(false);
+                throw;
+            }
+#else
+            table_.reserve(new_cap);
+            reset_ready_flags(new_cap);
+#endif
+            capacity_.store(new_cap);
+            growing_.store(false);
+        }
+
+        template <typename Tuple, size_t... Columns>
+        static constexpr bool row_is_nothrow_constructible(std::index_sequence<Columns...>) noexcept
+        {
+            return (noexcept(traits::template column<Columns>::construct_at(std::declval<std::byte*>(),
+                                                                            size_t{},
+                                                                            std::get<Columns>(std::declval<Tuple>())))
+                    && ...);
+        }
+
+        template <typename Tuple, size_t... Columns>
+        void construct_row(size_type row, Tuple&& args, std::index_sequence<Columns...>) noexcept
+        {
+            const auto& alloc = detail::table_storage_access::allocation(table_);
+            (traits::template column<Columns>::construct_at(alloc.columns[Columns],
+                                                            row,
+                                                            std::get<Columns>(static_cast<Tuple&&>(args))),
+             ...);
+        }
+
+      public:
+        /// @brief Creates an appender for a table, reserving room for `rows` more rows.
+        SOAGEN_NODISCARD_CTOR
+        explicit concurrent_appender(Soa& soa, size_type rows = 0) //
+            : table_{ static_cast<table&>(soa) },
+              claimed_{ table_.size() },
+              committed_{ table_.size() }
+        {
+            size_type cap = table_.size();
+            if SOAGEN_UNLIKELY(!detail::add_without_overflowing(cap, max(rows, size_type{ 1 }), cap)
+                               || cap > table_.max_size())
+                SOAGEN_THROW(std::bad_alloc{});
+
+            table_.reserve(cap);
+            cap = table_.capacity();
+            reset_ready_flags(cap);
+            capacity_.store(cap);
+        }
+
+        concurrent_appender(const concurrent_appender&)            = delete;
+        concurrent_appender& operator=(const concurrent_appender&) = delete;
+
+        /// @brief Destructor. Calls #commit().
+        ~concurrent_appender() noexcept
+        {
+            commit();
+        }
+
+        /// @brief Appends a row, constructing each column from the corresponding argument.
+        ///
+        /// @details Safe to call from any number of threads concurrently.
+        ///
+        /// @returns The index of the new row.
+        template <typename... Args>
+        size_type emplace_back(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == traits::column_count, "an argument must be provided for each column");
+
+            using args_tuple = std::tuple<Args&&...>;
+            static_assert(row_is_nothrow_constructible<args_tuple>(std::make_index_sequence<sizeof...(Args)>{}),
+                          "each column must be nothrow-constructible from its argument");
+
+            for (;;)
+            {
+                writers_.fetch_add(1u);
+                if (!growing_.load())
+                {
+                    const auto row = claimed_.fetch_add(1u);
+                    if (row < capacity_.load())
+                    {
+                        construct_row(row,
+                                      args_tuple{ static_cast<Args&&>(args)... },
+                                      std::make_index_sequence<sizeof...(Args)>{});
+                        ready_[row].store(true);
+                        publish();
+                        writers_.fetch_sub(1u);
+                        return row;
+                    }
+                }
+                writers_.fetch_sub(1u);
+                grow();
+            }
+        }
+
+        /// @brief Returns the number of rows (including those that were in the table to begin with) that are fully
+        ///        constructed and safe to read.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type committed_size() const noexcept
+        {
+            return committed_.load(std::memory_order_acquire);
+        }
+
+        /// @brief Returns the number of rows that can be held before the table needs to grow.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type capacity() const noexcept
+        {
+            return capacity_.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Updates the table's size to include every committed row.
+        ///
+        /// @attention Must not be called while other threads are appending.
+        void commit() noexcept
+        {
+            SOAGEN_ASSERT(!writers_.load());
+            SOAGEN_ASSERT(committed_.load() == min(claimed_.load(), capacity_.load()));
+
+            detail::table_storage_access::set_size(table_, committed_.load());
+        }
+    };
+}
+
+#include "header_end.hpp"
@@ -149,6 +149,11 @@ namespace soagen
         {
             using type = table_traits<Args...>;
         };
+        template <typename... Args>
+        struct table_traits_type_<reordered_table_traits<Args...>>
+        {
+            using type = reordered_table_traits<Args...>;
+        };
         template <typename Traits, typename Allocator>
         struct table_traits_type_<table<Traits, Allocator>>
         {
@@ -535,6 +540,49 @@ namespace soagen
     inline constexpr size_t buffer_alignment =
         max(allocator_traits<allocator_type<T>>::min_alignment, table_traits_type<T>::largest_alignment);
 
+    /// @cond
+    namespace detail
+    {
+        SOAGEN_CONST_GETTER
+        constexpr std::uint64_t fnv1a_append(std::uint64_t hash, std::uint64_t value) noexcept
+        {
+            for (size_t i = 0; i < 8u; i++)
+            {
+                hash ^= (value >> (i * 8u)) & 0xFFu;
+                hash *= 0x00000100000001B3ull;
+            }
+            return hash;
+        }
+
+        template <typename Traits>
+        SOAGEN_CONST_GETTER
+        constexpr std::uint64_t table_layout_hash() noexcept
+        {
+            std::uint64_t hash = fnv1a_append(0xCBF29CE484222325ull, Traits::column_count);
+            for (size_t i = 0; i < Traits::column_count; i++)
+            {
+                hash = fnv1a_append(hash, Traits::column_sizes[i]);
+                hash = fnv1a_append(hash, Traits::column_alignments[i]);
+            }
+            return hash;
+        }
+
+        template <typename T>
+        struct schema_hash_ // specialized in the generated code
+            : std::integral_constant<std::uint64_t, table_layout_hash<table_traits_type<T>>()>
+        {};
+    }
+    /// @endcond
+
+    /// @brief A 64-bit hash identifying the schema of an SoA type.
+    ///
+    /// @details For soagen-generated types this is computed by the generator from the struct's name and the
+    ///          names, types and alignments of its columns. For plain tables it is computed from the size and
+    ///          alignment of each column. Used to reject persisted data written by an incompatible type.
+    template <typename T>
+    inline constexpr std::uint64_t schema_hash =
+        POXY_IMPLEMENTATION_DETAIL(detail::schema_hash_<soa_type<T>>::value);
+
     /// @cond
     namespace detail
     {
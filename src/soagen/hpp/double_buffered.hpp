@@ -0,0 +1,268 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <algorithm>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    template <typename Soa, typename Buffered, typename = std::make_index_sequence<table_traits_type<Soa>::column_count>>
+    struct double_buffered_traits_;
+
+    // the front buffer is the source type's own columns, followed by a second copy of each double-buffered column
+    template <typename Soa, size_t... Buffered, size_t... Columns>
+    struct double_buffered_traits_<Soa, std::index_sequence<Buffered...>, std::index_sequence<Columns...>>
+    {
+        using traits = table_traits_type<Soa>;
+        using type   = table_traits<typename traits::template column<Columns>...,
+                                  typename traits::template column<Buffered>...>;
+    };
+
+    template <typename Soa, auto... Buffered>
+    struct double_buffered_columns_
+    {
+        using type = std::index_sequence<static_cast<size_t>(Buffered)...>;
+    };
+
+    template <typename Soa>
+    struct double_buffered_columns_<Soa>
+    {
+        using type = std::make_index_sequence<table_traits_type<Soa>::column_count>;
+    };
+
+    // the index of a column's back buffer in the underlying table (its own index if it isn't double-buffered)
+    template <size_t... Buffered>
+    constexpr size_t double_buffered_back_index(size_t column,
+                                                size_t column_count,
+                                                std::index_sequence<Buffered...>) noexcept
+    {
+        size_t index = column;
+        size_t pos   = column_count;
+        ((index = (Buffered == column ? pos : index), pos++), ...);
+        return index;
+    }
+
+    template <size_t... Buffered>
+    constexpr bool double_buffered_distinct(size_t column_count, std::index_sequence<Buffered...>) noexcept
+    {
+        for (size_t i = 0; i < column_count; i++)
+            if ((static_cast<size_t>(Buffered == i) + ... + 0u) > 1u)
+                return false;
+        return true;
+    }
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief	A pair of identically-shaped tables for ping-pong style updates (read state N, write state N+1, swap).
+    ///
+    /// @details	Both buffers live in a single #soagen::table allocation, so they always have the same size,
+    ///				capacity and column layout, and growing them is one reallocation rather than two.
+    ///				#swap_buffers() exchanges column pointers; no elements are moved or copied.
+    ///
+    /// @details	Only the columns listed in `Buffered` get a second buffer. The rest are shared: #front() and
+    ///				#back() return the same pointer for them, and they cost no extra memory.
+    ///
+    /// @tparam Soa			A table or generated SoA type describing the columns.
+    /// @tparam Buffered	Indices of the columns to double-buffer. Leave empty to double-buffer every column.
+    template <typename Soa, auto... Buffered>
+    class double_buffered
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
+      public:
+        /// @brief The SoA type describing the columns.
+        using soa_type = Soa;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        using source_traits    = table_traits_type<Soa>;
+        using buffered_columns = typename detail::double_buffered_columns_<Soa, Buffered...>::type;
+
+        static constexpr size_type column_count = source_traits::column_count;
+
+        template <auto Column>
+        static constexpr size_type back_index =
+            detail::double_buffered_back_index(static_cast<size_type>(Column), column_count, buffered_columns{});
+
+        static_assert(((static_cast<size_type>(Buffered) < column_count) && ...), "column index out of range");
+        static_assert(detail::double_buffered_distinct(column_count, buffered_columns{}),
+                      "columns may only be listed once");
+
+      public:
+        /// @brief The #soagen::table type holding both buffers.
+        using table_type = soagen::table<typename detail::double_buffered_traits_<Soa, buffered_columns>::type,
+                                         typename soagen::table_type<Soa>::allocator_type>;
+
+        /// @brief Returns true if the given column is double-buffered.
+        template <auto Column>
+        static constexpr bool is_buffered = back_index<Column> != static_cast<size_type>(Column);
+
+      private:
+        table_type table_;
+
+        template <size_t... Columns>
+        void swap_buffers_(std::index_sequence<Columns...>) noexcept
+        {
+            (table_.template swap_columns<Columns, back_index<Columns>>(), ...);
+        }
+
+        template <size_t... Columns>
+        void sync_back_(std::index_sequence<Columns...>)
+        {
+            (std::copy(front<Columns>(), front<Columns>() + size(), back<Columns>()), ...);
+        }
+
+        template <typename Tuple, size_t... Columns, size_t... BufferedColumns>
+        void emplace_back_(Tuple&& args, std::index_sequence<Columns...>, std::index_sequence<BufferedColumns...>)
+        {
+            // double-buffered columns are constructed from the same argument twice, so they only ever see an lvalue
+            table_.emplace_back(
+                [&]() -> decltype(auto)
+                {
+                    using arg_type = std::tuple_element_t<Columns, std::remove_reference_t<Tuple>>;
+                    if constexpr (is_buffered<Columns>)
+                        return static_cast<const std::remove_reference_t<arg_type>&>(std::get<Columns>(args));
+                    else
+                        return static_cast<arg_type>(std::get<Columns>(args));
+                }()...,
+                static_cast<const std::remove_reference_t<std::tuple_element_t<BufferedColumns,
+                                                                               std::remove_reference_t<Tuple>>>&>(
+                    std::get<BufferedColumns>(args))...);
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        double_buffered() = default;
+
+        /// @brief Returns the number of rows in each buffer.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return table_.size();
+        }
+
+        /// @brief Returns true if the buffers have no rows.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return table_.empty();
+        }
+
+        /// @brief Returns the number of rows each buffer can hold without reallocating.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type capacity() const noexcept
+        {
+            return table_.capacity();
+        }
+
+        /// @brief Reserves storage for (at least) the given number of rows in both buffers.
+        void reserve(size_type new_cap)
+        {
+            table_.reserve(new_cap);
+        }
+
+        /// @brief Resizes both buffers, default-constructing any new rows.
+        void resize(size_type new_size)
+        {
+            table_.resize(new_size);
+        }
+
+        /// @brief Removes all rows from both buffers.
+        void clear() noexcept
+        {
+            table_.clear();
+        }
+
+        /// @brief Removes the last `num` rows from both buffers.
+        void pop_back(size_type num = 1)
+        {
+            table_.pop_back(num);
+        }
+
+        /// @brief Appends a row to both buffers, constructing each column from the corresponding argument.
+        ///
+        /// @details Double-buffered columns are copy-constructed from their argument in both buffers.
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == column_count, "an argument must be provided for each column");
+
+            emplace_back_(std::forward_as_tuple(static_cast<Args&&>(args)...),
+                          std::make_index_sequence<column_count>{},
+                          buffered_columns{});
+        }
+
+        /// @brief Returns a pointer to the elements of a column in the front (current) buffer.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        value_type<Soa, Column>* front() noexcept
+        {
+            return table_.template column<static_cast<size_type>(Column)>();
+        }
+
+        /// @brief Returns a pointer to the elements of a column in the front (current) buffer.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>* front() const noexcept
+        {
+            return table_.template column<static_cast<size_type>(Column)>();
+        }
+
+        /// @brief Returns a pointer to the elements of a column in the back (next) buffer.
+        ///
+        /// @details Returns the same pointer as #front() for columns that are not double-buffered.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        value_type<Soa, Column>* back() noexcept
+        {
+            return table_.template column<back_index<Column>>();
+        }
+
+        /// @brief Returns a pointer to the elements of a column in the back (next) buffer.
+        ///
+        /// @details Returns the same pointer as #front() for columns that are not double-buffered.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>* back() const noexcept
+        {
+            return table_.template column<back_index<Column>>();
+        }
+
+        /// @brief Exchanges the front and back buffers of every double-buffered column.
+        ///
+        /// @details Constant-time; swaps one pointer per double-buffered column.
+        void swap_buffers() noexcept
+        {
+            swap_buffers_(buffered_columns{});
+        }
+
+        /// @brief Copies the front buffer of every double-buffered column into its back buffer.
+        ///
+        /// @details Useful when a step only writes some rows of the back buffer.
+        void sync_back()
+        {
+            sync_back_(buffered_columns{});
+        }
+
+        /// @brief Returns the underlying table (columns `[0, column_count)` are the front buffer).
+        SOAGEN_PURE_INLINE_GETTER
+        const table_type& table() const noexcept
+        {
+            return table_;
+        }
+    };
+}
+
+#include "header_end.hpp"
@@ -58,6 +58,8 @@ namespace soagen
     class span;
     template <typename...>
     struct table_traits;
+    template <typename...>
+    struct reordered_table_traits;
     template <typename, typename>
     class table;
     /// @endcond
@@ -6,6 +6,7 @@
 
 #include "preprocessor.hpp"
 SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 #include <memory>
@@ -122,6 +123,43 @@ namespace soagen
         }
     }
 
+    SOAGEN_CONST_INLINE_GETTER
+    constexpr int popcount(std::uint64_t val) noexcept
+    {
+#if SOAGEN_CLANG || SOAGEN_GCC || SOAGEN_HAS_BUILTIN(__builtin_popcountll)
+
+        return __builtin_popcountll(val);
+
+#else
+
+        int count = 0;
+        for (; val; val &= val - 1u)
+            count++;
+        return count;
+
+#endif
+    }
+
+    SOAGEN_CONST_INLINE_GETTER
+    constexpr int countr_zero(std::uint64_t val) noexcept
+    {
+        if (!val)
+            return 64;
+
+#if SOAGEN_CLANG || SOAGEN_GCC || SOAGEN_HAS_BUILTIN(__builtin_ctzll)
+
+        return __builtin_ctzll(val);
+
+#else
+
+        int count = 0;
+        for (; !(val & 1u); val >>= 1)
+            count++;
+        return count;
+
+#endif
+    }
+
     template <size_t N, typename T>
     SOAGEN_CONST_INLINE_GETTER
     SOAGEN_GNU_ATTR(assume_aligned(N))
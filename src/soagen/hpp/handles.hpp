@@ -0,0 +1,229 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	A stable, generational reference to a row in a table.
+    ///
+    /// @details	Unlike row indices, handles remain valid when other rows are inserted or erased (including by
+    ///				`unordered_erase()`, which moves the last row) and when the table reallocates. A handle becomes
+    ///				invalid only when the row it refers to is removed; it is never reused for a different row.
+    ///
+    /// @tparam Tag	The SoA type the handle belongs to, so handles to different types can't be mixed up.
+    template <typename Tag>
+    struct row_handle
+    {
+        /// @brief The handle's slot in the handle table.
+        std::uint32_t slot = static_cast<std::uint32_t>(-1);
+
+        /// @brief The slot's generation when the handle was issued.
+        std::uint32_t generation = {};
+
+        /// @brief Returns true if the handle was issued by a table (it may since have been invalidated).
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator bool() const noexcept
+        {
+            return slot != static_cast<std::uint32_t>(-1);
+        }
+
+        /// @brief Returns true if two handles refer to the same row.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator==(const row_handle& lhs, const row_handle& rhs) noexcept
+        {
+            return lhs.slot == rhs.slot && lhs.generation == rhs.generation;
+        }
+
+        /// @brief Returns true if two handles refer to different rows.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator!=(const row_handle& lhs, const row_handle& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /// @brief	A slot map from #soagen::row_handle to row index.
+    ///
+    /// @details	Rows stay densely packed in the table; this class only maintains the indirection between the two.
+    ///				Looking up a handle is a bounds check, a generation check and an array read. Freed slots are
+    ///				recycled with an incremented generation so stale handles are detected.
+    ///
+    /// @details	Generated SoA types with `handles = true` own one of these and keep it in sync for you, using the
+    ///				same notification protocol as #soagen::hash_index (minus the column pointer).
+    ///
+    /// @tparam Tag	The SoA type the handles belong to.
+    template <typename Tag>
+    class handle_table
+    {
+      public:
+        /// @brief The handle type.
+        using handle_type = row_handle<Tag>;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        static constexpr std::uint32_t no_slot = static_cast<std::uint32_t>(-1);
+
+        struct slot
+        {
+            std::uint32_t row; // the slot's row while in use, or the next free slot
+            std::uint32_t generation;
+        };
+
+        std::vector<slot> slots_;
+        std::vector<std::uint32_t> rows_; // row index -> slot
+        std::uint32_t free_ = no_slot;
+
+        std::uint32_t acquire(size_type row)
+        {
+            SOAGEN_ASSERT(row < no_slot && "handle tables are limited to 2^32 - 1 rows");
+
+            if (free_ != no_slot)
+            {
+                const auto s  = free_;
+                free_         = slots_[s].row;
+                slots_[s].row = static_cast<std::uint32_t>(row);
+                return s;
+            }
+
+            slots_.push_back({ static_cast<std::uint32_t>(row), 0u });
+            return static_cast<std::uint32_t>(slots_.size() - 1u);
+        }
+
+        void release(std::uint32_t s) noexcept
+        {
+            slots_[s].generation++;
+            slots_[s].row = free_;
+            free_         = s;
+        }
+
+        void renumber(size_type first) noexcept
+        {
+            for (size_type row = first; row < rows_.size(); row++)
+                slots_[rows_[row]].row = static_cast<std::uint32_t>(row);
+        }
+
+      public:
+        /// @brief Returns the number of rows in the table.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return rows_.size();
+        }
+
+        /// @brief Returns true if the table is empty.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return rows_.empty();
+        }
+
+        /// @brief Returns a handle to the given row.
+        SOAGEN_PURE_GETTER
+        handle_type handle_of(size_type row) const noexcept
+        {
+            SOAGEN_ASSERT(row < rows_.size());
+
+            const auto s = rows_[row];
+            return { s, slots_[s].generation };
+        }
+
+        /// @brief Returns the index of the row a handle refers to, or an empty optional if the row has been removed.
+        SOAGEN_PURE_GETTER
+        optional<size_type> index_of(const handle_type& handle) const noexcept
+        {
+            if (handle.slot >= slots_.size())
+                return {};
+
+            const auto& s = slots_[handle.slot];
+            if (s.generation != handle.generation || s.row >= rows_.size() || rows_[s.row] != handle.slot)
+                return {};
+
+            return static_cast<size_type>(s.row);
+        }
+
+        /// @brief Ensures the table can hold at least `rows` rows without allocating.
+        void reserve(size_type rows)
+        {
+            rows_.reserve(rows);
+
+            // slots_.size() - rows_.size() of them are free
+            if (rows > rows_.size())
+                slots_.reserve(slots_.size() + (rows - rows_.size()));
+        }
+
+        /// @brief Removes all rows, invalidating all handles.
+        void clear() noexcept
+        {
+            for (auto s : rows_)
+                release(s);
+            rows_.clear();
+        }
+
+        /// @brief Notifies the table that a row was appended.
+        void push_back(size_type row)
+        {
+            SOAGEN_ASSERT(row == rows_.size());
+
+            rows_.push_back(acquire(row));
+        }
+
+        /// @brief Notifies the table that a row was inserted.
+        void insert(size_type row, size_type /* count */)
+        {
+            rows_.insert(rows_.begin() + static_cast<std::ptrdiff_t>(row), acquire(row));
+            renumber(row + 1u);
+        }
+
+        /// @brief Notifies the table that a row is about to be erased (preserving order).
+        void erase(size_type row, size_type /* count */) noexcept
+        {
+            release(rows_[row]);
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(row));
+            renumber(row);
+        }
+
+        /// @brief Notifies the table that a row is about to be erased using the swap-and-pop idiom.
+        void unordered_erase(size_type row, size_type count) noexcept
+        {
+            release(rows_[row]);
+            if (row + 1u < count)
+            {
+                rows_[row]             = rows_.back();
+                slots_[rows_[row]].row = static_cast<std::uint32_t>(row);
+            }
+            rows_.pop_back();
+        }
+
+        /// @brief Notifies the table that rows are about to be removed from the end.
+        void pop_back(size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            for (size_type i = 0; i < num; i++)
+            {
+                release(rows_.back());
+                rows_.pop_back();
+            }
+        }
+
+        /// @brief Swaps the contents of the table with another.
+        void swap(handle_table& other) noexcept
+        {
+            using std::swap;
+            slots_.swap(other.slots_);
+            rows_.swap(other.rows_);
+            swap(free_, other.free_);
+        }
+    };
+}
+
+#include "header_end.hpp"
@@ -0,0 +1,312 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <functional>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	An open-addressing hash index mapping the values of a single column to their row indices.
+    ///
+    /// @details	The index does not store keys; it stores row indices (and their hashes) and compares keys by reading
+    ///				the column directly. Every member that changes the table's rows takes a pointer to the column's
+    ///				data so it can do so. Generated SoA types with a variable marked `index = 'hash'` own one of these
+    ///				and keep it in sync for you.
+    ///
+    /// @details	Notification functions that describe rows being removed (#erase(), #unordered_erase(), #pop_back())
+    ///				must be called <i>before</i> the table is modified; those describing rows being added (#push_back(),
+    ///				#insert()) must be called <i>after</i>. Call #reserve() before adding rows to the table so the
+    ///				subsequent notification can't throw.
+    ///
+    /// @note		Keys need not be unique; #find() returns one of the matching rows.
+    ///
+    /// @tparam Key			The column's value type.
+    /// @tparam Hash		The hash function.
+    /// @tparam KeyEqual	The key equality predicate.
+    template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class hash_index
+    {
+      public:
+        /// @brief The key (column value) type.
+        using key_type = Key;
+
+        /// @brief The hash function type.
+        using hasher = Hash;
+
+        /// @brief The key equality predicate type.
+        using key_equal = KeyEqual;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        static constexpr size_type empty_slot = static_cast<size_type>(-1);
+        static constexpr size_type min_slots  = 16;
+
+        struct slot
+        {
+            size_type row;
+            std::uint64_t hash;
+        };
+
+        std::vector<slot> slots_;
+        size_type count_ = {};
+        unsigned shift_  = 64;
+        hasher hasher_;
+        key_equal key_equal_;
+
+        SOAGEN_PURE_INLINE_GETTER
+        std::uint64_t hash(const key_type& key) const noexcept
+        {
+            // fibonacci hashing; std::hash is the identity for integers on most implementations
+            return static_cast<std::uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ull;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type home(std::uint64_t h) const noexcept
+        {
+            return static_cast<size_type>(h >> shift_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type mask() const noexcept
+        {
+            return slots_.size() - 1u;
+        }
+
+        void place(size_type row, std::uint64_t h) noexcept
+        {
+            SOAGEN_ASSUME(count_ < slots_.size());
+
+            for (size_type i = home(h);; i = (i + 1u) & mask())
+            {
+                if (slots_[i].row == empty_slot)
+                {
+                    slots_[i] = { row, h };
+                    count_++;
+                    return;
+                }
+            }
+        }
+
+        SOAGEN_PURE_GETTER
+        size_type locate(const key_type* keys, size_type row) const noexcept
+        {
+            SOAGEN_ASSUME(keys != nullptr);
+            SOAGEN_ASSUME(!slots_.empty());
+
+            for (size_type i = home(hash(keys[row]));; i = (i + 1u) & mask())
+            {
+                SOAGEN_ASSERT(slots_[i].row != empty_slot && "row was not in the index");
+                if (slots_[i].row == row)
+                    return i;
+            }
+        }
+
+        // backward-shift deletion; keeps probe sequences intact without tombstones
+        void remove_slot(size_type i) noexcept
+        {
+            for (size_type j = (i + 1u) & mask();; j = (j + 1u) & mask())
+            {
+                if (slots_[j].row == empty_slot)
+                    break;
+
+                const size_type h = home(slots_[j].hash);
+                if (((j - h) & mask()) >= ((j - i) & mask()))
+                {
+                    slots_[i] = slots_[j];
+                    i         = j;
+                }
+            }
+            slots_[i].row = empty_slot;
+            count_--;
+        }
+
+        void rehash(size_type slot_count)
+        {
+            std::vector<slot> old(slot_count, slot{ empty_slot, 0u });
+            old.swap(slots_);
+            count_ = 0;
+            shift_ = 64u;
+            for (size_type n = slot_count; n > 1u; n >>= 1)
+                shift_--;
+
+            for (const auto& s : old)
+                if (s.row != empty_slot)
+                    place(s.row, s.hash);
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        hash_index() = default;
+
+        /// @brief Constructs with the given hash function and equality predicate.
+        SOAGEN_NODISCARD_CTOR
+        explicit hash_index(const hasher& h, const key_equal& eq = key_equal{}) //
+            : hasher_{ h },
+              key_equal_{ eq }
+        {}
+
+        /// @brief Returns the number of rows in the index.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return count_;
+        }
+
+        /// @brief Returns true if the index is empty.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !count_;
+        }
+
+        /// @brief Ensures the index can hold at least `rows` rows without rehashing.
+        void reserve(size_type rows)
+        {
+            // max load factor of 3/4
+            if (rows <= slots_.size() - slots_.size() / 4u)
+                return;
+
+            size_type slot_count = min_slots;
+            while (slot_count - slot_count / 4u < rows)
+                slot_count *= 2u;
+            rehash(slot_count);
+        }
+
+        /// @brief Finds a row whose column value is equal to `key`.
+        ///
+        /// @param keys	The column's data.
+        /// @param key	The value to find.
+        ///
+        /// @returns The index of a matching row, or an empty optional.
+        SOAGEN_NODISCARD
+        optional<size_type> find(const key_type* keys, const key_type& key) const noexcept
+        {
+            if (!count_)
+                return {};
+
+            SOAGEN_ASSUME(keys != nullptr);
+
+            const auto h = hash(key);
+            for (size_type i = home(h);; i = (i + 1u) & mask())
+            {
+                const auto& s = slots_[i];
+                if (s.row == empty_slot)
+                    return {};
+                if (s.hash == h && key_equal_(keys[s.row], key))
+                    return s.row;
+            }
+        }
+
+        /// @brief Discards the index's contents and re-indexes the first `count` rows of a column.
+        void rebuild(const key_type* keys, size_type count)
+        {
+            clear();
+            reserve(count);
+            for (size_type row = 0; row < count; row++)
+                place(row, hash(keys[row]));
+        }
+
+        /// @brief Removes all rows from the index.
+        void clear() noexcept
+        {
+            for (auto& s : slots_)
+                s.row = empty_slot;
+            count_ = 0;
+        }
+
+        /// @brief Notifies the index that a row was appended to the table.
+        ///
+        /// @param keys	The column's data.
+        /// @param row	The index of the new row (i.e. the table's new size, minus one).
+        void push_back(const key_type* keys, size_type row)
+        {
+            reserve(count_ + 1u);
+            place(row, hash(keys[row]));
+        }
+
+        /// @brief Notifies the index that a row was inserted into the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the new row.
+        /// @param count	The table's new size.
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            reserve(count_ + 1u);
+            if (row + 1u < count)
+            {
+                for (auto& s : slots_)
+                    if (s.row != empty_slot && s.row >= row)
+                        s.row++;
+            }
+            push_back(keys, row);
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table (preserving order).
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            remove_slot(locate(keys, row));
+            if (row + 1u < count)
+            {
+                for (auto& s : slots_)
+                    if (s.row != empty_slot && s.row > row)
+                        s.row--;
+            }
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table using the swap-and-pop idiom.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            remove_slot(locate(keys, row));
+            if (row + 1u < count)
+                slots_[locate(keys, count - 1u)].row = row;
+        }
+
+        /// @brief Notifies the index that rows are about to be removed from the end of the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param num		The number of rows being removed.
+        /// @param count	The table's current size.
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
+            {
+                clear();
+                return;
+            }
+            for (size_type row = count - num; row < count; row++)
+                remove_slot(locate(keys, row));
+        }
+
+        /// @brief Swaps the contents of the index with another.
+        void swap(hash_index& other) noexcept
+        {
+            using std::swap;
+            slots_.swap(other.slots_);
+            swap(count_, other.count_);
+            swap(shift_, other.shift_);
+            swap(hasher_, other.hasher_);
+            swap(key_equal_, other.key_equal_);
+        }
+    };
+}
+
+#include "header_end.hpp"
@@ -0,0 +1,162 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "allocator.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#if SOAGEN_UNIX
+    #include <sys/mman.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	An allocator for large tables that backs them with (transparent) huge pages.
+    ///
+    /// @details	Allocations of at least #threshold bytes are mapped directly from the OS on a #huge_page_size
+    ///				boundary and marked with `MADV_HUGEPAGE` where supported, so a multi-megabyte column is covered by
+    ///				a handful of TLB entries instead of hundreds. Smaller allocations go to #soagen::allocator.
+    ///
+    /// @details	It also sets `column_alignment` to #page_size, so tables using it start every column of a page
+    ///				or more on a page boundary, and a scan of one column never shares its first or last page with
+    ///				a neighbouring column.
+    ///
+    /// @note		On platforms without `mmap()` every allocation goes to #soagen::allocator (still page-aligned
+    ///				when large).
+    struct huge_page_allocator
+    {
+        /// @brief The value type allocated by this allocator.
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
+
+        /// @brief Instances of this allocator are always equal.
+        using is_always_equal = std::true_type;
+
+        /// @brief Instances of this allocator don't propagate on copy-assignment.
+        using propagate_on_container_copy_assignment = std::false_type;
+
+        /// @brief Instances of this allocator don't propagate on move-assignment.
+        using propagate_on_container_move_assignment = std::false_type;
+
+        /// @brief Instances of this allocator don't propagate on swap.
+        using propagate_on_container_swap = std::false_type;
+
+        /// @brief The minimum alignment of any allocations created by this allocator.
+        static constexpr size_type min_alignment = allocator::min_alignment;
+
+        /// @brief The (assumed) size of a regular memory page.
+        static constexpr size_type page_size = 4096;
+
+        /// @brief The size (and alignment) of a huge page.
+        static constexpr size_type huge_page_size = size_type{ 2 } * 1024u * 1024u;
+
+        /// @brief Allocations of at least this many bytes are backed by huge pages.
+        static constexpr size_type threshold = huge_page_size;
+
+        /// @brief Columns of at least a page start on a page boundary.
+        static constexpr size_type column_alignment = page_size;
+
+      private:
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type round_up(size_type size, size_type alignment) noexcept
+        {
+            return (size + alignment - 1u) & ~(alignment - 1u);
+        }
+
+      public:
+        /// @brief Alignment-aware allocation.
+        /// @param size The size of the allocation, in bytes.
+        /// @param alignment The minimum alignment, in bytes. Must be a power-of-two.
+        /// @return A new allocation.
+        /// @throws std::bad_alloc If the system allocation function failed.
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
+        {
+            SOAGEN_ASSUME(size);
+            SOAGEN_ASSERT(static_cast<size_type>(alignment) <= huge_page_size);
+
+#if SOAGEN_UNIX
+            if (size >= threshold)
+            {
+                // over-map by one huge page so the start can be aligned, then give the slop back
+                const auto bytes = round_up(size, huge_page_size);
+                void* raw        = mmap(nullptr,
+                                 bytes + huge_page_size,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS,
+                                 -1,
+                                 0);
+                if SOAGEN_UNLIKELY(raw == MAP_FAILED)
+                    SOAGEN_THROW(std::bad_alloc{});
+
+                const auto raw_addr = reinterpret_cast<std::uintptr_t>(raw);
+                const auto head     = static_cast<size_type>(round_up(raw_addr, huge_page_size) - raw_addr);
+                const auto ptr      = static_cast<pointer>(raw) + head;
+                if (head)
+                    munmap(raw, head);
+                if (head != huge_page_size)
+                    munmap(ptr + bytes, huge_page_size - head);
+
+    #ifdef MADV_HUGEPAGE
+                madvise(ptr, bytes, MADV_HUGEPAGE);
+    #endif
+                return soagen::assume_aligned<min_alignment>(ptr);
+            }
+#endif
+
+            if (size >= page_size)
+                alignment = std::align_val_t{ max(static_cast<size_type>(alignment), page_size) };
+            return allocator{}.allocate(size, alignment);
+        }
+
+        /// @brief Deallocation.
+        /// @param ptr The pointer to the memory being deallocated. Must have been acquired via #allocate().
+        /// @param size The size of the allocation, in bytes. Must be the value used for previous call to #allocate().
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
+        {
+            SOAGEN_ASSUME(ptr != nullptr);
+            SOAGEN_ASSUME(size);
+
+#if SOAGEN_UNIX
+            if (size >= threshold)
+            {
+                munmap(ptr, round_up(size, huge_page_size));
+                return;
+            }
+#endif
+
+            allocator{}.deallocate(ptr, size);
+        }
+
+        /// @brief Equality operator.
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator==(const huge_page_allocator&, const huge_page_allocator&) noexcept
+        {
+            return true;
+        }
+
+        /// @brief Inequality operator.
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator!=(const huge_page_allocator&, const huge_page_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+    static_assert(std::is_trivially_default_constructible_v<huge_page_allocator>);
+    static_assert(std::is_trivially_copy_constructible_v<huge_page_allocator>);
+    static_assert(std::is_trivially_destructible_v<huge_page_allocator>);
+}
+
+#include "header_end.hpp"
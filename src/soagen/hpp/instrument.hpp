@@ -0,0 +1,511 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+
+#ifndef SOAGEN_INSTRUMENT
+    #define SOAGEN_INSTRUMENT 0
+#endif
+/// @def SOAGEN_INSTRUMENT
+/// @brief Define as `1` to have tables report allocation and growth events to a #soagen::table_hook, and
+///        register themselves for #soagen::memory_stats().
+/// @details Defaults to `0`, in which case tables contain no instrumentation code at all.
+
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#include <string_view>
+#if SOAGEN_INSTRUMENT
+    #include <atomic>
+    #include <chrono>
+    #include <mutex>
+    #include <string>
+    #include <vector>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief The kinds of event reported to a #soagen::table_hook.
+    enum class table_event : unsigned char
+    {
+        allocate,    ///< A table allocated its first buffer, moved a column into an allocation of its own
+                     ///< (`exchange_column()`), or took over another table's buffer (move construction,
+                     ///< move assignment or `swap()`).
+        reallocate,  ///< A table grew its buffer and moved its rows into it.
+        shrink,      ///< A table shrank its buffer (`shrink_to_fit()`) and moved its rows into it.
+        deallocate,  ///< A table freed its buffer (destruction, or `shrink_to_fit()` while empty), or handed it
+                     ///< over to another table (move construction, move assignment or `swap()`).
+        erase_shift, ///< `erase()` shifted the rows after the erased one down by one.
+    };
+
+    /// @brief Describes an event reported to a #soagen::table_hook.
+    struct table_event_info
+    {
+        /// @brief The kind of event.
+        table_event event;
+
+        /// @brief The name of the table's type, as reported by the compiler.
+        std::string_view type_name;
+
+        /// @brief A hash of the table's column layout, for grouping events by SoA type.
+        std::uint64_t layout_hash;
+
+        /// @brief The table that raised the event.
+        const void* table;
+
+        /// @brief The table's capacity before the event, in rows.
+        std::size_t old_capacity;
+
+        /// @brief The table's capacity after the event, in rows.
+        std::size_t new_capacity;
+
+        /// @brief The size of the table's buffers before the event, in bytes (including exchanged columns).
+        std::size_t old_bytes;
+
+        /// @brief The size of the table's buffers after the event, in bytes (including exchanged columns).
+        std::size_t new_bytes;
+
+        /// @brief The number of rows moved (or shifted) by the event.
+        std::size_t rows;
+
+        /// @brief The time taken by the event, in nanoseconds.
+        std::uint64_t nanoseconds;
+    };
+
+    /// @brief A function receiving table instrumentation events. Called on the thread that raised the event.
+    using table_hook = void (*)(const table_event_info&) noexcept;
+
+    /// @cond
+    namespace detail
+    {
+        template <typename T>
+        SOAGEN_CONST_GETTER
+        constexpr std::string_view type_name() noexcept
+        {
+#if SOAGEN_GCC || SOAGEN_CLANG
+            // "... type_name() [with T = X; ...]" (gcc) or "... type_name() [T = X]" (clang)
+            constexpr std::string_view sig = __PRETTY_FUNCTION__;
+            constexpr auto start           = sig.find("T = ") + 4u;
+            constexpr auto end             = min(sig.find(';', start), sig.rfind(']'));
+#else
+            // "... type_name<X>(void) noexcept"
+            constexpr std::string_view sig = __FUNCSIG__;
+            constexpr auto start           = sig.find("type_name<") + 10u;
+            constexpr auto end             = sig.rfind(">(void)");
+#endif
+            return sig.substr(start, end - start);
+        }
+
+#if SOAGEN_INSTRUMENT
+
+        inline std::atomic<table_hook> table_hook_{};
+
+        class table_event_timer
+        {
+            std::chrono::steady_clock::time_point start_;
+
+          public:
+            table_event_timer() noexcept //
+                : start_{ std::chrono::steady_clock::now() }
+            {}
+
+            SOAGEN_NODISCARD
+            std::uint64_t elapsed() const noexcept
+            {
+                return static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_)
+                        .count());
+            }
+        };
+
+        template <typename Table, typename Traits>
+        SOAGEN_NEVER_INLINE
+        void raise_table_event(table_event event,
+                               const void* tbl,
+                               size_t old_capacity,
+                               size_t new_capacity,
+                               size_t old_bytes,
+                               size_t new_bytes,
+                               size_t rows,
+                               std::uint64_t nanoseconds) noexcept
+        {
+            if (const auto hook = table_hook_.load(std::memory_order_acquire))
+                hook({ event,
+                       type_name<Table>(),
+                       table_layout_hash<Traits>(),
+                       tbl,
+                       old_capacity,
+                       new_capacity,
+                       old_bytes,
+                       new_bytes,
+                       rows,
+                       nanoseconds });
+        }
+
+        // a buffer changing hands without any rows moving is reported as its old owner deallocating it and its new
+        // owner allocating it, so totals kept per table from the events stay balanced
+        template <typename Table>
+        void raise_table_transfer(const void* tbl,
+                                  size_t old_capacity,
+                                  size_t old_bytes,
+                                  size_t new_capacity,
+                                  size_t new_bytes) noexcept
+        {
+            using traits = table_traits_type<Table>;
+
+            if (old_bytes)
+                raise_table_event<Table, traits>(table_event::deallocate,
+                                                 tbl,
+                                                 old_capacity,
+                                                 0u,
+                                                 old_bytes,
+                                                 0u,
+                                                 0u,
+                                                 0u);
+            if (new_bytes)
+                raise_table_event<Table, traits>(table_event::allocate,
+                                                 tbl,
+                                                 0u,
+                                                 new_capacity,
+                                                 0u,
+                                                 new_bytes,
+                                                 0u,
+                                                 0u);
+        }
+
+#endif
+    }
+    /// @endcond
+
+#if SOAGEN_INSTRUMENT
+
+    /// @brief Memory usage of all live tables of one type, as reported by #soagen::memory_stats().
+    struct table_memory_stats
+    {
+        /// @brief The name of the table type, as reported by the compiler.
+        std::string_view type_name;
+
+        /// @brief A hash of the table's column layout.
+        std::uint64_t layout_hash;
+
+        /// @brief The number of live tables.
+        std::size_t tables;
+
+        /// @brief The total number of rows.
+        std::size_t rows;
+
+        /// @brief The total capacity, in rows.
+        std::size_t capacity;
+
+        /// @brief The total size of the tables' buffers, in bytes (including exchanged columns).
+        std::size_t bytes;
+
+        /// @brief How many of #bytes are padding between columns (from column alignment), rather than capacity.
+        std::size_t padding_bytes;
+    };
+
+#endif
+}
+
+/// @cond
+namespace soagen::detail
+{
+#if SOAGEN_INSTRUMENT
+
+    // every live table is linked into the list for its type; the list for each type is created on first use and
+    // linked into a global list of types, so the registry can be queried without knowing the types up front
+
+    struct table_registry_node
+    {
+        table_registry_node* prev;
+        table_registry_node* next;
+    };
+
+    struct table_registry_entry
+    {
+        using collect_func = void (*)(const table_registry_node&, table_memory_stats&) noexcept;
+
+        std::string_view type_name;
+        std::uint64_t layout_hash;
+        collect_func collect;
+        std::mutex mutex;
+        table_registry_node tables;
+        table_registry_entry* next_entry;
+
+        static std::mutex& registry_mutex() noexcept
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static table_registry_entry*& registry_head() noexcept
+        {
+            static table_registry_entry* head;
+            return head;
+        }
+
+        table_registry_entry(std::string_view name, std::uint64_t hash, collect_func func) noexcept //
+            : type_name{ name },
+              layout_hash{ hash },
+              collect{ func },
+              tables{ &tables, &tables }
+        {
+            std::lock_guard lock{ registry_mutex() };
+            next_entry      = registry_head();
+            registry_head() = this;
+        }
+
+        ~table_registry_entry() noexcept
+        {
+            std::lock_guard lock{ registry_mutex() };
+            for (auto e = &registry_head(); *e; e = &(*e)->next_entry)
+            {
+                if (*e == this)
+                {
+                    *e = next_entry;
+                    break;
+                }
+            }
+        }
+
+        void link(table_registry_node& node) noexcept
+        {
+            std::lock_guard lock{ mutex };
+            node.prev         = tables.prev;
+            node.next         = &tables;
+            tables.prev->next = &node;
+            tables.prev       = &node;
+        }
+
+        void unlink(table_registry_node& node) noexcept
+        {
+            std::lock_guard lock{ mutex };
+            node.prev->next = node.next;
+            node.next->prev = node.prev;
+        }
+
+        SOAGEN_NODISCARD
+        table_memory_stats stats() noexcept
+        {
+            table_memory_stats s{ type_name, layout_hash, 0u, 0u, 0u, 0u, 0u };
+            std::lock_guard lock{ mutex };
+            for (auto node = tables.next; node != &tables; node = node->next)
+                collect(*node, s);
+            return s;
+        }
+    };
+
+    template <typename Table>
+    class table_registration;
+
+    // total size of a table's buffers, including exchanged columns (defined in table.hpp)
+    template <typename Table>
+    size_t table_allocation_bytes(const Table& tbl) noexcept;
+
+    template <typename Table>
+    void collect_table_stats(const table_registry_node& node, table_memory_stats& s) noexcept
+    {
+        using traits = table_traits_type<Table>;
+
+        size_t row_bytes = {};
+        for (size_t i = 0; i < traits::column_count; i++)
+            row_bytes += traits::column_sizes[i];
+
+        const auto& tbl = static_cast<const Table&>(static_cast<const table_registration<Table>&>(node));
+        s.tables++;
+        s.rows += tbl.size();
+        s.capacity += tbl.capacity();
+        s.bytes += table_allocation_bytes(tbl);
+        s.padding_bytes += tbl.allocation_size() ? tbl.allocation_size() - tbl.capacity() * row_bytes : 0u;
+    }
+
+    template <typename Table>
+    table_registry_entry& table_registry() noexcept
+    {
+        static table_registry_entry entry{ type_name<Table>(),
+                                           table_layout_hash<table_traits_type<Table>>(),
+                                           &collect_table_stats<Table> };
+        return entry;
+    }
+
+    // base class of every table when instrumentation is enabled; registers the table for its lifetime.
+    // it's the table's first base, so its move operations run before the table's storage has taken the other table's
+    // buffer, and can still see what's about to change hands.
+    template <typename Table>
+    class table_registration : public table_registry_node
+    {
+        SOAGEN_PURE_INLINE_GETTER
+        const Table& registered_table() const noexcept
+        {
+            return static_cast<const Table&>(*this);
+        }
+
+      protected:
+        table_registration() noexcept
+        {
+            table_registry<Table>().link(*this);
+        }
+
+        table_registration(const table_registration&) noexcept //
+            : table_registration{}
+        {}
+
+        table_registration(table_registration&& other) noexcept //
+            : table_registration{}
+        {
+            const auto capacity = other.registered_table().capacity();
+            const auto bytes    = table_allocation_bytes(other.registered_table());
+            raise_table_transfer<Table>(&other, capacity, bytes, 0u, 0u);
+            raise_table_transfer<Table>(this, 0u, 0u, capacity, bytes);
+        }
+
+        table_registration& operator=(const table_registration&) noexcept
+        {
+            return *this;
+        }
+
+        table_registration& operator=(table_registration&& rhs) noexcept
+        {
+            // the only move-assignment that reaches this is the untyped one, which always takes ownership
+            if (&rhs != this)
+                raise_move_from(rhs);
+            return *this;
+        }
+
+        ~table_registration() noexcept
+        {
+            table_registry<Table>().unlink(*this);
+        }
+
+        // call before this table takes ownership of rhs's buffer
+        void raise_move_from(const table_registration& rhs) noexcept
+        {
+            const auto old_capacity = registered_table().capacity();
+            const auto old_bytes    = table_allocation_bytes(registered_table());
+            const auto capacity     = rhs.registered_table().capacity();
+            const auto bytes        = table_allocation_bytes(rhs.registered_table());
+            raise_table_transfer<Table>(this, old_capacity, old_bytes, capacity, bytes);
+            raise_table_transfer<Table>(&rhs, capacity, bytes, 0u, 0u);
+        }
+
+        // call before this table swaps buffers with other
+        void raise_swap_with(const table_registration& other) noexcept
+        {
+            const auto capacity       = registered_table().capacity();
+            const auto bytes          = table_allocation_bytes(registered_table());
+            const auto other_capacity = other.registered_table().capacity();
+            const auto other_bytes    = table_allocation_bytes(other.registered_table());
+            raise_table_transfer<Table>(this, capacity, bytes, other_capacity, other_bytes);
+            raise_table_transfer<Table>(&other, other_capacity, other_bytes, capacity, bytes);
+        }
+    };
+
+    inline void append_json_string(std::string& out, std::string_view str)
+    {
+        out += '"';
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        out += '"';
+    }
+
+#endif
+}
+/// @endcond
+
+namespace soagen
+{
+#if SOAGEN_INSTRUMENT
+
+    /// @brief Returns the memory usage of all live tables of the given type.
+    ///
+    /// @details Generated SoA types with identical columns and allocators share a table type, and so are counted
+    ///          together.
+    ///
+    /// @availability This function is only available when #SOAGEN_INSTRUMENT is enabled.
+    ///
+    /// @attention Tables are read while being counted; don't modify tables of the type on other threads meanwhile.
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    table_memory_stats memory_stats() noexcept
+    {
+        return detail::table_registry<table_type<Soa>>().stats();
+    }
+
+    /// @brief Returns the memory usage of every table type that has been instantiated so far.
+    ///
+    /// @availability This function is only available when #SOAGEN_INSTRUMENT is enabled.
+    ///
+    /// @attention Tables are read while being counted; don't modify tables on other threads meanwhile.
+    SOAGEN_NODISCARD
+    inline std::vector<table_memory_stats> memory_report()
+    {
+        std::vector<table_memory_stats> report;
+        std::lock_guard lock{ detail::table_registry_entry::registry_mutex() };
+        for (auto e = detail::table_registry_entry::registry_head(); e; e = e->next_entry)
+            report.push_back(e->stats());
+        return report;
+    }
+
+    /// @brief Returns #memory_report() as a JSON document.
+    ///
+    /// @details The document is an object with one member, `"tables"`, an array with one object per table type
+    ///          holding the fields of #soagen::table_memory_stats. `layout_hash` is written as a hex string.
+    ///
+    /// @availability This function is only available when #SOAGEN_INSTRUMENT is enabled.
+    SOAGEN_NODISCARD
+    inline std::string memory_report_json()
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+
+        std::string out = "{\"tables\":[";
+        bool first      = true;
+        for (const auto& s : memory_report())
+        {
+            if (!first)
+                out += ',';
+            first = false;
+
+            out += "{\"type\":";
+            detail::append_json_string(out, s.type_name);
+            out += ",\"layout_hash\":\"";
+            for (int shift = 60; shift >= 0; shift -= 4)
+                out += hex[(s.layout_hash >> shift) & 0xFu];
+            out += "\",\"tables\":" + std::to_string(s.tables);
+            out += ",\"rows\":" + std::to_string(s.rows);
+            out += ",\"capacity\":" + std::to_string(s.capacity);
+            out += ",\"bytes\":" + std::to_string(s.bytes);
+            out += ",\"padding_bytes\":" + std::to_string(s.padding_bytes);
+            out += '}';
+        }
+        out += "]}";
+        return out;
+    }
+
+    /// @brief Installs a function to receive table instrumentation events (or removes it, if `nullptr`).
+    /// @returns The previously-installed hook.
+    /// @availability This function is only available when #SOAGEN_INSTRUMENT is enabled.
+    inline table_hook set_table_hook(table_hook hook) noexcept
+    {
+        return detail::table_hook_.exchange(hook, std::memory_order_acq_rel);
+    }
+
+    /// @brief Returns the currently-installed table hook, if any.
+    /// @availability This function is only available when #SOAGEN_INSTRUMENT is enabled.
+    SOAGEN_NODISCARD
+    inline table_hook get_table_hook() noexcept
+    {
+        return detail::table_hook_.load(std::memory_order_acquire);
+    }
+
+#endif
+}
+
+#include "header_end.hpp"
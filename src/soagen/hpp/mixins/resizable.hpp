@@ -10,13 +10,39 @@
 namespace soagen::mixins
 {
     template <typename Derived, bool = detail::has_resize_member<table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES resizable
+    struct SOAGEN_EMPTY_BASES resizable;
+
+    // resizing with explicit values doesn't need default-constructible columns
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES resizable<Derived, false>
     {
         static_assert(!detail::is_cvref<Derived>::value);
 
         using table_type = soagen::table_type<Derived>;
         using size_type  = std::size_t;
 
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits_type<Derived>::template rows_fillable_from<Values...>,
+                                    typename... Values)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& resize(size_type new_size, const Values&... values) //
+            noexcept(noexcept(std::declval<table_type&>().resize(std::declval<size_type>(),
+                                                                 std::declval<const Values&>()...)))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).resize(new_size, values...);
+            return static_cast<Derived&>(*this);
+        }
+    };
+
+    template <typename Derived, bool>
+    struct SOAGEN_EMPTY_BASES resizable //
+        : resizable<Derived, false>
+    {
+        using table_type = soagen::table_type<Derived>;
+        using size_type  = std::size_t;
+
+        using resizable<Derived, false>::resize;
+
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
         Derived& resize(size_type new_size) //
@@ -34,12 +60,20 @@ namespace soagen::mixins
             static_cast<table_type&>(static_cast<Derived&>(*this)).resize_for_overwrite(new_size);
             return static_cast<Derived&>(*this);
         }
-    };
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES resizable<Derived, false>
-    {};
+        SOAGEN_CONSTEXPR_20
+        soagen::span_type<Derived> append_uninitialized(size_type num) //
+            noexcept(noexcept(std::declval<table_type&>().append_uninitialized(std::declval<size_type>())))
+        {
+            if (!num)
+                return {};
 
+            auto& self       = static_cast<Derived&>(*this);
+            const auto start = static_cast<const table_type&>(self).size();
+            static_cast<table_type&>(self).append_uninitialized(num);
+            return { self, start, num };
+        }
+    };
 }
 
 #include "../header_end.hpp"
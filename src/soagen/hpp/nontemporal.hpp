@@ -0,0 +1,117 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+
+#ifndef SOAGEN_NONTEMPORAL_THRESHOLD
+    #define SOAGEN_NONTEMPORAL_THRESHOLD (2u * 1024u * 1024u)
+#endif
+/// @def SOAGEN_NONTEMPORAL_THRESHOLD
+/// @brief Bulk column writes of at least this many bytes bypass the cache.
+/// @details Applies to the copies made when a table of trivially-copyable columns reallocates, and to bulk default
+///          construction of trivially-copyable types with non-trivial default constructors. Writes that big won't
+///          be read again soon, so using streaming stores for them saves the rest of the working set from being
+///          evicted. Define as `0` to disable. Has no effect on targets without SSE2.
+
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#include <cstring>
+#if SOAGEN_ISET_SSE2
+    #include <emmintrin.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    inline constexpr size_t nontemporal_threshold = SOAGEN_NONTEMPORAL_THRESHOLD;
+
+    inline constexpr bool has_nontemporal_stores = !!SOAGEN_ISET_SSE2 && nontemporal_threshold > 0u;
+
+    // memcpy() for big, non-overlapping blocks that won't be read again soon
+    SOAGEN_GNU_ATTR(nonnull)
+    inline void nontemporal_copy(void* dest, const void* src, size_t bytes) noexcept
+    {
+#if SOAGEN_ISET_SSE2
+        auto d = static_cast<std::byte*>(dest);
+        auto s = static_cast<const std::byte*>(src);
+
+        // streaming stores need an aligned destination
+        const auto head = min(bytes, static_cast<size_t>((16u - reinterpret_cast<std::uintptr_t>(d) % 16u) % 16u));
+        std::memcpy(d, s, head);
+        d += head;
+        s += head;
+        bytes -= head;
+
+        for (; bytes >= 64u; d += 64u, s += 64u, bytes -= 64u)
+        {
+            const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16u));
+            const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32u));
+            const auto e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48u));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16u), b);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32u), c);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48u), e);
+        }
+        _mm_sfence();
+
+        std::memcpy(d, s, bytes);
+#else
+        std::memcpy(dest, src, bytes);
+#endif
+    }
+
+    // the block a nontemporal_fill() of Size-byte elements repeats (a whole number of elements and of 16-byte stores)
+    template <size_t Size>
+    inline constexpr size_t nontemporal_fill_period = lcm(Size, size_t{ 16 });
+
+    template <size_t Size>
+    inline constexpr bool can_nontemporal_fill = has_nontemporal_stores && nontemporal_fill_period<Size> <= 256u;
+
+    // writes count copies of a Size-byte value to dest, bypassing the cache
+    template <size_t Size>
+    SOAGEN_GNU_ATTR(nonnull)
+    inline void nontemporal_fill(void* dest, const void* value, size_t count) noexcept
+    {
+        static_assert(nontemporal_fill_period<Size> <= 256u);
+
+#if SOAGEN_ISET_SSE2
+        constexpr size_t period = nontemporal_fill_period<Size>;
+
+        auto d       = static_cast<std::byte*>(dest);
+        auto pattern = static_cast<const std::byte*>(value);
+        size_t bytes = Size * count;
+
+        // bytes before the first aligned store; the block then starts this far into an element
+        const auto head = min(bytes, static_cast<size_t>((16u - reinterpret_cast<std::uintptr_t>(d) % 16u) % 16u));
+        for (size_t i = 0; i < head; i++)
+            d[i] = pattern[i % Size];
+        d += head;
+        bytes -= head;
+
+        alignas(16) std::byte block[period];
+        for (size_t i = 0; i < period; i++)
+            block[i] = pattern[(head + i) % Size];
+
+        for (; bytes >= period; d += period, bytes -= period)
+            for (size_t i = 0; i < period; i += 16u)
+                _mm_stream_si128(reinterpret_cast<__m128i*>(d + i),
+                                 _mm_load_si128(reinterpret_cast<const __m128i*>(block + i)));
+        _mm_sfence();
+
+        std::memcpy(d, block, bytes);
+#else
+        auto d = static_cast<std::byte*>(dest);
+        for (size_t i = 0; i < count; i++)
+            std::memcpy(d + i * Size, value, Size);
+#endif
+    }
+}
+/// @endcond
+
+#include "header_end.hpp"
@@ -0,0 +1,421 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <array>
+#include <climits>
+#include <cstdint>
+#if SOAGEN_LINUX
+    #include <cstdio>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    inline size_t read_numa_node_count() noexcept
+    {
+#if SOAGEN_LINUX
+        // e.g. "0" or "0-1"; the highest node id is the last number in the list
+        if (auto f = std::fopen("/sys/devices/system/node/possible", "r"))
+        {
+            size_t last = {};
+            size_t val  = {};
+            bool digits = {};
+            for (int c = std::fgetc(f); c != EOF; c = std::fgetc(f))
+            {
+                if (c >= '0' && c <= '9')
+                {
+                    val    = val * 10u + static_cast<size_t>(c - '0');
+                    digits = true;
+                }
+                else
+                {
+                    if (digits)
+                        last = val;
+                    val    = {};
+                    digits = {};
+                }
+            }
+            std::fclose(f);
+            return (digits ? val : last) + 1u;
+        }
+#endif
+        return 1;
+    }
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief Returns the number of NUMA nodes on the system (`1` if it couldn't be determined).
+    SOAGEN_NODISCARD
+    inline std::size_t numa_node_count() noexcept
+    {
+        static const size_t count = detail::read_numa_node_count();
+        return count;
+    }
+
+    /// @brief	An allocator that places its allocations on a particular NUMA node.
+    ///
+    /// @details	Allocations of a page or more are mapped directly from the OS and bound to the node with the
+    ///				`mbind()` syscall (preferred, not strict, so a full node spills rather than failing). Smaller
+    ///				allocations, and every allocation from an allocator without a node, go to #soagen::allocator and
+    ///				land wherever the kernel's first-touch policy puts them.
+    ///
+    /// @details	Allocators compare equal if they target the same node, and propagate with the tables that use
+    ///				them, so a table's storage never changes node behind its back.
+    ///
+    /// @note		Node binding is only implemented on Linux; elsewhere this behaves like #soagen::allocator.
+    class numa_allocator
+    {
+        int node_ = -1;
+
+      public:
+        /// @brief The value type allocated by this allocator.
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
+
+        /// @brief Instances of this allocator are equal only if they target the same node.
+        using is_always_equal = std::false_type;
+
+        /// @brief Instances of this allocator propagate on copy-assignment.
+        using propagate_on_container_copy_assignment = std::true_type;
+
+        /// @brief Instances of this allocator propagate on move-assignment.
+        using propagate_on_container_move_assignment = std::true_type;
+
+        /// @brief Instances of this allocator propagate on swap.
+        using propagate_on_container_swap = std::true_type;
+
+        /// @brief The minimum alignment of any allocations created by this allocator.
+        static constexpr size_type min_alignment = allocator::min_alignment;
+
+        /// @brief The (assumed) size of a memory page.
+        static constexpr size_type page_size = 4096;
+
+      private:
+        SOAGEN_PURE_INLINE_GETTER
+        bool maps(size_type size) const noexcept
+        {
+#if SOAGEN_LINUX
+            return node_ >= 0 && size >= page_size;
+#else
+            static_cast<void>(size);
+            return false;
+#endif
+        }
+
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type round_up(size_type size) noexcept
+        {
+            return (size + page_size - 1u) & ~(page_size - 1u);
+        }
+
+      public:
+        /// @brief Creates an allocator with no preferred node.
+        SOAGEN_NODISCARD_CTOR
+        numa_allocator() noexcept = default;
+
+        /// @brief Creates an allocator that places allocations on the given node (or none, if negative).
+        SOAGEN_NODISCARD_CTOR
+        explicit numa_allocator(int node) noexcept //
+            : node_{ node }
+        {}
+
+        /// @brief Returns the node this allocator places allocations on, or `-1`.
+        SOAGEN_PURE_INLINE_GETTER
+        int node() const noexcept
+        {
+            return node_;
+        }
+
+        /// @brief Alignment-aware allocation.
+        /// @param size The size of the allocation, in bytes.
+        /// @param alignment The minimum alignment, in bytes. Must be a power-of-two.
+        /// @return A new allocation.
+        /// @throws std::bad_alloc If the system allocation function failed.
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
+        {
+            SOAGEN_ASSUME(size);
+
+#if SOAGEN_LINUX
+            if (maps(size))
+            {
+                SOAGEN_ASSERT(static_cast<size_type>(alignment) <= page_size);
+
+                const auto bytes = round_up(size);
+                void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if SOAGEN_UNLIKELY(ptr == MAP_FAILED)
+                    SOAGEN_THROW(std::bad_alloc{});
+
+                // MPOL_PREFERRED (1); failure (no NUMA support, node out of range) just leaves it to first-touch
+                constexpr size_type mask_bits = 1024;
+                if (static_cast<size_type>(node_) < mask_bits)
+                {
+                    unsigned long mask[mask_bits / (sizeof(unsigned long) * CHAR_BIT)] = {};
+                    mask[static_cast<size_type>(node_) / (sizeof(unsigned long) * CHAR_BIT)] =
+                        1ul << (static_cast<size_type>(node_) % (sizeof(unsigned long) * CHAR_BIT));
+                    static_cast<void>(syscall(SYS_mbind, ptr, bytes, 1, mask, mask_bits + 1u, 0u));
+                }
+
+                return soagen::assume_aligned<min_alignment>(static_cast<pointer>(ptr));
+            }
+#endif
+
+            return allocator{}.allocate(size, alignment);
+        }
+
+        /// @brief Deallocation.
+        /// @param ptr The pointer to the memory being deallocated. Must have been acquired via #allocate().
+        /// @param size The size of the allocation, in bytes. Must be the value used for previous call to #allocate().
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
+        {
+            SOAGEN_ASSUME(ptr != nullptr);
+            SOAGEN_ASSUME(size);
+
+#if SOAGEN_LINUX
+            if (maps(size))
+            {
+                munmap(ptr, round_up(size));
+                return;
+            }
+#endif
+
+            allocator{}.deallocate(ptr, size);
+        }
+
+        /// @brief Equality operator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator==(const numa_allocator& lhs, const numa_allocator& rhs) noexcept
+        {
+            return lhs.node_ == rhs.node_;
+        }
+
+        /// @brief Inequality operator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const numa_allocator& lhs, const numa_allocator& rhs) noexcept
+        {
+            return lhs.node_ != rhs.node_;
+        }
+    };
+    static_assert(std::is_nothrow_copy_constructible_v<numa_allocator>);
+    static_assert(std::is_nothrow_move_constructible_v<numa_allocator>);
+
+    /// @brief	A table whose rows are partitioned across several tables, one per NUMA node.
+    ///
+    /// @details	Rows are dealt out to the shards in blocks of `BlockRows`: rows `[0, BlockRows)` go to shard 0,
+    ///				the next block to shard 1, and so on, wrapping around. Row indices are therefore stable and map
+    ///				to a (shard, index) pair in constant time, and the shards stay within one block of each other
+    ///				in size.
+    ///
+    /// @details	Shard `i` is created with `Allocator{ i % numa_node_count() }` (when the allocator can be
+    ///				constructed from a node index), so with the default #soagen::numa_allocator each shard's
+    ///				storage lives on its own node. Parallel scans should give each shard to a thread pinned to
+    ///				that node and walk its columns directly; see #for_each_shard().
+    ///
+    /// @tparam Soa			A table or generated SoA type describing the columns.
+    /// @tparam Shards		The number of shards.
+    /// @tparam BlockRows	The number of consecutive rows that go to the same shard.
+    /// @tparam Allocator	The allocator used by each shard.
+    template <typename Soa, size_t Shards, size_t BlockRows = 1024, typename Allocator = numa_allocator>
+    class sharded_table
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(Shards > 0, "there must be at least one shard");
+        static_assert(BlockRows > 0, "BlockRows may not be zero");
+
+      public:
+        /// @brief The SoA type describing the columns.
+        using soa_type = Soa;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The #soagen::table type of each shard.
+        using shard_type = soagen::table<table_traits_type<Soa>, Allocator>;
+
+        /// @brief The number of shards.
+        static constexpr size_type shard_count = Shards;
+
+        /// @brief The number of consecutive rows that go to the same shard.
+        static constexpr size_type block_rows = BlockRows;
+
+        /// @brief The location of a row within the shards.
+        struct location
+        {
+            /// @brief The shard holding the row.
+            size_type shard;
+
+            /// @brief The row's index in its shard.
+            size_type index;
+        };
+
+      private:
+        std::array<shard_type, Shards> shards_;
+        size_type size_ = {};
+
+        template <size_t... Indices>
+        static std::array<shard_type, Shards> make_shards(std::index_sequence<Indices...>)
+        {
+            if constexpr (std::is_constructible_v<Allocator, int>)
+            {
+                const auto nodes = numa_node_count();
+                return { shard_type{ Allocator{ static_cast<int>(Indices % nodes) } }... };
+            }
+            else
+                return { (static_cast<void>(Indices), shard_type{})... };
+        }
+
+        // the number of rows shard `shard` holds when the whole table has `rows` rows
+        SOAGEN_CONST_GETTER
+        static constexpr size_type shard_rows(size_type rows, size_type shard) noexcept
+        {
+            const auto rem = rows % (BlockRows * Shards);
+            return (rows / (BlockRows * Shards)) * BlockRows
+                 + (rem > shard * BlockRows ? min(rem - shard * BlockRows, BlockRows) : size_type{});
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        sharded_table() //
+            : shards_{ make_shards(std::make_index_sequence<Shards>{}) }
+        {}
+
+        /// @brief Returns the total number of rows.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns true if there are no rows.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !size_;
+        }
+
+        /// @brief Returns the shard and shard-local index of a row.
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr location locate(size_type row) noexcept
+        {
+            const auto block = row / BlockRows;
+            return { block % Shards, (block / Shards) * BlockRows + row % BlockRows };
+        }
+
+        /// @brief Returns the row index of a shard-local index (the inverse of #locate()).
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type row_index(size_type shard, size_type index) noexcept
+        {
+            return ((index / BlockRows) * Shards + shard) * BlockRows + index % BlockRows;
+        }
+
+        /// @brief Returns a shard.
+        ///
+        /// @warning Elements may be modified through the returned table, but rows must not be added or removed.
+        SOAGEN_PURE_INLINE_GETTER
+        shard_type& shard(size_type index) noexcept
+        {
+            SOAGEN_ASSUME(index < Shards);
+            return shards_[index];
+        }
+
+        /// @brief Returns a shard.
+        SOAGEN_PURE_INLINE_GETTER
+        const shard_type& shard(size_type index) const noexcept
+        {
+            SOAGEN_ASSUME(index < Shards);
+            return shards_[index];
+        }
+
+        /// @brief Returns a reference to an element.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        value_type<Soa, Column>& get(size_type row) noexcept
+        {
+            SOAGEN_ASSUME(row < size_);
+            const auto loc = locate(row);
+            return shards_[loc.shard].template column<static_cast<size_type>(Column)>()[loc.index];
+        }
+
+        /// @brief Returns a reference to an element.
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
+        {
+            SOAGEN_ASSUME(row < size_);
+            const auto loc = locate(row);
+            return shards_[loc.shard].template column<static_cast<size_type>(Column)>()[loc.index];
+        }
+
+        /// @brief Invokes `func(shard_index, shard)` for every shard.
+        ///
+        /// @details Combine with #row_index() to recover the table-wide index of a shard's rows.
+        template <typename Func>
+        void for_each_shard(Func&& func)
+        {
+            for (size_type i = 0; i < Shards; i++)
+                func(i, shards_[i]);
+        }
+
+        /// @brief Invokes `func(shard_index, shard)` for every shard.
+        template <typename Func>
+        void for_each_shard(Func&& func) const
+        {
+            for (size_type i = 0; i < Shards; i++)
+                func(i, shards_[i]);
+        }
+
+        /// @brief Reserves storage in each shard for (at least) the given total number of rows.
+        void reserve(size_type new_cap)
+        {
+            for (size_type i = 0; i < Shards; i++)
+                shards_[i].reserve(shard_rows(new_cap, i));
+        }
+
+        /// @brief Appends a row, constructing each column from the corresponding argument.
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            shards_[locate(size_).shard].emplace_back(static_cast<Args&&>(args)...);
+            size_++;
+        }
+
+        /// @brief Removes the last `num` rows (or all of them, if there are fewer than `num`).
+        void pop_back(size_type num = 1) noexcept
+        {
+            num = min(num, size_);
+            for (; num; num--)
+                shards_[locate(--size_).shard].pop_back();
+        }
+
+        /// @brief Removes all rows.
+        void clear() noexcept
+        {
+            for (auto& s : shards_)
+                s.clear();
+            size_ = {};
+        }
+    };
+}
+
+#include "header_end.hpp"
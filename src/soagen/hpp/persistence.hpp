@@ -0,0 +1,607 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdio>
+#if SOAGEN_UNIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+SOAGEN_DISABLE_MSVC_WARNING(4996); // fopen
+
+namespace soagen
+{
+    /// @brief The version of the binary format written by #soagen::save().
+    inline constexpr std::uint32_t persisted_format_version = 1;
+
+    /// @brief The fixed-size header at the start of a file written by #soagen::save().
+    ///
+    /// @details The header is immediately followed by one #soagen::persisted_column per column,
+    ///          then zero-padding up to `data_offset`, then the column data.
+    struct persisted_header
+    {
+        /// @brief Always `"soagen\x1A\0"`.
+        unsigned char magic[8];
+
+        /// @brief The format version (#soagen::persisted_format_version).
+        std::uint32_t version;
+
+        /// @brief `0x01020304` as written by the host; used to reject files written with a different byte order.
+        std::uint32_t byte_order;
+
+        /// @brief The #soagen::schema_hash of the SoA type that wrote the file.
+        std::uint64_t schema_hash;
+
+        /// @brief The number of columns.
+        std::uint64_t column_count;
+
+        /// @brief The number of rows.
+        std::uint64_t row_count;
+
+        /// @brief The number of rows the column data was laid out for (always equal to `row_count` currently).
+        std::uint64_t capacity;
+
+        /// @brief The offset of the column data from the start of the file, in bytes.
+        std::uint64_t data_offset;
+
+        /// @brief The size of the column data (including inter-column padding), in bytes.
+        std::uint64_t data_size;
+    };
+    static_assert(sizeof(persisted_header) == 64);
+
+    /// @brief Describes one column in a file written by #soagen::save().
+    struct persisted_column
+    {
+        /// @brief The size of each element in the column, in bytes.
+        std::uint64_t size;
+
+        /// @brief The column's `alignment`.
+        std::uint64_t alignment;
+
+        /// @brief The offset of the column's first element from the start of the column data, in bytes.
+        std::uint64_t offset;
+
+        /// @brief Reserved; always zero.
+        std::uint64_t reserved;
+    };
+    static_assert(sizeof(persisted_column) == 32);
+
+    /// @cond
+    namespace detail
+    {
+        inline constexpr unsigned char persisted_magic[8] = { 's', 'o', 'a', 'g', 'e', 'n', 0x1A, 0 };
+
+        template <typename Soa>
+        inline constexpr size_t persisted_data_alignment =
+            max(buffer_alignment<table_type<Soa>>, min_actual_column_alignment);
+
+        template <typename Traits>
+        constexpr size_t persisted_layout(persisted_column (&columns)[Traits::column_count], size_t count) noexcept
+        {
+            size_t end = {};
+            for (size_t i = 0; i < Traits::column_count; i++)
+            {
+                const auto align = max(Traits::column_alignments[i], min_actual_column_alignment);
+
+                columns[i].size      = Traits::column_sizes[i];
+                columns[i].alignment = Traits::column_alignments[i];
+                columns[i].offset    = (end + align - 1u) & ~(align - 1u);
+                columns[i].reserved  = {};
+                end                  = columns[i].offset + Traits::column_sizes[i] * count;
+            }
+            return end;
+        }
+
+        template <typename Soa>
+        SOAGEN_NODISCARD
+        bool validate_persisted(const persisted_header& header,
+                                const persisted_column* columns,
+                                std::uint64_t file_size) noexcept
+        {
+            using traits = table_traits_type<Soa>;
+
+            if (std::memcmp(header.magic, persisted_magic, sizeof(persisted_magic)) != 0
+                || header.version != persisted_format_version     //
+                || header.byte_order != 0x01020304u               //
+                || header.schema_hash != schema_hash<Soa>         //
+                || header.column_count != traits::column_count    //
+                || header.row_count != header.capacity            // save() always writes them equal
+                || header.data_offset % persisted_data_alignment<Soa> //
+                || header.data_offset > file_size                 //
+                || header.data_size > file_size - header.data_offset)
+                return false;
+
+            for (size_t i = 0; i < traits::column_count; i++)
+            {
+                const auto align = max(traits::column_alignments[i], min_actual_column_alignment);
+
+                if (columns[i].size != traits::column_sizes[i]            //
+                    || columns[i].alignment != traits::column_alignments[i] //
+                    || columns[i].offset % align                          //
+                    || columns[i].offset > header.data_size               //
+                    || header.row_count > (header.data_size - columns[i].offset) / columns[i].size)
+                    return false;
+            }
+
+            return true;
+        }
+
+#if SOAGEN_WINDOWS
+        using file_offset = __int64;
+#elif SOAGEN_UNIX
+        using file_offset = off_t;
+#else
+        using file_offset = long;
+#endif
+
+        // std::fseek() and std::ftell() use long, which is only 32 bits on Windows
+        SOAGEN_NODISCARD
+        inline bool seek_file(std::FILE* file, std::uint64_t offset) noexcept
+        {
+            if (offset > static_cast<std::uint64_t>(~std::make_unsigned_t<file_offset>{} >> 1))
+                return false;
+
+#if SOAGEN_WINDOWS
+            return ::_fseeki64(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#elif SOAGEN_UNIX
+            return ::fseeko(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#else
+            return std::fseek(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#endif
+        }
+
+        SOAGEN_NODISCARD
+        inline bool get_file_size(std::FILE* file, std::uint64_t& size) noexcept
+        {
+#if SOAGEN_WINDOWS
+            const file_offset end = ::_fseeki64(file, 0, SEEK_END) == 0 ? ::_ftelli64(file) : -1;
+#elif SOAGEN_UNIX
+            const file_offset end = ::fseeko(file, 0, SEEK_END) == 0 ? ::ftello(file) : -1;
+#else
+            const file_offset end = std::fseek(file, 0, SEEK_END) == 0 ? std::ftell(file) : -1;
+#endif
+            if (end < 0)
+                return false;
+
+            size = static_cast<std::uint64_t>(end);
+            return true;
+        }
+
+        SOAGEN_NODISCARD
+        inline bool write_zeros(std::FILE* file, size_t count) noexcept
+        {
+            static constexpr unsigned char zeros[64] = {};
+            while (count)
+            {
+                const auto n = min(count, sizeof(zeros));
+                if (std::fwrite(zeros, 1u, n, file) != n)
+                    return false;
+                count -= n;
+            }
+            return true;
+        }
+    }
+    /// @endcond
+
+    /// @brief Writes the rows of an all-trivially-copyable SoA container to a file in a form that can be
+    ///        memory-mapped with #soagen::map() (or read back with #soagen::load()).
+    ///
+    /// @details The file contains a #soagen::persisted_header, a #soagen::persisted_column for each column, then the
+    ///          raw column data laid out exactly as a table with `capacity() == size()` would lay it out in memory.
+    ///
+    /// @returns True if the file was written successfully.
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool save(const Soa& soa, const char* path) noexcept
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be persisted this way");
+        SOAGEN_ASSUME(path != nullptr);
+
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        const auto& tbl   = static_cast<const table&>(soa);
+        const auto& alloc = detail::table_storage_access::allocation(tbl);
+        const auto count  = static_cast<size_t>(tbl.size());
+
+        persisted_column columns[traits::column_count];
+        const auto data_size = detail::persisted_layout<traits>(columns, count);
+
+        constexpr auto align       = detail::persisted_data_alignment<Soa>;
+        constexpr auto header_size = sizeof(persisted_header) + sizeof(columns);
+
+        persisted_header header{};
+        std::memcpy(header.magic, detail::persisted_magic, sizeof(detail::persisted_magic));
+        header.version      = persisted_format_version;
+        header.byte_order   = 0x01020304u;
+        header.schema_hash  = schema_hash<Soa>;
+        header.column_count = traits::column_count;
+        header.row_count    = count;
+        header.capacity     = count;
+        header.data_offset  = (header_size + align - 1u) & ~(align - 1u);
+        header.data_size    = data_size;
+
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file)
+            return false;
+
+        bool ok = std::fwrite(&header, sizeof(header), 1u, file) == 1u
+               && std::fwrite(columns, sizeof(columns), 1u, file) == 1u
+               && detail::write_zeros(file, static_cast<size_t>(header.data_offset) - header_size);
+
+        size_t pos = {};
+        for (size_t i = 0; ok && i < traits::column_count && count; i++)
+        {
+            const auto bytes = traits::column_sizes[i] * count;
+            ok               = detail::write_zeros(file, static_cast<size_t>(columns[i].offset) - pos)
+                && std::fwrite(alloc.columns[i], 1u, bytes, file) == bytes;
+            pos = static_cast<size_t>(columns[i].offset) + bytes;
+        }
+
+        return (std::fclose(file) == 0) && ok;
+    }
+
+    /// @brief Reads a file written by #soagen::save() into an SoA container, replacing its contents.
+    ///
+    /// @details This is the copying counterpart to #soagen::map(); the column data is read with a single
+    ///          `reserve()` and one contiguous read per column. The indexes and handles of soagen-generated types
+    ///          are rebuilt once all rows have been read.
+    ///
+    /// @returns True if the file was read successfully. Returns false (leaving `soa` empty) if the file could not be
+    ///          read, or was written by a different SoA type (according to #soagen::schema_hash).
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool load(Soa& soa, const char* path)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be persisted this way");
+        SOAGEN_ASSUME(path != nullptr);
+
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        soa.clear();
+        auto& tbl = static_cast<table&>(soa);
+
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file)
+            return false;
+
+        struct file_closer
+        {
+            std::FILE* file;
+
+            ~file_closer() noexcept
+            {
+                std::fclose(file);
+            }
+        } closer{ file };
+
+        persisted_header header;
+        persisted_column columns[traits::column_count];
+        std::uint64_t file_size;
+        if (std::fread(&header, sizeof(header), 1u, file) != 1u
+            || header.column_count != traits::column_count
+            || std::fread(columns, sizeof(columns), 1u, file) != 1u //
+            || !detail::get_file_size(file, file_size)                  //
+            || !detail::validate_persisted<Soa>(header, columns, file_size))
+            return false;
+
+        const auto count = static_cast<size_t>(header.row_count);
+        if (!count)
+            return true;
+
+        tbl.reserve(count);
+        const auto& alloc = detail::table_storage_access::allocation(tbl);
+        for (size_t i = 0; i < traits::column_count; i++)
+        {
+            const auto bytes = traits::column_sizes[i] * count;
+            if (!detail::seek_file(file, header.data_offset + columns[i].offset)
+                || std::fread(alloc.columns[i], 1u, bytes, file) != bytes)
+                return false;
+        }
+
+        detail::table_storage_access::set_size(tbl, count);
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
+
+    /// @brief How #soagen::map() maps a file into memory.
+    enum class map_mode : unsigned
+    {
+        /// @brief The mapped rows are read-only.
+        read_only,
+
+        /// @brief The mapped rows may be written (via #soagen::mapped::span()) but the changes are private to the
+        ///        process and never written back to the file.
+        copy_on_write
+    };
+
+    /// @brief An all-trivially-copyable SoA container whose rows live directly in a memory-mapped file.
+    ///
+    /// @details Created by #soagen::map(). The container is exposed as a `const` reference so it can be
+    ///          passed anywhere a regular table is expected, but it may not be resized or reallocated.
+    ///
+    /// @availability Memory mapping is only available on POSIX systems. Elsewhere the file is read into an
+    ///               ordinary heap allocation with #soagen::load() instead.
+    template <typename Soa>
+    class mapped
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!detail::is_cvref<Soa>::value, "Soa may not be cvref-qualified.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be memory-mapped");
+        static_assert(std::is_nothrow_default_constructible_v<Soa>,
+                      "only SoA types with a nothrow default-constructible allocator may be memory-mapped");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "SoA types with indexes or handles can't be memory-mapped; use soagen::load() instead");
+
+      public:
+        /// @brief The mapped SoA type.
+        using soa_type = Soa;
+
+        /// @brief Unsigned integer size type used by the SoA type.
+        using size_type = std::size_t;
+
+        /// @brief The #soagen::span type returned by #span().
+        using span_type = soagen::span_type<Soa>;
+
+        /// @brief The #soagen::span type returned by #const_span().
+        using const_span_type = soagen::const_span_type<Soa>;
+
+      private:
+        /// @cond
+        using table = table_type<Soa>;
+
+        Soa soa_;
+        void* address_ = {};
+        size_t length_ = {};
+        bool open_     = {};
+        bool writable_ = {};
+
+        void transfer_from(mapped& other) noexcept
+        {
+            auto& src = static_cast<table&>(other.soa_);
+            if (other.address_)
+            {
+                detail::table_storage_access::adopt(static_cast<table&>(soa_),
+                                                    detail::table_storage_access::allocation(src),
+                                                    src.size(),
+                                                    src.capacity());
+                detail::table_storage_access::release(src);
+            }
+            else
+                soa_ = static_cast<Soa&&>(other.soa_);
+
+            address_  = std::exchange(other.address_, nullptr);
+            length_   = std::exchange(other.length_, size_t{});
+            open_     = std::exchange(other.open_, false);
+            writable_ = std::exchange(other.writable_, false);
+        }
+
+        /// @endcond
+
+      public:
+        /// @brief Default constructor. Creates an empty mapping not associated with any file.
+        SOAGEN_NODISCARD_CTOR
+        mapped() noexcept = default;
+
+        /// @brief Maps a file written by #soagen::save().
+        ///
+        /// @details Check for success with #operator bool().
+        SOAGEN_NODISCARD_CTOR
+        explicit mapped(const char* path, map_mode mode = map_mode::read_only)
+        {
+            SOAGEN_ASSUME(path != nullptr);
+
+#if SOAGEN_UNIX
+            using traits = table_traits_type<Soa>;
+
+            const int fd = ::open(path, O_RDONLY);
+            if (fd < 0)
+                return;
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || static_cast<std::uint64_t>(st.st_size) < sizeof(persisted_header))
+            {
+                ::close(fd);
+                return;
+            }
+
+            const auto length = static_cast<size_t>(st.st_size);
+            void* address     = ::mmap(nullptr,
+                                   length,
+                                   mode == map_mode::read_only ? PROT_READ : (PROT_READ | PROT_WRITE),
+                                   MAP_PRIVATE,
+                                   fd,
+                                   0);
+            ::close(fd);
+            if (address == MAP_FAILED)
+                return;
+
+            const auto base    = static_cast<std::byte*>(address);
+            const auto& header = *reinterpret_cast<const persisted_header*>(base);
+            const auto columns = reinterpret_cast<const persisted_column*>(base + sizeof(persisted_header));
+
+            if (length < sizeof(persisted_header) + sizeof(persisted_column) * traits::column_count
+                || header.column_count != traits::column_count
+                || !detail::validate_persisted<Soa>(header, columns, length)
+                || reinterpret_cast<std::uintptr_t>(base + header.data_offset)
+                           % detail::persisted_data_alignment<Soa>)
+            {
+                ::munmap(address, length);
+                return;
+            }
+
+            if (header.row_count)
+            {
+                detail::table_allocation<traits::column_count> alloc{};
+                alloc.ptr  = base + header.data_offset;
+                alloc.size = static_cast<size_t>(header.data_size);
+                for (size_t i = 0; i < traits::column_count; i++)
+                    alloc.columns[i] = alloc.ptr + columns[i].offset;
+
+                detail::table_storage_access::adopt(static_cast<table&>(soa_),
+                                                    alloc,
+                                                    static_cast<size_t>(header.row_count),
+                                                    static_cast<size_t>(header.capacity));
+            }
+
+            address_  = address;
+            length_   = length;
+            open_     = true;
+            writable_ = mode == map_mode::copy_on_write;
+#else
+            open_     = load(soa_, path);
+            writable_ = open_ && mode == map_mode::copy_on_write;
+#endif
+        }
+
+        /// @brief Move constructor.
+        SOAGEN_NODISCARD_CTOR
+        mapped(mapped&& other) noexcept
+        {
+            transfer_from(other);
+        }
+
+        /// @brief Move-assignment operator.
+        mapped& operator=(mapped&& rhs) noexcept
+        {
+            if SOAGEN_LIKELY(&rhs != this)
+            {
+                close();
+                transfer_from(rhs);
+            }
+            return *this;
+        }
+
+        /// @brief Destructor. Unmaps the file.
+        ~mapped() noexcept
+        {
+            close();
+        }
+
+        /// @brief Unmaps the file (if any).
+        void close() noexcept
+        {
+            if (address_)
+            {
+                detail::table_storage_access::release(static_cast<table&>(soa_));
+#if SOAGEN_UNIX
+                ::munmap(address_, length_);
+#endif
+                address_ = nullptr;
+                length_  = {};
+            }
+            else
+                static_cast<table&>(soa_).clear();
+
+            open_     = false;
+            writable_ = false;
+        }
+
+        /// @brief Returns true if a file was mapped successfully.
+        SOAGEN_PURE_INLINE_GETTER
+        explicit operator bool() const noexcept
+        {
+            return open_;
+        }
+
+        /// @brief Returns true if the rows may be modified through #span().
+        SOAGEN_PURE_INLINE_GETTER
+        bool writable() const noexcept
+        {
+            return writable_;
+        }
+
+        /// @brief Returns the number of rows.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return static_cast<size_type>(soa_.size());
+        }
+
+        /// @brief Returns true if the number of rows is zero.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return soa_.empty();
+        }
+
+        /// @brief Returns the mapped SoA container.
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa& get() const noexcept
+        {
+            return soa_;
+        }
+
+        /// @brief Returns the mapped SoA container.
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa& operator*() const noexcept
+        {
+            return soa_;
+        }
+
+        /// @brief Returns the mapped SoA container.
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa* operator->() const noexcept
+        {
+            return &soa_;
+        }
+
+        /// @brief Returns a read-only span over all of the rows.
+        SOAGEN_PURE_INLINE_GETTER
+        const_span_type const_span() const noexcept
+        {
+            if (soa_.empty())
+                return {};
+            return const_span_type{ soa_ };
+        }
+
+        /// @brief Returns a mutable span over all of the rows.
+        ///
+        /// @attention The mapping must have been opened with #map_mode::copy_on_write.
+        SOAGEN_PURE_INLINE_GETTER
+        span_type span() noexcept
+        {
+            SOAGEN_ASSERT(writable_ && "the mapping must be opened with map_mode::copy_on_write to be written");
+
+            if (soa_.empty())
+                return {};
+            return span_type{ soa_ };
+        }
+    };
+
+    /// @brief Memory-maps a file written by #soagen::save().
+    ///
+    /// @details This is zero-copy: the rows are not read until they are accessed, so startup time is independent of
+    ///          the size of the file. @cpp
+    ///
+    /// auto m = soagen::map<entities>("entities.bin");
+    /// if (m)
+    ///     process(*m);
+    ///
+    /// @ecpp
+    ///
+    /// @returns A #soagen::mapped; check for success with `operator bool()`. Files written by a different SoA type
+    ///          (according to #soagen::schema_hash) are rejected.
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    mapped<Soa> map(const char* path, map_mode mode = map_mode::read_only)
+    {
+        return mapped<Soa>{ path, mode };
+    }
+}
+
+#include "header_end.hpp"
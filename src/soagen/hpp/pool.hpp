@@ -0,0 +1,337 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "allocator.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <cstdint>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    struct pool_counters
+    {
+        std::atomic<size_t> allocations;
+        std::atomic<size_t> hits;
+        std::atomic<size_t> deallocations;
+        std::atomic<size_t> releases;
+    };
+
+    inline pool_counters pool_stats_ = {};
+
+    // a per-thread cache of freed buffers, bucketed by size class and by the alignment each buffer actually has
+    class pool_cache
+    {
+      public:
+        static constexpr size_t min_class_log2   = 6;  // 64 bytes
+        static constexpr size_t size_classes     = 16; // ... 2 MiB
+        static constexpr size_t min_align_log2   = 4;  // 16 bytes
+        static constexpr size_t align_classes    = 9;  // ... 4 KiB
+        static constexpr size_t max_bucket_count = 16;
+        static constexpr size_t max_cached_bytes = size_t{ 16 } * 1024u * 1024u;
+
+        static constexpr size_t max_pooled_size      = size_t{ 1 } << (min_class_log2 + size_classes - 1u);
+        static constexpr size_t max_pooled_alignment = size_t{ 1 } << (min_align_log2 + align_classes - 1u);
+
+      private:
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        free_block* buckets_[size_classes][align_classes] = {};
+        size_t counts_[size_classes][align_classes]       = {};
+        size_t cached_bytes_                              = {};
+
+        static constexpr size_t log2_ceil(size_t val) noexcept
+        {
+            size_t log2 = 0;
+            while ((size_t{ 1 } << log2) < val)
+                log2++;
+            return log2;
+        }
+
+      public:
+        SOAGEN_CONST_GETTER
+        static constexpr size_t size_class(size_t size) noexcept
+        {
+            const auto log2 = log2_ceil(size);
+            return log2 > min_class_log2 ? log2 - min_class_log2 : 0u;
+        }
+
+        SOAGEN_CONST_GETTER
+        static constexpr size_t class_size(size_t size_class) noexcept
+        {
+            return size_t{ 1 } << (size_class + min_class_log2);
+        }
+
+        SOAGEN_CONST_GETTER
+        static constexpr size_t align_class(size_t alignment) noexcept
+        {
+            const auto log2 = log2_ceil(alignment);
+            return log2 > min_align_log2 ? log2 - min_align_log2 : 0u;
+        }
+
+        // set when the thread's cache is destroyed. trivially destructible, so unlike the cache it can still be read
+        // by buffers freed later in thread-exit teardown (e.g. by static tables)
+        SOAGEN_PURE_INLINE_GETTER
+        static bool& destroyed() noexcept
+        {
+            static thread_local bool flag = false;
+            return flag;
+        }
+
+        pool_cache() noexcept = default;
+
+        pool_cache(const pool_cache&)            = delete;
+        pool_cache& operator=(const pool_cache&) = delete;
+
+        ~pool_cache() noexcept
+        {
+            trim();
+            destroyed() = true;
+        }
+
+        // pops a cached buffer of the given size class aligned to at least the given alignment class
+        std::byte* pop(size_t sc, size_t ac) noexcept
+        {
+            for (; ac < align_classes; ac++)
+            {
+                if (auto b = buckets_[sc][ac])
+                {
+                    buckets_[sc][ac] = b->next;
+                    counts_[sc][ac]--;
+                    cached_bytes_ -= class_size(sc);
+                    return reinterpret_cast<std::byte*>(b);
+                }
+            }
+            return nullptr;
+        }
+
+        // caches a buffer, returning false if the cache is full
+        bool push(std::byte* ptr, size_t sc) noexcept
+        {
+            const auto bytes = class_size(sc);
+            const auto tz    = static_cast<size_t>(countr_zero(reinterpret_cast<std::uintptr_t>(ptr)));
+            const auto ac    = tz > min_align_log2 ? min(tz - min_align_log2, align_classes - 1u) : 0u;
+
+            if (counts_[sc][ac] >= max_bucket_count || cached_bytes_ + bytes > max_cached_bytes)
+                return false;
+
+            buckets_[sc][ac] = ::new (static_cast<void*>(ptr)) free_block{ buckets_[sc][ac] };
+            counts_[sc][ac]++;
+            cached_bytes_ += bytes;
+            return true;
+        }
+
+        void trim() noexcept
+        {
+            for (size_t sc = 0; sc < size_classes; sc++)
+            {
+                for (size_t ac = 0; ac < align_classes; ac++)
+                {
+                    while (auto b = buckets_[sc][ac])
+                    {
+                        buckets_[sc][ac] = b->next;
+                        allocator{}.deallocate(reinterpret_cast<std::byte*>(b), class_size(sc));
+                        pool_stats_.releases.fetch_add(1u, std::memory_order_relaxed);
+                    }
+                    counts_[sc][ac] = 0;
+                }
+            }
+            cached_bytes_ = 0;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_t cached_bytes() const noexcept
+        {
+            return cached_bytes_;
+        }
+
+        // the calling thread's cache, or nullptr if it has already been destroyed
+        static pool_cache* local() noexcept
+        {
+            if (destroyed())
+                return nullptr;
+
+            static thread_local pool_cache cache;
+            return &cache;
+        }
+    };
+}
+/// @endcond
+
+namespace soagen
+{
+    /// @brief Usage statistics for #soagen::pool_allocator.
+    struct pool_stats
+    {
+        /// @brief The number of allocations requested.
+        std::size_t allocations;
+
+        /// @brief The number of allocations served from a thread's cache.
+        std::size_t hits;
+
+        /// @brief The number of deallocations.
+        std::size_t deallocations;
+
+        /// @brief The number of buffers returned to the system (a cache was full, trimmed or its thread exited).
+        std::size_t releases;
+
+        /// @brief Returns the fraction of allocations served from a cache.
+        SOAGEN_PURE_GETTER
+        double hit_rate() const noexcept
+        {
+            return allocations ? static_cast<double>(hits) / static_cast<double>(allocations) : 0.0;
+        }
+    };
+
+    /// @brief	A thread-caching allocator that recycles table buffers.
+    ///
+    /// @details	Buffers are rounded up to a power-of-two size class. When freed they go to a small cache owned by
+    ///				the freeing thread, bucketed by size class and by the alignment of the buffer, and are handed
+    ///				back out to the next request on that thread with the same size class and a compatible alignment
+    ///				(e.g. the `buffer_alignment` of the same table type). Allocation and deallocation never lock.
+    ///
+    /// @details	Each thread caches at most 16 buffers per bucket and 16 MiB in total; anything else, and buffers
+    ///				larger than 2 MiB or aligned to more than 4 KiB, goes straight to #soagen::allocator. Use #stats()
+    ///				to check the hit rate.
+    ///
+    /// @note		Buffers may be freed on a different thread to the one that allocated them.
+    struct pool_allocator
+    {
+        /// @brief The value type allocated by this allocator.
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
+
+        /// @brief Instances of this allocator are always equal.
+        using is_always_equal = std::true_type;
+
+        /// @brief Instances of this allocator don't propagate on copy-assignment.
+        using propagate_on_container_copy_assignment = std::false_type;
+
+        /// @brief Instances of this allocator don't propagate on move-assignment.
+        using propagate_on_container_move_assignment = std::false_type;
+
+        /// @brief Instances of this allocator don't propagate on swap.
+        using propagate_on_container_swap = std::false_type;
+
+        /// @brief The minimum alignment of any allocations created by this allocator.
+        static constexpr size_type min_alignment = allocator::min_alignment;
+
+        /// @brief Alignment-aware allocation.
+        /// @param size The size of the allocation, in bytes.
+        /// @param alignment The minimum alignment, in bytes. Must be a power-of-two.
+        /// @return A new allocation.
+        /// @throws std::bad_alloc If the system aligned-allocation function failed.
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
+        {
+            using cache = detail::pool_cache;
+
+            detail::pool_stats_.allocations.fetch_add(1u, std::memory_order_relaxed);
+            if (size > cache::max_pooled_size)
+                return allocator{}.allocate(size, alignment);
+
+            // cached buffers are only known to be aligned up to the largest alignment class, so stricter requests
+            // always go to the system. they're still rounded up to the size class, since deallocate() can't tell
+            // them apart and will cache them like any other buffer (in the largest alignment class).
+            const auto sc = cache::size_class(size);
+            if (static_cast<size_t>(alignment) > cache::max_pooled_alignment)
+                return allocator{}.allocate(cache::class_size(sc), alignment);
+
+            const auto c = cache::local();
+            if (auto ptr = c ? c->pop(sc, cache::align_class(static_cast<size_t>(alignment))) : nullptr)
+            {
+                detail::pool_stats_.hits.fetch_add(1u, std::memory_order_relaxed);
+                return soagen::assume_aligned<min_alignment>(ptr);
+            }
+
+            return allocator{}.allocate(cache::class_size(sc), alignment);
+        }
+
+        /// @brief Deallocation.
+        /// @param ptr The pointer to the memory being deallocated. Must have been acquired via #allocate().
+        /// @param size The size of the allocation, in bytes. Must be the value used for previous call to #allocate().
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
+        {
+            using cache = detail::pool_cache;
+
+            detail::pool_stats_.deallocations.fetch_add(1u, std::memory_order_relaxed);
+            if (size <= cache::max_pooled_size)
+            {
+                if (const auto c = cache::local(); c && c->push(ptr, cache::size_class(size)))
+                    return;
+            }
+
+            detail::pool_stats_.releases.fetch_add(1u, std::memory_order_relaxed);
+            allocator{}.deallocate(ptr, size);
+        }
+
+        /// @brief Returns usage statistics for all threads.
+        SOAGEN_NODISCARD
+        static pool_stats stats() noexcept
+        {
+            return { detail::pool_stats_.allocations.load(std::memory_order_relaxed),
+                     detail::pool_stats_.hits.load(std::memory_order_relaxed),
+                     detail::pool_stats_.deallocations.load(std::memory_order_relaxed),
+                     detail::pool_stats_.releases.load(std::memory_order_relaxed) };
+        }
+
+        /// @brief Resets the usage statistics to zero.
+        static void reset_stats() noexcept
+        {
+            detail::pool_stats_.allocations.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.hits.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.deallocations.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.releases.store(0u, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the number of bytes held in the calling thread's cache.
+        SOAGEN_NODISCARD
+        static size_type cached_bytes() noexcept
+        {
+            const auto c = detail::pool_cache::local();
+            return c ? c->cached_bytes() : 0u;
+        }
+
+        /// @brief Returns every buffer in the calling thread's cache to the system.
+        static void trim() noexcept
+        {
+            if (const auto c = detail::pool_cache::local())
+                c->trim();
+        }
+
+        /// @brief Equality operator.
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator==(const pool_allocator&, const pool_allocator&) noexcept
+        {
+            return true;
+        }
+
+        /// @brief Inequality operator.
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator!=(const pool_allocator&, const pool_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+    static_assert(std::is_trivially_default_constructible_v<pool_allocator>);
+    static_assert(std::is_trivially_copy_constructible_v<pool_allocator>);
+    static_assert(std::is_trivially_destructible_v<pool_allocator>);
+}
+
+#include "header_end.hpp"
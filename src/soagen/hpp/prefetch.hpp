@@ -0,0 +1,236 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "iterator.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <iterator>
+#include <memory>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @cond
+    namespace detail
+    {
+        template <typename Row>
+        SOAGEN_ALWAYS_INLINE
+        void prefetch_row(Row&& row) noexcept
+        {
+            for_each_column(static_cast<Row&&>(row),
+                            [](auto&& value) noexcept { SOAGEN_PREFETCH(std::addressof(value)); });
+        }
+    }
+    /// @endcond
+
+    /// @brief	A row iterator that prefetches the columns it views some number of rows ahead.
+    ///
+    /// @details	Each increment issues a #SOAGEN_PREFETCH for every viewed column of the row #distance() rows
+    ///				ahead (if there is one), so scans over many columns at once don't have to rely on the hardware
+    ///				prefetcher tracking every stream. Dereferencing is unchanged.
+    ///
+    /// @tparam Iterator	A #soagen::iterator or #soagen::selection_iterator.
+    ///
+    /// @see #soagen::prefetched()
+    template <typename Iterator>
+    class prefetch_iterator
+    {
+      public:
+        /// @brief The wrapped iterator type.
+        using iterator_type = Iterator;
+
+        /// @brief Signed integer difference type.
+        using difference_type = typename Iterator::difference_type;
+
+        /// @brief The #soagen::row type dereferenced by this iterator.
+        using value_type = typename Iterator::value_type;
+
+        /// @brief Alias for #value_type.
+        using reference = typename Iterator::reference;
+
+        /// @brief Prefetching is only worthwhile going forward.
+        using iterator_category = std::forward_iterator_tag;
+
+#if SOAGEN_CPP <= 17
+        using pointer = void;
+#endif
+
+      private:
+        Iterator it_;
+        Iterator end_;
+        difference_type distance_;
+
+        SOAGEN_ALWAYS_INLINE
+        void prefetch() const noexcept
+        {
+            if (end_ - it_ > distance_)
+                detail::prefetch_row(it_[distance_]);
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        prefetch_iterator() noexcept //
+            : it_{},
+              end_{},
+              distance_{}
+        {}
+
+        /// @brief	Wraps an iterator.
+        ///
+        /// @param	it			The position to start at.
+        /// @param	end			The end of the range (rows past this are never prefetched).
+        /// @param	distance	How many rows ahead to prefetch. Zero disables prefetching.
+        SOAGEN_NODISCARD_CTOR
+        prefetch_iterator(Iterator it, Iterator end, difference_type distance) noexcept //
+            : it_{ it },
+              end_{ end },
+              distance_{ distance }
+        {
+            if (distance_ > 0)
+                prefetch();
+        }
+
+        /// @brief Returns the wrapped iterator.
+        SOAGEN_PURE_INLINE_GETTER
+        Iterator base() const noexcept
+        {
+            return it_;
+        }
+
+        /// @brief Returns how many rows ahead the iterator prefetches.
+        SOAGEN_PURE_INLINE_GETTER
+        difference_type distance() const noexcept
+        {
+            return distance_;
+        }
+
+        /// @brief Increments the iterator by one row (pre-fix).
+        prefetch_iterator& operator++() noexcept
+        {
+            ++it_;
+            if (distance_ > 0)
+                prefetch();
+            return *this;
+        }
+
+        /// @brief Increments the iterator by one row (post-fix).
+        prefetch_iterator operator++(int) noexcept
+        {
+            prefetch_iterator pre = *this;
+            ++(*this);
+            return pre;
+        }
+
+        /// @brief Returns the row the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        reference operator*() const noexcept
+        {
+            return *it_;
+        }
+
+        /// @brief Returns the row the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        detail::arrow_proxy<value_type> operator->() const noexcept
+        {
+            return { *it_ };
+        }
+
+        /// @brief Returns true if two iterators refer to the same row.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator==(const prefetch_iterator& lhs, const prefetch_iterator& rhs) noexcept
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        /// @brief Returns true if two iterators do not refer to the same row.
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const prefetch_iterator& lhs, const prefetch_iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /// @brief A range of #soagen::prefetch_iterator, as returned by #soagen::prefetched().
+    template <typename Iterator>
+    class prefetch_range
+    {
+      public:
+        /// @brief The #soagen::prefetch_iterator type.
+        using iterator = prefetch_iterator<Iterator>;
+
+        /// @brief Signed integer difference type.
+        using difference_type = typename Iterator::difference_type;
+
+      private:
+        Iterator begin_;
+        Iterator end_;
+        difference_type distance_;
+
+      public:
+        /// @brief Constructs a prefetching range over `[begin, end)`.
+        SOAGEN_NODISCARD_CTOR
+        prefetch_range(Iterator begin, Iterator end, difference_type distance) noexcept //
+            : begin_{ begin },
+              end_{ end },
+              distance_{ distance }
+        {}
+
+        /// @brief Returns an iterator to the first row in the range.
+        SOAGEN_PURE_INLINE_GETTER
+        iterator begin() const noexcept
+        {
+            return { begin_, end_, distance_ };
+        }
+
+        /// @brief Returns an iterator to one-past-the-last row in the range.
+        SOAGEN_PURE_INLINE_GETTER
+        iterator end() const noexcept
+        {
+            return { end_, end_, distance_ };
+        }
+    };
+
+    /// @brief	Iterates over a table, span or selection while prefetching the viewed columns some rows ahead.
+    ///
+    /// @details	@cpp
+    /// for (auto&& row : soagen::prefetched(particles, 16))
+    ///     row.position += row.velocity * dt;
+    /// @ecpp
+    ///
+    /// @param	range		A table, span or selection (anything with `begin()` and `end()` returning soagen iterators).
+    ///						It must outlive the returned range.
+    /// @param	distance	How many rows ahead to prefetch. Worth tuning per workload: too small and the data won't
+    ///						have arrived yet, too large and it'll have been evicted again. Zero disables prefetching.
+    template <typename Range>
+    SOAGEN_NODISCARD
+    auto prefetched(Range& range, size_t distance) noexcept
+    {
+        using iterator_type = decltype(range.begin());
+        return prefetch_range<iterator_type>{ range.begin(),
+                                              range.end(),
+                                              static_cast<typename iterator_type::difference_type>(distance) };
+    }
+
+    /// @brief Iterates over some of the columns of a table or span while prefetching them some rows ahead.
+    ///
+    /// @details	Only the selected columns are prefetched, so this is the one to use when a scan touches just a
+    ///				few columns of a wide table: @cpp
+    /// for (auto&& row : soagen::prefetched<particles::columns::position, particles::columns::velocity>(p, 16))
+    ///     row.position += row.velocity * dt;
+    /// @ecpp
+    template <auto Column, auto... Columns, typename Range>
+    SOAGEN_NODISCARD
+    auto prefetched(Range& range, size_t distance) noexcept
+    {
+        using iterator_type = decltype(range.template begin<Column, Columns...>());
+        return prefetch_range<iterator_type>{ range.template begin<Column, Columns...>(),
+                                              range.template end<Column, Columns...>(),
+                                              static_cast<typename iterator_type::difference_type>(distance) };
+    }
+}
+
+#include "header_end.hpp"
@@ -204,6 +204,17 @@
 /// @brief Marks a position in the code as being unreachable.
 /// @warning Using this incorrectly can lead to seriously mis-compiled code!
 
+#ifndef SOAGEN_PREFETCH
+    #if SOAGEN_GCC_LIKE || SOAGEN_CLANG || SOAGEN_HAS_BUILTIN(__builtin_prefetch)
+        #define SOAGEN_PREFETCH(ptr) __builtin_prefetch(static_cast<const void*>(ptr))
+    #else
+        #define SOAGEN_PREFETCH(ptr) static_cast<void>(ptr)
+    #endif
+#endif
+/// @def SOAGEN_PREFETCH
+/// @brief Hints to the CPU that the memory at some address will be read soon.
+/// @details Never faults, even on an invalid address; a no-op on compilers without `__builtin_prefetch`.
+
 #ifndef SOAGEN_MAKE_STRING
     #define SOAGEN_MAKE_STRING_2(s) #s
     #define SOAGEN_MAKE_STRING_1(s) SOAGEN_MAKE_STRING_2(s)
@@ -0,0 +1,801 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "row.hpp"
+#include "span.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+#if SOAGEN_HAS_EXCEPTIONS
+    #include <stdexcept>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+
+namespace soagen
+{
+    /// @cond
+    template <typename>
+    class selection;
+
+    namespace detail
+    {
+        template <typename>
+        struct is_selection_ : std::false_type
+        {};
+        template <typename Soa>
+        struct is_selection_<selection<Soa>> : std::true_type
+        {};
+
+        template <typename Soa>
+        struct selection_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            std::vector<size_t> indices;
+        };
+
+        template <typename Soa>
+        struct selection_iterator_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            const size_t* pos;
+        };
+    }
+    /// @endcond
+
+    /// @brief True if `T` is a #soagen::selection.
+    template <typename T>
+    inline constexpr bool is_selection = POXY_IMPLEMENTATION_DETAIL(detail::is_selection_<std::remove_cv_t<T>>::value);
+
+    /// @brief RandomAccessIterator over the rows of a #soagen::selection.
+    template <typename Soa, size_t... Columns>
+    class SOAGEN_EMPTY_BASES selection_iterator //
+        SOAGEN_HIDDEN_BASE(protected detail::selection_iterator_storage<detail::remove_cvref<Soa>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
+
+      public:
+        /// @brief Base SoA type for this iterator.
+        using soa_type = detail::remove_cvref<Soa>;
+
+        /// @brief Cvref-qualified version of #soa_type.
+        using soa_ref = detail::coerce_ref<Soa>;
+
+        /// @brief Unsigned integer size type used by the corresponding SoA type.
+        using size_type = std::size_t;
+
+        /// @brief Signed integer difference type used by the corresponding SoA type.
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief The #soagen::row type dereferenced by this iterator.
+        using row_type = soagen::row_type<Soa, Columns...>;
+
+        /// @brief Alias for #row_type.
+        using value_type = row_type;
+
+        /// @brief Alias for #row_type.
+        using reference = row_type;
+
+        /// @brief This iterator type is a RandomAccessIterator.
+        using iterator_category = std::random_access_iterator_tag;
+
+#if SOAGEN_CPP <= 17
+        using pointer = void;
+#endif
+
+      private:
+        /// @cond
+        using base = detail::selection_iterator_storage<detail::remove_cvref<Soa>>;
+        /// @endcond
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        constexpr selection_iterator() noexcept //
+            : base{}
+        {}
+
+        /// @brief Constructs an iterator to some position in a selection's list of row indices.
+        SOAGEN_NODISCARD_CTOR
+        constexpr selection_iterator(soa_ref src, const size_type* pos) noexcept //
+            : base{ const_cast<soa_type*>(&src), pos }
+        {}
+
+        /// @brief Returns the index of the row in the source SoA container that the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type source_index() const noexcept
+        {
+            SOAGEN_ASSUME(!!base::pos);
+
+            return *base::pos;
+        }
+
+        /// @brief Increments the iterator by one row (pre-fix).
+        friend constexpr selection_iterator& operator++(selection_iterator& it) noexcept
+        {
+            ++it.pos;
+            return it;
+        }
+
+        /// @brief Increments the iterator by one row (post-fix).
+        friend constexpr selection_iterator operator++(selection_iterator& it, int) noexcept
+        {
+            selection_iterator pre = it;
+            ++it.pos;
+            return pre;
+        }
+
+        /// @brief Increments the iterator by some arbitrary number of rows.
+        friend constexpr selection_iterator& operator+=(selection_iterator& it, difference_type n) noexcept
+        {
+            it.pos += n;
+            return it;
+        }
+
+        /// @brief Returns a copy of an iterator incremented by some arbitrary number of rows.
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator+(const selection_iterator& it, difference_type n) noexcept
+        {
+            auto it2 = it;
+            it2 += n;
+            return it2;
+        }
+
+        /// @brief Returns a copy of an iterator incremented by some arbitrary number of rows.
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator+(difference_type n, const selection_iterator& it) noexcept
+        {
+            return it + n;
+        }
+
+        /// @brief Decrements the iterator by one row (pre-fix).
+        friend constexpr selection_iterator& operator--(selection_iterator& it) noexcept
+        {
+            --it.pos;
+            return it;
+        }
+
+        /// @brief Decrements the iterator by one row (post-fix).
+        friend constexpr selection_iterator operator--(selection_iterator& it, int) noexcept
+        {
+            selection_iterator pre = it;
+            --it.pos;
+            return pre;
+        }
+
+        /// @brief Decrements the iterator by some arbitrary number of rows.
+        friend constexpr selection_iterator& operator-=(selection_iterator& it, difference_type n) noexcept
+        {
+            it.pos -= n;
+            return it;
+        }
+
+        /// @brief Returns a copy of an iterator decremented by some arbitrary number of rows.
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator-(const selection_iterator& it, difference_type n) noexcept
+        {
+            auto it2 = it;
+            it2 -= n;
+            return it2;
+        }
+
+        /// @brief Returns the difference between two iterators.
+        SOAGEN_PURE_GETTER
+        friend constexpr difference_type operator-(const selection_iterator& lhs,
+                                                   const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos - rhs.pos;
+        }
+
+        /// @brief Returns the row the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator*() const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(!!base::pos);
+
+            return static_cast<soa_ref>(*base::soa).template row<Columns...>(*base::pos);
+        }
+
+        /// @brief Returns the row the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr detail::arrow_proxy<row_type> operator->() const noexcept
+        {
+            return { *(*this) };
+        }
+
+        /// @brief Returns the row at some arbitrary offset from the one the iterator refers to.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator[](difference_type offset) const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(!!base::pos);
+
+            return static_cast<soa_ref>(*base::soa).template row<Columns...>(base::pos[offset]);
+        }
+
+        /// @brief Returns true if two iterators refer to the same position in the same selection.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator==(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos == rhs.pos;
+        }
+
+        /// @brief Returns true if two iterators do not refer to the same position in the same selection.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator!=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos != rhs.pos;
+        }
+
+        /// @brief Returns true if the LHS iterator refers to a position before the RHS iterator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator<(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos < rhs.pos;
+        }
+
+        /// @brief Returns true if the LHS iterator refers to a position before or equal to the RHS iterator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator<=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos <= rhs.pos;
+        }
+
+        /// @brief Returns true if the LHS iterator refers to a position after the RHS iterator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator>(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos > rhs.pos;
+        }
+
+        /// @brief Returns true if the LHS iterator refers to a position after or equal to the RHS iterator.
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator>=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos >= rhs.pos;
+        }
+    };
+
+    /// @brief		Base class for soagen::selection.
+    /// @details	Specialize this to add functionality to all selections of a particular type via CRTP.
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES selection_base
+    {};
+
+    /// @brief A view of an arbitrary (filtered) subset of a SoA container's rows.
+    ///
+    /// @details Selections store a list of row indices into the source container rather than copies of the rows,
+    ///          so multi-stage filters can be composed without materializing intermediate tables: @cpp
+    ///
+    /// auto adults = soagen::select<employees::columns::age>(staff, [](int age) { return age >= 18; });
+    /// auto rich   = adults.filter<employees::columns::salary>([](int s) { return s > 100000; });
+    /// auto total  = rich.reduce<employees::columns::salary>(0ll, std::plus<>{});
+    ///
+    /// @ecpp
+    ///
+    /// @attention Like spans, selections are invalidated by any operation that changes the number of rows in
+    ///            (or reallocates) the source container.
+    template <typename Soa>
+    class SOAGEN_EMPTY_BASES selection //
+        SOAGEN_HIDDEN_BASE(protected detail::selection_storage<detail::remove_cvref<Soa>>,
+                           public selection_base<selection<Soa>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_reference_v<Soa>, "Soa may not be a reference.");
+        static_assert(std::is_empty_v<selection_base<selection<Soa>>>,
+                      "selection_base specializations may not have data members");
+        static_assert(std::is_trivial_v<selection_base<selection<Soa>>>,
+                      "selection_base specializations must be trivial");
+
+      public:
+        /// @brief Base SoA type for this selection.
+        using soa_type = detail::remove_cvref<Soa>;
+
+        /// @brief Cvref-qualified version of #soa_type.
+        using soa_ref = detail::coerce_ref<Soa>;
+
+        /// @brief Unsigned integer size type used by the corresponding SoA type.
+        using size_type = std::size_t;
+
+        /// @brief Signed integer difference type used by the corresponding SoA type.
+        using difference_type = std::ptrdiff_t;
+
+        /// @brief #soagen::row type used by this selection.
+        using row_type = soagen::row_type<Soa>;
+
+        /// @brief #soagen::span type over the same source container.
+        using span_type = soagen::span_type<Soa>;
+
+        /// @brief Row iterators returned by iterator functions.
+        using iterator = selection_iterator<Soa>;
+
+        /// @brief Row iterators returned by "c"-prefixed iterator functions.
+        using const_iterator = selection_iterator<std::add_const_t<Soa>>;
+
+      private:
+        /// @cond
+        using base = detail::selection_storage<detail::remove_cvref<Soa>>;
+
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_type* soa, std::vector<size_type>&& indices) noexcept //
+            : base{ soa, static_cast<std::vector<size_type>&&>(indices) }
+        {}
+
+        template <typename Indices>
+        static std::vector<size_type> copy_indices(const Indices& indices, size_type offset, size_type count)
+        {
+            std::vector<size_type> result;
+            for (auto&& idx : indices)
+            {
+                SOAGEN_ASSERT(static_cast<size_type>(idx) < count);
+                static_cast<void>(count);
+
+                result.push_back(offset + static_cast<size_type>(idx));
+            }
+            return result;
+        }
+
+        /// @endcond
+
+      public:
+        /// @brief Default constructor. Creates an empty selection not associated with any container.
+        SOAGEN_NODISCARD_CTOR
+        selection() noexcept //
+            : base{}
+        {}
+
+        /// @brief Copy constructor.
+        SOAGEN_NODISCARD_CTOR
+        selection(const selection&) = default;
+
+        /// @brief Move constructor.
+        SOAGEN_NODISCARD_CTOR
+        selection(selection&&) noexcept = default;
+
+        /// @brief Copy-assignment operator.
+        selection& operator=(const selection&) = default;
+
+        /// @brief Move-assignment operator.
+        selection& operator=(selection&&) noexcept = default;
+
+        /// @brief Constructs a selection of specific rows of a SoA container.
+        ///
+        /// @param src		The source container.
+        /// @param indices	A range of integral row indices (e.g. a `std::vector<std::size_t>`).
+        template <typename Indices>
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_ref src, const Indices& indices) //
+            : base{ const_cast<soa_type*>(&src), copy_indices(indices, 0u, static_cast<size_type>(src.size())) }
+        {}
+
+        /// @brief Constructs a selection of specific rows of a SoA container.
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_ref src, std::initializer_list<size_type> indices) //
+            : base{ const_cast<soa_type*>(&src), copy_indices(indices, 0u, static_cast<size_type>(src.size())) }
+        {}
+
+        /// @brief Constructs a selection of specific rows of a span.
+        ///
+        /// @param src		The source span.
+        /// @param indices	A range of integral row indices, relative to the start of the span.
+        template <typename Indices>
+        SOAGEN_NODISCARD_CTOR
+        selection(const span_type& src, const Indices& indices) //
+            : base{ const_cast<soa_type*>(src.source()), copy_indices(indices, src.source_offset(), src.size()) }
+        {}
+
+        /// @brief Constructs a selection of specific rows of a span.
+        SOAGEN_NODISCARD_CTOR
+        selection(const span_type& src, std::initializer_list<size_type> indices) //
+            : base{ const_cast<soa_type*>(src.source()), copy_indices(indices, src.source_offset(), src.size()) }
+        {}
+
+        /// @brief Constructs a selection from a bitmask, selecting row `i` when bit `i` is set.
+        ///
+        /// @param src		The source container.
+        /// @param words	The bitmask, stored least-significant-bit first in 64-bit words.
+        ///					Must contain at least `(src.size() + 63) / 64` words.
+        SOAGEN_NODISCARD
+        static selection from_bitmask(soa_ref src, const std::uint64_t* words)
+        {
+            if (src.empty())
+                return selection{ static_cast<soa_ref>(src), std::initializer_list<size_type>{} };
+
+            return from_bitmask(span_type{ static_cast<soa_ref>(src) }, words);
+        }
+
+        /// @brief Constructs a selection from a bitmask, selecting row `i` of a span when bit `i` is set.
+        ///
+        /// @param src		The source span.
+        /// @param words	The bitmask, stored least-significant-bit first in 64-bit words.
+        ///					Must contain at least `(src.size() + 63) / 64` words.
+        SOAGEN_NODISCARD
+        static selection from_bitmask(const span_type& src, const std::uint64_t* words)
+        {
+            SOAGEN_ASSUME(words != nullptr || src.empty());
+
+            std::vector<size_type> indices;
+            const size_type count  = src.size();
+            const size_type offset = src.source_offset();
+            for (size_type w = 0; w * 64u < count; w++)
+            {
+                auto word = words[w];
+                if (const auto bits = count - w * 64u; bits < 64u)
+                    word &= (std::uint64_t{ 1 } << bits) - 1u;
+                for (; word; word &= word - 1u)
+                    indices.push_back(offset + w * 64u + static_cast<size_type>(countr_zero(word)));
+            }
+            return selection{ const_cast<soa_type*>(src.source()), static_cast<std::vector<size_type>&&>(indices) };
+        }
+
+        /// @name Size
+        /// @{
+
+        /// @brief Returns the number of rows viewed by the selection.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return base::indices.size();
+        }
+
+        /// @brief Returns true if the number of rows viewed by the selection is zero.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return base::indices.empty();
+        }
+
+        /// @}
+
+        /// @name Row indices
+        /// @{
+
+        /// @brief Returns a pointer to the selected row indices (as they relate to the source container).
+        SOAGEN_PURE_INLINE_GETTER
+        const size_type* indices() const noexcept
+        {
+            return base::indices.data();
+        }
+
+        /// @brief Returns the index of the selected row in the source container.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type source_index(size_type index) const noexcept
+        {
+            SOAGEN_ASSUME(index < base::indices.size());
+
+            return base::indices[index];
+        }
+
+        /// @brief The source container for this selection.
+        /// @attention Returns `nullptr` for default-constructed selections.
+        SOAGEN_PURE_INLINE_GETTER
+        std::remove_reference_t<soa_ref>* source() const noexcept
+        {
+            return base::soa;
+        }
+
+        /// @}
+
+        /// @name Rows
+        /// @{
+
+        /// @brief Returns the row at the given index.
+        ///
+        /// @tparam Cols Indices of the columns to include in the row. Leave the list empty for all columns.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> row(size_type index) const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+
+            return static_cast<soa_ref>(*base::soa).template row<static_cast<size_type>(Cols)...>(source_index(index));
+        }
+
+        /// @brief Returns the row at the given index.
+        SOAGEN_PURE_INLINE_GETTER
+        row_type operator[](size_type index) const noexcept
+        {
+            return row(index);
+        }
+
+#if SOAGEN_HAS_EXCEPTIONS || SOAGEN_DOXYGEN
+
+        /// @brief Returns the row at the given index.
+        ///
+        /// @tparam Cols Indices of the columns to include in the row. Leave the list empty for all columns.
+        ///
+        /// @throws std::out_of_range
+        ///
+        /// @availability This function is not available when exceptions are disabled.
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        soagen::row_type<Soa, Cols...> at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range{ "bad element access" };
+            return row<Cols...>(index);
+        }
+
+#endif
+
+        /// @brief Returns the first row viewed by the selection.
+        ///
+        /// @tparam Cols Indices of the columns to include in the row. Leave the list empty for all columns.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> front() const noexcept
+        {
+            return row<Cols...>(0u);
+        }
+
+        /// @brief Returns the last row viewed by the selection.
+        ///
+        /// @tparam Cols Indices of the columns to include in the row. Leave the list empty for all columns.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> back() const noexcept
+        {
+            return row<Cols...>(size() - 1u);
+        }
+
+        /// @}
+
+        /// @name Iterators
+        /// @{
+
+        /// @brief Returns an iterator to the first row viewed by the selection.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<Soa, static_cast<size_type>(Cols)...> begin() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<soa_ref>(*base::soa), base::indices.data() };
+        }
+
+        /// @brief Returns an iterator to one-past-the-last row viewed by the selection.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<Soa, static_cast<size_type>(Cols)...> end() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<soa_ref>(*base::soa), base::indices.data() + base::indices.size() };
+        }
+
+        /// @brief Returns a const iterator to the first row viewed by the selection.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<std::add_const_t<Soa>, static_cast<size_type>(Cols)...> cbegin() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<const soa_type&>(*base::soa), base::indices.data() };
+        }
+
+        /// @brief Returns a const iterator to one-past-the-last row viewed by the selection.
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<std::add_const_t<Soa>, static_cast<size_type>(Cols)...> cend() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<const soa_type&>(*base::soa), base::indices.data() + base::indices.size() };
+        }
+
+        /// @}
+
+        /// @name Columns
+        /// @{
+
+        /// @brief Gathers the selected elements of a column into a contiguous output buffer.
+        ///
+        /// @param out	An output iterator (e.g. a pointer to a scratch buffer of at least #size() elements).
+        ///
+        /// @returns	The output iterator advanced past the last element written.
+        template <auto Column, typename OutputIt>
+        OutputIt gather(OutputIt out) const
+        {
+            if (empty())
+                return out;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            for (const auto idx : base::indices)
+            {
+                *out = src[idx];
+                ++out;
+            }
+            return out;
+        }
+
+        /// @brief Gathers the selected elements of a column, prefetching the source elements some rows ahead.
+        ///
+        /// @details	Gathers jump around the source column, so the hardware prefetcher can't help;
+        ///				with a large table this is usually much faster than the plain #gather() for distances
+        ///				of around 8-32.
+        ///
+        /// @param out		An output iterator (e.g. a pointer to a scratch buffer of at least #size() elements).
+        /// @param distance	How many selected rows ahead to prefetch. Zero disables prefetching.
+        ///
+        /// @returns	The output iterator advanced past the last element written.
+        template <auto Column, typename OutputIt>
+        OutputIt gather(OutputIt out, size_type distance) const
+        {
+            if (empty())
+                return out;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            const auto idx = base::indices.data();
+            const auto num = base::indices.size();
+
+            size_type i = 0;
+            if (distance && distance < num)
+            {
+                for (; i < num - distance; i++)
+                {
+                    SOAGEN_PREFETCH(src + idx[i + distance]);
+                    *out = src[idx[i]];
+                    ++out;
+                }
+            }
+            for (; i < num; i++)
+            {
+                *out = src[idx[i]];
+                ++out;
+            }
+            return out;
+        }
+
+        /// @brief Reduces the selected elements of a column to a single value.
+        ///
+        /// @param init	The initial value of the accumulator.
+        /// @param op	A binary callable invoked as `acc = op(acc, value)` for each selected element, in order.
+        template <auto Column, typename T, typename BinaryOp>
+        SOAGEN_NODISCARD
+        T reduce(T init, BinaryOp&& op) const
+        {
+            if (empty())
+                return init;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            for (const auto idx : base::indices)
+                init = op(static_cast<T&&>(init), src[idx]);
+            return init;
+        }
+
+        /// @}
+
+        /// @name Filtering
+        /// @{
+
+        /// @brief Returns a new selection containing only those rows of this one for which a predicate returns true.
+        ///
+        /// @param pred A callable invoked with each selected #row_type.
+        template <typename Predicate>
+        SOAGEN_NODISCARD
+        selection filter(Predicate&& pred) const
+        {
+            std::vector<size_type> indices;
+            for (const auto idx : base::indices)
+                if (pred(static_cast<soa_ref>(*base::soa).row(idx)))
+                    indices.push_back(idx);
+            return selection{ base::soa, static_cast<std::vector<size_type>&&>(indices) };
+        }
+
+        /// @brief Returns a new selection containing only those rows of this one for which a predicate returns true.
+        ///
+        /// @param pred A callable invoked with each selected element of the given column.
+        template <auto Column, typename Predicate>
+        SOAGEN_NODISCARD
+        selection filter(Predicate&& pred) const
+        {
+            std::vector<size_type> indices;
+            if (!empty())
+            {
+                const auto src =
+                    static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+                for (const auto idx : base::indices)
+                    if (pred(src[idx]))
+                        indices.push_back(idx);
+            }
+            return selection{ base::soa, static_cast<std::vector<size_type>&&>(indices) };
+        }
+
+        /// @}
+    };
+
+    /// @cond
+    namespace detail
+    {
+        template <typename Soa, typename Predicate>
+        SOAGEN_NODISCARD
+        selection<Soa> select_rows(const span_type<Soa>& src, Predicate&& pred)
+        {
+            std::vector<size_t> indices;
+            for (size_t i = 0; i < src.size(); i++)
+                if (pred(src.row(i)))
+                    indices.push_back(i);
+            return selection<Soa>{ src, indices };
+        }
+
+        template <typename Soa, size_t Column, typename Predicate>
+        SOAGEN_NODISCARD
+        selection<Soa> select_rows(const span_type<Soa>& src, Predicate&& pred)
+        {
+            std::vector<size_t> indices;
+            if (!src.empty())
+            {
+                const auto col = src.template column<Column>();
+                for (size_t i = 0; i < src.size(); i++)
+                    if (pred(col[i]))
+                        indices.push_back(i);
+            }
+            return selection<Soa>{ src, indices };
+        }
+    }
+    /// @endcond
+
+    /// @brief Creates a #soagen::selection of the rows of a SoA container (or span) for which a predicate returns true.
+    ///
+    /// @param src	A table, span or soagen-generated SoA type.
+    /// @param pred	A callable invoked with each #soagen::row.
+    SOAGEN_CONSTRAINED_TEMPLATE((is_soa<detail::remove_cvref<T>> || is_span<detail::remove_cvref<T>>),
+                                typename T,
+                                typename Predicate)
+    SOAGEN_NODISCARD
+    auto select(T& src, Predicate&& pred)
+    {
+        if constexpr (is_span<detail::remove_cvref<T>>)
+        {
+            using soa = std::remove_reference_t<detail::soa_type_cvref<detail::remove_cvref<T>>>;
+            return detail::select_rows<soa>(src, static_cast<Predicate&&>(pred));
+        }
+        else if (src.empty())
+            return selection<T>{ src, std::initializer_list<size_t>{} };
+        else
+            return detail::select_rows<T>(span_type<T>{ src }, static_cast<Predicate&&>(pred));
+    }
+
+    /// @brief Creates a #soagen::selection of the rows of a SoA container (or span) for which a predicate
+    ///        returns true for the value of a particular column.
+    ///
+    /// @param src	A table, span or soagen-generated SoA type.
+    /// @param pred	A callable invoked with each element of the given column.
+    template <auto Column, typename T, typename Predicate>
+    SOAGEN_NODISCARD
+    auto select(T& src, Predicate&& pred)
+    {
+        static_assert(is_soa<detail::remove_cvref<T>> || is_span<detail::remove_cvref<T>>,
+                      "src must be a table, span or soagen-generated SoA type.");
+
+        if constexpr (is_span<detail::remove_cvref<T>>)
+        {
+            using soa = std::remove_reference_t<detail::soa_type_cvref<detail::remove_cvref<T>>>;
+            return detail::select_rows<soa, static_cast<size_t>(Column)>(src, static_cast<Predicate&&>(pred));
+        }
+        else if (src.empty())
+            return selection<T>{ src, std::initializer_list<size_t>{} };
+        else
+            return detail::select_rows<T, static_cast<size_t>(Column)>(span_type<T>{ src },
+                                                                       static_cast<Predicate&&>(pred));
+    }
+}
+
+#include "header_end.hpp"
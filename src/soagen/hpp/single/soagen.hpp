@@ -2206,6 +2206,14 @@ SOAGEN_ENABLE_WARNINGS;
     #endif
 #endif
 
+#ifndef SOAGEN_PREFETCH
+    #if SOAGEN_GCC_LIKE || SOAGEN_CLANG || SOAGEN_HAS_BUILTIN(__builtin_prefetch)
+        #define SOAGEN_PREFETCH(ptr) __builtin_prefetch(static_cast<const void*>(ptr))
+    #else
+        #define SOAGEN_PREFETCH(ptr) static_cast<void>(ptr)
+    #endif
+#endif
+
 #ifndef SOAGEN_MAKE_STRING
     #define SOAGEN_MAKE_STRING_2(s) #s
     #define SOAGEN_MAKE_STRING_1(s) SOAGEN_MAKE_STRING_2(s)
@@ -2483,6 +2491,8 @@ namespace soagen
     class span;
     template <typename...>
     struct table_traits;
+    template <typename...>
+    struct reordered_table_traits;
     template <typename, typename>
     class table;
 
@@ -2713,6 +2723,22 @@ namespace soagen::detail
     template <typename T>
     using has_nothrow_data_member = conjunction<has_data_member<T>, has_nothrow_data_member_<T>>;
 
+    // ---- contiguous ranges (data() + size())
+
+    template <typename T>
+    using has_size_member_ = decltype(std::declval<T&>().size());
+
+    template <typename T,
+              typename Value,
+              bool = conjunction<has_data_member<T>, is_detected<has_size_member_, T>>::value>
+    struct is_contiguous_range_of : std::false_type
+    {};
+    template <typename T, typename Value>
+    struct is_contiguous_range_of<T, Value, true>
+        : conjunction<std::is_pointer<decltype(std::declval<T&>().data())>,
+                      std::is_same<remove_cvref<decltype(*std::declval<T&>().data())>, Value>>
+    {};
+
     // ---- has emplace()
 
     template <typename T, typename Pos, typename... Args>
@@ -2829,6 +2855,7 @@ SOAGEN_POP_WARNINGS;
 //********  functions.hpp  *********************************************************************************************
 
 SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 #include <memory>
@@ -2989,6 +3016,43 @@ namespace soagen
         }
     }
 
+    SOAGEN_CONST_INLINE_GETTER
+    constexpr int popcount(std::uint64_t val) noexcept
+    {
+#if SOAGEN_CLANG || SOAGEN_GCC || SOAGEN_HAS_BUILTIN(__builtin_popcountll)
+
+        return __builtin_popcountll(val);
+
+#else
+
+        int count = 0;
+        for (; val; val &= val - 1u)
+            count++;
+        return count;
+
+#endif
+    }
+
+    SOAGEN_CONST_INLINE_GETTER
+    constexpr int countr_zero(std::uint64_t val) noexcept
+    {
+        if (!val)
+            return 64;
+
+#if SOAGEN_CLANG || SOAGEN_GCC || SOAGEN_HAS_BUILTIN(__builtin_ctzll)
+
+        return __builtin_ctzll(val);
+
+#else
+
+        int count = 0;
+        for (; !(val & 1u); val >>= 1)
+            count++;
+        return count;
+
+#endif
+    }
+
     template <size_t N, typename T>
     SOAGEN_CONST_INLINE_GETTER
     SOAGEN_GNU_ATTR(assume_aligned(N))
@@ -3249,6 +3313,11 @@ namespace soagen
         {
             using type = table_traits<Args...>;
         };
+        template <typename... Args>
+        struct table_traits_type_<reordered_table_traits<Args...>>
+        {
+            using type = reordered_table_traits<Args...>;
+        };
         template <typename Traits, typename Allocator>
         struct table_traits_type_<table<Traits, Allocator>>
         {
@@ -3563,6 +3632,42 @@ namespace soagen
     inline constexpr size_t buffer_alignment =
         max(allocator_traits<allocator_type<T>>::min_alignment, table_traits_type<T>::largest_alignment);
 
+    namespace detail
+    {
+        SOAGEN_CONST_GETTER
+        constexpr std::uint64_t fnv1a_append(std::uint64_t hash, std::uint64_t value) noexcept
+        {
+            for (size_t i = 0; i < 8u; i++)
+            {
+                hash ^= (value >> (i * 8u)) & 0xFFu;
+                hash *= 0x00000100000001B3ull;
+            }
+            return hash;
+        }
+
+        template <typename Traits>
+        SOAGEN_CONST_GETTER
+        constexpr std::uint64_t table_layout_hash() noexcept
+        {
+            std::uint64_t hash = fnv1a_append(0xCBF29CE484222325ull, Traits::column_count);
+            for (size_t i = 0; i < Traits::column_count; i++)
+            {
+                hash = fnv1a_append(hash, Traits::column_sizes[i]);
+                hash = fnv1a_append(hash, Traits::column_alignments[i]);
+            }
+            return hash;
+        }
+
+        template <typename T>
+        struct schema_hash_ // specialized in the generated code
+            : std::integral_constant<std::uint64_t, table_layout_hash<table_traits_type<T>>()>
+        {};
+    }
+
+    template <typename T>
+    inline constexpr std::uint64_t schema_hash =
+        detail::schema_hash_<soa_type<T>>::value;
+
     namespace detail
     {
         template <typename A, typename B, typename = void>
@@ -3842,6 +3947,19 @@ namespace soagen::detail
     template <typename Allocator>
     inline constexpr size_t alloc_min_alignment<Allocator, false> = alignof(typename Allocator::value_type);
 
+    // does the allocator want large columns to start on a particular boundary?
+
+    template <typename Allocator>
+    using has_column_alignment_ = decltype(Allocator::column_alignment);
+
+    template <typename Allocator>
+    inline constexpr bool has_column_alignment = is_detected<has_column_alignment_, Allocator>::value;
+
+    template <typename Allocator, bool = has_column_alignment<Allocator>>
+    inline constexpr size_t alloc_column_alignment = Allocator::column_alignment;
+    template <typename Allocator>
+    inline constexpr size_t alloc_column_alignment<Allocator, false> = 0;
+
     //--- base traits --------------------------------------------------------------------------------------------------
 
     template <typename Allocator>
@@ -3858,6 +3976,10 @@ namespace soagen::detail
         static constexpr size_t min_alignment = detail::alloc_min_alignment<Allocator>;
         static_assert(has_single_bit(min_alignment), "allocator min_alignment must be a power of two");
 
+        static constexpr size_t column_alignment = detail::alloc_column_alignment<Allocator>;
+        static_assert(!column_alignment || has_single_bit(column_alignment),
+                      "allocator column_alignment must be a power of two");
+
         SOAGEN_PURE_INLINE_GETTER
         static constexpr bool equal([[maybe_unused]] const Allocator& a, [[maybe_unused]] const Allocator& b) noexcept
         {
@@ -4271,6 +4393,176 @@ namespace soagen
 #endif
 SOAGEN_POP_WARNINGS;
 
+//********  nontemporal.hpp  *******************************************************************************************
+
+#ifndef SOAGEN_NONTEMPORAL_THRESHOLD
+    #define SOAGEN_NONTEMPORAL_THRESHOLD (2u * 1024u * 1024u)
+#endif
+
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#include <cstring>
+#if SOAGEN_ISET_SSE2
+    #include <emmintrin.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen::detail
+{
+    inline constexpr size_t nontemporal_threshold = SOAGEN_NONTEMPORAL_THRESHOLD;
+
+    inline constexpr bool has_nontemporal_stores = !!SOAGEN_ISET_SSE2 && nontemporal_threshold > 0u;
+
+    // memcpy() for big, non-overlapping blocks that won't be read again soon
+    SOAGEN_GNU_ATTR(nonnull)
+    inline void nontemporal_copy(void* dest, const void* src, size_t bytes) noexcept
+    {
+#if SOAGEN_ISET_SSE2
+        auto d = static_cast<std::byte*>(dest);
+        auto s = static_cast<const std::byte*>(src);
+
+        // streaming stores need an aligned destination
+        const auto head = min(bytes, static_cast<size_t>((16u - reinterpret_cast<std::uintptr_t>(d) % 16u) % 16u));
+        std::memcpy(d, s, head);
+        d += head;
+        s += head;
+        bytes -= head;
+
+        for (; bytes >= 64u; d += 64u, s += 64u, bytes -= 64u)
+        {
+            const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+            const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 16u));
+            const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 32u));
+            const auto e = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 48u));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16u), b);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32u), c);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48u), e);
+        }
+        _mm_sfence();
+
+        std::memcpy(d, s, bytes);
+#else
+        std::memcpy(dest, src, bytes);
+#endif
+    }
+
+    // the block a nontemporal_fill() of Size-byte elements repeats (a whole number of elements and of 16-byte stores)
+    template <size_t Size>
+    inline constexpr size_t nontemporal_fill_period = lcm(Size, size_t{ 16 });
+
+    template <size_t Size>
+    inline constexpr bool can_nontemporal_fill = has_nontemporal_stores && nontemporal_fill_period<Size> <= 256u;
+
+    // writes count copies of a Size-byte value to dest, bypassing the cache
+    template <size_t Size>
+    SOAGEN_GNU_ATTR(nonnull)
+    inline void nontemporal_fill(void* dest, const void* value, size_t count) noexcept
+    {
+        static_assert(nontemporal_fill_period<Size> <= 256u);
+
+#if SOAGEN_ISET_SSE2
+        constexpr size_t period = nontemporal_fill_period<Size>;
+
+        auto d       = static_cast<std::byte*>(dest);
+        auto pattern = static_cast<const std::byte*>(value);
+        size_t bytes = Size * count;
+
+        // bytes before the first aligned store; the block then starts this far into an element
+        const auto head = min(bytes, static_cast<size_t>((16u - reinterpret_cast<std::uintptr_t>(d) % 16u) % 16u));
+        for (size_t i = 0; i < head; i++)
+            d[i] = pattern[i % Size];
+        d += head;
+        bytes -= head;
+
+        alignas(16) std::byte block[period];
+        for (size_t i = 0; i < period; i++)
+            block[i] = pattern[(head + i) % Size];
+
+        for (; bytes >= period; d += period, bytes -= period)
+            for (size_t i = 0; i < period; i += 16u)
+                _mm_stream_si128(reinterpret_cast<__m128i*>(d + i),
+                                 _mm_load_si128(reinterpret_cast<const __m128i*>(block + i)));
+        _mm_sfence();
+
+        std::memcpy(d, block, bytes);
+#else
+        auto d = static_cast<std::byte*>(dest);
+        for (size_t i = 0; i < count; i++)
+            std::memcpy(d + i * Size, value, Size);
+#endif
+    }
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
 //********  column_traits.hpp  *****************************************************************************************
 
 SOAGEN_DISABLE_WARNINGS;
@@ -4431,6 +4723,22 @@ namespace soagen::detail
             SOAGEN_ASSUME(buffer != nullptr);
             SOAGEN_ASSUME(count);
 
+            // trivially-copyable types with a non-trivial constructor (e.g. default member initializers) all end up
+            // with the same bytes, so big runs of them can be stamped out from one without polluting the cache
+            if constexpr (std::is_trivially_copyable_v<storage_type>
+                          && !std::is_trivially_default_constructible_v<storage_type>
+                          && std::is_nothrow_default_constructible_v<storage_type>
+                          && can_nontemporal_fill<sizeof(storage_type)>)
+            {
+                if (count * sizeof(storage_type) >= nontemporal_threshold)
+                {
+                    const auto first = buffer + index * sizeof(storage_type);
+                    default_construct(first);
+                    nontemporal_fill<sizeof(storage_type)>(first + sizeof(storage_type), first, count - 1u);
+                    return;
+                }
+            }
+
 #if defined(__cpp_lib_start_lifetime_as) && __cpp_lib_start_lifetime_as >= 202207
             if constexpr (is_implicit_lifetime_type<storage_type>::value)
             {
@@ -4490,6 +4798,84 @@ namespace soagen::detail
             }
         }
 
+        //--- value construction ---------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        static constexpr storage_type& value_construct(std::byte* destination) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(destination != nullptr);
+
+            return *(::new (static_cast<void*>(destination)) storage_type());
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct(std::byte* buffer, size_t index, size_t count) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (std::is_trivially_copyable_v<storage_type>
+                          && std::is_nothrow_default_constructible_v<storage_type>)
+            {
+                // every element ends up with the same bytes, so construct one and stamp out the rest
+                const auto first = buffer + index * sizeof(storage_type);
+                value_construct(first);
+                broadcast(first + sizeof(storage_type), first, count - 1u);
+            }
+            else if constexpr (std::is_nothrow_default_constructible_v<storage_type>
+                               || std::is_trivially_destructible_v<storage_type>)
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    value_construct(buffer + index * sizeof(storage_type));
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                size_t i = index;
+
+                SOAGEN_TRY
+                {
+                    for (const size_t e = index + count; i < e; i++)
+                        value_construct(buffer + i * sizeof(storage_type));
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    for (; i-- > index;)
+                        destruct(buffer, i);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        // leaves trivially-default-constructible elements uninitialized (to be written directly, e.g. by read()) and
+        // value-initializes everything else
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = std::is_default_constructible_v<storage_type>)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct_for_overwrite(std::byte* buffer, size_t index, size_t count) //
+            noexcept(std::is_nothrow_default_constructible_v<storage_type>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (std::is_trivially_default_constructible_v<storage_type>)
+            {
+                default_construct_for_overwrite(buffer, index, count);
+            }
+            else
+            {
+                value_construct(buffer, index, count);
+            }
+        }
+
         //--- construction ---------------------------------------------------------------------------------------------
 
         static constexpr bool is_trivially_copyable = std::is_trivially_copyable_v<storage_type>;
@@ -5258,32 +5644,165 @@ namespace soagen::detail
                          count * sizeof(storage_type));
         }
 
-        //--- equality -------------------------------------------------------------------------------------------------
+        //--- memcpy ---------------------------------------------------------------------------------
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_equality_comparable<storage_type>::value)
-        SOAGEN_NODISCARD
-        SOAGEN_GNU_ATTR(nonnull)
-        static constexpr bool equal(const std::byte* lhs, const std::byte* rhs) //
-            noexcept(is_nothrow_equality_comparable<storage_type>::value)
+        // like memmove() but the ranges mustn't overlap; big copies bypass the cache (see nontemporal_copy())
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_trivially_copyable)
+        static void memcpy(std::byte* dest_buffer,
+                           size_t dest_index,
+                           const std::byte* source_buffer,
+                           size_t source_index,
+                           size_t count = 1) noexcept
         {
-            SOAGEN_ASSUME(lhs != nullptr);
-            SOAGEN_ASSUME(rhs != nullptr);
+            SOAGEN_ASSUME(dest_buffer != nullptr);
+            SOAGEN_ASSUME(source_buffer != nullptr);
 
-            return get(lhs) == get(rhs);
+            const auto dest   = soagen_aligned_storage(dest_buffer + dest_index * sizeof(storage_type));
+            const auto source = soagen_aligned_storage(source_buffer + source_index * sizeof(storage_type));
+            const auto bytes  = count * sizeof(storage_type);
+            if constexpr (has_nontemporal_stores)
+            {
+                if (bytes >= nontemporal_threshold)
+                {
+                    nontemporal_copy(dest, source, bytes);
+                    return;
+                }
+            }
+            std::memcpy(dest, source, bytes);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_equality_comparable<storage_type>::value)
-        SOAGEN_NODISCARD
+        //--- fill -----------------------------------------------------------------------------------------------------
+
+        // writes count copies of a trivially-copyable value: one memset() when its bytes are all the same (e.g. zero),
+        // otherwise fixed-size copies of a block of them (which compile to unrolled vector stores even at -O2, unlike
+        // a plain loop of element assignments)
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_trivially_copyable)
         SOAGEN_GNU_ATTR(nonnull)
-        static constexpr bool equal(const std::byte* lhs_buffer,
-                                    size_t lhs_index,
-                                    const std::byte* rhs_buffer,
-                                    size_t rhs_index,
-                                    size_t count = 1) //
-            noexcept(is_nothrow_equality_comparable<storage_type>::value)
+        static void broadcast(std::byte* destination, const std::byte* value, size_t count) noexcept
         {
-            SOAGEN_ASSUME(lhs_buffer != nullptr);
-            SOAGEN_ASSUME(rhs_buffer != nullptr);
+            SOAGEN_ASSUME(destination != nullptr);
+            SOAGEN_ASSUME(value != nullptr);
+
+            bool uniform = true;
+            for (size_t i = 1; i < sizeof(storage_type); i++)
+                uniform = uniform && value[i] == value[0];
+            if (uniform)
+            {
+                std::memset(destination, static_cast<int>(value[0]), count * sizeof(storage_type));
+                return;
+            }
+
+            constexpr size_t block_count = max(size_t{ 256 } / sizeof(storage_type), size_t{ 1 });
+            alignas(max(alignof(storage_type), size_t{ 16 })) std::byte block[block_count * sizeof(storage_type)];
+            for (size_t i = 0; i < block_count; i++)
+                std::memcpy(block + i * sizeof(storage_type), value, sizeof(storage_type));
+
+            for (; count >= block_count; destination += sizeof(block), count -= block_count)
+                std::memcpy(destination, block, sizeof(block));
+            std::memcpy(destination, block, count * sizeof(storage_type));
+        }
+
+        template <typename Arg>
+        static constexpr bool is_fillable_from =
+            is_trivially_copyable ? is_constructible<Arg> : std::is_assignable_v<storage_type&, Arg>;
+
+        template <typename Arg>
+        static constexpr bool is_nothrow_fillable_from =
+            is_trivially_copyable ? is_nothrow_constructible<Arg> : std::is_nothrow_assignable_v<storage_type&, Arg>;
+
+        // assigns value to count existing elements
+        SOAGEN_CONSTRAINED_TEMPLATE(is_fillable_from<const Arg&>, typename Arg)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void fill(std::byte* buffer, size_t index, size_t count, const Arg& value) //
+            noexcept(is_nothrow_fillable_from<const Arg&>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+
+            if constexpr (is_trivially_copyable)
+            {
+                // converted up-front since value may be one of the elements being overwritten
+                alignas(storage_type) std::byte converted[sizeof(storage_type)] = {};
+                construct(converted, value);
+                broadcast(buffer + index * sizeof(storage_type), converted, count);
+            }
+            else
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    get(buffer + index * sizeof(storage_type)) = value;
+            }
+        }
+
+        // constructs count elements from value
+        SOAGEN_CONSTRAINED_TEMPLATE(is_constructible<const Arg&>, typename Arg)
+        SOAGEN_GNU_ATTR(nonnull)
+        SOAGEN_CONSTEXPR_20
+        static void fill_construct(std::byte* buffer, size_t index, size_t count, const Arg& value) //
+            noexcept(is_nothrow_constructible<const Arg&>)
+        {
+            SOAGEN_ASSUME(buffer != nullptr);
+            SOAGEN_ASSUME(count);
+
+            if constexpr (is_trivially_copyable)
+            {
+                // every element ends up with the same bytes, so construct one and stamp out the rest
+                const auto first = buffer + index * sizeof(storage_type);
+                construct(first, value);
+                broadcast(first + sizeof(storage_type), first, count - 1u);
+            }
+            else if constexpr (is_nothrow_constructible<const Arg&> || std::is_trivially_destructible_v<storage_type>)
+            {
+                for (const size_t e = index + count; index < e; index++)
+                    construct_at(buffer, index, value);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                size_t i = index;
+
+                SOAGEN_TRY
+                {
+                    for (const size_t e = index + count; i < e; i++)
+                        construct_at(buffer, i, value);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    for (; i-- > index;)
+                        destruct(buffer, i);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        //--- equality -------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_equality_comparable<storage_type>::value)
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(nonnull)
+        static constexpr bool equal(const std::byte* lhs, const std::byte* rhs) //
+            noexcept(is_nothrow_equality_comparable<storage_type>::value)
+        {
+            SOAGEN_ASSUME(lhs != nullptr);
+            SOAGEN_ASSUME(rhs != nullptr);
+
+            return get(lhs) == get(rhs);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = is_equality_comparable<storage_type>::value)
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(nonnull)
+        static constexpr bool equal(const std::byte* lhs_buffer,
+                                    size_t lhs_index,
+                                    const std::byte* rhs_buffer,
+                                    size_t rhs_index,
+                                    size_t count = 1) //
+            noexcept(is_nothrow_equality_comparable<storage_type>::value)
+        {
+            SOAGEN_ASSUME(lhs_buffer != nullptr);
+            SOAGEN_ASSUME(rhs_buffer != nullptr);
 
             lhs_buffer += lhs_index * sizeof(storage_type);
             rhs_buffer += rhs_index * sizeof(storage_type);
@@ -5691,357 +6210,873 @@ namespace std
     };
 }
 
-//********  names.hpp  *************************************************************************************************
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-#ifndef SOAGEN_MAKE_NAME
-    #define SOAGEN_MAKE_NAME(Name)                                                                                     \
-                                                                                                                       \
-        struct name_tag_##Name;                                                                                        \
-                                                                                                                       \
-        template <>                                                                                                    \
-        struct SOAGEN_EMPTY_BASES name_constant<name_tag_##Name>                                                       \
-        {                                                                                                              \
-            static constexpr const char value[] = #Name;                                                               \
-        };                                                                                                             \
-                                                                                                                       \
-        template <typename T>                                                                                          \
-        struct SOAGEN_EMPTY_BASES named_ref<name_tag_##Name, T>                                                        \
-        {                                                                                                              \
-            static_assert(std::is_reference_v<T>);                                                                     \
-                                                                                                                       \
-            T Name;                                                                                                    \
-                                                                                                                       \
-          protected:                                                                                                   \
-            SOAGEN_PURE_INLINE_GETTER                                                                                  \
-            constexpr T get_ref() const noexcept                                                                       \
-            {                                                                                                          \
-                return static_cast<T>(Name);                                                                           \
-            }                                                                                                          \
-        };                                                                                                             \
-                                                                                                                       \
-        template <typename Derived, size_t Column>                                                                     \
-        struct SOAGEN_EMPTY_BASES named_func<name_tag_##Name, Derived, Column>                                         \
-        {                                                                                                              \
-            SOAGEN_PURE_INLINE_GETTER                                                                                  \
-            constexpr decltype(auto) Name() noexcept                                                                   \
-            {                                                                                                          \
-                using return_type = decltype(static_cast<Derived&>(*this).template column<Column>());                  \
-                if constexpr (std::is_reference_v<return_type>)                                                        \
-                    return static_cast<return_type>(static_cast<Derived&>(*this).template column<Column>());           \
-                else                                                                                                   \
-                    return static_cast<Derived&>(*this).template column<Column>();                                     \
-            }                                                                                                          \
-                                                                                                                       \
-            SOAGEN_PURE_INLINE_GETTER                                                                                  \
-            constexpr decltype(auto) Name() const noexcept                                                             \
-            {                                                                                                          \
-                using return_type = decltype(static_cast<const Derived&>(*this).template column<Column>());            \
-                if constexpr (std::is_reference_v<return_type>)                                                        \
-                    return static_cast<return_type>(static_cast<const Derived&>(*this).template column<Column>());     \
-                else                                                                                                   \
-                    return static_cast<const Derived&>(*this).template column<Column>();                               \
-            }                                                                                                          \
-        }
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
 #endif
+SOAGEN_POP_WARNINGS;
 
-#ifndef SOAGEN_MAKE_NAMED_COLUMN
-    #define SOAGEN_MAKE_NAMED_COLUMN(Soa, Column, Name)                                                                \
-                                                                                                                       \
-        template <>                                                                                                    \
-        struct SOAGEN_EMPTY_BASES column_name_tag_<Soa, Column>                                                        \
-        {                                                                                                              \
-            using type = name_tag_##Name;                                                                              \
-        }
+//********  instrument.hpp  ********************************************************************************************
+
+#ifndef SOAGEN_INSTRUMENT
+    #define SOAGEN_INSTRUMENT 0
 #endif
 
-#ifndef SOAGEN_MAKE_GENERIC_NAMED_COLUMN
-    #define SOAGEN_MAKE_GENERIC_NAMED_COLUMN(Column, Name)                                                             \
-                                                                                                                       \
-        SOAGEN_MAKE_NAME(Name);                                                                                        \
-                                                                                                                       \
-        template <typename Soa>                                                                                        \
-        struct SOAGEN_EMPTY_BASES column_name_tag_<Soa, Column>                                                        \
-        {                                                                                                              \
-            using type = name_tag_##Name;                                                                              \
-        }
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#include <string_view>
+#if SOAGEN_INSTRUMENT
+    #include <atomic>
+    #include <chrono>
+    #include <mutex>
+    #include <string>
+    #include <vector>
 #endif
+SOAGEN_ENABLE_WARNINGS;
 
-namespace soagen::detail
-{
-    //--- name constants ---------
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-    template <typename Tag>
-    struct name_constant;
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-    template <>
-    struct name_constant<void>
+namespace soagen
+{
+    enum class table_event : unsigned char
     {
-        static constexpr const char value[] = "";
+        allocate,
+        reallocate,
+        shrink,
+        deallocate,
+        erase_shift,
     };
 
-    //--- named ref type ---------
+    struct table_event_info
+    {
+        table_event event;
 
-    template <typename Tag, typename>
-    struct named_ref;
+        std::string_view type_name;
 
-    template <typename T>
-    struct SOAGEN_EMPTY_BASES named_ref<void, T> // unnamed columns
-    {
-        static_assert(std::is_reference_v<T>);
+        std::uint64_t layout_hash;
 
-      protected:
-        T val_;
+        const void* table;
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr T get_ref() const noexcept
-        {
-            return static_cast<T>(val_);
-        }
+        std::size_t old_capacity;
 
-      public:
-        template <typename Val>
-        SOAGEN_NODISCARD_CTOR
-        constexpr named_ref(Val&& val) noexcept //
-            : val_{ static_cast<Val&&>(val) }
-        {
-        }
+        std::size_t new_capacity;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(named_ref);
-    };
+        std::size_t old_bytes;
 
-    //--- named func type ---------
+        std::size_t new_bytes;
 
-    template <typename Tag, typename Derived, size_t>
-    struct named_func;
+        std::size_t rows;
 
-    template <typename Derived, size_t Column>
-    struct SOAGEN_EMPTY_BASES named_func<void, Derived, Column>
-    {
-        // unnamed columns do not contribute any functions
+        std::uint64_t nanoseconds;
     };
 
-    //--- column names ---------
+    using table_hook = void (*)(const table_event_info&) noexcept;
 
-    template <typename Soa, size_t Column>
-    struct column_name_tag_
+    namespace detail
     {
-        using type = void; // unnamed columns
-    };
-    template <typename Soa, auto Column>
-    using column_name_tag = typename column_name_tag_<soa_type<Soa>, static_cast<size_t>(Column)>::type;
+        template <typename T>
+        SOAGEN_CONST_GETTER
+        constexpr std::string_view type_name() noexcept
+        {
+#if SOAGEN_GCC || SOAGEN_CLANG
+            // "... type_name() [with T = X; ...]" (gcc) or "... type_name() [T = X]" (clang)
+            constexpr std::string_view sig = __PRETTY_FUNCTION__;
+            constexpr auto start           = sig.find("T = ") + 4u;
+            constexpr auto end             = min(sig.find(';', start), sig.rfind(']'));
+#else
+            // "... type_name<X>(void) noexcept"
+            constexpr std::string_view sig = __FUNCSIG__;
+            constexpr auto start           = sig.find("type_name<") + 10u;
+            constexpr auto end             = sig.rfind(">(void)");
+#endif
+            return sig.substr(start, end - start);
+        }
 
-    template <typename Soa, auto Column>
-    using column_name = name_constant<column_name_tag<Soa, Column>>;
+#if SOAGEN_INSTRUMENT
 
-    //--- generic fallback names ---------
+        inline std::atomic<table_hook> table_hook_{};
 
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(0, first);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(1, second);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(2, third);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(3, fourth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(4, fifth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(5, sixth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(6, seventh);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(7, eighth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(8, ninth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(9, tenth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(10, eleventh);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(11, twelfth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(12, thirteenth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(13, fourteenth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(14, fifteenth);
-    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(15, sixteenth);
+        class table_event_timer
+        {
+            std::chrono::steady_clock::time_point start_;
 
-    //--- column references ---------
+          public:
+            table_event_timer() noexcept //
+                : start_{ std::chrono::steady_clock::now() }
+            {}
 
-    template <typename Soa, size_t Column>
-    struct SOAGEN_EMPTY_BASES column_ref //
-        : named_ref<column_name_tag<Soa, Column>, value_ref<Soa, Column>>
-    {
-        static_assert(!std::is_lvalue_reference_v<Soa>);
-    };
+            SOAGEN_NODISCARD
+            std::uint64_t elapsed() const noexcept
+            {
+                return static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_)
+                        .count());
+            }
+        };
 
-    //--- column functions ---------
+        template <typename Table, typename Traits>
+        SOAGEN_NEVER_INLINE
+        void raise_table_event(table_event event,
+                               const void* tbl,
+                               size_t old_capacity,
+                               size_t new_capacity,
+                               size_t old_bytes,
+                               size_t new_bytes,
+                               size_t rows,
+                               std::uint64_t nanoseconds) noexcept
+        {
+            if (const auto hook = table_hook_.load(std::memory_order_acquire))
+                hook({ event,
+                       type_name<Table>(),
+                       table_layout_hash<Traits>(),
+                       tbl,
+                       old_capacity,
+                       new_capacity,
+                       old_bytes,
+                       new_bytes,
+                       rows,
+                       nanoseconds });
+        }
+
+        // a buffer changing hands without any rows moving is reported as its old owner deallocating it and its new
+        // owner allocating it, so totals kept per table from the events stay balanced
+        template <typename Table>
+        void raise_table_transfer(const void* tbl,
+                                  size_t old_capacity,
+                                  size_t old_bytes,
+                                  size_t new_capacity,
+                                  size_t new_bytes) noexcept
+        {
+            using traits = table_traits_type<Table>;
+
+            if (old_bytes)
+                raise_table_event<Table, traits>(table_event::deallocate,
+                                                 tbl,
+                                                 old_capacity,
+                                                 0u,
+                                                 old_bytes,
+                                                 0u,
+                                                 0u,
+                                                 0u);
+            if (new_bytes)
+                raise_table_event<Table, traits>(table_event::allocate,
+                                                 tbl,
+                                                 0u,
+                                                 new_capacity,
+                                                 0u,
+                                                 new_bytes,
+                                                 0u,
+                                                 0u);
+        }
 
-    template <typename Soa, size_t Column>
-    struct SOAGEN_EMPTY_BASES column_func //
-        : named_func<column_name_tag<Soa, Column>, Soa, Column>
-    {
-        static_assert(!detail::is_cvref<Soa>::value);
-    };
-}
+#endif
+    }
 
-//********  invoke.hpp  ************************************************************************************************
+#if SOAGEN_INSTRUMENT
 
-namespace soagen
-{
-    namespace detail
+    struct table_memory_stats
     {
-        template <typename Func, typename... Args>
-        struct is_invocable_ : nested_trait_<types<Func, Args...>, std::is_invocable, std::is_nothrow_invocable>
-        {
-            using base = nested_trait_<types<Func, Args...>, std::is_invocable, std::is_nothrow_invocable>;
+        std::string_view type_name;
 
-            using is_nothrow = typename base::template nested<0>;
-        };
-    }
+        std::uint64_t layout_hash;
 
-    template <typename Func, typename... Args>
-    inline constexpr bool is_invocable = detail::is_invocable_<Func, Args...>::value;
+        std::size_t tables;
 
-    template <typename Func, typename... Args>
-    inline constexpr bool is_nothrow_invocable =
-        detail::is_invocable_<Func, Args...>::is_nothrow::value;
+        std::size_t rows;
 
-    namespace detail
-    {
-        template <size_t I, typename Func, typename Arg>
-        struct is_invocable_with_optional_index_                            //
-            : std::disjunction<is_invocable_<Func, Arg, index_constant<I>>, //
-                               is_invocable_<Func, Arg, size_t>,            //
-                               is_invocable_<Func, index_constant<I>, Arg>, //
-                               is_invocable_<Func, size_t, Arg>,            //
-                               is_invocable_<Func, Arg>>
-        {};
-    }
+        std::size_t capacity;
 
-    template <size_t I, typename Func, typename Arg>
-    inline constexpr bool is_invocable_with_optional_index =
-        detail::is_invocable_with_optional_index_<I, Func, Arg>::value;
+        std::size_t bytes;
 
-    template <size_t I, typename Func, typename Arg>
-    inline constexpr bool is_nothrow_invocable_with_optional_index =
-        detail::is_invocable_with_optional_index_<I, Func, Arg>::is_nothrow::value;
+        std::size_t padding_bytes;
+    };
 
-    template <size_t I, typename Func, typename Arg>
-    SOAGEN_ALWAYS_INLINE
-    constexpr decltype(auto) invoke_with_optional_index(Func&& func,
-                                                        Arg&& arg) //
-        noexcept(is_nothrow_invocable_with_optional_index<I, Func&&, Arg&&>)
+#endif
+}
+
+namespace soagen::detail
+{
+#if SOAGEN_INSTRUMENT
+
+    // every live table is linked into the list for its type; the list for each type is created on first use and
+    // linked into a global list of types, so the registry can be queried without knowing the types up front
+
+    struct table_registry_node
     {
-        static_assert(is_invocable_with_optional_index<I, Func&&, Arg&&>);
+        table_registry_node* prev;
+        table_registry_node* next;
+    };
 
-        if constexpr (is_invocable<Func&&, Arg&&, index_constant<I>>)
+    struct table_registry_entry
+    {
+        using collect_func = void (*)(const table_registry_node&, table_memory_stats&) noexcept;
+
+        std::string_view type_name;
+        std::uint64_t layout_hash;
+        collect_func collect;
+        std::mutex mutex;
+        table_registry_node tables;
+        table_registry_entry* next_entry;
+
+        static std::mutex& registry_mutex() noexcept
         {
-            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg), index_constant<I>{});
+            static std::mutex mutex;
+            return mutex;
         }
-        else if constexpr (is_invocable<Func&&, Arg&&, size_t>)
+
+        static table_registry_entry*& registry_head() noexcept
         {
-            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg), I);
+            static table_registry_entry* head;
+            return head;
         }
-        else if constexpr (is_invocable<Func&&, index_constant<I>, Arg&&>)
+
+        table_registry_entry(std::string_view name, std::uint64_t hash, collect_func func) noexcept //
+            : type_name{ name },
+              layout_hash{ hash },
+              collect{ func },
+              tables{ &tables, &tables }
         {
-            return static_cast<Func&&>(func)(index_constant<I>{}, static_cast<Arg&&>(arg));
+            std::lock_guard lock{ registry_mutex() };
+            next_entry      = registry_head();
+            registry_head() = this;
         }
-        else if constexpr (is_invocable<Func&&, size_t, Arg&&>)
+
+        ~table_registry_entry() noexcept
         {
-            return static_cast<Func&&>(func)(I, static_cast<Arg&&>(arg));
+            std::lock_guard lock{ registry_mutex() };
+            for (auto e = &registry_head(); *e; e = &(*e)->next_entry)
+            {
+                if (*e == this)
+                {
+                    *e = next_entry;
+                    break;
+                }
+            }
         }
-        else
-        {
-            static_assert(is_invocable<Func&&, Arg&&>);
 
-            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg));
+        void link(table_registry_node& node) noexcept
+        {
+            std::lock_guard lock{ mutex };
+            node.prev         = tables.prev;
+            node.next         = &tables;
+            tables.prev->next = &node;
+            tables.prev       = &node;
         }
-    }
-}
 
-//********  for_each.hpp  **********************************************************************************************
+        void unlink(table_registry_node& node) noexcept
+        {
+            std::lock_guard lock{ mutex };
+            node.prev->next = node.next;
+            node.next->prev = node.prev;
+        }
 
-namespace soagen
-{
-    namespace detail
-    {
-        template <typename T, typename Func, size_t... Columns>
-        SOAGEN_ALWAYS_INLINE
-        void for_each_column(T&& obj, Func&& func, std::index_sequence<Columns...>) //
-            noexcept(noexcept((invoke_with_optional_index<Columns>(std::declval<Func&&>(),
-                                                                   std::declval<T&&>().template column<Columns>()),
-                               ...)))
+        SOAGEN_NODISCARD
+        table_memory_stats stats() noexcept
         {
-            (invoke_with_optional_index<Columns>(static_cast<Func&&>(func),
-                                                 static_cast<T&&>(obj).template column<Columns>()),
-             ...);
+            table_memory_stats s{ type_name, layout_hash, 0u, 0u, 0u, 0u, 0u };
+            std::lock_guard lock{ mutex };
+            for (auto node = tables.next; node != &tables; node = node->next)
+                collect(*node, s);
+            return s;
         }
-    }
+    };
 
-    template <typename T, typename Func>
-    void for_each_column(T&& obj, Func&& func) //
-        noexcept(noexcept(detail::for_each_column(std::declval<T&&>(),
-                                                  std::declval<Func&&>(),
-                                                  column_indices<detail::remove_cvref<T>>{})))
+    template <typename Table>
+    class table_registration;
+
+    // total size of a table's buffers, including exchanged columns (defined in table.hpp)
+    template <typename Table>
+    size_t table_allocation_bytes(const Table& tbl) noexcept;
+
+    template <typename Table>
+    void collect_table_stats(const table_registry_node& node, table_memory_stats& s) noexcept
     {
-        detail::for_each_column(static_cast<T&&>(obj),
-                                static_cast<Func&&>(func),
-                                column_indices<detail::remove_cvref<T>>{});
+        using traits = table_traits_type<Table>;
+
+        size_t row_bytes = {};
+        for (size_t i = 0; i < traits::column_count; i++)
+            row_bytes += traits::column_sizes[i];
+
+        const auto& tbl = static_cast<const Table&>(static_cast<const table_registration<Table>&>(node));
+        s.tables++;
+        s.rows += tbl.size();
+        s.capacity += tbl.capacity();
+        s.bytes += table_allocation_bytes(tbl);
+        s.padding_bytes += tbl.allocation_size() ? tbl.allocation_size() - tbl.capacity() * row_bytes : 0u;
     }
-}
 
-//********  row.hpp  ***************************************************************************************************
+    template <typename Table>
+    table_registry_entry& table_registry() noexcept
+    {
+        static table_registry_entry entry{ type_name<Table>(),
+                                           table_layout_hash<table_traits_type<Table>>(),
+                                           &collect_table_stats<Table> };
+        return entry;
+    }
 
-namespace soagen
-{
-    namespace detail
+    // base class of every table when instrumentation is enabled; registers the table for its lifetime.
+    // it's the table's first base, so its move operations run before the table's storage has taken the other table's
+    // buffer, and can still see what's about to change hands.
+    template <typename Table>
+    class table_registration : public table_registry_node
     {
-        // general rules for allowing implicit conversions:
-        // - losing rvalue (T&& -> T&), (const T&& -> const T&)
-        // - gaining const (T& -> const T&, T&& -> const T&&)
-        // - both
+        SOAGEN_PURE_INLINE_GETTER
+        const Table& registered_table() const noexcept
+        {
+            return static_cast<const Table&>(*this);
+        }
 
-        template <typename From, typename To>
-        inline constexpr bool implicit_conversion_ok = false;
+      protected:
+        table_registration() noexcept
+        {
+            table_registry<Table>().link(*this);
+        }
 
-        template <typename T>
-        inline constexpr bool implicit_conversion_ok<T, T> = true;
+        table_registration(const table_registration&) noexcept //
+            : table_registration{}
+        {}
 
-        template <typename T>
-        inline constexpr bool implicit_conversion_ok<T&, const T&> = true;
+        table_registration(table_registration&& other) noexcept //
+            : table_registration{}
+        {
+            const auto capacity = other.registered_table().capacity();
+            const auto bytes    = table_allocation_bytes(other.registered_table());
+            raise_table_transfer<Table>(&other, capacity, bytes, 0u, 0u);
+            raise_table_transfer<Table>(this, 0u, 0u, capacity, bytes);
+        }
 
-        template <typename T>
-        inline constexpr bool implicit_conversion_ok<T&&, T&> = true;
+        table_registration& operator=(const table_registration&) noexcept
+        {
+            return *this;
+        }
 
-        template <typename T>
-        inline constexpr bool implicit_conversion_ok<T&&, const T&> = true;
+        table_registration& operator=(table_registration&& rhs) noexcept
+        {
+            // the only move-assignment that reaches this is the untyped one, which always takes ownership
+            if (&rhs != this)
+                raise_move_from(rhs);
+            return *this;
+        }
 
-        template <typename T>
-        inline constexpr bool implicit_conversion_ok<T&&, const T&&> = true;
+        ~table_registration() noexcept
+        {
+            table_registry<Table>().unlink(*this);
+        }
 
-        // general rules for allowing explicit conversions:
-        template <typename From, typename To>
-        inline constexpr bool explicit_conversion_ok = false;
+        // call before this table takes ownership of rhs's buffer
+        void raise_move_from(const table_registration& rhs) noexcept
+        {
+            const auto old_capacity = registered_table().capacity();
+            const auto old_bytes    = table_allocation_bytes(registered_table());
+            const auto capacity     = rhs.registered_table().capacity();
+            const auto bytes        = table_allocation_bytes(rhs.registered_table());
+            raise_table_transfer<Table>(this, old_capacity, old_bytes, capacity, bytes);
+            raise_table_transfer<Table>(&rhs, capacity, bytes, 0u, 0u);
+        }
 
-        template <typename T>
-        inline constexpr bool explicit_conversion_ok<T&, T&&> = true;
+        // call before this table swaps buffers with other
+        void raise_swap_with(const table_registration& other) noexcept
+        {
+            const auto capacity       = registered_table().capacity();
+            const auto bytes          = table_allocation_bytes(registered_table());
+            const auto other_capacity = other.registered_table().capacity();
+            const auto other_bytes    = table_allocation_bytes(other.registered_table());
+            raise_table_transfer<Table>(this, capacity, bytes, other_capacity, other_bytes);
+            raise_table_transfer<Table>(&other, other_capacity, other_bytes, capacity, bytes);
+        }
+    };
 
-        template <typename T>
-        inline constexpr bool explicit_conversion_ok<T&, const T&&> = true;
+    inline void append_json_string(std::string& out, std::string_view str)
+    {
+        out += '"';
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        out += '"';
+    }
 
-        // tests for compatible column permutations:
-        template <typename From, typename To>
-        inline constexpr bool column_conversion_ok = false;
+#endif
+}
 
-        template <size_t... Columns>
-        inline constexpr bool column_conversion_ok<std::index_sequence<Columns...>, std::index_sequence<Columns...>> =
-            true;
+namespace soagen
+{
+#if SOAGEN_INSTRUMENT
 
-        template <size_t... FromColumns, size_t... ToColumns>
-        inline constexpr bool
-            column_conversion_ok<std::index_sequence<FromColumns...>, std::index_sequence<ToColumns...>> =
-                (any_same_value<ToColumns, FromColumns...> && ...);
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    table_memory_stats memory_stats() noexcept
+    {
+        return detail::table_registry<table_type<Soa>>().stats();
+    }
 
-        // row implicit conversions:
-        template <typename From, typename To>
-        inline constexpr bool row_implicit_conversion_ok = false;
+    SOAGEN_NODISCARD
+    inline std::vector<table_memory_stats> memory_report()
+    {
+        std::vector<table_memory_stats> report;
+        std::lock_guard lock{ detail::table_registry_entry::registry_mutex() };
+        for (auto e = detail::table_registry_entry::registry_head(); e; e = e->next_entry)
+            report.push_back(e->stats());
+        return report;
+    }
 
-        template <typename From, size_t... FromColumns, typename To, size_t... ToColumns>
-        inline constexpr bool row_implicit_conversion_ok<row<From, FromColumns...>, //
-                                                         row<To, ToColumns...>> =
-            implicit_conversion_ok<detail::coerce_ref<From>, detail::coerce_ref<To>>
-            && column_conversion_ok<std::index_sequence<FromColumns...>, std::index_sequence<ToColumns...>>;
+    SOAGEN_NODISCARD
+    inline std::string memory_report_json()
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+
+        std::string out = "{\"tables\":[";
+        bool first      = true;
+        for (const auto& s : memory_report())
+        {
+            if (!first)
+                out += ',';
+            first = false;
+
+            out += "{\"type\":";
+            detail::append_json_string(out, s.type_name);
+            out += ",\"layout_hash\":\"";
+            for (int shift = 60; shift >= 0; shift -= 4)
+                out += hex[(s.layout_hash >> shift) & 0xFu];
+            out += "\",\"tables\":" + std::to_string(s.tables);
+            out += ",\"rows\":" + std::to_string(s.rows);
+            out += ",\"capacity\":" + std::to_string(s.capacity);
+            out += ",\"bytes\":" + std::to_string(s.bytes);
+            out += ",\"padding_bytes\":" + std::to_string(s.padding_bytes);
+            out += '}';
+        }
+        out += "]}";
+        return out;
+    }
 
-        // row explicit conversions:
-        template <typename From, typename To>
-        inline constexpr bool row_explicit_conversion_ok = false;
+    inline table_hook set_table_hook(table_hook hook) noexcept
+    {
+        return detail::table_hook_.exchange(hook, std::memory_order_acq_rel);
+    }
+
+    SOAGEN_NODISCARD
+    inline table_hook get_table_hook() noexcept
+    {
+        return detail::table_hook_.load(std::memory_order_acquire);
+    }
+
+#endif
+}
+
+//********  names.hpp  *************************************************************************************************
+
+#ifndef SOAGEN_MAKE_NAME
+    #define SOAGEN_MAKE_NAME(Name)                                                                                     \
+                                                                                                                       \
+        struct name_tag_##Name;                                                                                        \
+                                                                                                                       \
+        template <>                                                                                                    \
+        struct SOAGEN_EMPTY_BASES name_constant<name_tag_##Name>                                                       \
+        {                                                                                                              \
+            static constexpr const char value[] = #Name;                                                               \
+        };                                                                                                             \
+                                                                                                                       \
+        template <typename T>                                                                                          \
+        struct SOAGEN_EMPTY_BASES named_ref<name_tag_##Name, T>                                                        \
+        {                                                                                                              \
+            static_assert(std::is_reference_v<T>);                                                                     \
+                                                                                                                       \
+            T Name;                                                                                                    \
+                                                                                                                       \
+          protected:                                                                                                   \
+            SOAGEN_PURE_INLINE_GETTER                                                                                  \
+            constexpr T get_ref() const noexcept                                                                       \
+            {                                                                                                          \
+                return static_cast<T>(Name);                                                                           \
+            }                                                                                                          \
+        };                                                                                                             \
+                                                                                                                       \
+        template <typename Derived, size_t Column>                                                                     \
+        struct SOAGEN_EMPTY_BASES named_func<name_tag_##Name, Derived, Column>                                         \
+        {                                                                                                              \
+            SOAGEN_PURE_INLINE_GETTER                                                                                  \
+            constexpr decltype(auto) Name() noexcept                                                                   \
+            {                                                                                                          \
+                using return_type = decltype(static_cast<Derived&>(*this).template column<Column>());                  \
+                if constexpr (std::is_reference_v<return_type>)                                                        \
+                    return static_cast<return_type>(static_cast<Derived&>(*this).template column<Column>());           \
+                else                                                                                                   \
+                    return static_cast<Derived&>(*this).template column<Column>();                                     \
+            }                                                                                                          \
+                                                                                                                       \
+            SOAGEN_PURE_INLINE_GETTER                                                                                  \
+            constexpr decltype(auto) Name() const noexcept                                                             \
+            {                                                                                                          \
+                using return_type = decltype(static_cast<const Derived&>(*this).template column<Column>());            \
+                if constexpr (std::is_reference_v<return_type>)                                                        \
+                    return static_cast<return_type>(static_cast<const Derived&>(*this).template column<Column>());     \
+                else                                                                                                   \
+                    return static_cast<const Derived&>(*this).template column<Column>();                               \
+            }                                                                                                          \
+        }
+#endif
+
+#ifndef SOAGEN_MAKE_NAMED_COLUMN
+    #define SOAGEN_MAKE_NAMED_COLUMN(Soa, Column, Name)                                                                \
+                                                                                                                       \
+        template <>                                                                                                    \
+        struct SOAGEN_EMPTY_BASES column_name_tag_<Soa, Column>                                                        \
+        {                                                                                                              \
+            using type = name_tag_##Name;                                                                              \
+        }
+#endif
+
+#ifndef SOAGEN_MAKE_GENERIC_NAMED_COLUMN
+    #define SOAGEN_MAKE_GENERIC_NAMED_COLUMN(Column, Name)                                                             \
+                                                                                                                       \
+        SOAGEN_MAKE_NAME(Name);                                                                                        \
+                                                                                                                       \
+        template <typename Soa>                                                                                        \
+        struct SOAGEN_EMPTY_BASES column_name_tag_<Soa, Column>                                                        \
+        {                                                                                                              \
+            using type = name_tag_##Name;                                                                              \
+        }
+#endif
+
+namespace soagen::detail
+{
+    //--- name constants ---------
+
+    template <typename Tag>
+    struct name_constant;
+
+    template <>
+    struct name_constant<void>
+    {
+        static constexpr const char value[] = "";
+    };
+
+    //--- named ref type ---------
+
+    template <typename Tag, typename>
+    struct named_ref;
+
+    template <typename T>
+    struct SOAGEN_EMPTY_BASES named_ref<void, T> // unnamed columns
+    {
+        static_assert(std::is_reference_v<T>);
+
+      protected:
+        T val_;
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr T get_ref() const noexcept
+        {
+            return static_cast<T>(val_);
+        }
+
+      public:
+        template <typename Val>
+        SOAGEN_NODISCARD_CTOR
+        constexpr named_ref(Val&& val) noexcept //
+            : val_{ static_cast<Val&&>(val) }
+        {
+        }
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(named_ref);
+    };
+
+    //--- named func type ---------
+
+    template <typename Tag, typename Derived, size_t>
+    struct named_func;
+
+    template <typename Derived, size_t Column>
+    struct SOAGEN_EMPTY_BASES named_func<void, Derived, Column>
+    {
+        // unnamed columns do not contribute any functions
+    };
+
+    //--- column names ---------
+
+    template <typename Soa, size_t Column>
+    struct column_name_tag_
+    {
+        using type = void; // unnamed columns
+    };
+    template <typename Soa, auto Column>
+    using column_name_tag = typename column_name_tag_<soa_type<Soa>, static_cast<size_t>(Column)>::type;
+
+    template <typename Soa, auto Column>
+    using column_name = name_constant<column_name_tag<Soa, Column>>;
+
+    //--- generic fallback names ---------
+
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(0, first);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(1, second);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(2, third);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(3, fourth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(4, fifth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(5, sixth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(6, seventh);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(7, eighth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(8, ninth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(9, tenth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(10, eleventh);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(11, twelfth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(12, thirteenth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(13, fourteenth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(14, fifteenth);
+    SOAGEN_MAKE_GENERIC_NAMED_COLUMN(15, sixteenth);
+
+    //--- column references ---------
+
+    template <typename Soa, size_t Column>
+    struct SOAGEN_EMPTY_BASES column_ref //
+        : named_ref<column_name_tag<Soa, Column>, value_ref<Soa, Column>>
+    {
+        static_assert(!std::is_lvalue_reference_v<Soa>);
+    };
+
+    //--- column functions ---------
+
+    template <typename Soa, size_t Column>
+    struct SOAGEN_EMPTY_BASES column_func //
+        : named_func<column_name_tag<Soa, Column>, Soa, Column>
+    {
+        static_assert(!detail::is_cvref<Soa>::value);
+    };
+}
+
+//********  invoke.hpp  ************************************************************************************************
+
+namespace soagen
+{
+    namespace detail
+    {
+        template <typename Func, typename... Args>
+        struct is_invocable_ : nested_trait_<types<Func, Args...>, std::is_invocable, std::is_nothrow_invocable>
+        {
+            using base = nested_trait_<types<Func, Args...>, std::is_invocable, std::is_nothrow_invocable>;
+
+            using is_nothrow = typename base::template nested<0>;
+        };
+    }
+
+    template <typename Func, typename... Args>
+    inline constexpr bool is_invocable = detail::is_invocable_<Func, Args...>::value;
+
+    template <typename Func, typename... Args>
+    inline constexpr bool is_nothrow_invocable =
+        detail::is_invocable_<Func, Args...>::is_nothrow::value;
+
+    namespace detail
+    {
+        template <size_t I, typename Func, typename Arg>
+        struct is_invocable_with_optional_index_                            //
+            : std::disjunction<is_invocable_<Func, Arg, index_constant<I>>, //
+                               is_invocable_<Func, Arg, size_t>,            //
+                               is_invocable_<Func, index_constant<I>, Arg>, //
+                               is_invocable_<Func, size_t, Arg>,            //
+                               is_invocable_<Func, Arg>>
+        {};
+    }
+
+    template <size_t I, typename Func, typename Arg>
+    inline constexpr bool is_invocable_with_optional_index =
+        detail::is_invocable_with_optional_index_<I, Func, Arg>::value;
+
+    template <size_t I, typename Func, typename Arg>
+    inline constexpr bool is_nothrow_invocable_with_optional_index =
+        detail::is_invocable_with_optional_index_<I, Func, Arg>::is_nothrow::value;
+
+    template <size_t I, typename Func, typename Arg>
+    SOAGEN_ALWAYS_INLINE
+    constexpr decltype(auto) invoke_with_optional_index(Func&& func,
+                                                        Arg&& arg) //
+        noexcept(is_nothrow_invocable_with_optional_index<I, Func&&, Arg&&>)
+    {
+        static_assert(is_invocable_with_optional_index<I, Func&&, Arg&&>);
+
+        if constexpr (is_invocable<Func&&, Arg&&, index_constant<I>>)
+        {
+            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg), index_constant<I>{});
+        }
+        else if constexpr (is_invocable<Func&&, Arg&&, size_t>)
+        {
+            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg), I);
+        }
+        else if constexpr (is_invocable<Func&&, index_constant<I>, Arg&&>)
+        {
+            return static_cast<Func&&>(func)(index_constant<I>{}, static_cast<Arg&&>(arg));
+        }
+        else if constexpr (is_invocable<Func&&, size_t, Arg&&>)
+        {
+            return static_cast<Func&&>(func)(I, static_cast<Arg&&>(arg));
+        }
+        else
+        {
+            static_assert(is_invocable<Func&&, Arg&&>);
+
+            return static_cast<Func&&>(func)(static_cast<Arg&&>(arg));
+        }
+    }
+}
+
+//********  for_each.hpp  **********************************************************************************************
+
+namespace soagen
+{
+    namespace detail
+    {
+        template <typename T, typename Func, size_t... Columns>
+        SOAGEN_ALWAYS_INLINE
+        void for_each_column(T&& obj, Func&& func, std::index_sequence<Columns...>) //
+            noexcept(noexcept((invoke_with_optional_index<Columns>(std::declval<Func&&>(),
+                                                                   std::declval<T&&>().template column<Columns>()),
+                               ...)))
+        {
+            (invoke_with_optional_index<Columns>(static_cast<Func&&>(func),
+                                                 static_cast<T&&>(obj).template column<Columns>()),
+             ...);
+        }
+    }
+
+    template <typename T, typename Func>
+    void for_each_column(T&& obj, Func&& func) //
+        noexcept(noexcept(detail::for_each_column(std::declval<T&&>(),
+                                                  std::declval<Func&&>(),
+                                                  column_indices<detail::remove_cvref<T>>{})))
+    {
+        detail::for_each_column(static_cast<T&&>(obj),
+                                static_cast<Func&&>(func),
+                                column_indices<detail::remove_cvref<T>>{});
+    }
+}
+
+//********  row.hpp  ***************************************************************************************************
+
+namespace soagen
+{
+    namespace detail
+    {
+        // general rules for allowing implicit conversions:
+        // - losing rvalue (T&& -> T&), (const T&& -> const T&)
+        // - gaining const (T& -> const T&, T&& -> const T&&)
+        // - both
+
+        template <typename From, typename To>
+        inline constexpr bool implicit_conversion_ok = false;
+
+        template <typename T>
+        inline constexpr bool implicit_conversion_ok<T, T> = true;
+
+        template <typename T>
+        inline constexpr bool implicit_conversion_ok<T&, const T&> = true;
+
+        template <typename T>
+        inline constexpr bool implicit_conversion_ok<T&&, T&> = true;
+
+        template <typename T>
+        inline constexpr bool implicit_conversion_ok<T&&, const T&> = true;
+
+        template <typename T>
+        inline constexpr bool implicit_conversion_ok<T&&, const T&&> = true;
+
+        // general rules for allowing explicit conversions:
+        template <typename From, typename To>
+        inline constexpr bool explicit_conversion_ok = false;
+
+        template <typename T>
+        inline constexpr bool explicit_conversion_ok<T&, T&&> = true;
+
+        template <typename T>
+        inline constexpr bool explicit_conversion_ok<T&, const T&&> = true;
+
+        // tests for compatible column permutations:
+        template <typename From, typename To>
+        inline constexpr bool column_conversion_ok = false;
+
+        template <size_t... Columns>
+        inline constexpr bool column_conversion_ok<std::index_sequence<Columns...>, std::index_sequence<Columns...>> =
+            true;
+
+        template <size_t... FromColumns, size_t... ToColumns>
+        inline constexpr bool
+            column_conversion_ok<std::index_sequence<FromColumns...>, std::index_sequence<ToColumns...>> =
+                (any_same_value<ToColumns, FromColumns...> && ...);
+
+        // row implicit conversions:
+        template <typename From, typename To>
+        inline constexpr bool row_implicit_conversion_ok = false;
+
+        template <typename From, size_t... FromColumns, typename To, size_t... ToColumns>
+        inline constexpr bool row_implicit_conversion_ok<row<From, FromColumns...>, //
+                                                         row<To, ToColumns...>> =
+            implicit_conversion_ok<detail::coerce_ref<From>, detail::coerce_ref<To>>
+            && column_conversion_ok<std::index_sequence<FromColumns...>, std::index_sequence<ToColumns...>>;
+
+        // row explicit conversions:
+        template <typename From, typename To>
+        inline constexpr bool row_explicit_conversion_ok = false;
 
         template <typename From, size_t... FromColumns, typename To, size_t... ToColumns>
         inline constexpr bool row_explicit_conversion_ok<row<From, FromColumns...>, //
@@ -6050,175 +7085,7012 @@ namespace soagen
             && column_conversion_ok<std::index_sequence<FromColumns...>, std::index_sequence<ToColumns...>>;
     }
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES row_base
-    {};
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES row_base
+    {};
+
+    template <typename Soa, size_t... Columns>
+    struct SOAGEN_EMPTY_BASES row //
+    SOAGEN_HIDDEN_BASE(public detail::column_ref<Soa, Columns>..., public row_base<row<Soa, Columns...>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
+        static_assert(sizeof...(Columns), "Column index list may not be empty.");
+        static_assert(std::is_empty_v<row_base<row<Soa, Columns...>>>,
+                      "row_base specializations may not have data members");
+        static_assert(std::is_trivial_v<row_base<row<Soa, Columns...>>>, "row_base specializations must be trivial");
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr row(value_ref<Soa, Columns>... args) noexcept //
+            : detail::column_ref<Soa, Columns>{ static_cast<value_ref<Soa, Columns>>(args) }...
+        {
+        }
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(row);
+
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr decltype(auto) column() const noexcept
+        {
+            static_assert(static_cast<size_t>(Column) < table_traits_type<Soa>::column_count,
+                          "column index out of range");
+
+            return detail::column_ref<Soa, static_cast<size_t>(Column)>::get_ref();
+        }
+
+        template <typename Func>
+        SOAGEN_ALWAYS_INLINE
+        constexpr void for_each_column(Func&& func) const //
+            noexcept(noexcept(soagen::for_each_column(std::declval<const row&>(), std::declval<Func&&>())))
+        {
+            soagen::for_each_column(*this, static_cast<Func&&>(func));
+        }
+
+        template <auto Member>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr decltype(auto) get() const noexcept
+        {
+            static_assert(static_cast<size_t>(Member) < sizeof...(Columns), "member index out of range");
+
+            return detail::type_at_index<static_cast<size_t>(Member), detail::column_ref<Soa, Columns>...>::get_ref();
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_equality_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator==(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_equality_comparable)
+        {
+            if constexpr (std::is_same_v<Soa, T>)
+            {
+                if (&lhs == &rhs)
+                    return true;
+            }
+            return ((lhs.template column<Columns>() == rhs.template column<Columns>()) && ...);
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_equality_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator!=(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_equality_comparable)
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        template <size_t Member, typename T>
+        SOAGEN_NODISCARD
+        static constexpr int row_compare_impl(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        {
+            if constexpr (std::is_same_v<Soa, T>)
+            {
+                if (&lhs == &rhs)
+                    return 0;
+            }
+
+            if (lhs.template get<Member>() < rhs.template get<Member>())
+                return -1;
+
+            if (rhs.template get<Member>() < lhs.template get<Member>())
+                return 1;
+
+            if constexpr (Member + 1u == sizeof...(Columns))
+                return 0;
+            else
+                return row_compare_impl<Member + 1u>(lhs, rhs);
+        }
+
+      public:
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator<(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        {
+            return row_compare_impl<0>(lhs, rhs) < 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator<=(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        {
+            return row_compare_impl<0>(lhs, rhs) <= 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator>(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        {
+            return row_compare_impl<0>(lhs, rhs) > 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
+                                    typename T)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator>=(const row& lhs, const row<T, Columns...>& rhs) //
+            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        {
+            return row_compare_impl<0>(lhs, rhs) >= 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((detail::row_implicit_conversion_ok<row, row<T, Cols...>>
+                                     && !detail::row_explicit_conversion_ok<row, row<T, Cols...>>),
+                                    typename T,
+                                    size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr operator row<T, Cols...>() const noexcept
+        {
+            return row<T, Cols...>{ static_cast<value_ref<T, Cols>>(this->template column<Cols>())... };
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((!detail::row_implicit_conversion_ok<row, row<T, Cols...>>
+                                     && detail::row_explicit_conversion_ok<row, row<T, Cols...>>),
+                                    typename T,
+                                    size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator row<T, Cols...>() const noexcept
+        {
+            return row<T, Cols...>{ static_cast<value_ref<T, Cols>>(this->template column<Cols>())... };
+        }
+    };
+}
+
+namespace std
+{
+    template <typename Soa, size_t... Columns>
+    struct tuple_size<soagen::row<Soa, Columns...>> //
+        : std::integral_constant<size_t, sizeof...(Columns)>
+    {};
+
+    template <size_t Member, typename Soa, size_t... Columns>
+    struct tuple_element<Member, soagen::row<Soa, Columns...>>
+    {
+        using type = decltype(std::declval<soagen::row<Soa, Columns...>>().template get<Member>());
+    };
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  iterator.hpp  **********************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <iterator>
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen
+{
+    namespace detail
+    {
+        template <typename T>
+        struct arrow_proxy
+        {
+            mutable T value;
+
+            SOAGEN_PURE_INLINE_GETTER
+            constexpr T* operator->() const noexcept
+            {
+                return &value;
+            }
+        };
+
+        template <typename Soa>
+        struct iterator_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            ptrdiff_t offset;
+        };
+    }
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES iterator_base
+    {};
+
+    template <typename Soa, size_t... Columns>
+    class SOAGEN_EMPTY_BASES iterator
+        SOAGEN_HIDDEN_BASE(protected detail::iterator_storage<detail::remove_cvref<Soa>>,
+                           public iterator_base<iterator<Soa, Columns...>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
+        static_assert(sizeof...(Columns), "Column index list may not be empty.");
+        static_assert(std::is_empty_v<iterator_base<iterator<Soa, Columns...>>>,
+                      "iterator_base specializations may not have data members");
+        static_assert(std::is_trivial_v<iterator_base<iterator<Soa, Columns...>>>,
+                      "iterator_base specializations must be trivial");
+
+      public:
+        using soa_type = detail::remove_cvref<Soa>;
+
+        using soa_ref = detail::coerce_ref<Soa>;
+        static_assert(std::is_reference_v<soa_ref>);
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using row_type = soagen::row_type<Soa, Columns...>;
+
+        using value_type = row_type;
+
+        using reference = row_type;
+
+        using iterator_category = std::random_access_iterator_tag;
+
+#if SOAGEN_CPP <= 17
+        using pointer = void;
+#endif
+
+      private:
+        template <typename, size_t...>
+        friend class iterator;
+
+        using base = detail::iterator_storage<detail::remove_cvref<Soa>>;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr iterator(base b) noexcept //
+            : base{ b }
+        {
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        constexpr iterator() noexcept //
+            : base{}
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        iterator(const iterator&) = default;
+
+        iterator& operator=(const iterator&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr iterator(soa_ref src, difference_type pos) noexcept //
+            : base{ const_cast<soa_type*>(&src), pos }
+        {
+        }
+
+        friend constexpr iterator& operator++(iterator& it) noexcept // pre
+        {
+            ++it.offset;
+            return it;
+        }
+
+        friend constexpr iterator operator++(iterator& it, int) noexcept // post
+        {
+            iterator pre = it;
+            ++it.offset;
+            return pre;
+        }
+
+        friend constexpr iterator& operator+=(iterator& it, difference_type n) noexcept
+        {
+            it.offset += n;
+            return it;
+        }
+
+        SOAGEN_PURE_GETTER
+        friend constexpr iterator operator+(const iterator& it, difference_type n) noexcept
+        {
+            auto it2 = it;
+            it2 += n;
+            return it2;
+        }
+
+        friend constexpr iterator& operator--(iterator& it) noexcept // pre
+        {
+            --it.offset;
+            return it;
+        }
+
+        friend constexpr iterator operator--(iterator& it, int) noexcept // post
+        {
+            iterator pre = it;
+            --it.offset;
+            return pre;
+        }
+
+        friend constexpr iterator& operator-=(iterator& it, difference_type n) noexcept
+        {
+            return it += (-n);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr iterator operator-(const iterator& it, difference_type n) noexcept
+        {
+            return it + (-n);
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_GETTER
+        constexpr difference_type operator-(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::offset - rhs.offset;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator*() const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(base::offset >= 0);
+
+            return static_cast<soa_ref>(*base::soa).template row<Columns...>(static_cast<size_type>(base::offset));
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr detail::arrow_proxy<row_type> operator->() const noexcept
+        {
+            return { *(*this) };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator[](difference_type offset) const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(base::offset + offset >= 0);
+
+            return static_cast<soa_ref>(*base::soa)
+                .template row<Columns...>(static_cast<size_type>(base::offset + offset));
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_GETTER
+        constexpr bool operator==(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::soa == rhs.soa && base::offset == rhs.offset;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator!=(const iterator& lhs, const iterator<T, Cols...>& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool operator<(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::offset < rhs.offset;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool operator<=(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::offset <= rhs.offset;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool operator>(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::offset > rhs.offset;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool operator>=(const iterator<T, Cols...>& rhs) const noexcept
+        {
+            return base::offset >= rhs.offset;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            (detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
+             && !detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
+            typename T,
+            size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr operator iterator<T, Cols...>() const noexcept
+        {
+            return iterator<T, Cols...>{ static_cast<const base&>(*this) };
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((!detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
+                                     && detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
+                                    typename T,
+                                    size_t... Cols)
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator iterator<T, Cols...>() const noexcept
+        {
+            return iterator<T, Cols...>{ static_cast<const base&>(*this) };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator size_type() const noexcept
+        {
+            SOAGEN_ASSUME(base::offset >= 0);
+
+            return static_cast<size_type>(base::offset);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator difference_type() const noexcept
+        {
+            return base::offset;
+        }
+    };
+
+    template <typename Soa, size_t... Columns>
+    SOAGEN_PURE_INLINE_GETTER
+    constexpr iterator<Soa, Columns...> operator+(typename iterator<Soa, Columns...>::difference_type n,
+                                                  const iterator<Soa, Columns...>& it) noexcept
+    {
+        return it + n;
+    }
+}
+
+//********  mixins/columns.hpp  ****************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, typename...>
+    struct SOAGEN_EMPTY_BASES columns;
+
+    template <typename Derived, size_t... Columns>
+    struct SOAGEN_EMPTY_BASES
+    columns<Derived, std::index_sequence<Columns...>> : detail::column_func<Derived, Columns>...
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+        static_assert(sizeof...(Columns));
+        static_assert(std::is_same_v<column_indices<Derived>, std::index_sequence<Columns...>>);
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES columns<Derived> //
+        : columns<Derived, column_indices<Derived>>
+    {
+        template <typename Func>
+        SOAGEN_ALWAYS_INLINE
+        constexpr void for_each_column(Func&& func) //
+            noexcept(noexcept(soagen::for_each_column(std::declval<Derived&>(), std::declval<Func&&>())))
+        {
+            soagen::for_each_column(static_cast<Derived&>(*this), static_cast<Func&&>(func));
+        }
+
+        template <typename Func>
+        SOAGEN_ALWAYS_INLINE
+        constexpr void for_each_column(Func&& func) const //
+            noexcept(noexcept(soagen::for_each_column(std::declval<const Derived&>(), std::declval<Func&&>())))
+        {
+            soagen::for_each_column(static_cast<const Derived&>(*this), static_cast<Func&&>(func));
+        }
+    };
+}
+
+//********  mixins/equality_comparable.hpp  ****************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, bool = detail::is_equality_comparable<const table_type<Derived>>::value>
+    struct SOAGEN_EMPTY_BASES equality_comparable
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator==(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_equality_comparable<const table_type<Derived>>::value)
+        {
+            return detail::soa_views_equal(lhs, rhs, column_indices<Derived>{});
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator!=(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_equality_comparable<const table_type<Derived>>::value)
+        {
+            return !detail::soa_views_equal(lhs, rhs, column_indices<Derived>{});
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES equality_comparable<Derived, false>
+    {};
+}
+
+//********  mixins/less_than_comparable.hpp  ***************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, bool = detail::is_less_than_comparable<const table_type<Derived>>::value>
+    struct SOAGEN_EMPTY_BASES less_than_comparable
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator<(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+        {
+            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) < 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator<=(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+        {
+            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) <= 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator>(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+        {
+            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) > 0;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
+        SOAGEN_NODISCARD
+        friend constexpr bool operator>=(const Derived& lhs, const Rhs& rhs) //
+            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+        {
+            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) >= 0;
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES less_than_comparable<Derived, false>
+    {};
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  span.hpp  **************************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#if SOAGEN_HAS_EXCEPTIONS
+    #include <stdexcept>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+
+namespace soagen
+{
+    namespace detail
+    {
+        template <typename Soa>
+        struct span_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            size_t start;
+            size_t count;
+        };
+
+        SOAGEN_CONST_GETTER
+        constexpr size_t calc_span_count(size_t start, size_t src_count, size_t desired_count) noexcept
+        {
+            return desired_count == static_cast<size_t>(-1) ? src_count - min(start, src_count) : desired_count;
+        }
+    }
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES span_base
+    {};
+
+    template <typename Soa>
+    class SOAGEN_EMPTY_BASES span //
+        SOAGEN_HIDDEN_BASE(protected detail::span_storage<detail::remove_cvref<Soa>>,
+                           public span_base<span<Soa>>,
+                           public mixins::columns<span<Soa>>,
+                           public mixins::equality_comparable<span<Soa>>,
+                           public mixins::less_than_comparable<span<Soa>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
+        static_assert(std::is_empty_v<span_base<span<Soa>>>, "span_base specializations may not have data members");
+        static_assert(std::is_trivial_v<span_base<span<Soa>>>, "span_base specializations must be trivial");
+
+      public:
+        using soa_type = detail::remove_cvref<Soa>;
+
+        using soa_ref = detail::coerce_ref<Soa>;
+        static_assert(std::is_reference_v<soa_ref>);
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using row_type = soagen::row_type<Soa>;
+
+        using iterator = soagen::iterator_type<Soa>;
+
+        using const_iterator = soagen::const_iterator_type<Soa>;
+
+        using span_type = span;
+
+        using const_span_type = soagen::const_span_type<Soa>;
+
+      private:
+        template <typename>
+        friend class span;
+
+        using base = detail::span_storage<detail::remove_cvref<Soa>>;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr span(base b) noexcept //
+            : base{ b }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr span(soa_ref soa, size_type start, size_type count, std::true_type) noexcept //
+            : base{ const_cast<soa_type*>(&soa), start, count }
+        {
+            SOAGEN_CONSTEXPR_SAFE_ASSERT(start < soa.size());
+            SOAGEN_CONSTEXPR_SAFE_ASSERT(start + count <= soa.size());
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        constexpr span() noexcept //
+            : base{}
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        span(const span&) = default;
+
+        span& operator=(const span&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr span(soa_ref soa, size_type start, size_type count = static_cast<size_type>(-1)) noexcept //
+            : span{ static_cast<soa_ref>(soa),
+                    start,
+                    detail::calc_span_count(start, soa.size(), count),
+                    std::true_type{} }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        explicit constexpr span(soa_ref soa) noexcept //
+            : span{ static_cast<soa_ref>(soa),        //
+                    0u,
+                    soa.size(),
+                    std::true_type{} }
+        {
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type size() const noexcept
+        {
+            return base::count;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool empty() const noexcept
+        {
+            return !size();
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(span, Column)
+        constexpr auto* column() const noexcept
+        {
+            return static_cast<soa_ref>(*base::soa).template column<Column>() + base::start;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_CONSTEXPR_20
+        void fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) const
+        {
+            SOAGEN_ASSUME(first <= size());
+
+            static_cast<soa_ref>(*base::soa).template fill<Column>(value, //
+                                                                   base::start + first,
+                                                                   min(count, size() - first));
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_CONSTEXPR_20
+        void assign_column(const Range& values, size_type first = 0) const
+        {
+            SOAGEN_ASSUME(first <= size());
+            SOAGEN_ASSERT(static_cast<size_type>(std::size(values)) <= size() - first);
+
+            static_cast<soa_ref>(*base::soa).template assign_column<Column>(values, base::start + first);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Soa, Cols...> row(size_type index) const noexcept
+        {
+            return static_cast<soa_ref>(*base::soa).template row<static_cast<size_type>(Cols)...>(base::start + index);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        row_type operator[](size_type index) const noexcept
+        {
+            return row(index);
+        }
+
+#if SOAGEN_HAS_EXCEPTIONS
+
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Soa, Cols...> at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range{ "bad element access" };
+            return static_cast<soa_ref>(*base::soa).template at<static_cast<size_type>(Cols)...>(base::start + index);
+        }
+
+#endif
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Soa, Cols...> front() const noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(0u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Soa, Cols...> back() const noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(size() - 1u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr soagen::iterator_type<Soa, Cols...> begin() const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa), //
+                     static_cast<difference_type>(base::start) };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr soagen::iterator_type<Soa, Cols...> end() const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa), //
+                     static_cast<difference_type>(base::start + base::count) };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr soagen::const_iterator_type<Soa, Cols...> cbegin() const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa), //
+                     static_cast<difference_type>(base::start) };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr soagen::const_iterator_type<Soa, Cols...> cend() const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa), //
+                     static_cast<difference_type>(base::start + base::count) };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa),
+                     base::start + start,
+                     detail::calc_span_count(start, base::count, count),
+                     std::true_type{} };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const_span_type const_subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
+        {
+            return { static_cast<soa_ref>(*base::soa),
+                     base::start + start,
+                     detail::calc_span_count(start, base::count, count),
+                     std::true_type{} };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type source_offset() const noexcept
+        {
+            return base::start;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr std::remove_reference_t<soa_ref>* source() const noexcept
+        {
+            return base::soa;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            (detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
+             && !detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
+            typename T)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr operator span<T>() const noexcept
+        {
+            return span<T>{ static_cast<const base&>(*this) };
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((!detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
+                                     && detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
+                                    typename T)
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator span<T>() const noexcept
+        {
+            return span<T>{ static_cast<const base&>(*this) };
+        }
+    };
+}
+
+//********  table_traits.hpp  ******************************************************************************************
+
+namespace soagen::detail
+{
+    // a base class for the table traits that handles all the non-alignment-dependent stuff -
+    // the 'Columns' argument seen by this class should be the column_base_traits, NOT soagen::column_traits
+    // (to minimize template instantiation explosion)
+    template <typename...>
+    struct table_traits_base;
+
+    template <size_t... I, typename... Columns>
+    struct table_traits_base<std::index_sequence<I...>, Columns...>
+    {
+        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
+
+        static_assert(std::is_same_v<std::index_sequence<I...>, std::make_index_sequence<sizeof...(Columns)>>,
+                      "index sequence must match columns");
+
+        static constexpr size_t column_count = sizeof...(Columns);
+        static_assert(column_count, "tables must have at least one column");
+        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
+
+        // columns
+
+        template <auto Index>
+        using column = type_at_index<static_cast<size_t>(Index), Columns...>;
+
+        template <typename IndexConstant>
+        using column_from_ic =
+            type_at_index<static_cast<size_t>(detail::remove_cvref<IndexConstant>::value), Columns...>;
+
+        template <auto Index>
+        using storage_type = typename column<static_cast<size_t>(Index)>::storage_type;
+
+        using column_pointers       = std::byte* [column_count];
+        using const_column_pointers = std::byte* const[column_count];
+
+        static constexpr size_t column_sizes[column_count] = { sizeof(typename Columns::storage_type)... };
+
+        // default constructibility
+
+        static constexpr bool all_default_constructible =
+            std::conjunction<std::is_default_constructible<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_nothrow_default_constructible =
+            std::conjunction<std::is_nothrow_default_constructible<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_trivially_default_constructible =
+            std::conjunction<std::is_trivially_default_constructible<typename Columns::storage_type>...>::value;
+
+        // trivial-copyability (memcpy + memmove)
+
+        static constexpr bool all_trivially_copyable = (Columns::is_trivially_copyable && ...);
+
+        static constexpr bool any_trivially_copyable = (false || ... || Columns::is_trivially_copyable);
+
+        // move-constructibility
+
+        static constexpr bool all_move_constructible = (Columns::is_move_constructible && ...);
+
+        static constexpr bool all_nothrow_move_constructible = (Columns::is_nothrow_move_constructible && ...);
+
+        static constexpr bool all_trivially_move_constructible = (Columns::is_trivially_move_constructible && ...);
+
+        // move-assignability
+
+        static constexpr bool all_move_assignable = (Columns::is_move_assignable && ...);
+
+        static constexpr bool all_nothrow_move_assignable = (Columns::is_nothrow_move_assignable && ...);
+
+        static constexpr bool all_trivially_move_assignable = (Columns::is_trivially_move_assignable && ...);
+
+        // copy-constructibility
+
+        static constexpr bool all_copy_constructible = (Columns::is_copy_constructible && ...);
+
+        static constexpr bool all_nothrow_copy_constructible = (Columns::is_nothrow_copy_constructible && ...);
+
+        static constexpr bool all_trivially_copy_constructible = (Columns::is_trivially_copy_constructible && ...);
+
+        // copy-assignability
+
+        static constexpr bool all_copy_assignable = (Columns::is_copy_assignable && ...);
+
+        static constexpr bool all_nothrow_copy_assignable = (Columns::is_nothrow_copy_assignable && ...);
+
+        static constexpr bool all_trivially_copy_assignable = (Columns::is_trivially_copy_assignable && ...);
+
+        // move-or-copy-constructibility
+
+        static constexpr bool all_move_or_copy_constructible = (Columns::is_move_or_copy_constructible && ...);
+
+        static constexpr bool all_nothrow_move_or_copy_constructible =
+            (Columns::is_nothrow_move_or_copy_constructible && ...);
+
+        static constexpr bool all_trivially_move_or_copy_constructible =
+            (Columns::is_trivially_move_or_copy_constructible && ...);
+
+        // move-or-copy-assignability
+
+        static constexpr bool all_move_or_copy_assignable = (Columns::is_move_or_copy_assignable && ...);
+
+        static constexpr bool all_nothrow_move_or_copy_assignable =
+            (Columns::is_nothrow_move_or_copy_assignable && ...);
+
+        static constexpr bool all_trivially_move_or_copy_assignable =
+            (Columns::is_trivially_move_or_copy_assignable && ...);
+
+        // destructibility
+
+        static constexpr bool all_destructible =
+            std::conjunction<std::is_destructible<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_nothrow_destructible =
+            std::conjunction<std::is_nothrow_destructible<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_trivially_destructible =
+            std::conjunction<std::is_trivially_destructible<typename Columns::storage_type>...>::value;
+
+        // swappability
+
+        static constexpr bool all_swappable = (Columns::is_swappable && ...);
+
+        static constexpr bool all_nothrow_swappable = (Columns::is_nothrow_swappable && ...);
+
+        // equality comparability
+
+        static constexpr bool all_equality_comparable =
+            std::conjunction<is_equality_comparable<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_nothrow_equality_comparable =
+            std::conjunction<is_nothrow_equality_comparable<typename Columns::storage_type>...>::value;
+
+        // less-than comparability
+
+        static constexpr bool all_less_than_comparable =
+            std::conjunction<is_less_than_comparable<typename Columns::storage_type>...>::value;
+
+        static constexpr bool all_nothrow_less_than_comparable =
+            std::conjunction<is_nothrow_less_than_comparable<typename Columns::storage_type>...>::value;
+
+        // row constructibility
+
+      private:
+        template <size_t, typename...>
+        struct row_constructible_from_tuple_ : std::false_type
+        {};
+        template <typename Tuple, size_t... Members>
+        struct row_constructible_from_tuple_<column_count, Tuple, std::index_sequence<Members...>>
+            : std::conjunction<typename Columns::template is_constructible_trait<decltype(get_from_tuple<Members>(
+                  std::declval<Tuple>()))>...>
+        {
+            static_assert(std::is_same_v<std::index_sequence<Members...>, std::make_index_sequence<column_count>>);
+        };
+
+        template <bool, size_t, typename... Args>
+        struct row_constructible_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct row_constructible_from_<false, column_count, Args...>
+            : std::conjunction<typename Columns::template is_constructible_trait<Args>...>
+        {
+            static_assert(sizeof...(Args) == column_count);
+        };
+        template <typename Tuple>
+        struct row_constructible_from_<true, 1, Tuple>
+            : row_constructible_from_tuple_<std::tuple_size_v<detail::remove_cvref<Tuple>>,
+                                            detail::remove_cvref<Tuple>,
+                                            std::make_index_sequence<std::tuple_size_v<detail::remove_cvref<Tuple>>>>
+        {};
+
+      public:
+        template <typename... Args>
+        static constexpr bool row_constructible_from =
+            row_constructible_from_<(is_tuple<detail::remove_cvref<Args>> && ...), sizeof...(Args), Args...>::value;
+
+        // row constructibility (nothrow)
+
+      private:
+        template <size_t, typename...>
+        struct row_nothrow_constructible_from_tuple_ : std::false_type
+        {};
+        template <typename Tuple, size_t... Members>
+        struct row_nothrow_constructible_from_tuple_<column_count, Tuple, std::index_sequence<Members...>>
+            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<
+                  decltype(get_from_tuple<Members>(std::declval<Tuple>()))>...>
+        {
+            static_assert(std::is_same_v<std::index_sequence<Members...>, std::make_index_sequence<column_count>>);
+        };
+
+        template <bool, size_t, typename... Args>
+        struct row_nothrow_constructible_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct row_nothrow_constructible_from_<false, column_count, Args...>
+            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<Args>...>
+        {
+            static_assert(sizeof...(Args) == column_count);
+        };
+        template <typename Tuple>
+        struct row_nothrow_constructible_from_<true, 1, Tuple>
+            : row_nothrow_constructible_from_tuple_<
+                  std::tuple_size_v<detail::remove_cvref<Tuple>>,
+                  detail::remove_cvref<Tuple>,
+                  std::make_index_sequence<std::tuple_size_v<detail::remove_cvref<Tuple>>>>
+        {};
+
+      public:
+        template <typename... Args>
+        static constexpr bool row_nothrow_constructible_from =
+            row_nothrow_constructible_from_<(is_tuple<detail::remove_cvref<Args>> && ...), sizeof...(Args), Args...>::
+                value;
+
+        //--- memmove --------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_trivially_copyable)
+        SOAGEN_CONSTEXPR_20
+        static void memmove(column_pointers& dest,
+                            size_t dest_start,
+                            const_column_pointers& source,
+                            size_t source_start,
+                            size_t count) //
+            noexcept
+        {
+            (column<I>::memmove(dest[I], dest_start, source[I], source_start, count), ...);
+        }
+
+        //--- memcpy ---------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_trivially_copyable)
+        static void memcpy(column_pointers& dest,
+                           size_t dest_start,
+                           const_column_pointers& source,
+                           size_t source_start,
+                           size_t count) //
+            noexcept
+        {
+            (column<I>::memcpy(dest[I], dest_start, source[I], source_start, count), ...);
+        }
+
+        //--- destruction ----------------------------------------------------------------------------------------------
+
+        static constexpr void destruct_row(column_pointers& columns,
+                                           size_t index,
+                                           size_t leftmost_column,
+                                           size_t rightmost_column) noexcept
+        {
+            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+
+            if constexpr (all_trivially_destructible)
+            {
+                // nothing to do in this case :)
+            }
+            else
+            {
+                const auto destructor = [&](auto ic) noexcept
+                {
+                    static constexpr size_t column_index = decltype(ic)::value;
+
+                    if constexpr (!std::is_trivially_destructible_v<storage_type<column_index>>)
+                    {
+                        if (column_index >= leftmost_column && column_index <= rightmost_column)
+                            column<column_index>::destruct(columns[column_index], index);
+                    }
+                };
+
+                (destructor(index_constant<column_count - I - 1u>{}), ...);
+            }
+        }
+
+        static constexpr void destruct_row(column_pointers& columns, size_t index) noexcept
+        {
+            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+
+            if constexpr (all_trivially_destructible)
+            {
+                // nothing to do in this case :)
+            }
+            else
+            {
+                const auto destructor = [&](auto ic) noexcept
+                {
+                    static constexpr size_t column_index = decltype(ic)::value;
+
+                    if constexpr (!std::is_trivially_destructible_v<storage_type<column_index>>)
+                    {
+                        column<column_index>::destruct(columns[column_index], index);
+                    }
+                };
+
+                (destructor(index_constant<column_count - I - 1u>{}), ...);
+            }
+        }
+
+        static constexpr void destruct_rows([[maybe_unused]] column_pointers& columns,
+                                            [[maybe_unused]] size_t start,
+                                            [[maybe_unused]] size_t count) noexcept
+        {
+            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+
+            if constexpr (all_trivially_destructible)
+            {
+                // nothing to do in this case :)
+            }
+            else
+            {
+                for (size_t i = start + count; i-- > start;)
+                    destruct_row(columns, i);
+            }
+        }
+
+        //--- default-construction -------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
+        SOAGEN_CONSTEXPR_20
+        static void default_construct_row(column_pointers& columns,
+                                          size_t index) //
+            noexcept(all_nothrow_default_constructible) //
+        {
+            static_assert(all_default_constructible);
+
+            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
+            {
+                (column<I>::default_construct(columns[I], index), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic) //
+                    noexcept(std::is_nothrow_default_constructible_v<storage_type<decltype(ic)::value>>)
+                {
+                    column_from_ic<decltype(ic)>::default_construct(columns[decltype(ic)::value], index);
+
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    if (constructed_columns)
+                        destruct_row(columns, index, 0u, constructed_columns - 1u);
+
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
+        SOAGEN_CONSTEXPR_20
+        static void default_construct_rows([[maybe_unused]] column_pointers& columns,
+                                           [[maybe_unused]] size_t start,
+                                           [[maybe_unused]] size_t count) //
+            noexcept(all_nothrow_destructible)
+        {
+            if constexpr (all_nothrow_default_constructible)
+            {
+                // column-at-a-time so each column can use its bulk path
+                if (count)
+                    (column<I>::default_construct(columns[I], start, count), ...);
+            }
+            else if constexpr (all_trivially_destructible)
+            {
+                for (size_t i = start, e = start + count; i < e; i++)
+                    default_construct_row(columns, i);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                size_t i = start;
+
+                SOAGEN_TRY
+                {
+                    for (const size_t e = start + count; i < e; i++)
+                        default_construct_row(columns, i);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    destruct_rows(columns, start, i - start);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
+        SOAGEN_CONSTEXPR_20
+        static void construct_rows_for_overwrite([[maybe_unused]] column_pointers& columns,
+                                                 [[maybe_unused]] size_t start,
+                                                 [[maybe_unused]] size_t count) //
+            noexcept(all_nothrow_default_constructible)
+        {
+            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
+            {
+                (column<I>::default_construct_for_overwrite(columns[I], start, count), ...);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic) //
+                {
+                    column_from_ic<decltype(ic)>::default_construct_for_overwrite(columns[decltype(ic)::value],
+                                                                                  start,
+                                                                                  count);
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    const auto destructor = [&](auto ic) //
+                    {
+                        if (decltype(ic)::value < constructed_columns)
+                            for (size_t i = start, e = start + count; i < e; i++)
+                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
+                    };
+                    (destructor(index_constant<I>{}), ...);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct_rows_for_overwrite([[maybe_unused]] column_pointers& columns,
+                                                       [[maybe_unused]] size_t start,
+                                                       [[maybe_unused]] size_t count) //
+            noexcept(all_nothrow_default_constructible)
+        {
+            if (!count)
+                return;
+
+            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
+            {
+                (column<I>::value_construct_for_overwrite(columns[I], start, count), ...);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic) //
+                {
+                    column_from_ic<decltype(ic)>::value_construct_for_overwrite(columns[decltype(ic)::value],
+                                                                                start,
+                                                                                count);
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    const auto destructor = [&](auto ic) //
+                    {
+                        if (decltype(ic)::value < constructed_columns)
+                            for (size_t i = start, e = start + count; i < e; i++)
+                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
+                    };
+                    (destructor(index_constant<I>{}), ...);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        //--- construction ---------------------------------------------------------------------------------------------
+
+      private:
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename Tuple, auto sfinae = row_constructible_from<Tuple&&>)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void construct_row_from_tuple(column_pointers& columns,
+                                             size_t index,
+                                             Tuple&& tuple) //
+            noexcept(row_nothrow_constructible_from<Tuple&&>)
+        {
+            static_assert(std::tuple_size_v<detail::remove_cvref<Tuple>> == column_count);
+
+            construct_row(columns, index, get_from_tuple<I>(static_cast<Tuple&&>(tuple))...);
+        }
+
+      public:
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename... Args, auto sfinae = row_constructible_from<Args&&...>)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void construct_row(column_pointers& columns, size_t index, Args&&... args) //
+            noexcept(row_nothrow_constructible_from<Args&&...>)
+        {
+            if constexpr (sizeof...(Args) == 0)
+            {
+                default_construct_row(columns, index, static_cast<Args&&>(args)...);
+            }
+            else if constexpr (sizeof...(Args) == 1 && (is_tuple<detail::remove_cvref<Args>> && ...))
+            {
+                construct_row_from_tuple(columns, index, static_cast<Args&&>(args)...);
+            }
+            else
+            {
+                static_assert(sizeof...(Args) == sizeof...(I));
+
+                if constexpr (row_nothrow_constructible_from<Args&&...> || all_trivially_destructible)
+                {
+                    (column<I>::construct_at(columns[I], index, static_cast<Args&&>(args)), ...);
+                }
+                else
+                {
+                    // machinery to provide strong-exception guarantee
+
+                    [[maybe_unused]]
+                    size_t constructed_columns = {};
+
+                    const auto constructor =
+                        [&](auto ic, auto&& arg) noexcept(
+                            column_from_ic<decltype(ic)>::template is_nothrow_constructible<decltype(arg)>)
+                    {
+                        static_assert(std::is_reference_v<decltype(arg)>);
+
+                        column_from_ic<decltype(ic)>::construct_at(columns[decltype(ic)::value],
+                                                                   index,
+                                                                   static_cast<decltype(arg)>(arg));
+
+                        constructed_columns++;
+                    };
+
+                    SOAGEN_TRY
+                    {
+                        (constructor(index_constant<I>{}, static_cast<Args&&>(args)), ...);
+                    }
+#if SOAGEN_HAS_EXCEPTIONS
+                    catch (...)
+                    {
+                        if (constructed_columns)
+                            destruct_row(columns, index, 0u, constructed_columns - 1u);
+                        throw;
+                    }
+#endif
+                }
+            }
+        }
+
+        //--- fill-construction ----------------------------------------------------------------------------------------
+
+      private:
+        template <bool, typename... Args>
+        struct rows_fillable_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct rows_fillable_from_<true, Args...>
+            : std::conjunction<typename Columns::template is_constructible_trait<const Args&>...>
+        {};
+
+        template <bool, typename... Args>
+        struct rows_nothrow_fillable_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct rows_nothrow_fillable_from_<true, Args...>
+            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<const Args&>...>
+        {};
+
+      public:
+        // one value per column (no tuple unpacking, unlike row_constructible_from)
+        template <typename... Args>
+        static constexpr bool rows_fillable_from = rows_fillable_from_<sizeof...(Args) == column_count, Args...>::value;
+
+        template <typename... Args>
+        static constexpr bool rows_nothrow_fillable_from =
+            rows_nothrow_fillable_from_<sizeof...(Args) == column_count, Args...>::value;
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename... Args, auto sfinae = rows_fillable_from<Args...>)
+        SOAGEN_CONSTEXPR_20
+        static void fill_construct_rows(column_pointers& columns,
+                                        size_t start,
+                                        size_t count,
+                                        const Args&... values) //
+            noexcept(rows_nothrow_fillable_from<Args...>)
+        {
+            if (!count)
+                return;
+
+            // column-at-a-time so each column can use its bulk path
+            if constexpr (rows_nothrow_fillable_from<Args...> || all_trivially_destructible)
+            {
+                (column<I>::fill_construct(columns[I], start, count, values), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic, const auto& value) //
+                {
+                    column_from_ic<decltype(ic)>::fill_construct(columns[decltype(ic)::value], start, count, value);
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}, values), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    const auto destructor = [&](auto ic) //
+                    {
+                        if (decltype(ic)::value < constructed_columns)
+                            for (size_t i = start, e = start + count; i < e; i++)
+                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
+                    };
+                    (destructor(index_constant<I>{}), ...);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        //--- move-construction ----------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_construct_row(column_pointers& dest,
+                                       size_t dest_index,
+                                       column_pointers& source,
+                                       size_t source_index) //
+            noexcept(all_nothrow_move_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            if constexpr (all_nothrow_move_constructible || all_trivially_destructible)
+            {
+                (column<I>::move_construct(dest[I], dest_index, source[I], source_index), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor =
+                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_move_constructible)
+                {
+                    column_from_ic<decltype(ic)>::move_construct(dest[decltype(ic)::value],
+                                                                 dest_index,
+                                                                 source[decltype(ic)::value],
+                                                                 source_index);
+
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    if (constructed_columns)
+                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_construct_rows(column_pointers& dest,
+                                        size_t dest_start,
+                                        column_pointers& source,
+                                        size_t source_start,
+                                        size_t count) //
+            noexcept(all_nothrow_move_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t cleanup_start = dest_start;
+                [[maybe_unused]]
+                size_t cleanup_count = 0;
+
+                const auto constructor = [&]() noexcept(all_nothrow_move_constructible)
+                {
+                    if (&dest == &source && dest_start > source_start)
+                    {
+                        for (size_t i = count; i-- > 0u;)
+                        {
+                            move_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_start = dest_start + i;
+                            cleanup_count++;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            move_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_count++;
+                        }
+                    }
+                };
+
+                if constexpr (all_nothrow_move_constructible)
+                {
+                    constructor();
+                }
+                else
+                {
+                    // machinery to provide strong-exception guarantee
+
+                    SOAGEN_TRY
+                    {
+                        constructor();
+                    }
+#if SOAGEN_HAS_EXCEPTIONS
+                    catch (...)
+                    {
+                        destruct_rows(dest, cleanup_start, cleanup_count);
+                        throw;
+                    }
+#endif
+                }
+            }
+        }
+
+        //--- copy-construction ----------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void copy_construct_row(column_pointers& dest,
+                                       size_t dest_index,
+                                       const const_column_pointers& source,
+                                       size_t source_index) //
+            noexcept(all_nothrow_copy_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            if constexpr (all_nothrow_copy_constructible || all_trivially_destructible)
+            {
+                (column<I>::copy_construct(dest[I], dest_index, source[I], source_index), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor =
+                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_copy_constructible)
+                {
+                    column_from_ic<decltype(ic)>::copy_construct(dest[decltype(ic)::value],
+                                                                 dest_index,
+                                                                 source[decltype(ic)::value],
+                                                                 source_index);
+
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    if (constructed_columns)
+                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void copy_construct_rows(column_pointers& dest,
+                                        size_t dest_start,
+                                        const const_column_pointers& source,
+                                        size_t source_start,
+                                        size_t count) //
+            noexcept(all_nothrow_copy_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t cleanup_start = dest_start;
+                [[maybe_unused]]
+                size_t cleanup_count = 0;
+
+                const auto constructor = [&]() noexcept(all_nothrow_copy_constructible)
+                {
+                    if (&dest == &source && dest_start > source_start)
+                    {
+                        for (size_t i = count; i-- > 0u;)
+                        {
+                            copy_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_start = dest_start + i;
+                            cleanup_count++;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            copy_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_count++;
+                        }
+                    }
+                };
+
+                if constexpr (all_nothrow_copy_constructible)
+                {
+                    constructor();
+                }
+                else
+                {
+                    // machinery to provide strong-exception guarantee
+                    SOAGEN_TRY
+                    {
+                        constructor();
+                    }
+#if SOAGEN_HAS_EXCEPTIONS
+                    catch (...)
+                    {
+                        destruct_rows(dest, cleanup_start, cleanup_count);
+                        throw;
+                    }
+#endif
+                }
+            }
+        }
+
+        //--- move-or-copy-construction (whichever is possible per-column) ---------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_or_copy_construct_row(column_pointers& dest,
+                                               size_t dest_index,
+                                               column_pointers& source,
+                                               size_t source_index) //
+            noexcept(all_nothrow_move_or_copy_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            if constexpr (all_nothrow_move_or_copy_constructible || all_trivially_destructible)
+            {
+                (column<I>::move_or_copy_construct(dest[I], dest_index, source[I], source_index), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor =
+                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_move_or_copy_constructible)
+                {
+                    column_from_ic<decltype(ic)>::move_or_copy_construct(dest[decltype(ic)::value],
+                                                                         dest_index,
+                                                                         source[decltype(ic)::value],
+                                                                         source_index);
+
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    if (constructed_columns)
+                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
+                    throw;
+                }
+#endif
+            }
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_constructible)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_or_copy_construct_rows(column_pointers& dest,
+                                                size_t dest_start,
+                                                column_pointers& source,
+                                                size_t source_start,
+                                                size_t count) //
+            noexcept(all_nothrow_move_or_copy_constructible)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t cleanup_start = dest_start;
+                [[maybe_unused]]
+                size_t cleanup_count = 0;
+
+                const auto constructor = [&]() noexcept(all_nothrow_move_or_copy_constructible)
+                {
+                    if (&dest == &source && dest_start > source_start)
+                    {
+                        for (size_t i = count; i-- > 0u;)
+                        {
+                            move_or_copy_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_start = dest_start + i;
+                            cleanup_count++;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            move_or_copy_construct_row(dest, dest_start + i, source, source_start + i);
+                            cleanup_count++;
+                        }
+                    }
+                };
+
+                if constexpr (all_nothrow_move_or_copy_constructible)
+                {
+                    constructor();
+                }
+                else
+                {
+                    // machinery to provide strong-exception guarantee
+
+                    SOAGEN_TRY
+                    {
+                        constructor();
+                    }
+#if SOAGEN_HAS_EXCEPTIONS
+                    catch (...)
+                    {
+                        destruct_rows(dest, cleanup_start, cleanup_count);
+                        throw;
+                    }
+#endif
+                }
+            }
+        }
+
+        //--- move-assignment ------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_assign_row(column_pointers& dest,
+                                    size_t dest_index,
+                                    column_pointers& source,
+                                    size_t source_index) //
+            noexcept(all_nothrow_move_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            // todo: how to provide a strong-exception guarantee here?
+
+            (column<I>::move_assign(dest[I], dest_index, source[I], source_index), ...);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_assign_rows(column_pointers& dest,
+                                     size_t dest_start,
+                                     column_pointers& source,
+                                     size_t source_start,
+                                     size_t count) //
+            noexcept(all_nothrow_copy_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                if (&dest == &source && dest_start > source_start)
+                {
+                    for (size_t i = count; i-- > 0u;)
+                        move_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                        move_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+            }
+        }
+
+        //--- copy-assignment ------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void copy_assign_row(column_pointers& dest,
+                                    size_t dest_index,
+                                    const const_column_pointers& source,
+                                    size_t source_index) //
+            noexcept(all_nothrow_copy_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            // todo: how to provide a strong-exception guarantee here?
+
+            (column<I>::copy_assign(dest[I], dest_index, source[I], source_index), ...);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void copy_assign_rows(column_pointers& dest,
+                                     size_t dest_start,
+                                     const const_column_pointers& source,
+                                     size_t source_start,
+                                     size_t count) //
+            noexcept(all_nothrow_copy_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                if (&dest == &source && dest_start > source_start)
+                {
+                    for (size_t i = count; i-- > 0u;)
+                        copy_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                        copy_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+            }
+        }
+
+        //--- move-or-copy-assignment (whichever is possible per-column) -----------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_or_copy_assign_row(column_pointers& dest,
+                                            size_t dest_index,
+                                            column_pointers& source,
+                                            size_t source_index) //
+            noexcept(all_nothrow_move_or_copy_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+
+            // todo: how to provide a strong-exception guarantee here?
+
+            (column<I>::move_or_copy_assign(dest[I], dest_index, source[I], source_index), ...);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_assignable)
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        static void move_or_copy_assign_rows(column_pointers& dest,
+                                             size_t dest_start,
+                                             column_pointers& source,
+                                             size_t source_start,
+                                             size_t count) //
+            noexcept(all_nothrow_move_or_copy_assignable)
+        {
+            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+
+            if constexpr (all_trivially_copyable)
+            {
+                memmove(dest, dest_start, source, source_start, count);
+            }
+            else
+            {
+                if (&dest == &source && dest_start > source_start)
+                {
+                    for (size_t i = count; i-- > 0u;)
+                        move_or_copy_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                        move_or_copy_assign_row(dest, dest_start + i, source, source_start + i);
+                }
+            }
+        }
+
+        //--- swap rows ------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_swappable)
+        SOAGEN_CONSTEXPR_20
+        static void swap_rows(column_pointers& lhs,
+                              size_t lhs_index,
+                              column_pointers& rhs,
+                              size_t rhs_index) //
+            noexcept(all_nothrow_swappable)
+        {
+            (column<I>::swap(lhs[I], lhs_index, rhs[I], rhs_index), ...);
+        }
+
+        //--- swap columns ---------------------------------------------------------------------------------------------
+
+        template <auto A, auto B>
+        static constexpr bool can_swap_columns =
+            static_cast<size_t>(A) == static_cast<size_t>(B)
+            || (std::is_same_v<storage_type<A>, storage_type<B>> && column<A>::is_swappable);
+
+        template <auto A, auto B>
+        static constexpr bool can_nothrow_swap_columns =
+            static_cast<size_t>(A) == static_cast<size_t>(B)
+            || (std::is_same_v<storage_type<A>, storage_type<B>> && column<A>::is_nothrow_swappable);
+
+        SOAGEN_HIDDEN_CONSTRAINT((can_swap_columns<A, B>), auto A, auto B)
+        SOAGEN_CONSTEXPR_20
+        static void swap_columns([[maybe_unused]] column_pointers& columns,
+                                 [[maybe_unused]] size_t start,
+                                 [[maybe_unused]] size_t count) //
+            noexcept(can_nothrow_swap_columns<A, B>)
+        {
+            if constexpr (static_cast<size_t>(A) != static_cast<size_t>(B))
+            {
+                static_assert(std::is_same_v<storage_type<A>, storage_type<B>>);
+                static_assert(column<A>::is_swappable);
+                static_assert(column<B>::is_swappable);
+
+                column<A>::swap(columns[A], start, columns[B], start, count);
+            }
+        }
+
+        //--- equality -------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_equality_comparable)
+        SOAGEN_NODISCARD
+        static constexpr bool equal(const const_column_pointers& lhs,
+                                    size_t lhs_start,
+                                    const const_column_pointers& rhs,
+                                    size_t rhs_start,
+                                    size_t count) //
+            noexcept(all_nothrow_equality_comparable)
+        {
+            // note that the equality-comparison is done column-major for speed (cache-locality) because
+            // equality-comparison does not need to know anything about the order of the columns,
+            // just that they are all equal (there is no lexicographic constraint)
+
+            return (column<I>::equal(lhs[I], lhs_start, rhs[I], rhs_start, count) && ...);
+        }
+
+        //--- compare --------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_less_than_comparable)
+        SOAGEN_NODISCARD
+        static constexpr int compare(const const_column_pointers& lhs,
+                                     size_t lhs_start,
+                                     const const_column_pointers& rhs,
+                                     size_t rhs_start,
+                                     size_t count) //
+            noexcept(all_nothrow_less_than_comparable)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                int result = 0;
+                (void)(((result = column<I>::less_than(lhs[I], lhs_start + i, rhs[I], rhs_start + i)
+                                    ? -1
+                                    : (column<I>::less_than(rhs[I], rhs_start + i, lhs[I], lhs_start + i) ? 1 : 0)),
+                        result != 0)
+                       || ...);
+                if (result != 0)
+                    return result;
+            }
+
+            return 0;
+        }
+    };
+
+    // a more specialzed base that sees the full column traits, not just the base version.
+    // (this is just for things that need the specialized information _and_ the column indices)
+    template <typename...>
+    struct table_traits_base_specialized;
+
+    template <size_t... I, typename... Columns>
+    struct table_traits_base_specialized<std::index_sequence<I...>, Columns...> //
+        : public table_traits_base<std::index_sequence<I...>, to_base_traits<Columns>...>
+    {
+        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
+
+        //
+    };
+
+    // the order columns are laid out in a table's buffer; values[n] is the index of the n-th column in memory
+    template <size_t N>
+    struct column_storage_order
+    {
+        size_t values[N];
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t operator[](size_t position) const noexcept
+        {
+            return values[position];
+        }
+    };
+
+    template <size_t N>
+    SOAGEN_CONST_GETTER
+    constexpr column_storage_order<N> make_column_storage_order(const size_t (&alignments)[N], bool reorder) noexcept
+    {
+        column_storage_order<N> order{};
+        for (size_t i = 0; i < N; i++)
+            order.values[i] = i;
+
+        // stable insertion sort, most-aligned first (ties keep their declared order)
+        if (reorder)
+        {
+            for (size_t i = 1; i < N; i++)
+            {
+                const auto col = order.values[i];
+                size_t j       = i;
+                for (; j > 0u && alignments[order.values[j - 1u]] < alignments[col]; j--)
+                    order.values[j] = order.values[j - 1u];
+                order.values[j] = col;
+            }
+        }
+        return order;
+    }
+}
+
+namespace soagen
+{
+    template <typename... Columns>
+    struct SOAGEN_EMPTY_BASES table_traits //
+        SOAGEN_HIDDEN_BASE(public detail::table_traits_base_specialized<std::make_index_sequence<sizeof...(Columns)>,
+                                                                        detail::as_column<Columns>...>)
+    {
+        static constexpr size_t column_count = sizeof...(Columns);
+        static_assert(column_count, "tables must have at least one column");
+
+        static constexpr size_t aligned_stride = lcm(size_t{ 1 }, detail::as_column<Columns>::aligned_stride...);
+
+        // columns
+        // (note that these hide the base class typedefs - this is intentional)
+
+        template <auto Index>
+        using column =
+            detail::type_at_index<static_cast<size_t>(Index), detail::as_column<Columns>...>;
+
+        template <typename IndexConstant>
+        using column_from_ic =
+            detail::type_at_index<static_cast<size_t>(detail::remove_cvref<IndexConstant>::value),
+                                  detail::as_column<Columns>...>;
+
+        static constexpr size_t column_alignments[column_count] = { detail::as_column<Columns>::alignment... };
+
+        static constexpr size_t largest_alignment = max(size_t{ 1 }, detail::as_column<Columns>::alignment...);
+
+        static constexpr detail::column_storage_order<column_count> storage_order =
+            detail::make_column_storage_order(column_alignments, false);
+
+        static constexpr bool rvalues_are_distinct =
+            !(std::is_same_v<typename detail::as_column<Columns>::param_type,
+                                                        typename detail::as_column<Columns>::rvalue_type>
+                                         && ...);
+
+        template <typename BackingTable, typename... Args>
+        static constexpr bool emplace_back_is_nothrow =
+            detail::has_nothrow_emplace_back_member<BackingTable, Args...>::value;
+
+        template <typename BackingTable>
+        static constexpr bool push_back_is_nothrow =
+            emplace_back_is_nothrow<BackingTable, typename detail::as_column<Columns>::param_forward_type...>;
+
+        template <typename BackingTable>
+        static constexpr bool rvalue_push_back_is_nothrow =
+            emplace_back_is_nothrow<BackingTable, typename detail::as_column<Columns>::rvalue_forward_type...>;
+
+        template <typename BackingTable, typename Row>
+        static constexpr bool row_push_back_is_nothrow = emplace_back_is_nothrow<BackingTable, Row>;
+
+        template <typename BackingTable, typename... Args>
+        static constexpr bool emplace_is_nothrow =
+            detail::has_nothrow_emplace_member<BackingTable, std::size_t, Args...>::value;
+
+        template <typename BackingTable>
+        static constexpr bool insert_is_nothrow =
+            emplace_is_nothrow<BackingTable, typename detail::as_column<Columns>::param_forward_type...>;
+
+        template <typename BackingTable>
+        static constexpr bool rvalue_insert_is_nothrow =
+            emplace_is_nothrow<BackingTable, typename detail::as_column<Columns>::rvalue_forward_type...>;
+
+        template <typename BackingTable, typename Row>
+        static constexpr bool row_insert_is_nothrow = emplace_is_nothrow<BackingTable, Row>;
+    };
+
+    template <typename... Columns>
+    struct SOAGEN_EMPTY_BASES reordered_table_traits //
+        : public table_traits<Columns...>
+    {
+        static constexpr detail::column_storage_order<sizeof...(Columns)> storage_order =
+            detail::make_column_storage_order(table_traits<Columns...>::column_alignments, true);
+    };
+
+    namespace detail
+    {
+        template <typename>
+        struct is_table_traits_ : std::false_type
+        {};
+        template <typename... Columns>
+        struct is_table_traits_<table_traits<Columns...>> : std::true_type
+        {};
+        template <typename... Columns>
+        struct is_table_traits_<reordered_table_traits<Columns...>> : std::true_type
+        {};
+        template <typename... Columns>
+        struct is_table_traits_<detail::table_traits_base<Columns...>> : std::true_type
+        {};
+    }
+
+    template <typename T>
+    inline constexpr bool is_table_traits =
+        detail::is_table_traits_<std::remove_cv_t<T>>::value;
+}
+
+namespace soagen::detail
+{
+    template <typename... Columns>
+    struct to_base_traits_<table_traits<Columns...>>
+    {
+        using type = table_traits_base<to_base_traits<as_column<Columns>>...>;
+
+        static_assert(std::is_base_of_v<type, table_traits<Columns...>>);
+    };
+
+    template <typename... Columns>
+    struct to_base_traits_<reordered_table_traits<Columns...>> : to_base_traits_<table_traits<Columns...>>
+    {};
+}
+
+//********  mixins/rows.hpp  *******************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, typename...>
+    struct SOAGEN_EMPTY_BASES rows;
+
+    template <typename Derived, size_t... Columns>
+    struct SOAGEN_EMPTY_BASES rows<Derived, std::index_sequence<Columns...>>
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+        static_assert(std::is_same_v<column_indices<Derived>, std::index_sequence<Columns...>>);
+
+        using size_type       = std::size_t;
+        using row_type        = soagen::row_type<Derived>;
+        using rvalue_row_type = soagen::rvalue_row_type<Derived>;
+        using const_row_type  = soagen::const_row_type<Derived>;
+
+        template <auto... Cols>
+        SOAGEN_PURE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Derived, Cols...> row(size_type index) & noexcept
+        {
+            if constexpr (sizeof...(Cols))
+            {
+                return { static_cast<value_ref<Derived, Cols>>(
+                    static_cast<Derived&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
+            }
+            else
+            {
+                return { static_cast<value_ref<Derived, Columns>>(
+                    static_cast<Derived&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::rvalue_row_type<Derived, Cols...> row(size_type index) && noexcept
+        {
+#if SOAGEN_MSVC
+            // https://developercommunity.visualstudio.com/t/C:-Corrupt-references-when-creating-a/10446877
+            return static_cast<soagen::rvalue_row_type<Derived, Cols...>>(
+                static_cast<Derived&>(*this).template row<Cols...>(index));
+#else
+
+            if constexpr (sizeof...(Cols))
+            {
+                return { static_cast<value_ref<Derived&&, Cols>>(
+                    static_cast<Derived&&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
+            }
+            else
+            {
+                return { static_cast<value_ref<Derived&&, Columns>>(
+                    static_cast<Derived&&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
+            }
+#endif
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::const_row_type<Derived, Cols...> row(size_type index) const& noexcept
+        {
+            if constexpr (sizeof...(Cols))
+            {
+                return { static_cast<value_ref<const Derived, Cols>>(
+                    static_cast<const Derived&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
+            }
+            else
+            {
+                return { static_cast<value_ref<const Derived, Columns>>(
+                    static_cast<const Derived&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
+            }
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        row_type operator[](size_type index) & noexcept
+        {
+            return row(index);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        rvalue_row_type operator[](size_type index) && noexcept
+        {
+            return static_cast<rows&&>(*this).row(index);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        const_row_type operator[](size_type index) const& noexcept
+        {
+            return row(index);
+        }
+
+#if SOAGEN_HAS_EXCEPTIONS
+
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Derived, Cols...> at(size_type index) &
+        {
+            if (index >= static_cast<const Derived&>(*this).size())
+                throw std::out_of_range{ "bad element access" };
+            return row<static_cast<size_type>(Cols)...>(index);
+        }
+
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        SOAGEN_CONSTEXPR_20
+        soagen::rvalue_row_type<Derived, Cols...> at(size_type index) &&
+        {
+            if (index >= static_cast<const Derived&>(*this).size())
+                throw std::out_of_range{ "bad element access" };
+
+            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(index);
+        }
+
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        SOAGEN_CONSTEXPR_20
+        soagen::const_row_type<Derived, Cols...> at(size_type index) const&
+        {
+            if (index >= static_cast<const Derived&>(*this).size())
+                throw std::out_of_range{ "bad element access" };
+            return row<static_cast<size_type>(Cols)...>(index);
+        }
+
+#endif
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Derived, Cols...> front() & noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(0u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::row_type<Derived, Cols...> back() & noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(static_cast<const Derived&>(*this).size() - 1u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::rvalue_row_type<Derived, Cols...> front() && noexcept
+        {
+            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(0u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::rvalue_row_type<Derived, Cols...> back() && noexcept
+        {
+            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(
+                static_cast<const Derived&>(*this).size() - 1u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::const_row_type<Derived, Cols...> front() const& noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(0u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        soagen::const_row_type<Derived, Cols...> back() const& noexcept
+        {
+            return row<static_cast<size_type>(Cols)...>(static_cast<const Derived&>(*this).size() - 1u);
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES rows<Derived> : rows<Derived, column_indices<Derived>>
+    {};
+}
+
+//********  source_offset.hpp  *****************************************************************************************
+
+#define SOAGEN_DETECT_INTEGER(name, trait)                                                                             \
+    template <typename T>                                                                                              \
+    using name##_trait_ = decltype(trait);                                                                             \
+    template <typename T, bool = is_detected<name##_trait_, T>::value>                                                 \
+    struct name##_ : std::disjunction<std::is_integral<detail::remove_cvref<decltype(trait)>>,                         \
+                                      std::is_enum<detail::remove_cvref<decltype(trait)>>,                             \
+                                      std::is_constructible<std::size_t, decltype(trait)>>                             \
+    {};                                                                                                                \
+    template <typename T>                                                                                              \
+    struct name##_<T, false> : std::false_type                                                                         \
+    {}
+
+namespace soagen
+{
+    namespace detail
+    {
+        // static function T::source_offset()
+        SOAGEN_DETECT_INTEGER(has_source_offset_static_func, detail::remove_cvref<T>::source_offset());
+
+        // static var T::source_offset
+        SOAGEN_DETECT_INTEGER(has_source_offset_static_var, detail::remove_cvref<T>::source_offset);
+
+        // member function t.source_offset()
+        SOAGEN_DETECT_INTEGER(has_source_offset_member_func, std::declval<const T&>().source_offset());
+
+        // member var t.source_offset
+        SOAGEN_DETECT_INTEGER(has_source_offset_member_var,
+                              std::declval<const T&>().*(&detail::remove_cvref<T>::source_offset));
+
+        // ADL
+        namespace adl_dummy
+        {
+            void source_offset();
+            template <typename T>
+            using has_source_offset_adl_trait_ = decltype(source_offset(std::declval<const T&>()));
+        }
+        template <typename T>
+        using has_source_offset_adl_ = is_detected<adl_dummy::has_source_offset_adl_trait_, T>;
+    }
+
+    template <typename T>
+    inline constexpr bool has_source_offset =
+        std::disjunction_v<detail::has_source_offset_static_func_<T>,
+                                                      detail::has_source_offset_member_func_<T>,
+                                                      detail::has_source_offset_member_var_<T>,
+                                                      detail::has_source_offset_static_var_<T>,
+                                                      detail::has_source_offset_adl_<T>>;
+
+    template <typename T>
+    SOAGEN_PURE_INLINE_GETTER
+    constexpr std::size_t get_source_offset([[maybe_unused]] const T& object) noexcept
+    {
+        // note that order is important here -
+        // we have to try to detect member functions and vars before static vars
+
+        if constexpr (detail::has_source_offset_static_func_<T>::value)
+        {
+            return static_cast<size_t>(detail::remove_cvref<T>::source_offset());
+        }
+        else if constexpr (detail::has_source_offset_member_func_<T>::value)
+        {
+            return static_cast<size_t>(object.source_offset());
+        }
+        else if constexpr (detail::has_source_offset_member_var_<T>::value)
+        {
+            return static_cast<size_t>(object.source_offset);
+        }
+        else if constexpr (detail::has_source_offset_static_var_<T>::value)
+        {
+            return static_cast<size_t>(detail::remove_cvref<T>::source_offset);
+        }
+        else if constexpr (detail::has_source_offset_adl_<T>::value)
+        {
+            using detail::adl_dummy::source_offset;
+            return static_cast<size_t>(source_offset(object));
+        }
+        else
+            return {};
+    }
+}
+
+#undef SOAGEN_DETECT_INTEGER
+
+//********  mixins/iterators.hpp  **************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES iterators
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using difference_type = std::ptrdiff_t;
+        using iterator        = soagen::iterator_type<Derived>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<Derived>;
+        using const_iterator  = soagen::const_iterator_type<Derived>;
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator_type<Derived, Cols...> begin() & noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&>(*this), 0 };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator_type<Derived, Cols...> end() & noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&>(*this),
+                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
+                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr rvalue_iterator_type<Derived, Cols...> begin() && noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&&>(*this), 0 };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr rvalue_iterator_type<Derived, Cols...> end() && noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&&>(*this),
+                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
+                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const_iterator_type<Derived, Cols...> begin() const& noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<const Derived&>(*this), 0 };
+            }
+            else
+            {
+                return { static_cast<const soa_type<Derived>&>(static_cast<const Derived&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const_iterator_type<Derived, Cols...> end() const& noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<const Derived&>(*this),
+                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+            else
+            {
+                return { static_cast<const soa_type<Derived>&>(static_cast<Derived&&>(*this)),
+                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
+                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
+            }
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const_iterator_type<Derived, Cols...> cbegin() const noexcept
+        {
+            return begin<Cols...>();
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const_iterator_type<Derived, Cols...> cend() const noexcept
+        {
+            return end<Cols...>();
+        }
+    };
+}
+
+//********  mixins/spans.hpp  ******************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES spans
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using size_type        = std::size_t;
+        using span_type        = soagen::span_type<Derived>;
+        using rvalue_span_type = soagen::rvalue_span_type<Derived>;
+        using const_span_type  = soagen::const_span_type<Derived>;
+
+        SOAGEN_PURE_INLINE_GETTER
+        span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) & noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&>(*this), start, count };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
+                         get_source_offset(static_cast<const Derived&>(*this)) + start,
+                         detail::calc_span_count(start,
+                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
+                                                 count) };
+            }
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        rvalue_span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) && noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<Derived&&>(*this), start, count };
+            }
+            else
+            {
+                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
+                         get_source_offset(static_cast<const Derived&>(*this)) + start,
+                         detail::calc_span_count(start,
+                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
+                                                 count) };
+            }
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const_span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) const& noexcept
+        {
+            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
+            {
+                return { static_cast<const Derived&>(*this), start, count };
+            }
+            else
+            {
+                return { static_cast<const soa_type<Derived>&>(static_cast<const Derived&>(*this)),
+                         get_source_offset(static_cast<const Derived&>(*this)) + start,
+                         detail::calc_span_count(start,
+                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
+                                                 count) };
+            }
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const_span_type const_subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
+        {
+            return subspan(start, count);
+        }
+    };
+}
+
+//********  table.hpp  *************************************************************************************************
+
+namespace soagen::detail
+{
+    SOAGEN_CONSTRAINED_TEMPLATE(detail::is_unsigned<T>::value, typename T)
+    SOAGEN_NODISCARD
+    constexpr bool add_without_overflowing(T lhs, T rhs, T& result) noexcept
+    {
+        if (lhs > static_cast<T>(-1) - rhs)
+            return false;
+
+        result = lhs + rhs;
+        return true;
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // generic allocation classes for tracking the column pointers and the actual size in bytes
+    //------------------------------------------------------------------------------------------------------------------
+
+    struct table_allocation_base
+    {
+        std::byte* ptr;
+        size_t size;
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator bool() const noexcept
+        {
+            return !!ptr;
+        }
+    };
+
+    template <size_t ColumnCount>
+    struct table_allocation : table_allocation_base
+    {
+        std::byte* columns[ColumnCount];
+
+        // per-column sizes in bytes of the separate allocations holding columns that were exchanged with another
+        // table (see soagen::exchange_column()), zero for columns still in the main buffer. allocated by the first
+        // exchange, so tables that never exchange columns only pay for the null pointer.
+        size_t* separate;
+
+        // the main buffer plus any separately-held columns
+        SOAGEN_PURE_GETTER
+        constexpr size_t total_size() const noexcept
+        {
+            size_t total = size;
+            if (separate)
+            {
+                for (size_t i = 0; i < ColumnCount; i++)
+                    total += separate[i];
+            }
+            return total;
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // base class for handling allocation and deallocation
+    //------------------------------------------------------------------------------------------------------------------
+
+    template <typename Allocator>
+    class SOAGEN_EMPTY_BASES table_allocate //
+    {
+        static_assert(!detail::is_cvref<Allocator>::value, "allocators may not be cvref-qualified");
+
+      public:
+        using allocator_type = Allocator;
+
+      protected:
+        static constexpr bool allocate_is_nothrow =
+            noexcept(allocator_traits<Allocator>::allocate(std::declval<Allocator&>(), size_t{}, std::align_val_t{}));
+
+        // guard against allocators with incorrect pointer typedefs where possible
+        using allocator_pointer_type = std::remove_reference_t<
+            decltype(allocator_traits<Allocator>::allocate(std::declval<Allocator&>(), size_t{}, std::align_val_t{}))>;
+        static_assert(std::is_pointer_v<allocator_pointer_type>);
+
+        SOAGEN_NODISCARD
+        SOAGEN_NEVER_INLINE
+        constexpr table_allocation_base allocate(allocator_type& alloc,
+                                                 size_t size,
+                                                 size_t alignment) noexcept(allocate_is_nothrow)
+        {
+            SOAGEN_ASSUME(size);
+            SOAGEN_ASSUME((static_cast<size_t>(alignment) & (static_cast<size_t>(alignment) - 1u)) == 0u);
+
+            const auto ptr = soagen::assume_aligned<allocator_traits<Allocator>::min_alignment>(
+                allocator_traits<Allocator>::allocate(
+                    alloc,
+                    size,
+                    std::align_val_t{ max(alignment, allocator_traits<Allocator>::min_alignment) }));
+
+            SOAGEN_ASSUME(ptr != nullptr);
+
+            if constexpr (std::is_same_v<allocator_pointer_type, std::byte*>)
+                return { ptr, size };
+            else
+                return { reinterpret_cast<std::byte*>(ptr), size };
+        }
+
+        SOAGEN_NEVER_INLINE
+        constexpr void deallocate(allocator_type& alloc, const table_allocation_base& al) noexcept
+        {
+            if constexpr (std::is_same_v<allocator_pointer_type, std::byte*>)
+                allocator_traits<Allocator>::deallocate(alloc, al.ptr, al.size);
+            else
+                allocator_traits<Allocator>::deallocate(alloc,
+                                                        reinterpret_cast<allocator_pointer_type>(al.ptr),
+                                                        al.size);
+        }
+
+        template <size_t ColumnCount>
+        constexpr void deallocate(allocator_type& alloc, const table_allocation<ColumnCount>& al) noexcept
+        {
+            if SOAGEN_UNLIKELY(al.separate)
+            {
+                for (size_t i = 0; i < ColumnCount; i++)
+                    if (al.separate[i])
+                        deallocate(alloc, table_allocation_base{ al.columns[i], al.separate[i] });
+
+                deallocate(alloc,
+                           table_allocation_base{ reinterpret_cast<std::byte*>(al.separate),
+                                                  sizeof(size_t) * ColumnCount });
+            }
+
+            deallocate(alloc, static_cast<const table_allocation_base&>(al));
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // base class for handling general boilerplate
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_allocate
+#undef SOAGEN_BASE_TYPE
+#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Allocator>
+
+    struct table_storage_access;
+
+    template <size_t ColumnCount, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_storage //
+        : public SOAGEN_BASE_TYPE
+    {
+        static_assert(ColumnCount, "tables must have at least one column");
+
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+        friend struct table_storage_access;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using allocator_type  = Allocator;
+
+      protected:
+        using allocation = table_allocation<ColumnCount>;
+
+        allocation alloc_ = {};
+        size_t count_     = {};
+        compressed_pair<size_t, Allocator> capacity_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        explicit constexpr table_storage(const Allocator& alloc) noexcept //
+            : capacity_{ size_t{}, alloc }
+        {
+            static_assert(std::is_nothrow_copy_constructible_v<Allocator>,
+                          "allocators must be nothrow copy-constructible");
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        explicit constexpr table_storage(Allocator&& alloc) noexcept //
+            : capacity_{ size_t{}, static_cast<Allocator&&>(alloc) }
+        {
+            static_assert(std::is_nothrow_move_constructible_v<Allocator>,
+                          "allocators must be nothrow move-constructible");
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr table_storage(table_storage&& other) noexcept //
+            : alloc_{ std::exchange(other.alloc_, allocation{}) },
+              count_{ std::exchange(other.count_, size_t{}) },
+              capacity_{ std::exchange(other.capacity_.first(), size_t{}), static_cast<Allocator&&>(other.allocator()) }
+        {
+            static_assert(std::is_nothrow_move_constructible_v<Allocator>,
+                          "allocators must be nothrow move-constructible");
+        }
+
+        // conditionally-implemented in specialized child classes:
+        table_storage()                                = delete;
+        table_storage& operator=(table_storage&&)      = delete;
+        table_storage(const table_storage&)            = delete;
+        table_storage& operator=(const table_storage&) = delete;
+
+        ~table_storage() noexcept
+        {
+            static_assert(std::is_nothrow_destructible_v<Allocator>, "allocators must be nothrow destructible");
+
+            // element destructors are run in a more specialized child class
+
+            if (alloc_)
+                base::deallocate(allocator(), alloc_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t size() const noexcept
+        {
+            return count_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool empty() const noexcept
+        {
+            return !count_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t capacity() const noexcept
+        {
+            return capacity_.first();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t allocation_size() const noexcept
+        {
+            return alloc_.size;
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        Allocator get_allocator() const noexcept
+        {
+            return capacity_.second();
+        }
+
+      protected:
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr Allocator& allocator() noexcept
+        {
+            return capacity_.second();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const Allocator& allocator() const noexcept
+        {
+            return capacity_.second();
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // raw storage access for non-member machinery that needs to alias external memory (e.g. soagen::mapped)
+    //------------------------------------------------------------------------------------------------------------------
+
+    struct table_storage_access
+    {
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr const table_allocation<ColumnCount>& allocation(
+            const table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.alloc_;
+        }
+
+        // points an empty table at externally-owned memory; the table must be released before it is destroyed
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void adopt(table_storage<ColumnCount, Allocator>& tbl,
+                                    const table_allocation<ColumnCount>& alloc,
+                                    size_t count,
+                                    size_t capacity) noexcept
+        {
+            SOAGEN_ASSUME(!tbl.alloc_);
+            SOAGEN_ASSUME(count <= capacity);
+
+            tbl.alloc_            = alloc;
+            tbl.count_            = count;
+            tbl.capacity_.first() = capacity;
+        }
+
+        // sets the row count directly; the caller is responsible for the elements in [0, count) having been written
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void set_size(table_storage<ColumnCount, Allocator>& tbl, size_t count) noexcept
+        {
+            SOAGEN_ASSUME(count <= tbl.capacity_.first());
+
+            tbl.count_ = count;
+        }
+
+        // mutable access to the column pointers, for machinery that re-homes individual columns
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr table_allocation<ColumnCount>& allocation(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.alloc_;
+        }
+
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr Allocator& allocator(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.allocator();
+        }
+
+        // detaches a table from its storage without destroying elements or deallocating
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void release(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            tbl.alloc_            = {};
+            tbl.count_            = {};
+            tbl.capacity_.first() = {};
+        }
+    };
+
+#if SOAGEN_INSTRUMENT
+
+    template <typename Table>
+    size_t table_allocation_bytes(const Table& tbl) noexcept
+    {
+        return table_storage_access::allocation(tbl).total_size();
+    }
+
+#endif
+
+    //------------------------------------------------------------------------------------------------------------------
+    // generated types with indexes or handles keep them in sync from their own members; machinery that writes rows
+    // through table_storage_access bypasses them, so has to rebuild them afterwards (or reject such types)
+    //------------------------------------------------------------------------------------------------------------------
+
+    template <typename T>
+    using has_rebuild_indexes_ = decltype(std::declval<T&>().rebuild_indexes());
+
+    template <typename T>
+    using has_rebuild_handles_ = decltype(std::declval<T&>().rebuild_handles());
+
+    template <typename Soa>
+    inline constexpr bool has_row_observers =
+        is_detected<has_rebuild_indexes_, Soa>::value || is_detected<has_rebuild_handles_, Soa>::value;
+
+    // brings the indexes and handles back in line with rows written directly into the table;
+    // if that fails the container is cleared, so it's never left holding rows its observers don't know about
+    template <typename Soa>
+    void rebuild_row_observers(Soa& soa)
+    {
+        if constexpr (has_row_observers<Soa>)
+        {
+            SOAGEN_TRY
+            {
+                if constexpr (is_detected<has_rebuild_handles_, Soa>::value)
+                    soa.rebuild_handles();
+                if constexpr (is_detected<has_rebuild_indexes_, Soa>::value)
+                    soa.rebuild_indexes();
+            }
+#if SOAGEN_HAS_EXCEPTIONS
+            catch (...)
+            {
+                soa.clear();
+                throw;
+            }
+#endif
+        }
+    }
+
+    // as above, for machinery that only rewrites column values in place; rows keep their positions, so handles don't
+    // need reissuing
+    template <typename Soa>
+    void rebuild_value_indexes(Soa& soa)
+    {
+        if constexpr (is_detected<has_rebuild_indexes_, Soa>::value)
+        {
+            SOAGEN_TRY
+            {
+                soa.rebuild_indexes();
+            }
+#if SOAGEN_HAS_EXCEPTIONS
+            catch (...)
+            {
+                soa.clear();
+                throw;
+            }
+#endif
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: default-constructibility
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_storage
+#undef SOAGEN_BASE_TYPE
+#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<ColumnCount, Allocator>
+
+    template <size_t ColumnCount,
+              typename Allocator,
+              bool = std::is_default_constructible_v<Allocator>>
+    class SOAGEN_EMPTY_BASES table_default_construct //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FOUR(table_default_construct);
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr table_default_construct() noexcept //
+            : SOAGEN_BASE_TYPE{ Allocator{} }
+        {
+            static_assert(std::is_nothrow_default_constructible_v<Allocator>,
+                          "allocators must be nothrow default-constructible, or not default-constructible at all");
+        }
+    };
+
+    template <size_t ColumnCount, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_default_construct<ColumnCount, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_construct);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: move-assignment (un-typed base parts only)
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_default_construct
+
+    template <size_t ColumnCount,
+              typename Allocator,
+              bool = !allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+                  || std::is_move_assignable_v<Allocator>>
+    class SOAGEN_EMPTY_BASES table_move_assignable_base //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      protected:
+        using allocation = table_allocation<ColumnCount>;
+
+        constexpr bool move_from_by_taking_ownership(table_move_assignable_base&& rhs) noexcept
+        {
+            SOAGEN_ASSUME(&rhs != this);
+
+            const auto take_ownership = [&]() noexcept
+            {
+                if (base::alloc_)
+                    base::deallocate(base::allocator(), base::alloc_);
+
+                base::alloc_            = std::exchange(rhs.alloc_, allocation{});
+                base::count_            = std::exchange(rhs.count_, size_t{});
+                base::capacity_.first() = std::exchange(rhs.capacity_.first(), size_t{});
+
+                if constexpr (allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+                {
+                    static_assert(std::is_nothrow_move_assignable_v<Allocator>,
+                                  "move-propagated allocators must be nothrow move-assignable");
+
+                    base::allocator() = static_cast<Allocator&&>(rhs.allocator());
+                }
+            };
+
+            if constexpr (allocator_traits<Allocator>::container_move_assign_always_takes_ownership)
+            {
+                take_ownership();
+                return true;
+            }
+            else
+            {
+                if (allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
+                {
+                    take_ownership();
+                    return true;
+                }
+
+                // if they compare non-equal then we need to do elementwise move-assignment,
+                // which can't be implemented at this untyped level - must be implemented as part of a more specialized
+                // child class.
+
+                return false;
+            }
+        }
+
+        template <typename T>
+        constexpr bool move_from_by_taking_ownership(T&& rhs, std::true_type) noexcept
+        {
+            return move_from_by_taking_ownership(static_cast<table_move_assignable_base&&>(rhs));
+        }
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        table_move_assignable_base()                                             = default;
+        table_move_assignable_base(table_move_assignable_base&&)                 = default;
+        table_move_assignable_base(const table_move_assignable_base&)            = default;
+        table_move_assignable_base& operator=(const table_move_assignable_base&) = default;
+
+        constexpr table_move_assignable_base& operator=(table_move_assignable_base&& rhs) noexcept
+        {
+            if SOAGEN_LIKELY(&rhs != this)
+                move_from_by_taking_ownership(static_cast<table_move_assignable_base&&>(rhs));
+            return *this;
+        }
+    };
+
+    template <size_t ColumnCount, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_move_assignable_base<ColumnCount, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_move_assignable_base);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: swap
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_move_assignable_base
+
+    template <size_t ColumnCount,
+              typename Allocator,
+              bool = !allocator_traits<Allocator>::propagate_on_container_swap::value || std::is_swappable_v<Allocator>>
+    class SOAGEN_EMPTY_BASES table_swap //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_swap);
+
+        constexpr void swap(table_swap& other) noexcept
+        {
+            if SOAGEN_UNLIKELY(&other == this)
+                return;
+
+            if constexpr (!allocator_traits<Allocator>::propagate_on_container_swap::value
+                          && !allocator_traits<Allocator>::is_always_equal::value)
+            {
+                SOAGEN_ASSERT(base::allocator() == other.allocator()
+                              && "allocators must compare equal in a non-propagating swap");
+            }
+
+            using std::swap;
+            swap(base::alloc_, other.alloc_);
+            swap(base::count_, other.count_);
+            swap(base::capacity_.first(), other.capacity_.first());
+
+            if constexpr (allocator_traits<Allocator>::propagate_on_container_swap::value)
+            {
+                static_assert(std::is_nothrow_swappable_v<Allocator>,
+                              "swap-propagated allocators must be nothrow-swappable");
+
+                swap(base::allocator(), other.allocator());
+            }
+        }
+    };
+
+    template <size_t ColumnCount, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_swap<ColumnCount, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_swap);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: typed base
+    //
+    // note: specializations from here down take the full Traits, not just the ColumnCount
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_swap
+#undef SOAGEN_BASE_TYPE
+#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Traits::column_count, Allocator>
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_typed_base //
+        :
+#if SOAGEN_INSTRUMENT
+          public table_registration<table<Traits, Allocator>>, // first, see table_registration
+#endif
+          public SOAGEN_BASE_TYPE
+    {
+      private:
+        using table_type  = table<Traits, Allocator>;
+        using allocation  = table_allocation<Traits::column_count>;
+        using column_ends = size_t[Traits::column_count];
+        using base        = SOAGEN_BASE_TYPE;
+
+        // ends are in storage order (Traits::storage_order), not column order
+        static constexpr void calc_column_ends(column_ends& ends, size_t capacity) noexcept
+        {
+            // pad ends so the next column starts at the right alignment for the storage type
+            size_t prev = {};
+            for (size_t i = 0; i < Traits::column_count - 1u; i++)
+            {
+                const auto next = Traits::storage_order[i + 1u];
+                auto align      = max(Traits::column_alignments[next], min_actual_column_alignment);
+
+                // large columns start on the allocator's column_alignment boundary (e.g. a page), if it has one
+                if constexpr (allocator_traits<Allocator>::column_alignment > 0u)
+                {
+                    if (Traits::column_sizes[next] * capacity >= allocator_traits<Allocator>::column_alignment)
+                        align = max(align, allocator_traits<Allocator>::column_alignment);
+                }
+
+                ends[i] = prev + Traits::column_sizes[Traits::storage_order[i]] * capacity;
+                ends[i] = (ends[i] + align - 1u) & ~(align - 1u);
+                prev    = ends[i];
+            }
+
+            // last end doesn't need to be aligned (it's just the total buffer size)
+            ends[Traits::column_count - 1u] =
+                prev + Traits::column_sizes[Traits::storage_order[Traits::column_count - 1u]] * capacity;
+        }
+
+        SOAGEN_NODISCARD
+        constexpr allocation allocate(const column_ends& ends) noexcept(base::allocate_is_nothrow)
+        {
+            SOAGEN_ASSUME(ends[Traits::column_count - 1u]);
+
+            allocation alloc = {
+                base::allocate(base::allocator(), ends[Traits::column_count - 1u], buffer_alignment<table_type>),
+                {}
+            };
+            SOAGEN_ASSUME(alloc.ptr);
+            SOAGEN_ASSUME(alloc.size == ends[Traits::column_count - 1u]);
+
+            // columns are laid out in storage order (see table_traits::storage_order)
+            const auto first                        = soagen::assume_aligned<buffer_alignment<table_type>>(alloc.ptr);
+            alloc.columns[Traits::storage_order[0]] = first;
+            for (size_t i = 1; i < Traits::column_count; i++)
+                alloc.columns[Traits::storage_order[i]] = first + ends[i - 1u];
+
+            return alloc;
+        }
+
+        SOAGEN_CONSTEXPR_20
+        SOAGEN_NEVER_INLINE
+        void adjust_capacity(size_t new_capacity) noexcept(
+            base::allocate_is_nothrow
+            && (Traits::all_nothrow_move_or_copy_constructible
+                || (Traits::all_nothrow_default_constructible && Traits::all_nothrow_move_or_copy_assignable)
+                || Traits::all_nothrow_copy_constructible
+                || (Traits::all_nothrow_default_constructible && Traits::all_nothrow_copy_assignable)))
+        {
+            SOAGEN_ASSUME(new_capacity);
+            SOAGEN_ASSUME(new_capacity >= base::count_);
+
+            if SOAGEN_UNLIKELY(new_capacity == base::capacity())
+                return;
+
+#if SOAGEN_INSTRUMENT
+            const detail::table_event_timer timer;
+            const auto old_capacity = base::capacity();
+            const auto old_bytes    = base::alloc_ ? base::alloc_.total_size() : size_t{};
+#endif
+
+            // get new ends
+            column_ends new_ends{};
+            calc_column_ends(new_ends, new_capacity);
+
+            // alloc + move
+            auto new_alloc = allocate(new_ends);
+            SOAGEN_ASSERT(new_alloc);
+            if (base::count_)
+            {
+                SOAGEN_ASSERT(base::alloc_);
+
+                // this looks a bit convoluted and is probably worth an explainer:
+                // we really, really, _really_ don't want reserve() and shrink_to_fit() to throw if we can avoid it,
+                // since it potentially leaves the container in a sliced state (i.e. some elements were moved already
+                // when an exception is raised), so we're moving or copying the elements according to the 'most nothrow'
+                // path that still fulfills the brief.
+
+                if constexpr (Traits::all_trivially_copyable)
+                {
+                    // the old and new buffers never overlap, and most of what's copied won't be touched again soon
+                    Traits::memcpy(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else if constexpr (Traits::all_nothrow_move_or_copy_constructible)
+                {
+                    Traits::move_or_copy_construct_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else if constexpr (Traits::all_nothrow_default_constructible
+                                   && Traits::all_nothrow_move_or_copy_assignable)
+                {
+                    Traits::default_construct_rows(new_alloc.columns, {}, base::count_);
+                    Traits::move_or_copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else if constexpr (Traits::all_nothrow_copy_constructible)
+                {
+                    Traits::copy_construct_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else if constexpr (Traits::all_nothrow_default_constructible && Traits::all_nothrow_copy_assignable)
+                {
+                    Traits::default_construct_rows(new_alloc.columns, {}, base::count_);
+                    Traits::copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else
+                {
+                    [[maybe_unused]]
+                    bool needs_destruct = false;
+
+                    SOAGEN_TRY
+                    {
+                        if constexpr (Traits::all_move_or_copy_constructible)
+                        {
+                            Traits::move_or_copy_construct_rows(new_alloc.columns,
+                                                                {},
+                                                                base::alloc_.columns,
+                                                                {},
+                                                                base::count_); // strong
+                        }
+                        else if constexpr (Traits::all_default_constructible && Traits::all_move_or_copy_assignable)
+                        {
+                            Traits::default_construct_rows(new_alloc.columns, {}, base::count_); // strong
+                            needs_destruct = !Traits::all_trivially_destructible;
+                            Traits::move_or_copy_assign_rows(new_alloc.columns,
+                                                             {},
+                                                             base::alloc_.columns,
+                                                             {},
+                                                             base::count_);
+                        }
+                        else if constexpr (Traits::all_copy_constructible)
+                        {
+                            Traits::copy_construct_rows(new_alloc.columns,
+                                                        {},
+                                                        base::alloc_.columns,
+                                                        {},
+                                                        base::count_); // strong
+                        }
+                        else if constexpr (Traits::all_default_constructible && Traits::all_copy_assignable)
+                        {
+                            Traits::default_construct_rows(new_alloc.columns, {}, base::count_); // strong
+                            needs_destruct = !Traits::all_trivially_destructible;
+                            Traits::copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                        }
+                    }
+#if SOAGEN_HAS_EXCEPTIONS
+                    catch (...)
+                    {
+                        if (needs_destruct)
+                            Traits::destruct_rows(new_alloc.columns, {}, base::count_);
+                        base::deallocate(base::allocator(), new_alloc);
+                        throw;
+                    }
+#endif
+                }
+
+                if constexpr (!Traits::all_trivially_destructible)
+                {
+                    Traits::destruct_rows(base::alloc_.columns, {}, base::count_);
+                }
+            }
+            if (base::alloc_)
+                base::deallocate(base::allocator(), base::alloc_);
+            base::alloc_            = new_alloc;
+            base::capacity_.first() = new_capacity;
+
+#if SOAGEN_INSTRUMENT
+            detail::raise_table_event<table_type, Traits>(!old_capacity                ? table_event::allocate
+                                                          : new_capacity > old_capacity ? table_event::reallocate
+                                                                                        : table_event::shrink,
+                                                          this,
+                                                          old_capacity,
+                                                          new_capacity,
+                                                          old_bytes,
+                                                          new_alloc.size,
+                                                          base::count_,
+                                                          timer.elapsed());
+#endif
+        }
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_typed_base);
+
+#if SOAGEN_INSTRUMENT
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = has_swap_member<base>::value)
+        void swap(table_typed_base& other) noexcept
+        {
+            if SOAGEN_LIKELY(&other != this)
+                this->raise_swap_with(other);
+            base::swap(other);
+        }
+#endif
+
+        ~table_typed_base() noexcept
+        {
+            clear();
+
+#if SOAGEN_INSTRUMENT
+            if (base::alloc_)
+                detail::raise_table_event<table_type, Traits>(table_event::deallocate,
+                                                              this,
+                                                              base::capacity(),
+                                                              0u,
+                                                              base::alloc_.total_size(),
+                                                              0u,
+                                                              0u,
+                                                              0u);
+#endif
+        }
+
+        SOAGEN_RESETTER
+        constexpr void clear() noexcept
+        {
+            if constexpr (!Traits::all_trivially_destructible)
+            {
+                static_assert(Traits::all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+
+                if (base::count_)
+                    Traits::destruct_rows(base::alloc_.columns, {}, base::count_);
+            }
+            base::count_ = {};
+        }
+
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        void reserve(size_t new_capacity) noexcept(noexcept(this->adjust_capacity(size_t{})))
+        {
+            if SOAGEN_UNLIKELY(!new_capacity)
+                return;
+
+            if constexpr (Traits::aligned_stride > 1)
+            {
+                if (const size_t rem = new_capacity % Traits::aligned_stride; rem > 0u)
+                {
+                    static_cast<void>(
+                        add_without_overflowing(new_capacity, Traits::aligned_stride - rem, new_capacity));
+                }
+            }
+
+            if SOAGEN_UNLIKELY(new_capacity > max_capacity)
+                SOAGEN_THROW(std::bad_alloc{});
+
+            if (new_capacity <= base::capacity())
+                return;
+
+            adjust_capacity(new_capacity);
+        }
+
+        SOAGEN_NEVER_INLINE
+        SOAGEN_CONSTEXPR_20
+        void shrink_to_fit() noexcept(noexcept(this->adjust_capacity(size_t{})))
+        {
+            if (!base::count_)
+            {
+                if (base::alloc_)
+                {
+#if SOAGEN_INSTRUMENT
+                    const detail::table_event_timer timer;
+                    const auto old_capacity = base::capacity();
+                    const auto old_bytes    = base::alloc_.total_size();
+#endif
+                    base::deallocate(base::allocator(), base::alloc_);
+                    base::alloc_            = {};
+                    base::capacity_.first() = {};
+#if SOAGEN_INSTRUMENT
+                    detail::raise_table_event<table_type, Traits>(table_event::deallocate,
+                                                                  this,
+                                                                  old_capacity,
+                                                                  0u,
+                                                                  old_bytes,
+                                                                  0u,
+                                                                  0u,
+                                                                  timer.elapsed());
+#endif
+                }
+                return;
+            }
+
+            auto new_capacity = base::count_;
+            if constexpr (Traits::aligned_stride > 1)
+            {
+                if (const size_t rem = new_capacity % Traits::aligned_stride; rem > 0u)
+                {
+                    static_cast<void>(
+                        add_without_overflowing(new_capacity, Traits::aligned_stride - rem, new_capacity));
+                }
+            }
+            if (new_capacity >= base::capacity())
+                return;
+
+            adjust_capacity(new_capacity);
+        }
+
+        SOAGEN_CONSTEXPR_20
+        void pop_back(size_t num = 1) noexcept
+        {
+            static_assert(Traits::all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+
+            num = min(base::count_, num);
+            if constexpr (!Traits::all_trivially_destructible)
+            {
+                Traits::destruct_rows(base::alloc_.columns, base::count_ - num, num);
+            }
+            base::count_ -= num;
+        }
+
+      public:
+        static constexpr size_t max_capacity = []() -> size_t
+        {
+            if constexpr (Traits::column_count == 1)
+            {
+                return static_cast<size_t>(-1) / Traits::column_sizes[0];
+            }
+            else
+            {
+                // todo: i'm sure there's a smarter way to do this
+
+                constexpr auto capacity_ok = [](size_t cap) noexcept
+                {
+                    size_t buf_end = {};
+                    for (size_t i = 0u; i < Traits::column_count; i++)
+                    {
+                        const auto col = Traits::storage_order[i];
+                        if (i)
+                        {
+                            const auto align = max(Traits::column_alignments[col], min_actual_column_alignment);
+
+                            if (const size_t rem = buf_end % align; rem > 0u)
+                            {
+                                if (!add_without_overflowing(buf_end, align - rem, buf_end))
+                                    return false;
+                            }
+                        }
+                        if (!add_without_overflowing(buf_end, Traits::column_sizes[col] * cap, buf_end))
+                            return false;
+                    }
+                    return true;
+                };
+
+                size_t lower  = static_cast<size_t>(-1);
+                size_t higher = lower;
+                while (lower && !capacity_ok(lower))
+                {
+                    higher = lower;
+                    lower /= 16u;
+                }
+                if (!lower)
+                    return 0;
+
+                while (true)
+                {
+                    const auto midpoint = lower + (higher - lower) / 2u;
+                    if (capacity_ok(midpoint))
+                        lower = midpoint;
+                    else
+                        higher = midpoint;
+
+                    if ((higher - lower) <= 1u)
+                        return lower;
+                }
+
+                return 0;
+            }
+        }();
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t max_size() const noexcept
+        {
+            return max_capacity;
+        }
+
+      protected:
+        SOAGEN_CONSTEXPR_20
+        SOAGEN_NEVER_INLINE
+        void grow_if_necessary(size_t new_elements)
+        {
+            SOAGEN_ASSUME(new_elements);
+
+            // determine the minimum required allocation size to store the new elements.
+            // if this calculation would overflow or the result would exceed max_capacity then we've
+            // hit system limits and have no choice but to raise std::bad_alloc.
+            auto new_size = base::count_;
+            if SOAGEN_UNLIKELY(!add_without_overflowing(new_size, new_elements, new_size) || new_size > max_capacity)
+                SOAGEN_THROW(std::bad_alloc{});
+
+            // already enough capacity, no work to do.
+            if SOAGEN_LIKELY(new_size <= base::capacity())
+                return;
+
+            // again we need to check system limits, this time when applying the growth factor.
+            // if we overflow or would exceed the max capacity then clamp the result to max_capacity
+            // (the user is right on the edge of hitting system limits and will hit them at the next growth)
+            auto new_cap = new_size;
+            if SOAGEN_UNLIKELY(!add_without_overflowing(new_cap, new_cap, new_cap) || new_cap > max_capacity)
+                new_cap = max_capacity;
+
+            reserve(new_cap);
+        }
+
+      public:
+        SOAGEN_CONSTRAINED_TEMPLATE(Traits::template row_constructible_from<Args&&...>, typename... Args)
+        SOAGEN_CONSTEXPR_20
+        void emplace_back(Args&&... args) noexcept(                    //
+            Traits::template row_nothrow_constructible_from<Args&&...> //
+            && noexcept(this->grow_if_necessary(size_t{})))
+        {
+            grow_if_necessary(1u);
+            Traits::construct_row(base::alloc_.columns, base::count_, static_cast<Args&&>(args)...);
+            base::count_++;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(Traits::template rows_fillable_from<Values...>, typename... Values)
+        SOAGEN_CONSTEXPR_20
+        void resize(size_t num, const Values&... values) noexcept( //
+            Traits::template rows_nothrow_fillable_from<Values...> //
+            && noexcept(this->reserve(size_t{})))
+        {
+            if (base::count_ > num)
+            {
+                pop_back(base::count_ - num);
+            }
+            else if (base::count_ < num)
+            {
+                reserve(num);
+                Traits::fill_construct_rows(base::alloc_.columns, base::count_, num - base::count_, values...);
+                base::count_ = num;
+            }
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE((Traits::all_move_or_copy_constructible //
+                                     && Traits::all_move_or_copy_assignable //
+                                     && Traits::template row_constructible_from<Args&&...>),
+                                    typename... Args)
+        SOAGEN_CONSTEXPR_20
+        void emplace(size_t position, Args&&... args) noexcept(           //
+            Traits::all_nothrow_move_or_copy_constructible                //
+            && Traits::all_nothrow_move_or_copy_assignable                //
+            && Traits::template row_nothrow_constructible_from<Args&&...> //
+            && noexcept(this->grow_if_necessary(size_t{})))
+        {
+            SOAGEN_ASSUME(position <= base::count_);
+
+            // delegating to emplace_back for the end position is ideal
+            // because emplace_back never needs to move+destruct elements (modulo re-allocation)
+            if (position == base::count_)
+            {
+                emplace_back(static_cast<Args&&>(args)...);
+                return;
+            }
+
+            if constexpr (Traits::all_nothrow_move_or_copy_constructible //
+                          && Traits::all_nothrow_move_or_copy_assignable //
+                          && Traits::template row_nothrow_constructible_from<Args&&...>)
+            {
+                // move-construct the last element (since it is new)
+                grow_if_necessary(1u);
+                Traits::move_or_copy_construct_row(base::alloc_.columns,
+                                                   base::count_,
+                                                   base::alloc_.columns,
+                                                   base::count_ - 1u);
+
+                // move-assign the rest of the elements (they were already alive)
+                if (position + 1u < base::count_)
+                {
+                    Traits::move_or_copy_assign_rows(base::alloc_.columns,
+                                                     position + 1u,
+                                                     base::alloc_.columns,
+                                                     position,
+                                                     base::count_ - position - 1u);
+                }
+
+                // destruct the existing element if necessary
+                if constexpr (!Traits::all_trivially_destructible)
+                {
+                    Traits::destruct_row(base::alloc_.columns, position);
+                }
+
+                // insert the new element by direct construction
+                Traits::construct_row(base::alloc_.columns, position, static_cast<Args&&>(args)...);
+
+                base::count_++;
+            }
+            else
+            {
+                emplace_back(static_cast<Args&&>(args)...);
+                for (size_t i = base::count_ - 1u; i > position; i--)
+                    Traits::swap_rows(base::alloc_.columns, i, base::alloc_.columns, i - 1u);
+            }
+        }
+
+      private:
+        template <size_t A, size_t B>
+        static constexpr bool can_swap_columns =
+            Traits::template can_swap_columns<A, B>
+            || (std::is_same_v<typename Traits::template storage_type<A>, typename Traits::template storage_type<B>>
+                && actual_alignment<table_type, A> == actual_alignment<table_type, B>);
+
+        template <size_t A, size_t B>
+        static constexpr bool can_nothrow_swap_columns =
+            Traits::template can_nothrow_swap_columns<A, B>
+            || (std::is_same_v<typename Traits::template storage_type<A>, typename Traits::template storage_type<B>>
+                && actual_alignment<table_type, A> == actual_alignment<table_type, B>);
+
+      public:
+        template <auto A, auto B>
+        SOAGEN_CONSTEXPR_20
+        void swap_columns() //
+            noexcept(can_nothrow_swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>)
+        {
+            static_assert(can_swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>);
+
+            if constexpr (static_cast<size_t>(A) != static_cast<size_t>(B))
+            {
+                using storage_a = typename Traits::template storage_type<A>;
+                using storage_b = typename Traits::template storage_type<B>;
+                static_assert(std::is_same_v<storage_a, storage_b>);
+
+                // if they have the same base alignment, we can just swap the two pointers
+                // rather than having to do an element-wise swap
+                if constexpr (actual_alignment<table_type, static_cast<size_t>(A)>
+                              == actual_alignment<table_type, static_cast<size_t>(B)>)
+                {
+                    std::swap(base::alloc_.columns[static_cast<size_t>(A)], base::alloc_.columns[static_cast<size_t>(B)]);
+                    if (base::alloc_.separate)
+                        std::swap(base::alloc_.separate[static_cast<size_t>(A)],
+                                  base::alloc_.separate[static_cast<size_t>(B)]);
+                }
+                else
+                {
+                    Traits::template swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>(base::alloc_.columns,
+                                                                                                  {},
+                                                                                                  base::count_);
+                }
+            }
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: default-constructible column types
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_typed_base
+#undef SOAGEN_BASE_TYPE
+#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Traits, Allocator>
+
+    template <typename Traits, //
+              typename Allocator,
+              bool = Traits::all_default_constructible>
+    class SOAGEN_EMPTY_BASES table_default_constructible_columns //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_constructible_columns);
+
+        using base::resize;
+
+        SOAGEN_CONSTEXPR_20
+        void resize(size_t num) noexcept(             //
+            Traits::all_nothrow_default_constructible //
+            && noexcept(this->pop_back(size_t{}))     //
+            && noexcept(this->reserve(size_t{})))
+        {
+            if (base::size() > num)
+            {
+                base::pop_back(base::size() - num);
+            }
+            else if (base::size() < num)
+            {
+                base::reserve(num);
+                if constexpr (Traits::all_nothrow_default_constructible)
+                {
+                    Traits::default_construct_rows(base::alloc_.columns, base::size(), num - base::size());
+                    base::count_ = num;
+                }
+                else
+                {
+                    for (size_t i = base::size(); i < num; i++)
+                    {
+                        Traits::default_construct_row(base::alloc_.columns, i);
+                        base::count_++;
+                    }
+                }
+            }
+        }
+
+        SOAGEN_CONSTEXPR_20
+        void resize_for_overwrite(size_t num) noexcept( //
+            Traits::all_nothrow_default_constructible   //
+            && noexcept(this->pop_back(size_t{}))       //
+            && noexcept(this->reserve(size_t{})))
+        {
+            if (base::size() > num)
+            {
+                base::pop_back(base::size() - num);
+            }
+            else if (base::size() < num)
+            {
+                base::reserve(num);
+                Traits::construct_rows_for_overwrite(base::alloc_.columns, base::size(), num - base::size());
+                base::count_ = num;
+            }
+        }
+
+        SOAGEN_CONSTEXPR_20
+        soagen::span_type<table<Traits, Allocator>> append_uninitialized(size_t num) //
+            noexcept(Traits::all_nothrow_default_constructible && noexcept(this->grow_if_necessary(size_t{})))
+        {
+            if (!num)
+                return {};
+
+            const auto start = base::size();
+            base::grow_if_necessary(num);
+            Traits::value_construct_rows_for_overwrite(base::alloc_.columns, start, num);
+            base::count_ += num;
+
+            return { static_cast<table<Traits, Allocator>&>(*this), start, num };
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_default_constructible_columns<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_constructible_columns);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: move-assignment (typed)
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_default_constructible_columns
+
+    template <typename Traits, //
+              typename Allocator,
+              bool UseBase = !std::is_move_assignable_v<SOAGEN_BASE_TYPE>
+                          || allocator_traits<Allocator>::container_move_assign_always_takes_ownership,
+              bool Movable = (Traits::all_move_or_copy_assignable && Traits::all_move_or_copy_constructible)>
+    class SOAGEN_EMPTY_BASES table_move_assign //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        table_move_assign()                                    = default;
+        table_move_assign(table_move_assign&&)                 = default;
+        table_move_assign(const table_move_assign& other)      = default;
+        table_move_assign& operator=(const table_move_assign&) = default;
+
+        // note that this is only specialized when allocator_traits::container_move_assign_always_takes_ownership
+        // is false - if it's true then the untyped base move-assign operator is already complete and no elementwise
+        // moving will ever need to take place
+        static_assert(!UseBase);
+        static_assert(Movable);
+
+        table_move_assign& operator=(table_move_assign&& rhs) noexcept( //
+            Traits::all_nothrow_move_or_copy_assignable                 //
+            && Traits::all_nothrow_move_or_copy_constructible           //
+            && noexcept(base::clear())                                  //
+            && noexcept(base::pop_back())                               //
+            && noexcept(base::reserve(size_t{})))
+        {
+            if SOAGEN_UNLIKELY(&rhs == this)
+                return *this;
+
+            static_assert(!allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
+            static_assert(!allocator_traits<Allocator>::is_always_equal::value);
+
+#if SOAGEN_INSTRUMENT
+            if (allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
+                this->raise_move_from(rhs);
+#endif
+            if (base::move_from_by_taking_ownership(rhs, std::true_type{}))
+                return *this;
+
+            SOAGEN_ASSERT(!allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()));
+
+            if (rhs.empty())
+            {
+                base::clear();
+                return *this;
+            }
+
+            if (rhs.size() < base::size())
+                base::pop_back(base::size() - rhs.size());
+
+            base::reserve(rhs.size());
+
+            const auto assigned_end = min(base::size(), rhs.size());
+            for (size_t i = 0; i < assigned_end; i++)
+                Traits::move_or_copy_assign_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+
+            const auto constructed_end = max(base::size(), rhs.size());
+            for (size_t i = assigned_end; i < constructed_end; i++)
+            {
+                Traits::move_or_copy_construct_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+                base::count_++;
+            }
+
+            return *this;
+        }
+    };
+
+    template <typename Traits, typename Allocator, bool Movable>
+    class SOAGEN_EMPTY_BASES table_move_assign<Traits, Allocator, /*UseBase*/ true, Movable> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_move_assign);
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_move_assign<Traits, Allocator, /*UseBase*/ false, /*Movable*/ false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        table_move_assign()                                    = default;
+        table_move_assign(table_move_assign&&)                 = default;
+        table_move_assign(const table_move_assign&)            = default;
+        table_move_assign& operator=(const table_move_assign&) = default;
+
+        // base operator is insufficient but the elements aren't movable so no choice but to explicitly delete
+        table_move_assign& operator=(table_move_assign&&) = delete;
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: copy-construct
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_move_assign
+
+    template <typename Traits, //
+              typename Allocator,
+              bool = Traits::all_copy_constructible && std::is_copy_constructible_v<Allocator>>
+    class SOAGEN_EMPTY_BASES table_copy_construct //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        table_copy_construct()                                       = default;
+        table_copy_construct(table_copy_construct&&)                 = default;
+        table_copy_construct& operator=(table_copy_construct&&)      = default;
+        table_copy_construct& operator=(const table_copy_construct&) = default;
+
+        table_copy_construct(const table_copy_construct& other) noexcept(Traits::all_nothrow_copy_constructible //
+                                                                         && noexcept(base::reserve(size_t{})))
+            : base{ allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator()) }
+        {
+            static_assert(std::is_nothrow_copy_constructible_v<Allocator>,
+                          "allocators must be nothrow copy-constructible");
+
+            base::reserve(other.size());
+            Traits::copy_construct_rows(base::alloc_.columns, {}, other.alloc_.columns, {}, other.size());
+            base::count_ = other.size();
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_copy_construct<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_copy_construct);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: copy-assign
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_copy_construct
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_copy_assignable    //
+                  && Traits::all_copy_constructible //
+                  && (!allocator_traits<Allocator>::propagate_on_container_copy_assignment::value
+                      || std::is_copy_assignable_v<Allocator>)>
+    class SOAGEN_EMPTY_BASES table_copy_assign //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        table_copy_assign()                               = default;
+        table_copy_assign(table_copy_assign&&)            = default;
+        table_copy_assign& operator=(table_copy_assign&&) = default;
+        table_copy_assign(const table_copy_assign&)       = default;
+
+        constexpr table_copy_assign& operator=(const table_copy_assign& rhs) noexcept( // wtb: noexcept(auto)
+            Traits::all_nothrow_copy_assignable                                        //
+            && Traits::all_nothrow_copy_constructible                                  //
+            && noexcept(base::clear())                                                 //
+            && noexcept(base::pop_back())                                              //
+            && noexcept(base::reserve(size_t{})))
+        {
+            if SOAGEN_UNLIKELY(&rhs == this)
+                return *this;
+
+            if constexpr (allocator_traits<Allocator>::propagate_on_container_copy_assignment::value
+                          || !allocator_traits<Allocator>::is_always_equal::value)
+            {
+                if (!allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
+                {
+                    base::clear();
+                    base::shrink_to_fit();
+                    SOAGEN_ASSERT(base::empty());
+                    SOAGEN_ASSERT(!base::alloc_);
+                }
+            }
+
+            if constexpr (allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+            {
+                static_assert(std::is_nothrow_copy_assignable_v<Allocator>,
+                              "copy-propagated allocators must be nothrow copy-assignable");
+
+                base::allocator() = rhs.allocator();
+            }
+
+            if (rhs.empty())
+            {
+                base::clear();
+                return *this;
+            }
+
+            if (rhs.size() < base::size())
+                base::pop_back(base::size() - rhs.size());
+
+            base::reserve(rhs.size());
+
+            const auto assigned_end = min(base::size(), rhs.size());
+            for (size_t i = 0; i < assigned_end; i++)
+                Traits::copy_assign_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+
+            const auto constructed_end = max(base::size(), rhs.size());
+            for (size_t i = assigned_end; i < constructed_end; i++)
+            {
+                Traits::copy_construct_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+                base::count_++;
+            }
+
+            return *this;
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_copy_assign<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_copy_assign);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: row erasure
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_copy_assign
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_move_or_copy_assignable>
+    class SOAGEN_EMPTY_BASES table_row_erasure //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure);
+
+        void erase(size_t pos)                                   //
+            noexcept(Traits::all_nothrow_move_or_copy_assignable //
+                     && noexcept(base::pop_back()))
+        {
+            SOAGEN_ASSUME(pos < base::count_);
+
+            if (pos + 1u < base::count_)
+            {
+#if SOAGEN_INSTRUMENT
+                const detail::table_event_timer timer;
+#endif
+                Traits::move_or_copy_assign_rows(base::alloc_.columns,
+                                                 pos,
+                                                 base::alloc_.columns,
+                                                 pos + 1u,
+                                                 base::count_ - pos - 1u);
+#if SOAGEN_INSTRUMENT
+                detail::raise_table_event<table<Traits, Allocator>, Traits>(table_event::erase_shift,
+                                                                            this,
+                                                                            base::capacity(),
+                                                                            base::capacity(),
+                                                                            base::alloc_.total_size(),
+                                                                            base::alloc_.total_size(),
+                                                                            base::count_ - pos - 1u,
+                                                                            timer.elapsed());
+#endif
+            }
+
+            base::pop_back();
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_row_erasure<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: row erasure (unordered)
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_row_erasure
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_swappable>
+    class SOAGEN_EMPTY_BASES table_row_erasure_unordered //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure_unordered);
+
+        soagen::optional<size_t> unordered_erase(size_t pos) //
+            noexcept(Traits::all_nothrow_swappable           //
+                     && noexcept(base::pop_back()))
+        {
+            SOAGEN_ASSUME(pos < base::count_);
+
+            if (pos + 1u == base::count_)
+            {
+                base::pop_back();
+                return {};
+            }
+
+            Traits::swap_rows(base::alloc_.columns, pos, base::alloc_.columns, base::count_ - 1u);
+            base::pop_back();
+            return soagen::optional<size_t>{ base::count_ };
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_row_erasure_unordered<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure_unordered);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: EqualityComparable
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_row_erasure_unordered
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_equality_comparable>
+    class SOAGEN_EMPTY_BASES table_equality_compare //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_equality_compare);
+
+        SOAGEN_NODISCARD
+        friend constexpr bool operator==(const table_equality_compare& lhs,
+                                         const table_equality_compare& rhs) //
+            noexcept(Traits::all_nothrow_equality_comparable)
+        {
+            if (&lhs == &rhs || (lhs.empty() && rhs.empty()))
+                return true;
+
+            if (lhs.size() != rhs.size())
+                return false;
+
+            return Traits::equal(lhs.alloc_.columns, {}, rhs.alloc_.columns, {}, lhs.size());
+        }
+
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator!=(const table_equality_compare& lhs,
+                                         const table_equality_compare& rhs) //
+            noexcept(Traits::all_nothrow_equality_comparable)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_equality_compare<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_equality_compare);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: LessThanComparable
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_equality_compare
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_less_than_comparable>
+    class SOAGEN_EMPTY_BASES table_less_than_compare //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_less_than_compare);
+
+        SOAGEN_NODISCARD
+        constexpr int compare(const table_less_than_compare& rhs) const //
+            noexcept(Traits::all_nothrow_less_than_comparable)
+        {
+            if (&rhs == this)
+                return 0;
+            if (base::empty())
+                return rhs.empty() ? 0 : -1;
+            if (rhs.empty())
+                return 1;
+
+            const auto comp = Traits::compare(base::alloc_.columns, //
+                                              {},
+                                              rhs.alloc_.columns,
+                                              {},
+                                              min(base::size(), rhs.size()));
+
+            return comp != 0 ? comp : (base::size() == rhs.size() ? 0 : (base::size() < rhs.size() ? -1 : 1));
+        }
+
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator<(const table_less_than_compare& lhs,
+                                        const table_less_than_compare& rhs) //
+            noexcept(Traits::all_nothrow_less_than_comparable)
+        {
+            return lhs.compare(rhs) < 0;
+        }
+
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator<=(const table_less_than_compare& lhs,
+                                         const table_less_than_compare& rhs) //
+            noexcept(Traits::all_nothrow_less_than_comparable)
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator>(const table_less_than_compare& lhs,
+                                        const table_less_than_compare& rhs) //
+            noexcept(Traits::all_nothrow_less_than_comparable)
+        {
+            return lhs.compare(rhs) > 0;
+        }
+
+        SOAGEN_NODISCARD
+        SOAGEN_ALWAYS_INLINE
+        friend constexpr bool operator>=(const table_less_than_compare& lhs,
+                                         const table_less_than_compare& rhs) //
+            noexcept(Traits::all_nothrow_less_than_comparable)
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_less_than_compare<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_less_than_compare);
+    };
+
+    //------------------------------------------------------------------------------------------------------------------
+    // specialization: data()
+    //------------------------------------------------------------------------------------------------------------------
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_less_than_compare
+
+    template <typename Traits,
+              typename Allocator,
+              bool = Traits::all_trivially_copyable>
+    class SOAGEN_EMPTY_BASES table_data_ptr //
+        : public SOAGEN_BASE_TYPE
+    {
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_data_ptr);
+
+        using table_type     = table<Traits, Allocator>;
+        using table_traits   = Traits;
+        using allocator_type = Allocator;
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
+        constexpr std::byte* data() noexcept
+        {
+            return soagen::assume_aligned<buffer_alignment<table_type>>(base::alloc_.ptr);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
+        constexpr const std::byte* data() const noexcept
+        {
+            return soagen::assume_aligned<buffer_alignment<table_type>>(base::alloc_.ptr);
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    class SOAGEN_EMPTY_BASES table_data_ptr<Traits, Allocator, false> //
+        : public SOAGEN_BASE_TYPE
+    {
+      public:
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+
+        SOAGEN_DEFAULT_RULE_OF_FIVE(table_data_ptr);
+    };
+}
+
+#undef SOAGEN_BASE_NAME
+#define SOAGEN_BASE_NAME table_data_ptr
+#undef SOAGEN_BASE_TYPE
+#define SOAGEN_BASE_TYPE detail::SOAGEN_BASE_NAME<Traits, Allocator>
+
+namespace soagen
+{
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES table_base
+    {};
+
+    template <typename Traits,
+              typename Allocator = soagen::allocator>
+    class SOAGEN_EMPTY_BASES table //
+        SOAGEN_HIDDEN_BASE(public SOAGEN_BASE_TYPE,
+                           public table_base<table<Traits, Allocator>>,
+                           public mixins::columns<table<Traits, Allocator>>,
+                           public mixins::rows<table<Traits, Allocator>>,
+                           public mixins::iterators<table<Traits, Allocator>>)
+    {
+        static_assert(std::is_empty_v<table_base<table>>, "table_base specializations may not have data members");
+        static_assert(std::is_trivial_v<table_base<table>>, "table_base specializations must be trivial");
+
+      private:
+        using base = SOAGEN_BASE_TYPE;
+
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = Allocator;
+        static_assert(!detail::is_cvref<allocator_type>::value, "allocators may not be cvref-qualified");
+
+        using table_traits = Traits;
+        static_assert(is_table_traits<table_traits>, "Traits must be an instance of soagen::table_traits");
+        static_assert(!detail::is_cvref<table_traits>::value, "table traits may not be cvref-qualified");
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits =
+            typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type =
+            typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        static constexpr size_t aligned_stride = table_traits::aligned_stride;
+
+        SOAGEN_NODISCARD_CTOR
+        table() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        table(table&&) = default;
+
+        table& operator=(table&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        table(const table&) = default;
+
+        table& operator=(const table&) = default;
+
+        ~table() = default;
+
+        template <auto Column>
+        SOAGEN_COLUMN(table, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            using column       = column_traits<static_cast<size_type>(Column)>;
+            using storage_type = typename column::storage_type;
+            using value_type   = typename column::value_type;
+
+            if constexpr (std::is_pointer_v<storage_type>)
+            {
+                static_assert(std::is_same_v<storage_type, void*>);
+
+                return soagen::assume_aligned<actual_alignment<table, Column>>(SOAGEN_LAUNDER(
+                    reinterpret_cast<value_type*>(base::alloc_.columns[static_cast<size_type>(Column)])));
+            }
+            else
+            {
+                static_assert(std::is_same_v<storage_type, std::remove_cv_t<value_type>>);
+
+                return soagen::assume_aligned<actual_alignment<table, Column>>(
+                    column::ptr(base::alloc_.columns[static_cast<size_type>(Column)]));
+            }
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(table, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            return const_cast<table&>(*this).template column<static_cast<size_type>(Column)>();
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_CONSTEXPR_20
+        void fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(column_traits<Column>::template is_nothrow_fillable_from<const Value&>)
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+            static_assert(column_traits<Column>::template is_fillable_from<const Value&>,
+                          "column must be assignable from the value");
+            SOAGEN_ASSUME(first <= base::size());
+
+            count = min(count, base::size() - first);
+            if (count)
+                column_traits<Column>::fill(base::alloc_.columns[static_cast<size_type>(Column)], first, count, value);
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_CONSTEXPR_20
+        void assign_column(const Range& values, size_type first = 0)
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+            SOAGEN_ASSUME(first <= base::size());
+
+            using value_type = std::remove_cv_t<column_type<Column>>;
+            auto dest        = column<Column>() + first;
+
+            if constexpr (std::is_trivially_copyable_v<value_type>
+                          && detail::is_contiguous_range_of<const Range, value_type>::value)
+            {
+                const auto count = static_cast<size_type>(values.size());
+                SOAGEN_ASSERT(count <= base::size() - first);
+
+                if (count)
+                    std::memmove(dest, values.data(), count * sizeof(value_type));
+            }
+            else
+            {
+                [[maybe_unused]]
+                const auto end = column<Column>() + base::size();
+                for (const auto& value : values)
+                {
+                    SOAGEN_ASSERT(dest < end);
+                    *dest++ = value;
+                }
+            }
+        }
+
+        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+    };
+
+    SOAGEN_CONSTRAINED_TEMPLATE((detail::has_swap_member<table<Args...>>::value), typename... Args)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(table<Args...>& lhs, table<Args...>& rhs) //
+        noexcept(detail::has_nothrow_swap_member<table<Args...>>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#undef SOAGEN_BASE_NAME
+#undef SOAGEN_BASE_TYPE
+
+//********  mixins/data_ptr.hpp  ***************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, bool = detail::has_data_member<table_type<Derived>>::value>
+    struct SOAGEN_EMPTY_BASES data_ptr
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using table_type = soagen::table_type<Derived>;
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
+        constexpr std::byte* data() //
+            noexcept(detail::has_nothrow_data_member<table_type>::value)
+        {
+            return soagen::assume_aligned<buffer_alignment<table_type>>(
+                static_cast<table_type&>(static_cast<Derived&>(*this)).data());
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
+        constexpr const std::byte* data() const //
+            noexcept(detail::has_nothrow_data_member<const table_type>::value)
+        {
+            return soagen::assume_aligned<buffer_alignment<table_type>>(
+                static_cast<const table_type&>(static_cast<const Derived&>(*this)).data());
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES data_ptr<Derived, false>
+    {};
+}
+
+//********  mixins/resizable.hpp  **************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, bool = detail::has_resize_member<table_type<Derived>>::value>
+    struct SOAGEN_EMPTY_BASES resizable;
+
+    // resizing with explicit values doesn't need default-constructible columns
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES resizable<Derived, false>
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using table_type = soagen::table_type<Derived>;
+        using size_type  = std::size_t;
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits_type<Derived>::template rows_fillable_from<Values...>,
+                                    typename... Values)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& resize(size_type new_size, const Values&... values) //
+            noexcept(noexcept(std::declval<table_type&>().resize(std::declval<size_type>(),
+                                                                 std::declval<const Values&>()...)))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).resize(new_size, values...);
+            return static_cast<Derived&>(*this);
+        }
+    };
+
+    template <typename Derived, bool>
+    struct SOAGEN_EMPTY_BASES resizable //
+        : resizable<Derived, false>
+    {
+        using table_type = soagen::table_type<Derived>;
+        using size_type  = std::size_t;
+
+        using resizable<Derived, false>::resize;
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& resize(size_type new_size) //
+            noexcept(detail::has_nothrow_resize_member<table_type>::value)
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).resize(new_size);
+            return static_cast<Derived&>(*this);
+        }
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& resize_for_overwrite(size_type new_size) //
+            noexcept(noexcept(std::declval<table_type&>().resize_for_overwrite(std::declval<size_type>())))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).resize_for_overwrite(new_size);
+            return static_cast<Derived&>(*this);
+        }
+
+        SOAGEN_CONSTEXPR_20
+        soagen::span_type<Derived> append_uninitialized(size_type num) //
+            noexcept(noexcept(std::declval<table_type&>().append_uninitialized(std::declval<size_type>())))
+        {
+            if (!num)
+                return {};
+
+            auto& self       = static_cast<Derived&>(*this);
+            const auto start = static_cast<const table_type&>(self).size();
+            static_cast<table_type&>(self).append_uninitialized(num);
+            return { self, start, num };
+        }
+    };
+}
+
+//********  mixins/size_and_capacity.hpp  ******************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES size_and_capacity
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using table_type = soagen::table_type<Derived>;
+        using size_type  = std::size_t;
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool empty() const noexcept
+        {
+            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).empty();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type size() const noexcept
+        {
+            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).size();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type max_size() const noexcept
+        {
+            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).max_size();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type allocation_size() const noexcept
+        {
+            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).allocation_size();
+        }
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& reserve(size_type new_cap) //
+            noexcept(noexcept(std::declval<table_type&>().reserve(size_type{})))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).reserve(new_cap);
+            return static_cast<Derived&>(*this);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type capacity() const noexcept
+        {
+            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).capacity();
+        }
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& shrink_to_fit() //
+            noexcept(noexcept(std::declval<table_type&>().shrink_to_fit()))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).shrink_to_fit();
+            return static_cast<Derived&>(*this);
+        }
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& pop_back(size_type num = 1) //
+            noexcept(noexcept(std::declval<table_type&>().pop_back(size_type{})))
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).pop_back(num);
+            return static_cast<Derived&>(*this);
+        }
+
+        SOAGEN_RESETTER
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        Derived& clear() noexcept
+        {
+            static_cast<table_type&>(static_cast<Derived&>(*this)).clear();
+            return static_cast<Derived&>(*this);
+        }
+    };
+}
+
+//********  mixins/swappable.hpp  **************************************************************************************
+
+namespace soagen::mixins
+{
+    template <typename Derived, bool = detail::has_swap_member<table_type<Derived>>::value>
+    struct SOAGEN_EMPTY_BASES swappable
+    {
+        static_assert(!detail::is_cvref<Derived>::value);
+
+        using table_type = soagen::table_type<Derived>;
+
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        void swap(Derived& other) //
+            noexcept(detail::has_nothrow_swap_member<table_type>::value)
+        {
+            return static_cast<table_type&>(static_cast<Derived&>(*this)).swap(static_cast<table_type&>(other));
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES swappable<Derived, false>
+    {};
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  selection.hpp  *********************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+#if SOAGEN_HAS_EXCEPTIONS
+    #include <stdexcept>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+
+namespace soagen
+{
+    template <typename>
+    class selection;
+
+    namespace detail
+    {
+        template <typename>
+        struct is_selection_ : std::false_type
+        {};
+        template <typename Soa>
+        struct is_selection_<selection<Soa>> : std::true_type
+        {};
+
+        template <typename Soa>
+        struct selection_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            std::vector<size_t> indices;
+        };
+
+        template <typename Soa>
+        struct selection_iterator_storage
+        {
+            static_assert(!detail::is_cvref<Soa>::value);
+
+            Soa* soa;
+            const size_t* pos;
+        };
+    }
+
+    template <typename T>
+    inline constexpr bool is_selection = detail::is_selection_<std::remove_cv_t<T>>::value;
+
+    template <typename Soa, size_t... Columns>
+    class SOAGEN_EMPTY_BASES selection_iterator //
+        SOAGEN_HIDDEN_BASE(protected detail::selection_iterator_storage<detail::remove_cvref<Soa>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
+
+      public:
+        using soa_type = detail::remove_cvref<Soa>;
+
+        using soa_ref = detail::coerce_ref<Soa>;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using row_type = soagen::row_type<Soa, Columns...>;
+
+        using value_type = row_type;
+
+        using reference = row_type;
+
+        using iterator_category = std::random_access_iterator_tag;
+
+#if SOAGEN_CPP <= 17
+        using pointer = void;
+#endif
+
+      private:
+        using base = detail::selection_iterator_storage<detail::remove_cvref<Soa>>;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        constexpr selection_iterator() noexcept //
+            : base{}
+        {}
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr selection_iterator(soa_ref src, const size_type* pos) noexcept //
+            : base{ const_cast<soa_type*>(&src), pos }
+        {}
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type source_index() const noexcept
+        {
+            SOAGEN_ASSUME(!!base::pos);
+
+            return *base::pos;
+        }
+
+        friend constexpr selection_iterator& operator++(selection_iterator& it) noexcept
+        {
+            ++it.pos;
+            return it;
+        }
+
+        friend constexpr selection_iterator operator++(selection_iterator& it, int) noexcept
+        {
+            selection_iterator pre = it;
+            ++it.pos;
+            return pre;
+        }
+
+        friend constexpr selection_iterator& operator+=(selection_iterator& it, difference_type n) noexcept
+        {
+            it.pos += n;
+            return it;
+        }
+
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator+(const selection_iterator& it, difference_type n) noexcept
+        {
+            auto it2 = it;
+            it2 += n;
+            return it2;
+        }
+
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator+(difference_type n, const selection_iterator& it) noexcept
+        {
+            return it + n;
+        }
+
+        friend constexpr selection_iterator& operator--(selection_iterator& it) noexcept
+        {
+            --it.pos;
+            return it;
+        }
+
+        friend constexpr selection_iterator operator--(selection_iterator& it, int) noexcept
+        {
+            selection_iterator pre = it;
+            --it.pos;
+            return pre;
+        }
+
+        friend constexpr selection_iterator& operator-=(selection_iterator& it, difference_type n) noexcept
+        {
+            it.pos -= n;
+            return it;
+        }
+
+        SOAGEN_PURE_GETTER
+        friend constexpr selection_iterator operator-(const selection_iterator& it, difference_type n) noexcept
+        {
+            auto it2 = it;
+            it2 -= n;
+            return it2;
+        }
+
+        SOAGEN_PURE_GETTER
+        friend constexpr difference_type operator-(const selection_iterator& lhs,
+                                                   const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos - rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator*() const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(!!base::pos);
+
+            return static_cast<soa_ref>(*base::soa).template row<Columns...>(*base::pos);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr detail::arrow_proxy<row_type> operator->() const noexcept
+        {
+            return { *(*this) };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr reference operator[](difference_type offset) const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+            SOAGEN_ASSUME(!!base::pos);
+
+            return static_cast<soa_ref>(*base::soa).template row<Columns...>(base::pos[offset]);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator==(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos == rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator!=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos != rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator<(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos < rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator<=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos <= rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator>(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos > rhs.pos;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator>=(const selection_iterator& lhs, const selection_iterator& rhs) noexcept
+        {
+            return lhs.pos >= rhs.pos;
+        }
+    };
+
+    template <typename Derived>
+    struct SOAGEN_EMPTY_BASES selection_base
+    {};
+
+    template <typename Soa>
+    class SOAGEN_EMPTY_BASES selection //
+        SOAGEN_HIDDEN_BASE(protected detail::selection_storage<detail::remove_cvref<Soa>>,
+                           public selection_base<selection<Soa>>)
+    {
+        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_reference_v<Soa>, "Soa may not be a reference.");
+        static_assert(std::is_empty_v<selection_base<selection<Soa>>>,
+                      "selection_base specializations may not have data members");
+        static_assert(std::is_trivial_v<selection_base<selection<Soa>>>,
+                      "selection_base specializations must be trivial");
+
+      public:
+        using soa_type = detail::remove_cvref<Soa>;
+
+        using soa_ref = detail::coerce_ref<Soa>;
+
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using row_type = soagen::row_type<Soa>;
+
+        using span_type = soagen::span_type<Soa>;
+
+        using iterator = selection_iterator<Soa>;
+
+        using const_iterator = selection_iterator<std::add_const_t<Soa>>;
+
+      private:
+        using base = detail::selection_storage<detail::remove_cvref<Soa>>;
+
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_type* soa, std::vector<size_type>&& indices) noexcept //
+            : base{ soa, static_cast<std::vector<size_type>&&>(indices) }
+        {}
+
+        template <typename Indices>
+        static std::vector<size_type> copy_indices(const Indices& indices, size_type offset, size_type count)
+        {
+            std::vector<size_type> result;
+            for (auto&& idx : indices)
+            {
+                SOAGEN_ASSERT(static_cast<size_type>(idx) < count);
+                static_cast<void>(count);
+
+                result.push_back(offset + static_cast<size_type>(idx));
+            }
+            return result;
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        selection() noexcept //
+            : base{}
+        {}
+
+        SOAGEN_NODISCARD_CTOR
+        selection(const selection&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        selection(selection&&) noexcept = default;
+
+        selection& operator=(const selection&) = default;
+
+        selection& operator=(selection&&) noexcept = default;
+
+        template <typename Indices>
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_ref src, const Indices& indices) //
+            : base{ const_cast<soa_type*>(&src), copy_indices(indices, 0u, static_cast<size_type>(src.size())) }
+        {}
+
+        SOAGEN_NODISCARD_CTOR
+        selection(soa_ref src, std::initializer_list<size_type> indices) //
+            : base{ const_cast<soa_type*>(&src), copy_indices(indices, 0u, static_cast<size_type>(src.size())) }
+        {}
+
+        template <typename Indices>
+        SOAGEN_NODISCARD_CTOR
+        selection(const span_type& src, const Indices& indices) //
+            : base{ const_cast<soa_type*>(src.source()), copy_indices(indices, src.source_offset(), src.size()) }
+        {}
+
+        SOAGEN_NODISCARD_CTOR
+        selection(const span_type& src, std::initializer_list<size_type> indices) //
+            : base{ const_cast<soa_type*>(src.source()), copy_indices(indices, src.source_offset(), src.size()) }
+        {}
+
+        SOAGEN_NODISCARD
+        static selection from_bitmask(soa_ref src, const std::uint64_t* words)
+        {
+            if (src.empty())
+                return selection{ static_cast<soa_ref>(src), std::initializer_list<size_type>{} };
+
+            return from_bitmask(span_type{ static_cast<soa_ref>(src) }, words);
+        }
+
+        SOAGEN_NODISCARD
+        static selection from_bitmask(const span_type& src, const std::uint64_t* words)
+        {
+            SOAGEN_ASSUME(words != nullptr || src.empty());
+
+            std::vector<size_type> indices;
+            const size_type count  = src.size();
+            const size_type offset = src.source_offset();
+            for (size_type w = 0; w * 64u < count; w++)
+            {
+                auto word = words[w];
+                if (const auto bits = count - w * 64u; bits < 64u)
+                    word &= (std::uint64_t{ 1 } << bits) - 1u;
+                for (; word; word &= word - 1u)
+                    indices.push_back(offset + w * 64u + static_cast<size_type>(countr_zero(word)));
+            }
+            return selection{ const_cast<soa_type*>(src.source()), static_cast<std::vector<size_type>&&>(indices) };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return base::indices.size();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return base::indices.empty();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const size_type* indices() const noexcept
+        {
+            return base::indices.data();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type source_index(size_type index) const noexcept
+        {
+            SOAGEN_ASSUME(index < base::indices.size());
+
+            return base::indices[index];
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        std::remove_reference_t<soa_ref>* source() const noexcept
+        {
+            return base::soa;
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> row(size_type index) const noexcept
+        {
+            SOAGEN_ASSUME(!!base::soa);
+
+            return static_cast<soa_ref>(*base::soa).template row<static_cast<size_type>(Cols)...>(source_index(index));
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        row_type operator[](size_type index) const noexcept
+        {
+            return row(index);
+        }
+
+#if SOAGEN_HAS_EXCEPTIONS
+
+        template <auto... Cols>
+        SOAGEN_NODISCARD
+        soagen::row_type<Soa, Cols...> at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range{ "bad element access" };
+            return row<Cols...>(index);
+        }
+
+#endif
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> front() const noexcept
+        {
+            return row<Cols...>(0u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::row_type<Soa, Cols...> back() const noexcept
+        {
+            return row<Cols...>(size() - 1u);
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<Soa, static_cast<size_type>(Cols)...> begin() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<soa_ref>(*base::soa), base::indices.data() };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<Soa, static_cast<size_type>(Cols)...> end() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<soa_ref>(*base::soa), base::indices.data() + base::indices.size() };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<std::add_const_t<Soa>, static_cast<size_type>(Cols)...> cbegin() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<const soa_type&>(*base::soa), base::indices.data() };
+        }
+
+        template <auto... Cols>
+        SOAGEN_PURE_INLINE_GETTER
+        selection_iterator<std::add_const_t<Soa>, static_cast<size_type>(Cols)...> cend() const noexcept
+        {
+            if (!base::soa)
+                return {};
+            return { static_cast<const soa_type&>(*base::soa), base::indices.data() + base::indices.size() };
+        }
+
+        template <auto Column, typename OutputIt>
+        OutputIt gather(OutputIt out) const
+        {
+            if (empty())
+                return out;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            for (const auto idx : base::indices)
+            {
+                *out = src[idx];
+                ++out;
+            }
+            return out;
+        }
+
+        template <auto Column, typename OutputIt>
+        OutputIt gather(OutputIt out, size_type distance) const
+        {
+            if (empty())
+                return out;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            const auto idx = base::indices.data();
+            const auto num = base::indices.size();
+
+            size_type i = 0;
+            if (distance && distance < num)
+            {
+                for (; i < num - distance; i++)
+                {
+                    SOAGEN_PREFETCH(src + idx[i + distance]);
+                    *out = src[idx[i]];
+                    ++out;
+                }
+            }
+            for (; i < num; i++)
+            {
+                *out = src[idx[i]];
+                ++out;
+            }
+            return out;
+        }
+
+        template <auto Column, typename T, typename BinaryOp>
+        SOAGEN_NODISCARD
+        T reduce(T init, BinaryOp&& op) const
+        {
+            if (empty())
+                return init;
+
+            SOAGEN_ASSUME(!!base::soa);
+
+            const auto src = static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+            for (const auto idx : base::indices)
+                init = op(static_cast<T&&>(init), src[idx]);
+            return init;
+        }
+
+        template <typename Predicate>
+        SOAGEN_NODISCARD
+        selection filter(Predicate&& pred) const
+        {
+            std::vector<size_type> indices;
+            for (const auto idx : base::indices)
+                if (pred(static_cast<soa_ref>(*base::soa).row(idx)))
+                    indices.push_back(idx);
+            return selection{ base::soa, static_cast<std::vector<size_type>&&>(indices) };
+        }
+
+        template <auto Column, typename Predicate>
+        SOAGEN_NODISCARD
+        selection filter(Predicate&& pred) const
+        {
+            std::vector<size_type> indices;
+            if (!empty())
+            {
+                const auto src =
+                    static_cast<const soa_type&>(*base::soa).template column<static_cast<size_type>(Column)>();
+                for (const auto idx : base::indices)
+                    if (pred(src[idx]))
+                        indices.push_back(idx);
+            }
+            return selection{ base::soa, static_cast<std::vector<size_type>&&>(indices) };
+        }
+    };
+
+    namespace detail
+    {
+        template <typename Soa, typename Predicate>
+        SOAGEN_NODISCARD
+        selection<Soa> select_rows(const span_type<Soa>& src, Predicate&& pred)
+        {
+            std::vector<size_t> indices;
+            for (size_t i = 0; i < src.size(); i++)
+                if (pred(src.row(i)))
+                    indices.push_back(i);
+            return selection<Soa>{ src, indices };
+        }
+
+        template <typename Soa, size_t Column, typename Predicate>
+        SOAGEN_NODISCARD
+        selection<Soa> select_rows(const span_type<Soa>& src, Predicate&& pred)
+        {
+            std::vector<size_t> indices;
+            if (!src.empty())
+            {
+                const auto col = src.template column<Column>();
+                for (size_t i = 0; i < src.size(); i++)
+                    if (pred(col[i]))
+                        indices.push_back(i);
+            }
+            return selection<Soa>{ src, indices };
+        }
+    }
+
+    SOAGEN_CONSTRAINED_TEMPLATE((is_soa<detail::remove_cvref<T>> || is_span<detail::remove_cvref<T>>),
+                                typename T,
+                                typename Predicate)
+    SOAGEN_NODISCARD
+    auto select(T& src, Predicate&& pred)
+    {
+        if constexpr (is_span<detail::remove_cvref<T>>)
+        {
+            using soa = std::remove_reference_t<detail::soa_type_cvref<detail::remove_cvref<T>>>;
+            return detail::select_rows<soa>(src, static_cast<Predicate&&>(pred));
+        }
+        else if (src.empty())
+            return selection<T>{ src, std::initializer_list<size_t>{} };
+        else
+            return detail::select_rows<T>(span_type<T>{ src }, static_cast<Predicate&&>(pred));
+    }
+
+    template <auto Column, typename T, typename Predicate>
+    SOAGEN_NODISCARD
+    auto select(T& src, Predicate&& pred)
+    {
+        static_assert(is_soa<detail::remove_cvref<T>> || is_span<detail::remove_cvref<T>>,
+                      "src must be a table, span or soagen-generated SoA type.");
+
+        if constexpr (is_span<detail::remove_cvref<T>>)
+        {
+            using soa = std::remove_reference_t<detail::soa_type_cvref<detail::remove_cvref<T>>>;
+            return detail::select_rows<soa, static_cast<size_t>(Column)>(src, static_cast<Predicate&&>(pred));
+        }
+        else if (src.empty())
+            return selection<T>{ src, std::initializer_list<size_t>{} };
+        else
+            return detail::select_rows<T, static_cast<size_t>(Column)>(span_type<T>{ src },
+                                                                       static_cast<Predicate&&>(pred));
+    }
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  prefetch.hpp  **********************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <iterator>
+#include <memory>
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen
+{
+    namespace detail
+    {
+        template <typename Row>
+        SOAGEN_ALWAYS_INLINE
+        void prefetch_row(Row&& row) noexcept
+        {
+            for_each_column(static_cast<Row&&>(row),
+                            [](auto&& value) noexcept { SOAGEN_PREFETCH(std::addressof(value)); });
+        }
+    }
+
+    template <typename Iterator>
+    class prefetch_iterator
+    {
+      public:
+        using iterator_type = Iterator;
+
+        using difference_type = typename Iterator::difference_type;
+
+        using value_type = typename Iterator::value_type;
+
+        using reference = typename Iterator::reference;
+
+        using iterator_category = std::forward_iterator_tag;
+
+#if SOAGEN_CPP <= 17
+        using pointer = void;
+#endif
+
+      private:
+        Iterator it_;
+        Iterator end_;
+        difference_type distance_;
+
+        SOAGEN_ALWAYS_INLINE
+        void prefetch() const noexcept
+        {
+            if (end_ - it_ > distance_)
+                detail::prefetch_row(it_[distance_]);
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        prefetch_iterator() noexcept //
+            : it_{},
+              end_{},
+              distance_{}
+        {}
+
+        SOAGEN_NODISCARD_CTOR
+        prefetch_iterator(Iterator it, Iterator end, difference_type distance) noexcept //
+            : it_{ it },
+              end_{ end },
+              distance_{ distance }
+        {
+            if (distance_ > 0)
+                prefetch();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        Iterator base() const noexcept
+        {
+            return it_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        difference_type distance() const noexcept
+        {
+            return distance_;
+        }
+
+        prefetch_iterator& operator++() noexcept
+        {
+            ++it_;
+            if (distance_ > 0)
+                prefetch();
+            return *this;
+        }
+
+        prefetch_iterator operator++(int) noexcept
+        {
+            prefetch_iterator pre = *this;
+            ++(*this);
+            return pre;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        reference operator*() const noexcept
+        {
+            return *it_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        detail::arrow_proxy<value_type> operator->() const noexcept
+        {
+            return { *it_ };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator==(const prefetch_iterator& lhs, const prefetch_iterator& rhs) noexcept
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const prefetch_iterator& lhs, const prefetch_iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    template <typename Iterator>
+    class prefetch_range
+    {
+      public:
+        using iterator = prefetch_iterator<Iterator>;
+
+        using difference_type = typename Iterator::difference_type;
+
+      private:
+        Iterator begin_;
+        Iterator end_;
+        difference_type distance_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        prefetch_range(Iterator begin, Iterator end, difference_type distance) noexcept //
+            : begin_{ begin },
+              end_{ end },
+              distance_{ distance }
+        {}
+
+        SOAGEN_PURE_INLINE_GETTER
+        iterator begin() const noexcept
+        {
+            return { begin_, end_, distance_ };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        iterator end() const noexcept
+        {
+            return { end_, end_, distance_ };
+        }
+    };
+
+    template <typename Range>
+    SOAGEN_NODISCARD
+    auto prefetched(Range& range, size_t distance) noexcept
+    {
+        using iterator_type = decltype(range.begin());
+        return prefetch_range<iterator_type>{ range.begin(),
+                                              range.end(),
+                                              static_cast<typename iterator_type::difference_type>(distance) };
+    }
+
+    template <auto Column, auto... Columns, typename Range>
+    SOAGEN_NODISCARD
+    auto prefetched(Range& range, size_t distance) noexcept
+    {
+        using iterator_type = decltype(range.template begin<Column, Columns...>());
+        return prefetch_range<iterator_type>{ range.template begin<Column, Columns...>(),
+                                              range.template end<Column, Columns...>(),
+                                              static_cast<typename iterator_type::difference_type>(distance) };
+    }
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  persistence.hpp  *******************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdio>
+#if SOAGEN_UNIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+SOAGEN_DISABLE_MSVC_WARNING(4996); // fopen
+
+namespace soagen
+{
+    inline constexpr std::uint32_t persisted_format_version = 1;
+
+    struct persisted_header
+    {
+        unsigned char magic[8];
+
+        std::uint32_t version;
+
+        std::uint32_t byte_order;
+
+        std::uint64_t schema_hash;
+
+        std::uint64_t column_count;
+
+        std::uint64_t row_count;
+
+        std::uint64_t capacity;
+
+        std::uint64_t data_offset;
+
+        std::uint64_t data_size;
+    };
+    static_assert(sizeof(persisted_header) == 64);
+
+    struct persisted_column
+    {
+        std::uint64_t size;
+
+        std::uint64_t alignment;
+
+        std::uint64_t offset;
+
+        std::uint64_t reserved;
+    };
+    static_assert(sizeof(persisted_column) == 32);
+
+    namespace detail
+    {
+        inline constexpr unsigned char persisted_magic[8] = { 's', 'o', 'a', 'g', 'e', 'n', 0x1A, 0 };
+
+        template <typename Soa>
+        inline constexpr size_t persisted_data_alignment =
+            max(buffer_alignment<table_type<Soa>>, min_actual_column_alignment);
+
+        template <typename Traits>
+        constexpr size_t persisted_layout(persisted_column (&columns)[Traits::column_count], size_t count) noexcept
+        {
+            size_t end = {};
+            for (size_t i = 0; i < Traits::column_count; i++)
+            {
+                const auto align = max(Traits::column_alignments[i], min_actual_column_alignment);
+
+                columns[i].size      = Traits::column_sizes[i];
+                columns[i].alignment = Traits::column_alignments[i];
+                columns[i].offset    = (end + align - 1u) & ~(align - 1u);
+                columns[i].reserved  = {};
+                end                  = columns[i].offset + Traits::column_sizes[i] * count;
+            }
+            return end;
+        }
+
+        template <typename Soa>
+        SOAGEN_NODISCARD
+        bool validate_persisted(const persisted_header& header,
+                                const persisted_column* columns,
+                                std::uint64_t file_size) noexcept
+        {
+            using traits = table_traits_type<Soa>;
+
+            if (std::memcmp(header.magic, persisted_magic, sizeof(persisted_magic)) != 0
+                || header.version != persisted_format_version     //
+                || header.byte_order != 0x01020304u               //
+                || header.schema_hash != schema_hash<Soa>         //
+                || header.column_count != traits::column_count    //
+                || header.row_count != header.capacity            // save() always writes them equal
+                || header.data_offset % persisted_data_alignment<Soa> //
+                || header.data_offset > file_size                 //
+                || header.data_size > file_size - header.data_offset)
+                return false;
+
+            for (size_t i = 0; i < traits::column_count; i++)
+            {
+                const auto align = max(traits::column_alignments[i], min_actual_column_alignment);
+
+                if (columns[i].size != traits::column_sizes[i]            //
+                    || columns[i].alignment != traits::column_alignments[i] //
+                    || columns[i].offset % align                          //
+                    || columns[i].offset > header.data_size               //
+                    || header.row_count > (header.data_size - columns[i].offset) / columns[i].size)
+                    return false;
+            }
+
+            return true;
+        }
+
+#if SOAGEN_WINDOWS
+        using file_offset = __int64;
+#elif SOAGEN_UNIX
+        using file_offset = off_t;
+#else
+        using file_offset = long;
+#endif
+
+        // std::fseek() and std::ftell() use long, which is only 32 bits on Windows
+        SOAGEN_NODISCARD
+        inline bool seek_file(std::FILE* file, std::uint64_t offset) noexcept
+        {
+            if (offset > static_cast<std::uint64_t>(~std::make_unsigned_t<file_offset>{} >> 1))
+                return false;
+
+#if SOAGEN_WINDOWS
+            return ::_fseeki64(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#elif SOAGEN_UNIX
+            return ::fseeko(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#else
+            return std::fseek(file, static_cast<file_offset>(offset), SEEK_SET) == 0;
+#endif
+        }
+
+        SOAGEN_NODISCARD
+        inline bool get_file_size(std::FILE* file, std::uint64_t& size) noexcept
+        {
+#if SOAGEN_WINDOWS
+            const file_offset end = ::_fseeki64(file, 0, SEEK_END) == 0 ? ::_ftelli64(file) : -1;
+#elif SOAGEN_UNIX
+            const file_offset end = ::fseeko(file, 0, SEEK_END) == 0 ? ::ftello(file) : -1;
+#else
+            const file_offset end = std::fseek(file, 0, SEEK_END) == 0 ? std::ftell(file) : -1;
+#endif
+            if (end < 0)
+                return false;
+
+            size = static_cast<std::uint64_t>(end);
+            return true;
+        }
+
+        SOAGEN_NODISCARD
+        inline bool write_zeros(std::FILE* file, size_t count) noexcept
+        {
+            static constexpr unsigned char zeros[64] = {};
+            while (count)
+            {
+                const auto n = min(count, sizeof(zeros));
+                if (std::fwrite(zeros, 1u, n, file) != n)
+                    return false;
+                count -= n;
+            }
+            return true;
+        }
+    }
+
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool save(const Soa& soa, const char* path) noexcept
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be persisted this way");
+        SOAGEN_ASSUME(path != nullptr);
+
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        const auto& tbl   = static_cast<const table&>(soa);
+        const auto& alloc = detail::table_storage_access::allocation(tbl);
+        const auto count  = static_cast<size_t>(tbl.size());
+
+        persisted_column columns[traits::column_count];
+        const auto data_size = detail::persisted_layout<traits>(columns, count);
+
+        constexpr auto align       = detail::persisted_data_alignment<Soa>;
+        constexpr auto header_size = sizeof(persisted_header) + sizeof(columns);
+
+        persisted_header header{};
+        std::memcpy(header.magic, detail::persisted_magic, sizeof(detail::persisted_magic));
+        header.version      = persisted_format_version;
+        header.byte_order   = 0x01020304u;
+        header.schema_hash  = schema_hash<Soa>;
+        header.column_count = traits::column_count;
+        header.row_count    = count;
+        header.capacity     = count;
+        header.data_offset  = (header_size + align - 1u) & ~(align - 1u);
+        header.data_size    = data_size;
+
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file)
+            return false;
+
+        bool ok = std::fwrite(&header, sizeof(header), 1u, file) == 1u
+               && std::fwrite(columns, sizeof(columns), 1u, file) == 1u
+               && detail::write_zeros(file, static_cast<size_t>(header.data_offset) - header_size);
+
+        size_t pos = {};
+        for (size_t i = 0; ok && i < traits::column_count && count; i++)
+        {
+            const auto bytes = traits::column_sizes[i] * count;
+            ok               = detail::write_zeros(file, static_cast<size_t>(columns[i].offset) - pos)
+                && std::fwrite(alloc.columns[i], 1u, bytes, file) == bytes;
+            pos = static_cast<size_t>(columns[i].offset) + bytes;
+        }
+
+        return (std::fclose(file) == 0) && ok;
+    }
+
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool load(Soa& soa, const char* path)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be persisted this way");
+        SOAGEN_ASSUME(path != nullptr);
+
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        soa.clear();
+        auto& tbl = static_cast<table&>(soa);
+
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file)
+            return false;
+
+        struct file_closer
+        {
+            std::FILE* file;
+
+            ~file_closer() noexcept
+            {
+                std::fclose(file);
+            }
+        } closer{ file };
+
+        persisted_header header;
+        persisted_column columns[traits::column_count];
+        std::uint64_t file_size;
+        if (std::fread(&header, sizeof(header), 1u, file) != 1u
+            || header.column_count != traits::column_count
+            || std::fread(columns, sizeof(columns), 1u, file) != 1u //
+            || !detail::get_file_size(file, file_size)                  //
+            || !detail::validate_persisted<Soa>(header, columns, file_size))
+            return false;
+
+        const auto count = static_cast<size_t>(header.row_count);
+        if (!count)
+            return true;
+
+        tbl.reserve(count);
+        const auto& alloc = detail::table_storage_access::allocation(tbl);
+        for (size_t i = 0; i < traits::column_count; i++)
+        {
+            const auto bytes = traits::column_sizes[i] * count;
+            if (!detail::seek_file(file, header.data_offset + columns[i].offset)
+                || std::fread(alloc.columns[i], 1u, bytes, file) != bytes)
+                return false;
+        }
+
+        detail::table_storage_access::set_size(tbl, count);
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
+
+    enum class map_mode : unsigned
+    {
+        read_only,
+        copy_on_write
+    };
+
+    template <typename Soa>
+    class mapped
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!detail::is_cvref<Soa>::value, "Soa may not be cvref-qualified.");
+        static_assert(table_traits_type<Soa>::all_trivially_copyable,
+                      "only tables with all trivially-copyable columns may be memory-mapped");
+        static_assert(std::is_nothrow_default_constructible_v<Soa>,
+                      "only SoA types with a nothrow default-constructible allocator may be memory-mapped");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "SoA types with indexes or handles can't be memory-mapped; use soagen::load() instead");
+
+      public:
+        using soa_type = Soa;
+
+        using size_type = std::size_t;
+
+        using span_type = soagen::span_type<Soa>;
+
+        using const_span_type = soagen::const_span_type<Soa>;
+
+      private:
+        using table = table_type<Soa>;
+
+        Soa soa_;
+        void* address_ = {};
+        size_t length_ = {};
+        bool open_     = {};
+        bool writable_ = {};
+
+        void transfer_from(mapped& other) noexcept
+        {
+            auto& src = static_cast<table&>(other.soa_);
+            if (other.address_)
+            {
+                detail::table_storage_access::adopt(static_cast<table&>(soa_),
+                                                    detail::table_storage_access::allocation(src),
+                                                    src.size(),
+                                                    src.capacity());
+                detail::table_storage_access::release(src);
+            }
+            else
+                soa_ = static_cast<Soa&&>(other.soa_);
+
+            address_  = std::exchange(other.address_, nullptr);
+            length_   = std::exchange(other.length_, size_t{});
+            open_     = std::exchange(other.open_, false);
+            writable_ = std::exchange(other.writable_, false);
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        mapped() noexcept = default;
+
+        SOAGEN_NODISCARD_CTOR
+        explicit mapped(const char* path, map_mode mode = map_mode::read_only)
+        {
+            SOAGEN_ASSUME(path != nullptr);
+
+#if SOAGEN_UNIX
+            using traits = table_traits_type<Soa>;
+
+            const int fd = ::open(path, O_RDONLY);
+            if (fd < 0)
+                return;
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || static_cast<std::uint64_t>(st.st_size) < sizeof(persisted_header))
+            {
+                ::close(fd);
+                return;
+            }
+
+            const auto length = static_cast<size_t>(st.st_size);
+            void* address     = ::mmap(nullptr,
+                                   length,
+                                   mode == map_mode::read_only ? PROT_READ : (PROT_READ | PROT_WRITE),
+                                   MAP_PRIVATE,
+                                   fd,
+                                   0);
+            ::close(fd);
+            if (address == MAP_FAILED)
+                return;
+
+            const auto base    = static_cast<std::byte*>(address);
+            const auto& header = *reinterpret_cast<const persisted_header*>(base);
+            const auto columns = reinterpret_cast<const persisted_column*>(base + sizeof(persisted_header));
+
+            if (length < sizeof(persisted_header) + sizeof(persisted_column) * traits::column_count
+                || header.column_count != traits::column_count
+                || !detail::validate_persisted<Soa>(header, columns, length)
+                || reinterpret_cast<std::uintptr_t>(base + header.data_offset)
+                           % detail::persisted_data_alignment<Soa>)
+            {
+                ::munmap(address, length);
+                return;
+            }
+
+            if (header.row_count)
+            {
+                detail::table_allocation<traits::column_count> alloc{};
+                alloc.ptr  = base + header.data_offset;
+                alloc.size = static_cast<size_t>(header.data_size);
+                for (size_t i = 0; i < traits::column_count; i++)
+                    alloc.columns[i] = alloc.ptr + columns[i].offset;
+
+                detail::table_storage_access::adopt(static_cast<table&>(soa_),
+                                                    alloc,
+                                                    static_cast<size_t>(header.row_count),
+                                                    static_cast<size_t>(header.capacity));
+            }
+
+            address_  = address;
+            length_   = length;
+            open_     = true;
+            writable_ = mode == map_mode::copy_on_write;
+#else
+            open_     = load(soa_, path);
+            writable_ = open_ && mode == map_mode::copy_on_write;
+#endif
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        mapped(mapped&& other) noexcept
+        {
+            transfer_from(other);
+        }
+
+        mapped& operator=(mapped&& rhs) noexcept
+        {
+            if SOAGEN_LIKELY(&rhs != this)
+            {
+                close();
+                transfer_from(rhs);
+            }
+            return *this;
+        }
+
+        ~mapped() noexcept
+        {
+            close();
+        }
+
+        void close() noexcept
+        {
+            if (address_)
+            {
+                detail::table_storage_access::release(static_cast<table&>(soa_));
+#if SOAGEN_UNIX
+                ::munmap(address_, length_);
+#endif
+                address_ = nullptr;
+                length_  = {};
+            }
+            else
+                static_cast<table&>(soa_).clear();
+
+            open_     = false;
+            writable_ = false;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit operator bool() const noexcept
+        {
+            return open_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool writable() const noexcept
+        {
+            return writable_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return static_cast<size_type>(soa_.size());
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return soa_.empty();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa& get() const noexcept
+        {
+            return soa_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa& operator*() const noexcept
+        {
+            return soa_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const Soa* operator->() const noexcept
+        {
+            return &soa_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        const_span_type const_span() const noexcept
+        {
+            if (soa_.empty())
+                return {};
+            return const_span_type{ soa_ };
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        span_type span() noexcept
+        {
+            SOAGEN_ASSERT(writable_ && "the mapping must be opened with map_mode::copy_on_write to be written");
+
+            if (soa_.empty())
+                return {};
+            return span_type{ soa_ };
+        }
+    };
+
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    mapped<Soa> map(const char* path, map_mode mode = map_mode::read_only)
+    {
+        return mapped<Soa>{ path, mode };
+    }
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  stream.hpp  ************************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen
+{
+    inline constexpr std::uint32_t stream_format_version = 1;
 
-    template <typename Soa, size_t... Columns>
-    struct SOAGEN_EMPTY_BASES row //
-    SOAGEN_HIDDEN_BASE(public detail::column_ref<Soa, Columns>..., public row_base<row<Soa, Columns...>>)
+    struct stream_header
     {
-        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
-        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
-        static_assert(sizeof...(Columns), "Column index list may not be empty.");
-        static_assert(std::is_empty_v<row_base<row<Soa, Columns...>>>,
-                      "row_base specializations may not have data members");
-        static_assert(std::is_trivial_v<row_base<row<Soa, Columns...>>>, "row_base specializations must be trivial");
+        unsigned char magic[8];
 
-        SOAGEN_NODISCARD_CTOR
-        constexpr row(value_ref<Soa, Columns>... args) noexcept //
-            : detail::column_ref<Soa, Columns>{ static_cast<value_ref<Soa, Columns>>(args) }...
-        {
-        }
+        std::uint32_t version;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(row);
+        std::uint32_t byte_order;
 
-        template <auto Column>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr decltype(auto) column() const noexcept
-        {
-            static_assert(static_cast<size_t>(Column) < table_traits_type<Soa>::column_count,
-                          "column index out of range");
+        std::uint64_t schema_hash;
 
-            return detail::column_ref<Soa, static_cast<size_t>(Column)>::get_ref();
-        }
+        std::uint64_t column_count;
 
-        template <typename Func>
-        SOAGEN_ALWAYS_INLINE
-        constexpr void for_each_column(Func&& func) const //
-            noexcept(noexcept(soagen::for_each_column(std::declval<const row&>(), std::declval<Func&&>())))
+        std::uint64_t row_count;
+    };
+    static_assert(sizeof(stream_header) == 40);
+
+    namespace detail
+    {
+        inline constexpr unsigned char stream_magic[8] = { 's', 'o', 'a', 'g', 'e', 'n', 0x1B, 0 };
+
+        template <typename Sink>
+        SOAGEN_NODISCARD
+        bool stream_write(Sink& sink, const void* data, size_t size)
         {
-            soagen::for_each_column(*this, static_cast<Func&&>(func));
+            if (!size)
+                return true;
+
+            if constexpr (std::is_void_v<decltype(sink(data, size))>)
+            {
+                sink(data, size);
+                return true;
+            }
+            else
+                return static_cast<bool>(sink(data, size));
         }
 
-        template <auto Member>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr decltype(auto) get() const noexcept
+        template <typename Source>
+        SOAGEN_NODISCARD
+        bool stream_read(Source& source, void* data, size_t size)
         {
-            static_assert(static_cast<size_t>(Member) < sizeof...(Columns), "member index out of range");
+            if (!size)
+                return true;
 
-            return detail::type_at_index<static_cast<size_t>(Member), detail::column_ref<Soa, Columns>...>::get_ref();
+            if constexpr (std::is_void_v<decltype(source(data, size))>)
+            {
+                source(data, size);
+                return true;
+            }
+            else
+                return static_cast<bool>(source(data, size));
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_equality_comparable),
-                                    typename T)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator==(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_equality_comparable)
+        // destroys the first N elements of a partially-read column block if the read doesn't complete
+        template <typename T>
+        struct stream_construct_guard
         {
-            if constexpr (std::is_same_v<Soa, T>)
+            T* values;
+            size_t count;
+
+            ~stream_construct_guard() noexcept
             {
-                if (&lhs == &rhs)
-                    return true;
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                        values[i].~T();
+                }
             }
-            return ((lhs.template column<Columns>() == rhs.template column<Columns>()) && ...);
+        };
+    }
+
+    template <typename T, typename = void>
+    struct column_codec;
+
+    template <typename T>
+    struct column_codec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    {
+        template <typename Sink>
+        SOAGEN_NODISCARD
+        static bool write(Sink& sink, const T* values, size_t count)
+        {
+            return detail::stream_write(sink, values, sizeof(T) * count);
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_equality_comparable),
-                                    typename T)
+        template <typename Source>
         SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator!=(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_equality_comparable)
+        static bool read(Source& source, T* dest, size_t count)
         {
-            return !(lhs == rhs);
+            return detail::stream_read(source, dest, sizeof(T) * count);
         }
+    };
 
-      private:
-        template <size_t Member, typename T>
+    template <typename Char, typename Traits, typename Allocator>
+    struct column_codec<std::basic_string<Char, Traits, Allocator>>
+    {
+        using string_type = std::basic_string<Char, Traits, Allocator>;
+
+        template <typename Sink>
         SOAGEN_NODISCARD
-        static constexpr int row_compare_impl(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        static bool write(Sink& sink, const string_type* values, size_t count)
         {
-            if constexpr (std::is_same_v<Soa, T>)
+            // lengths first, in batches, so the reader can size everything up-front
+            std::uint64_t lengths[256];
+            for (size_t i = 0; i < count;)
             {
-                if (&lhs == &rhs)
-                    return 0;
+                const auto batch = min(count - i, sizeof(lengths) / sizeof(lengths[0]));
+                for (size_t j = 0; j < batch; j++)
+                    lengths[j] = static_cast<std::uint64_t>(values[i + j].size());
+                if (!detail::stream_write(sink, lengths, sizeof(std::uint64_t) * batch))
+                    return false;
+                i += batch;
             }
 
-            if (lhs.template get<Member>() < rhs.template get<Member>())
-                return -1;
-
-            if (rhs.template get<Member>() < lhs.template get<Member>())
-                return 1;
+            for (size_t i = 0; i < count; i++)
+                if (!detail::stream_write(sink, values[i].data(), sizeof(Char) * values[i].size()))
+                    return false;
 
-            if constexpr (Member + 1u == sizeof...(Columns))
-                return 0;
-            else
-                return row_compare_impl<Member + 1u>(lhs, rhs);
+            return true;
         }
 
-      public:
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
-                                    typename T)
+        template <typename Source>
         SOAGEN_NODISCARD
-        friend constexpr bool operator<(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        static bool read(Source& source, string_type* dest, size_t count)
         {
-            return row_compare_impl<0>(lhs, rhs) < 0;
+            std::vector<std::uint64_t> lengths(count);
+            if (!detail::stream_read(source, lengths.data(), sizeof(std::uint64_t) * count))
+                return false;
+
+            detail::stream_construct_guard<string_type> guard{ dest, 0u };
+            for (size_t i = 0; i < count; i++)
+            {
+                auto& str = *::new (static_cast<void*>(dest + i)) string_type(static_cast<size_t>(lengths[i]), Char{});
+                guard.count++;
+                if (!detail::stream_read(source, str.data(), sizeof(Char) * str.size()))
+                    return false;
+            }
+
+            guard.count = 0u;
+            return true;
         }
+    };
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
-                                    typename T)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator<=(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+    namespace detail
+    {
+        // uninitialized storage for a block of values on their way to or from a column_codec
+        template <typename T>
+        struct stream_block
         {
-            return row_compare_impl<0>(lhs, rhs) <= 0;
-        }
+            T* values;
+            size_t count = {};
+            size_t capacity;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
-                                    typename T)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator>(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+            explicit stream_block(size_t cap) //
+                : values{ std::allocator<T>{}.allocate(cap) },
+                  capacity{ cap }
+            {}
+
+            stream_block(const stream_block&)            = delete;
+            stream_block& operator=(const stream_block&) = delete;
+
+            ~stream_block() noexcept
+            {
+                clear();
+                std::allocator<T>{}.deallocate(values, capacity);
+            }
+
+            void clear() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                        values[i].~T();
+                }
+                count = 0u;
+            }
+
+            template <typename Arg>
+            void push_back(Arg&& arg)
+            {
+                SOAGEN_ASSUME(count < capacity);
+
+                ::new (static_cast<void*>(values + count)) T(static_cast<Arg&&>(arg));
+                count++;
+            }
+
+            template <typename Source>
+            SOAGEN_NODISCARD
+            bool read(Source& source, size_t num)
+            {
+                SOAGEN_ASSUME(!count);
+                SOAGEN_ASSUME(num <= capacity);
+
+                if (!column_codec<T>::read(source, values, num))
+                    return false;
+                count = num;
+                return true;
+            }
+        };
+
+        // each member is written as a contiguous block using its own codec (so e.g. trivially-copyable members take a
+        // single write per block), in batches of rows to bound the temporary memory
+        template <typename Tuple, typename = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+        struct tuple_column_codec;
+
+        template <typename Tuple, size_t... Members>
+        struct tuple_column_codec<Tuple, std::index_sequence<Members...>>
         {
-            return row_compare_impl<0>(lhs, rhs) > 0;
-        }
+            static constexpr size_t batch_rows = 1024;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T> && table_traits_type<Soa>::all_less_than_comparable),
-                                    typename T)
+            template <size_t Member>
+            using member_type = std::tuple_element_t<Member, Tuple>;
+
+            template <size_t Member, typename Sink>
+            SOAGEN_NODISCARD
+            static bool write_member(Sink& sink,
+                                     stream_block<member_type<Member>>& block,
+                                     const Tuple* values,
+                                     size_t count)
+            {
+                for (size_t i = 0; i < count; i++)
+                    block.push_back(std::get<Member>(values[i]));
+
+                const bool ok = column_codec<member_type<Member>>::write(sink, block.values, count);
+                block.clear();
+                return ok;
+            }
+
+            template <typename Sink>
+            SOAGEN_NODISCARD
+            static bool write(Sink& sink, const Tuple* values, size_t count)
+            {
+                if (!count)
+                    return true;
+
+                std::tuple<stream_block<member_type<Members>>...> blocks{ (static_cast<void>(Members),
+                                                                           min(count, batch_rows))... };
+                for (size_t start = 0; start < count; start += batch_rows)
+                {
+                    const auto batch = min(count - start, batch_rows);
+                    if (!(write_member<Members>(sink, std::get<Members>(blocks), values + start, batch) && ...))
+                        return false;
+                }
+                return true;
+            }
+
+            template <typename Source>
+            SOAGEN_NODISCARD
+            static bool read(Source& source, Tuple* dest, size_t count)
+            {
+                if (!count)
+                    return true;
+
+                std::tuple<stream_block<member_type<Members>>...> blocks{ (static_cast<void>(Members),
+                                                                           min(count, batch_rows))... };
+                stream_construct_guard<Tuple> guard{ dest, 0u };
+                for (size_t start = 0; start < count; start += batch_rows)
+                {
+                    const auto batch = min(count - start, batch_rows);
+                    if (!(std::get<Members>(blocks).read(source, batch) && ...))
+                        return false;
+
+                    for (size_t i = 0; i < batch; i++)
+                    {
+                        ::new (static_cast<void*>(dest + start + i))
+                            Tuple{ static_cast<member_type<Members>&&>(std::get<Members>(blocks).values[i])... };
+                        guard.count++;
+                    }
+                    (std::get<Members>(blocks).clear(), ...);
+                }
+
+                guard.count = 0u;
+                return true;
+            }
+        };
+    }
+
+    template <typename... T>
+    struct column_codec<std::tuple<T...>, std::enable_if_t<!std::is_trivially_copyable_v<std::tuple<T...>>>>
+        : detail::tuple_column_codec<std::tuple<T...>>
+    {};
+
+    template <typename A, typename B>
+    struct column_codec<std::pair<A, B>, std::enable_if_t<!std::is_trivially_copyable_v<std::pair<A, B>>>>
+        : detail::tuple_column_codec<std::pair<A, B>>
+    {};
+
+    namespace detail
+    {
+        template <typename Soa, typename Sink, size_t... Columns>
         SOAGEN_NODISCARD
-        friend constexpr bool operator>=(const row& lhs, const row<T, Columns...>& rhs) //
-            noexcept(table_traits_type<Soa>::all_nothrow_less_than_comparable)
+        bool serialize_columns(const Soa& soa, Sink& sink, std::index_sequence<Columns...>)
         {
-            return row_compare_impl<0>(lhs, rhs) >= 0;
-        }
+            using table  = table_type<Soa>;
+            using traits = table_traits_type<Soa>;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((detail::row_implicit_conversion_ok<row, row<T, Cols...>>
-                                     && !detail::row_explicit_conversion_ok<row, row<T, Cols...>>),
-                                    typename T,
-                                    size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr operator row<T, Cols...>() const noexcept
-        {
-            return row<T, Cols...>{ static_cast<value_ref<T, Cols>>(this->template column<Cols>())... };
+            const auto& alloc = table_storage_access::allocation(static_cast<const table&>(soa));
+            const auto count  = static_cast<size_t>(soa.size());
+
+            return (column_codec<typename traits::template storage_type<Columns>>::write(
+                        sink,
+                        traits::template column<Columns>::ptr(static_cast<const std::byte*>(alloc.columns[Columns])),
+                        count)
+                    && ...);
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((!detail::row_implicit_conversion_ok<row, row<T, Cols...>>
-                                     && detail::row_explicit_conversion_ok<row, row<T, Cols...>>),
-                                    typename T,
-                                    size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator row<T, Cols...>() const noexcept
+        template <typename Soa, typename Source, size_t... Columns>
+        SOAGEN_NODISCARD
+        bool deserialize_columns(Soa& soa, Source& source, size_t count, std::index_sequence<Columns...>)
         {
-            return row<T, Cols...>{ static_cast<value_ref<T, Cols>>(this->template column<Cols>())... };
+            using table  = table_type<Soa>;
+            using traits = table_traits_type<Soa>;
+
+            auto& tbl = static_cast<table&>(soa);
+            tbl.reserve(count);
+            const auto& alloc = table_storage_access::allocation(tbl);
+
+            // destroys the fully-read columns if a later one fails
+            struct columns_guard
+            {
+                const table_allocation<traits::column_count>& alloc;
+                size_t count;
+                size_t columns = 0;
+
+                ~columns_guard() noexcept
+                {
+                    size_t col = 0;
+                    const auto destruct = [&](auto ic) noexcept
+                    {
+                        if (col++ < columns)
+                            for (size_t i = 0; i < count; i++)
+                                traits::template column<decltype(ic)::value>::destruct(alloc.columns[decltype(ic)::value],
+                                                                                      i);
+                    };
+                    (destruct(index_constant<Columns>{}), ...);
+                }
+            } guard{ alloc, count };
+
+            const auto read_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                if (!column_codec<typename traits::template storage_type<column>>::read(
+                        source,
+                        traits::template column<column>::ptr(alloc.columns[column]),
+                        count))
+                    return false;
+                guard.columns++;
+                return true;
+            };
+            if (!(read_column(index_constant<Columns>{}) && ...))
+                return false;
+
+            guard.columns = 0;
+            table_storage_access::set_size(tbl, count);
+            return true;
         }
-    };
-}
+    }
+
+    template <typename Soa, typename Sink>
+    SOAGEN_NODISCARD
+    bool serialize(const Soa& soa, Sink&& sink)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
 
-namespace std
-{
-    template <typename Soa, size_t... Columns>
-    struct tuple_size<soagen::row<Soa, Columns...>> //
-        : std::integral_constant<size_t, sizeof...(Columns)>
-    {};
+        using traits = table_traits_type<Soa>;
 
-    template <size_t Member, typename Soa, size_t... Columns>
-    struct tuple_element<Member, soagen::row<Soa, Columns...>>
+        stream_header header{};
+        std::memcpy(header.magic, detail::stream_magic, sizeof(detail::stream_magic));
+        header.version      = stream_format_version;
+        header.byte_order   = 0x01020304u;
+        header.schema_hash  = schema_hash<Soa>;
+        header.column_count = traits::column_count;
+        header.row_count    = static_cast<std::uint64_t>(soa.size());
+
+        if (!detail::stream_write(sink, &header, sizeof(header)))
+            return false;
+
+        if (!header.row_count)
+            return true;
+
+        return detail::serialize_columns(soa, sink, std::make_index_sequence<traits::column_count>{});
+    }
+
+    template <typename Soa, typename Source>
+    SOAGEN_NODISCARD
+    bool deserialize(Soa& soa, Source&& source)
     {
-        using type = decltype(std::declval<soagen::row<Soa, Columns...>>().template get<Member>());
-    };
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
+        using traits = table_traits_type<Soa>;
+
+        soa.clear();
+
+        stream_header header;
+        if (!detail::stream_read(source, &header, sizeof(header))
+            || std::memcmp(header.magic, detail::stream_magic, sizeof(detail::stream_magic)) != 0
+            || header.version != stream_format_version || header.byte_order != 0x01020304u
+            || header.schema_hash != schema_hash<Soa> || header.column_count != traits::column_count)
+            return false;
+
+        if (!header.row_count)
+            return true;
+
+        if (!detail::deserialize_columns(soa,
+                                         source,
+                                         static_cast<size_t>(header.row_count),
+                                         std::make_index_sequence<traits::column_count>{}))
+            return false;
+
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
 }
 
 // reset optimizations
@@ -6245,12 +14117,54 @@ namespace std
 #endif
 SOAGEN_POP_WARNINGS;
 
-//********  iterator.hpp  **********************************************************************************************
+//********  arrow.hpp  *************************************************************************************************
 
 SOAGEN_DISABLE_WARNINGS;
-#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 SOAGEN_ENABLE_WARNINGS;
 
+#ifndef ARROW_C_DATA_INTERFACE
+    #define ARROW_C_DATA_INTERFACE
+
+    #define ARROW_FLAG_DICTIONARY_ORDERED 1
+    #define ARROW_FLAG_NULLABLE           2
+    #define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+extern "C"
+{
+    struct ArrowSchema
+    {
+        const char* format;
+        const char* name;
+        const char* metadata;
+        int64_t flags;
+        int64_t n_children;
+        struct ArrowSchema** children;
+        struct ArrowSchema* dictionary;
+        void (*release)(struct ArrowSchema*);
+        void* private_data;
+    };
+
+    struct ArrowArray
+    {
+        int64_t length;
+        int64_t null_count;
+        int64_t offset;
+        int64_t n_buffers;
+        int64_t n_children;
+        const void** buffers;
+        struct ArrowArray** children;
+        struct ArrowArray* dictionary;
+        void (*release)(struct ArrowArray*);
+        void* private_data;
+    };
+}
+
+#endif
+
 // push current states
 SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
 SOAGEN_DISABLE_SPAM_WARNINGS;
@@ -6296,385 +14210,777 @@ SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
     #endif
 #endif
 
-namespace soagen
+namespace soagen::detail
 {
-    namespace detail
-    {
-        template <typename T>
-        struct arrow_proxy
-        {
-            mutable T value;
+    //--- per-type formats ---------------------------------------------------------------------------------------------
 
-            SOAGEN_PURE_INLINE_GETTER
-            constexpr T* operator->() const noexcept
-            {
-                return &value;
-            }
-        };
+    template <typename T, typename = void>
+    struct arrow_format_
+    {
+        static constexpr const char* value = nullptr;
+    };
+    template <>
+    struct arrow_format_<bool>
+    {
+        static constexpr const char* value = "b";
+    };
+    template <typename T>
+    struct arrow_format_<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr const char* value = sizeof(T) == 1 ? (std::is_signed_v<T> ? "c" : "C")
+                                           : sizeof(T) == 2 ? (std::is_signed_v<T> ? "s" : "S")
+                                           : sizeof(T) == 4 ? (std::is_signed_v<T> ? "i" : "I")
+                                           : sizeof(T) == 8 ? (std::is_signed_v<T> ? "l" : "L")
+                                                            : nullptr;
+    };
+    template <>
+    struct arrow_format_<float>
+    {
+        static constexpr const char* value = "f";
+    };
+    template <>
+    struct arrow_format_<double>
+    {
+        static constexpr const char* value = "g";
+    };
+    template <typename Traits, typename Allocator>
+    struct arrow_format_<std::basic_string<char, Traits, Allocator>>
+    {
+        static constexpr const char* value = "U"; // exported as large_utf8; "u" is also accepted on import
+    };
+    template <typename T>
+    inline constexpr const char* arrow_format = arrow_format_<T>::value;
 
-        template <typename Soa>
-        struct iterator_storage
-        {
-            static_assert(!detail::is_cvref<Soa>::value);
+    template <typename T>
+    inline constexpr bool is_arrow_primitive = arrow_format<T> != nullptr
+                                            && (std::is_integral_v<T> || std::is_floating_point_v<T>)
+                                            && !std::is_same_v<T, bool>;
 
-            Soa* soa;
-            ptrdiff_t offset;
-        };
-    }
+    template <typename T>
+    inline constexpr bool is_arrow_string = arrow_format<T> != nullptr && !std::is_arithmetic_v<T>;
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES iterator_base
-    {};
+    template <typename Soa, size_t Column>
+    using arrow_column_type = std::remove_cv_t<value_type<Soa, Column>>;
 
     template <typename Soa, size_t... Columns>
-    class SOAGEN_EMPTY_BASES iterator
-        SOAGEN_HIDDEN_BASE(protected detail::iterator_storage<detail::remove_cvref<Soa>>,
-                           public iterator_base<iterator<Soa, Columns...>>)
+    SOAGEN_CONST_GETTER
+    constexpr bool arrow_exportable(std::index_sequence<Columns...>) noexcept
     {
-        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
-        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
-        static_assert(sizeof...(Columns), "Column index list may not be empty.");
-        static_assert(std::is_empty_v<iterator_base<iterator<Soa, Columns...>>>,
-                      "iterator_base specializations may not have data members");
-        static_assert(std::is_trivial_v<iterator_base<iterator<Soa, Columns...>>>,
-                      "iterator_base specializations must be trivial");
+        return (true && ... && (arrow_format<arrow_column_type<Soa, Columns>> != nullptr));
+    }
 
-      public:
-        using soa_type = detail::remove_cvref<Soa>;
+    inline constexpr std::int64_t arrow_zeros[2] = {}; // stand-in for the buffers of empty columns
 
-        using soa_ref = detail::coerce_ref<Soa>;
-        static_assert(std::is_reference_v<soa_ref>);
+    //--- release callbacks --------------------------------------------------------------------------------------------
 
-        using size_type = std::size_t;
+    // every exported struct (parent and children alike) holds a reference to the shared export state so children
+    // can be moved out of their parent and released independently, as permitted by the spec.
 
-        using difference_type = std::ptrdiff_t;
+    template <typename Holder>
+    void arrow_release(ArrowArray* array) noexcept
+    {
+        SOAGEN_ASSUME(array != nullptr);
 
-        using row_type = soagen::row_type<Soa, Columns...>;
+        for (int64_t i = 0; i < array->n_children; i++)
+            if (auto child = array->children[i]; child->release)
+                child->release(child);
 
-        using value_type = row_type;
+        delete static_cast<std::shared_ptr<Holder>*>(array->private_data);
+        array->release = nullptr;
+    }
 
-        using reference = row_type;
+    template <typename Holder>
+    void arrow_release(ArrowSchema* schema) noexcept
+    {
+        SOAGEN_ASSUME(schema != nullptr);
 
-        using iterator_category = std::random_access_iterator_tag;
+        for (int64_t i = 0; i < schema->n_children; i++)
+            if (auto child = schema->children[i]; child->release)
+                child->release(child);
 
-#if SOAGEN_CPP <= 17
-        using pointer = void;
-#endif
+        delete static_cast<std::shared_ptr<Holder>*>(schema->private_data);
+        schema->release = nullptr;
+    }
 
-      private:
-        template <typename, size_t...>
-        friend class iterator;
+    //--- export state -------------------------------------------------------------------------------------------------
 
-        using base = detail::iterator_storage<detail::remove_cvref<Soa>>;
+    template <typename Soa>
+    struct arrow_array_export
+    {
+        static constexpr size_t column_count = table_traits_type<Soa>::column_count;
+
+        std::shared_ptr<const Soa> soa;
+        ArrowArray children[column_count];
+        ArrowArray* child_pointers[column_count];
+        const void* buffers[1]                     = {}; // struct arrays have only a validity buffer
+        const void* child_buffers[column_count][3] = {};
+        std::vector<std::byte> converted[column_count]; // columns that can't be exported zero-copy (bool, strings)
+    };
 
-        SOAGEN_NODISCARD_CTOR
-        constexpr iterator(base b) noexcept //
-            : base{ b }
-        {
-        }
+    template <size_t ColumnCount>
+    struct arrow_schema_export
+    {
+        ArrowSchema children[ColumnCount];
+        ArrowSchema* child_pointers[ColumnCount];
+        std::string names[ColumnCount];
+    };
 
-      public:
-        SOAGEN_NODISCARD_CTOR
-        constexpr iterator() noexcept //
-            : base{}
-        {
-        }
+    template <typename Soa, size_t Column>
+    void arrow_export_column(arrow_array_export<Soa>& state, ArrowArray& array)
+    {
+        using type = arrow_column_type<Soa, Column>;
 
-        SOAGEN_NODISCARD_CTOR
-        iterator(const iterator&) = default;
+        const auto& soa   = *state.soa;
+        const auto count  = static_cast<size_t>(soa.size());
+        auto& buffers     = state.child_buffers[Column];
+        const auto* zeros = static_cast<const void*>(arrow_zeros);
 
-        iterator& operator=(const iterator&) = default;
+        array.length     = static_cast<int64_t>(count);
+        array.null_count = 0;
+        array.offset     = 0;
+        array.n_buffers  = 2;
+        array.n_children = 0;
+        array.buffers    = buffers;
+        array.children   = nullptr;
+        array.dictionary = nullptr;
+        buffers[0]       = nullptr; // validity
 
-        SOAGEN_NODISCARD_CTOR
-        constexpr iterator(soa_ref src, difference_type pos) noexcept //
-            : base{ const_cast<soa_type*>(&src), pos }
+        if constexpr (is_arrow_primitive<type>)
         {
+            // zero-copy
+            buffers[1] = count ? static_cast<const void*>(soa.template column<Column>()) : zeros;
         }
-
-        friend constexpr iterator& operator++(iterator& it) noexcept // pre
+        else if constexpr (std::is_same_v<type, bool>)
         {
-            ++it.offset;
-            return it;
+            auto& bits = state.converted[Column];
+            bits.resize((count + 7u) / 8u + 1u);
+            const auto values = soa.template column<Column>();
+            for (size_t i = 0; i < count; i++)
+                if (values[i])
+                    bits[i / 8u] |= static_cast<std::byte>(1u << (i % 8u));
+            buffers[1] = bits.data();
         }
-
-        friend constexpr iterator operator++(iterator& it, int) noexcept // post
+        else
         {
-            iterator pre = it;
-            ++it.offset;
-            return pre;
-        }
+            static_assert(is_arrow_string<type>);
 
-        friend constexpr iterator& operator+=(iterator& it, difference_type n) noexcept
-        {
-            it.offset += n;
-            return it;
-        }
+            const auto values = soa.template column<Column>();
+            size_t total      = {};
+            for (size_t i = 0; i < count; i++)
+                total += values[i].size();
+
+            // [ int64 offsets (count + 1) | character data ]
+            auto& buf = state.converted[Column];
+            buf.resize(sizeof(std::int64_t) * (count + 1u) + total + 1u);
+            auto offsets = reinterpret_cast<std::int64_t*>(buf.data());
+            auto chars   = buf.data() + sizeof(std::int64_t) * (count + 1u);
+            offsets[0]   = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                std::memcpy(chars + offsets[i], values[i].data(), values[i].size());
+                offsets[i + 1u] = offsets[i] + static_cast<std::int64_t>(values[i].size());
+            }
 
-        SOAGEN_PURE_GETTER
-        friend constexpr iterator operator+(const iterator& it, difference_type n) noexcept
-        {
-            auto it2 = it;
-            it2 += n;
-            return it2;
+            array.n_buffers = 3;
+            buffers[1]      = offsets;
+            buffers[2]      = chars;
         }
+    }
 
-        friend constexpr iterator& operator--(iterator& it) noexcept // pre
-        {
-            --it.offset;
-            return it;
-        }
+    template <typename Soa, size_t... Columns>
+    void arrow_export(std::shared_ptr<const Soa> soa,
+                      ArrowArray* out_array,
+                      ArrowSchema* out_schema,
+                      std::index_sequence<Columns...>)
+    {
+        static constexpr size_t column_count = sizeof...(Columns);
 
-        friend constexpr iterator operator--(iterator& it, int) noexcept // post
+        // array
+        if (out_array)
         {
-            iterator pre = it;
-            --it.offset;
-            return pre;
-        }
+            using state_type = arrow_array_export<Soa>;
 
-        friend constexpr iterator& operator-=(iterator& it, difference_type n) noexcept
-        {
-            return it += (-n);
-        }
+            auto state = std::make_shared<state_type>();
+            state->soa = static_cast<std::shared_ptr<const Soa>&&>(soa);
+            (arrow_export_column<Soa, Columns>(*state, state->children[Columns]), ...);
 
-        SOAGEN_PURE_INLINE_GETTER
-        friend constexpr iterator operator-(const iterator& it, difference_type n) noexcept
-        {
-            return it + (-n);
-        }
+            const auto count = static_cast<int64_t>(state->soa->size());
+            for (size_t i = 0; i < column_count; i++)
+            {
+                state->child_pointers[i]         = &state->children[i];
+                state->children[i].release       = arrow_release<state_type>;
+                state->children[i].private_data  = new std::shared_ptr<state_type>(state);
+            }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_GETTER
-        constexpr difference_type operator-(const iterator<T, Cols...>& rhs) const noexcept
-        {
-            return base::offset - rhs.offset;
+            *out_array = ArrowArray{ count,
+                                     0,
+                                     0,
+                                     1,
+                                     static_cast<int64_t>(column_count),
+                                     state->buffers,
+                                     state->child_pointers,
+                                     nullptr,
+                                     arrow_release<state_type>,
+                                     nullptr };
+            out_array->private_data = new std::shared_ptr<state_type>(static_cast<std::shared_ptr<state_type>&&>(state));
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr reference operator*() const noexcept
+        // schema
+        if (out_schema)
         {
-            SOAGEN_ASSUME(!!base::soa);
-            SOAGEN_ASSUME(base::offset >= 0);
-
-            return static_cast<soa_ref>(*base::soa).template row<Columns...>(static_cast<size_type>(base::offset));
-        }
+            using state_type = arrow_schema_export<column_count>;
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr detail::arrow_proxy<row_type> operator->() const noexcept
-        {
-            return { *(*this) };
+            auto state = std::make_shared<state_type>();
+            const auto make_child = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+
+                auto& name = state->names[column];
+                name       = column_name<Soa, column>::value;
+                if (name.empty())
+                    name = std::to_string(column);
+
+                state->child_pointers[column] = &state->children[column];
+                state->children[column]       = ArrowSchema{ arrow_format<arrow_column_type<Soa, column>>,
+                                                       name.c_str(),
+                                                       nullptr,
+                                                       0,
+                                                       0,
+                                                       nullptr,
+                                                       nullptr,
+                                                       arrow_release<state_type>,
+                                                       new std::shared_ptr<state_type>(state) };
+            };
+            (make_child(index_constant<Columns>{}), ...);
+
+            *out_schema = ArrowSchema{ "+s",
+                                       "",
+                                       nullptr,
+                                       0,
+                                       static_cast<int64_t>(column_count),
+                                       state->child_pointers,
+                                       nullptr,
+                                       arrow_release<state_type>,
+                                       nullptr };
+            out_schema->private_data =
+                new std::shared_ptr<state_type>(static_cast<std::shared_ptr<state_type>&&>(state));
         }
+    }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr reference operator[](difference_type offset) const noexcept
-        {
-            SOAGEN_ASSUME(!!base::soa);
-            SOAGEN_ASSUME(base::offset + offset >= 0);
+    //--- import -------------------------------------------------------------------------------------------------------
 
-            return static_cast<soa_ref>(*base::soa)
-                .template row<Columns...>(static_cast<size_type>(base::offset + offset));
-        }
+    // soagen columns can't represent nulls, so any array that might have some is rejected. a null_count of -1 means
+    // "not computed", in which case a validity bitmap has to be assumed to mark some.
+    SOAGEN_PURE_GETTER
+    inline bool arrow_may_have_nulls(const ArrowArray& array) noexcept
+    {
+        return array.null_count > 0
+            || (array.null_count && array.n_buffers > 0 && array.buffers && array.buffers[0]);
+    }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_GETTER
-        constexpr bool operator==(const iterator<T, Cols...>& rhs) const noexcept
-        {
-            return base::soa == rhs.soa && base::offset == rhs.offset;
-        }
+    template <typename T>
+    SOAGEN_NODISCARD
+    bool arrow_validate_column(const ArrowArray& array, const ArrowSchema& schema, size_t length) noexcept
+    {
+        if (!schema.format || array.length < 0 || array.offset < 0 || static_cast<size_t>(array.length) != length
+            || arrow_may_have_nulls(array) || !array.buffers)
+            return false;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        friend constexpr bool operator!=(const iterator& lhs, const iterator<T, Cols...>& rhs) noexcept
-        {
-            return !(lhs == rhs);
-        }
+        const std::string_view format{ schema.format };
+        if constexpr (is_arrow_string<T>)
+            return (format == "U" || format == "u") && array.n_buffers == 3
+                && (!length || (array.buffers[1] && array.buffers[2]));
+        else
+            return format == arrow_format<T> && array.n_buffers == 2 && (!length || array.buffers[1]);
+    }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool operator<(const iterator<T, Cols...>& rhs) const noexcept
-        {
-            return base::offset < rhs.offset;
-        }
+    template <typename Soa, size_t Column>
+    void arrow_import_column(Soa& soa, const ArrowArray& array, const ArrowSchema& schema, size_t& constructed)
+    {
+        using column = typename table_traits_type<Soa>::template column<Column>;
+        using type   = arrow_column_type<Soa, Column>;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool operator<=(const iterator<T, Cols...>& rhs) const noexcept
-        {
-            return base::offset <= rhs.offset;
-        }
+        auto dest = table_storage_access::allocation(static_cast<table_type<Soa>&>(soa)).columns[Column];
+        const auto count  = static_cast<size_t>(array.length);
+        const auto offset = static_cast<size_t>(array.offset);
+        if (!count)
+            return;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool operator>(const iterator<T, Cols...>& rhs) const noexcept
+        if constexpr (is_arrow_primitive<type>)
         {
-            return base::offset > rhs.offset;
+            std::memcpy(dest, static_cast<const type*>(array.buffers[1]) + offset, sizeof(type) * count);
+            constructed = count;
         }
-
-        SOAGEN_CONSTRAINED_TEMPLATE((same_table_type<Soa, T>), typename T, size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool operator>=(const iterator<T, Cols...>& rhs) const noexcept
+        else if constexpr (std::is_same_v<type, bool>)
         {
-            return base::offset >= rhs.offset;
+            const auto bits = static_cast<const std::uint8_t*>(array.buffers[1]);
+            for (; constructed < count; constructed++)
+            {
+                const auto bit = offset + constructed;
+                column::construct_at(dest, constructed, ((bits[bit / 8u] >> (bit % 8u)) & 1u) != 0u);
+            }
         }
-
-        SOAGEN_CONSTRAINED_TEMPLATE(
-            (detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
-             && !detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
-            typename T,
-            size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr operator iterator<T, Cols...>() const noexcept
+        else
         {
-            return iterator<T, Cols...>{ static_cast<const base&>(*this) };
-        }
+            const auto chars = static_cast<const char*>(array.buffers[2]);
+            const auto read  = [&](const auto* offsets)
+            {
+                for (; constructed < count; constructed++)
+                {
+                    const auto start = static_cast<size_t>(offsets[offset + constructed]);
+                    const auto end   = static_cast<size_t>(offsets[offset + constructed + 1u]);
+                    column::construct_at(dest, constructed, chars + start, end - start);
+                }
+            };
 
-        SOAGEN_CONSTRAINED_TEMPLATE((!detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
-                                     && detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
-                                    typename T,
-                                    size_t... Cols)
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator iterator<T, Cols...>() const noexcept
-        {
-            return iterator<T, Cols...>{ static_cast<const base&>(*this) };
+            // large_utf8 ("U") has 64-bit offsets, utf8 ("u") 32-bit
+            if (schema.format[0] == 'U')
+                read(static_cast<const std::int64_t*>(array.buffers[1]));
+            else
+                read(static_cast<const std::int32_t*>(array.buffers[1]));
         }
+    }
 
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator size_type() const noexcept
-        {
-            SOAGEN_ASSUME(base::offset >= 0);
+    template <typename Soa, size_t... Columns>
+    SOAGEN_NODISCARD
+    bool arrow_import(Soa& soa, const ArrowArray& array, const ArrowSchema& schema, std::index_sequence<Columns...>)
+    {
+        using traits = table_traits_type<Soa>;
+        using table  = table_type<Soa>;
 
-            return static_cast<size_type>(base::offset);
-        }
+        if (!schema.format || std::string_view{ schema.format } != "+s"
+            || schema.n_children != static_cast<int64_t>(traits::column_count)
+            || array.n_children != static_cast<int64_t>(traits::column_count) || array.length < 0
+            || array.offset != 0 || arrow_may_have_nulls(array))
+            return false;
 
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator difference_type() const noexcept
+        const auto count = static_cast<size_t>(array.length);
+        if (!(arrow_validate_column<arrow_column_type<Soa, Columns>>(*array.children[Columns],
+                                                                                      *schema.children[Columns],
+                                                                                      count)
+              && ...))
+            return false;
+
+        if (!count)
+            return true;
+
+        auto& tbl = static_cast<table&>(soa);
+        tbl.reserve(count);
+
+        // destroys any constructed elements if a later column throws
+        struct columns_guard
         {
-            return base::offset;
-        }
-    };
+            table& tbl;
+            size_t constructed[traits::column_count] = {};
+            bool committed                           = false;
 
-    template <typename Soa, size_t... Columns>
-    SOAGEN_PURE_INLINE_GETTER
-    constexpr iterator<Soa, Columns...> operator+(typename iterator<Soa, Columns...>::difference_type n,
-                                                  const iterator<Soa, Columns...>& it) noexcept
-    {
-        return it + n;
+            ~columns_guard() noexcept
+            {
+                if (committed)
+                    return;
+                const auto& alloc = table_storage_access::allocation(tbl);
+                const auto destruct = [&](auto ic) noexcept
+                {
+                    constexpr size_t column = decltype(ic)::value;
+                    for (size_t i = 0; i < constructed[column]; i++)
+                        traits::template column<column>::destruct(alloc.columns[column], i);
+                };
+                (destruct(index_constant<Columns>{}), ...);
+            }
+        } guard{ tbl };
+
+        (arrow_import_column<Soa, Columns>(soa, *array.children[Columns], *schema.children[Columns], guard.constructed[Columns]),
+         ...);
+
+        guard.committed = true;
+        table_storage_access::set_size(tbl, count);
+        return true;
     }
 }
 
-//********  mixins/columns.hpp  ****************************************************************************************
-
-namespace soagen::mixins
+namespace soagen
 {
-    template <typename Derived, typename...>
-    struct SOAGEN_EMPTY_BASES columns;
+    template <typename T>
+    inline constexpr bool is_arrow_exportable =
+        detail::arrow_exportable<soa_type<T>>(column_indices<soa_type<T>>{});
 
-    template <typename Derived, size_t... Columns>
-    struct SOAGEN_EMPTY_BASES
-    columns<Derived, std::index_sequence<Columns...>> : detail::column_func<Derived, Columns>...
+    template <typename Soa>
+    void to_arrow(std::shared_ptr<Soa> soa, ArrowArray* out_array, ArrowSchema* out_schema = nullptr)
     {
-        static_assert(!detail::is_cvref<Derived>::value);
-        static_assert(sizeof...(Columns));
-        static_assert(std::is_same_v<column_indices<Derived>, std::index_sequence<Columns...>>);
-    };
+        using soa_type = std::remove_cv_t<Soa>;
+        static_assert(is_soa<soa_type>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<soa_type>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(soa != nullptr);
+
+        detail::arrow_export<soa_type>(std::shared_ptr<const soa_type>{ static_cast<std::shared_ptr<Soa>&&>(soa) },
+                                       out_array,
+                                       out_schema,
+                                       std::make_index_sequence<table_traits_type<soa_type>::column_count>{});
+    }
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES columns<Derived> //
-        : columns<Derived, column_indices<Derived>>
+    SOAGEN_CONSTRAINED_TEMPLATE(is_soa<Soa>, typename Soa)
+    void to_arrow(Soa&& soa, ArrowArray* out_array, ArrowSchema* out_schema = nullptr)
     {
-        template <typename Func>
-        SOAGEN_ALWAYS_INLINE
-        constexpr void for_each_column(Func&& func) //
-            noexcept(noexcept(soagen::for_each_column(std::declval<Derived&>(), std::declval<Func&&>())))
-        {
-            soagen::for_each_column(static_cast<Derived&>(*this), static_cast<Func&&>(func));
-        }
+        to_arrow(std::make_shared<Soa>(static_cast<Soa&&>(soa)), out_array, out_schema);
+    }
 
-        template <typename Func>
-        SOAGEN_ALWAYS_INLINE
-        constexpr void for_each_column(Func&& func) const //
-            noexcept(noexcept(soagen::for_each_column(std::declval<const Derived&>(), std::declval<Func&&>())))
+    template <typename Soa>
+    void to_arrow_schema(ArrowSchema* out_schema)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<Soa>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(out_schema != nullptr);
+
+        detail::arrow_export<Soa>(nullptr,
+                                  nullptr,
+                                  out_schema,
+                                  std::make_index_sequence<table_traits_type<Soa>::column_count>{});
+    }
+
+    template <typename Soa>
+    SOAGEN_NODISCARD
+    bool from_arrow(Soa& soa, ArrowArray* array, const ArrowSchema* schema)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(is_arrow_exportable<Soa>,
+                      "all columns must be integers, float, double, bool or std::string to use Arrow interop");
+        SOAGEN_ASSUME(array != nullptr);
+        SOAGEN_ASSUME(schema != nullptr);
+
+        struct array_releaser
         {
-            soagen::for_each_column(static_cast<const Derived&>(*this), static_cast<Func&&>(func));
-        }
-    };
+            ArrowArray* array;
+
+            ~array_releaser() noexcept
+            {
+                if (array->release)
+                    array->release(array);
+            }
+        } releaser{ array };
+
+        soa.clear();
+        if (!array->release)
+            return false;
+
+        if (!detail::arrow_import(soa,
+                                  *array,
+                                  *schema,
+                                  std::make_index_sequence<table_traits_type<Soa>::column_count>{}))
+            return false;
+
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
 }
 
-//********  mixins/equality_comparable.hpp  ****************************************************************************
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-namespace soagen::mixins
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  aos.hpp  ***************************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <tuple>
+#include <utility>
+#if SOAGEN_ISET_SSE
+    #include <xmmintrin.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen::detail
 {
-    template <typename Derived, bool = detail::is_equality_comparable<const table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES equality_comparable
+    // rows transposed per block; small enough that a block of source structs is still in L1 by the time the last
+    // column has been written
+    inline constexpr size_t aos_block_rows = 256;
+
+    template <typename T, typename... Members>
+    SOAGEN_PURE_GETTER
+    inline bool aos_members_are_sequential(const T& obj, Members T::*... members) noexcept
     {
-        static_assert(!detail::is_cvref<Derived>::value);
+        size_t expected = 0;
+        return ((reinterpret_cast<const std::byte*>(&(obj.*members)) - reinterpret_cast<const std::byte*>(&obj)
+                     == static_cast<std::ptrdiff_t>((expected++) * sizeof(Members)))
+                && ...);
+    }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator==(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_equality_comparable<const table_type<Derived>>::value)
+    // structs of exactly four packed floats going to/from four float columns can be transposed with SSE shuffles
+    template <typename Soa, typename T, typename... Members>
+    inline constexpr bool aos_is_float4 = sizeof...(Members) == 4                         //
+                                       && sizeof(T) == 4u * sizeof(float)                 //
+                                       && std::is_standard_layout_v<T>                    //
+                                       && (std::is_same_v<remove_cvref<Members>, float> && ...);
+
+    template <typename Soa, size_t... Columns>
+    inline constexpr bool aos_columns_are_float =
+        (std::is_same_v<typename table_traits_type<Soa>::template storage_type<Columns>, float> && ...);
+
+    template <typename Soa, typename T, typename... Members, size_t... Columns>
+    SOAGEN_NEVER_INLINE
+    void aos_append(Soa& soa, const T* src, size_t count, std::index_sequence<Columns...>, Members T::*... members)
+    {
+        using traits = table_traits_type<Soa>;
+        using table  = table_type<Soa>;
+
+        auto& tbl         = static_cast<table&>(soa);
+        const size_t base = tbl.size();
+
+        size_t new_size = base;
+        if SOAGEN_UNLIKELY(!add_without_overflowing(new_size, count, new_size) || new_size > tbl.max_size())
+            SOAGEN_THROW(std::bad_alloc{});
+        if (new_size > tbl.capacity())
+            tbl.reserve(max(new_size, min(tbl.capacity() * 2u, tbl.max_size())));
+
+        const auto& alloc = table_storage_access::allocation(tbl);
+        const std::tuple<Members T::*...> member_ptrs{ members... };
+
+        // destroys a partially-written block and pops any previously-committed ones if a copy throws,
+        // leaving the table as it was on entry
+        struct block_guard
         {
-            return detail::soa_views_equal(lhs, rhs, column_indices<Derived>{});
-        }
+            table& tbl;
+            size_t base;
+            size_t start;
+            size_t constructed[traits::column_count] = {};
+            bool committed                           = false;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator!=(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_equality_comparable<const table_type<Derived>>::value)
+            ~block_guard() noexcept
+            {
+                if (committed)
+                    return;
+                const auto& a       = table_storage_access::allocation(tbl);
+                const auto destruct = [&](auto ic) noexcept
+                {
+                    constexpr size_t column = decltype(ic)::value;
+                    for (size_t i = 0; i < constructed[column]; i++)
+                        traits::template column<column>::destruct(a.columns[column], start + i);
+                };
+                (destruct(index_constant<Columns>{}), ...);
+                tbl.pop_back(tbl.size() - base);
+            }
+        };
+
+        for (size_t block = 0; block < count; block += aos_block_rows)
         {
-            return !detail::soa_views_equal(lhs, rhs, column_indices<Derived>{});
+            const size_t rows  = min(count - block, aos_block_rows);
+            const size_t start = base + block;
+            const T* const in  = src + block;
+
+            block_guard guard{ tbl, base, start };
+            size_t done = 0;
+
+#if SOAGEN_ISET_SSE
+            if constexpr (aos_is_float4<Soa, T, Members...> && aos_columns_are_float<Soa, Columns...>)
+            {
+                if (aos_members_are_sequential(*src, members...))
+                {
+                    float* const out[] = { traits::template column<Columns>::ptr(alloc.columns[Columns]) + start... };
+                    for (; done + 4u <= rows; done += 4u)
+                    {
+                        const float* const f = reinterpret_cast<const float*>(in + done);
+
+                        __m128 r0 = _mm_loadu_ps(f);
+                        __m128 r1 = _mm_loadu_ps(f + 4);
+                        __m128 r2 = _mm_loadu_ps(f + 8);
+                        __m128 r3 = _mm_loadu_ps(f + 12);
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        _mm_storeu_ps(out[0] + done, r0);
+                        _mm_storeu_ps(out[1] + done, r1);
+                        _mm_storeu_ps(out[2] + done, r2);
+                        _mm_storeu_ps(out[3] + done, r3);
+                    }
+                    ((guard.constructed[Columns] = done), ...);
+                }
+            }
+#endif
+
+            const auto copy_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                using column_traits     = typename traits::template column<column>;
+                const auto member       = std::get<column>(member_ptrs);
+                std::byte* const buf    = alloc.columns[column];
+
+                if constexpr (noexcept(column_traits::construct_at(buf, size_t{}, in->*member)))
+                {
+                    for (size_t i = done; i < rows; i++)
+                        column_traits::construct_at(buf, start + i, in[i].*member);
+                    guard.constructed[column] = rows;
+                }
+                else
+                {
+                    for (size_t i = done; i < rows; i++)
+                    {
+                        column_traits::construct_at(buf, start + i, in[i].*member);
+                        guard.constructed[column]++;
+                    }
+                }
+            };
+            (copy_column(index_constant<Columns>{}), ...);
+
+            guard.committed = true;
+            table_storage_access::set_size(tbl, start + rows);
         }
-    };
+    }
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES equality_comparable<Derived, false>
-    {};
-}
+    template <typename Soa, typename T, typename... Members, size_t... Columns>
+    SOAGEN_NEVER_INLINE
+    void aos_copy(const Soa& soa,
+                  T* dest,
+                  size_t start,
+                  size_t count,
+                  std::index_sequence<Columns...>,
+                  Members T::*... members)
+    {
+        using table = table_type<Soa>;
 
-//********  mixins/less_than_comparable.hpp  ***************************************************************************
+        const auto& tbl = static_cast<const table&>(soa);
+        SOAGEN_ASSERT(start <= tbl.size());
+        SOAGEN_ASSERT(count <= tbl.size() - start);
 
-namespace soagen::mixins
-{
-    template <typename Derived, bool = detail::is_less_than_comparable<const table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES less_than_comparable
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+        const std::tuple<Members T::*...> member_ptrs{ members... };
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator<(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+        for (size_t block = 0; block < count; block += aos_block_rows)
         {
-            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) < 0;
-        }
+            const size_t rows = min(count - block, aos_block_rows);
+            const size_t from = start + block;
+            T* const out      = dest + block;
+            size_t done       = 0;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator<=(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
-        {
-            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) <= 0;
+#if SOAGEN_ISET_SSE
+            if constexpr (aos_is_float4<Soa, T, Members...> && aos_columns_are_float<Soa, Columns...>)
+            {
+                if (aos_members_are_sequential(*dest, members...))
+                {
+                    const float* const in[] = { tbl.template column<Columns>() + from... };
+                    for (; done + 4u <= rows; done += 4u)
+                    {
+                        float* const f = reinterpret_cast<float*>(out + done);
+
+                        __m128 r0 = _mm_loadu_ps(in[0] + done);
+                        __m128 r1 = _mm_loadu_ps(in[1] + done);
+                        __m128 r2 = _mm_loadu_ps(in[2] + done);
+                        __m128 r3 = _mm_loadu_ps(in[3] + done);
+                        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                        _mm_storeu_ps(f, r0);
+                        _mm_storeu_ps(f + 4, r1);
+                        _mm_storeu_ps(f + 8, r2);
+                        _mm_storeu_ps(f + 12, r3);
+                    }
+                }
+            }
+#endif
+
+            const auto copy_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                const auto member       = std::get<column>(member_ptrs);
+                const auto* const in    = tbl.template column<column>() + from;
+
+                for (size_t i = done; i < rows; i++)
+                    out[i].*member = in[i];
+            };
+            (copy_column(index_constant<Columns>{}), ...);
         }
+    }
+}
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator>(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+namespace soagen
+{
+    template <typename Soa, typename T, typename... Members>
+    Soa& append_from_aos(Soa& soa, const T* src, size_t count, Members T::*... members)
+    {
+        static_assert(sizeof...(Members) == table_traits_type<Soa>::column_count,
+                      "a member pointer must be provided for each column");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "SoA types with indexes or handles must use their append_from_aos() member function");
+
+        if (count)
         {
-            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) > 0;
+            SOAGEN_ASSERT(src);
+            detail::aos_append(soa, src, count, std::make_index_sequence<sizeof...(Members)>{}, members...);
         }
+        return soa;
+    }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((comparable_soa<Derived, Rhs>), typename Rhs)
-        SOAGEN_NODISCARD
-        friend constexpr bool operator>=(const Derived& lhs, const Rhs& rhs) //
-            noexcept(detail::is_nothrow_less_than_comparable<const table_type<Derived>>::value)
+    template <typename Soa, typename T, typename... Members>
+    void copy_to_aos(const Soa& soa, T* dest, size_t start, size_t count, Members T::*... members)
+    {
+        static_assert(sizeof...(Members) == table_traits_type<Soa>::column_count,
+                      "a member pointer must be provided for each column");
+
+        if (count)
         {
-            return detail::soa_views_compare(lhs, rhs, column_indices<Derived>{}) >= 0;
+            SOAGEN_ASSERT(dest);
+            detail::aos_copy(soa, dest, start, count, std::make_index_sequence<sizeof...(Members)>{}, members...);
         }
-    };
-
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES less_than_comparable<Derived, false>
-    {};
+    }
 }
 
 // reset optimizations
@@ -6701,12 +15007,11 @@ namespace soagen::mixins
 #endif
 SOAGEN_POP_WARNINGS;
 
-//********  span.hpp  **************************************************************************************************
+//********  hash_index.hpp  ********************************************************************************************
 
 SOAGEN_DISABLE_WARNINGS;
-#if SOAGEN_HAS_EXCEPTIONS
-    #include <stdexcept>
-#endif
+#include <functional>
+#include <vector>
 SOAGEN_ENABLE_WARNINGS;
 
 // push current states
@@ -6754,3691 +15059,4165 @@ SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
     #endif
 #endif
 
-SOAGEN_DISABLE_SHADOW_WARNINGS;
-
 namespace soagen
 {
-    namespace detail
-    {
-        template <typename Soa>
-        struct span_storage
-        {
-            static_assert(!detail::is_cvref<Soa>::value);
-
-            Soa* soa;
-            size_t start;
-            size_t count;
-        };
-
-        SOAGEN_CONST_GETTER
-        constexpr size_t calc_span_count(size_t start, size_t src_count, size_t desired_count) noexcept
-        {
-            return desired_count == static_cast<size_t>(-1) ? src_count - min(start, src_count) : desired_count;
-        }
-    }
-
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES span_base
-    {};
-
-    template <typename Soa>
-    class SOAGEN_EMPTY_BASES span //
-        SOAGEN_HIDDEN_BASE(protected detail::span_storage<detail::remove_cvref<Soa>>,
-                           public span_base<span<Soa>>,
-                           public mixins::columns<span<Soa>>,
-                           public mixins::equality_comparable<span<Soa>>,
-                           public mixins::less_than_comparable<span<Soa>>)
+    template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class hash_index
     {
-        static_assert(is_soa<detail::remove_cvref<Soa>>, "Soa must be a table or soagen-generated SoA type.");
-        static_assert(!std::is_lvalue_reference_v<Soa>, "Soa may not be an lvalue reference.");
-        static_assert(std::is_empty_v<span_base<span<Soa>>>, "span_base specializations may not have data members");
-        static_assert(std::is_trivial_v<span_base<span<Soa>>>, "span_base specializations must be trivial");
-
       public:
-        using soa_type = detail::remove_cvref<Soa>;
-
-        using soa_ref = detail::coerce_ref<Soa>;
-        static_assert(std::is_reference_v<soa_ref>);
-
-        using size_type = std::size_t;
-
-        using difference_type = std::ptrdiff_t;
+        using key_type = Key;
 
-        using row_type = soagen::row_type<Soa>;
-
-        using iterator = soagen::iterator_type<Soa>;
-
-        using const_iterator = soagen::const_iterator_type<Soa>;
+        using hasher = Hash;
 
-        using span_type = span;
+        using key_equal = KeyEqual;
 
-        using const_span_type = soagen::const_span_type<Soa>;
+        using size_type = std::size_t;
 
       private:
-        template <typename>
-        friend class span;
-
-        using base = detail::span_storage<detail::remove_cvref<Soa>>;
-
-        SOAGEN_NODISCARD_CTOR
-        constexpr span(base b) noexcept //
-            : base{ b }
-        {
-        }
-
-        SOAGEN_NODISCARD_CTOR
-        constexpr span(soa_ref soa, size_type start, size_type count, std::true_type) noexcept //
-            : base{ const_cast<soa_type*>(&soa), start, count }
-        {
-            SOAGEN_CONSTEXPR_SAFE_ASSERT(start < soa.size());
-            SOAGEN_CONSTEXPR_SAFE_ASSERT(start + count <= soa.size());
-        }
-
-      public:
-        SOAGEN_NODISCARD_CTOR
-        constexpr span() noexcept //
-            : base{}
-        {
-        }
-
-        SOAGEN_NODISCARD_CTOR
-        span(const span&) = default;
-
-        span& operator=(const span&) = default;
-
-        SOAGEN_NODISCARD_CTOR
-        constexpr span(soa_ref soa, size_type start, size_type count = static_cast<size_type>(-1)) noexcept //
-            : span{ static_cast<soa_ref>(soa),
-                    start,
-                    detail::calc_span_count(start, soa.size(), count),
-                    std::true_type{} }
-        {
-        }
-
-        SOAGEN_NODISCARD_CTOR
-        explicit constexpr span(soa_ref soa) noexcept //
-            : span{ static_cast<soa_ref>(soa),        //
-                    0u,
-                    soa.size(),
-                    std::true_type{} }
-        {
-        }
-
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type size() const noexcept
-        {
-            return base::count;
-        }
-
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool empty() const noexcept
-        {
-            return !size();
-        }
-
-        template <auto Column>
-        SOAGEN_COLUMN(span, Column)
-        constexpr auto* column() const noexcept
-        {
-            return static_cast<soa_ref>(*base::soa).template column<Column>() + base::start;
-        }
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Soa, Cols...> row(size_type index) const noexcept
-        {
-            return static_cast<soa_ref>(*base::soa).template row<static_cast<size_type>(Cols)...>(base::start + index);
-        }
-
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        row_type operator[](size_type index) const noexcept
-        {
-            return row(index);
-        }
-
-#if SOAGEN_HAS_EXCEPTIONS
-
-        template <auto... Cols>
-        SOAGEN_NODISCARD
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Soa, Cols...> at(size_type index) const
-        {
-            if (index >= size())
-                throw std::out_of_range{ "bad element access" };
-            return static_cast<soa_ref>(*base::soa).template at<static_cast<size_type>(Cols)...>(base::start + index);
-        }
-
-#endif
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Soa, Cols...> front() const noexcept
-        {
-            return row<static_cast<size_type>(Cols)...>(0u);
-        }
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Soa, Cols...> back() const noexcept
-        {
-            return row<static_cast<size_type>(Cols)...>(size() - 1u);
-        }
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr soagen::iterator_type<Soa, Cols...> begin() const noexcept
-        {
-            return { static_cast<soa_ref>(*base::soa), //
-                     static_cast<difference_type>(base::start) };
-        }
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr soagen::iterator_type<Soa, Cols...> end() const noexcept
-        {
-            return { static_cast<soa_ref>(*base::soa), //
-                     static_cast<difference_type>(base::start + base::count) };
-        }
-
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr soagen::const_iterator_type<Soa, Cols...> cbegin() const noexcept
-        {
-            return { static_cast<soa_ref>(*base::soa), //
-                     static_cast<difference_type>(base::start) };
-        }
+        static constexpr size_type empty_slot = static_cast<size_type>(-1);
+        static constexpr size_type min_slots  = 16;
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr soagen::const_iterator_type<Soa, Cols...> cend() const noexcept
+        struct slot
         {
-            return { static_cast<soa_ref>(*base::soa), //
-                     static_cast<difference_type>(base::start + base::count) };
-        }
+            size_type row;
+            std::uint64_t hash;
+        };
 
-        SOAGEN_PURE_INLINE_GETTER
-        span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
-        {
-            return { static_cast<soa_ref>(*base::soa),
-                     base::start + start,
-                     detail::calc_span_count(start, base::count, count),
-                     std::true_type{} };
-        }
+        std::vector<slot> slots_;
+        size_type count_ = {};
+        unsigned shift_  = 64;
+        hasher hasher_;
+        key_equal key_equal_;
 
         SOAGEN_PURE_INLINE_GETTER
-        const_span_type const_subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
+        std::uint64_t hash(const key_type& key) const noexcept
         {
-            return { static_cast<soa_ref>(*base::soa),
-                     base::start + start,
-                     detail::calc_span_count(start, base::count, count),
-                     std::true_type{} };
+            // fibonacci hashing; std::hash is the identity for integers on most implementations
+            return static_cast<std::uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ull;
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type source_offset() const noexcept
+        size_type home(std::uint64_t h) const noexcept
         {
-            return base::start;
+            return static_cast<size_type>(h >> shift_);
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr std::remove_reference_t<soa_ref>* source() const noexcept
+        size_type mask() const noexcept
         {
-            return base::soa;
+            return slots_.size() - 1u;
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE(
-            (detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
-             && !detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
-            typename T)
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr operator span<T>() const noexcept
+        void place(size_type row, std::uint64_t h) noexcept
         {
-            return span<T>{ static_cast<const base&>(*this) };
-        }
+            SOAGEN_ASSUME(count_ < slots_.size());
 
-        SOAGEN_CONSTRAINED_TEMPLATE((!detail::implicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>
-                                     && detail::explicit_conversion_ok<detail::coerce_ref<Soa>, detail::coerce_ref<T>>),
-                                    typename T)
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator span<T>() const noexcept
-        {
-            return span<T>{ static_cast<const base&>(*this) };
+            for (size_type i = home(h);; i = (i + 1u) & mask())
+            {
+                if (slots_[i].row == empty_slot)
+                {
+                    slots_[i] = { row, h };
+                    count_++;
+                    return;
+                }
+            }
         }
-    };
-}
-
-//********  table_traits.hpp  ******************************************************************************************
-
-namespace soagen::detail
-{
-    // a base class for the table traits that handles all the non-alignment-dependent stuff -
-    // the 'Columns' argument seen by this class should be the column_base_traits, NOT soagen::column_traits
-    // (to minimize template instantiation explosion)
-    template <typename...>
-    struct table_traits_base;
-
-    template <size_t... I, typename... Columns>
-    struct table_traits_base<std::index_sequence<I...>, Columns...>
-    {
-        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
-
-        static_assert(std::is_same_v<std::index_sequence<I...>, std::make_index_sequence<sizeof...(Columns)>>,
-                      "index sequence must match columns");
-
-        static constexpr size_t column_count = sizeof...(Columns);
-        static_assert(column_count, "tables must have at least one column");
-        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
-
-        // columns
-
-        template <auto Index>
-        using column = type_at_index<static_cast<size_t>(Index), Columns...>;
-
-        template <typename IndexConstant>
-        using column_from_ic =
-            type_at_index<static_cast<size_t>(detail::remove_cvref<IndexConstant>::value), Columns...>;
-
-        template <auto Index>
-        using storage_type = typename column<static_cast<size_t>(Index)>::storage_type;
-
-        using column_pointers       = std::byte* [column_count];
-        using const_column_pointers = std::byte* const[column_count];
-
-        static constexpr size_t column_sizes[column_count] = { sizeof(typename Columns::storage_type)... };
-
-        // default constructibility
-
-        static constexpr bool all_default_constructible =
-            std::conjunction<std::is_default_constructible<typename Columns::storage_type>...>::value;
-
-        static constexpr bool all_nothrow_default_constructible =
-            std::conjunction<std::is_nothrow_default_constructible<typename Columns::storage_type>...>::value;
 
-        static constexpr bool all_trivially_default_constructible =
-            std::conjunction<std::is_trivially_default_constructible<typename Columns::storage_type>...>::value;
-
-        // trivial-copyability (memcpy + memmove)
+        SOAGEN_PURE_GETTER
+        size_type locate(const key_type* keys, size_type row) const noexcept
+        {
+            SOAGEN_ASSUME(keys != nullptr);
+            SOAGEN_ASSUME(!slots_.empty());
 
-        static constexpr bool all_trivially_copyable = (Columns::is_trivially_copyable && ...);
+            for (size_type i = home(hash(keys[row]));; i = (i + 1u) & mask())
+            {
+                SOAGEN_ASSERT(slots_[i].row != empty_slot && "row was not in the index");
+                if (slots_[i].row == row)
+                    return i;
+            }
+        }
 
-        static constexpr bool any_trivially_copyable = (false || ... || Columns::is_trivially_copyable);
+        // backward-shift deletion; keeps probe sequences intact without tombstones
+        void remove_slot(size_type i) noexcept
+        {
+            for (size_type j = (i + 1u) & mask();; j = (j + 1u) & mask())
+            {
+                if (slots_[j].row == empty_slot)
+                    break;
 
-        // move-constructibility
+                const size_type h = home(slots_[j].hash);
+                if (((j - h) & mask()) >= ((j - i) & mask()))
+                {
+                    slots_[i] = slots_[j];
+                    i         = j;
+                }
+            }
+            slots_[i].row = empty_slot;
+            count_--;
+        }
 
-        static constexpr bool all_move_constructible = (Columns::is_move_constructible && ...);
+        void rehash(size_type slot_count)
+        {
+            std::vector<slot> old(slot_count, slot{ empty_slot, 0u });
+            old.swap(slots_);
+            count_ = 0;
+            shift_ = 64u;
+            for (size_type n = slot_count; n > 1u; n >>= 1)
+                shift_--;
 
-        static constexpr bool all_nothrow_move_constructible = (Columns::is_nothrow_move_constructible && ...);
+            for (const auto& s : old)
+                if (s.row != empty_slot)
+                    place(s.row, s.hash);
+        }
 
-        static constexpr bool all_trivially_move_constructible = (Columns::is_trivially_move_constructible && ...);
+      public:
+        SOAGEN_NODISCARD_CTOR
+        hash_index() = default;
 
-        // move-assignability
+        SOAGEN_NODISCARD_CTOR
+        explicit hash_index(const hasher& h, const key_equal& eq = key_equal{}) //
+            : hasher_{ h },
+              key_equal_{ eq }
+        {}
 
-        static constexpr bool all_move_assignable = (Columns::is_move_assignable && ...);
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return count_;
+        }
 
-        static constexpr bool all_nothrow_move_assignable = (Columns::is_nothrow_move_assignable && ...);
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !count_;
+        }
 
-        static constexpr bool all_trivially_move_assignable = (Columns::is_trivially_move_assignable && ...);
+        void reserve(size_type rows)
+        {
+            // max load factor of 3/4
+            if (rows <= slots_.size() - slots_.size() / 4u)
+                return;
 
-        // copy-constructibility
+            size_type slot_count = min_slots;
+            while (slot_count - slot_count / 4u < rows)
+                slot_count *= 2u;
+            rehash(slot_count);
+        }
 
-        static constexpr bool all_copy_constructible = (Columns::is_copy_constructible && ...);
+        SOAGEN_NODISCARD
+        optional<size_type> find(const key_type* keys, const key_type& key) const noexcept
+        {
+            if (!count_)
+                return {};
 
-        static constexpr bool all_nothrow_copy_constructible = (Columns::is_nothrow_copy_constructible && ...);
+            SOAGEN_ASSUME(keys != nullptr);
 
-        static constexpr bool all_trivially_copy_constructible = (Columns::is_trivially_copy_constructible && ...);
+            const auto h = hash(key);
+            for (size_type i = home(h);; i = (i + 1u) & mask())
+            {
+                const auto& s = slots_[i];
+                if (s.row == empty_slot)
+                    return {};
+                if (s.hash == h && key_equal_(keys[s.row], key))
+                    return s.row;
+            }
+        }
 
-        // copy-assignability
+        void rebuild(const key_type* keys, size_type count)
+        {
+            clear();
+            reserve(count);
+            for (size_type row = 0; row < count; row++)
+                place(row, hash(keys[row]));
+        }
 
-        static constexpr bool all_copy_assignable = (Columns::is_copy_assignable && ...);
+        void clear() noexcept
+        {
+            for (auto& s : slots_)
+                s.row = empty_slot;
+            count_ = 0;
+        }
 
-        static constexpr bool all_nothrow_copy_assignable = (Columns::is_nothrow_copy_assignable && ...);
+        void push_back(const key_type* keys, size_type row)
+        {
+            reserve(count_ + 1u);
+            place(row, hash(keys[row]));
+        }
 
-        static constexpr bool all_trivially_copy_assignable = (Columns::is_trivially_copy_assignable && ...);
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            reserve(count_ + 1u);
+            if (row + 1u < count)
+            {
+                for (auto& s : slots_)
+                    if (s.row != empty_slot && s.row >= row)
+                        s.row++;
+            }
+            push_back(keys, row);
+        }
 
-        // move-or-copy-constructibility
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            remove_slot(locate(keys, row));
+            if (row + 1u < count)
+            {
+                for (auto& s : slots_)
+                    if (s.row != empty_slot && s.row > row)
+                        s.row--;
+            }
+        }
 
-        static constexpr bool all_move_or_copy_constructible = (Columns::is_move_or_copy_constructible && ...);
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            remove_slot(locate(keys, row));
+            if (row + 1u < count)
+                slots_[locate(keys, count - 1u)].row = row;
+        }
 
-        static constexpr bool all_nothrow_move_or_copy_constructible =
-            (Columns::is_nothrow_move_or_copy_constructible && ...);
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
+            {
+                clear();
+                return;
+            }
+            for (size_type row = count - num; row < count; row++)
+                remove_slot(locate(keys, row));
+        }
 
-        static constexpr bool all_trivially_move_or_copy_constructible =
-            (Columns::is_trivially_move_or_copy_constructible && ...);
+        void swap(hash_index& other) noexcept
+        {
+            using std::swap;
+            slots_.swap(other.slots_);
+            swap(count_, other.count_);
+            swap(shift_, other.shift_);
+            swap(hasher_, other.hasher_);
+            swap(key_equal_, other.key_equal_);
+        }
+    };
+}
 
-        // move-or-copy-assignability
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-        static constexpr bool all_move_or_copy_assignable = (Columns::is_move_or_copy_assignable && ...);
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-        static constexpr bool all_nothrow_move_or_copy_assignable =
-            (Columns::is_nothrow_move_or_copy_assignable && ...);
+//********  bitmap_index.hpp  ******************************************************************************************
 
-        static constexpr bool all_trivially_move_or_copy_assignable =
-            (Columns::is_trivially_move_or_copy_assignable && ...);
+SOAGEN_DISABLE_WARNINGS;
+#include <functional>
+#include <iterator>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
 
-        // destructibility
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-        static constexpr bool all_destructible =
-            std::conjunction<std::is_destructible<typename Columns::storage_type>...>::value;
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-        static constexpr bool all_nothrow_destructible =
-            std::conjunction<std::is_nothrow_destructible<typename Columns::storage_type>...>::value;
+namespace soagen
+{
+    template <typename, typename>
+    class bitmap_index;
 
-        static constexpr bool all_trivially_destructible =
-            std::conjunction<std::is_trivially_destructible<typename Columns::storage_type>...>::value;
+    class row_bitset
+    {
+      public:
+        using size_type = std::size_t;
 
-        // swappability
+        class iterator
+        {
+          public:
+            using value_type        = size_type;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = size_type;
+            using pointer           = void;
+            using iterator_category = std::forward_iterator_tag;
 
-        static constexpr bool all_swappable = (Columns::is_swappable && ...);
+          private:
+            const std::uint64_t* words_ = {};
+            size_type word_count_       = {};
+            size_type word_             = {};
+            std::uint64_t bits_         = {};
 
-        static constexpr bool all_nothrow_swappable = (Columns::is_nothrow_swappable && ...);
+            void skip_empty_words() noexcept
+            {
+                while (!bits_ && ++word_ < word_count_)
+                    bits_ = words_[word_];
+            }
 
-        // equality comparability
+            friend class row_bitset;
 
-        static constexpr bool all_equality_comparable =
-            std::conjunction<is_equality_comparable<typename Columns::storage_type>...>::value;
+            SOAGEN_NODISCARD_CTOR
+            iterator(const std::uint64_t* words, size_type word_count, size_type word) noexcept //
+                : words_{ words },
+                  word_count_{ word_count },
+                  word_{ word },
+                  bits_{ word < word_count ? words[word] : 0u }
+            {
+                if (word_ < word_count_)
+                    skip_empty_words();
+            }
 
-        static constexpr bool all_nothrow_equality_comparable =
-            std::conjunction<is_nothrow_equality_comparable<typename Columns::storage_type>...>::value;
+          public:
+            SOAGEN_NODISCARD_CTOR
+            iterator() noexcept = default;
 
-        // less-than comparability
+            SOAGEN_PURE_INLINE_GETTER
+            size_type operator*() const noexcept
+            {
+                SOAGEN_ASSUME(bits_ != 0u);
 
-        static constexpr bool all_less_than_comparable =
-            std::conjunction<is_less_than_comparable<typename Columns::storage_type>...>::value;
+                return word_ * 64u + static_cast<size_type>(countr_zero(bits_));
+            }
 
-        static constexpr bool all_nothrow_less_than_comparable =
-            std::conjunction<is_nothrow_less_than_comparable<typename Columns::storage_type>...>::value;
+            iterator& operator++() noexcept
+            {
+                bits_ &= bits_ - 1u;
+                skip_empty_words();
+                return *this;
+            }
 
-        // row constructibility
+            iterator operator++(int) noexcept
+            {
+                iterator prev = *this;
+                ++(*this);
+                return prev;
+            }
 
-      private:
-        template <size_t, typename...>
-        struct row_constructible_from_tuple_ : std::false_type
-        {};
-        template <typename Tuple, size_t... Members>
-        struct row_constructible_from_tuple_<column_count, Tuple, std::index_sequence<Members...>>
-            : std::conjunction<typename Columns::template is_constructible_trait<decltype(get_from_tuple<Members>(
-                  std::declval<Tuple>()))>...>
-        {
-            static_assert(std::is_same_v<std::index_sequence<Members...>, std::make_index_sequence<column_count>>);
-        };
+            SOAGEN_PURE_INLINE_GETTER
+            friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return lhs.word_ == rhs.word_ && lhs.bits_ == rhs.bits_;
+            }
 
-        template <bool, size_t, typename... Args>
-        struct row_constructible_from_ : std::false_type
-        {};
-        template <typename... Args>
-        struct row_constructible_from_<false, column_count, Args...>
-            : std::conjunction<typename Columns::template is_constructible_trait<Args>...>
-        {
-            static_assert(sizeof...(Args) == column_count);
+            SOAGEN_PURE_INLINE_GETTER
+            friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
         };
-        template <typename Tuple>
-        struct row_constructible_from_<true, 1, Tuple>
-            : row_constructible_from_tuple_<std::tuple_size_v<detail::remove_cvref<Tuple>>,
-                                            detail::remove_cvref<Tuple>,
-                                            std::make_index_sequence<std::tuple_size_v<detail::remove_cvref<Tuple>>>>
-        {};
 
-      public:
-        template <typename... Args>
-        static constexpr bool row_constructible_from =
-            row_constructible_from_<(is_tuple<detail::remove_cvref<Args>> && ...), sizeof...(Args), Args...>::value;
-
-        // row constructibility (nothrow)
+        using const_iterator = iterator;
 
       private:
-        template <size_t, typename...>
-        struct row_nothrow_constructible_from_tuple_ : std::false_type
-        {};
-        template <typename Tuple, size_t... Members>
-        struct row_nothrow_constructible_from_tuple_<column_count, Tuple, std::index_sequence<Members...>>
-            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<
-                  decltype(get_from_tuple<Members>(std::declval<Tuple>()))>...>
-        {
-            static_assert(std::is_same_v<std::index_sequence<Members...>, std::make_index_sequence<column_count>>);
-        };
+        std::vector<std::uint64_t> words_;
+        size_type size_ = {};
 
-        template <bool, size_t, typename... Args>
-        struct row_nothrow_constructible_from_ : std::false_type
-        {};
-        template <typename... Args>
-        struct row_nothrow_constructible_from_<false, column_count, Args...>
-            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<Args>...>
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type words_for(size_type rows) noexcept
         {
-            static_assert(sizeof...(Args) == column_count);
-        };
-        template <typename Tuple>
-        struct row_nothrow_constructible_from_<true, 1, Tuple>
-            : row_nothrow_constructible_from_tuple_<
-                  std::tuple_size_v<detail::remove_cvref<Tuple>>,
-                  detail::remove_cvref<Tuple>,
-                  std::make_index_sequence<std::tuple_size_v<detail::remove_cvref<Tuple>>>>
-        {};
-
-      public:
-        template <typename... Args>
-        static constexpr bool row_nothrow_constructible_from =
-            row_nothrow_constructible_from_<(is_tuple<detail::remove_cvref<Args>> && ...), sizeof...(Args), Args...>::
-                value;
-
-        //--- memmove --------------------------------------------------------------------------------------------------
+            return (rows + 63u) / 64u;
+        }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_trivially_copyable)
-        SOAGEN_CONSTEXPR_20
-        static void memmove(column_pointers& dest,
-                            size_t dest_start,
-                            const_column_pointers& source,
-                            size_t source_start,
-                            size_t count) //
-            noexcept
+        void mask_tail() noexcept
         {
-            (column<I>::memmove(dest[I], dest_start, source[I], source_start, count), ...);
+            if (const auto bits = size_ % 64u; bits)
+                words_.back() &= (std::uint64_t{ 1 } << bits) - 1u;
         }
 
-        //--- destruction ----------------------------------------------------------------------------------------------
-
-        static constexpr void destruct_row(column_pointers& columns,
-                                           size_t index,
-                                           size_t leftmost_column,
-                                           size_t rightmost_column) noexcept
+        // adjusts the number of rows; new rows are not in the set. doesn't allocate if reserve()'d.
+        void resize(size_type rows)
         {
-            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
-
-            if constexpr (all_trivially_destructible)
-            {
-                // nothing to do in this case :)
-            }
-            else
-            {
-                const auto destructor = [&](auto ic) noexcept
-                {
-                    static constexpr size_t column_index = decltype(ic)::value;
-
-                    if constexpr (!std::is_trivially_destructible_v<storage_type<column_index>>)
-                    {
-                        if (column_index >= leftmost_column && column_index <= rightmost_column)
-                            column<column_index>::destruct(columns[column_index], index);
-                    }
-                };
-
-                (destructor(index_constant<column_count - I - 1u>{}), ...);
-            }
+            words_.resize(words_for(rows));
+            size_ = rows;
+            mask_tail();
         }
 
-        static constexpr void destruct_row(column_pointers& columns, size_t index) noexcept
+        void reserve(size_type rows)
         {
-            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+            words_.reserve(words_for(rows));
+        }
 
-            if constexpr (all_trivially_destructible)
-            {
-                // nothing to do in this case :)
-            }
-            else
-            {
-                const auto destructor = [&](auto ic) noexcept
-                {
-                    static constexpr size_t column_index = decltype(ic)::value;
+        // inserts a row that is not in the set before row `pos`, shifting subsequent rows up by one
+        void insert_row(size_type pos)
+        {
+            SOAGEN_ASSERT(pos <= size_);
 
-                    if constexpr (!std::is_trivially_destructible_v<storage_type<column_index>>)
-                    {
-                        column<column_index>::destruct(columns[column_index], index);
-                    }
-                };
+            resize(size_ + 1u);
+            const size_type first = pos / 64u;
+            for (size_type w = words_.size() - 1u; w > first; w--)
+                words_[w] = (words_[w] << 1) | (words_[w - 1u] >> 63);
 
-                (destructor(index_constant<column_count - I - 1u>{}), ...);
-            }
+            const std::uint64_t low = (std::uint64_t{ 1 } << (pos % 64u)) - 1u;
+            words_[first]           = (words_[first] & low) | ((words_[first] & ~low) << 1);
         }
 
-        static constexpr void destruct_rows([[maybe_unused]] column_pointers& columns,
-                                            [[maybe_unused]] size_t start,
-                                            [[maybe_unused]] size_t count) noexcept
+        // removes row `pos`, shifting subsequent rows down by one
+        void erase_row(size_type pos) noexcept
         {
-            static_assert(all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+            SOAGEN_ASSERT(pos < size_);
 
-            if constexpr (all_trivially_destructible)
-            {
-                // nothing to do in this case :)
-            }
-            else
+            const size_type first   = pos / 64u;
+            const size_type last    = words_.size() - 1u;
+            const std::uint64_t low = (std::uint64_t{ 1 } << (pos % 64u)) - 1u;
+
+            words_[first] = (words_[first] & low) | ((words_[first] >> 1) & ~low);
+            for (size_type w = first + 1u; w <= last; w++)
             {
-                for (size_t i = start + count; i-- > start;)
-                    destruct_row(columns, i);
+                words_[w - 1u] |= words_[w] << 63;
+                words_[w] >>= 1;
             }
+
+            words_.resize(words_for(size_ - 1u));
+            size_--;
+            mask_tail();
         }
 
-        //--- default-construction -------------------------------------------------------------------------------------
+        template <typename, typename>
+        friend class bitmap_index;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
-        SOAGEN_CONSTEXPR_20
-        static void default_construct_row(column_pointers& columns,
-                                          size_t index) //
-            noexcept(all_nothrow_default_constructible) //
-        {
-            static_assert(all_default_constructible);
+      public:
+        SOAGEN_NODISCARD_CTOR
+        row_bitset() noexcept = default;
 
-            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
-            {
-                (column<I>::default_construct(columns[I], index), ...);
-            }
-            else
-            {
-                // machinery to provide strong-exception guarantee
+        SOAGEN_NODISCARD_CTOR
+        explicit row_bitset(size_type rows) //
+            : words_(words_for(rows)),
+              size_{ rows }
+        {}
 
-                [[maybe_unused]]
-                size_t constructed_columns = {};
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
 
-                const auto constructor = [&](auto ic) //
-                    noexcept(std::is_nothrow_default_constructible_v<storage_type<decltype(ic)::value>>)
-                {
-                    column_from_ic<decltype(ic)>::default_construct(columns[decltype(ic)::value], index);
+        SOAGEN_PURE_INLINE_GETTER
+        const std::uint64_t* words() const noexcept
+        {
+            return words_.data();
+        }
 
-                    constructed_columns++;
-                };
+        SOAGEN_PURE_INLINE_GETTER
+        size_type word_count() const noexcept
+        {
+            return words_.size();
+        }
 
-                SOAGEN_TRY
-                {
-                    (constructor(index_constant<I>{}), ...);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    if (constructed_columns)
-                        destruct_row(columns, index, 0u, constructed_columns - 1u);
+        SOAGEN_PURE_GETTER
+        size_type count() const noexcept
+        {
+            size_type n = 0;
+            for (auto w : words_)
+                n += static_cast<size_type>(popcount(w));
+            return n;
+        }
 
-                    throw;
-                }
-#endif
-            }
+        SOAGEN_PURE_GETTER
+        bool any() const noexcept
+        {
+            for (auto w : words_)
+                if (w)
+                    return true;
+            return false;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
-        SOAGEN_CONSTEXPR_20
-        static void default_construct_rows([[maybe_unused]] column_pointers& columns,
-                                           [[maybe_unused]] size_t start,
-                                           [[maybe_unused]] size_t count) //
-            noexcept(all_nothrow_destructible)
+        SOAGEN_PURE_INLINE_GETTER
+        bool none() const noexcept
         {
-            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
-            {
-                for (size_t i = start, e = start + count; i < e; i++)
-                    default_construct_row(columns, i);
-            }
-            else
-            {
-                // machinery to provide strong-exception guarantee
+            return !any();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool test(size_type row) const noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
 
-                size_t i = start;
+            return (words_[row / 64u] >> (row % 64u)) & 1u;
+        }
 
-                SOAGEN_TRY
-                {
-                    for (const size_t e = start + count; i < e; i++)
-                        default_construct_row(columns, i);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    destruct_rows(columns, start, i - start);
-                    throw;
-                }
-#endif
-            }
+        row_bitset& set(size_type row) noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
+
+            words_[row / 64u] |= std::uint64_t{ 1 } << (row % 64u);
+            return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
-        SOAGEN_CONSTEXPR_20
-        static void construct_rows_for_overwrite([[maybe_unused]] column_pointers& columns,
-                                                 [[maybe_unused]] size_t start,
-                                                 [[maybe_unused]] size_t count) //
-            noexcept(all_nothrow_default_constructible)
+        row_bitset& reset(size_type row) noexcept
         {
-            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
-            {
-                (column<I>::default_construct_for_overwrite(columns[I], start, count), ...);
-            }
-            else
-            {
-                [[maybe_unused]]
-                size_t constructed_columns = {};
+            SOAGEN_ASSERT(row < size_);
 
-                const auto constructor = [&](auto ic) //
-                {
-                    column_from_ic<decltype(ic)>::default_construct_for_overwrite(columns[decltype(ic)::value],
-                                                                                  start,
-                                                                                  count);
-                    constructed_columns++;
-                };
+            words_[row / 64u] &= ~(std::uint64_t{ 1 } << (row % 64u));
+            return *this;
+        }
 
-                SOAGEN_TRY
-                {
-                    (constructor(index_constant<I>{}), ...);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    const auto destructor = [&](auto ic) //
-                    {
-                        if (decltype(ic)::value < constructed_columns)
-                            for (size_t i = start, e = start + count; i < e; i++)
-                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
-                    };
-                    (destructor(index_constant<I>{}), ...);
-                    throw;
-                }
-#endif
-            }
+        SOAGEN_PURE_GETTER
+        optional<size_type> first() const noexcept
+        {
+            for (size_type w = 0; w < words_.size(); w++)
+                if (words_[w])
+                    return w * 64u + static_cast<size_type>(countr_zero(words_[w]));
+            return {};
         }
 
-        //--- construction ---------------------------------------------------------------------------------------------
+        row_bitset& flip() noexcept
+        {
+            for (auto& w : words_)
+                w = ~w;
+            if (!words_.empty())
+                mask_tail();
+            return *this;
+        }
 
-      private:
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename Tuple, auto sfinae = row_constructible_from<Tuple&&>)
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void construct_row_from_tuple(column_pointers& columns,
-                                             size_t index,
-                                             Tuple&& tuple) //
-            noexcept(row_nothrow_constructible_from<Tuple&&>)
+        row_bitset& operator&=(const row_bitset& rhs) noexcept
         {
-            static_assert(std::tuple_size_v<detail::remove_cvref<Tuple>> == column_count);
+            SOAGEN_ASSERT(size_ == rhs.size_);
 
-            construct_row(columns, index, get_from_tuple<I>(static_cast<Tuple&&>(tuple))...);
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] &= rhs.words_[w];
+            return *this;
         }
 
-      public:
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename... Args, auto sfinae = row_constructible_from<Args&&...>)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void construct_row(column_pointers& columns, size_t index, Args&&... args) //
-            noexcept(row_nothrow_constructible_from<Args&&...>)
+        row_bitset& operator|=(const row_bitset& rhs) noexcept
         {
-            if constexpr (sizeof...(Args) == 0)
-            {
-                default_construct_row(columns, index, static_cast<Args&&>(args)...);
-            }
-            else if constexpr (sizeof...(Args) == 1 && (is_tuple<detail::remove_cvref<Args>> && ...))
-            {
-                construct_row_from_tuple(columns, index, static_cast<Args&&>(args)...);
-            }
-            else
-            {
-                static_assert(sizeof...(Args) == sizeof...(I));
+            SOAGEN_ASSERT(size_ == rhs.size_);
 
-                if constexpr (row_nothrow_constructible_from<Args&&...> || all_trivially_destructible)
-                {
-                    (column<I>::construct_at(columns[I], index, static_cast<Args&&>(args)), ...);
-                }
-                else
-                {
-                    // machinery to provide strong-exception guarantee
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] |= rhs.words_[w];
+            return *this;
+        }
 
-                    [[maybe_unused]]
-                    size_t constructed_columns = {};
+        row_bitset& operator^=(const row_bitset& rhs) noexcept
+        {
+            SOAGEN_ASSERT(size_ == rhs.size_);
 
-                    const auto constructor =
-                        [&](auto ic, auto&& arg) noexcept(
-                            column_from_ic<decltype(ic)>::template is_nothrow_constructible<decltype(arg)>)
-                    {
-                        static_assert(std::is_reference_v<decltype(arg)>);
+            for (size_type w = 0; w < words_.size(); w++)
+                words_[w] ^= rhs.words_[w];
+            return *this;
+        }
 
-                        column_from_ic<decltype(ic)>::construct_at(columns[decltype(ic)::value],
-                                                                   index,
-                                                                   static_cast<decltype(arg)>(arg));
+        SOAGEN_NODISCARD
+        friend row_bitset operator&(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs &= rhs);
+        }
 
-                        constructed_columns++;
-                    };
+        SOAGEN_NODISCARD
+        friend row_bitset operator|(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs |= rhs);
+        }
 
-                    SOAGEN_TRY
-                    {
-                        (constructor(index_constant<I>{}, static_cast<Args&&>(args)), ...);
-                    }
-#if SOAGEN_HAS_EXCEPTIONS
-                    catch (...)
-                    {
-                        if (constructed_columns)
-                            destruct_row(columns, index, 0u, constructed_columns - 1u);
-                        throw;
-                    }
-#endif
-                }
-            }
+        SOAGEN_NODISCARD
+        friend row_bitset operator^(row_bitset lhs, const row_bitset& rhs) noexcept
+        {
+            return static_cast<row_bitset&&>(lhs ^= rhs);
         }
 
-        //--- move-construction ----------------------------------------------------------------------------------------
+        SOAGEN_NODISCARD
+        friend row_bitset operator~(row_bitset set) noexcept
+        {
+            return static_cast<row_bitset&&>(set.flip());
+        }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_construct_row(column_pointers& dest,
-                                       size_t dest_index,
-                                       column_pointers& source,
-                                       size_t source_index) //
-            noexcept(all_nothrow_move_constructible)
+        SOAGEN_PURE_GETTER
+        friend bool operator==(const row_bitset& lhs, const row_bitset& rhs) noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+            return lhs.size_ == rhs.size_ && lhs.words_ == rhs.words_;
+        }
 
-            if constexpr (all_nothrow_move_constructible || all_trivially_destructible)
-            {
-                (column<I>::move_construct(dest[I], dest_index, source[I], source_index), ...);
-            }
-            else
-            {
-                // machinery to provide strong-exception guarantee
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const row_bitset& lhs, const row_bitset& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
 
-                [[maybe_unused]]
-                size_t constructed_columns = {};
+        SOAGEN_PURE_INLINE_GETTER
+        iterator begin() const noexcept
+        {
+            return { words_.data(), words_.size(), 0u };
+        }
 
-                const auto constructor =
-                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_move_constructible)
-                {
-                    column_from_ic<decltype(ic)>::move_construct(dest[decltype(ic)::value],
-                                                                 dest_index,
-                                                                 source[decltype(ic)::value],
-                                                                 source_index);
+        SOAGEN_PURE_INLINE_GETTER
+        iterator end() const noexcept
+        {
+            return { words_.data(), words_.size(), words_.size() };
+        }
+    };
 
-                    constructed_columns++;
-                };
+    template <typename Key, typename KeyEqual = std::equal_to<Key>>
+    class bitmap_index
+    {
+      public:
+        using key_type = Key;
 
-                SOAGEN_TRY
-                {
-                    (constructor(index_constant<I>{}), ...);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    if (constructed_columns)
-                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
-                    throw;
-                }
-#endif
-            }
+        using key_equal = KeyEqual;
+
+        using size_type = std::size_t;
+
+      private:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        std::vector<key_type> values_;
+        std::vector<row_bitset> bitsets_;
+        std::vector<size_type> counts_;
+        row_bitset spare_; // storage for the next new value, so adding one after reserve() doesn't allocate
+        size_type rows_ = {};
+        key_equal key_equal_;
+
+        SOAGEN_PURE_GETTER
+        size_type slot_of(const key_type& key) const noexcept
+        {
+            for (size_type i = 0; i < values_.size(); i++)
+                if (key_equal_(values_[i], key))
+                    return i;
+            return npos;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_construct_rows(column_pointers& dest,
-                                        size_t dest_start,
-                                        column_pointers& source,
-                                        size_t source_start,
-                                        size_t count) //
-            noexcept(all_nothrow_move_constructible)
+        size_type slot_for(const key_type& key)
         {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+            if (const auto slot = slot_of(key); slot != npos)
+                return slot;
 
-            if constexpr (all_trivially_copyable)
-            {
-                memmove(dest, dest_start, source, source_start, count);
-            }
-            else
-            {
-                [[maybe_unused]]
-                size_t cleanup_start = dest_start;
-                [[maybe_unused]]
-                size_t cleanup_count = 0;
+            // everything that can throw happens before any of the vectors are grown, so they stay in step
+            values_.reserve(values_.size() + 1u);
+            counts_.reserve(values_.size() + 1u);
+            bitsets_.reserve(values_.size() + 1u);
+            spare_.resize(rows_);
+            for (auto& w : spare_.words_)
+                w = 0u;
 
-                const auto constructor = [&]() noexcept(all_nothrow_move_constructible)
-                {
-                    if (&dest == &source && dest_start > source_start)
-                    {
-                        for (size_t i = count; i-- > 0u;)
-                        {
-                            move_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_start = dest_start + i;
-                            cleanup_count++;
-                        }
-                    }
-                    else
-                    {
-                        for (size_t i = 0; i < count; i++)
-                        {
-                            move_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_count++;
-                        }
-                    }
-                };
+            values_.push_back(key);
+            counts_.push_back(0u);
+            bitsets_.push_back(static_cast<row_bitset&&>(spare_));
+            spare_ = row_bitset{};
+            return values_.size() - 1u;
+        }
 
-                if constexpr (all_nothrow_move_constructible)
-                {
-                    constructor();
-                }
-                else
-                {
-                    // machinery to provide strong-exception guarantee
+        void drop_empty_values() noexcept
+        {
+            for (size_type i = values_.size(); i-- > 0u;)
+            {
+                if (counts_[i])
+                    continue;
 
-                    SOAGEN_TRY
-                    {
-                        constructor();
-                    }
-#if SOAGEN_HAS_EXCEPTIONS
-                    catch (...)
-                    {
-                        destruct_rows(dest, cleanup_start, cleanup_count);
-                        throw;
-                    }
-#endif
+                if (i + 1u < values_.size())
+                {
+                    using std::swap;
+                    swap(values_[i], values_.back());
+                    swap(counts_[i], counts_.back());
+                    swap(bitsets_[i], bitsets_.back());
                 }
+                values_.pop_back();
+                counts_.pop_back();
+                if (bitsets_.back().words_.capacity() > spare_.words_.capacity())
+                    spare_ = static_cast<row_bitset&&>(bitsets_.back());
+                bitsets_.pop_back();
             }
         }
 
-        //--- copy-construction ----------------------------------------------------------------------------------------
+        void resize_all(size_type rows)
+        {
+            rows_ = rows;
+            for (auto& b : bitsets_)
+                b.resize(rows);
+        }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void copy_construct_row(column_pointers& dest,
-                                       size_t dest_index,
-                                       const const_column_pointers& source,
-                                       size_t source_index) //
-            noexcept(all_nothrow_copy_constructible)
+      public:
+        SOAGEN_NODISCARD_CTOR
+        bitmap_index() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        explicit bitmap_index(const key_equal& eq) //
+            : key_equal_{ eq }
+        {}
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+            return rows_;
+        }
 
-            if constexpr (all_nothrow_copy_constructible || all_trivially_destructible)
-            {
-                (column<I>::copy_construct(dest[I], dest_index, source[I], source_index), ...);
-            }
-            else
-            {
-                // machinery to provide strong-exception guarantee
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !rows_;
+        }
 
-                [[maybe_unused]]
-                size_t constructed_columns = {};
+        SOAGEN_PURE_INLINE_GETTER
+        size_type cardinality() const noexcept
+        {
+            return values_.size();
+        }
 
-                const auto constructor =
-                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_copy_constructible)
-                {
-                    column_from_ic<decltype(ic)>::copy_construct(dest[decltype(ic)::value],
-                                                                 dest_index,
-                                                                 source[decltype(ic)::value],
-                                                                 source_index);
+        void reserve(size_type rows)
+        {
+            drop_empty_values(); // left behind by the two-argument overload if the table modification threw
 
-                    constructed_columns++;
-                };
+            values_.reserve(values_.size() + 1u);
+            counts_.reserve(values_.size() + 1u);
+            bitsets_.reserve(values_.size() + 1u);
+            spare_.reserve(rows);
+            for (auto& b : bitsets_)
+                b.reserve(rows);
+        }
 
-                SOAGEN_TRY
-                {
-                    (constructor(index_constant<I>{}), ...);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    if (constructed_columns)
-                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
-                    throw;
-                }
-#endif
-            }
+        template <typename K>
+        void reserve(size_type rows, const K& key)
+        {
+            reserve(rows);
+            if constexpr (std::is_same_v<K, key_type>)
+                slot_for(key);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void copy_construct_rows(column_pointers& dest,
-                                        size_t dest_start,
-                                        const const_column_pointers& source,
-                                        size_t source_start,
-                                        size_t count) //
-            noexcept(all_nothrow_copy_constructible)
+        SOAGEN_NODISCARD
+        row_bitset matching(const key_type& key) const
         {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+            if (const auto slot = slot_of(key); slot != npos)
+                return bitsets_[slot];
+            return row_bitset{ rows_ };
+        }
 
-            if constexpr (all_trivially_copyable)
+        SOAGEN_PURE_GETTER
+        size_type count(const key_type& key) const noexcept
+        {
+            const auto slot = slot_of(key);
+            return slot != npos ? counts_[slot] : 0u;
+        }
+
+        SOAGEN_NODISCARD
+        optional<size_type> find(const key_type* /* keys */, const key_type& key) const noexcept
+        {
+            if (const auto slot = slot_of(key); slot != npos)
+                return bitsets_[slot].first();
+            return {};
+        }
+
+        void rebuild(const key_type* keys, size_type count)
+        {
+            clear();
+            rows_ = count;
+            for (size_type row = 0; row < count; row++)
             {
-                memmove(dest, dest_start, source, source_start, count);
+                const auto slot = slot_for(keys[row]);
+                bitsets_[slot].set(row);
+                counts_[slot]++;
             }
-            else
-            {
-                [[maybe_unused]]
-                size_t cleanup_start = dest_start;
-                [[maybe_unused]]
-                size_t cleanup_count = 0;
+        }
 
-                const auto constructor = [&]() noexcept(all_nothrow_copy_constructible)
-                {
-                    if (&dest == &source && dest_start > source_start)
-                    {
-                        for (size_t i = count; i-- > 0u;)
-                        {
-                            copy_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_start = dest_start + i;
-                            cleanup_count++;
-                        }
-                    }
-                    else
-                    {
-                        for (size_t i = 0; i < count; i++)
-                        {
-                            copy_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_count++;
-                        }
-                    }
-                };
+        void clear() noexcept
+        {
+            values_.clear();
+            bitsets_.clear();
+            counts_.clear();
+            rows_ = 0;
+        }
 
-                if constexpr (all_nothrow_copy_constructible)
-                {
-                    constructor();
-                }
-                else
-                {
-                    // machinery to provide strong-exception guarantee
-                    SOAGEN_TRY
-                    {
-                        constructor();
-                    }
-#if SOAGEN_HAS_EXCEPTIONS
-                    catch (...)
-                    {
-                        destruct_rows(dest, cleanup_start, cleanup_count);
-                        throw;
-                    }
-#endif
-                }
-            }
+        void push_back(const key_type* keys, size_type row)
+        {
+            const auto slot = slot_for(keys[row]);
+            resize_all(row + 1u);
+            bitsets_[slot].set(row);
+            counts_[slot]++;
         }
 
-        //--- move-or-copy-construction (whichever is possible per-column) ---------------------------------------------
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            const auto slot = slot_for(keys[row]);
+            for (auto& b : bitsets_)
+                b.insert_row(row);
+            rows_ = count;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_or_copy_construct_row(column_pointers& dest,
-                                               size_t dest_index,
-                                               column_pointers& source,
-                                               size_t source_index) //
-            noexcept(all_nothrow_move_or_copy_constructible)
+            bitsets_[slot].set(row);
+            counts_[slot]++;
+        }
+
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+            static_cast<void>(count);
+            SOAGEN_ASSERT(count == rows_);
 
-            if constexpr (all_nothrow_move_or_copy_constructible || all_trivially_destructible)
+            counts_[slot_of(keys[row])]--;
+            for (auto& b : bitsets_)
+                b.erase_row(row);
+            rows_--;
+            drop_empty_values();
+        }
+
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            SOAGEN_ASSERT(count == rows_);
+
+            const auto slot = slot_of(keys[row]);
+            bitsets_[slot].reset(row);
+            counts_[slot]--;
+
+            if (row + 1u < count)
             {
-                (column<I>::move_or_copy_construct(dest[I], dest_index, source[I], source_index), ...);
+                auto& last = bitsets_[slot_of(keys[count - 1u])];
+                last.reset(count - 1u);
+                last.set(row);
             }
-            else
+
+            for (auto& b : bitsets_)
+                b.resize(count - 1u); // shrinking; doesn't allocate
+            rows_--;
+            drop_empty_values();
+        }
+
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
             {
-                // machinery to provide strong-exception guarantee
+                clear();
+                return;
+            }
 
-                [[maybe_unused]]
-                size_t constructed_columns = {};
+            for (size_type row = count - num; row < count; row++)
+                counts_[slot_of(keys[row])]--;
+            for (auto& b : bitsets_)
+                b.resize(count - num);
+            rows_ = count - num;
+            drop_empty_values();
+        }
 
-                const auto constructor =
-                    [&](auto ic) noexcept(column_from_ic<decltype(ic)>::is_nothrow_move_or_copy_constructible)
-                {
-                    column_from_ic<decltype(ic)>::move_or_copy_construct(dest[decltype(ic)::value],
-                                                                         dest_index,
-                                                                         source[decltype(ic)::value],
-                                                                         source_index);
+        void swap(bitmap_index& other) noexcept
+        {
+            using std::swap;
+            values_.swap(other.values_);
+            bitsets_.swap(other.bitsets_);
+            counts_.swap(other.counts_);
+            swap(spare_, other.spare_);
+            swap(rows_, other.rows_);
+            swap(key_equal_, other.key_equal_);
+        }
+    };
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  sorted_index.hpp  ******************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <algorithm>
+#include <functional>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-                    constructed_columns++;
-                };
+namespace soagen
+{
+    class row_indices
+    {
+      public:
+        using size_type = std::size_t;
 
-                SOAGEN_TRY
-                {
-                    (constructor(index_constant<I>{}), ...);
-                }
-#if SOAGEN_HAS_EXCEPTIONS
-                catch (...)
-                {
-                    if (constructed_columns)
-                        destruct_row(dest, dest_index, 0u, constructed_columns - 1u);
-                    throw;
-                }
-#endif
-            }
-        }
+        using iterator = const size_type*;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_constructible)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_or_copy_construct_rows(column_pointers& dest,
-                                                size_t dest_start,
-                                                column_pointers& source,
-                                                size_t source_start,
-                                                size_t count) //
-            noexcept(all_nothrow_move_or_copy_constructible)
-        {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+        using const_iterator = const size_type*;
 
-            if constexpr (all_trivially_copyable)
-            {
-                memmove(dest, dest_start, source, source_start, count);
-            }
-            else
-            {
-                [[maybe_unused]]
-                size_t cleanup_start = dest_start;
-                [[maybe_unused]]
-                size_t cleanup_count = 0;
+      private:
+        const size_type* first_ = {};
+        const size_type* last_  = {};
 
-                const auto constructor = [&]() noexcept(all_nothrow_move_or_copy_constructible)
-                {
-                    if (&dest == &source && dest_start > source_start)
-                    {
-                        for (size_t i = count; i-- > 0u;)
-                        {
-                            move_or_copy_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_start = dest_start + i;
-                            cleanup_count++;
-                        }
-                    }
-                    else
-                    {
-                        for (size_t i = 0; i < count; i++)
-                        {
-                            move_or_copy_construct_row(dest, dest_start + i, source, source_start + i);
-                            cleanup_count++;
-                        }
-                    }
-                };
+      public:
+        SOAGEN_NODISCARD_CTOR
+        constexpr row_indices() noexcept = default;
 
-                if constexpr (all_nothrow_move_or_copy_constructible)
-                {
-                    constructor();
-                }
-                else
-                {
-                    // machinery to provide strong-exception guarantee
+        SOAGEN_NODISCARD_CTOR
+        constexpr row_indices(const size_type* first, const size_type* last) noexcept //
+            : first_{ first },
+              last_{ last }
+        {}
 
-                    SOAGEN_TRY
-                    {
-                        constructor();
-                    }
-#if SOAGEN_HAS_EXCEPTIONS
-                    catch (...)
-                    {
-                        destruct_rows(dest, cleanup_start, cleanup_count);
-                        throw;
-                    }
-#endif
-                }
-            }
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type size() const noexcept
+        {
+            return static_cast<size_type>(last_ - first_);
         }
 
-        //--- move-assignment ------------------------------------------------------------------------------------------
-
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_assign_row(column_pointers& dest,
-                                    size_t dest_index,
-                                    column_pointers& source,
-                                    size_t source_index) //
-            noexcept(all_nothrow_move_assignable)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool empty() const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+            return first_ == last_;
+        }
 
-            // todo: how to provide a strong-exception guarantee here?
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type operator[](size_type pos) const noexcept
+        {
+            SOAGEN_CONSTEXPR_SAFE_ASSERT(pos < size());
 
-            (column<I>::move_assign(dest[I], dest_index, source[I], source_index), ...);
+            return first_[pos];
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_assign_rows(column_pointers& dest,
-                                     size_t dest_start,
-                                     column_pointers& source,
-                                     size_t source_start,
-                                     size_t count) //
-            noexcept(all_nothrow_copy_assignable)
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator begin() const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+            return first_;
+        }
 
-            if constexpr (all_trivially_copyable)
-            {
-                memmove(dest, dest_start, source, source_start, count);
-            }
-            else
-            {
-                if (&dest == &source && dest_start > source_start)
-                {
-                    for (size_t i = count; i-- > 0u;)
-                        move_assign_row(dest, dest_start + i, source, source_start + i);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; i++)
-                        move_assign_row(dest, dest_start + i, source, source_start + i);
-                }
-            }
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator end() const noexcept
+        {
+            return last_;
         }
+    };
 
-        //--- copy-assignment ------------------------------------------------------------------------------------------
+    template <typename Key, typename Compare = std::less<Key>>
+    class sorted_index
+    {
+      public:
+        using key_type = Key;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void copy_assign_row(column_pointers& dest,
-                                    size_t dest_index,
-                                    const const_column_pointers& source,
-                                    size_t source_index) //
-            noexcept(all_nothrow_copy_assignable)
-        {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
+        using key_compare = Compare;
 
-            // todo: how to provide a strong-exception guarantee here?
+        using size_type = std::size_t;
 
-            (column<I>::copy_assign(dest[I], dest_index, source[I], source_index), ...);
+      private:
+        std::vector<size_type> rows_;
+        key_compare compare_;
+
+        // the index's ordering: by key, then by row index, so every row has exactly one place in it
+        SOAGEN_PURE_GETTER
+        bool precedes(const key_type* keys, size_type lhs, const key_type& key, size_type rhs) const noexcept
+        {
+            return compare_(keys[lhs], key) || (!compare_(key, keys[lhs]) && lhs < rhs);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_copy_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void copy_assign_rows(column_pointers& dest,
-                                     size_t dest_start,
-                                     const const_column_pointers& source,
-                                     size_t source_start,
-                                     size_t count) //
-            noexcept(all_nothrow_copy_assignable)
+        // position of the given (key, row) pair in the ordering
+        SOAGEN_PURE_GETTER
+        size_type position(const key_type* keys, const key_type& key, size_type row) const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
 
-            if constexpr (all_trivially_copyable)
-            {
-                memmove(dest, dest_start, source, source_start, count);
-            }
-            else
+            SOAGEN_ASSUME(keys != nullptr);
+
+            const size_type* base = rows_.data();
+            while (n > 1u)
             {
-                if (&dest == &source && dest_start > source_start)
-                {
-                    for (size_t i = count; i-- > 0u;)
-                        copy_assign_row(dest, dest_start + i, source, source_start + i);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; i++)
-                        copy_assign_row(dest, dest_start + i, source, source_start + i);
-                }
+                const size_type half = n / 2u;
+                base                 = precedes(keys, base[half], key, row) ? base + half : base;
+                n -= half;
             }
+            return static_cast<size_type>(base - rows_.data())
+                 + static_cast<size_type>(precedes(keys, *base, key, row));
         }
 
-        //--- move-or-copy-assignment (whichever is possible per-column) -----------------------------------------------
-
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_or_copy_assign_row(column_pointers& dest,
-                                            size_t dest_index,
-                                            column_pointers& source,
-                                            size_t source_index) //
-            noexcept(all_nothrow_move_or_copy_assignable)
+        SOAGEN_PURE_GETTER
+        size_type locate(const key_type* keys, size_type row) const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_index != source_index);
-
-            // todo: how to provide a strong-exception guarantee here?
+            SOAGEN_ASSUME(keys != nullptr);
 
-            (column<I>::move_or_copy_assign(dest[I], dest_index, source[I], source_index), ...);
+            const auto pos = position(keys, keys[row], row);
+            SOAGEN_ASSERT(pos < rows_.size() && rows_[pos] == row && "row was not in the index");
+            return min(pos, rows_.size() - 1u);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_or_copy_assignable)
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        static void move_or_copy_assign_rows(column_pointers& dest,
-                                             size_t dest_start,
-                                             column_pointers& source,
-                                             size_t source_start,
-                                             size_t count) //
-            noexcept(all_nothrow_move_or_copy_assignable)
+        // position of a newly-added row
+        SOAGEN_PURE_GETTER
+        size_type placement(const key_type* keys, size_type row) const noexcept
         {
-            SOAGEN_ASSUME(&dest != &source || dest_start != source_start);
+            if (rows_.empty() || precedes(keys, rows_.back(), keys[row], row))
+                return rows_.size();
+            return position(keys, keys[row], row);
+        }
 
-            if constexpr (all_trivially_copyable)
-            {
-                memmove(dest, dest_start, source, source_start, count);
-            }
-            else
-            {
-                if (&dest == &source && dest_start > source_start)
-                {
-                    for (size_t i = count; i-- > 0u;)
-                        move_or_copy_assign_row(dest, dest_start + i, source, source_start + i);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; i++)
-                        move_or_copy_assign_row(dest, dest_start + i, source, source_start + i);
-                }
-            }
+      public:
+        SOAGEN_NODISCARD_CTOR
+        sorted_index() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        explicit sorted_index(const key_compare& comp) //
+            : compare_{ comp }
+        {}
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return rows_.size();
         }
 
-        //--- swap rows ------------------------------------------------------------------------------------------------
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return rows_.empty();
+        }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_swappable)
-        SOAGEN_CONSTEXPR_20
-        static void swap_rows(column_pointers& lhs,
-                              size_t lhs_index,
-                              column_pointers& rhs,
-                              size_t rhs_index) //
-            noexcept(all_nothrow_swappable)
+        SOAGEN_PURE_INLINE_GETTER
+        row_indices rows() const noexcept
         {
-            (column<I>::swap(lhs[I], lhs_index, rhs[I], rhs_index), ...);
+            return { rows_.data(), rows_.data() + rows_.size() };
         }
 
-        //--- swap columns ---------------------------------------------------------------------------------------------
+        void reserve(size_type rows)
+        {
+            rows_.reserve(rows);
+        }
 
-        template <auto A, auto B>
-        static constexpr bool can_swap_columns =
-            static_cast<size_t>(A) == static_cast<size_t>(B)
-            || (std::is_same_v<storage_type<A>, storage_type<B>> && column<A>::is_swappable);
+        SOAGEN_PURE_GETTER
+        size_type lower_bound(const key_type* keys, const key_type& key) const noexcept
+        {
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
 
-        template <auto A, auto B>
-        static constexpr bool can_nothrow_swap_columns =
-            static_cast<size_t>(A) == static_cast<size_t>(B)
-            || (std::is_same_v<storage_type<A>, storage_type<B>> && column<A>::is_nothrow_swappable);
+            SOAGEN_ASSUME(keys != nullptr);
 
-        SOAGEN_HIDDEN_CONSTRAINT((can_swap_columns<A, B>), auto A, auto B)
-        SOAGEN_CONSTEXPR_20
-        static void swap_columns([[maybe_unused]] column_pointers& columns,
-                                 [[maybe_unused]] size_t start,
-                                 [[maybe_unused]] size_t count) //
-            noexcept(can_nothrow_swap_columns<A, B>)
-        {
-            if constexpr (static_cast<size_t>(A) != static_cast<size_t>(B))
+            // branchless: the loop body compiles to a conditional move, so there are no mispredictions to pay for
+            const size_type* base = rows_.data();
+            while (n > 1u)
             {
-                static_assert(std::is_same_v<storage_type<A>, storage_type<B>>);
-                static_assert(column<A>::is_swappable);
-                static_assert(column<B>::is_swappable);
-
-                column<A>::swap(columns[A], start, columns[B], start, count);
+                const size_type half = n / 2u;
+                base                 = compare_(keys[base[half]], key) ? base + half : base;
+                n -= half;
             }
+            return static_cast<size_type>(base - rows_.data()) + static_cast<size_type>(compare_(keys[*base], key));
         }
 
-        //--- equality -------------------------------------------------------------------------------------------------
-
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_equality_comparable)
-        SOAGEN_NODISCARD
-        static constexpr bool equal(const const_column_pointers& lhs,
-                                    size_t lhs_start,
-                                    const const_column_pointers& rhs,
-                                    size_t rhs_start,
-                                    size_t count) //
-            noexcept(all_nothrow_equality_comparable)
+        SOAGEN_PURE_GETTER
+        size_type upper_bound(const key_type* keys, const key_type& key) const noexcept
         {
-            // note that the equality-comparison is done column-major for speed (cache-locality) because
-            // equality-comparison does not need to know anything about the order of the columns,
-            // just that they are all equal (there is no lexicographic constraint)
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
 
-            return (column<I>::equal(lhs[I], lhs_start, rhs[I], rhs_start, count) && ...);
-        }
+            SOAGEN_ASSUME(keys != nullptr);
 
-        //--- compare --------------------------------------------------------------------------------------------------
+            const size_type* base = rows_.data();
+            while (n > 1u)
+            {
+                const size_type half = n / 2u;
+                base                 = !compare_(key, keys[base[half]]) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_type>(base - rows_.data()) + static_cast<size_type>(!compare_(key, keys[*base]));
+        }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_less_than_comparable)
         SOAGEN_NODISCARD
-        static constexpr int compare(const const_column_pointers& lhs,
-                                     size_t lhs_start,
-                                     const const_column_pointers& rhs,
-                                     size_t rhs_start,
-                                     size_t count) //
-            noexcept(all_nothrow_less_than_comparable)
+        optional<size_type> find(const key_type* keys, const key_type& key) const noexcept
         {
-            for (size_t i = 0; i < count; i++)
-            {
-                int result = 0;
-                (void)(((result = column<I>::less_than(lhs[I], lhs_start + i, rhs[I], rhs_start + i)
-                                    ? -1
-                                    : (column<I>::less_than(rhs[I], rhs_start + i, lhs[I], lhs_start + i) ? 1 : 0)),
-                        result != 0)
-                       || ...);
-                if (result != 0)
-                    return result;
-            }
+            const auto pos = lower_bound(keys, key);
+            if (pos < rows_.size() && !compare_(key, keys[rows_[pos]]))
+                return rows_[pos];
+            return {};
+        }
 
-            return 0;
+        SOAGEN_NODISCARD
+        row_indices equal_range(const key_type* keys, const key_type& key) const noexcept
+        {
+            return { rows_.data() + lower_bound(keys, key), rows_.data() + upper_bound(keys, key) };
         }
-    };
 
-    // a more specialzed base that sees the full column traits, not just the base version.
-    // (this is just for things that need the specialized information _and_ the column indices)
-    template <typename...>
-    struct table_traits_base_specialized;
+        SOAGEN_NODISCARD
+        row_indices range(const key_type* keys, const key_type& lo, const key_type& hi) const noexcept
+        {
+            const auto first = lower_bound(keys, lo);
+            const auto last  = max(first, lower_bound(keys, hi));
+            return { rows_.data() + first, rows_.data() + last };
+        }
 
-    template <size_t... I, typename... Columns>
-    struct table_traits_base_specialized<std::index_sequence<I...>, Columns...> //
-        : public table_traits_base<std::index_sequence<I...>, to_base_traits<Columns>...>
-    {
-        static_assert((... && is_column_traits<Columns>), "columns must be instances of soagen::column_traits");
+        void rebuild(const key_type* keys, size_type count)
+        {
+            rows_.resize(count);
+            for (size_type row = 0; row < count; row++)
+                rows_[row] = row;
 
-        //
-    };
-}
+            std::stable_sort(rows_.begin(),
+                             rows_.end(),
+                             [&](size_type lhs, size_type rhs) noexcept(noexcept(compare_(keys[lhs], keys[rhs])))
+                             { return compare_(keys[lhs], keys[rhs]); });
+        }
 
-namespace soagen
-{
-    template <typename... Columns>
-    struct SOAGEN_EMPTY_BASES table_traits //
-        SOAGEN_HIDDEN_BASE(public detail::table_traits_base_specialized<std::make_index_sequence<sizeof...(Columns)>,
-                                                                        detail::as_column<Columns>...>)
-    {
-        static constexpr size_t column_count = sizeof...(Columns);
-        static_assert(column_count, "tables must have at least one column");
+        void clear() noexcept
+        {
+            rows_.clear();
+        }
 
-        static constexpr size_t aligned_stride = lcm(size_t{ 1 }, detail::as_column<Columns>::aligned_stride...);
+        void push_back(const key_type* keys, size_type row)
+        {
+            rows_.insert(rows_.begin() + static_cast<std::ptrdiff_t>(placement(keys, row)), row);
+        }
 
-        // columns
-        // (note that these hide the base class typedefs - this is intentional)
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            if (row + 1u < count)
+            {
+                for (auto& r : rows_)
+                    if (r >= row)
+                        r++;
+            }
+            push_back(keys, row);
+        }
 
-        template <auto Index>
-        using column =
-            detail::type_at_index<static_cast<size_t>(Index), detail::as_column<Columns>...>;
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(locate(keys, row)));
+            if (row + 1u < count)
+            {
+                for (auto& r : rows_)
+                    if (r > row)
+                        r--;
+            }
+        }
 
-        template <typename IndexConstant>
-        using column_from_ic =
-            detail::type_at_index<static_cast<size_t>(detail::remove_cvref<IndexConstant>::value),
-                                  detail::as_column<Columns>...>;
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(locate(keys, row)));
+            if (row + 1u == count)
+                return;
 
-        static constexpr size_t column_alignments[column_count] = { detail::as_column<Columns>::alignment... };
+            // the last row keeps its value but takes on a lower index, so it can only move ahead of equal keys
+            const auto from = locate(keys, count - 1u);
+            const auto to   = position(keys, keys[count - 1u], row);
+            std::rotate(rows_.begin() + static_cast<std::ptrdiff_t>(to),
+                        rows_.begin() + static_cast<std::ptrdiff_t>(from),
+                        rows_.begin() + static_cast<std::ptrdiff_t>(from + 1u));
+            rows_[to] = row;
+        }
 
-        static constexpr size_t largest_alignment = max(size_t{ 1 }, detail::as_column<Columns>::alignment...);
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
+            {
+                clear();
+                return;
+            }
 
-        static constexpr bool rvalues_are_distinct =
-            !(std::is_same_v<typename detail::as_column<Columns>::param_type,
-                                                        typename detail::as_column<Columns>::rvalue_type>
-                                         && ...);
+            // only the part of the index from the first popped row onwards needs compacting. finding it costs one
+            // binary search per row, which stops paying for itself once a sizeable fraction of the rows are going
+            const size_type new_count = count - num;
+            size_type first           = 0u;
+            if (num <= rows_.size() / 8u)
+            {
+                first = rows_.size();
+                for (size_type row = new_count; row < count; row++)
+                    first = min(first, locate(keys, row));
+            }
 
-        template <typename BackingTable, typename... Args>
-        static constexpr bool emplace_back_is_nothrow =
-            detail::has_nothrow_emplace_back_member<BackingTable, Args...>::value;
+            rows_.erase(std::remove_if(rows_.begin() + static_cast<std::ptrdiff_t>(first),
+                                       rows_.end(),
+                                       [=](size_type r) noexcept { return r >= new_count; }),
+                        rows_.end());
+        }
 
-        template <typename BackingTable>
-        static constexpr bool push_back_is_nothrow =
-            emplace_back_is_nothrow<BackingTable, typename detail::as_column<Columns>::param_forward_type...>;
+        void swap(sorted_index& other) noexcept
+        {
+            using std::swap;
+            rows_.swap(other.rows_);
+            swap(compare_, other.compare_);
+        }
+    };
+}
 
-        template <typename BackingTable>
-        static constexpr bool rvalue_push_back_is_nothrow =
-            emplace_back_is_nothrow<BackingTable, typename detail::as_column<Columns>::rvalue_forward_type...>;
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-        template <typename BackingTable, typename Row>
-        static constexpr bool row_push_back_is_nothrow = emplace_back_is_nothrow<BackingTable, Row>;
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-        template <typename BackingTable, typename... Args>
-        static constexpr bool emplace_is_nothrow =
-            detail::has_nothrow_emplace_member<BackingTable, std::size_t, Args...>::value;
+//********  handles.hpp  ***********************************************************************************************
 
-        template <typename BackingTable>
-        static constexpr bool insert_is_nothrow =
-            emplace_is_nothrow<BackingTable, typename detail::as_column<Columns>::param_forward_type...>;
+SOAGEN_DISABLE_WARNINGS;
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
 
-        template <typename BackingTable>
-        static constexpr bool rvalue_insert_is_nothrow =
-            emplace_is_nothrow<BackingTable, typename detail::as_column<Columns>::rvalue_forward_type...>;
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-        template <typename BackingTable, typename Row>
-        static constexpr bool row_insert_is_nothrow = emplace_is_nothrow<BackingTable, Row>;
-    };
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-    namespace detail
+namespace soagen
+{
+    template <typename Tag>
+    struct row_handle
     {
-        template <typename>
-        struct is_table_traits_ : std::false_type
-        {};
-        template <typename... Columns>
-        struct is_table_traits_<table_traits<Columns...>> : std::true_type
-        {};
-        template <typename... Columns>
-        struct is_table_traits_<detail::table_traits_base<Columns...>> : std::true_type
-        {};
-    }
+        std::uint32_t slot = static_cast<std::uint32_t>(-1);
 
-    template <typename T>
-    inline constexpr bool is_table_traits =
-        detail::is_table_traits_<std::remove_cv_t<T>>::value;
-}
+        std::uint32_t generation = {};
 
-namespace soagen::detail
-{
-    template <typename... Columns>
-    struct to_base_traits_<table_traits<Columns...>>
-    {
-        using type = table_traits_base<to_base_traits<as_column<Columns>>...>;
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator bool() const noexcept
+        {
+            return slot != static_cast<std::uint32_t>(-1);
+        }
 
-        static_assert(std::is_base_of_v<type, table_traits<Columns...>>);
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator==(const row_handle& lhs, const row_handle& rhs) noexcept
+        {
+            return lhs.slot == rhs.slot && lhs.generation == rhs.generation;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend constexpr bool operator!=(const row_handle& lhs, const row_handle& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
     };
-}
 
-//********  mixins/rows.hpp  *******************************************************************************************
+    template <typename Tag>
+    class handle_table
+    {
+      public:
+        using handle_type = row_handle<Tag>;
 
-namespace soagen::mixins
-{
-    template <typename Derived, typename...>
-    struct SOAGEN_EMPTY_BASES rows;
+        using size_type = std::size_t;
 
-    template <typename Derived, size_t... Columns>
-    struct SOAGEN_EMPTY_BASES rows<Derived, std::index_sequence<Columns...>>
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
-        static_assert(std::is_same_v<column_indices<Derived>, std::index_sequence<Columns...>>);
+      private:
+        static constexpr std::uint32_t no_slot = static_cast<std::uint32_t>(-1);
 
-        using size_type       = std::size_t;
-        using row_type        = soagen::row_type<Derived>;
-        using rvalue_row_type = soagen::rvalue_row_type<Derived>;
-        using const_row_type  = soagen::const_row_type<Derived>;
+        struct slot
+        {
+            std::uint32_t row; // the slot's row while in use, or the next free slot
+            std::uint32_t generation;
+        };
 
-        template <auto... Cols>
-        SOAGEN_PURE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Derived, Cols...> row(size_type index) & noexcept
+        std::vector<slot> slots_;
+        std::vector<std::uint32_t> rows_; // row index -> slot
+        std::uint32_t free_ = no_slot;
+
+        std::uint32_t acquire(size_type row)
         {
-            if constexpr (sizeof...(Cols))
-            {
-                return { static_cast<value_ref<Derived, Cols>>(
-                    static_cast<Derived&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
-            }
-            else
+            SOAGEN_ASSERT(row < no_slot && "handle tables are limited to 2^32 - 1 rows");
+
+            if (free_ != no_slot)
             {
-                return { static_cast<value_ref<Derived, Columns>>(
-                    static_cast<Derived&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
+                const auto s  = free_;
+                free_         = slots_[s].row;
+                slots_[s].row = static_cast<std::uint32_t>(row);
+                return s;
             }
+
+            slots_.push_back({ static_cast<std::uint32_t>(row), 0u });
+            return static_cast<std::uint32_t>(slots_.size() - 1u);
+        }
+
+        void release(std::uint32_t s) noexcept
+        {
+            slots_[s].generation++;
+            slots_[s].row = free_;
+            free_         = s;
+        }
+
+        void renumber(size_type first) noexcept
+        {
+            for (size_type row = first; row < rows_.size(); row++)
+                slots_[rows_[row]].row = static_cast<std::uint32_t>(row);
+        }
+
+      public:
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return rows_.size();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return rows_.empty();
         }
 
-        template <auto... Cols>
         SOAGEN_PURE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::rvalue_row_type<Derived, Cols...> row(size_type index) && noexcept
+        handle_type handle_of(size_type row) const noexcept
         {
-#if SOAGEN_MSVC
-            // https://developercommunity.visualstudio.com/t/C:-Corrupt-references-when-creating-a/10446877
-            return static_cast<soagen::rvalue_row_type<Derived, Cols...>>(
-                static_cast<Derived&>(*this).template row<Cols...>(index));
-#else
+            SOAGEN_ASSERT(row < rows_.size());
 
-            if constexpr (sizeof...(Cols))
-            {
-                return { static_cast<value_ref<Derived&&, Cols>>(
-                    static_cast<Derived&&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
-            }
-            else
-            {
-                return { static_cast<value_ref<Derived&&, Columns>>(
-                    static_cast<Derived&&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
-            }
-#endif
+            const auto s = rows_[row];
+            return { s, slots_[s].generation };
         }
 
-        template <auto... Cols>
         SOAGEN_PURE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::const_row_type<Derived, Cols...> row(size_type index) const& noexcept
+        optional<size_type> index_of(const handle_type& handle) const noexcept
         {
-            if constexpr (sizeof...(Cols))
-            {
-                return { static_cast<value_ref<const Derived, Cols>>(
-                    static_cast<const Derived&>(*this).template column<static_cast<size_type>(Cols)>()[index])... };
-            }
-            else
-            {
-                return { static_cast<value_ref<const Derived, Columns>>(
-                    static_cast<const Derived&>(*this).template column<static_cast<size_type>(Columns)>()[index])... };
-            }
+            if (handle.slot >= slots_.size())
+                return {};
+
+            const auto& s = slots_[handle.slot];
+            if (s.generation != handle.generation || s.row >= rows_.size() || rows_[s.row] != handle.slot)
+                return {};
+
+            return static_cast<size_type>(s.row);
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        row_type operator[](size_type index) & noexcept
+        void reserve(size_type rows)
         {
-            return row(index);
+            rows_.reserve(rows);
+
+            // slots_.size() - rows_.size() of them are free
+            if (rows > rows_.size())
+                slots_.reserve(slots_.size() + (rows - rows_.size()));
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        rvalue_row_type operator[](size_type index) && noexcept
+        void clear() noexcept
         {
-            return static_cast<rows&&>(*this).row(index);
+            for (auto s : rows_)
+                release(s);
+            rows_.clear();
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        const_row_type operator[](size_type index) const& noexcept
+        void push_back(size_type row)
         {
-            return row(index);
+            SOAGEN_ASSERT(row == rows_.size());
+
+            rows_.push_back(acquire(row));
         }
 
-#if SOAGEN_HAS_EXCEPTIONS
+        void insert(size_type row, size_type /* count */)
+        {
+            rows_.insert(rows_.begin() + static_cast<std::ptrdiff_t>(row), acquire(row));
+            renumber(row + 1u);
+        }
 
-        template <auto... Cols>
-        SOAGEN_NODISCARD
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Derived, Cols...> at(size_type index) &
+        void erase(size_type row, size_type /* count */) noexcept
         {
-            if (index >= static_cast<const Derived&>(*this).size())
-                throw std::out_of_range{ "bad element access" };
-            return row<static_cast<size_type>(Cols)...>(index);
+            release(rows_[row]);
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(row));
+            renumber(row);
         }
 
-        template <auto... Cols>
-        SOAGEN_NODISCARD
-        SOAGEN_CONSTEXPR_20
-        soagen::rvalue_row_type<Derived, Cols...> at(size_type index) &&
+        void unordered_erase(size_type row, size_type count) noexcept
         {
-            if (index >= static_cast<const Derived&>(*this).size())
-                throw std::out_of_range{ "bad element access" };
+            release(rows_[row]);
+            if (row + 1u < count)
+            {
+                rows_[row]             = rows_.back();
+                slots_[rows_[row]].row = static_cast<std::uint32_t>(row);
+            }
+            rows_.pop_back();
+        }
 
-            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(index);
+        void pop_back(size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            for (size_type i = 0; i < num; i++)
+            {
+                release(rows_.back());
+                rows_.pop_back();
+            }
         }
 
-        template <auto... Cols>
-        SOAGEN_NODISCARD
-        SOAGEN_CONSTEXPR_20
-        soagen::const_row_type<Derived, Cols...> at(size_type index) const&
+        void swap(handle_table& other) noexcept
         {
-            if (index >= static_cast<const Derived&>(*this).size())
-                throw std::out_of_range{ "bad element access" };
-            return row<static_cast<size_type>(Cols)...>(index);
+            using std::swap;
+            slots_.swap(other.slots_);
+            rows_.swap(other.rows_);
+            swap(free_, other.free_);
+        }
+    };
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  concurrent.hpp  ********************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen
+{
+    template <typename Soa>
+    class concurrent_appender
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<Soa>, "Soa may not be const.");
+        static_assert(!detail::has_row_observers<Soa>,
+                      "concurrent_appender can't be used with types that have indexes or handles.");
+
+      public:
+        using soa_type = Soa;
+
+        using size_type = std::size_t;
+
+      private:
+        using table  = table_type<Soa>;
+        using traits = table_traits_type<Soa>;
+
+        table& table_;
+        std::atomic<size_type> claimed_;   // next row to hand out (may overshoot capacity_)
+        std::atomic<size_type> committed_; // every row below this is fully constructed
+        std::atomic<size_type> capacity_;
+        std::atomic<size_type> writers_ = 0; // threads between claiming a row and publishing it
+        std::atomic<bool> growing_      = false;
+        std::unique_ptr<std::atomic<bool>[]> ready_; // indexed by row
+        std::mutex grow_mutex_;
+
+        void reset_ready_flags(size_type capacity)
+        {
+            ready_.reset(new std::atomic<bool>[capacity]);
+            for (size_type i = 0; i < capacity; i++)
+                ready_[i].store(false, std::memory_order_relaxed);
+        }
+
+        void publish() noexcept
+        {
+            // advance the watermark over any contiguous run of finished rows; whichever thread finishes the row at the
+            // watermark carries it forward over rows finished out-of-order by others
+            auto c             = committed_.load();
+            const auto max_row = capacity_.load();
+            while (c < max_row && ready_[c].load())
+            {
+                if (committed_.compare_exchange_weak(c, c + 1u))
+                    c++;
+            }
+        }
+
+        void grow()
+        {
+            std::lock_guard<std::mutex> lock{ grow_mutex_ };
+            if (claimed_.load() < capacity_.load())
+                return; // another thread got here first
+
+            growing_.store(true);
+            while (writers_.load())
+                std::this_thread::yield();
+
+            // nobody is mid-row, so every claimed row below capacity has been constructed
+            const auto cap       = capacity_.load();
+            const auto committed = min(claimed_.load(), cap);
+            detail::table_storage_access::set_size(table_, committed);
+            committed_.store(committed);
+            claimed_.store(committed);
+
+            const auto new_cap = cap > table_.max_size() / 2u ? table_.max_size() : max(cap * 2u, size_type{ 64 });
+            if SOAGEN_UNLIKELY(new_cap <= committed)
+            {
+                growing_.store(false);
+                SOAGEN_THROW(std::bad_alloc{});
+            }
+
+#if SOAGEN_HAS_EXCEPTIONS
+            try
+            {
+                table_.reserve(new_cap);
+                reset_ready_flags(new_cap);
+            }
+            catch (...)
+            {
+                growing_.store(false);
+                throw;
+            }
+#else
+            table_.reserve(new_cap);
+            reset_ready_flags(new_cap);
+#endif
+            capacity_.store(new_cap);
+            growing_.store(false);
         }
 
-#endif
+        template <typename Tuple, size_t... Columns>
+        static constexpr bool row_is_nothrow_constructible(std::index_sequence<Columns...>) noexcept
+        {
+            return (noexcept(traits::template column<Columns>::construct_at(std::declval<std::byte*>(),
+                                                                            size_t{},
+                                                                            std::get<Columns>(std::declval<Tuple>())))
+                    && ...);
+        }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Derived, Cols...> front() & noexcept
+        template <typename Tuple, size_t... Columns>
+        void construct_row(size_type row, Tuple&& args, std::index_sequence<Columns...>) noexcept
         {
-            return row<static_cast<size_type>(Cols)...>(0u);
+            const auto& alloc = detail::table_storage_access::allocation(table_);
+            (traits::template column<Columns>::construct_at(alloc.columns[Columns],
+                                                            row,
+                                                            std::get<Columns>(static_cast<Tuple&&>(args))),
+             ...);
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::row_type<Derived, Cols...> back() & noexcept
+      public:
+        SOAGEN_NODISCARD_CTOR
+        explicit concurrent_appender(Soa& soa, size_type rows = 0) //
+            : table_{ static_cast<table&>(soa) },
+              claimed_{ table_.size() },
+              committed_{ table_.size() }
+        {
+            size_type cap = table_.size();
+            if SOAGEN_UNLIKELY(!detail::add_without_overflowing(cap, max(rows, size_type{ 1 }), cap)
+                               || cap > table_.max_size())
+                SOAGEN_THROW(std::bad_alloc{});
+
+            table_.reserve(cap);
+            cap = table_.capacity();
+            reset_ready_flags(cap);
+            capacity_.store(cap);
+        }
+
+        concurrent_appender(const concurrent_appender&)            = delete;
+        concurrent_appender& operator=(const concurrent_appender&) = delete;
+
+        ~concurrent_appender() noexcept
         {
-            return row<static_cast<size_type>(Cols)...>(static_cast<const Derived&>(*this).size() - 1u);
+            commit();
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::rvalue_row_type<Derived, Cols...> front() && noexcept
+        template <typename... Args>
+        size_type emplace_back(Args&&... args)
         {
-            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(0u);
+            static_assert(sizeof...(Args) == traits::column_count, "an argument must be provided for each column");
+
+            using args_tuple = std::tuple<Args&&...>;
+            static_assert(row_is_nothrow_constructible<args_tuple>(std::make_index_sequence<sizeof...(Args)>{}),
+                          "each column must be nothrow-constructible from its argument");
+
+            for (;;)
+            {
+                writers_.fetch_add(1u);
+                if (!growing_.load())
+                {
+                    const auto row = claimed_.fetch_add(1u);
+                    if (row < capacity_.load())
+                    {
+                        construct_row(row,
+                                      args_tuple{ static_cast<Args&&>(args)... },
+                                      std::make_index_sequence<sizeof...(Args)>{});
+                        ready_[row].store(true);
+                        publish();
+                        writers_.fetch_sub(1u);
+                        return row;
+                    }
+                }
+                writers_.fetch_sub(1u);
+                grow();
+            }
         }
 
-        template <auto... Cols>
         SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::rvalue_row_type<Derived, Cols...> back() && noexcept
+        size_type committed_size() const noexcept
         {
-            return static_cast<rows&&>(*this).template row<static_cast<size_type>(Cols)...>(
-                static_cast<const Derived&>(*this).size() - 1u);
+            return committed_.load(std::memory_order_acquire);
         }
 
-        template <auto... Cols>
         SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::const_row_type<Derived, Cols...> front() const& noexcept
+        size_type capacity() const noexcept
         {
-            return row<static_cast<size_type>(Cols)...>(0u);
+            return capacity_.load(std::memory_order_relaxed);
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        soagen::const_row_type<Derived, Cols...> back() const& noexcept
+        void commit() noexcept
         {
-            return row<static_cast<size_type>(Cols)...>(static_cast<const Derived&>(*this).size() - 1u);
+            SOAGEN_ASSERT(!writers_.load());
+            SOAGEN_ASSERT(committed_.load() == min(claimed_.load(), capacity_.load()));
+
+            detail::table_storage_access::set_size(table_, committed_.load());
         }
     };
-
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES rows<Derived> : rows<Derived, column_indices<Derived>>
-    {};
 }
 
-//********  source_offset.hpp  *****************************************************************************************
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-#define SOAGEN_DETECT_INTEGER(name, trait)                                                                             \
-    template <typename T>                                                                                              \
-    using name##_trait_ = decltype(trait);                                                                             \
-    template <typename T, bool = is_detected<name##_trait_, T>::value>                                                 \
-    struct name##_ : std::disjunction<std::is_integral<detail::remove_cvref<decltype(trait)>>,                         \
-                                      std::is_enum<detail::remove_cvref<decltype(trait)>>,                             \
-                                      std::is_constructible<std::size_t, decltype(trait)>>                             \
-    {};                                                                                                                \
-    template <typename T>                                                                                              \
-    struct name##_<T, false> : std::false_type                                                                         \
-    {}
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-namespace soagen
-{
-    namespace detail
-    {
-        // static function T::source_offset()
-        SOAGEN_DETECT_INTEGER(has_source_offset_static_func, detail::remove_cvref<T>::source_offset());
+//********  snapshot.hpp  **********************************************************************************************
 
-        // static var T::source_offset
-        SOAGEN_DETECT_INTEGER(has_source_offset_static_var, detail::remove_cvref<T>::source_offset);
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
 
-        // member function t.source_offset()
-        SOAGEN_DETECT_INTEGER(has_source_offset_member_func, std::declval<const T&>().source_offset());
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-        // member var t.source_offset
-        SOAGEN_DETECT_INTEGER(has_source_offset_member_var,
-                              std::declval<const T&>().*(&detail::remove_cvref<T>::source_offset));
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-        // ADL
-        namespace adl_dummy
-        {
-            void source_offset();
-            template <typename T>
-            using has_source_offset_adl_trait_ = decltype(source_offset(std::declval<const T&>()));
-        }
-        template <typename T>
-        using has_source_offset_adl_ = is_detected<adl_dummy::has_source_offset_adl_trait_, T>;
-    }
+namespace soagen::detail
+{
+    // a fixed-capacity block of one column's elements, shared between a cow_table and its snapshots
+    template <typename Column, size_t Rows>
+    class cow_chunk
+    {
+        using storage_type = typename Column::storage_type;
+        using value_type   = typename Column::value_type;
 
-    template <typename T>
-    inline constexpr bool has_source_offset =
-        std::disjunction_v<detail::has_source_offset_static_func_<T>,
-                                                      detail::has_source_offset_member_func_<T>,
-                                                      detail::has_source_offset_member_var_<T>,
-                                                      detail::has_source_offset_static_var_<T>,
-                                                      detail::has_source_offset_adl_<T>>;
+        static constexpr size_t buffer_size = sizeof(storage_type) * Rows;
 
-    template <typename T>
-    SOAGEN_PURE_INLINE_GETTER
-    constexpr std::size_t get_source_offset([[maybe_unused]] const T& object) noexcept
-    {
-        // note that order is important here -
-        // we have to try to detect member functions and vars before static vars
+        std::atomic<size_t> refs_ = 1;
+        size_t count_             = 0; // constructed elements
+        std::byte* data_;
 
-        if constexpr (detail::has_source_offset_static_func_<T>::value)
-        {
-            return static_cast<size_t>(detail::remove_cvref<T>::source_offset());
-        }
-        else if constexpr (detail::has_source_offset_member_func_<T>::value)
-        {
-            return static_cast<size_t>(object.source_offset());
-        }
-        else if constexpr (detail::has_source_offset_member_var_<T>::value)
-        {
-            return static_cast<size_t>(object.source_offset);
-        }
-        else if constexpr (detail::has_source_offset_static_var_<T>::value)
-        {
-            return static_cast<size_t>(detail::remove_cvref<T>::source_offset);
-        }
-        else if constexpr (detail::has_source_offset_adl_<T>::value)
-        {
-            using detail::adl_dummy::source_offset;
-            return static_cast<size_t>(source_offset(object));
-        }
-        else
-            return {};
-    }
-}
+      public:
+        cow_chunk() //
+            : data_{ allocator{}.allocate(buffer_size, std::align_val_t{ Column::alignment }) }
+        {}
 
-#undef SOAGEN_DETECT_INTEGER
+        cow_chunk(const cow_chunk&)            = delete;
+        cow_chunk& operator=(const cow_chunk&) = delete;
 
-//********  mixins/iterators.hpp  **************************************************************************************
+        ~cow_chunk() noexcept
+        {
+            truncate(0);
+            allocator{}.deallocate(data_, buffer_size);
+        }
 
-namespace soagen::mixins
-{
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES iterators
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+        SOAGEN_NODISCARD
+        cow_chunk* clone(size_t count) const
+        {
+            SOAGEN_ASSERT(count <= count_);
 
-        using difference_type = std::ptrdiff_t;
-        using iterator        = soagen::iterator_type<Derived>;
-        using rvalue_iterator = soagen::rvalue_iterator_type<Derived>;
-        using const_iterator  = soagen::const_iterator_type<Derived>;
+            std::unique_ptr<cow_chunk> c{ new cow_chunk };
+            for (; c->count_ < count; c->count_++)
+                Column::copy_construct(c->data_, c->count_, data_, c->count_);
+            return c.release();
+        }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr iterator_type<Derived, Cols...> begin() & noexcept
+        void acquire() noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&>(*this), 0 };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
-            }
+            refs_.fetch_add(1u, std::memory_order_relaxed);
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr iterator_type<Derived, Cols...> end() & noexcept
+        void release() noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&>(*this),
-                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
-                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
+            if (refs_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                delete this;
         }
 
-        template <auto... Cols>
+        // acquire pairs with release() so that readers dropping their reference happen-before the writer reuses it
         SOAGEN_PURE_INLINE_GETTER
-        constexpr rvalue_iterator_type<Derived, Cols...> begin() && noexcept
-        {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&&>(*this), 0 };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
-            }
+        bool shared() const noexcept
+        {
+            return refs_.load(std::memory_order_acquire) != 1u;
         }
 
-        template <auto... Cols>
         SOAGEN_PURE_INLINE_GETTER
-        constexpr rvalue_iterator_type<Derived, Cols...> end() && noexcept
+        size_t size() const noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&&>(*this),
-                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
-                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
+            return count_;
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr const_iterator_type<Derived, Cols...> begin() const& noexcept
+        template <typename Arg>
+        void emplace_back(Arg&& arg)
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<const Derived&>(*this), 0 };
-            }
-            else
-            {
-                return { static_cast<const soa_type<Derived>&>(static_cast<const Derived&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this))) };
-            }
+            SOAGEN_ASSERT(count_ < Rows);
+
+            Column::construct_at(data_, count_, static_cast<Arg&&>(arg));
+            count_++;
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr const_iterator_type<Derived, Cols...> end() const& noexcept
+        void truncate(size_t count) noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<const Derived&>(*this),
-                         static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
-            else
-            {
-                return { static_cast<const soa_type<Derived>&>(static_cast<Derived&&>(*this)),
-                         static_cast<difference_type>(get_source_offset(static_cast<const Derived&>(*this)))
-                             + static_cast<difference_type>(static_cast<const Derived&>(*this).size()) };
-            }
+            while (count_ > count)
+                Column::destruct(data_, --count_);
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr const_iterator_type<Derived, Cols...> cbegin() const noexcept
+        SOAGEN_PURE_GETTER
+        value_type* elements() noexcept
         {
-            return begin<Cols...>();
+            if constexpr (std::is_pointer_v<storage_type>)
+                return SOAGEN_LAUNDER(reinterpret_cast<value_type*>(data_));
+            else
+                return Column::ptr(data_);
         }
 
-        template <auto... Cols>
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr const_iterator_type<Derived, Cols...> cend() const noexcept
+        SOAGEN_PURE_GETTER
+        const value_type* elements() const noexcept
         {
-            return end<Cols...>();
+            return const_cast<cow_chunk&>(*this).elements();
         }
     };
-}
 
-//********  mixins/spans.hpp  ******************************************************************************************
-
-namespace soagen::mixins
-{
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES spans
+    // an owning reference to a cow_chunk
+    template <typename Chunk>
+    class cow_chunk_ref
     {
-        static_assert(!detail::is_cvref<Derived>::value);
+        Chunk* ptr_ = {};
 
-        using size_type        = std::size_t;
-        using span_type        = soagen::span_type<Derived>;
-        using rvalue_span_type = soagen::rvalue_span_type<Derived>;
-        using const_span_type  = soagen::const_span_type<Derived>;
+      public:
+        cow_chunk_ref() noexcept = default;
 
-        SOAGEN_PURE_INLINE_GETTER
-        span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) & noexcept
+        explicit cow_chunk_ref(Chunk* ptr) noexcept //
+            : ptr_{ ptr }
+        {}
+
+        cow_chunk_ref(const cow_chunk_ref& other) noexcept //
+            : ptr_{ other.ptr_ }
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&>(*this), start, count };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&>(static_cast<Derived&>(*this)),
-                         get_source_offset(static_cast<const Derived&>(*this)) + start,
-                         detail::calc_span_count(start,
-                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
-                                                 count) };
-            }
+            if (ptr_)
+                ptr_->acquire();
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        rvalue_span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) && noexcept
+        cow_chunk_ref(cow_chunk_ref&& other) noexcept //
+            : ptr_{ std::exchange(other.ptr_, nullptr) }
+        {}
+
+        cow_chunk_ref& operator=(cow_chunk_ref other) noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<Derived&&>(*this), start, count };
-            }
-            else
-            {
-                return { static_cast<soa_type<Derived>&&>(static_cast<Derived&&>(*this)),
-                         get_source_offset(static_cast<const Derived&>(*this)) + start,
-                         detail::calc_span_count(start,
-                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
-                                                 count) };
-            }
+            std::swap(ptr_, other.ptr_);
+            return *this;
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        const_span_type subspan(size_type start, size_type count = static_cast<size_type>(-1)) const& noexcept
+        ~cow_chunk_ref() noexcept
         {
-            if constexpr (std::is_same_v<soa_type<detail::remove_cvref<Derived>>, Derived>)
-            {
-                return { static_cast<const Derived&>(*this), start, count };
-            }
-            else
-            {
-                return { static_cast<const soa_type<Derived>&>(static_cast<const Derived&>(*this)),
-                         get_source_offset(static_cast<const Derived&>(*this)) + start,
-                         detail::calc_span_count(start,
-                                                 static_cast<size_type>(static_cast<const Derived&>(*this).size()),
-                                                 count) };
-            }
+            if (ptr_)
+                ptr_->release();
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        const_span_type const_subspan(size_type start, size_type count = static_cast<size_type>(-1)) const noexcept
+        Chunk* operator->() const noexcept
         {
-            return subspan(start, count);
+            SOAGEN_ASSUME(ptr_ != nullptr);
+            return ptr_;
         }
     };
-}
 
-//********  table.hpp  *************************************************************************************************
+    template <typename Soa, size_t Rows, typename = std::make_index_sequence<table_traits_type<Soa>::column_count>>
+    struct cow_columns_;
 
-namespace soagen::detail
-{
-    SOAGEN_CONSTRAINED_TEMPLATE(detail::is_unsigned<T>::value, typename T)
-    SOAGEN_NODISCARD
-    constexpr bool add_without_overflowing(T lhs, T rhs, T& result) noexcept
+    template <typename Soa, size_t Rows, size_t... Columns>
+    struct cow_columns_<Soa, Rows, std::index_sequence<Columns...>>
     {
-        if (lhs > static_cast<T>(-1) - rhs)
-            return false;
-
-        result = lhs + rhs;
-        return true;
+        using type = std::tuple<
+            std::vector<cow_chunk_ref<cow_chunk<typename table_traits_type<Soa>::template column<Columns>, Rows>>>...>;
     };
+}
 
-    //------------------------------------------------------------------------------------------------------------------
-    // generic allocation classes for tracking the column pointers and the actual size in bytes
-    //------------------------------------------------------------------------------------------------------------------
+namespace soagen
+{
+    template <typename Soa, size_t ChunkRows>
+    class cow_table;
 
-    struct table_allocation_base
+    template <typename Soa, size_t ChunkRows = 1024>
+    class cow_snapshot
     {
-        std::byte* ptr;
-        size_t size;
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(has_single_bit(ChunkRows), "ChunkRows must be a power of two.");
 
-        SOAGEN_PURE_INLINE_GETTER
-        explicit constexpr operator bool() const noexcept
-        {
-            return !!ptr;
-        }
-    };
+      public:
+        using soa_type = Soa;
 
-    template <size_t ColumnCount>
-    struct table_allocation : table_allocation_base
-    {
-        std::byte* columns[ColumnCount];
-    };
+        using size_type = std::size_t;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // base class for handling allocation and deallocation
-    //------------------------------------------------------------------------------------------------------------------
+        static constexpr size_type chunk_rows = ChunkRows;
 
-    template <typename Allocator>
-    class SOAGEN_EMPTY_BASES table_allocate //
-    {
-        static_assert(!detail::is_cvref<Allocator>::value, "allocators may not be cvref-qualified");
+      private:
+        friend class cow_table<Soa, ChunkRows>;
+
+        typename detail::cow_columns_<Soa, ChunkRows>::type columns_;
+        size_type size_ = 0;
 
       public:
-        using allocator_type = Allocator;
+        SOAGEN_NODISCARD_CTOR
+        cow_snapshot() = default;
 
-      protected:
-        static constexpr bool allocate_is_nothrow =
-            noexcept(allocator_traits<Allocator>::allocate(std::declval<Allocator&>(), size_t{}, std::align_val_t{}));
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
 
-        // guard against allocators with incorrect pointer typedefs where possible
-        using allocator_pointer_type = std::remove_reference_t<
-            decltype(allocator_traits<Allocator>::allocate(std::declval<Allocator&>(), size_t{}, std::align_val_t{}))>;
-        static_assert(std::is_pointer_v<allocator_pointer_type>);
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !size_;
+        }
 
-        SOAGEN_NODISCARD
-        SOAGEN_NEVER_INLINE
-        constexpr table_allocation_base allocate(allocator_type& alloc,
-                                                 size_t size,
-                                                 size_t alignment) noexcept(allocate_is_nothrow)
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
         {
-            SOAGEN_ASSUME(size);
-            SOAGEN_ASSUME((static_cast<size_t>(alignment) & (static_cast<size_t>(alignment) - 1u)) == 0u);
+            SOAGEN_ASSERT(row < size_);
 
-            const auto ptr = soagen::assume_aligned<allocator_traits<Allocator>::min_alignment>(
-                allocator_traits<Allocator>::allocate(
-                    alloc,
-                    size,
-                    std::align_val_t{ max(alignment, allocator_traits<Allocator>::min_alignment) }));
+            return std::get<static_cast<size_t>(Column)>(columns_)[row / chunk_rows]->elements()[row % chunk_rows];
+        }
 
-            SOAGEN_ASSUME(ptr != nullptr);
+        SOAGEN_PURE_INLINE_GETTER
+        size_type chunk_count() const noexcept
+        {
+            return (size_ + (chunk_rows - 1u)) / chunk_rows;
+        }
 
-            if constexpr (std::is_same_v<allocator_pointer_type, std::byte*>)
-                return { ptr, size };
-            else
-                return { reinterpret_cast<std::byte*>(ptr), size };
+        SOAGEN_PURE_GETTER
+        size_type chunk_size(size_type chunk) const noexcept
+        {
+            SOAGEN_ASSERT(chunk < chunk_count());
+
+            return min(size_ - chunk * chunk_rows, chunk_rows);
         }
 
-        SOAGEN_NEVER_INLINE
-        constexpr void deallocate(allocator_type& alloc, const table_allocation_base& al) noexcept
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>* chunk(size_type chunk) const noexcept
         {
-            if constexpr (std::is_same_v<allocator_pointer_type, std::byte*>)
-                allocator_traits<Allocator>::deallocate(alloc, al.ptr, al.size);
-            else
-                allocator_traits<Allocator>::deallocate(alloc,
-                                                        reinterpret_cast<allocator_pointer_type>(al.ptr),
-                                                        al.size);
+            SOAGEN_ASSERT(chunk < chunk_count());
+
+            return std::get<static_cast<size_t>(Column)>(columns_)[chunk]->elements();
         }
     };
 
-    //------------------------------------------------------------------------------------------------------------------
-    // base class for handling general boilerplate
-    //------------------------------------------------------------------------------------------------------------------
+    template <typename Soa, size_t ChunkRows = 1024>
+    class cow_table
+    {
+      public:
+        using soa_type = Soa;
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_allocate
-#undef SOAGEN_BASE_TYPE
-#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Allocator>
+        using size_type = std::size_t;
 
-    template <size_t ColumnCount, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_storage //
-        : public SOAGEN_BASE_TYPE
-    {
-        static_assert(ColumnCount, "tables must have at least one column");
+        using snapshot_type = cow_snapshot<Soa, ChunkRows>;
+
+        static constexpr size_type chunk_rows = ChunkRows;
 
       private:
-        using base = SOAGEN_BASE_TYPE;
+        using traits = table_traits_type<Soa>;
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-        using size_type       = size_t;
-        using difference_type = ptrdiff_t;
-        using allocator_type  = Allocator;
+        template <size_t Column>
+        using chunk_type = detail::cow_chunk<typename traits::template column<Column>, ChunkRows>;
 
-      protected:
-        using allocation = table_allocation<ColumnCount>;
+        template <size_t Column>
+        using chunk_ref = detail::cow_chunk_ref<chunk_type<Column>>;
 
-        allocation alloc_ = {};
-        size_t count_     = {};
-        compressed_pair<size_t, Allocator> capacity_;
+        snapshot_type data_;
 
-      public:
-        SOAGEN_NODISCARD_CTOR
-        explicit constexpr table_storage(const Allocator& alloc) noexcept //
-            : capacity_{ size_t{}, alloc }
+        template <size_t Column>
+        auto& chunks() noexcept
         {
-            static_assert(std::is_nothrow_copy_constructible_v<Allocator>,
-                          "allocators must be nothrow copy-constructible");
+            return std::get<Column>(data_.columns_);
         }
 
-        SOAGEN_NODISCARD_CTOR
-        explicit constexpr table_storage(Allocator&& alloc) noexcept //
-            : capacity_{ size_t{}, static_cast<Allocator&&>(alloc) }
+        // gives the table exclusive ownership of a chunk, copying its first `count` elements if it was shared
+        template <size_t Column>
+        chunk_type<Column>& unshare(size_type chunk, size_type count)
         {
-            static_assert(std::is_nothrow_move_constructible_v<Allocator>,
-                          "allocators must be nothrow move-constructible");
+            auto& ref = chunks<Column>()[chunk];
+            if (ref->shared())
+                ref = chunk_ref<Column>{ ref->clone(count) };
+            return *ref.operator->();
         }
 
-        SOAGEN_NODISCARD_CTOR
-        constexpr table_storage(table_storage&& other) noexcept //
-            : alloc_{ std::exchange(other.alloc_, allocation{}) },
-              count_{ std::exchange(other.count_, size_t{}) },
-              capacity_{ std::exchange(other.capacity_.first(), size_t{}), static_cast<Allocator&&>(other.allocator()) }
+        template <size_t Column>
+        void prepare_back()
         {
-            static_assert(std::is_nothrow_move_constructible_v<Allocator>,
-                          "allocators must be nothrow move-constructible");
+            const auto chunk = data_.size_ / chunk_rows;
+            auto& list       = chunks<Column>();
+            if (chunk == list.size())
+                list.push_back(chunk_ref<Column>{ new chunk_type<Column> });
+            else
+                unshare<Column>(chunk, data_.size_ % chunk_rows);
         }
 
-        // conditionally-implemented in specialized child classes:
-        table_storage()                                = delete;
-        table_storage& operator=(table_storage&&)      = delete;
-        table_storage(const table_storage&)            = delete;
-        table_storage& operator=(const table_storage&) = delete;
+        template <size_t Column, typename Arg>
+        void construct_back(Arg&& arg)
+        {
+            chunks<Column>()[data_.size_ / chunk_rows]->emplace_back(static_cast<Arg&&>(arg));
+        }
 
-        ~table_storage() noexcept
+        template <size_t Column>
+        void destroy_back() noexcept
         {
-            static_assert(std::is_nothrow_destructible_v<Allocator>, "allocators must be nothrow destructible");
+            auto& c = chunks<Column>()[data_.size_ / chunk_rows];
+            c->truncate(c->size() - 1u);
+        }
 
-            // element destructors are run in a more specialized child class
+        template <size_t Column>
+        void truncate(size_type new_size) noexcept
+        {
+            auto& list       = chunks<Column>();
+            const auto keep  = (new_size + (chunk_rows - 1u)) / chunk_rows;
+            const auto first = list.begin() + static_cast<std::ptrdiff_t>(min(keep, list.size()));
+            list.erase(first, list.end());
 
-            if (alloc_)
-                base::deallocate(allocator(), alloc_);
+            if (keep && new_size % chunk_rows)
+                list.back()->truncate(new_size % chunk_rows);
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr size_t size() const noexcept
+        template <typename Tuple, size_t... Columns>
+        void emplace_back_(Tuple&& args, std::index_sequence<Columns...>)
         {
-            return count_;
+            (prepare_back<Columns>(), ...);
+
+            // if a column throws, the ones constructed before it are rolled back
+            [[maybe_unused]] size_type constructed = 0;
+#if SOAGEN_HAS_EXCEPTIONS
+            try
+            {
+#endif
+                ((construct_back<Columns>(std::get<Columns>(static_cast<Tuple&&>(args))), constructed++), ...);
+#if SOAGEN_HAS_EXCEPTIONS
+            }
+            catch (...)
+            {
+                ((Columns < constructed ? destroy_back<Columns>() : void()), ...);
+                throw;
+            }
+#endif
+            data_.size_++;
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr bool empty() const noexcept
+        template <size_t... Columns>
+        void pop_back_(size_type new_size, std::index_sequence<Columns...>)
         {
-            return !count_;
+            // un-share the new last chunks up-front so the destructive part can't fail midway through
+            if (new_size % chunk_rows)
+                (unshare<Columns>(new_size / chunk_rows, new_size % chunk_rows), ...);
+
+            (truncate<Columns>(new_size), ...);
+            data_.size_ = new_size;
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr size_t capacity() const noexcept
+        template <size_t... Columns>
+        void copy_from(const table_type<Soa>& src, std::index_sequence<Columns...>)
         {
-            return capacity_.first();
+            (
+                [&]() //
+                {
+                    const auto* values = src.template column<Columns>();
+                    auto& list         = chunks<Columns>();
+                    list.reserve((src.size() + (chunk_rows - 1u)) / chunk_rows);
+                    for (size_type row = 0; row < src.size(); row++)
+                    {
+                        if (row % chunk_rows == 0u)
+                            list.push_back(chunk_ref<Columns>{ new chunk_type<Columns> });
+                        list.back()->emplace_back(values[row]);
+                    }
+                }(),
+                ...);
+            data_.size_ = src.size();
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr size_t allocation_size() const noexcept
+      public:
+        SOAGEN_NODISCARD_CTOR
+        cow_table() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        explicit cow_table(const Soa& soa)
         {
-            return alloc_.size;
+            copy_from(static_cast<const table_type<Soa>&>(soa), std::make_index_sequence<traits::column_count>{});
         }
 
-        SOAGEN_INLINE_GETTER
-        SOAGEN_CONSTEXPR_20
-        Allocator get_allocator() const noexcept
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
         {
-            return capacity_.second();
+            return data_.size();
         }
 
-      protected:
         SOAGEN_PURE_INLINE_GETTER
-        constexpr Allocator& allocator() noexcept
+        bool empty() const noexcept
         {
-            return capacity_.second();
+            return data_.empty();
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr const Allocator& allocator() const noexcept
+        SOAGEN_NODISCARD
+        snapshot_type snapshot() const
         {
-            return capacity_.second();
+            return data_;
         }
-    };
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: default-constructibility
-    //------------------------------------------------------------------------------------------------------------------
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
+        {
+            return data_.template get<Column>(row);
+        }
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_storage
-#undef SOAGEN_BASE_TYPE
-#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<ColumnCount, Allocator>
+        template <auto Column>
+        SOAGEN_NODISCARD
+        value_type<Soa, Column>& get_for_write(size_type row)
+        {
+            SOAGEN_ASSERT(row < size());
 
-    template <size_t ColumnCount,
-              typename Allocator,
-              bool = std::is_default_constructible_v<Allocator>>
-    class SOAGEN_EMPTY_BASES table_default_construct //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+            constexpr auto col = static_cast<size_t>(Column);
+            auto& c            = unshare<col>(row / chunk_rows, chunks<col>()[row / chunk_rows]->size());
+            return c.elements()[row % chunk_rows];
+        }
 
-        SOAGEN_DEFAULT_RULE_OF_FOUR(table_default_construct);
+        template <auto Column, typename Value>
+        void set(size_type row, Value&& value)
+        {
+            get_for_write<Column>(row) = static_cast<Value&&>(value);
+        }
 
-        SOAGEN_NODISCARD_CTOR
-        constexpr table_default_construct() noexcept //
-            : SOAGEN_BASE_TYPE{ Allocator{} }
+        template <typename... Args>
+        void emplace_back(Args&&... args)
         {
-            static_assert(std::is_nothrow_default_constructible_v<Allocator>,
-                          "allocators must be nothrow default-constructible, or not default-constructible at all");
+            static_assert(sizeof...(Args) == traits::column_count, "an argument must be provided for each column");
+
+            emplace_back_(std::forward_as_tuple(static_cast<Args&&>(args)...),
+                          std::make_index_sequence<traits::column_count>{});
         }
-    };
 
-    template <size_t ColumnCount, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_default_construct<ColumnCount, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        void pop_back(size_type num = 1)
+        {
+            pop_back_(size() - min(num, size()), std::make_index_sequence<traits::column_count>{});
+        }
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_construct);
+        void clear() noexcept
+        {
+            data_ = snapshot_type{};
+        }
     };
+}
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: move-assignment (un-typed base parts only)
-    //------------------------------------------------------------------------------------------------------------------
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_default_construct
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-    template <size_t ColumnCount,
-              typename Allocator,
-              bool = !allocator_traits<Allocator>::propagate_on_container_move_assignment::value
-                  || std::is_move_assignable_v<Allocator>>
-    class SOAGEN_EMPTY_BASES table_move_assignable_base //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+//********  double_buffered.hpp  ***************************************************************************************
 
-      protected:
-        using allocation = table_allocation<ColumnCount>;
+SOAGEN_DISABLE_WARNINGS;
+#include <algorithm>
+SOAGEN_ENABLE_WARNINGS;
 
-        constexpr bool move_from_by_taking_ownership(table_move_assignable_base&& rhs) noexcept
-        {
-            SOAGEN_ASSUME(&rhs != this);
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-            const auto take_ownership = [&]() noexcept
-            {
-                if (base::alloc_)
-                    base::deallocate(base::allocator(), base::alloc_);
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-                base::alloc_            = std::exchange(rhs.alloc_, allocation{});
-                base::count_            = std::exchange(rhs.count_, size_t{});
-                base::capacity_.first() = std::exchange(rhs.capacity_.first(), size_t{});
+namespace soagen::detail
+{
+    template <typename Soa, typename Buffered, typename = std::make_index_sequence<table_traits_type<Soa>::column_count>>
+    struct double_buffered_traits_;
 
-                if constexpr (allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
-                {
-                    static_assert(std::is_nothrow_move_assignable_v<Allocator>,
-                                  "move-propagated allocators must be nothrow move-assignable");
+    // the front buffer is the source type's own columns, followed by a second copy of each double-buffered column
+    template <typename Soa, size_t... Buffered, size_t... Columns>
+    struct double_buffered_traits_<Soa, std::index_sequence<Buffered...>, std::index_sequence<Columns...>>
+    {
+        using traits = table_traits_type<Soa>;
+        using type   = table_traits<typename traits::template column<Columns>...,
+                                  typename traits::template column<Buffered>...>;
+    };
 
-                    base::allocator() = static_cast<Allocator&&>(rhs.allocator());
-                }
-            };
+    template <typename Soa, auto... Buffered>
+    struct double_buffered_columns_
+    {
+        using type = std::index_sequence<static_cast<size_t>(Buffered)...>;
+    };
 
-            if constexpr (allocator_traits<Allocator>::container_move_assign_always_takes_ownership)
-            {
-                take_ownership();
-                return true;
-            }
-            else
-            {
-                if (allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
-                {
-                    take_ownership();
-                    return true;
-                }
+    template <typename Soa>
+    struct double_buffered_columns_<Soa>
+    {
+        using type = std::make_index_sequence<table_traits_type<Soa>::column_count>;
+    };
 
-                // if they compare non-equal then we need to do elementwise move-assignment,
-                // which can't be implemented at this untyped level - must be implemented as part of a more specialized
-                // child class.
+    // the index of a column's back buffer in the underlying table (its own index if it isn't double-buffered)
+    template <size_t... Buffered>
+    constexpr size_t double_buffered_back_index(size_t column,
+                                                size_t column_count,
+                                                std::index_sequence<Buffered...>) noexcept
+    {
+        size_t index = column;
+        size_t pos   = column_count;
+        ((index = (Buffered == column ? pos : index), pos++), ...);
+        return index;
+    }
 
+    template <size_t... Buffered>
+    constexpr bool double_buffered_distinct(size_t column_count, std::index_sequence<Buffered...>) noexcept
+    {
+        for (size_t i = 0; i < column_count; i++)
+            if ((static_cast<size_t>(Buffered == i) + ... + 0u) > 1u)
                 return false;
-            }
-        }
-
-        template <typename T>
-        constexpr bool move_from_by_taking_ownership(T&& rhs, std::true_type) noexcept
-        {
-            return move_from_by_taking_ownership(static_cast<table_move_assignable_base&&>(rhs));
-        }
-
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        table_move_assignable_base()                                             = default;
-        table_move_assignable_base(table_move_assignable_base&&)                 = default;
-        table_move_assignable_base(const table_move_assignable_base&)            = default;
-        table_move_assignable_base& operator=(const table_move_assignable_base&) = default;
-
-        constexpr table_move_assignable_base& operator=(table_move_assignable_base&& rhs) noexcept
-        {
-            if SOAGEN_LIKELY(&rhs != this)
-                move_from_by_taking_ownership(static_cast<table_move_assignable_base&&>(rhs));
-            return *this;
-        }
-    };
+        return true;
+    }
+}
 
-    template <size_t ColumnCount, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_move_assignable_base<ColumnCount, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
+namespace soagen
+{
+    template <typename Soa, auto... Buffered>
+    class double_buffered
     {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
       public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        using soa_type = Soa;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_move_assignable_base);
-    };
+        using size_type = std::size_t;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: swap
-    //------------------------------------------------------------------------------------------------------------------
+      private:
+        using source_traits    = table_traits_type<Soa>;
+        using buffered_columns = typename detail::double_buffered_columns_<Soa, Buffered...>::type;
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_move_assignable_base
+        static constexpr size_type column_count = source_traits::column_count;
 
-    template <size_t ColumnCount,
-              typename Allocator,
-              bool = !allocator_traits<Allocator>::propagate_on_container_swap::value || std::is_swappable_v<Allocator>>
-    class SOAGEN_EMPTY_BASES table_swap //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        template <auto Column>
+        static constexpr size_type back_index =
+            detail::double_buffered_back_index(static_cast<size_type>(Column), column_count, buffered_columns{});
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        static_assert(((static_cast<size_type>(Buffered) < column_count) && ...), "column index out of range");
+        static_assert(detail::double_buffered_distinct(column_count, buffered_columns{}),
+                      "columns may only be listed once");
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_swap);
+      public:
+        using table_type = soagen::table<typename detail::double_buffered_traits_<Soa, buffered_columns>::type,
+                                         typename soagen::table_type<Soa>::allocator_type>;
 
-        constexpr void swap(table_swap& other) noexcept
-        {
-            if SOAGEN_UNLIKELY(&other == this)
-                return;
+        template <auto Column>
+        static constexpr bool is_buffered = back_index<Column> != static_cast<size_type>(Column);
 
-            if constexpr (!allocator_traits<Allocator>::propagate_on_container_swap::value
-                          && !allocator_traits<Allocator>::is_always_equal::value)
-            {
-                SOAGEN_ASSERT(base::allocator() == other.allocator()
-                              && "allocators must compare equal in a non-propagating swap");
-            }
+      private:
+        table_type table_;
 
-            using std::swap;
-            swap(base::alloc_, other.alloc_);
-            swap(base::count_, other.count_);
-            swap(base::capacity_.first(), other.capacity_.first());
+        template <size_t... Columns>
+        void swap_buffers_(std::index_sequence<Columns...>) noexcept
+        {
+            (table_.template swap_columns<Columns, back_index<Columns>>(), ...);
+        }
 
-            if constexpr (allocator_traits<Allocator>::propagate_on_container_swap::value)
-            {
-                static_assert(std::is_nothrow_swappable_v<Allocator>,
-                              "swap-propagated allocators must be nothrow-swappable");
+        template <size_t... Columns>
+        void sync_back_(std::index_sequence<Columns...>)
+        {
+            (std::copy(front<Columns>(), front<Columns>() + size(), back<Columns>()), ...);
+        }
 
-                swap(base::allocator(), other.allocator());
-            }
+        template <typename Tuple, size_t... Columns, size_t... BufferedColumns>
+        void emplace_back_(Tuple&& args, std::index_sequence<Columns...>, std::index_sequence<BufferedColumns...>)
+        {
+            // double-buffered columns are constructed from the same argument twice, so they only ever see an lvalue
+            table_.emplace_back(
+                [&]() -> decltype(auto)
+                {
+                    using arg_type = std::tuple_element_t<Columns, std::remove_reference_t<Tuple>>;
+                    if constexpr (is_buffered<Columns>)
+                        return static_cast<const std::remove_reference_t<arg_type>&>(std::get<Columns>(args));
+                    else
+                        return static_cast<arg_type>(std::get<Columns>(args));
+                }()...,
+                static_cast<const std::remove_reference_t<std::tuple_element_t<BufferedColumns,
+                                                                               std::remove_reference_t<Tuple>>>&>(
+                    std::get<BufferedColumns>(args))...);
         }
-    };
 
-    template <size_t ColumnCount, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_swap<ColumnCount, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
       public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        SOAGEN_NODISCARD_CTOR
+        double_buffered() = default;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_swap);
-    };
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return table_.size();
+        }
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: typed base
-    //
-    // note: specializations from here down take the full Traits, not just the ColumnCount
-    //------------------------------------------------------------------------------------------------------------------
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return table_.empty();
+        }
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_swap
-#undef SOAGEN_BASE_TYPE
-#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Traits::column_count, Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        size_type capacity() const noexcept
+        {
+            return table_.capacity();
+        }
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_typed_base //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using table_type  = table<Traits, Allocator>;
-        using allocation  = table_allocation<Traits::column_count>;
-        using column_ends = size_t[Traits::column_count];
-        using base        = SOAGEN_BASE_TYPE;
+        void reserve(size_type new_cap)
+        {
+            table_.reserve(new_cap);
+        }
 
-        static constexpr void calc_column_ends(column_ends& ends, size_t capacity) noexcept
+        void resize(size_type new_size)
         {
-            // pad ends so the next column starts at the right alignment for the storage type
-            size_t prev = {};
-            for (size_t i = 0; i < Traits::column_count - 1u; i++)
-            {
-                const auto align = max(Traits::column_alignments[i + 1u], min_actual_column_alignment);
+            table_.resize(new_size);
+        }
 
-                ends[i] = prev + Traits::column_sizes[i] * capacity;
-                ends[i] = (ends[i] + align - 1u) & ~(align - 1u);
-                prev    = ends[i];
-            }
+        void clear() noexcept
+        {
+            table_.clear();
+        }
 
-            // last end doesn't need to be aligned (it's just the total buffer size)
-            ends[Traits::column_count - 1u] = prev + Traits::column_sizes[Traits::column_count - 1u] * capacity;
+        void pop_back(size_type num = 1)
+        {
+            table_.pop_back(num);
         }
 
-        SOAGEN_NODISCARD
-        constexpr allocation allocate(const column_ends& ends) noexcept(base::allocate_is_nothrow)
+        template <typename... Args>
+        void emplace_back(Args&&... args)
         {
-            SOAGEN_ASSUME(ends[Traits::column_count - 1u]);
+            static_assert(sizeof...(Args) == column_count, "an argument must be provided for each column");
 
-            allocation alloc = {
-                base::allocate(base::allocator(), ends[Traits::column_count - 1u], buffer_alignment<table_type>),
-                {}
-            };
-            SOAGEN_ASSUME(alloc.ptr);
-            SOAGEN_ASSUME(alloc.size == ends[Traits::column_count - 1u]);
+            emplace_back_(std::forward_as_tuple(static_cast<Args&&>(args)...),
+                          std::make_index_sequence<column_count>{},
+                          buffered_columns{});
+        }
 
-            alloc.columns[0] = soagen::assume_aligned<buffer_alignment<table_type>>(alloc.ptr);
-            for (size_t i = 1; i < Traits::column_count; i++)
-                alloc.columns[i] = alloc.columns[0] + ends[i - 1u];
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        value_type<Soa, Column>* front() noexcept
+        {
+            return table_.template column<static_cast<size_type>(Column)>();
+        }
 
-            return alloc;
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>* front() const noexcept
+        {
+            return table_.template column<static_cast<size_type>(Column)>();
         }
 
-        SOAGEN_CONSTEXPR_20
-        SOAGEN_NEVER_INLINE
-        void adjust_capacity(size_t new_capacity) noexcept(
-            base::allocate_is_nothrow
-            && (Traits::all_nothrow_move_or_copy_constructible
-                || (Traits::all_nothrow_default_constructible && Traits::all_nothrow_move_or_copy_assignable)
-                || Traits::all_nothrow_copy_constructible
-                || (Traits::all_nothrow_default_constructible && Traits::all_nothrow_copy_assignable)))
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        value_type<Soa, Column>* back() noexcept
         {
-            SOAGEN_ASSUME(new_capacity);
-            SOAGEN_ASSUME(new_capacity >= base::count_);
+            return table_.template column<back_index<Column>>();
+        }
 
-            if SOAGEN_UNLIKELY(new_capacity == base::capacity())
-                return;
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>* back() const noexcept
+        {
+            return table_.template column<back_index<Column>>();
+        }
 
-            // get new ends
-            column_ends new_ends{};
-            calc_column_ends(new_ends, new_capacity);
+        void swap_buffers() noexcept
+        {
+            swap_buffers_(buffered_columns{});
+        }
 
-            // alloc + move
-            auto new_alloc = allocate(new_ends);
-            SOAGEN_ASSERT(new_alloc);
-            if (base::count_)
-            {
-                SOAGEN_ASSERT(base::alloc_);
+        void sync_back()
+        {
+            sync_back_(buffered_columns{});
+        }
 
-                // this looks a bit convoluted and is probably worth an explainer:
-                // we really, really, _really_ don't want reserve() and shrink_to_fit() to throw if we can avoid it,
-                // since it potentially leaves the container in a sliced state (i.e. some elements were moved already
-                // when an exception is raised), so we're moving or copying the elements according to the 'most nothrow'
-                // path that still fulfills the brief.
+        SOAGEN_PURE_INLINE_GETTER
+        const table_type& table() const noexcept
+        {
+            return table_;
+        }
+    };
+}
 
-                if constexpr (Traits::all_nothrow_move_or_copy_constructible)
-                {
-                    Traits::move_or_copy_construct_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
-                }
-                else if constexpr (Traits::all_nothrow_default_constructible
-                                   && Traits::all_nothrow_move_or_copy_assignable)
-                {
-                    Traits::default_construct_rows(new_alloc.columns, {}, base::count_);
-                    Traits::move_or_copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
-                }
-                else if constexpr (Traits::all_nothrow_copy_constructible)
-                {
-                    Traits::copy_construct_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
-                }
-                else if constexpr (Traits::all_nothrow_default_constructible && Traits::all_nothrow_copy_assignable)
-                {
-                    Traits::default_construct_rows(new_alloc.columns, {}, base::count_);
-                    Traits::copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
-                }
-                else
-                {
-                    [[maybe_unused]]
-                    bool needs_destruct = false;
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-                    SOAGEN_TRY
-                    {
-                        if constexpr (Traits::all_move_or_copy_constructible)
-                        {
-                            Traits::move_or_copy_construct_rows(new_alloc.columns,
-                                                                {},
-                                                                base::alloc_.columns,
-                                                                {},
-                                                                base::count_); // strong
-                        }
-                        else if constexpr (Traits::all_default_constructible && Traits::all_move_or_copy_assignable)
-                        {
-                            Traits::default_construct_rows(new_alloc.columns, {}, base::count_); // strong
-                            needs_destruct = !Traits::all_trivially_destructible;
-                            Traits::move_or_copy_assign_rows(new_alloc.columns,
-                                                             {},
-                                                             base::alloc_.columns,
-                                                             {},
-                                                             base::count_);
-                        }
-                        else if constexpr (Traits::all_copy_constructible)
-                        {
-                            Traits::copy_construct_rows(new_alloc.columns,
-                                                        {},
-                                                        base::alloc_.columns,
-                                                        {},
-                                                        base::count_); // strong
-                        }
-                        else if constexpr (Traits::all_default_constructible && Traits::all_copy_assignable)
-                        {
-                            Traits::default_construct_rows(new_alloc.columns, {}, base::count_); // strong
-                            needs_destruct = !Traits::all_trivially_destructible;
-                            Traits::copy_assign_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
-                        }
-                    }
-#if SOAGEN_HAS_EXCEPTIONS
-                    catch (...)
-                    {
-                        if (needs_destruct)
-                            Traits::destruct_rows(new_alloc.columns, {}, base::count_);
-                        base::deallocate(base::allocator(), new_alloc);
-                        throw;
-                    }
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
 #endif
-                }
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-                if constexpr (!Traits::all_trivially_destructible)
-                {
-                    Traits::destruct_rows(base::alloc_.columns, {}, base::count_);
-                }
+//********  column_buffer.hpp  *****************************************************************************************
 
-                base::deallocate(base::allocator(), base::alloc_);
-            }
-            base::alloc_            = new_alloc;
-            base::capacity_.first() = new_capacity;
-        }
+SOAGEN_DISABLE_WARNINGS;
+#include <cstring>
+SOAGEN_ENABLE_WARNINGS;
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_typed_base);
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-        ~table_typed_base() noexcept
+namespace soagen::detail
+{
+    template <typename Allocator>
+    std::byte* allocate_column(Allocator& alloc, size_t bytes, size_t alignment)
+    {
+        return reinterpret_cast<std::byte*>(
+            allocator_traits<Allocator>::allocate(alloc, bytes, std::align_val_t{ alignment }));
+    }
+
+    template <typename Allocator>
+    void deallocate_column(Allocator& alloc, std::byte* ptr, size_t bytes) noexcept
+    {
+        using pointer = std::remove_reference_t<
+            decltype(allocator_traits<Allocator>::allocate(alloc, size_t{}, std::align_val_t{}))>;
+
+        allocator_traits<Allocator>::deallocate(alloc, reinterpret_cast<pointer>(ptr), bytes);
+    }
+
+    // moves a column out of a table's main buffer into an allocation of its own so it can change hands.
+    // this is the only part of an exchange that touches elements, and only happens once per column per allocation.
+    template <typename Table, size_t Column>
+    void separate_column(Table& tbl)
+    {
+        using column = typename table_traits_type<Table>::template column<Column>;
+
+        auto& alloc = table_storage_access::allocation(tbl);
+        if (!alloc || (alloc.separate && alloc.separate[Column]))
+            return;
+
+#if SOAGEN_INSTRUMENT
+        const table_event_timer timer;
+        const auto old_bytes = alloc.total_size();
+#endif
+
+        auto& allocator = table_storage_access::allocator(tbl);
+        if (!alloc.separate)
         {
-            clear();
+            constexpr size_t count = table_traits_type<Table>::column_count;
+            alloc.separate         = reinterpret_cast<size_t*>(allocate_column(
+                allocator,
+                sizeof(size_t) * count,
+                max(alignof(size_t), allocator_traits<allocator_type<Table>>::min_alignment)));
+            for (size_t i = 0; i < count; i++)
+                alloc.separate[i] = 0u;
         }
 
-        SOAGEN_RESETTER
-        constexpr void clear() noexcept
+        const size_t bytes = sizeof(typename column::storage_type) * tbl.capacity();
+        std::byte* buf     = allocate_column(allocator, bytes, actual_alignment<Table, Column>);
+        std::byte* src     = alloc.columns[Column];
+
+        if constexpr (column::is_trivially_copyable)
         {
-            if constexpr (!Traits::all_trivially_destructible)
+            if (tbl.size())
+                std::memcpy(buf, src, sizeof(typename column::storage_type) * tbl.size());
+        }
+        else
+        {
+            size_t i = 0;
+#if SOAGEN_HAS_EXCEPTIONS
+            try
             {
-                static_assert(Traits::all_nothrow_destructible, "column storage_types must be nothrow-destructible");
-
-                if (base::count_)
-                    Traits::destruct_rows(base::alloc_.columns, {}, base::count_);
+#endif
+                for (; i < tbl.size(); i++)
+                    column::move_or_copy_construct(buf, i, src, i);
+#if SOAGEN_HAS_EXCEPTIONS
             }
-            base::count_ = {};
+            catch (...)
+            {
+                while (i)
+                    column::destruct(buf, --i);
+                deallocate_column(allocator, buf, bytes);
+                throw;
+            }
+#endif
+            for (i = tbl.size(); i-- > 0u;)
+                column::destruct(src, i);
         }
 
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        void reserve(size_t new_capacity) noexcept(noexcept(this->adjust_capacity(size_t{})))
-        {
-            if SOAGEN_UNLIKELY(!new_capacity)
-                return;
+        alloc.columns[Column]  = buf;
+        alloc.separate[Column] = bytes;
 
-            if constexpr (Traits::aligned_stride > 1)
-            {
-                if (const size_t rem = new_capacity % Traits::aligned_stride; rem > 0u)
-                {
-                    static_cast<void>(
-                        add_without_overflowing(new_capacity, Traits::aligned_stride - rem, new_capacity));
-                }
-            }
+#if SOAGEN_INSTRUMENT
+        raise_table_event<Table, table_traits_type<Table>>(table_event::allocate,
+                                                           &tbl,
+                                                           tbl.capacity(),
+                                                           tbl.capacity(),
+                                                           old_bytes,
+                                                           alloc.total_size(),
+                                                           tbl.size(),
+                                                           timer.elapsed());
+#endif
+    }
 
-            if SOAGEN_UNLIKELY(new_capacity > max_capacity)
-                SOAGEN_THROW(std::bad_alloc{});
+    template <typename A, size_t ColumnA, typename B, size_t ColumnB>
+    inline constexpr bool columns_exchangeable =
+        std::is_same_v<typename table_traits_type<A>::template storage_type<ColumnA>,
+                       typename table_traits_type<B>::template storage_type<ColumnB>>
+        && actual_alignment<A, ColumnA> == actual_alignment<B, ColumnB>
+        && std::is_same_v<allocator_type<A>, allocator_type<B>>;
+}
 
-            if (new_capacity <= base::capacity())
-                return;
+namespace soagen
+{
+    template <typename Soa, auto Column>
+    class column_buffer
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
 
-            adjust_capacity(new_capacity);
-        }
+      public:
+        using table_type = soagen::table_type<Soa>;
 
-        SOAGEN_NEVER_INLINE
-        SOAGEN_CONSTEXPR_20
-        void shrink_to_fit() noexcept(noexcept(this->adjust_capacity(size_t{})))
-        {
-            if (!base::count_)
-            {
-                if (base::alloc_)
-                {
-                    base::deallocate(base::allocator(), base::alloc_);
-                    base::alloc_            = {};
-                    base::capacity_.first() = {};
-                }
-                return;
-            }
+        using value_type = soagen::value_type<Soa, Column>;
 
-            auto new_capacity = base::count_;
-            if constexpr (Traits::aligned_stride > 1)
-            {
-                if (const size_t rem = new_capacity % Traits::aligned_stride; rem > 0u)
-                {
-                    static_cast<void>(
-                        add_without_overflowing(new_capacity, Traits::aligned_stride - rem, new_capacity));
-                }
-            }
-            if (new_capacity >= base::capacity())
-                return;
+        using size_type = std::size_t;
 
-            adjust_capacity(new_capacity);
-        }
+        using allocator_type = soagen::allocator_type<Soa>;
 
-        SOAGEN_CONSTEXPR_20
-        void pop_back(size_t num = 1) noexcept
-        {
-            static_assert(Traits::all_nothrow_destructible, "column storage_types must be nothrow-destructible");
+        static constexpr size_t alignment = actual_alignment<table_type, Column>;
 
-            num = min(base::count_, num);
-            if constexpr (!Traits::all_trivially_destructible)
-            {
-                Traits::destruct_rows(base::alloc_.columns, base::count_ - num, num);
-            }
-            base::count_ -= num;
+      private:
+        template <auto, typename Table, typename BufferSoa, auto BufferColumn>
+        friend void exchange_column(Table&, column_buffer<BufferSoa, BufferColumn>&);
+
+        using column       = typename table_traits_type<Soa>::template column<static_cast<size_t>(Column)>;
+        using storage_type = typename column::storage_type;
+
+        std::byte* data_    = {};
+        size_type size_     = {};
+        size_type capacity_ = {};
+        allocator_type alloc_;
+
+        void release() noexcept
+        {
+            clear();
+            if (data_)
+                detail::deallocate_column(alloc_, data_, sizeof(storage_type) * capacity_);
+            data_     = {};
+            capacity_ = {};
         }
 
       public:
-        static constexpr size_t max_capacity = []() -> size_t
+        SOAGEN_NODISCARD_CTOR
+        explicit column_buffer(size_type capacity = 0, const allocator_type& alloc = allocator_type{}) //
+            : capacity_{ capacity },
+              alloc_{ alloc }
         {
-            if constexpr (Traits::column_count == 1)
-            {
-                return static_cast<size_t>(-1) / Traits::column_sizes[0];
-            }
-            else
-            {
-                // todo: i'm sure there's a smarter way to do this
+            if (capacity_)
+                data_ = detail::allocate_column(alloc_, sizeof(storage_type) * capacity_, alignment);
+        }
 
-                constexpr auto capacity_ok = [](size_t cap) noexcept
-                {
-                    size_t buf_end = {};
-                    for (size_t i = 0u; i < Traits::column_count; i++)
-                    {
-                        if (i)
-                        {
-                            const auto align = max(Traits::column_alignments[i], min_actual_column_alignment);
+        SOAGEN_NODISCARD_CTOR
+        column_buffer(column_buffer&& other) noexcept //
+            : data_{ std::exchange(other.data_, nullptr) },
+              size_{ std::exchange(other.size_, size_type{}) },
+              capacity_{ std::exchange(other.capacity_, size_type{}) },
+              alloc_{ other.alloc_ }
+        {}
 
-                            if (const size_t rem = buf_end % align; rem > 0u)
-                            {
-                                if (!add_without_overflowing(buf_end, align - rem, buf_end))
-                                    return false;
-                            }
-                        }
-                        if (!add_without_overflowing(buf_end, Traits::column_sizes[i] * cap, buf_end))
-                            return false;
-                    }
-                    return true;
-                };
+        column_buffer& operator=(column_buffer&& other) noexcept
+        {
+            if (&other != this)
+            {
+                release();
+                data_     = std::exchange(other.data_, nullptr);
+                size_     = std::exchange(other.size_, size_type{});
+                capacity_ = std::exchange(other.capacity_, size_type{});
+                alloc_    = other.alloc_;
+            }
+            return *this;
+        }
 
-                size_t lower  = static_cast<size_t>(-1);
-                size_t higher = lower;
-                while (lower && !capacity_ok(lower))
-                {
-                    higher = lower;
-                    lower /= 16u;
-                }
-                if (!lower)
-                    return 0;
+        column_buffer(const column_buffer&)            = delete;
+        column_buffer& operator=(const column_buffer&) = delete;
 
-                while (true)
-                {
-                    const auto midpoint = lower + (higher - lower) / 2u;
-                    if (capacity_ok(midpoint))
-                        lower = midpoint;
-                    else
-                        higher = midpoint;
+        ~column_buffer() noexcept
+        {
+            release();
+        }
 
-                    if ((higher - lower) <= 1u)
-                        return lower;
-                }
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
 
-                return 0;
-            }
-        }();
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !size_;
+        }
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr size_t max_size() const noexcept
+        size_type capacity() const noexcept
         {
-            return max_capacity;
+            return capacity_;
         }
 
-      private:
-        SOAGEN_CONSTEXPR_20
-        SOAGEN_NEVER_INLINE
-        void grow_if_necessary(size_t new_elements)
+        SOAGEN_PURE_GETTER
+        value_type* data() noexcept
         {
-            SOAGEN_ASSUME(new_elements);
+            if constexpr (std::is_pointer_v<storage_type>)
+                return SOAGEN_LAUNDER(reinterpret_cast<value_type*>(data_));
+            else
+                return column::ptr(data_);
+        }
 
-            // determine the minimum required allocation size to store the new elements.
-            // if this calculation would overflow or the result would exceed max_capacity then we've
-            // hit system limits and have no choice but to raise std::bad_alloc.
-            auto new_size = base::count_;
-            if SOAGEN_UNLIKELY(!add_without_overflowing(new_size, new_elements, new_size) || new_size > max_capacity)
-                SOAGEN_THROW(std::bad_alloc{});
+        SOAGEN_PURE_GETTER
+        const value_type* data() const noexcept
+        {
+            return const_cast<column_buffer&>(*this).data();
+        }
 
-            // already enough capacity, no work to do.
-            if SOAGEN_LIKELY(new_size <= base::capacity())
-                return;
+        SOAGEN_PURE_GETTER
+        value_type& operator[](size_type index) noexcept
+        {
+            SOAGEN_ASSERT(index < size_);
 
-            // again we need to check system limits, this time when applying the growth factor.
-            // if we overflow or would exceed the max capacity then clamp the result to max_capacity
-            // (the user is right on the edge of hitting system limits and will hit them at the next growth)
-            auto new_cap = new_size;
-            if SOAGEN_UNLIKELY(!add_without_overflowing(new_cap, new_cap, new_cap) || new_cap > max_capacity)
-                new_cap = max_capacity;
+            return data()[index];
+        }
 
-            reserve(new_cap);
+        SOAGEN_PURE_GETTER
+        const value_type& operator[](size_type index) const noexcept
+        {
+            SOAGEN_ASSERT(index < size_);
+
+            return data()[index];
         }
 
-      public:
-        SOAGEN_CONSTRAINED_TEMPLATE(Traits::template row_constructible_from<Args&&...>, typename... Args)
-        SOAGEN_CONSTEXPR_20
-        void emplace_back(Args&&... args) noexcept(                    //
-            Traits::template row_nothrow_constructible_from<Args&&...> //
-            && noexcept(this->grow_if_necessary(size_t{})))
+        template <typename... Args>
+        value_type& emplace_back(Args&&... args)
         {
-            grow_if_necessary(1u);
-            Traits::construct_row(base::alloc_.columns, base::count_, static_cast<Args&&>(args)...);
-            base::count_++;
+            SOAGEN_ASSERT(size_ < capacity_);
+
+            column::construct_at(data_, size_, static_cast<Args&&>(args)...);
+            return data()[size_++];
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE((Traits::all_move_or_copy_constructible //
-                                     && Traits::all_move_or_copy_assignable //
-                                     && Traits::template row_constructible_from<Args&&...>),
-                                    typename... Args)
-        SOAGEN_CONSTEXPR_20
-        void emplace(size_t position, Args&&... args) noexcept(           //
-            Traits::all_nothrow_move_or_copy_constructible                //
-            && Traits::all_nothrow_move_or_copy_assignable                //
-            && Traits::template row_nothrow_constructible_from<Args&&...> //
-            && noexcept(this->grow_if_necessary(size_t{})))
+        void clear() noexcept
         {
-            SOAGEN_ASSUME(position <= base::count_);
+            while (size_)
+                column::destruct(data_, --size_);
+        }
+    };
 
-            // delegating to emplace_back for the end position is ideal
-            // because emplace_back never needs to move+destruct elements (modulo re-allocation)
-            if (position == base::count_)
+    SOAGEN_CONSTRAINED_TEMPLATE(is_soa<SoaB>, auto ColumnA, auto ColumnB = ColumnA, typename SoaA, typename SoaB)
+    void exchange_column(SoaA& a, SoaB& b)
+    {
+        static_assert(is_soa<SoaA>, "SoaA must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<SoaA> && !std::is_const_v<SoaB>, "tables may not be const");
+
+        using table_a          = table_type<SoaA>;
+        using table_b          = table_type<SoaB>;
+        constexpr size_t col_a = static_cast<size_t>(ColumnA);
+        constexpr size_t col_b = static_cast<size_t>(ColumnB);
+        static_assert(detail::columns_exchangeable<table_a, col_a, table_b, col_b>,
+                      "columns must have the same storage type, alignment and allocator type");
+
+        auto& ta = static_cast<table_a&>(a);
+        auto& tb = static_cast<table_b&>(b);
+        if constexpr (std::is_same_v<table_a, table_b>)
+        {
+            if (&ta == &tb)
             {
-                emplace_back(static_cast<Args&&>(args)...);
+                ta.template swap_columns<col_a, col_b>();
+                detail::rebuild_value_indexes(a);
                 return;
             }
+        }
 
-            if constexpr (Traits::all_nothrow_move_or_copy_constructible //
-                          && Traits::all_nothrow_move_or_copy_assignable //
-                          && Traits::template row_nothrow_constructible_from<Args&&...>)
-            {
-                // move-construct the last element (since it is new)
-                grow_if_necessary(1u);
-                Traits::move_or_copy_construct_row(base::alloc_.columns,
-                                                   base::count_,
-                                                   base::alloc_.columns,
-                                                   base::count_ - 1u);
-
-                // move-assign the rest of the elements (they were already alive)
-                if (position + 1u < base::count_)
-                {
-                    Traits::move_or_copy_assign_rows(base::alloc_.columns,
-                                                     position + 1u,
-                                                     base::alloc_.columns,
-                                                     position,
-                                                     base::count_ - position - 1u);
-                }
+        SOAGEN_ASSERT(ta.size() == tb.size());
+        SOAGEN_ASSERT(ta.capacity() == tb.capacity());
+        SOAGEN_ASSERT(allocator_traits<allocator_type<table_a>>::equal(ta.get_allocator(), tb.get_allocator()));
+        if (!ta.capacity())
+            return;
 
-                // destruct the existing element if necessary
-                if constexpr (!Traits::all_trivially_destructible)
-                {
-                    Traits::destruct_row(base::alloc_.columns, position);
-                }
+        detail::separate_column<table_a, col_a>(ta);
+        detail::separate_column<table_b, col_b>(tb);
 
-                // insert the new element by direct construction
-                Traits::construct_row(base::alloc_.columns, position, static_cast<Args&&>(args)...);
+        auto& alloc_a = detail::table_storage_access::allocation(ta);
+        auto& alloc_b = detail::table_storage_access::allocation(tb);
+        std::swap(alloc_a.columns[col_a], alloc_b.columns[col_b]);
+        std::swap(alloc_a.separate[col_a], alloc_b.separate[col_b]);
 
-                base::count_++;
-            }
-            else
-            {
-                emplace_back(static_cast<Args&&>(args)...);
-                for (size_t i = base::count_ - 1u; i > position; i--)
-                    Traits::swap_rows(base::alloc_.columns, i, base::alloc_.columns, i - 1u);
-            }
-        }
+        detail::rebuild_value_indexes(a);
+        detail::rebuild_value_indexes(b);
+    }
 
-      private:
-        template <size_t A, size_t B>
-        static constexpr bool can_swap_columns =
-            Traits::template can_swap_columns<A, B>
-            || (std::is_same_v<typename Traits::template storage_type<A>, typename Traits::template storage_type<B>>
-                && actual_alignment<table_type, A> == actual_alignment<table_type, B>);
+    template <auto Column, typename Soa, typename BufferSoa, auto BufferColumn>
+    void exchange_column(Soa& soa, column_buffer<BufferSoa, BufferColumn>& buffer)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(!std::is_const_v<Soa>, "Soa may not be const");
 
-        template <size_t A, size_t B>
-        static constexpr bool can_nothrow_swap_columns =
-            Traits::template can_nothrow_swap_columns<A, B>
-            || (std::is_same_v<typename Traits::template storage_type<A>, typename Traits::template storage_type<B>>
-                && actual_alignment<table_type, A> == actual_alignment<table_type, B>);
+        using table          = table_type<Soa>;
+        constexpr size_t col = static_cast<size_t>(Column);
+        static_assert(detail::columns_exchangeable<table, col, BufferSoa, static_cast<size_t>(BufferColumn)>,
+                      "columns must have the same storage type, alignment and allocator type");
 
-      public:
-        template <auto A, auto B>
-        SOAGEN_CONSTEXPR_20
-        void swap_columns() //
-            noexcept(can_nothrow_swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>)
-        {
-            static_assert(can_swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>);
+        auto& tbl = static_cast<table&>(soa);
+        SOAGEN_ASSERT(tbl.size() == buffer.size());
+        SOAGEN_ASSERT(tbl.capacity() == buffer.capacity());
+        SOAGEN_ASSERT(allocator_traits<allocator_type<table>>::equal(tbl.get_allocator(), buffer.alloc_));
+        if (!tbl.capacity())
+            return;
 
-            if constexpr (static_cast<size_t>(A) != static_cast<size_t>(B))
-            {
-                using storage_a = typename Traits::template storage_type<A>;
-                using storage_b = typename Traits::template storage_type<B>;
-                static_assert(std::is_same_v<storage_a, storage_b>);
+        detail::separate_column<table, col>(tbl);
 
-                // if they have the same base alignment, we can just swap the two pointers
-                // rather than having to do an element-wise swap
-                if constexpr (actual_alignment<table_type, static_cast<size_t>(A)>
-                              == actual_alignment<table_type, static_cast<size_t>(B)>)
-                {
-                    const auto temp                              = base::alloc_.columns[static_cast<size_t>(A)];
-                    base::alloc_.columns[static_cast<size_t>(A)] = base::alloc_.columns[static_cast<size_t>(B)];
-                    base::alloc_.columns[static_cast<size_t>(B)] = temp;
-                }
-                else
-                {
-                    Traits::template swap_columns<static_cast<size_t>(A), static_cast<size_t>(B)>(base::alloc_.columns,
-                                                                                                  {},
-                                                                                                  base::count_);
-                }
-            }
-        }
-    };
+        auto& alloc = detail::table_storage_access::allocation(tbl);
+        std::swap(alloc.columns[col], buffer.data_);
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: default-constructible column types
-    //------------------------------------------------------------------------------------------------------------------
+        detail::rebuild_value_indexes(soa);
+    }
+}
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_typed_base
-#undef SOAGEN_BASE_TYPE
-#define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Traits, Allocator>
+//********  arena.hpp  *************************************************************************************************
 
-    template <typename Traits, //
-              typename Allocator,
-              bool = Traits::all_default_constructible>
-    class SOAGEN_EMPTY_BASES table_default_constructible_columns //
-        : public SOAGEN_BASE_TYPE
+namespace soagen
+{
+    class arena
     {
+      public:
+        using size_type = std::size_t;
+
+        static constexpr size_type min_alignment = allocator::min_alignment;
+
       private:
-        using base = SOAGEN_BASE_TYPE;
+        // upstream blocks are singly-linked through a header at their start
+        struct block
+        {
+            block* next;
+            size_type size;
+        };
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        static constexpr size_type header_size = (sizeof(block) + min_alignment - 1u) & ~(min_alignment - 1u);
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_constructible_columns);
+        block* blocks_            = {}; // owned upstream blocks, most recent first
+        std::byte* initial_       = {};
+        size_type initial_size_   = {};
+        bool owns_initial_        = {};
+        std::byte* cursor_        = {};
+        std::byte* end_           = {};
+        size_type next_size_      = {};
+        size_type bytes_used_     = {};
+        size_type bytes_reserved_ = {};
 
-        SOAGEN_CONSTEXPR_20
-        void resize(size_t num) noexcept(             //
-            Traits::all_nothrow_default_constructible //
-            && noexcept(this->pop_back(size_t{}))     //
-            && noexcept(this->reserve(size_t{})))
+        SOAGEN_NODISCARD
+        static std::byte* align_up(std::byte* ptr, size_type alignment) noexcept
         {
-            if (base::size() > num)
-            {
-                base::pop_back(base::size() - num);
-            }
-            else if (base::size() < num)
-            {
-                base::reserve(num);
-                for (size_t i = base::size(); i < num; i++)
-                {
-                    Traits::default_construct_row(base::alloc_.columns, i);
-                    base::count_++;
-                }
-            }
+            const auto p = reinterpret_cast<uintptr_t>(ptr);
+            return ptr + (((p + alignment - 1u) & ~static_cast<uintptr_t>(alignment - 1u)) - p);
         }
 
-        SOAGEN_CONSTEXPR_20
-        void resize_for_overwrite(size_t num) noexcept( //
-            Traits::all_nothrow_default_constructible   //
-            && noexcept(this->pop_back(size_t{}))       //
-            && noexcept(this->reserve(size_t{})))
+        block* new_block(size_type usable)
         {
-            if (base::size() > num)
-            {
-                base::pop_back(base::size() - num);
-            }
-            else if (base::size() < num)
+            const auto size = header_size + usable;
+            auto b = reinterpret_cast<block*>(allocator{}.allocate(size, std::align_val_t{ min_alignment }));
+            b->next = blocks_;
+            b->size = size;
+            blocks_ = b;
+            bytes_reserved_ += size;
+            return b;
+        }
+
+        void free_blocks(block* keep) noexcept
+        {
+            while (blocks_ != keep)
             {
-                base::reserve(num);
-                Traits::construct_rows_for_overwrite(base::alloc_.columns, base::size(), num - base::size());
-                base::count_ = num;
+                const auto next = blocks_->next;
+                bytes_reserved_ -= blocks_->size;
+                allocator{}.deallocate(reinterpret_cast<std::byte*>(blocks_), blocks_->size);
+                blocks_ = next;
             }
         }
-    };
-
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_default_constructible_columns<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_constructible_columns);
-    };
-
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: move-assignment (typed)
-    //------------------------------------------------------------------------------------------------------------------
-
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_default_constructible_columns
 
-    template <typename Traits, //
-              typename Allocator,
-              bool UseBase = !std::is_move_assignable_v<SOAGEN_BASE_TYPE>
-                          || allocator_traits<Allocator>::container_move_assign_always_takes_ownership,
-              bool Movable = (Traits::all_move_or_copy_assignable && Traits::all_move_or_copy_constructible)>
-    class SOAGEN_EMPTY_BASES table_move_assign //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        void rewind() noexcept
+        {
+            cursor_     = initial_;
+            end_        = initial_ + initial_size_;
+            bytes_used_ = {};
+        }
 
       public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        table_move_assign()                                    = default;
-        table_move_assign(table_move_assign&&)                 = default;
-        table_move_assign(const table_move_assign& other)      = default;
-        table_move_assign& operator=(const table_move_assign&) = default;
-
-        // note that this is only specialized when allocator_traits::container_move_assign_always_takes_ownership
-        // is false - if it's true then the untyped base move-assign operator is already complete and no elementwise
-        // moving will ever need to take place
-        static_assert(!UseBase);
-        static_assert(Movable);
+        SOAGEN_NODISCARD_CTOR
+        explicit arena(size_type initial_size = 64u * 1024u) noexcept //
+            : next_size_{ max(initial_size, size_type{ 256 }) }
+        {}
 
-        table_move_assign& operator=(table_move_assign&& rhs) noexcept( //
-            Traits::all_nothrow_move_or_copy_assignable                 //
-            && Traits::all_nothrow_move_or_copy_constructible           //
-            && noexcept(base::clear())                                  //
-            && noexcept(base::pop_back())                               //
-            && noexcept(base::reserve(size_t{})))
+        SOAGEN_NODISCARD_CTOR
+        arena(void* buffer, size_type size) noexcept //
+            : initial_{ static_cast<std::byte*>(buffer) },
+              initial_size_{ size },
+              next_size_{ max(size * 2u, size_type{ 256 }) }
         {
-            if SOAGEN_UNLIKELY(&rhs == this)
-                return *this;
+            rewind();
+            bytes_reserved_ = size;
+        }
 
-            static_assert(!allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
-            static_assert(!allocator_traits<Allocator>::is_always_equal::value);
+        arena(const arena&)            = delete;
+        arena& operator=(const arena&) = delete;
 
-            if (base::move_from_by_taking_ownership(rhs, std::true_type{}))
-                return *this;
+        ~arena() noexcept
+        {
+            release();
+        }
 
-            SOAGEN_ASSERT(!allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()));
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        std::byte* allocate(size_type size, size_type alignment = min_alignment)
+        {
+            alignment = max(alignment, min_alignment);
+            SOAGEN_ASSERT(has_single_bit(alignment));
 
-            if (rhs.empty())
+            std::byte* ptr = cursor_ ? align_up(cursor_, alignment) : nullptr;
+            if SOAGEN_UNLIKELY(!ptr || ptr > end_ || static_cast<size_type>(end_ - ptr) < size)
             {
-                base::clear();
-                return *this;
-            }
+                // the first owned block becomes the initial block that reset() keeps
+                const auto usable = max(next_size_, size + alignment);
+                const auto b      = new_block(usable);
+                if (!initial_)
+                {
+                    initial_      = reinterpret_cast<std::byte*>(b) + header_size;
+                    initial_size_ = usable;
+                    owns_initial_ = true;
+                }
+                else
+                    next_size_ = max(next_size_, usable) * 2u;
 
-            if (rhs.size() < base::size())
-                base::pop_back(base::size() - rhs.size());
+                cursor_ = reinterpret_cast<std::byte*>(b) + header_size;
+                end_    = cursor_ + usable;
+                ptr     = align_up(cursor_, alignment);
+            }
 
-            base::reserve(rhs.size());
+            cursor_ = ptr + size;
+            bytes_used_ += size;
+            return ptr;
+        }
 
-            const auto assigned_end = min(base::size(), rhs.size());
-            for (size_t i = 0; i < assigned_end; i++)
-                Traits::move_or_copy_assign_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+        void reset() noexcept
+        {
+            if (!initial_)
+                return;
 
-            const auto constructed_end = max(base::size(), rhs.size());
-            for (size_t i = assigned_end; i < constructed_end; i++)
+            // the initial owned block is the last one in the list
+            block* keep = {};
+            if (owns_initial_)
             {
-                Traits::move_or_copy_construct_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
-                base::count_++;
+                keep = blocks_;
+                while (keep && keep->next)
+                    keep = keep->next;
             }
+            free_blocks(keep);
+            rewind();
+        }
 
-            return *this;
+        void release() noexcept
+        {
+            free_blocks(nullptr);
+            if (owns_initial_)
+            {
+                initial_      = {};
+                initial_size_ = {};
+                owns_initial_ = {};
+                cursor_       = {};
+                end_          = {};
+                bytes_used_   = {};
+            }
+            else if (initial_)
+                rewind();
         }
-    };
 
-    template <typename Traits, typename Allocator, bool Movable>
-    class SOAGEN_EMPTY_BASES table_move_assign<Traits, Allocator, /*UseBase*/ true, Movable> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        SOAGEN_PURE_INLINE_GETTER
+        size_type bytes_used() const noexcept
+        {
+            return bytes_used_;
+        }
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_move_assign);
+        SOAGEN_PURE_INLINE_GETTER
+        size_type bytes_reserved() const noexcept
+        {
+            return bytes_reserved_;
+        }
     };
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_move_assign<Traits, Allocator, /*UseBase*/ false, /*Movable*/ false> //
-        : public SOAGEN_BASE_TYPE
+    class arena_allocator
     {
+        arena* arena_;
+
       public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
 
-        table_move_assign()                                    = default;
-        table_move_assign(table_move_assign&&)                 = default;
-        table_move_assign(const table_move_assign&)            = default;
-        table_move_assign& operator=(const table_move_assign&) = default;
+        using is_always_equal = std::false_type;
 
-        // base operator is insufficient but the elements aren't movable so no choice but to explicitly delete
-        table_move_assign& operator=(table_move_assign&&) = delete;
-    };
+        using propagate_on_container_copy_assignment = std::true_type;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: copy-construct
-    //------------------------------------------------------------------------------------------------------------------
+        using propagate_on_container_move_assignment = std::true_type;
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_move_assign
+        using propagate_on_container_swap = std::true_type;
 
-    template <typename Traits, //
-              typename Allocator,
-              bool = Traits::all_copy_constructible && std::is_copy_constructible_v<Allocator>>
-    class SOAGEN_EMPTY_BASES table_copy_construct //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        static constexpr size_type min_alignment = arena::min_alignment;
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        SOAGEN_NODISCARD_CTOR
+        explicit arena_allocator(arena& a) noexcept //
+            : arena_{ &a }
+        {}
 
-        table_copy_construct()                                       = default;
-        table_copy_construct(table_copy_construct&&)                 = default;
-        table_copy_construct& operator=(table_copy_construct&&)      = default;
-        table_copy_construct& operator=(const table_copy_construct&) = default;
+        SOAGEN_PURE_INLINE_GETTER
+        arena& get_arena() const noexcept
+        {
+            return *arena_;
+        }
 
-        table_copy_construct(const table_copy_construct& other) noexcept(Traits::all_nothrow_copy_constructible //
-                                                                         && noexcept(base::reserve(size_t{})))
-            : base{ allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator()) }
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
         {
-            static_assert(std::is_nothrow_copy_constructible_v<Allocator>,
-                          "allocators must be nothrow copy-constructible");
+            return soagen::assume_aligned<min_alignment>(arena_->allocate(size, static_cast<size_type>(alignment)));
+        }
 
-            base::reserve(other.size());
-            Traits::copy_construct_rows(base::alloc_.columns, {}, other.alloc_.columns, {}, other.size());
-            base::count_ = other.size();
+        void deallocate(value_type*, size_type) noexcept
+        {}
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena_;
         }
     };
+    static_assert(std::is_nothrow_copy_constructible_v<arena_allocator>);
+    static_assert(std::is_nothrow_move_constructible_v<arena_allocator>);
+}
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_copy_construct<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_copy_construct);
-    };
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: copy-assign
-    //------------------------------------------------------------------------------------------------------------------
+//********  pool.hpp  **************************************************************************************************
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_copy_construct
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <cstdint>
+SOAGEN_ENABLE_WARNINGS;
 
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_copy_assignable    //
-                  && Traits::all_copy_constructible //
-                  && (!allocator_traits<Allocator>::propagate_on_container_copy_assignment::value
-                      || std::is_copy_assignable_v<Allocator>)>
-    class SOAGEN_EMPTY_BASES table_copy_assign //
-        : public SOAGEN_BASE_TYPE
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen::detail
+{
+    struct pool_counters
+    {
+        std::atomic<size_t> allocations;
+        std::atomic<size_t> hits;
+        std::atomic<size_t> deallocations;
+        std::atomic<size_t> releases;
+    };
+
+    inline pool_counters pool_stats_ = {};
+
+    // a per-thread cache of freed buffers, bucketed by size class and by the alignment each buffer actually has
+    class pool_cache
     {
+      public:
+        static constexpr size_t min_class_log2   = 6;  // 64 bytes
+        static constexpr size_t size_classes     = 16; // ... 2 MiB
+        static constexpr size_t min_align_log2   = 4;  // 16 bytes
+        static constexpr size_t align_classes    = 9;  // ... 4 KiB
+        static constexpr size_t max_bucket_count = 16;
+        static constexpr size_t max_cached_bytes = size_t{ 16 } * 1024u * 1024u;
+
+        static constexpr size_t max_pooled_size      = size_t{ 1 } << (min_class_log2 + size_classes - 1u);
+        static constexpr size_t max_pooled_alignment = size_t{ 1 } << (min_align_log2 + align_classes - 1u);
+
       private:
-        using base = SOAGEN_BASE_TYPE;
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        free_block* buckets_[size_classes][align_classes] = {};
+        size_t counts_[size_classes][align_classes]       = {};
+        size_t cached_bytes_                              = {};
+
+        static constexpr size_t log2_ceil(size_t val) noexcept
+        {
+            size_t log2 = 0;
+            while ((size_t{ 1 } << log2) < val)
+                log2++;
+            return log2;
+        }
 
       public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        SOAGEN_CONST_GETTER
+        static constexpr size_t size_class(size_t size) noexcept
+        {
+            const auto log2 = log2_ceil(size);
+            return log2 > min_class_log2 ? log2 - min_class_log2 : 0u;
+        }
 
-        table_copy_assign()                               = default;
-        table_copy_assign(table_copy_assign&&)            = default;
-        table_copy_assign& operator=(table_copy_assign&&) = default;
-        table_copy_assign(const table_copy_assign&)       = default;
+        SOAGEN_CONST_GETTER
+        static constexpr size_t class_size(size_t size_class) noexcept
+        {
+            return size_t{ 1 } << (size_class + min_class_log2);
+        }
 
-        constexpr table_copy_assign& operator=(const table_copy_assign& rhs) noexcept( // wtb: noexcept(auto)
-            Traits::all_nothrow_copy_assignable                                        //
-            && Traits::all_nothrow_copy_constructible                                  //
-            && noexcept(base::clear())                                                 //
-            && noexcept(base::pop_back())                                              //
-            && noexcept(base::reserve(size_t{})))
+        SOAGEN_CONST_GETTER
+        static constexpr size_t align_class(size_t alignment) noexcept
         {
-            if SOAGEN_UNLIKELY(&rhs == this)
-                return *this;
+            const auto log2 = log2_ceil(alignment);
+            return log2 > min_align_log2 ? log2 - min_align_log2 : 0u;
+        }
 
-            if constexpr (allocator_traits<Allocator>::propagate_on_container_copy_assignment::value
-                          || !allocator_traits<Allocator>::is_always_equal::value)
-            {
-                if (!allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
-                {
-                    base::clear();
-                    base::shrink_to_fit();
-                    SOAGEN_ASSERT(base::empty());
-                    SOAGEN_ASSERT(!base::alloc_);
-                }
-            }
+        // set when the thread's cache is destroyed. trivially destructible, so unlike the cache it can still be read
+        // by buffers freed later in thread-exit teardown (e.g. by static tables)
+        SOAGEN_PURE_INLINE_GETTER
+        static bool& destroyed() noexcept
+        {
+            static thread_local bool flag = false;
+            return flag;
+        }
 
-            if constexpr (allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
-            {
-                static_assert(std::is_nothrow_copy_assignable_v<Allocator>,
-                              "copy-propagated allocators must be nothrow copy-assignable");
+        pool_cache() noexcept = default;
 
-                base::allocator() = rhs.allocator();
-            }
+        pool_cache(const pool_cache&)            = delete;
+        pool_cache& operator=(const pool_cache&) = delete;
 
-            if (rhs.empty())
+        ~pool_cache() noexcept
+        {
+            trim();
+            destroyed() = true;
+        }
+
+        // pops a cached buffer of the given size class aligned to at least the given alignment class
+        std::byte* pop(size_t sc, size_t ac) noexcept
+        {
+            for (; ac < align_classes; ac++)
             {
-                base::clear();
-                return *this;
+                if (auto b = buckets_[sc][ac])
+                {
+                    buckets_[sc][ac] = b->next;
+                    counts_[sc][ac]--;
+                    cached_bytes_ -= class_size(sc);
+                    return reinterpret_cast<std::byte*>(b);
+                }
             }
+            return nullptr;
+        }
 
-            if (rhs.size() < base::size())
-                base::pop_back(base::size() - rhs.size());
+        // caches a buffer, returning false if the cache is full
+        bool push(std::byte* ptr, size_t sc) noexcept
+        {
+            const auto bytes = class_size(sc);
+            const auto tz    = static_cast<size_t>(countr_zero(reinterpret_cast<std::uintptr_t>(ptr)));
+            const auto ac    = tz > min_align_log2 ? min(tz - min_align_log2, align_classes - 1u) : 0u;
 
-            base::reserve(rhs.size());
+            if (counts_[sc][ac] >= max_bucket_count || cached_bytes_ + bytes > max_cached_bytes)
+                return false;
 
-            const auto assigned_end = min(base::size(), rhs.size());
-            for (size_t i = 0; i < assigned_end; i++)
-                Traits::copy_assign_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
+            buckets_[sc][ac] = ::new (static_cast<void*>(ptr)) free_block{ buckets_[sc][ac] };
+            counts_[sc][ac]++;
+            cached_bytes_ += bytes;
+            return true;
+        }
 
-            const auto constructed_end = max(base::size(), rhs.size());
-            for (size_t i = assigned_end; i < constructed_end; i++)
+        void trim() noexcept
+        {
+            for (size_t sc = 0; sc < size_classes; sc++)
             {
-                Traits::copy_construct_row(base::alloc_.columns, i, rhs.alloc_.columns, i);
-                base::count_++;
+                for (size_t ac = 0; ac < align_classes; ac++)
+                {
+                    while (auto b = buckets_[sc][ac])
+                    {
+                        buckets_[sc][ac] = b->next;
+                        allocator{}.deallocate(reinterpret_cast<std::byte*>(b), class_size(sc));
+                        pool_stats_.releases.fetch_add(1u, std::memory_order_relaxed);
+                    }
+                    counts_[sc][ac] = 0;
+                }
             }
+            cached_bytes_ = 0;
+        }
 
-            return *this;
+        SOAGEN_PURE_INLINE_GETTER
+        size_t cached_bytes() const noexcept
+        {
+            return cached_bytes_;
         }
-    };
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_copy_assign<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        // the calling thread's cache, or nullptr if it has already been destroyed
+        static pool_cache* local() noexcept
+        {
+            if (destroyed())
+                return nullptr;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_copy_assign);
+            static thread_local pool_cache cache;
+            return &cache;
+        }
     };
+}
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: row erasure
-    //------------------------------------------------------------------------------------------------------------------
-
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_copy_assign
-
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_move_or_copy_assignable>
-    class SOAGEN_EMPTY_BASES table_row_erasure //
-        : public SOAGEN_BASE_TYPE
+namespace soagen
+{
+    struct pool_stats
     {
-      private:
-        using base = SOAGEN_BASE_TYPE;
-
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        std::size_t allocations;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure);
+        std::size_t hits;
 
-        void erase(size_t pos)                                   //
-            noexcept(Traits::all_nothrow_move_or_copy_assignable //
-                     && noexcept(base::pop_back()))
-        {
-            SOAGEN_ASSUME(pos < base::count_);
+        std::size_t deallocations;
 
-            if (pos + 1u < base::count_)
-                Traits::move_or_copy_assign_rows(base::alloc_.columns,
-                                                 pos,
-                                                 base::alloc_.columns,
-                                                 pos + 1u,
-                                                 base::count_ - pos - 1u);
+        std::size_t releases;
 
-            base::pop_back();
+        SOAGEN_PURE_GETTER
+        double hit_rate() const noexcept
+        {
+            return allocations ? static_cast<double>(hits) / static_cast<double>(allocations) : 0.0;
         }
     };
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_row_erasure<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
+    struct pool_allocator
     {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure);
-    };
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: row erasure (unordered)
-    //------------------------------------------------------------------------------------------------------------------
+        using is_always_equal = std::true_type;
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_row_erasure
+        using propagate_on_container_copy_assignment = std::false_type;
 
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_swappable>
-    class SOAGEN_EMPTY_BASES table_row_erasure_unordered //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        using propagate_on_container_move_assignment = std::false_type;
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        using propagate_on_container_swap = std::false_type;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure_unordered);
+        static constexpr size_type min_alignment = allocator::min_alignment;
 
-        soagen::optional<size_t> unordered_erase(size_t pos) //
-            noexcept(Traits::all_nothrow_swappable           //
-                     && noexcept(base::pop_back()))
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
         {
-            SOAGEN_ASSUME(pos < base::count_);
+            using cache = detail::pool_cache;
 
-            if (pos + 1u == base::count_)
+            detail::pool_stats_.allocations.fetch_add(1u, std::memory_order_relaxed);
+            if (size > cache::max_pooled_size)
+                return allocator{}.allocate(size, alignment);
+
+            // cached buffers are only known to be aligned up to the largest alignment class, so stricter requests
+            // always go to the system. they're still rounded up to the size class, since deallocate() can't tell
+            // them apart and will cache them like any other buffer (in the largest alignment class).
+            const auto sc = cache::size_class(size);
+            if (static_cast<size_t>(alignment) > cache::max_pooled_alignment)
+                return allocator{}.allocate(cache::class_size(sc), alignment);
+
+            const auto c = cache::local();
+            if (auto ptr = c ? c->pop(sc, cache::align_class(static_cast<size_t>(alignment))) : nullptr)
             {
-                base::pop_back();
-                return {};
+                detail::pool_stats_.hits.fetch_add(1u, std::memory_order_relaxed);
+                return soagen::assume_aligned<min_alignment>(ptr);
             }
 
-            Traits::swap_rows(base::alloc_.columns, pos, base::alloc_.columns, base::count_ - 1u);
-            base::pop_back();
-            return soagen::optional<size_t>{ base::count_ };
+            return allocator{}.allocate(cache::class_size(sc), alignment);
         }
-    };
-
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_row_erasure_unordered<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_row_erasure_unordered);
-    };
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
+        {
+            using cache = detail::pool_cache;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: EqualityComparable
-    //------------------------------------------------------------------------------------------------------------------
+            detail::pool_stats_.deallocations.fetch_add(1u, std::memory_order_relaxed);
+            if (size <= cache::max_pooled_size)
+            {
+                if (const auto c = cache::local(); c && c->push(ptr, cache::size_class(size)))
+                    return;
+            }
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_row_erasure_unordered
+            detail::pool_stats_.releases.fetch_add(1u, std::memory_order_relaxed);
+            allocator{}.deallocate(ptr, size);
+        }
 
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_equality_comparable>
-    class SOAGEN_EMPTY_BASES table_equality_compare //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        SOAGEN_NODISCARD
+        static pool_stats stats() noexcept
+        {
+            return { detail::pool_stats_.allocations.load(std::memory_order_relaxed),
+                     detail::pool_stats_.hits.load(std::memory_order_relaxed),
+                     detail::pool_stats_.deallocations.load(std::memory_order_relaxed),
+                     detail::pool_stats_.releases.load(std::memory_order_relaxed) };
+        }
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_equality_compare);
+        static void reset_stats() noexcept
+        {
+            detail::pool_stats_.allocations.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.hits.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.deallocations.store(0u, std::memory_order_relaxed);
+            detail::pool_stats_.releases.store(0u, std::memory_order_relaxed);
+        }
 
         SOAGEN_NODISCARD
-        friend constexpr bool operator==(const table_equality_compare& lhs,
-                                         const table_equality_compare& rhs) //
-            noexcept(Traits::all_nothrow_equality_comparable)
+        static size_type cached_bytes() noexcept
         {
-            if (&lhs == &rhs || (lhs.empty() && rhs.empty()))
-                return true;
+            const auto c = detail::pool_cache::local();
+            return c ? c->cached_bytes() : 0u;
+        }
 
-            if (lhs.size() != rhs.size())
-                return false;
+        static void trim() noexcept
+        {
+            if (const auto c = detail::pool_cache::local())
+                c->trim();
+        }
 
-            return Traits::equal(lhs.alloc_.columns, {}, rhs.alloc_.columns, {}, lhs.size());
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator==(const pool_allocator&, const pool_allocator&) noexcept
+        {
+            return true;
         }
 
-        SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator!=(const table_equality_compare& lhs,
-                                         const table_equality_compare& rhs) //
-            noexcept(Traits::all_nothrow_equality_comparable)
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator!=(const pool_allocator&, const pool_allocator&) noexcept
         {
-            return !(lhs == rhs);
+            return false;
         }
     };
+    static_assert(std::is_trivially_default_constructible_v<pool_allocator>);
+    static_assert(std::is_trivially_copy_constructible_v<pool_allocator>);
+    static_assert(std::is_trivially_destructible_v<pool_allocator>);
+}
+
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
+
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
+
+//********  huge_pages.hpp  ********************************************************************************************
+
+SOAGEN_DISABLE_WARNINGS;
+#include <cstdint>
+#if SOAGEN_UNIX
+    #include <sys/mman.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
+
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
+
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
+
+namespace soagen
+{
+    struct huge_page_allocator
+    {
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_equality_compare<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        using is_always_equal = std::true_type;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_equality_compare);
-    };
+        using propagate_on_container_copy_assignment = std::false_type;
 
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: LessThanComparable
-    //------------------------------------------------------------------------------------------------------------------
+        using propagate_on_container_move_assignment = std::false_type;
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_equality_compare
+        using propagate_on_container_swap = std::false_type;
 
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_less_than_comparable>
-    class SOAGEN_EMPTY_BASES table_less_than_compare //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        static constexpr size_type min_alignment = allocator::min_alignment;
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+        static constexpr size_type page_size = 4096;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_less_than_compare);
+        static constexpr size_type huge_page_size = size_type{ 2 } * 1024u * 1024u;
 
-        SOAGEN_NODISCARD
-        constexpr int compare(const table_less_than_compare& rhs) const //
-            noexcept(Traits::all_nothrow_less_than_comparable)
-        {
-            if (&rhs == this)
-                return 0;
-            if (base::empty())
-                return rhs.empty() ? 0 : -1;
-            if (rhs.empty())
-                return 1;
+        static constexpr size_type threshold = huge_page_size;
 
-            const auto comp = Traits::compare(base::alloc_.columns, //
-                                              {},
-                                              rhs.alloc_.columns,
-                                              {},
-                                              min(base::size(), rhs.size()));
+        static constexpr size_type column_alignment = page_size;
 
-            return comp != 0 ? comp : (base::size() == rhs.size() ? 0 : (base::size() < rhs.size() ? -1 : 1));
+      private:
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type round_up(size_type size, size_type alignment) noexcept
+        {
+            return (size + alignment - 1u) & ~(alignment - 1u);
         }
 
+      public:
         SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator<(const table_less_than_compare& lhs,
-                                        const table_less_than_compare& rhs) //
-            noexcept(Traits::all_nothrow_less_than_comparable)
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
         {
-            return lhs.compare(rhs) < 0;
+            SOAGEN_ASSUME(size);
+            SOAGEN_ASSERT(static_cast<size_type>(alignment) <= huge_page_size);
+
+#if SOAGEN_UNIX
+            if (size >= threshold)
+            {
+                // over-map by one huge page so the start can be aligned, then give the slop back
+                const auto bytes = round_up(size, huge_page_size);
+                void* raw        = mmap(nullptr,
+                                 bytes + huge_page_size,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS,
+                                 -1,
+                                 0);
+                if SOAGEN_UNLIKELY(raw == MAP_FAILED)
+                    SOAGEN_THROW(std::bad_alloc{});
+
+                const auto raw_addr = reinterpret_cast<std::uintptr_t>(raw);
+                const auto head     = static_cast<size_type>(round_up(raw_addr, huge_page_size) - raw_addr);
+                const auto ptr      = static_cast<pointer>(raw) + head;
+                if (head)
+                    munmap(raw, head);
+                if (head != huge_page_size)
+                    munmap(ptr + bytes, huge_page_size - head);
+
+    #ifdef MADV_HUGEPAGE
+                madvise(ptr, bytes, MADV_HUGEPAGE);
+    #endif
+                return soagen::assume_aligned<min_alignment>(ptr);
+            }
+#endif
+
+            if (size >= page_size)
+                alignment = std::align_val_t{ max(static_cast<size_type>(alignment), page_size) };
+            return allocator{}.allocate(size, alignment);
         }
 
-        SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator<=(const table_less_than_compare& lhs,
-                                         const table_less_than_compare& rhs) //
-            noexcept(Traits::all_nothrow_less_than_comparable)
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
         {
-            return lhs.compare(rhs) <= 0;
+            SOAGEN_ASSUME(ptr != nullptr);
+            SOAGEN_ASSUME(size);
+
+#if SOAGEN_UNIX
+            if (size >= threshold)
+            {
+                munmap(ptr, round_up(size, huge_page_size));
+                return;
+            }
+#endif
+
+            allocator{}.deallocate(ptr, size);
         }
 
-        SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator>(const table_less_than_compare& lhs,
-                                        const table_less_than_compare& rhs) //
-            noexcept(Traits::all_nothrow_less_than_comparable)
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator==(const huge_page_allocator&, const huge_page_allocator&) noexcept
         {
-            return lhs.compare(rhs) > 0;
+            return true;
         }
 
-        SOAGEN_NODISCARD
-        SOAGEN_ALWAYS_INLINE
-        friend constexpr bool operator>=(const table_less_than_compare& lhs,
-                                         const table_less_than_compare& rhs) //
-            noexcept(Traits::all_nothrow_less_than_comparable)
+        SOAGEN_CONST_INLINE_GETTER
+        friend bool operator!=(const huge_page_allocator&, const huge_page_allocator&) noexcept
         {
-            return lhs.compare(rhs) >= 0;
+            return false;
         }
     };
+    static_assert(std::is_trivially_default_constructible_v<huge_page_allocator>);
+    static_assert(std::is_trivially_copy_constructible_v<huge_page_allocator>);
+    static_assert(std::is_trivially_destructible_v<huge_page_allocator>);
+}
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_less_than_compare<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
-    {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_less_than_compare);
-    };
-
-    //------------------------------------------------------------------------------------------------------------------
-    // specialization: data()
-    //------------------------------------------------------------------------------------------------------------------
-
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_less_than_compare
-
-    template <typename Traits,
-              typename Allocator,
-              bool = Traits::all_trivially_copyable>
-    class SOAGEN_EMPTY_BASES table_data_ptr //
-        : public SOAGEN_BASE_TYPE
-    {
-      private:
-        using base = SOAGEN_BASE_TYPE;
+// reset optimizations
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma float_control(pop)
+        #pragma strict_gs_check(pop)
+        #pragma runtime_checks("", restore)
+        #if !SOAGEN_CLANG
+            #pragma optimize("", on)
+        #endif
+        #pragma inline_recursion(off)
+    #endif
+#endif
 
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
+// pop current states
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma pop_macro("min")
+    #pragma pop_macro("max")
+    #pragma pop_macro("finite")
+#endif
+#if SOAGEN_GCC
+    #pragma GCC pop_options
+#endif
+SOAGEN_POP_WARNINGS;
 
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_data_ptr);
+//********  numa.hpp  **************************************************************************************************
 
-        using table_type     = table<Traits, Allocator>;
-        using table_traits   = Traits;
-        using allocator_type = Allocator;
+SOAGEN_DISABLE_WARNINGS;
+#include <array>
+#include <climits>
+#include <cstdint>
+#if SOAGEN_LINUX
+    #include <cstdio>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+SOAGEN_ENABLE_WARNINGS;
 
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_GNU_ATTR(returns_nonnull)
-        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
-        constexpr std::byte* data() noexcept
-        {
-            return soagen::assume_aligned<buffer_alignment<table_type>>(base::alloc_.ptr);
-        }
+// push current states
+SOAGEN_PUSH_WARNINGS; // NOLINT(fsw-bugprone-unbalanced-pragmas): intentional
+SOAGEN_DISABLE_SPAM_WARNINGS;
+SOAGEN_DISABLE_SHADOW_WARNINGS;
+SOAGEN_DISABLE_GCC_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_GCC_WARNING_GE(12, "-Wnonnull-compare");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++14-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wc++17-extensions");
+SOAGEN_DISABLE_CLANG_WARNING("-Wredundant-consteval-if");
+SOAGEN_DISABLE_CLANG_WARNING("-Wnested-anon-types");
+SOAGEN_DISABLE_MSVC_WARNING(4201); // nameless struct/union
+SOAGEN_DISABLE_MSVC_WARNING(4984); // if constexpr language extension
+#if SOAGEN_GCC
+    #pragma GCC push_options
+#endif
+#if SOAGEN_MSVC_LIKE || SOAGEN_GCC_LIKE
+    #pragma push_macro("min")
+    #pragma push_macro("max")
+    #pragma push_macro("finite")
+    #undef min
+    #undef max
+    #undef finite
+#endif
 
-        SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_GNU_ATTR(returns_nonnull)
-        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
-        constexpr const std::byte* data() const noexcept
-        {
-            return soagen::assume_aligned<buffer_alignment<table_type>>(base::alloc_.ptr);
-        }
-    };
+// set optimizations
+#ifndef SOAGEN_ALWAYS_OPTIMIZE
+    #define SOAGEN_ALWAYS_OPTIMIZE 1
+#endif
+#if SOAGEN_ALWAYS_OPTIMIZE
+    #if SOAGEN_MSVC_LIKE
+        #pragma inline_recursion(on)
+        #if !SOAGEN_CLANG
+            #pragma optimize("gt", on)
+        #endif
+        #pragma runtime_checks("", off)
+        #pragma strict_gs_check(push, off)
+        #pragma float_control(precise, off, push)
+        #pragma float_control(except, off)
+    #elif SOAGEN_GCC
+        #if (!defined(__OPTIMIZE__) || !defined(NDEBUG))
+            #pragma GCC optimize("Os")
+        #endif
+    #endif
+#endif
 
-    template <typename Traits, typename Allocator>
-    class SOAGEN_EMPTY_BASES table_data_ptr<Traits, Allocator, false> //
-        : public SOAGEN_BASE_TYPE
+namespace soagen::detail
+{
+    inline size_t read_numa_node_count() noexcept
     {
-      public:
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-
-        SOAGEN_DEFAULT_RULE_OF_FIVE(table_data_ptr);
-    };
+#if SOAGEN_LINUX
+        // e.g. "0" or "0-1"; the highest node id is the last number in the list
+        if (auto f = std::fopen("/sys/devices/system/node/possible", "r"))
+        {
+            size_t last = {};
+            size_t val  = {};
+            bool digits = {};
+            for (int c = std::fgetc(f); c != EOF; c = std::fgetc(f))
+            {
+                if (c >= '0' && c <= '9')
+                {
+                    val    = val * 10u + static_cast<size_t>(c - '0');
+                    digits = true;
+                }
+                else
+                {
+                    if (digits)
+                        last = val;
+                    val    = {};
+                    digits = {};
+                }
+            }
+            std::fclose(f);
+            return (digits ? val : last) + 1u;
+        }
+#endif
+        return 1;
+    }
 }
 
-#undef SOAGEN_BASE_NAME
-#define SOAGEN_BASE_NAME table_data_ptr
-#undef SOAGEN_BASE_TYPE
-#define SOAGEN_BASE_TYPE detail::SOAGEN_BASE_NAME<Traits, Allocator>
-
 namespace soagen
 {
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES table_base
-    {};
-
-    template <typename Traits,
-              typename Allocator = soagen::allocator>
-    class SOAGEN_EMPTY_BASES table //
-        SOAGEN_HIDDEN_BASE(public SOAGEN_BASE_TYPE,
-                           public table_base<table<Traits, Allocator>>,
-                           public mixins::columns<table<Traits, Allocator>>,
-                           public mixins::rows<table<Traits, Allocator>>,
-                           public mixins::iterators<table<Traits, Allocator>>)
+    SOAGEN_NODISCARD
+    inline std::size_t numa_node_count() noexcept
     {
-        static_assert(std::is_empty_v<table_base<table>>, "table_base specializations may not have data members");
-        static_assert(std::is_trivial_v<table_base<table>>, "table_base specializations must be trivial");
-
-      private:
-        using base = SOAGEN_BASE_TYPE;
+        static const size_t count = detail::read_numa_node_count();
+        return count;
+    }
+
+    class numa_allocator
+    {
+        int node_ = -1;
 
       public:
-        using size_type = std::size_t;
+        using value_type         = std::byte;
+        using pointer            = value_type*;
+        using const_pointer      = const value_type*;
+        using void_pointer       = std::byte*;
+        using const_void_pointer = const std::byte*;
+        using size_type          = std::size_t;
+        using difference_type    = std::ptrdiff_t;
 
-        using difference_type = std::ptrdiff_t;
+        using is_always_equal = std::false_type;
 
-        using allocator_type = Allocator;
-        static_assert(!detail::is_cvref<allocator_type>::value, "allocators may not be cvref-qualified");
+        using propagate_on_container_copy_assignment = std::true_type;
 
-        using table_traits = Traits;
-        static_assert(is_table_traits<table_traits>, "Traits must be an instance of soagen::table_traits");
-        static_assert(!detail::is_cvref<table_traits>::value, "table traits may not be cvref-qualified");
+        using propagate_on_container_move_assignment = std::true_type;
 
-        static constexpr size_type column_count = table_traits::column_count;
+        using propagate_on_container_swap = std::true_type;
 
-        template <auto Column>
-        using column_traits =
-            typename table_traits::template column<static_cast<size_type>(Column)>;
+        static constexpr size_type min_alignment = allocator::min_alignment;
 
-        template <auto Column>
-        using column_type =
-            typename column_traits<static_cast<size_type>(Column)>::value_type;
+        static constexpr size_type page_size = 4096;
 
-        static constexpr size_t aligned_stride = table_traits::aligned_stride;
+      private:
+        SOAGEN_PURE_INLINE_GETTER
+        bool maps(size_type size) const noexcept
+        {
+#if SOAGEN_LINUX
+            return node_ >= 0 && size >= page_size;
+#else
+            static_cast<void>(size);
+            return false;
+#endif
+        }
 
-        SOAGEN_NODISCARD_CTOR
-        table() = default;
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type round_up(size_type size) noexcept
+        {
+            return (size + page_size - 1u) & ~(page_size - 1u);
+        }
 
+      public:
         SOAGEN_NODISCARD_CTOR
-        table(table&&) = default;
-
-        table& operator=(table&&) = default;
+        numa_allocator() noexcept = default;
 
         SOAGEN_NODISCARD_CTOR
-        table(const table&) = default;
-
-        table& operator=(const table&) = default;
-
-        ~table() = default;
+        explicit numa_allocator(int node) noexcept //
+            : node_{ node }
+        {}
 
-        template <auto Column>
-        SOAGEN_COLUMN(table, Column)
-        constexpr column_type<Column>* column() noexcept
+        SOAGEN_PURE_INLINE_GETTER
+        int node() const noexcept
         {
-            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+            return node_;
+        }
 
-            using column       = column_traits<static_cast<size_type>(Column)>;
-            using storage_type = typename column::storage_type;
-            using value_type   = typename column::value_type;
+        SOAGEN_NODISCARD
+        SOAGEN_GNU_ATTR(assume_aligned(min_alignment))
+        SOAGEN_GNU_ATTR(returns_nonnull)
+        value_type* allocate(size_type size, std::align_val_t alignment = std::align_val_t{ min_alignment })
+        {
+            SOAGEN_ASSUME(size);
 
-            if constexpr (std::is_pointer_v<storage_type>)
+#if SOAGEN_LINUX
+            if (maps(size))
             {
-                static_assert(std::is_same_v<storage_type, void*>);
+                SOAGEN_ASSERT(static_cast<size_type>(alignment) <= page_size);
 
-                return soagen::assume_aligned<actual_alignment<table, Column>>(SOAGEN_LAUNDER(
-                    reinterpret_cast<value_type*>(base::alloc_.columns[static_cast<size_type>(Column)])));
-            }
-            else
-            {
-                static_assert(std::is_same_v<storage_type, std::remove_cv_t<value_type>>);
+                const auto bytes = round_up(size);
+                void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if SOAGEN_UNLIKELY(ptr == MAP_FAILED)
+                    SOAGEN_THROW(std::bad_alloc{});
 
-                return soagen::assume_aligned<actual_alignment<table, Column>>(
-                    column::ptr(base::alloc_.columns[static_cast<size_type>(Column)]));
+                // MPOL_PREFERRED (1); failure (no NUMA support, node out of range) just leaves it to first-touch
+                constexpr size_type mask_bits = 1024;
+                if (static_cast<size_type>(node_) < mask_bits)
+                {
+                    unsigned long mask[mask_bits / (sizeof(unsigned long) * CHAR_BIT)] = {};
+                    mask[static_cast<size_type>(node_) / (sizeof(unsigned long) * CHAR_BIT)] =
+                        1ul << (static_cast<size_type>(node_) % (sizeof(unsigned long) * CHAR_BIT));
+                    static_cast<void>(syscall(SYS_mbind, ptr, bytes, 1, mask, mask_bits + 1u, 0u));
+                }
+
+                return soagen::assume_aligned<min_alignment>(static_cast<pointer>(ptr));
             }
-        }
+#endif
 
-        template <auto Column>
-        SOAGEN_COLUMN(table, Column)
-        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
-        {
-            return const_cast<table&>(*this).template column<static_cast<size_type>(Column)>();
+            return allocator{}.allocate(size, alignment);
         }
 
-        using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
-    };
-
-    SOAGEN_CONSTRAINED_TEMPLATE((detail::has_swap_member<table<Args...>>::value), typename... Args)
-    SOAGEN_ALWAYS_INLINE
-    constexpr void swap(table<Args...>& lhs, table<Args...>& rhs) //
-        noexcept(detail::has_nothrow_swap_member<table<Args...>>::value)
-    {
-        lhs.swap(rhs);
-    }
-}
-
-#undef SOAGEN_BASE_NAME
-#undef SOAGEN_BASE_TYPE
-
-//********  mixins/data_ptr.hpp  ***************************************************************************************
+        SOAGEN_GNU_ATTR(nonnull)
+        void deallocate(value_type* ptr, size_type size) noexcept
+        {
+            SOAGEN_ASSUME(ptr != nullptr);
+            SOAGEN_ASSUME(size);
 
-namespace soagen::mixins
-{
-    template <typename Derived, bool = detail::has_data_member<table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES data_ptr
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+#if SOAGEN_LINUX
+            if (maps(size))
+            {
+                munmap(ptr, round_up(size));
+                return;
+            }
+#endif
 
-        using table_type = soagen::table_type<Derived>;
+            allocator{}.deallocate(ptr, size);
+        }
 
         SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_GNU_ATTR(returns_nonnull)
-        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
-        constexpr std::byte* data() //
-            noexcept(detail::has_nothrow_data_member<table_type>::value)
+        friend bool operator==(const numa_allocator& lhs, const numa_allocator& rhs) noexcept
         {
-            return soagen::assume_aligned<buffer_alignment<table_type>>(
-                static_cast<table_type&>(static_cast<Derived&>(*this)).data());
+            return lhs.node_ == rhs.node_;
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        SOAGEN_GNU_ATTR(returns_nonnull)
-        SOAGEN_GNU_ATTR(assume_aligned(buffer_alignment<table_type>))
-        constexpr const std::byte* data() const //
-            noexcept(detail::has_nothrow_data_member<const table_type>::value)
+        friend bool operator!=(const numa_allocator& lhs, const numa_allocator& rhs) noexcept
         {
-            return soagen::assume_aligned<buffer_alignment<table_type>>(
-                static_cast<const table_type&>(static_cast<const Derived&>(*this)).data());
+            return lhs.node_ != rhs.node_;
         }
     };
+    static_assert(std::is_nothrow_copy_constructible_v<numa_allocator>);
+    static_assert(std::is_nothrow_move_constructible_v<numa_allocator>);
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES data_ptr<Derived, false>
-    {};
-}
+    template <typename Soa, size_t Shards, size_t BlockRows = 1024, typename Allocator = numa_allocator>
+    class sharded_table
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(Shards > 0, "there must be at least one shard");
+        static_assert(BlockRows > 0, "BlockRows may not be zero");
 
-//********  mixins/resizable.hpp  **************************************************************************************
+      public:
+        using soa_type = Soa;
 
-namespace soagen::mixins
-{
-    template <typename Derived, bool = detail::has_resize_member<table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES resizable
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+        using size_type = std::size_t;
 
-        using table_type = soagen::table_type<Derived>;
-        using size_type  = std::size_t;
+        using shard_type = soagen::table<table_traits_type<Soa>, Allocator>;
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& resize(size_type new_size) //
-            noexcept(detail::has_nothrow_resize_member<table_type>::value)
-        {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).resize(new_size);
-            return static_cast<Derived&>(*this);
-        }
+        static constexpr size_type shard_count = Shards;
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& resize_for_overwrite(size_type new_size) //
-            noexcept(noexcept(std::declval<table_type&>().resize_for_overwrite(std::declval<size_type>())))
+        static constexpr size_type block_rows = BlockRows;
+
+        struct location
         {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).resize_for_overwrite(new_size);
-            return static_cast<Derived&>(*this);
-        }
-    };
+            size_type shard;
 
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES resizable<Derived, false>
-    {};
-}
+            size_type index;
+        };
 
-//********  mixins/size_and_capacity.hpp  ******************************************************************************
+      private:
+        std::array<shard_type, Shards> shards_;
+        size_type size_ = {};
 
-namespace soagen::mixins
-{
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES size_and_capacity
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+        template <size_t... Indices>
+        static std::array<shard_type, Shards> make_shards(std::index_sequence<Indices...>)
+        {
+            if constexpr (std::is_constructible_v<Allocator, int>)
+            {
+                const auto nodes = numa_node_count();
+                return { shard_type{ Allocator{ static_cast<int>(Indices % nodes) } }... };
+            }
+            else
+                return { (static_cast<void>(Indices), shard_type{})... };
+        }
 
-        using table_type = soagen::table_type<Derived>;
-        using size_type  = std::size_t;
+        // the number of rows shard `shard` holds when the whole table has `rows` rows
+        SOAGEN_CONST_GETTER
+        static constexpr size_type shard_rows(size_type rows, size_type shard) noexcept
+        {
+            const auto rem = rows % (BlockRows * Shards);
+            return (rows / (BlockRows * Shards)) * BlockRows
+                 + (rem > shard * BlockRows ? min(rem - shard * BlockRows, BlockRows) : size_type{});
+        }
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        sharded_table() //
+            : shards_{ make_shards(std::make_index_sequence<Shards>{}) }
+        {}
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr bool empty() const noexcept
+        size_type size() const noexcept
         {
-            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).empty();
+            return size_;
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type size() const noexcept
+        bool empty() const noexcept
         {
-            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).size();
+            return !size_;
         }
 
-        SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type max_size() const noexcept
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr location locate(size_type row) noexcept
         {
-            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).max_size();
+            const auto block = row / BlockRows;
+            return { block % Shards, (block / Shards) * BlockRows + row % BlockRows };
+        }
+
+        SOAGEN_CONST_INLINE_GETTER
+        static constexpr size_type row_index(size_type shard, size_type index) noexcept
+        {
+            return ((index / BlockRows) * Shards + shard) * BlockRows + index % BlockRows;
         }
 
         SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type allocation_size() const noexcept
+        shard_type& shard(size_type index) noexcept
         {
-            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).allocation_size();
+            SOAGEN_ASSUME(index < Shards);
+            return shards_[index];
         }
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& reserve(size_type new_cap) //
-            noexcept(noexcept(std::declval<table_type&>().reserve(size_type{})))
+        SOAGEN_PURE_INLINE_GETTER
+        const shard_type& shard(size_type index) const noexcept
         {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).reserve(new_cap);
-            return static_cast<Derived&>(*this);
+            SOAGEN_ASSUME(index < Shards);
+            return shards_[index];
         }
 
+        template <auto Column>
         SOAGEN_PURE_INLINE_GETTER
-        constexpr size_type capacity() const noexcept
+        value_type<Soa, Column>& get(size_type row) noexcept
         {
-            return static_cast<const table_type&>(static_cast<const Derived&>(*this)).capacity();
+            SOAGEN_ASSUME(row < size_);
+            const auto loc = locate(row);
+            return shards_[loc.shard].template column<static_cast<size_type>(Column)>()[loc.index];
         }
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& shrink_to_fit() //
-            noexcept(noexcept(std::declval<table_type&>().shrink_to_fit()))
+        template <auto Column>
+        SOAGEN_PURE_INLINE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
         {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).shrink_to_fit();
-            return static_cast<Derived&>(*this);
+            SOAGEN_ASSUME(row < size_);
+            const auto loc = locate(row);
+            return shards_[loc.shard].template column<static_cast<size_type>(Column)>()[loc.index];
         }
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& pop_back(size_type num = 1) //
-            noexcept(noexcept(std::declval<table_type&>().pop_back(size_type{})))
+        template <typename Func>
+        void for_each_shard(Func&& func)
         {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).pop_back(num);
-            return static_cast<Derived&>(*this);
+            for (size_type i = 0; i < Shards; i++)
+                func(i, shards_[i]);
         }
 
-        SOAGEN_RESETTER
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        Derived& clear() noexcept
+        template <typename Func>
+        void for_each_shard(Func&& func) const
         {
-            static_cast<table_type&>(static_cast<Derived&>(*this)).clear();
-            return static_cast<Derived&>(*this);
+            for (size_type i = 0; i < Shards; i++)
+                func(i, shards_[i]);
         }
-    };
-}
 
-//********  mixins/swappable.hpp  **************************************************************************************
+        void reserve(size_type new_cap)
+        {
+            for (size_type i = 0; i < Shards; i++)
+                shards_[i].reserve(shard_rows(new_cap, i));
+        }
 
-namespace soagen::mixins
-{
-    template <typename Derived, bool = detail::has_swap_member<table_type<Derived>>::value>
-    struct SOAGEN_EMPTY_BASES swappable
-    {
-        static_assert(!detail::is_cvref<Derived>::value);
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            shards_[locate(size_).shard].emplace_back(static_cast<Args&&>(args)...);
+            size_++;
+        }
 
-        using table_type = soagen::table_type<Derived>;
+        void pop_back(size_type num = 1) noexcept
+        {
+            num = min(num, size_);
+            for (; num; num--)
+                shards_[locate(--size_).shard].pop_back();
+        }
 
-        SOAGEN_ALWAYS_INLINE
-        SOAGEN_CONSTEXPR_20
-        void swap(Derived& other) //
-            noexcept(detail::has_nothrow_swap_member<table_type>::value)
+        void clear() noexcept
         {
-            return static_cast<table_type&>(static_cast<Derived&>(*this)).swap(static_cast<table_type&>(other));
+            for (auto& s : shards_)
+                s.clear();
+            size_ = {};
         }
     };
-
-    template <typename Derived>
-    struct SOAGEN_EMPTY_BASES swappable<Derived, false>
-    {};
 }
 
 // reset optimizations
@@ -10465,8 +19244,6 @@ namespace soagen::mixins
 #endif
 SOAGEN_POP_WARNINGS;
 
-//********  mixins/all.hpp  ********************************************************************************************
-
 // IWYU pragma: end_exports
 
 #undef SOAGEN_ADDRESS_OF
@@ -10606,6 +19383,7 @@ SOAGEN_POP_WARNINGS;
 #undef SOAGEN_IF_RUNTIME
 #undef SOAGEN_IN
 #undef SOAGEN_INOUT
+#undef SOAGEN_INSTRUMENT
 #undef SOAGEN_INTELLISENSE
 #undef SOAGEN_ISET_AVX
 #undef SOAGEN_ISET_AVX2
@@ -10625,12 +19403,14 @@ SOAGEN_POP_WARNINGS;
 #undef SOAGEN_MAKE_VERSION
 #undef SOAGEN_NEVER_INLINE
 #undef SOAGEN_NODISCARD_CLASS
+#undef SOAGEN_NONTEMPORAL_THRESHOLD
 #undef SOAGEN_NOOP
 #undef SOAGEN_NO_UNIQUE_ADDRESS
 #undef SOAGEN_OPTIONAL_TYPE
 #undef SOAGEN_OUT
 #undef SOAGEN_OUTLINE_STATIC_CONSTEXPR_MEMBER
 #undef SOAGEN_OWNER
+#undef SOAGEN_PREFETCH
 #undef SOAGEN_STATIC_CONSTEXPR_23
 #undef SOAGEN_THROW
 #undef SOAGEN_TRY
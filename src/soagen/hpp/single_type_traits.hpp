@@ -208,6 +208,22 @@ namespace soagen::detail
     template <typename T>
     using has_nothrow_data_member = conjunction<has_data_member<T>, has_nothrow_data_member_<T>>;
 
+    // ---- contiguous ranges (data() + size())
+
+    template <typename T>
+    using has_size_member_ = decltype(std::declval<T&>().size());
+
+    template <typename T,
+              typename Value,
+              bool = conjunction<has_data_member<T>, is_detected<has_size_member_, T>>::value>
+    struct is_contiguous_range_of : std::false_type
+    {};
+    template <typename T, typename Value>
+    struct is_contiguous_range_of<T, Value, true>
+        : conjunction<std::is_pointer<decltype(std::declval<T&>().data())>,
+                      std::is_same<remove_cvref<decltype(*std::declval<T&>().data())>, Value>>
+    {};
+
     // ---- has emplace()
 
     template <typename T, typename Pos, typename... Args>
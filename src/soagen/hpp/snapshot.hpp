@@ -0,0 +1,503 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+/// @cond
+namespace soagen::detail
+{
+    // a fixed-capacity block of one column's elements, shared between a cow_table and its snapshots
+    template <typename Column, size_t Rows>
+    class cow_chunk
+    {
+        using storage_type = typename Column::storage_type;
+        using value_type   = typename Column::value_type;
+
+        static constexpr size_t buffer_size = sizeof(storage_type) * Rows;
+
+        std::atomic<size_t> refs_ = 1;
+        size_t count_             = 0; // constructed elements
+        std::byte* data_;
+
+      public:
+        cow_chunk() //
+            : data_{ allocator{}.allocate(buffer_size, std::align_val_t{ Column::alignment }) }
+        {}
+
+        cow_chunk(const cow_chunk&)            = delete;
+        cow_chunk& operator=(const cow_chunk&) = delete;
+
+        ~cow_chunk() noexcept
+        {
+            truncate(0);
+            allocator{}.deallocate(data_, buffer_size);
+        }
+
+        SOAGEN_NODISCARD
+        cow_chunk* clone(size_t count) const
+        {
+            SOAGEN_ASSERT(count <= count_);
+
+            std::unique_ptr<cow_chunk> c{ new cow_chunk };
+            for (; c->count_ < count; c->count_++)
+                Column::copy_construct(c->data_, c->count_, data_, c->count_);
+            return c.release();
+        }
+
+        void acquire() noexcept
+        {
+            refs_.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        void release() noexcept
+        {
+            if (refs_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                delete this;
+        }
+
+        // acquire pairs with release() so that readers dropping their reference happen-before the writer reuses it
+        SOAGEN_PURE_INLINE_GETTER
+        bool shared() const noexcept
+        {
+            return refs_.load(std::memory_order_acquire) != 1u;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        size_t size() const noexcept
+        {
+            return count_;
+        }
+
+        template <typename Arg>
+        void emplace_back(Arg&& arg)
+        {
+            SOAGEN_ASSERT(count_ < Rows);
+
+            Column::construct_at(data_, count_, static_cast<Arg&&>(arg));
+            count_++;
+        }
+
+        void truncate(size_t count) noexcept
+        {
+            while (count_ > count)
+                Column::destruct(data_, --count_);
+        }
+
+        SOAGEN_PURE_GETTER
+        value_type* elements() noexcept
+        {
+            if constexpr (std::is_pointer_v<storage_type>)
+                return SOAGEN_LAUNDER(reinterpret_cast<value_type*>(data_));
+            else
+                return Column::ptr(data_);
+        }
+
+        SOAGEN_PURE_GETTER
+        const value_type* elements() const noexcept
+        {
+            return const_cast<cow_chunk&>(*this).elements();
+        }
+    };
+
+    // an owning reference to a cow_chunk
+    template <typename Chunk>
+    class cow_chunk_ref
+    {
+        Chunk* ptr_ = {};
+
+      public:
+        cow_chunk_ref() noexcept = default;
+
+        explicit cow_chunk_ref(Chunk* ptr) noexcept //
+            : ptr_{ ptr }
+        {}
+
+        cow_chunk_ref(const cow_chunk_ref& other) noexcept //
+            : ptr_{ other.ptr_ }
+        {
+            if (ptr_)
+                ptr_->acquire();
+        }
+
+        cow_chunk_ref(cow_chunk_ref&& other) noexcept //
+            : ptr_{ std::exchange(other.ptr_, nullptr) }
+        {}
+
+        cow_chunk_ref& operator=(cow_chunk_ref other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+            return *this;
+        }
+
+        ~cow_chunk_ref() noexcept
+        {
+            if (ptr_)
+                ptr_->release();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        Chunk* operator->() const noexcept
+        {
+            SOAGEN_ASSUME(ptr_ != nullptr);
+            return ptr_;
+        }
+    };
+
+    template <typename Soa, size_t Rows, typename = std::make_index_sequence<table_traits_type<Soa>::column_count>>
+    struct cow_columns_;
+
+    template <typename Soa, size_t Rows, size_t... Columns>
+    struct cow_columns_<Soa, Rows, std::index_sequence<Columns...>>
+    {
+        using type = std::tuple<
+            std::vector<cow_chunk_ref<cow_chunk<typename table_traits_type<Soa>::template column<Columns>, Rows>>>...>;
+    };
+}
+/// @endcond
+
+namespace soagen
+{
+    template <typename Soa, size_t ChunkRows>
+    class cow_table;
+
+    /// @brief	An immutable view of the contents of a #soagen::cow_table at the moment it was taken.
+    ///
+    /// @details	Snapshots share column storage with the table (and each other) in fixed-size chunks, so taking one
+    ///				copies a handful of pointers rather than any rows. They may be copied, read and destroyed from
+    ///				any thread, independently of the table; later writes to the table are never visible through
+    ///				them.
+    ///
+    /// @tparam Soa			A table or generated SoA type describing the columns.
+    /// @tparam ChunkRows	The number of rows per storage chunk.
+    template <typename Soa, size_t ChunkRows = 1024>
+    class cow_snapshot
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+        static_assert(has_single_bit(ChunkRows), "ChunkRows must be a power of two.");
+
+      public:
+        /// @brief The SoA type describing the columns.
+        using soa_type = Soa;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The number of rows per storage chunk.
+        static constexpr size_type chunk_rows = ChunkRows;
+
+      private:
+        friend class cow_table<Soa, ChunkRows>;
+
+        typename detail::cow_columns_<Soa, ChunkRows>::type columns_;
+        size_type size_ = 0;
+
+      public:
+        /// @brief Default constructor. Creates an empty snapshot.
+        SOAGEN_NODISCARD_CTOR
+        cow_snapshot() = default;
+
+        /// @brief Returns the number of rows in the snapshot.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns true if the snapshot has no rows.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return !size_;
+        }
+
+        /// @brief Returns the value of a column in the given row.
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
+        {
+            SOAGEN_ASSERT(row < size_);
+
+            return std::get<static_cast<size_t>(Column)>(columns_)[row / chunk_rows]->elements()[row % chunk_rows];
+        }
+
+        /// @brief Returns the number of storage chunks spanned by the snapshot's rows.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type chunk_count() const noexcept
+        {
+            return (size_ + (chunk_rows - 1u)) / chunk_rows;
+        }
+
+        /// @brief Returns the number of the snapshot's rows stored in the given chunk.
+        SOAGEN_PURE_GETTER
+        size_type chunk_size(size_type chunk) const noexcept
+        {
+            SOAGEN_ASSERT(chunk < chunk_count());
+
+            return min(size_ - chunk * chunk_rows, chunk_rows);
+        }
+
+        /// @brief Returns a pointer to the elements of a column in the given chunk.
+        ///
+        /// @details Rows `[chunk * chunk_rows, chunk * chunk_rows + chunk_size(chunk))` are contiguous, so scans
+        ///          should iterate chunk-by-chunk rather than calling #get() for every row.
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>* chunk(size_type chunk) const noexcept
+        {
+            SOAGEN_ASSERT(chunk < chunk_count());
+
+            return std::get<static_cast<size_t>(Column)>(columns_)[chunk]->elements();
+        }
+    };
+
+    /// @brief	A table whose readers can take cheap, consistent snapshots while it is being written.
+    ///
+    /// @details	Each column is stored as a list of reference-counted chunks of #chunk_rows rows. #snapshot()
+    ///				shares the chunks rather than copying them; the first time the table writes to a chunk that is
+    ///				still referenced by a snapshot it makes a private copy of just that chunk (copy-on-write).
+    ///				Readers never block the writer and never see a partial write.
+    ///
+    /// @details	Chunks not referenced by any snapshot are modified in place, so a table nobody has snapshotted
+    ///				costs about the same to write to as a regular #soagen::table. Appending to a snapshotted table
+    ///				copies at most the partially-filled last chunk of each column once per snapshot.
+    ///
+    /// @attention	The table itself is not thread-safe: writes and calls to #snapshot() must come from one thread
+    ///				(or be externally synchronized). References returned by #get_for_write() are invalidated by
+    ///				#snapshot().
+    ///
+    /// @tparam Soa			A table or generated SoA type describing the columns.
+    /// @tparam ChunkRows	The number of rows per storage chunk.
+    template <typename Soa, size_t ChunkRows = 1024>
+    class cow_table
+    {
+      public:
+        /// @brief The SoA type describing the columns.
+        using soa_type = Soa;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The snapshot type returned by #snapshot().
+        using snapshot_type = cow_snapshot<Soa, ChunkRows>;
+
+        /// @brief The number of rows per storage chunk.
+        static constexpr size_type chunk_rows = ChunkRows;
+
+      private:
+        using traits = table_traits_type<Soa>;
+
+        template <size_t Column>
+        using chunk_type = detail::cow_chunk<typename traits::template column<Column>, ChunkRows>;
+
+        template <size_t Column>
+        using chunk_ref = detail::cow_chunk_ref<chunk_type<Column>>;
+
+        snapshot_type data_;
+
+        template <size_t Column>
+        auto& chunks() noexcept
+        {
+            return std::get<Column>(data_.columns_);
+        }
+
+        // gives the table exclusive ownership of a chunk, copying its first `count` elements if it was shared
+        template <size_t Column>
+        chunk_type<Column>& unshare(size_type chunk, size_type count)
+        {
+            auto& ref = chunks<Column>()[chunk];
+            if (ref->shared())
+                ref = chunk_ref<Column>{ ref->clone(count) };
+            return *ref.operator->();
+        }
+
+        template <size_t Column>
+        void prepare_back()
+        {
+            const auto chunk = data_.size_ / chunk_rows;
+            auto& list       = chunks<Column>();
+            if (chunk == list.size())
+                list.push_back(chunk_ref<Column>{ new chunk_type<Column> });
+            else
+                unshare<Column>(chunk, data_.size_ % chunk_rows);
+        }
+
+        template <size_t Column, typename Arg>
+        void construct_back(Arg&& arg)
+        {
+            chunks<Column>()[data_.size_ / chunk_rows]->emplace_back(static_cast<Arg&&>(arg));
+        }
+
+        template <size_t Column>
+        void destroy_back() noexcept
+        {
+            auto& c = chunks<Column>()[data_.size_ / chunk_rows];
+            c->truncate(c->size() - 1u);
+        }
+
+        template <size_t Column>
+        void truncate(size_type new_size) noexcept
+        {
+            auto& list       = chunks<Column>();
+            const auto keep  = (new_size + (chunk_rows - 1u)) / chunk_rows;
+            const auto first = list.begin() + static_cast<std::ptrdiff_t>(min(keep, list.size()));
+            list.erase(first, list.end());
+
+            if (keep && new_size % chunk_rows)
+                list.back()->truncate(new_size % chunk_rows);
+        }
+
+        template <typename Tuple, size_t... Columns>
+        void emplace_back_(Tuple&& args, std::index_sequence<Columns...>)
+        {
+            (prepare_back<Columns>(), ...);
+
+            // if a column throws, the ones constructed before it are rolled back
+            [[maybe_unused]] size_type constructed = 0;
+#if SOAGEN_HAS_EXCEPTIONS
+            try
+            {
+#endif
+                ((construct_back<Columns>(std::get<Columns>(static_cast<Tuple&&>(args))), constructed++), ...);
+#if SOAGEN_HAS_EXCEPTIONS
+            }
+            catch (...)
+            {
+                ((Columns < constructed ? destroy_back<Columns>() : void()), ...);
+                throw;
+            }
+#endif
+            data_.size_++;
+        }
+
+        template <size_t... Columns>
+        void pop_back_(size_type new_size, std::index_sequence<Columns...>)
+        {
+            // un-share the new last chunks up-front so the destructive part can't fail midway through
+            if (new_size % chunk_rows)
+                (unshare<Columns>(new_size / chunk_rows, new_size % chunk_rows), ...);
+
+            (truncate<Columns>(new_size), ...);
+            data_.size_ = new_size;
+        }
+
+        template <size_t... Columns>
+        void copy_from(const table_type<Soa>& src, std::index_sequence<Columns...>)
+        {
+            (
+                [&]() //
+                {
+                    const auto* values = src.template column<Columns>();
+                    auto& list         = chunks<Columns>();
+                    list.reserve((src.size() + (chunk_rows - 1u)) / chunk_rows);
+                    for (size_type row = 0; row < src.size(); row++)
+                    {
+                        if (row % chunk_rows == 0u)
+                            list.push_back(chunk_ref<Columns>{ new chunk_type<Columns> });
+                        list.back()->emplace_back(values[row]);
+                    }
+                }(),
+                ...);
+            data_.size_ = src.size();
+        }
+
+      public:
+        /// @brief Default constructor. Creates an empty table.
+        SOAGEN_NODISCARD_CTOR
+        cow_table() = default;
+
+        /// @brief Creates a table containing a copy of the rows of a regular table.
+        SOAGEN_NODISCARD_CTOR
+        explicit cow_table(const Soa& soa)
+        {
+            copy_from(static_cast<const table_type<Soa>&>(soa), std::make_index_sequence<traits::column_count>{});
+        }
+
+        /// @brief Returns the number of rows in the table.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return data_.size();
+        }
+
+        /// @brief Returns true if the table has no rows.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return data_.empty();
+        }
+
+        /// @brief Returns an immutable view of the table's current contents.
+        ///
+        /// @details Constant-time in the number of rows (it copies one pointer per column per chunk).
+        SOAGEN_NODISCARD
+        snapshot_type snapshot() const
+        {
+            return data_;
+        }
+
+        /// @brief Returns the value of a column in the given row.
+        template <auto Column>
+        SOAGEN_PURE_GETTER
+        const value_type<Soa, Column>& get(size_type row) const noexcept
+        {
+            return data_.template get<Column>(row);
+        }
+
+        /// @brief Returns a writable reference to the value of a column in the given row.
+        ///
+        /// @details Copies the row's chunk of that column first if a snapshot is still using it.
+        template <auto Column>
+        SOAGEN_NODISCARD
+        value_type<Soa, Column>& get_for_write(size_type row)
+        {
+            SOAGEN_ASSERT(row < size());
+
+            constexpr auto col = static_cast<size_t>(Column);
+            auto& c            = unshare<col>(row / chunk_rows, chunks<col>()[row / chunk_rows]->size());
+            return c.elements()[row % chunk_rows];
+        }
+
+        /// @brief Assigns to the value of a column in the given row.
+        template <auto Column, typename Value>
+        void set(size_type row, Value&& value)
+        {
+            get_for_write<Column>(row) = static_cast<Value&&>(value);
+        }
+
+        /// @brief Appends a row, constructing each column from the corresponding argument.
+        ///
+        /// @details Provides the strong exception guarantee.
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == traits::column_count, "an argument must be provided for each column");
+
+            emplace_back_(std::forward_as_tuple(static_cast<Args&&>(args)...),
+                          std::make_index_sequence<traits::column_count>{});
+        }
+
+        /// @brief Removes the last `num` rows.
+        void pop_back(size_type num = 1)
+        {
+            pop_back_(size() - min(num, size()), std::make_index_sequence<traits::column_count>{});
+        }
+
+        /// @brief Removes all rows.
+        void clear() noexcept
+        {
+            data_ = snapshot_type{};
+        }
+    };
+}
+
+#include "header_end.hpp"
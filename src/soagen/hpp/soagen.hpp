@@ -23,6 +23,24 @@
 #include "core.hpp"
 #include "table.hpp"
 #include "mixins/all.hpp"
+#include "selection.hpp"
+#include "prefetch.hpp"
+#include "persistence.hpp"
+#include "stream.hpp"
+#include "arrow.hpp"
+#include "aos.hpp"
+#include "hash_index.hpp"
+#include "bitmap_index.hpp"
+#include "sorted_index.hpp"
+#include "handles.hpp"
+#include "concurrent.hpp"
+#include "snapshot.hpp"
+#include "double_buffered.hpp"
+#include "column_buffer.hpp"
+#include "arena.hpp"
+#include "pool.hpp"
+#include "huge_pages.hpp"
+#include "numa.hpp"
 // IWYU pragma: end_exports
 
 // __SOAGEN_UNDEFS
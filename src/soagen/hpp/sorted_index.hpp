@@ -0,0 +1,413 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "core.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <algorithm>
+#include <functional>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief	A contiguous, read-only list of row indices.
+    ///
+    /// @details	Returned by range queries on a #soagen::sorted_index. Can be passed directly to the constructor
+    ///				of a #soagen::selection.
+    ///
+    /// @attention	Invalidated by any operation that adds or removes rows from the table the index belongs to.
+    class row_indices
+    {
+      public:
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+        /// @brief The iterator type.
+        using iterator = const size_type*;
+
+        /// @brief The const iterator type.
+        using const_iterator = const size_type*;
+
+      private:
+        const size_type* first_ = {};
+        const size_type* last_  = {};
+
+      public:
+        /// @brief Default constructor. Creates an empty list.
+        SOAGEN_NODISCARD_CTOR
+        constexpr row_indices() noexcept = default;
+
+        /// @brief Constructs a list from a pair of pointers.
+        SOAGEN_NODISCARD_CTOR
+        constexpr row_indices(const size_type* first, const size_type* last) noexcept //
+            : first_{ first },
+              last_{ last }
+        {}
+
+        /// @brief Returns the number of row indices in the list.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type size() const noexcept
+        {
+            return static_cast<size_type>(last_ - first_);
+        }
+
+        /// @brief Returns true if the list is empty.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr bool empty() const noexcept
+        {
+            return first_ == last_;
+        }
+
+        /// @brief Returns the row index at the given position in the list.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_type operator[](size_type pos) const noexcept
+        {
+            SOAGEN_CONSTEXPR_SAFE_ASSERT(pos < size());
+
+            return first_[pos];
+        }
+
+        /// @brief Returns an iterator to the first row index in the list.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator begin() const noexcept
+        {
+            return first_;
+        }
+
+        /// @brief Returns an iterator to one-past-the-last row index in the list.
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr iterator end() const noexcept
+        {
+            return last_;
+        }
+    };
+
+    /// @brief	A sorted secondary index over the values of a single column.
+    ///
+    /// @details	The index stores the table's row indices ordered by their column value, and answers `lower_bound`,
+    ///				`equal_range` and `range` queries with a branchless binary search that reads the column directly.
+    ///				Generated SoA types with a variable marked `index = 'sorted'` own one of these and keep it in sync
+    ///				for you.
+    ///
+    /// @details	Appending rows whose values are not less than the current maximum (e.g. timestamps in a time-series)
+    ///				is O(1); other insertions are O(n).
+    ///
+    /// @details	Notification functions follow the same protocol as #soagen::hash_index: those describing rows being
+    ///				removed must be called <i>before</i> the table is modified; those describing rows being added must
+    ///				be called <i>after</i>, having first called #reserve().
+    ///
+    /// @tparam Key			The column's value type.
+    /// @tparam Compare		The ordering predicate.
+    template <typename Key, typename Compare = std::less<Key>>
+    class sorted_index
+    {
+      public:
+        /// @brief The key (column value) type.
+        using key_type = Key;
+
+        /// @brief The ordering predicate type.
+        using key_compare = Compare;
+
+        /// @brief The unsigned integer size type used by this class.
+        using size_type = std::size_t;
+
+      private:
+        std::vector<size_type> rows_;
+        key_compare compare_;
+
+        // the index's ordering: by key, then by row index, so every row has exactly one place in it
+        SOAGEN_PURE_GETTER
+        bool precedes(const key_type* keys, size_type lhs, const key_type& key, size_type rhs) const noexcept
+        {
+            return compare_(keys[lhs], key) || (!compare_(key, keys[lhs]) && lhs < rhs);
+        }
+
+        // position of the given (key, row) pair in the ordering
+        SOAGEN_PURE_GETTER
+        size_type position(const key_type* keys, const key_type& key, size_type row) const noexcept
+        {
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
+
+            SOAGEN_ASSUME(keys != nullptr);
+
+            const size_type* base = rows_.data();
+            while (n > 1u)
+            {
+                const size_type half = n / 2u;
+                base                 = precedes(keys, base[half], key, row) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_type>(base - rows_.data())
+                 + static_cast<size_type>(precedes(keys, *base, key, row));
+        }
+
+        SOAGEN_PURE_GETTER
+        size_type locate(const key_type* keys, size_type row) const noexcept
+        {
+            SOAGEN_ASSUME(keys != nullptr);
+
+            const auto pos = position(keys, keys[row], row);
+            SOAGEN_ASSERT(pos < rows_.size() && rows_[pos] == row && "row was not in the index");
+            return min(pos, rows_.size() - 1u);
+        }
+
+        // position of a newly-added row
+        SOAGEN_PURE_GETTER
+        size_type placement(const key_type* keys, size_type row) const noexcept
+        {
+            if (rows_.empty() || precedes(keys, rows_.back(), keys[row], row))
+                return rows_.size();
+            return position(keys, keys[row], row);
+        }
+
+      public:
+        /// @brief Default constructor.
+        SOAGEN_NODISCARD_CTOR
+        sorted_index() = default;
+
+        /// @brief Constructs with the given ordering predicate.
+        SOAGEN_NODISCARD_CTOR
+        explicit sorted_index(const key_compare& comp) //
+            : compare_{ comp }
+        {}
+
+        /// @brief Returns the number of rows in the index.
+        SOAGEN_PURE_INLINE_GETTER
+        size_type size() const noexcept
+        {
+            return rows_.size();
+        }
+
+        /// @brief Returns true if the index is empty.
+        SOAGEN_PURE_INLINE_GETTER
+        bool empty() const noexcept
+        {
+            return rows_.empty();
+        }
+
+        /// @brief Returns the row indices in ascending order of their column value.
+        SOAGEN_PURE_INLINE_GETTER
+        row_indices rows() const noexcept
+        {
+            return { rows_.data(), rows_.data() + rows_.size() };
+        }
+
+        /// @brief Ensures the index can hold at least `rows` rows without reallocating.
+        void reserve(size_type rows)
+        {
+            rows_.reserve(rows);
+        }
+
+        /// @brief Returns the position (in sorted order) of the first row whose value is not less than `key`.
+        ///
+        /// @param keys	The column's data.
+        /// @param key	The value to search for.
+        SOAGEN_PURE_GETTER
+        size_type lower_bound(const key_type* keys, const key_type& key) const noexcept
+        {
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
+
+            SOAGEN_ASSUME(keys != nullptr);
+
+            // branchless: the loop body compiles to a conditional move, so there are no mispredictions to pay for
+            const size_type* base = rows_.data();
+            while (n > 1u)
+            {
+                const size_type half = n / 2u;
+                base                 = compare_(keys[base[half]], key) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_type>(base - rows_.data()) + static_cast<size_type>(compare_(keys[*base], key));
+        }
+
+        /// @brief Returns the position (in sorted order) of the first row whose value is greater than `key`.
+        ///
+        /// @param keys	The column's data.
+        /// @param key	The value to search for.
+        SOAGEN_PURE_GETTER
+        size_type upper_bound(const key_type* keys, const key_type& key) const noexcept
+        {
+            size_type n = rows_.size();
+            if (!n)
+                return 0u;
+
+            SOAGEN_ASSUME(keys != nullptr);
+
+            const size_type* base = rows_.data();
+            while (n > 1u)
+            {
+                const size_type half = n / 2u;
+                base                 = !compare_(key, keys[base[half]]) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_type>(base - rows_.data()) + static_cast<size_type>(!compare_(key, keys[*base]));
+        }
+
+        /// @brief Finds a row whose column value is equivalent to `key`.
+        ///
+        /// @param keys	The column's data.
+        /// @param key	The value to find.
+        ///
+        /// @returns The lowest index of the matching rows, or an empty optional.
+        SOAGEN_NODISCARD
+        optional<size_type> find(const key_type* keys, const key_type& key) const noexcept
+        {
+            const auto pos = lower_bound(keys, key);
+            if (pos < rows_.size() && !compare_(key, keys[rows_[pos]]))
+                return rows_[pos];
+            return {};
+        }
+
+        /// @brief Returns the rows whose column value is equivalent to `key`, in ascending order of row index.
+        ///
+        /// @param keys	The column's data.
+        /// @param key	The value to search for.
+        SOAGEN_NODISCARD
+        row_indices equal_range(const key_type* keys, const key_type& key) const noexcept
+        {
+            return { rows_.data() + lower_bound(keys, key), rows_.data() + upper_bound(keys, key) };
+        }
+
+        /// @brief Returns the rows whose column value lies in the half-open interval `[lo, hi)`, in ascending order.
+        ///
+        /// @param keys	The column's data.
+        /// @param lo	The (inclusive) lower bound.
+        /// @param hi	The (exclusive) upper bound.
+        SOAGEN_NODISCARD
+        row_indices range(const key_type* keys, const key_type& lo, const key_type& hi) const noexcept
+        {
+            const auto first = lower_bound(keys, lo);
+            const auto last  = max(first, lower_bound(keys, hi));
+            return { rows_.data() + first, rows_.data() + last };
+        }
+
+        /// @brief Discards the index's contents and re-indexes the first `count` rows of a column.
+        void rebuild(const key_type* keys, size_type count)
+        {
+            rows_.resize(count);
+            for (size_type row = 0; row < count; row++)
+                rows_[row] = row;
+
+            std::stable_sort(rows_.begin(),
+                             rows_.end(),
+                             [&](size_type lhs, size_type rhs) noexcept(noexcept(compare_(keys[lhs], keys[rhs])))
+                             { return compare_(keys[lhs], keys[rhs]); });
+        }
+
+        /// @brief Removes all rows from the index.
+        void clear() noexcept
+        {
+            rows_.clear();
+        }
+
+        /// @brief Notifies the index that a row was appended to the table.
+        ///
+        /// @param keys	The column's data.
+        /// @param row	The index of the new row (i.e. the table's new size, minus one).
+        void push_back(const key_type* keys, size_type row)
+        {
+            rows_.insert(rows_.begin() + static_cast<std::ptrdiff_t>(placement(keys, row)), row);
+        }
+
+        /// @brief Notifies the index that a row was inserted into the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the new row.
+        /// @param count	The table's new size.
+        void insert(const key_type* keys, size_type row, size_type count)
+        {
+            if (row + 1u < count)
+            {
+                for (auto& r : rows_)
+                    if (r >= row)
+                        r++;
+            }
+            push_back(keys, row);
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table (preserving order).
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(locate(keys, row)));
+            if (row + 1u < count)
+            {
+                for (auto& r : rows_)
+                    if (r > row)
+                        r--;
+            }
+        }
+
+        /// @brief Notifies the index that a row is about to be erased from the table using the swap-and-pop idiom.
+        ///
+        /// @param keys		The column's data.
+        /// @param row		The index of the row being erased.
+        /// @param count	The table's current size.
+        void unordered_erase(const key_type* keys, size_type row, size_type count) noexcept
+        {
+            rows_.erase(rows_.begin() + static_cast<std::ptrdiff_t>(locate(keys, row)));
+            if (row + 1u == count)
+                return;
+
+            // the last row keeps its value but takes on a lower index, so it can only move ahead of equal keys
+            const auto from = locate(keys, count - 1u);
+            const auto to   = position(keys, keys[count - 1u], row);
+            std::rotate(rows_.begin() + static_cast<std::ptrdiff_t>(to),
+                        rows_.begin() + static_cast<std::ptrdiff_t>(from),
+                        rows_.begin() + static_cast<std::ptrdiff_t>(from + 1u));
+            rows_[to] = row;
+        }
+
+        /// @brief Notifies the index that rows are about to be removed from the end of the table.
+        ///
+        /// @param keys		The column's data.
+        /// @param num		The number of rows being removed.
+        /// @param count	The table's current size.
+        void pop_back(const key_type* keys, size_type num, size_type count) noexcept
+        {
+            num = min(num, count);
+            if (num == count)
+            {
+                clear();
+                return;
+            }
+
+            // only the part of the index from the first popped row onwards needs compacting. finding it costs one
+            // binary search per row, which stops paying for itself once a sizeable fraction of the rows are going
+            const size_type new_count = count - num;
+            size_type first           = 0u;
+            if (num <= rows_.size() / 8u)
+            {
+                first = rows_.size();
+                for (size_type row = new_count; row < count; row++)
+                    first = min(first, locate(keys, row));
+            }
+
+            rows_.erase(std::remove_if(rows_.begin() + static_cast<std::ptrdiff_t>(first),
+                                       rows_.end(),
+                                       [=](size_type r) noexcept { return r >= new_count; }),
+                        rows_.end());
+        }
+
+        /// @brief Swaps the contents of the index with another.
+        void swap(sorted_index& other) noexcept
+        {
+            using std::swap;
+            rows_.swap(other.rows_);
+            swap(compare_, other.compare_);
+        }
+    };
+}
+
+#include "header_end.hpp"
@@ -179,6 +179,40 @@ namespace soagen
             return static_cast<soa_ref>(*base::soa).template column<Column>() + base::start;
         }
 
+        /// @brief Assigns a value to every element of a column viewed by the span (or some range of them).
+        ///
+        /// @param value	The value to assign.
+        /// @param first	The first row to assign, relative to the start of the span.
+        /// @param count	The number of rows to assign. Clamped to the end of the span.
+        ///
+        /// @see soagen::table::fill()
+        template <auto Column, typename Value>
+        SOAGEN_CONSTEXPR_20
+        void fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) const
+        {
+            SOAGEN_ASSUME(first <= size());
+
+            static_cast<soa_ref>(*base::soa).template fill<Column>(value, //
+                                                                   base::start + first,
+                                                                   min(count, size() - first));
+        }
+
+        /// @brief Assigns the elements of a range to a column viewed by the span, starting at the given row.
+        ///
+        /// @param values	The range of values to assign. Must not run past the end of the span.
+        /// @param first	The first row to assign, relative to the start of the span.
+        ///
+        /// @see soagen::table::assign_column()
+        template <auto Column, typename Range>
+        SOAGEN_CONSTEXPR_20
+        void assign_column(const Range& values, size_type first = 0) const
+        {
+            SOAGEN_ASSUME(first <= size());
+            SOAGEN_ASSERT(static_cast<size_type>(std::size(values)) <= size() - first);
+
+            static_cast<soa_ref>(*base::soa).template assign_column<Column>(values, base::start + first);
+        }
+
 #if SOAGEN_DOXYGEN
         /// @brief Invokes a function once for each column data pointer (const overload).
         ///
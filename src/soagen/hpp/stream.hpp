@@ -0,0 +1,501 @@
+//# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+//# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+//# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+//# SPDX-License-Identifier: MIT
+#pragma once
+
+#include "table.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+SOAGEN_ENABLE_WARNINGS;
+#include "header_start.hpp"
+
+namespace soagen
+{
+    /// @brief The version of the stream format written by #soagen::serialize().
+    inline constexpr std::uint32_t stream_format_version = 1;
+
+    /// @brief The header at the start of a stream written by #soagen::serialize().
+    ///
+    /// @details The header is followed by one block per column, in column order, each written by the
+    ///          #soagen::column_codec for that column's `storage_type`.
+    struct stream_header
+    {
+        /// @brief Always `"soagen\x1B\0"`.
+        unsigned char magic[8];
+
+        /// @brief The format version (#soagen::stream_format_version).
+        std::uint32_t version;
+
+        /// @brief `0x01020304` as written by the host; used to reject streams written with a different byte order.
+        std::uint32_t byte_order;
+
+        /// @brief The #soagen::schema_hash of the SoA type that wrote the stream.
+        std::uint64_t schema_hash;
+
+        /// @brief The number of columns.
+        std::uint64_t column_count;
+
+        /// @brief The number of rows.
+        std::uint64_t row_count;
+    };
+    static_assert(sizeof(stream_header) == 40);
+
+    /// @cond
+    namespace detail
+    {
+        inline constexpr unsigned char stream_magic[8] = { 's', 'o', 'a', 'g', 'e', 'n', 0x1B, 0 };
+
+        template <typename Sink>
+        SOAGEN_NODISCARD
+        bool stream_write(Sink& sink, const void* data, size_t size)
+        {
+            if (!size)
+                return true;
+
+            if constexpr (std::is_void_v<decltype(sink(data, size))>)
+            {
+                sink(data, size);
+                return true;
+            }
+            else
+                return static_cast<bool>(sink(data, size));
+        }
+
+        template <typename Source>
+        SOAGEN_NODISCARD
+        bool stream_read(Source& source, void* data, size_t size)
+        {
+            if (!size)
+                return true;
+
+            if constexpr (std::is_void_v<decltype(source(data, size))>)
+            {
+                source(data, size);
+                return true;
+            }
+            else
+                return static_cast<bool>(source(data, size));
+        }
+
+        // destroys the first N elements of a partially-read column block if the read doesn't complete
+        template <typename T>
+        struct stream_construct_guard
+        {
+            T* values;
+            size_t count;
+
+            ~stream_construct_guard() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                        values[i].~T();
+                }
+            }
+        };
+    }
+    /// @endcond
+
+    /// @brief		Describes how the elements of a column are written to and read from a stream by
+    ///				#soagen::serialize() and #soagen::deserialize().
+    ///
+    /// @details	Specializations must provide two static member functions: @cpp
+    ///
+    /// // writes count values to sink; returns false if the sink fails
+    /// template <typename Sink>
+    /// static bool write(Sink& sink, const T* values, std::size_t count);
+    ///
+    /// // constructs count values into uninitialized memory at dest; returns false if the source fails,
+    /// // in which case no values may be left constructed
+    /// template <typename Source>
+    /// static bool read(Source& source, T* dest, std::size_t count);
+    ///
+    /// @ecpp
+    ///
+    ///				Specializations are provided for trivially-copyable types (written as one raw run),
+    ///				`std::basic_string` (a block of lengths followed by the characters) and `std::tuple`/`std::pair`
+    ///				(each member written as a block using its own codec). Specialize this for any other column types you
+    ///				wish to serialize.
+    template <typename T, typename = void>
+    struct column_codec;
+
+    /// @cond
+
+    template <typename T>
+    struct column_codec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    {
+        template <typename Sink>
+        SOAGEN_NODISCARD
+        static bool write(Sink& sink, const T* values, size_t count)
+        {
+            return detail::stream_write(sink, values, sizeof(T) * count);
+        }
+
+        template <typename Source>
+        SOAGEN_NODISCARD
+        static bool read(Source& source, T* dest, size_t count)
+        {
+            return detail::stream_read(source, dest, sizeof(T) * count);
+        }
+    };
+
+    template <typename Char, typename Traits, typename Allocator>
+    struct column_codec<std::basic_string<Char, Traits, Allocator>>
+    {
+        using string_type = std::basic_string<Char, Traits, Allocator>;
+
+        template <typename Sink>
+        SOAGEN_NODISCARD
+        static bool write(Sink& sink, const string_type* values, size_t count)
+        {
+            // lengths first, in batches, so the reader can size everything up-front
+            std::uint64_t lengths[256];
+            for (size_t i = 0; i < count;)
+            {
+                const auto batch = min(count - i, sizeof(lengths) / sizeof(lengths[0]));
+                for (size_t j = 0; j < batch; j++)
+                    lengths[j] = static_cast<std::uint64_t>(values[i + j].size());
+                if (!detail::stream_write(sink, lengths, sizeof(std::uint64_t) * batch))
+                    return false;
+                i += batch;
+            }
+
+            for (size_t i = 0; i < count; i++)
+                if (!detail::stream_write(sink, values[i].data(), sizeof(Char) * values[i].size()))
+                    return false;
+
+            return true;
+        }
+
+        template <typename Source>
+        SOAGEN_NODISCARD
+        static bool read(Source& source, string_type* dest, size_t count)
+        {
+            std::vector<std::uint64_t> lengths(count);
+            if (!detail::stream_read(source, lengths.data(), sizeof(std::uint64_t) * count))
+                return false;
+
+            detail::stream_construct_guard<string_type> guard{ dest, 0u };
+            for (size_t i = 0; i < count; i++)
+            {
+                auto& str = *::new (static_cast<void*>(dest + i)) string_type(static_cast<size_t>(lengths[i]), Char{});
+                guard.count++;
+                if (!detail::stream_read(source, str.data(), sizeof(Char) * str.size()))
+                    return false;
+            }
+
+            guard.count = 0u;
+            return true;
+        }
+    };
+
+    namespace detail
+    {
+        // uninitialized storage for a block of values on their way to or from a column_codec
+        template <typename T>
+        struct stream_block
+        {
+            T* values;
+            size_t count = {};
+            size_t capacity;
+
+            explicit stream_block(size_t cap) //
+                : values{ std::allocator<T>{}.allocate(cap) },
+                  capacity{ cap }
+            {}
+
+            stream_block(const stream_block&)            = delete;
+            stream_block& operator=(const stream_block&) = delete;
+
+            ~stream_block() noexcept
+            {
+                clear();
+                std::allocator<T>{}.deallocate(values, capacity);
+            }
+
+            void clear() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                        values[i].~T();
+                }
+                count = 0u;
+            }
+
+            template <typename Arg>
+            void push_back(Arg&& arg)
+            {
+                SOAGEN_ASSUME(count < capacity);
+
+                ::new (static_cast<void*>(values + count)) T(static_cast<Arg&&>(arg));
+                count++;
+            }
+
+            template <typename Source>
+            SOAGEN_NODISCARD
+            bool read(Source& source, size_t num)
+            {
+                SOAGEN_ASSUME(!count);
+                SOAGEN_ASSUME(num <= capacity);
+
+                if (!column_codec<T>::read(source, values, num))
+                    return false;
+                count = num;
+                return true;
+            }
+        };
+
+        // each member is written as a contiguous block using its own codec (so e.g. trivially-copyable members take a
+        // single write per block), in batches of rows to bound the temporary memory
+        template <typename Tuple, typename = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+        struct tuple_column_codec;
+
+        template <typename Tuple, size_t... Members>
+        struct tuple_column_codec<Tuple, std::index_sequence<Members...>>
+        {
+            static constexpr size_t batch_rows = 1024;
+
+            template <size_t Member>
+            using member_type = std::tuple_element_t<Member, Tuple>;
+
+            template <size_t Member, typename Sink>
+            SOAGEN_NODISCARD
+            static bool write_member(Sink& sink,
+                                     stream_block<member_type<Member>>& block,
+                                     const Tuple* values,
+                                     size_t count)
+            {
+                for (size_t i = 0; i < count; i++)
+                    block.push_back(std::get<Member>(values[i]));
+
+                const bool ok = column_codec<member_type<Member>>::write(sink, block.values, count);
+                block.clear();
+                return ok;
+            }
+
+            template <typename Sink>
+            SOAGEN_NODISCARD
+            static bool write(Sink& sink, const Tuple* values, size_t count)
+            {
+                if (!count)
+                    return true;
+
+                std::tuple<stream_block<member_type<Members>>...> blocks{ (static_cast<void>(Members),
+                                                                           min(count, batch_rows))... };
+                for (size_t start = 0; start < count; start += batch_rows)
+                {
+                    const auto batch = min(count - start, batch_rows);
+                    if (!(write_member<Members>(sink, std::get<Members>(blocks), values + start, batch) && ...))
+                        return false;
+                }
+                return true;
+            }
+
+            template <typename Source>
+            SOAGEN_NODISCARD
+            static bool read(Source& source, Tuple* dest, size_t count)
+            {
+                if (!count)
+                    return true;
+
+                std::tuple<stream_block<member_type<Members>>...> blocks{ (static_cast<void>(Members),
+                                                                           min(count, batch_rows))... };
+                stream_construct_guard<Tuple> guard{ dest, 0u };
+                for (size_t start = 0; start < count; start += batch_rows)
+                {
+                    const auto batch = min(count - start, batch_rows);
+                    if (!(std::get<Members>(blocks).read(source, batch) && ...))
+                        return false;
+
+                    for (size_t i = 0; i < batch; i++)
+                    {
+                        ::new (static_cast<void*>(dest + start + i))
+                            Tuple{ static_cast<member_type<Members>&&>(std::get<Members>(blocks).values[i])... };
+                        guard.count++;
+                    }
+                    (std::get<Members>(blocks).clear(), ...);
+                }
+
+                guard.count = 0u;
+                return true;
+            }
+        };
+    }
+
+    template <typename... T>
+    struct column_codec<std::tuple<T...>, std::enable_if_t<!std::is_trivially_copyable_v<std::tuple<T...>>>>
+        : detail::tuple_column_codec<std::tuple<T...>>
+    {};
+
+    template <typename A, typename B>
+    struct column_codec<std::pair<A, B>, std::enable_if_t<!std::is_trivially_copyable_v<std::pair<A, B>>>>
+        : detail::tuple_column_codec<std::pair<A, B>>
+    {};
+
+    /// @endcond
+
+    /// @cond
+    namespace detail
+    {
+        template <typename Soa, typename Sink, size_t... Columns>
+        SOAGEN_NODISCARD
+        bool serialize_columns(const Soa& soa, Sink& sink, std::index_sequence<Columns...>)
+        {
+            using table  = table_type<Soa>;
+            using traits = table_traits_type<Soa>;
+
+            const auto& alloc = table_storage_access::allocation(static_cast<const table&>(soa));
+            const auto count  = static_cast<size_t>(soa.size());
+
+            return (column_codec<typename traits::template storage_type<Columns>>::write(
+                        sink,
+                        traits::template column<Columns>::ptr(static_cast<const std::byte*>(alloc.columns[Columns])),
+                        count)
+                    && ...);
+        }
+
+        template <typename Soa, typename Source, size_t... Columns>
+        SOAGEN_NODISCARD
+        bool deserialize_columns(Soa& soa, Source& source, size_t count, std::index_sequence<Columns...>)
+        {
+            using table  = table_type<Soa>;
+            using traits = table_traits_type<Soa>;
+
+            auto& tbl = static_cast<table&>(soa);
+            tbl.reserve(count);
+            const auto& alloc = table_storage_access::allocation(tbl);
+
+            // destroys the fully-read columns if a later one fails
+            struct columns_guard
+            {
+                const table_allocation<traits::column_count>& alloc;
+                size_t count;
+                size_t columns = 0;
+
+                ~columns_guard() noexcept
+                {
+                    size_t col = 0;
+                    const auto destruct = [&](auto ic) noexcept
+                    {
+                        if (col++ < columns)
+                            for (size_t i = 0; i < count; i++)
+                                traits::template column<decltype(ic)::value>::destruct(alloc.columns[decltype(ic)::value],
+                                                                                      i);
+                    };
+                    (destruct(index_constant<Columns>{}), ...);
+                }
+            } guard{ alloc, count };
+
+            const auto read_column = [&](auto ic)
+            {
+                constexpr size_t column = decltype(ic)::value;
+                if (!column_codec<typename traits::template storage_type<column>>::read(
+                        source,
+                        traits::template column<column>::ptr(alloc.columns[column]),
+                        count))
+                    return false;
+                guard.columns++;
+                return true;
+            };
+            if (!(read_column(index_constant<Columns>{}) && ...))
+                return false;
+
+            guard.columns = 0;
+            table_storage_access::set_size(tbl, count);
+            return true;
+        }
+    }
+    /// @endcond
+
+    /// @brief Writes the rows of an SoA container to a sink, one column at a time.
+    ///
+    /// @details Unlike #soagen::save(), this works for any column types with a #soagen::column_codec (e.g. strings and
+    ///          tuples), and never requires the whole table to be addressable as one buffer; each column is written as
+    ///          one contiguous block (e.g. one raw run for arithmetic columns) so I/O stays sequential: @cpp
+    ///
+    /// std::ofstream file{ "employees.bin", std::ios::binary };
+    /// soagen::serialize(staff,
+    ///                   [&](const void* data, std::size_t size)
+    ///                   { return !!file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)); });
+    ///
+    /// @ecpp
+    ///
+    /// @param soa	The table, or soagen-generated SoA type, to write.
+    /// @param sink	A callable invoked as `sink(const void* data, std::size_t size)`. It may return `bool`
+    ///				(with `false` aborting serialization) or `void`.
+    ///
+    /// @returns True if all rows were written successfully.
+    template <typename Soa, typename Sink>
+    SOAGEN_NODISCARD
+    bool serialize(const Soa& soa, Sink&& sink)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
+        using traits = table_traits_type<Soa>;
+
+        stream_header header{};
+        std::memcpy(header.magic, detail::stream_magic, sizeof(detail::stream_magic));
+        header.version      = stream_format_version;
+        header.byte_order   = 0x01020304u;
+        header.schema_hash  = schema_hash<Soa>;
+        header.column_count = traits::column_count;
+        header.row_count    = static_cast<std::uint64_t>(soa.size());
+
+        if (!detail::stream_write(sink, &header, sizeof(header)))
+            return false;
+
+        if (!header.row_count)
+            return true;
+
+        return detail::serialize_columns(soa, sink, std::make_index_sequence<traits::column_count>{});
+    }
+
+    /// @brief Reads rows written by #soagen::serialize() into an SoA container, replacing its contents.
+    ///
+    /// @details Storage is reserved once up-front and each column is then constructed in-place, one column at a time.
+    ///          The indexes and handles of soagen-generated types are rebuilt once all rows have been read.
+    ///
+    /// @param soa		The table, or soagen-generated SoA type, to read into.
+    /// @param source	A callable invoked as `source(void* data, std::size_t size)` to read exactly `size` bytes.
+    ///					It may return `bool` (with `false` aborting deserialization) or `void`.
+    ///
+    /// @returns True if all rows were read successfully. Returns false (leaving `soa` empty) if the source failed,
+    ///          or the data was written by a different SoA type (according to #soagen::schema_hash).
+    template <typename Soa, typename Source>
+    SOAGEN_NODISCARD
+    bool deserialize(Soa& soa, Source&& source)
+    {
+        static_assert(is_soa<Soa>, "Soa must be a table or soagen-generated SoA type.");
+
+        using traits = table_traits_type<Soa>;
+
+        soa.clear();
+
+        stream_header header;
+        if (!detail::stream_read(source, &header, sizeof(header))
+            || std::memcmp(header.magic, detail::stream_magic, sizeof(detail::stream_magic)) != 0
+            || header.version != stream_format_version || header.byte_order != 0x01020304u
+            || header.schema_hash != schema_hash<Soa> || header.column_count != traits::column_count)
+            return false;
+
+        if (!header.row_count)
+            return true;
+
+        if (!detail::deserialize_columns(soa,
+                                         source,
+                                         static_cast<size_t>(header.row_count),
+                                         std::make_index_sequence<traits::column_count>{}))
+            return false;
+
+        detail::rebuild_row_observers(soa);
+        return true;
+    }
+}
+
+#include "header_end.hpp"
@@ -7,6 +7,7 @@
 #include "allocator.hpp"
 #include "column_traits.hpp"
 #include "compressed_pair.hpp"
+#include "instrument.hpp"
 #include "iterator.hpp"
 #include "row.hpp"
 #include "span.hpp"
@@ -51,6 +52,24 @@ namespace soagen::detail
     struct table_allocation : table_allocation_base
     {
         std::byte* columns[ColumnCount];
+
+        // per-column sizes in bytes of the separate allocations holding columns that were exchanged with another
+        // table (see soagen::exchange_column()), zero for columns still in the main buffer. allocated by the first
+        // exchange, so tables that never exchange columns only pay for the null pointer.
+        size_t* separate;
+
+        // the main buffer plus any separately-held columns
+        SOAGEN_PURE_GETTER
+        constexpr size_t total_size() const noexcept
+        {
+            size_t total = size;
+            if (separate)
+            {
+                for (size_t i = 0; i < ColumnCount; i++)
+                    total += separate[i];
+            }
+            return total;
+        }
     };
 
     //------------------------------------------------------------------------------------------------------------------
@@ -107,6 +126,23 @@ namespace soagen::detail
                                                         reinterpret_cast<allocator_pointer_type>(al.ptr),
                                                         al.size);
         }
+
+        template <size_t ColumnCount>
+        constexpr void deallocate(allocator_type& alloc, const table_allocation<ColumnCount>& al) noexcept
+        {
+            if SOAGEN_UNLIKELY(al.separate)
+            {
+                for (size_t i = 0; i < ColumnCount; i++)
+                    if (al.separate[i])
+                        deallocate(alloc, table_allocation_base{ al.columns[i], al.separate[i] });
+
+                deallocate(alloc,
+                           table_allocation_base{ reinterpret_cast<std::byte*>(al.separate),
+                                                  sizeof(size_t) * ColumnCount });
+            }
+
+            deallocate(alloc, static_cast<const table_allocation_base&>(al));
+        }
     };
 
     //------------------------------------------------------------------------------------------------------------------
@@ -118,6 +154,8 @@ namespace soagen::detail
 #undef SOAGEN_BASE_TYPE
 #define SOAGEN_BASE_TYPE SOAGEN_BASE_NAME<Allocator>
 
+    struct table_storage_access;
+
     template <size_t ColumnCount, typename Allocator>
     class SOAGEN_EMPTY_BASES table_storage //
         : public SOAGEN_BASE_TYPE
@@ -127,6 +165,8 @@ namespace soagen::detail
       private:
         using base = SOAGEN_BASE_TYPE;
 
+        friend struct table_storage_access;
+
       public:
         using SOAGEN_BASE_TYPE::SOAGEN_BASE_NAME;
         using size_type       = size_t;
@@ -228,6 +268,139 @@ namespace soagen::detail
         }
     };
 
+    //------------------------------------------------------------------------------------------------------------------
+    // raw storage access for non-member machinery that needs to alias external memory (e.g. soagen::mapped)
+    //------------------------------------------------------------------------------------------------------------------
+
+    struct table_storage_access
+    {
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr const table_allocation<ColumnCount>& allocation(
+            const table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.alloc_;
+        }
+
+        // points an empty table at externally-owned memory; the table must be released before it is destroyed
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void adopt(table_storage<ColumnCount, Allocator>& tbl,
+                                    const table_allocation<ColumnCount>& alloc,
+                                    size_t count,
+                                    size_t capacity) noexcept
+        {
+            SOAGEN_ASSUME(!tbl.alloc_);
+            SOAGEN_ASSUME(count <= capacity);
+
+            tbl.alloc_            = alloc;
+            tbl.count_            = count;
+            tbl.capacity_.first() = capacity;
+        }
+
+        // sets the row count directly; the caller is responsible for the elements in [0, count) having been written
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void set_size(table_storage<ColumnCount, Allocator>& tbl, size_t count) noexcept
+        {
+            SOAGEN_ASSUME(count <= tbl.capacity_.first());
+
+            tbl.count_ = count;
+        }
+
+        // mutable access to the column pointers, for machinery that re-homes individual columns
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr table_allocation<ColumnCount>& allocation(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.alloc_;
+        }
+
+        template <size_t ColumnCount, typename Allocator>
+        SOAGEN_PURE_INLINE_GETTER
+        static constexpr Allocator& allocator(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            return tbl.allocator();
+        }
+
+        // detaches a table from its storage without destroying elements or deallocating
+        template <size_t ColumnCount, typename Allocator>
+        static constexpr void release(table_storage<ColumnCount, Allocator>& tbl) noexcept
+        {
+            tbl.alloc_            = {};
+            tbl.count_            = {};
+            tbl.capacity_.first() = {};
+        }
+    };
+
+#if SOAGEN_INSTRUMENT
+
+    template <typename Table>
+    size_t table_allocation_bytes(const Table& tbl) noexcept
+    {
+        return table_storage_access::allocation(tbl).total_size();
+    }
+
+#endif
+
+    //------------------------------------------------------------------------------------------------------------------
+    // generated types with indexes or handles keep them in sync from their own members; machinery that writes rows
+    // through table_storage_access bypasses them, so has to rebuild them afterwards (or reject such types)
+    //------------------------------------------------------------------------------------------------------------------
+
+    template <typename T>
+    using has_rebuild_indexes_ = decltype(std::declval<T&>().rebuild_indexes());
+
+    template <typename T>
+    using has_rebuild_handles_ = decltype(std::declval<T&>().rebuild_handles());
+
+    template <typename Soa>
+    inline constexpr bool has_row_observers =
+        is_detected<has_rebuild_indexes_, Soa>::value || is_detected<has_rebuild_handles_, Soa>::value;
+
+    // brings the indexes and handles back in line with rows written directly into the table;
+    // if that fails the container is cleared, so it's never left holding rows its observers don't know about
+    template <typename Soa>
+    void rebuild_row_observers(Soa& soa)
+    {
+        if constexpr (has_row_observers<Soa>)
+        {
+            SOAGEN_TRY
+            {
+                if constexpr (is_detected<has_rebuild_handles_, Soa>::value)
+                    soa.rebuild_handles();
+                if constexpr (is_detected<has_rebuild_indexes_, Soa>::value)
+                    soa.rebuild_indexes();
+            }
+#if SOAGEN_HAS_EXCEPTIONS
+            catch (...)
+            {
+                soa.clear();
+                throw;
+            }
+#endif
+        }
+    }
+
+    // as above, for machinery that only rewrites column values in place; rows keep their positions, so handles don't
+    // need reissuing
+    template <typename Soa>
+    void rebuild_value_indexes(Soa& soa)
+    {
+        if constexpr (is_detected<has_rebuild_indexes_, Soa>::value)
+        {
+            SOAGEN_TRY
+            {
+                soa.rebuild_indexes();
+            }
+#if SOAGEN_HAS_EXCEPTIONS
+            catch (...)
+            {
+                soa.clear();
+                throw;
+            }
+#endif
+        }
+    }
+
     //------------------------------------------------------------------------------------------------------------------
     // specialization: default-constructibility
     //------------------------------------------------------------------------------------------------------------------
@@ -433,7 +606,11 @@ namespace soagen::detail
 
     template <typename Traits, typename Allocator>
     class SOAGEN_EMPTY_BASES table_typed_base //
-        : public SOAGEN_BASE_TYPE
+        :
+#if SOAGEN_INSTRUMENT
+          public table_registration<table<Traits, Allocator>>, // first, see table_registration
+#endif
+          public SOAGEN_BASE_TYPE
     {
       private:
         using table_type  = table<Traits, Allocator>;
@@ -441,21 +618,31 @@ namespace soagen::detail
         using column_ends = size_t[Traits::column_count];
         using base        = SOAGEN_BASE_TYPE;
 
+        // ends are in storage order (Traits::storage_order), not column order
         static constexpr void calc_column_ends(column_ends& ends, size_t capacity) noexcept
         {
             // pad ends so the next column starts at the right alignment for the storage type
             size_t prev = {};
             for (size_t i = 0; i < Traits::column_count - 1u; i++)
             {
-                const auto align = max(Traits::column_alignments[i + 1u], min_actual_column_alignment);
+                const auto next = Traits::storage_order[i + 1u];
+                auto align      = max(Traits::column_alignments[next], min_actual_column_alignment);
 
-                ends[i] = prev + Traits::column_sizes[i] * capacity;
+                // large columns start on the allocator's column_alignment boundary (e.g. a page), if it has one
+                if constexpr (allocator_traits<Allocator>::column_alignment > 0u)
+                {
+                    if (Traits::column_sizes[next] * capacity >= allocator_traits<Allocator>::column_alignment)
+                        align = max(align, allocator_traits<Allocator>::column_alignment);
+                }
+
+                ends[i] = prev + Traits::column_sizes[Traits::storage_order[i]] * capacity;
                 ends[i] = (ends[i] + align - 1u) & ~(align - 1u);
                 prev    = ends[i];
             }
 
             // last end doesn't need to be aligned (it's just the total buffer size)
-            ends[Traits::column_count - 1u] = prev + Traits::column_sizes[Traits::column_count - 1u] * capacity;
+            ends[Traits::column_count - 1u] =
+                prev + Traits::column_sizes[Traits::storage_order[Traits::column_count - 1u]] * capacity;
         }
 
         SOAGEN_NODISCARD
@@ -470,9 +657,11 @@ namespace soagen::detail
             SOAGEN_ASSUME(alloc.ptr);
             SOAGEN_ASSUME(alloc.size == ends[Traits::column_count - 1u]);
 
-            alloc.columns[0] = soagen::assume_aligned<buffer_alignment<table_type>>(alloc.ptr);
+            // columns are laid out in storage order (see table_traits::storage_order)
+            const auto first                        = soagen::assume_aligned<buffer_alignment<table_type>>(alloc.ptr);
+            alloc.columns[Traits::storage_order[0]] = first;
             for (size_t i = 1; i < Traits::column_count; i++)
-                alloc.columns[i] = alloc.columns[0] + ends[i - 1u];
+                alloc.columns[Traits::storage_order[i]] = first + ends[i - 1u];
 
             return alloc;
         }
@@ -492,6 +681,12 @@ namespace soagen::detail
             if SOAGEN_UNLIKELY(new_capacity == base::capacity())
                 return;
 
+#if SOAGEN_INSTRUMENT
+            const detail::table_event_timer timer;
+            const auto old_capacity = base::capacity();
+            const auto old_bytes    = base::alloc_ ? base::alloc_.total_size() : size_t{};
+#endif
+
             // get new ends
             column_ends new_ends{};
             calc_column_ends(new_ends, new_capacity);
@@ -509,7 +704,12 @@ namespace soagen::detail
                 // when an exception is raised), so we're moving or copying the elements according to the 'most nothrow'
                 // path that still fulfills the brief.
 
-                if constexpr (Traits::all_nothrow_move_or_copy_constructible)
+                if constexpr (Traits::all_trivially_copyable)
+                {
+                    // the old and new buffers never overlap, and most of what's copied won't be touched again soon
+                    Traits::memcpy(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
+                }
+                else if constexpr (Traits::all_nothrow_move_or_copy_constructible)
                 {
                     Traits::move_or_copy_construct_rows(new_alloc.columns, {}, base::alloc_.columns, {}, base::count_);
                 }
@@ -583,11 +783,24 @@ namespace soagen::detail
                 {
                     Traits::destruct_rows(base::alloc_.columns, {}, base::count_);
                 }
-
-                base::deallocate(base::allocator(), base::alloc_);
             }
+            if (base::alloc_)
+                base::deallocate(base::allocator(), base::alloc_);
             base::alloc_            = new_alloc;
             base::capacity_.first() = new_capacity;
+
+#if SOAGEN_INSTRUMENT
+            detail::raise_table_event<table_type, Traits>(!old_capacity                ? table_event::allocate
+                                                          : new_capacity > old_capacity ? table_event::reallocate
+                                                                                        : table_event::shrink,
+                                                          this,
+                                                          old_capacity,
+                                                          new_capacity,
+                                                          old_bytes,
+                                                          new_alloc.size,
+                                                          base::count_,
+                                                          timer.elapsed());
+#endif
         }
 
       public:
@@ -595,9 +808,31 @@ namespace soagen::detail
 
         SOAGEN_DEFAULT_RULE_OF_FIVE(table_typed_base);
 
+#if SOAGEN_INSTRUMENT
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = has_swap_member<base>::value)
+        void swap(table_typed_base& other) noexcept
+        {
+            if SOAGEN_LIKELY(&other != this)
+                this->raise_swap_with(other);
+            base::swap(other);
+        }
+#endif
+
         ~table_typed_base() noexcept
         {
             clear();
+
+#if SOAGEN_INSTRUMENT
+            if (base::alloc_)
+                detail::raise_table_event<table_type, Traits>(table_event::deallocate,
+                                                              this,
+                                                              base::capacity(),
+                                                              0u,
+                                                              base::alloc_.total_size(),
+                                                              0u,
+                                                              0u,
+                                                              0u);
+#endif
         }
 
         SOAGEN_RESETTER
@@ -646,9 +881,24 @@ namespace soagen::detail
             {
                 if (base::alloc_)
                 {
+#if SOAGEN_INSTRUMENT
+                    const detail::table_event_timer timer;
+                    const auto old_capacity = base::capacity();
+                    const auto old_bytes    = base::alloc_.total_size();
+#endif
                     base::deallocate(base::allocator(), base::alloc_);
                     base::alloc_            = {};
                     base::capacity_.first() = {};
+#if SOAGEN_INSTRUMENT
+                    detail::raise_table_event<table_type, Traits>(table_event::deallocate,
+                                                                  this,
+                                                                  old_capacity,
+                                                                  0u,
+                                                                  old_bytes,
+                                                                  0u,
+                                                                  0u,
+                                                                  timer.elapsed());
+#endif
                 }
                 return;
             }
@@ -697,9 +947,10 @@ namespace soagen::detail
                     size_t buf_end = {};
                     for (size_t i = 0u; i < Traits::column_count; i++)
                     {
+                        const auto col = Traits::storage_order[i];
                         if (i)
                         {
-                            const auto align = max(Traits::column_alignments[i], min_actual_column_alignment);
+                            const auto align = max(Traits::column_alignments[col], min_actual_column_alignment);
 
                             if (const size_t rem = buf_end % align; rem > 0u)
                             {
@@ -707,7 +958,7 @@ namespace soagen::detail
                                     return false;
                             }
                         }
-                        if (!add_without_overflowing(buf_end, Traits::column_sizes[i] * cap, buf_end))
+                        if (!add_without_overflowing(buf_end, Traits::column_sizes[col] * cap, buf_end))
                             return false;
                     }
                     return true;
@@ -745,7 +996,7 @@ namespace soagen::detail
             return max_capacity;
         }
 
-      private:
+      protected:
         SOAGEN_CONSTEXPR_20
         SOAGEN_NEVER_INLINE
         void grow_if_necessary(size_t new_elements)
@@ -785,6 +1036,24 @@ namespace soagen::detail
             base::count_++;
         }
 
+        SOAGEN_CONSTRAINED_TEMPLATE(Traits::template rows_fillable_from<Values...>, typename... Values)
+        SOAGEN_CONSTEXPR_20
+        void resize(size_t num, const Values&... values) noexcept( //
+            Traits::template rows_nothrow_fillable_from<Values...> //
+            && noexcept(this->reserve(size_t{})))
+        {
+            if (base::count_ > num)
+            {
+                pop_back(base::count_ - num);
+            }
+            else if (base::count_ < num)
+            {
+                reserve(num);
+                Traits::fill_construct_rows(base::alloc_.columns, base::count_, num - base::count_, values...);
+                base::count_ = num;
+            }
+        }
+
         SOAGEN_CONSTRAINED_TEMPLATE((Traits::all_move_or_copy_constructible //
                                      && Traits::all_move_or_copy_assignable //
                                      && Traits::template row_constructible_from<Args&&...>),
@@ -878,9 +1147,10 @@ namespace soagen::detail
                 if constexpr (actual_alignment<table_type, static_cast<size_t>(A)>
                               == actual_alignment<table_type, static_cast<size_t>(B)>)
                 {
-                    const auto temp                              = base::alloc_.columns[static_cast<size_t>(A)];
-                    base::alloc_.columns[static_cast<size_t>(A)] = base::alloc_.columns[static_cast<size_t>(B)];
-                    base::alloc_.columns[static_cast<size_t>(B)] = temp;
+                    std::swap(base::alloc_.columns[static_cast<size_t>(A)], base::alloc_.columns[static_cast<size_t>(B)]);
+                    if (base::alloc_.separate)
+                        std::swap(base::alloc_.separate[static_cast<size_t>(A)],
+                                  base::alloc_.separate[static_cast<size_t>(B)]);
                 }
                 else
                 {
@@ -915,6 +1185,8 @@ namespace soagen::detail
 
         SOAGEN_DEFAULT_RULE_OF_FIVE(table_default_constructible_columns);
 
+        using base::resize;
+
         SOAGEN_CONSTEXPR_20
         void resize(size_t num) noexcept(             //
             Traits::all_nothrow_default_constructible //
@@ -928,10 +1200,18 @@ namespace soagen::detail
             else if (base::size() < num)
             {
                 base::reserve(num);
-                for (size_t i = base::size(); i < num; i++)
+                if constexpr (Traits::all_nothrow_default_constructible)
+                {
+                    Traits::default_construct_rows(base::alloc_.columns, base::size(), num - base::size());
+                    base::count_ = num;
+                }
+                else
                 {
-                    Traits::default_construct_row(base::alloc_.columns, i);
-                    base::count_++;
+                    for (size_t i = base::size(); i < num; i++)
+                    {
+                        Traits::default_construct_row(base::alloc_.columns, i);
+                        base::count_++;
+                    }
                 }
             }
         }
@@ -953,6 +1233,21 @@ namespace soagen::detail
                 base::count_ = num;
             }
         }
+
+        SOAGEN_CONSTEXPR_20
+        soagen::span_type<table<Traits, Allocator>> append_uninitialized(size_t num) //
+            noexcept(Traits::all_nothrow_default_constructible && noexcept(this->grow_if_necessary(size_t{})))
+        {
+            if (!num)
+                return {};
+
+            const auto start = base::size();
+            base::grow_if_necessary(num);
+            Traits::value_construct_rows_for_overwrite(base::alloc_.columns, start, num);
+            base::count_ += num;
+
+            return { static_cast<table<Traits, Allocator>&>(*this), start, num };
+        }
     };
 
     template <typename Traits, typename Allocator>
@@ -1010,6 +1305,10 @@ namespace soagen::detail
             static_assert(!allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
             static_assert(!allocator_traits<Allocator>::is_always_equal::value);
 
+#if SOAGEN_INSTRUMENT
+            if (allocator_traits<Allocator>::equal(base::allocator(), rhs.allocator()))
+                this->raise_move_from(rhs);
+#endif
             if (base::move_from_by_taking_ownership(rhs, std::true_type{}))
                 return *this;
 
@@ -1235,11 +1534,26 @@ namespace soagen::detail
             SOAGEN_ASSUME(pos < base::count_);
 
             if (pos + 1u < base::count_)
+            {
+#if SOAGEN_INSTRUMENT
+                const detail::table_event_timer timer;
+#endif
                 Traits::move_or_copy_assign_rows(base::alloc_.columns,
                                                  pos,
                                                  base::alloc_.columns,
                                                  pos + 1u,
                                                  base::count_ - pos - 1u);
+#if SOAGEN_INSTRUMENT
+                detail::raise_table_event<table<Traits, Allocator>, Traits>(table_event::erase_shift,
+                                                                            this,
+                                                                            base::capacity(),
+                                                                            base::capacity(),
+                                                                            base::alloc_.total_size(),
+                                                                            base::alloc_.total_size(),
+                                                                            base::count_ - pos - 1u,
+                                                                            timer.elapsed());
+#endif
+            }
 
             base::pop_back();
         }
@@ -1628,6 +1942,67 @@ namespace soagen
             return const_cast<table&>(*this).template column<static_cast<size_type>(Column)>();
         }
 
+        /// @brief Assigns a value to every element of a column (or some range of them).
+        ///
+        /// @details Trivially-copyable columns are filled with a single `memset()` when every byte of the value is
+        ///          the same (e.g. zeroing), and with a loop the compiler can vectorize otherwise.
+        ///
+        /// @param value	The value to assign. It may be one of the column's own elements.
+        /// @param first	The first row to assign.
+        /// @param count	The number of rows to assign. Clamped to the end of the table.
+        template <auto Column, typename Value>
+        SOAGEN_CONSTEXPR_20
+        void fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(column_traits<Column>::template is_nothrow_fillable_from<const Value&>)
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+            static_assert(column_traits<Column>::template is_fillable_from<const Value&>,
+                          "column must be assignable from the value");
+            SOAGEN_ASSUME(first <= base::size());
+
+            count = min(count, base::size() - first);
+            if (count)
+                column_traits<Column>::fill(base::alloc_.columns[static_cast<size_type>(Column)], first, count, value);
+        }
+
+        /// @brief Assigns the elements of a range to a column, starting at the given row.
+        ///
+        /// @details Contiguous ranges of a trivially-copyable column's own type (anything with `data()` and `size()`,
+        ///          e.g. a `std::vector`) are copied with a single `memmove()`.
+        ///
+        /// @param values	The range of values to assign. Must not run past the end of the table.
+        /// @param first	The first row to assign.
+        template <auto Column, typename Range>
+        SOAGEN_CONSTEXPR_20
+        void assign_column(const Range& values, size_type first = 0)
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+            SOAGEN_ASSUME(first <= base::size());
+
+            using value_type = std::remove_cv_t<column_type<Column>>;
+            auto dest        = column<Column>() + first;
+
+            if constexpr (std::is_trivially_copyable_v<value_type>
+                          && detail::is_contiguous_range_of<const Range, value_type>::value)
+            {
+                const auto count = static_cast<size_type>(values.size());
+                SOAGEN_ASSERT(count <= base::size() - first);
+
+                if (count)
+                    std::memmove(dest, values.data(), count * sizeof(value_type));
+            }
+            else
+            {
+                [[maybe_unused]]
+                const auto end = column<Column>() + base::size();
+                for (const auto& value : values)
+                {
+                    SOAGEN_ASSERT(dest < end);
+                    *dest++ = value;
+                }
+            }
+        }
+
         /// @}
 
 #if !SOAGEN_DOXYGEN
@@ -1655,6 +2030,7 @@ namespace soagen
         /// @warning This value is `capacity() * (sizeof() for every column) + (alignment padding)`.
         ///          It is **not** based on `size()`! If you are using the value returned by this function
         ///          in conjunction with `data()` to do serialization, hashing, etc, use `shrink_to_fit()` first.
+        ///          Columns moved out of the main buffer by #soagen::exchange_column() are not included.
         constexpr size_t allocation_size() const noexcept;
 
         /// @brief Reserves storage for (at least) the given number of rows.
@@ -1709,6 +2085,34 @@ namespace soagen
         /// @availability This method is only available when all the column types are default-constructible.
         void resize_for_overwrite(size_type new_size) noexcept(...);
 
+        /// @brief Resizes the table to the given number of rows, copy-constructing any new rows from the given values.
+        ///
+        /// @details New rows are constructed a column at a time, so trivially-copyable columns are filled in bulk
+        ///          (see #fill()).
+        ///
+        /// @param new_size	The new number of rows.
+        /// @param values	One value per column.
+        template <typename... Values>
+        void resize(size_type new_size, const Values&... values) noexcept(...);
+
+        /// @brief Appends rows to be written directly in place, returning a span of them.
+        ///
+        /// @details Elements of trivially-default-constructible columns are left uninitialized, so decoders can write
+        ///          straight into the column memory (e.g. with `read()` or a SIMD parser) without a second copy.
+        ///          Elements of every other column are value-initialized. Capacity grows the same as for
+        ///          #emplace_back(), so repeated appends are amortized.
+        ///
+        /// @cpp
+        /// auto rows = table.append_uninitialized(count);
+        /// read(fd, rows.template column<0>(), count * sizeof(float));
+        /// @ecpp
+        ///
+        /// @returns A span of the new rows (empty if `num` is zero). The span refers to rows by index, so it survives
+        ///          the table growing; column pointers taken from it do not.
+        ///
+        /// @availability This method is only available when all the column types are default-constructible.
+        span_type append_uninitialized(size_type num) noexcept(...);
+
         /// @brief Swaps the contents of the table with another.
         ///
         /// @availability This method is only available when #allocator_type is swappable or non-propagating.
@@ -1773,11 +2177,15 @@ namespace soagen
 
         /// @brief Returns a pointer to the raw byte backing array.
         ///
+        /// @note Columns moved out of the main buffer by #soagen::exchange_column() are not part of it.
+        ///
         /// @availability This method is only available when all the column types are trivially-copyable.
         constexpr std::byte* data() noexcept;
 
         /// @brief Returns a const pointer to the raw byte backing array.
         ///
+        /// @note Columns moved out of the main buffer by #soagen::exchange_column() are not part of it.
+        ///
         /// @availability This method is only available when all the column types are trivially-copyable.
         constexpr const std::byte* data() const noexcept;
 
@@ -235,6 +235,19 @@ namespace soagen::detail
             (column<I>::memmove(dest[I], dest_start, source[I], source_start, count), ...);
         }
 
+        //--- memcpy ---------------------------------------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_trivially_copyable)
+        static void memcpy(column_pointers& dest,
+                           size_t dest_start,
+                           const_column_pointers& source,
+                           size_t source_start,
+                           size_t count) //
+            noexcept
+        {
+            (column<I>::memcpy(dest[I], dest_start, source[I], source_start, count), ...);
+        }
+
         //--- destruction ----------------------------------------------------------------------------------------------
 
         static constexpr void destruct_row(column_pointers& columns,
@@ -358,7 +371,13 @@ namespace soagen::detail
                                            [[maybe_unused]] size_t count) //
             noexcept(all_nothrow_destructible)
         {
-            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
+            if constexpr (all_nothrow_default_constructible)
+            {
+                // column-at-a-time so each column can use its bulk path
+                if (count)
+                    (column<I>::default_construct(columns[I], start, count), ...);
+            }
+            else if constexpr (all_trivially_destructible)
             {
                 for (size_t i = start, e = start + count; i < e; i++)
                     default_construct_row(columns, i);
@@ -428,6 +447,53 @@ namespace soagen::detail
             }
         }
 
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_default_constructible)
+        SOAGEN_CONSTEXPR_20
+        static void value_construct_rows_for_overwrite([[maybe_unused]] column_pointers& columns,
+                                                       [[maybe_unused]] size_t start,
+                                                       [[maybe_unused]] size_t count) //
+            noexcept(all_nothrow_default_constructible)
+        {
+            if (!count)
+                return;
+
+            if constexpr (all_nothrow_default_constructible || all_trivially_destructible)
+            {
+                (column<I>::value_construct_for_overwrite(columns[I], start, count), ...);
+            }
+            else
+            {
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic) //
+                {
+                    column_from_ic<decltype(ic)>::value_construct_for_overwrite(columns[decltype(ic)::value],
+                                                                                start,
+                                                                                count);
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    const auto destructor = [&](auto ic) //
+                    {
+                        if (decltype(ic)::value < constructed_columns)
+                            for (size_t i = start, e = start + count; i < e; i++)
+                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
+                    };
+                    (destructor(index_constant<I>{}), ...);
+                    throw;
+                }
+#endif
+            }
+        }
+
         //--- construction ---------------------------------------------------------------------------------------------
 
       private:
@@ -503,6 +569,83 @@ namespace soagen::detail
             }
         }
 
+        //--- fill-construction ----------------------------------------------------------------------------------------
+
+      private:
+        template <bool, typename... Args>
+        struct rows_fillable_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct rows_fillable_from_<true, Args...>
+            : std::conjunction<typename Columns::template is_constructible_trait<const Args&>...>
+        {};
+
+        template <bool, typename... Args>
+        struct rows_nothrow_fillable_from_ : std::false_type
+        {};
+        template <typename... Args>
+        struct rows_nothrow_fillable_from_<true, Args...>
+            : std::conjunction<typename Columns::template is_nothrow_constructible_trait<const Args&>...>
+        {};
+
+      public:
+        // one value per column (no tuple unpacking, unlike row_constructible_from)
+        template <typename... Args>
+        static constexpr bool rows_fillable_from = rows_fillable_from_<sizeof...(Args) == column_count, Args...>::value;
+
+        template <typename... Args>
+        static constexpr bool rows_nothrow_fillable_from =
+            rows_nothrow_fillable_from_<sizeof...(Args) == column_count, Args...>::value;
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, typename... Args, auto sfinae = rows_fillable_from<Args...>)
+        SOAGEN_CONSTEXPR_20
+        static void fill_construct_rows(column_pointers& columns,
+                                        size_t start,
+                                        size_t count,
+                                        const Args&... values) //
+            noexcept(rows_nothrow_fillable_from<Args...>)
+        {
+            if (!count)
+                return;
+
+            // column-at-a-time so each column can use its bulk path
+            if constexpr (rows_nothrow_fillable_from<Args...> || all_trivially_destructible)
+            {
+                (column<I>::fill_construct(columns[I], start, count, values), ...);
+            }
+            else
+            {
+                // machinery to provide strong-exception guarantee
+
+                [[maybe_unused]]
+                size_t constructed_columns = {};
+
+                const auto constructor = [&](auto ic, const auto& value) //
+                {
+                    column_from_ic<decltype(ic)>::fill_construct(columns[decltype(ic)::value], start, count, value);
+                    constructed_columns++;
+                };
+
+                SOAGEN_TRY
+                {
+                    (constructor(index_constant<I>{}, values), ...);
+                }
+#if SOAGEN_HAS_EXCEPTIONS
+                catch (...)
+                {
+                    const auto destructor = [&](auto ic) //
+                    {
+                        if (decltype(ic)::value < constructed_columns)
+                            for (size_t i = start, e = start + count; i < e; i++)
+                                column_from_ic<decltype(ic)>::destruct(columns[decltype(ic)::value], i);
+                    };
+                    (destructor(index_constant<I>{}), ...);
+                    throw;
+                }
+#endif
+            }
+        }
+
         //--- move-construction ----------------------------------------------------------------------------------------
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = all_move_constructible)
@@ -1100,6 +1243,42 @@ namespace soagen::detail
 
         //
     };
+
+    // the order columns are laid out in a table's buffer; values[n] is the index of the n-th column in memory
+    template <size_t N>
+    struct column_storage_order
+    {
+        size_t values[N];
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr size_t operator[](size_t position) const noexcept
+        {
+            return values[position];
+        }
+    };
+
+    template <size_t N>
+    SOAGEN_CONST_GETTER
+    constexpr column_storage_order<N> make_column_storage_order(const size_t (&alignments)[N], bool reorder) noexcept
+    {
+        column_storage_order<N> order{};
+        for (size_t i = 0; i < N; i++)
+            order.values[i] = i;
+
+        // stable insertion sort, most-aligned first (ties keep their declared order)
+        if (reorder)
+        {
+            for (size_t i = 1; i < N; i++)
+            {
+                const auto col = order.values[i];
+                size_t j       = i;
+                for (; j > 0u && alignments[order.values[j - 1u]] < alignments[col]; j--)
+                    order.values[j] = order.values[j - 1u];
+                order.values[j] = col;
+            }
+        }
+        return order;
+    }
 }
 /// @endcond
 
@@ -1146,6 +1325,13 @@ namespace soagen
         /// @brief The max `alignment` of all columns in the table.
         static constexpr size_t largest_alignment = max(size_t{ 1 }, detail::as_column<Columns>::alignment...);
 
+        /// @brief	The order the columns are laid out in a table's buffer.
+        ///
+        /// @details	`storage_order[n]` is the index of the column stored n-th in memory. For plain
+        ///				#soagen::table_traits this is the declared order; see #soagen::reordered_table_traits.
+        static constexpr detail::column_storage_order<column_count> storage_order =
+            POXY_IMPLEMENTATION_DETAIL(detail::make_column_storage_order(column_alignments, false));
+
         /// @brief True if the arguments passed to the rvalue overloads of `push_back()`
         /// and `insert()` would be distinct from the regular const lvalue overload.
         static constexpr bool rvalues_are_distinct =
@@ -1204,6 +1390,23 @@ namespace soagen
         static constexpr bool row_insert_is_nothrow = emplace_is_nothrow<BackingTable, Row>;
     };
 
+    /// @brief	Traits for a table that lays its columns out most-aligned first.
+    ///
+    /// @details	Identical to #soagen::table_traits except for #storage_order: the columns are stored in the
+    ///				buffer sorted by descending `alignment` (ties keep their declared order), which minimizes the
+    ///				padding needed between them. Column indices, and everything else that is expressed in terms
+    ///				of them, are unaffected; only the physical placement of each column changes.
+    ///
+    /// @see	The `reorder_storage` struct option.
+    template <typename... Columns>
+    struct SOAGEN_EMPTY_BASES reordered_table_traits //
+        : public table_traits<Columns...>
+    {
+        /// @brief	The order the columns are laid out in a table's buffer (most-aligned first).
+        static constexpr detail::column_storage_order<sizeof...(Columns)> storage_order = POXY_IMPLEMENTATION_DETAIL(
+            detail::make_column_storage_order(table_traits<Columns...>::column_alignments, true));
+    };
+
     /// @cond
     namespace detail
     {
@@ -1214,6 +1417,9 @@ namespace soagen
         struct is_table_traits_<table_traits<Columns...>> : std::true_type
         {};
         template <typename... Columns>
+        struct is_table_traits_<reordered_table_traits<Columns...>> : std::true_type
+        {};
+        template <typename... Columns>
         struct is_table_traits_<detail::table_traits_base<Columns...>> : std::true_type
         {};
     }
@@ -1234,6 +1440,10 @@ namespace soagen::detail
 
         static_assert(std::is_base_of_v<type, table_traits<Columns...>>);
     };
+
+    template <typename... Columns>
+    struct to_base_traits_<reordered_table_traits<Columns...>> : to_base_traits_<table_traits<Columns...>>
+    {};
 }
 /// @endcond
 
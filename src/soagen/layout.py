@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+# This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+# Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+# See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+# SPDX-License-Identifier: MIT
+
+"""
+Column layout/padding analysis for --layout-report. Mirrors the buffer layout computed by soagen::table
+(calc_column_ends() and table_traits::aligned_stride) for the common 64-bit ABIs, using a table of known type sizes;
+columns of other types are reported but can't be measured.
+"""
+
+import itertools
+import math
+import re
+from io import StringIO
+
+# sizeof/alignof on LP64 targets (x86-64 and aarch64 linux/macOS, and the parts of LLP64 windows that matter here)
+KNOWN_TYPES = {
+    r'bool': (1, 1),
+    r'char': (1, 1),
+    r'signed char': (1, 1),
+    r'unsigned char': (1, 1),
+    r'char8_t': (1, 1),
+    r'std::byte': (1, 1),
+    r'short': (2, 2),
+    r'unsigned short': (2, 2),
+    r'char16_t': (2, 2),
+    r'int': (4, 4),
+    r'unsigned': (4, 4),
+    r'unsigned int': (4, 4),
+    r'float': (4, 4),
+    r'char32_t': (4, 4),
+    r'long': (8, 8),
+    r'unsigned long': (8, 8),
+    r'long long': (8, 8),
+    r'unsigned long long': (8, 8),
+    r'double': (8, 8),
+    r'std::size_t': (8, 8),
+    r'size_t': (8, 8),
+    r'std::ptrdiff_t': (8, 8),
+    r'ptrdiff_t': (8, 8),
+    r'std::intptr_t': (8, 8),
+    r'std::uintptr_t': (8, 8),
+}
+for bits in (8, 16, 32, 64):
+    for prefix in (r'', r'std::'):
+        for sign in (r'', r'u'):
+            KNOWN_TYPES[rf'{prefix}{sign}int{bits}_t'] = (bits // 8, bits // 8)
+
+# max(__STDCPP_DEFAULT_NEW_ALIGNMENT__, alignof(std::max_align_t), 16) - see detail::min_actual_column_alignment
+MIN_COLUMN_ALIGNMENT = 16
+
+# capacities to show padding for
+REPRESENTATIVE_CAPACITIES = (1, 16, 256, 4096, 65536)
+
+# orderings are searched exhaustively up to this many columns, and by sorting on alignment beyond it
+MAX_PERMUTED_COLUMNS = 8
+
+
+def type_size_and_alignment(type: str):
+    """Returns (sizeof, alignof) for a type on a typical 64-bit target, or None if the generator can't know."""
+    type = re.sub(r'\s+', ' ', type.strip())
+    type = re.sub(r'^(?:const |volatile )+|(?: const| volatile)+$', '', type)
+    if type.endswith('*'):
+        return (8, 8)
+    return KNOWN_TYPES.get(type, None)
+
+
+class ColumnShape(object):
+    def __init__(self, name: str, type: str, alignment: int):
+        self.name = name
+        self.type = type
+        known = type_size_and_alignment(type)
+        self.size = known[0] if known else None
+        # column_traits::alignment = max(requested alignment, alignof(value_type))
+        self.alignment = max(alignment, known[1]) if known else (alignment if alignment > 0 else None)
+
+
+def aligned_stride(columns) -> int:
+    """table_traits::aligned_stride: the capacity quantum that keeps every column's over-alignment intact."""
+    stride = 1
+    for col in columns:
+        col_stride = math.lcm(col.alignment, col.size) // col.size
+        stride = math.lcm(stride, col_stride)
+    return stride
+
+
+def round_capacity(capacity: int, stride: int) -> int:
+    return ((capacity + stride - 1) // stride) * stride
+
+
+def buffer_layout(columns, capacity: int):
+    """Returns (buffer bytes, padding bytes) for the columns in the given order, as calc_column_ends() lays them out."""
+    end = 0
+    padding = 0
+    for i, col in enumerate(columns):
+        if i:
+            align = max(col.alignment, MIN_COLUMN_ALIGNMENT)
+            aligned = (end + align - 1) & ~(align - 1)
+            padding += aligned - end
+            end = aligned
+        end += col.size * capacity
+    return (end, padding)
+
+
+def total_padding(columns, capacities) -> int:
+    return sum([buffer_layout(columns, cap)[1] for cap in capacities])
+
+
+def reordered_storage(columns):
+    """The physical column order used by soagen::reordered_table_traits (reorder_storage = true)."""
+    return sorted(columns, key=lambda c: -c.alignment)  # stable, so ties keep their declared order
+
+
+def best_order(columns, capacities):
+    """Returns the column order with the least padding over the given capacities (ties keep the original order)."""
+    if len(columns) <= MAX_PERMUTED_COLUMNS:
+        best = list(columns)
+        best_padding = total_padding(best, capacities)
+        for perm in itertools.permutations(columns):
+            padding = total_padding(perm, capacities)
+            if padding < best_padding:
+                best = list(perm)
+                best_padding = padding
+        return best
+
+    # most-aligned first, then largest first, so each column tends to end on the next one's boundary
+    return sorted(columns, key=lambda c: (-c.alignment, -c.size))
+
+
+def layout_report(struct) -> str:
+    columns = [ColumnShape(col.name, col.type, col.alignment) for col in struct.columns]
+    with StringIO() as buf:
+        buf.write(rf'{struct.qualified_type}:' + '\n')
+
+        name_width = max([len(c.name) for c in columns] + [len('column')])
+        type_width = max([len(c.type) for c in columns] + [len('type')])
+        buf.write(rf'    {"column":<{name_width}}  {"type":<{type_width}}  size  align' + '\n')
+        for col in columns:
+            size = str(col.size) if col.size is not None else '?'
+            align = str(col.alignment) if col.alignment is not None else '?'
+            buf.write(rf'    {col.name:<{name_width}}  {col.type:<{type_width}}  {size:>4}  {align:>5}' + '\n')
+
+        unknown = [c.name for c in columns if c.size is None]
+        if unknown:
+            buf.write(
+                rf'    sizes of {", ".join(unknown)} are not known to the generator; padding figures are unavailable'
+                + '\n'
+            )
+            return buf.getvalue()
+
+        if getattr(struct, r'reorder_storage', False):
+            columns = reordered_storage(columns)
+            buf.write(rf'    storage order (reorder_storage): {", ".join([c.name for c in columns])}' + '\n')
+
+        stride = aligned_stride(columns)
+        buf.write(rf'    bytes per row: {sum([c.size for c in columns])}' + '\n')
+        buf.write(rf'    aligned_stride: {stride} (capacities are rounded up to a multiple of this)' + '\n')
+
+        capacities = [round_capacity(cap, stride) for cap in REPRESENTATIVE_CAPACITIES]
+        buf.write(r'    capacity   buffer bytes   padding bytes' + '\n')
+        for requested, cap in zip(REPRESENTATIVE_CAPACITIES, capacities):
+            total, padding = buffer_layout(columns, cap)
+            cap_str = str(cap) if cap == requested else rf'{requested} -> {cap}'
+            buf.write(rf'    {cap_str:<10} {total:>12}   {padding:>13} ({100.0 * padding / total:.1f}%)' + '\n')
+
+        # with reorder_storage the declared order no longer decides the layout, so there's nothing to suggest
+        if getattr(struct, r'reorder_storage', False):
+            return buf.getvalue()
+
+        best = best_order(columns, capacities)
+        current = total_padding(columns, capacities)
+        suggested = total_padding(best, capacities)
+        if suggested < current:
+            buf.write(
+                rf'    suggested column order: {", ".join([c.name for c in best])} '
+                + rf'(saves {(current - suggested) // len(capacities)} bytes of padding per table on average)'
+                + '\n'
+            )
+            reordered = total_padding(reordered_storage(columns), capacities)
+            if reordered < current:
+                buf.write(
+                    rf'    or set reorder_storage = true to keep the declared order '
+                    + rf'(saves {(current - reordered) // len(capacities)} bytes of padding per table on average)'
+                    + '\n'
+                )
+        else:
+            buf.write(r'    column order is already optimal' + '\n')
+
+        return buf.getvalue()
+
+
+__all__ = [
+    r'type_size_and_alignment',
+    r'aligned_stride',
+    r'buffer_layout',
+    r'reordered_storage',
+    r'best_order',
+    r'layout_report',
+]
@@ -14,7 +14,7 @@ import zipfile
 from io import StringIO
 from pathlib import Path
 
-from . import cpp, log, paths, preprocessor, utils
+from . import cpp, layout, log, paths, preprocessor, utils
 from .config import Config
 from .errors import Error
 from .preprocessor import Preprocessor
@@ -268,6 +268,12 @@ def main_impl():
         default=True,
         help=f'generate {log.STYLE_CYAN}.natvis{log.STYLE_RESET} files for Visual Studio (default: %(default)s)',
     )
+    args.add_argument(
+        r'--layout-report',  #
+        action=argparse.BooleanOptionalAction,
+        default=False,
+        help=f'print each struct\'s column sizes, padding and suggested column order (default: %(default)s)',
+    )
     args.add_argument(
         r'--bug-report', action=r'store_true', help=r"capture all inputs and outputs in a bug-report zip file"
     )  #
@@ -439,6 +445,10 @@ def main_impl():
                 if args.bug_report_internal:
                     utils.copy_file(src.path, paths.BUG_REPORT_OUTPUTS, logger=log.i)
 
+            if args.layout_report:
+                for struct in config.structs:
+                    log.i(layout.layout_report(struct).rstrip())
+
             if args.natvis:
                 natvis = config.natvis
                 with Writer(natvis.path, meta=config.meta_stack, clang_format=False, doxygen=False) as o:
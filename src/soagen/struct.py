@@ -26,6 +26,8 @@ TAB_SPACES = '    '
 class Struct(Configurable):
     allocator: str
     annotations: list[str]
+    aos: bool
+    handles: bool
     attributes: list[str]
     brief: str
     copyable: bool
@@ -38,6 +40,7 @@ class Struct(Configurable):
     mixins: list[str]
     movable: bool
     prologue: str
+    reorder_storage: bool
     reverse_iterators: bool
     static_variables: dict[str, list[StaticVariable]]
     swappable: bool
@@ -49,6 +52,7 @@ class Struct(Configurable):
     index: int
     columns: list[Column]
     column_indices: str
+    schema_hash: int
     meta: MetaVars
 
     __schema = Schema(
@@ -58,6 +62,8 @@ class Struct(Configurable):
                 ValueOrArray(str, name=r'annotations'),
                 Use(lambda x: utils.remove_duplicates([s.strip() for s in x if s.strip()])),
             ),
+            Optional(r'aos', default=False): bool,
+            Optional(r'handles', default=False): bool,
             Optional(r'attributes', default=lambda: []): And(
                 ValueOrArray(str, name=r'attributes'),
                 Use(lambda x: utils.remove_duplicates([s.strip() for s in x if s.strip()])),
@@ -76,6 +82,7 @@ class Struct(Configurable):
             ),
             Optional(r'movable', default=True): bool,
             Optional(r'prologue', default=''): Stripped(str),
+            Optional(r'reorder_storage', default=False): bool,
             Optional(r'reverse_iterators', default=False): bool,
             Optional(r'static_variables', default=lambda: []): [object],
             Optional(r'swappable', default=True): bool,
@@ -192,6 +199,12 @@ class Struct(Configurable):
             index += 1
         self.column_indices = ", ".join([str(col.index) for col in self.columns])
 
+        # FNV-1a of the struct name + column names, types and alignments (used to reject incompatible persisted data)
+        self.schema_hash = 0xCBF29CE484222325
+        schema = self.qualified_name + ''.join([rf';{col.name}:{col.type}:{col.alignment}' for col in self.columns])
+        for b in schema.encode('utf-8'):
+            self.schema_hash = ((self.schema_hash ^ b) * 0x00000100000001B3) & 0xFFFFFFFFFFFFFFFF
+
         self.prologue = rf'''
         {self.config.all_structs.prologue}
 
@@ -274,7 +287,11 @@ class Struct(Configurable):
                     max_length = max(len(col.name), max_length)
                 left_padding = max(0, 32 - (max_length + 6)) * ' '
                 with StringIO() as buf:
-                    buf.write('soagen::table_traits<\n')
+                    # reorder_storage only changes the physical column order; indices stay in declared order
+                    if self.reorder_storage:
+                        buf.write('soagen::reordered_table_traits<\n')
+                    else:
+                        buf.write('soagen::table_traits<\n')
                     for i in range(len(self.columns)):
                         if i:
                             buf.write(f',\n')
@@ -319,9 +336,434 @@ class Struct(Configurable):
             {{
                 using type = table<table_traits_type<{self.qualified_name}>, allocator_type<{self.qualified_name}>>;
             }};
+
+            template <>
+            struct schema_hash_<{self.qualified_name}>
+                : std::integral_constant<std::uint64_t, 0x{self.schema_hash:016X}ull>
+            {{}};
+            '''
+            )
+
+    def write_index_modifiers(
+        self, o: Writer, doxygen, indexed: list[Column], observers: list[str], index_calls, observer_calls
+    ):
+        # members that would otherwise be inherited from the mixins and bypass the indexes (and handle table)
+        push_back_all = index_calls(r'push_back', r'i')
+        o(
+            rf'''
+        {doxygen(r"@brief Removes the last row(s) from the table.")}
+        {self.name}& pop_back(size_type num = 1) noexcept
+        {{
+            if (table_.empty())
+                return *this;
+
+            {index_calls(r'pop_back', r'num', r'table_.size()')}
+            table_.pop_back(num);
+            return *this;
+        }}
+
+        {doxygen("@brief Removes all rows from table.")}
+        SOAGEN_RESETTER
+        {self.name}& clear() noexcept
+        {{
+            table_.clear();
+            {observer_calls(r'clear')}
+            return *this;
+        }}
+
+        {
+            doxygen(r"""
+        @brief Resizes the table to the given number of rows.
+
+        @availability This method is only available when all the column types are default-constructible.""")
+        }
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        SOAGEN_ENABLE_IF_T({self.name}&, sfinae) resize(size_type new_size)
+        {{
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            {observer_calls(r'reserve', r'new_size')}
+            table_.resize(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {{
+                {push_back_all}
+            }}
+            return *this;
+        }}
+
+        {
+            doxygen(r"""
+        @brief Resizes the table to the given number of rows, copy-constructing any new rows from the given values.
+
+        @details New rows are constructed a column at a time, so trivially-copyable columns are filled in bulk.
+
+        @param new_size	The new number of rows.
+        @param values	One value per column.""")
+        }
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::template rows_fillable_from<Values...>, typename... Values)
+        {self.name}& resize(size_type new_size, const Values&... values)
+        {{
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            {observer_calls(r'reserve', r'new_size')}
+            table_.resize(new_size, values...);
+            for (size_type i = old_size; i < new_size; i++)
+            {{
+                {push_back_all}
+            }}
+            return *this;
+        }}
+
+        '''
+        )
+
+        if indexed:
+            o(
+                rf'''
+            {doxygen(r"@brief Not available on tables with indexes; the new rows' keys would be indeterminate.")}
+            {self.name}& resize_for_overwrite(size_type) = delete;
+
+            {doxygen(r"@brief Not available on tables with indexes; the new rows' keys would be indeterminate.")}
+            span_type append_uninitialized(size_type) = delete;
+            '''
+            )
+        else:
+            o(
+                rf'''
+            {
+                doxygen(r"""
+            @brief Resizes the table to the given number of rows, without initializing new trivially-constructible elements.
+
+            @availability This method is only available when all the column types are default-constructible.""")
+            }
+            SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+            SOAGEN_ENABLE_IF_T({self.name}&, sfinae) resize_for_overwrite(size_type new_size)
+            {{
+                const size_type old_size = table_.size();
+                if (new_size < old_size)
+                    return pop_back(old_size - new_size);
+
+                {observer_calls(r'reserve', r'new_size')}
+                table_.resize_for_overwrite(new_size);
+                for (size_type i = old_size; i < new_size; i++)
+                {{
+                    {push_back_all}
+                }}
+                return *this;
+            }}
+
+            {
+                doxygen(r"""
+            @brief Appends `count` rows and returns a span over them, ready to be written directly into column memory.
+
+            @availability This method is only available when all the column types are default-constructible.""")
+            }
+            SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+            SOAGEN_ENABLE_IF_T(span_type, sfinae) append_uninitialized(size_type count)
+            {{
+                if (!count)
+                    return {{}};
+
+                const size_type old_size = table_.size();
+                {observer_calls(r'reserve', r'old_size + count')}
+                table_.append_uninitialized(count);
+                for (size_type i = old_size; i < old_size + count; i++)
+                {{
+                    {push_back_all}
+                }}
+                return {{ *this, old_size, count }};
+            }}
             '''
             )
 
+        if self.swappable:
+            o(
+                rf'''
+            {
+                doxygen(r"""
+            @brief Swaps the contents of the table with another.
+
+            @availability This method is only available when #allocator_type is swappable or non-propagating.""")
+            }
+            SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_swap_member<table_type>::value)
+            SOAGEN_ENABLE_IF_T(void, sfinae) swap({self.name}& other) //
+                noexcept(soagen::detail::has_nothrow_swap_member<table_type>::value)
+            {{
+                table_.swap(other.table_);
+                {' '.join([rf'{obs}.swap(other.{obs});' for obs in observers])}
+            }}
+            '''
+            )
+
+    def write_index_lookups(self, o: Writer, doxygen, indexed: list[Column]):
+        with DoxygenMemberGroup(o, 'Indexes'):
+            with Public(o):
+                o(
+                    rf'''
+                {
+                    doxygen(r"""
+                @brief Rebuilds the table's indexes from scratch.
+
+                @details Indexes are kept up-to-date automatically by every member function that adds or removes rows.
+                         Call this if you modify an indexed column's values in-place (e.g. via a row or column pointer),
+                         or modify the underlying table directly.""")
+                }
+                void rebuild_indexes()
+                {{
+                    if (table_.empty())
+                    {{
+                        {' '.join([rf'{col.name}_index_.clear();' for col in indexed])}
+                        return;
+                    }}
+
+                    {' '.join([rf'{col.name}_index_.rebuild(table_.template column<{col.index}>(), table_.size());' for col in indexed])}
+                }}
+                '''
+                )
+
+                def dispatch(call: str, cols: list[Column], what: str) -> str:
+                    branches = []
+                    for col in cols:
+                        branches.append(
+                            rf'''if constexpr (static_cast<size_type>(Column) == {col.index})
+                                return {col.name}_index_.{call.format(rf'table_.template column<{col.index}>()')};'''
+                        )
+                    branches.append(rf'''static_assert(sizeof(column_type<Column>) == 0, "column does not have {what}");''')
+                    return f"{NEWLINE}else ".join(branches)
+
+                o(
+                    rf'''
+                {
+                    doxygen(r"""
+                @brief Finds a row by the value of an indexed column.
+
+                @returns The index of a row whose column value is equal to `key`, or an empty optional.
+                         If several rows have the same value, any one of them may be returned.""")
+                }
+                template <auto Column>
+                SOAGEN_NODISCARD
+                soagen::optional<size_type> find(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+                {{
+                    if (table_.empty())
+                        return {{}};
+
+                    {dispatch('find({}, key)', indexed, 'an index')}
+                }}
+                '''
+                )
+                if len(indexed) == 1:
+                    o(
+                        rf'''
+                    {
+                        doxygen(rf"""
+                    @brief Finds a row by its `{indexed[0].name}`.
+
+                    @returns The index of a row whose `{indexed[0].name}` is equal to `key`, or an empty optional.
+                             If several rows have the same value, any one of them may be returned.""")
+                    }
+                    SOAGEN_NODISCARD
+                    soagen::optional<size_type> find(const std::remove_cv_t<column_type<{indexed[0].index}>>& key) const noexcept
+                    {{
+                        return find<{indexed[0].index}>(key);
+                    }}
+                    '''
+                    )
+
+                sorted_ = [col for col in indexed if col.index_type == r'sorted']
+                if sorted_:
+                    o(
+                        rf'''
+                    {
+                        doxygen(r"""
+                    @brief Returns the rows whose value in a column with a sorted index is equal to `key`.
+
+                    @returns A list of row indices, in the order the rows were added.""")
+                    }
+                    template <auto Column>
+                    SOAGEN_NODISCARD
+                    soagen::row_indices equal_range(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+                    {{
+                        if (table_.empty())
+                            return {{}};
+
+                        {dispatch('equal_range({}, key)', sorted_, 'a sorted index')}
+                    }}
+
+                    {
+                        doxygen(r"""
+                    @brief Returns the rows whose value in a column with a sorted index lies in the range `[lo, hi)`.
+
+                    @returns A list of row indices, in ascending order of the column's value.""")
+                    }
+                    template <auto Column>
+                    SOAGEN_NODISCARD
+                    soagen::row_indices range(const std::remove_cv_t<column_type<Column>>& lo,
+                                              const std::remove_cv_t<column_type<Column>>& hi) const noexcept
+                    {{
+                        if (table_.empty())
+                            return {{}};
+
+                        {dispatch('range({}, lo, hi)', sorted_, 'a sorted index')}
+                    }}
+                    '''
+                    )
+                    if len(sorted_) == 1:
+                        col = sorted_[0]
+                        o(
+                            rf'''
+                        {
+                            doxygen(rf"""
+                        @brief Returns the rows whose `{col.name}` is equal to `key`.
+
+                        @returns A list of row indices, in the order the rows were added.""")
+                        }
+                        SOAGEN_NODISCARD
+                        soagen::row_indices equal_range(const std::remove_cv_t<column_type<{col.index}>>& key) const noexcept
+                        {{
+                            return equal_range<{col.index}>(key);
+                        }}
+
+                        {
+                            doxygen(rf"""
+                        @brief Returns the rows whose `{col.name}` lies in the range `[lo, hi)`.
+
+                        @returns A list of row indices, in ascending order of `{col.name}`.""")
+                        }
+                        SOAGEN_NODISCARD
+                        soagen::row_indices range(const std::remove_cv_t<column_type<{col.index}>>& lo,
+                                                  const std::remove_cv_t<column_type<{col.index}>>& hi) const noexcept
+                        {{
+                            return range<{col.index}>(lo, hi);
+                        }}
+                        '''
+                        )
+
+                bitmapped = [col for col in indexed if col.index_type == r'bitmap']
+                if bitmapped:
+                    o(
+                        rf'''
+                    {
+                        doxygen(r"""
+                    @brief Returns the set of rows whose value in a column with a bitmap index is equal to `key`.
+
+                    @details Sets returned for different columns (or keys) can be combined with `&`, `|` and `~`,
+                             and iterated to visit the matching row indices in ascending order.""")
+                    }
+                    template <auto Column>
+                    SOAGEN_NODISCARD
+                    soagen::row_bitset matching(const std::remove_cv_t<column_type<Column>>& key) const
+                    {{
+                        {dispatch('matching(key)', bitmapped, 'a bitmap index')}
+                    }}
+                    '''
+                    )
+                    if len(bitmapped) == 1:
+                        col = bitmapped[0]
+                        o(
+                            rf'''
+                        {
+                            doxygen(rf"""
+                        @brief Returns the set of rows whose `{col.name}` is equal to `key`.""")
+                        }
+                        SOAGEN_NODISCARD
+                        soagen::row_bitset matching(const std::remove_cv_t<column_type<{col.index}>>& key) const
+                        {{
+                            return matching<{col.index}>(key);
+                        }}
+                        '''
+                        )
+
+    def write_handles(self, o: Writer, doxygen):
+        with DoxygenMemberGroup(o, 'Handles'):
+            with Public(o):
+                o(
+                    rf'''
+                {doxygen(r"@brief Stable, generational reference to a row. See soagen::row_handle.")}
+                using handle_type = soagen::row_handle<{self.name}>;
+
+                {doxygen(r"@brief Returns a handle to the row at the given index.")}
+                SOAGEN_PURE_INLINE_GETTER
+                handle_type handle_of(size_type index) const noexcept
+                {{
+                    return handles_.handle_of(index);
+                }}
+
+                {
+                    doxygen(r"""
+                @brief Returns the current index of the row a handle refers to.
+
+                @returns The row's index, or an empty optional if the row has since been removed.""")
+                }
+                SOAGEN_PURE_INLINE_GETTER
+                soagen::optional<size_type> index_of(const handle_type& handle) const noexcept
+                {{
+                    return handles_.index_of(handle);
+                }}
+
+                {doxygen(r"@brief Returns true if a handle refers to a row that is still in the table.")}
+                SOAGEN_PURE_INLINE_GETTER
+                bool contains(const handle_type& handle) const noexcept
+                {{
+                    return static_cast<bool>(handles_.index_of(handle));
+                }}
+
+                {
+                    doxygen(r"""
+                @brief Discards all existing handles and issues a new one for every row.
+
+                @details Handles are kept up-to-date automatically by every member function that adds or removes rows.
+                         Call this if you add or remove rows via the underlying table directly.""")
+                }
+                void rebuild_handles()
+                {{
+                    handles_.clear();
+                    handles_.reserve(table_.size());
+                    for (size_type i = 0, e = table_.size(); i < e; i++)
+                        handles_.push_back(i);
+                }}
+
+                {
+                    doxygen(r"""
+                @brief Appends a new row to the end of the table and returns a handle to it.
+
+                @details Arguments are forwarded to #emplace_back().""")
+                }
+                template <typename... Args>
+                handle_type emplace_back_handle(Args&&... args)
+                {{
+                    emplace_back(static_cast<Args&&>(args)...);
+                    return handles_.handle_of(table_.size() - 1u);
+                }}
+
+                {
+                    doxygen(r"""
+                @brief Removes the row a handle refers to.
+
+                @details Uses the swap-and-pop idiom, so this is O(1) and keeps the columns densely packed;
+                         handles to the other rows (including the moved one) remain valid.
+
+                @returns True if the handle referred to a row that was still in the table.
+
+                @availability This method is only available when all the column types are move-assignable.""")
+                }
+                SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+                SOAGEN_ENABLE_IF_T(bool, sfinae) erase(const handle_type& handle) //
+                    noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)
+                {{
+                    const auto index = handles_.index_of(handle);
+                    if (!index)
+                        return false;
+
+                    unordered_erase(*index);
+                    return true;
+                }}
+                '''
+                )
+
     def write_class_definition(self, o: Writer):
         with MetaScope(self):
             if self.prologue:
@@ -353,6 +795,57 @@ class Struct(Configurable):
                 indent = ' ' * leading_spaces if leading_spaces is not None else ''
                 return f'{popped_start * NEWLINE}{indent}/// {rf"{NEWLINE}{indent}/// ".join(lines)}'
 
+            # secondary indexes (variables with an 'index') and the handle table (handles = true) observe the rows;
+            # every member that adds or removes rows notifies them
+            indexed = [col for col in self.columns if col.index_type]
+            observers = [rf'{col.name}_index_' for col in indexed] + ([r'handles_'] if self.handles else [])
+            index_class = {
+                r'bitmap': r'soagen::bitmap_index',
+                r'hash': r'soagen::hash_index',
+                r'sorted': r'soagen::sorted_index',
+            }
+
+            def index_calls(fn: str, *args) -> str:
+                nonlocal indexed
+                calls = [rf'{col.name}_index_.{fn}({", ".join([rf"table_.template column<{col.index}>()", *args])});' for col in indexed]
+                if self.handles:
+                    calls.append(rf'handles_.{fn}({", ".join(args)});')
+                return ' '.join(calls)
+
+            def observer_calls(fn: str, *args) -> str:
+                nonlocal observers
+                return ' '.join([rf'{obs}.{fn}({", ".join(args)});' for obs in observers])
+
+            def before(s: str) -> str:
+                return rf'{s} ' if s else ''
+
+            def after(s: str) -> str:
+                return rf' {s}' if s else ''
+
+            idx_grow = before(observer_calls(r'reserve', r'table_.size() + 1u'))
+            # bitmap indexes need a copy of each new distinct value; when the row's values are named arguments they're
+            # handed over up-front so the copy happens before the table is modified
+            idx_grow_row = before(
+                ' '.join(
+                    [
+                        rf'{col.name}_index_.reserve(table_.size() + 1u'
+                        + (rf', {col.name});' if col.index_type == r'bitmap' else r');')
+                        for col in indexed
+                    ]
+                    + ([r'handles_.reserve(table_.size() + 1u);'] if self.handles else [])
+                )
+            )
+            idx_push_back = after(index_calls(r'push_back', r'table_.size() - 1u'))
+            idx_insert_index = after(index_calls(r'insert', r'index_', r'table_.size()'))
+            idx_insert_iter = after(index_calls(r'insert', r'static_cast<size_type>(iter_)', r'table_.size()'))
+            idx_erase_pos = before(index_calls(r'erase', r'pos', r'table_.size()'))
+            idx_erase_iter = before(index_calls(r'erase', r'static_cast<size_type>(pos)', r'table_.size()'))
+            idx_unordered_erase_pos = before(index_calls(r'unordered_erase', r'pos', r'table_.size()'))
+            idx_unordered_erase_iter = before(index_calls(r'unordered_erase', r'static_cast<size_type>(pos)', r'table_.size()'))
+            idx_noexcept = r' && indexes_are_nothrow_' if observers else ''
+            # members that only rewrite values leave the handles alone; only value indexes have to be rebuilt
+            idx_rebuild_noexcept = r' && indexes_are_nothrow_' if indexed else ''
+
             o(
                 doxygen(
                     rf'''
@@ -482,6 +975,21 @@ class Struct(Configurable):
                     {doxygen(r"@brief Gets the name of the specified column as a null-terminated string.")}
                     template <auto Column> static constexpr auto& column_name = soagen::detail::column_name<{self.name}, static_cast<size_type>(Column)>::value;
 
+                    '''
+                    )
+
+                    if self.aos:
+                        o(doxygen(r"@brief A plain struct with one member per column (the 'Array-of-Structures' equivalent of a row)."))
+                        with ClassDefinition(o, 'struct value_type'):
+                            for col in self.columns:
+                                typ = col.type
+                                if re.search(r'\b(?:const|volatile)\b', typ):
+                                    typ = rf'std::remove_cv_t<{typ}>'
+                                o(rf'{typ} {col.name}{rf" = {col.default}" if col.default else ""};')
+
+                    o(
+                        rf'''
+
                     {self.header}
 
                     '''
@@ -500,9 +1008,22 @@ class Struct(Configurable):
                     table_type table_;
                     '''
                     )
+                    for col in indexed:
+                        o(rf'{index_class[col.index_type]}<std::remove_cv_t<column_type<{col.index}>>> {col.name}_index_;')
+                    if self.handles:
+                        o(rf'soagen::handle_table<{self.name}> handles_;')
+                    if observers:
+                        o(
+                            r'''
+
+                        // growing an index or the handle table may allocate
+                        static constexpr bool indexes_are_nothrow_ = false;
+                        '''
+                        )
 
                 with Public(o):
                     ctor_attrs = 'SOAGEN_NODISCARD_CTOR'
+                    ctor_constexpr = '' if observers else 'constexpr '  # the indexes' storage isn't constexpr-constructible
 
                     if isinstance(self.default_constructible, bool) or self.default_constructible != 'auto':
                         o(
@@ -531,13 +1052,13 @@ class Struct(Configurable):
 
                     {doxygen(r"@brief Constructs with the given allocator.")}
                     {ctor_attrs}
-                    constexpr explicit {self.name}(const allocator_type& alloc) noexcept //
+                    {ctor_constexpr}explicit {self.name}(const allocator_type& alloc) noexcept //
                         : table_{{ alloc }}
                     {{}}
 
                     {doxygen(r"@brief Constructs with the given allocator.")}
                     {ctor_attrs}
-                    constexpr explicit {self.name}(allocator_type&& alloc) noexcept //
+                    {ctor_constexpr}explicit {self.name}(allocator_type&& alloc) noexcept //
                         : table_{{ static_cast<allocator_type&&>(alloc) }}
                     {{}}
 
@@ -619,7 +1140,7 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T({self.name}&, sfinae) erase(size_type pos) //
                             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
                         {{
-                            table_.erase(pos);
+                            {idx_erase_pos}table_.erase(pos);
                             return *this;
                         }}
 
@@ -644,7 +1165,7 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T(soagen::optional<size_type>, sfinae) unordered_erase(size_type pos) //
                             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
                         {{
-                            return table_.unordered_erase(pos);
+                            {idx_unordered_erase_pos}return table_.unordered_erase(pos);
                         }}
                         '''
                         )
@@ -667,7 +1188,7 @@ class Struct(Configurable):
                                 SOAGEN_ENABLE_IF_T({const}iterator, sfinae) erase({const}iterator pos) //
                                     noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
                                 {{
-                                    table_.erase(static_cast<size_type>(pos));
+                                    {idx_erase_iter}table_.erase(static_cast<size_type>(pos));
                                     return pos;
                                 }}
 
@@ -694,7 +1215,7 @@ class Struct(Configurable):
                                 }iterator pos) //
                                     noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
                                 {{
-                                    if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                                    {idx_unordered_erase_iter}if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                                         return {const}iterator{{ *this, static_cast<difference_type>(*moved_pos) }};
                                     return {{}};
                                 }}
@@ -713,12 +1234,59 @@ class Struct(Configurable):
                         SOAGEN_ALWAYS_INLINE
                         SOAGEN_CONSTEXPR_20
                         {self.name}& swap_columns() //
-                            noexcept(noexcept(std::declval<table_type&>().template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+                            noexcept(noexcept(std::declval<table_type&>().template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()){idx_rebuild_noexcept})
+                        {{
+                            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();{after("rebuild_indexes();" if indexed else "")}
+                            return *this;
+                        }}
+
+                        {
+                                doxygen(r"""
+                        @brief Assigns a value to every element of a column (or some range of them).
+
+                        @details Trivially-copyable columns are filled with a single `memset()` when every byte of the value is
+                                 the same (e.g. zeroing), and with a loop the compiler can vectorize otherwise.
+
+                        @param value	The value to assign. It may be one of the column's own elements.
+                        @param first	The first row to assign.
+                        @param count	The number of rows to assign. Clamped to the end of the table.""")
+                            }
+                        template <auto Column, typename Value>
+                        SOAGEN_ALWAYS_INLINE
+                        SOAGEN_CONSTEXPR_20
+                        {self.name}& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+                            noexcept(noexcept(std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)){idx_rebuild_noexcept})
                         {{
-                            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+                            table_.template fill<static_cast<size_type>(Column)>(value, first, count);{after("rebuild_indexes();" if indexed else "")}
                             return *this;
                         }}
 
+                        {
+                                doxygen(r"""
+                        @brief Assigns the elements of a range to a column, starting at the given row.
+
+                        @details Contiguous ranges of a trivially-copyable column's own type (anything with `data()` and `size()`,
+                                 e.g. a `std::vector`) are copied with a single `memmove()`.
+
+                        @param values	The range of values to assign. Must not run past the end of the table.
+                        @param first	The first row to assign.""")
+                            }
+                        template <auto Column, typename Range>
+                        SOAGEN_ALWAYS_INLINE
+                        SOAGEN_CONSTEXPR_20
+                        {self.name}& assign_column(const Range& values, size_type first = 0)
+                        {{
+                            table_.template assign_column<static_cast<size_type>(Column)>(values, first);{after("rebuild_indexes();" if indexed else "")}
+                            return *this;
+                        }}
+                        '''
+                        )
+
+                        if observers:
+                            self.write_index_modifiers(o, doxygen, indexed, observers, index_calls, observer_calls)
+                        else:
+                            o(
+                                rf'''
                         #if SOAGEN_DOXYGEN
 
                         {doxygen(r"@brief Removes the last row(s) from the table.")}
@@ -737,25 +1305,54 @@ class Struct(Configurable):
                         {self.name}& resize(size_type new_size) //
                             noexcept(soagen::has_nothrow_resize_member<table_type>);
 
-                        '''
-                        )
+                        {
+                                doxygen(r"""
+                        @brief Resizes the table to the given number of rows, copy-constructing any new rows from the given values.
 
-                        if self.swappable:
-                            o(
-                                rf'''
-                            {
-                                    doxygen(r"""
-                            @brief Swaps the contents of the table with another.
+                        @details New rows are constructed a column at a time, so trivially-copyable columns are filled in bulk.
 
-                            @availability This method is only available when #allocator_type is swappable or non-propagating.""")
-                                }
-                            constexpr void swap({self.name}& other) //
-                                noexcept(soagen::has_nothrow_swap_member<table_type>);
+                        @param new_size	The new number of rows.
+                        @param values	One value per column.""")
+                            }
+                        template <typename... Values>
+                        {self.name}& resize(size_type new_size, const Values&... values) noexcept(...);
 
-                            #endif
-                            '''
+                        {
+                                doxygen(r"""
+                        @brief Appends `num` rows and returns a span over them, ready to be written directly into column memory.
+
+                        @details Trivially default-constructible columns are left uninitialized; all others are value-initialized.
+
+                        @returns A span over the new rows (empty if `num` is zero).
+
+                        @availability This method is only available when all the column types are default-constructible.""")
+                            }
+                        span_type append_uninitialized(size_type num) noexcept(...);
+
+                        '''
                             )
 
+                            if self.swappable:
+                                o(
+                                    rf'''
+                                {
+                                        doxygen(r"""
+                                @brief Swaps the contents of the table with another.
+
+                                @availability This method is only available when #allocator_type is swappable or non-propagating.""")
+                                    }
+                                constexpr void swap({self.name}& other) //
+                                    noexcept(soagen::has_nothrow_swap_member<table_type>);
+                                '''
+                                )
+
+                            o('#endif')
+
+                if indexed:
+                    self.write_index_lookups(o, doxygen, indexed)
+                if self.handles:
+                    self.write_handles(o, doxygen)
+
                 # figure out defaults for function + template params
                 value_defaults = []
                 type_defaults = []
@@ -818,9 +1415,9 @@ class Struct(Configurable):
                         {doxygen('@brief Adds a new row at the end of the table.')}
                         SOAGEN_CONSTEXPR_20
                         {self.name}& push_back({", ".join(lvalue_param_list)}) //
-                            noexcept(table_traits::push_back_is_nothrow<table_type>)		//
+                            noexcept(table_traits::push_back_is_nothrow<table_type>{idx_noexcept})		//
                         {{
-                            table_.emplace_back({", ".join(lvalue_forward_list)});
+                            {idx_grow_row}table_.emplace_back({", ".join(lvalue_forward_list)});{idx_push_back}
                             return *this;
                         }}
 
@@ -828,9 +1425,9 @@ class Struct(Configurable):
                         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
                         SOAGEN_CONSTEXPR_20
                         {self.name}& push_back({", ".join(rvalue_param_list)}) //
-                            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)	 //
+                            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>{idx_noexcept})	 //
                         {{
-                            table_.emplace_back({", ".join(rvalue_forward_list)});
+                            {idx_grow_row}table_.emplace_back({", ".join(rvalue_forward_list)});{idx_push_back}
                             return *this;
                         }}
 
@@ -841,9 +1438,9 @@ class Struct(Configurable):
                                                     {", ".join(template_type_list)}) //
                         SOAGEN_CONSTEXPR_20
                         {self.name}& emplace_back({", ".join(template_param_list)}) //
-                            noexcept(table_traits::emplace_back_is_nothrow<table_type, {", ".join(template_params)}>) //
+                            noexcept(table_traits::emplace_back_is_nothrow<table_type, {", ".join(template_params)}>{idx_noexcept}) //
                         {{
-                            table_.emplace_back({", ".join(template_forward_list)});
+                            {idx_grow_row}table_.emplace_back({", ".join(template_forward_list)});{idx_push_back}
                             return *this;
                         }}
 
@@ -851,15 +1448,58 @@ class Struct(Configurable):
                         SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
                         SOAGEN_CONSTEXPR_20
                         {self.name}& emplace_back(Tuple&& tuple_)								 //
-                            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+                            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>{idx_noexcept}) //
                         {{
-                            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+                            {idx_grow}table_.emplace_back(static_cast<Tuple&&>(tuple_));{idx_push_back}
                             return *this;
                         }}
 
                         '''
                         )
 
+                if self.aos:
+                    member_ptrs = ", ".join([rf'&value_type::{col.name}' for col in self.columns])
+                    append_body = rf'soagen::append_from_aos(table_, src, count, {member_ptrs});'
+                    if observers:
+                        append_body = rf'''
+                        {observer_calls(r'reserve', r'table_.size() + count')}
+                        const size_type first = table_.size();
+                        {append_body}
+                        for (size_type i = first; i < table_.size(); i++)
+                        {{
+                            {index_calls(r'push_back', r'i')}
+                        }}'''
+                    with DoxygenMemberGroup(o, 'Array-of-Structures conversion'):
+                        with Public(o):
+                            o(
+                                rf'''
+                            {
+                                    doxygen(r"""
+                            @brief Appends rows to the end of the table by copying them from an array of #value_type.
+
+                            @details Rows are transposed in blocks, one column at a time, rather than being pushed back one at a time.
+                                     See soagen::append_from_aos().""")
+                                }
+                            {self.name}& append_from_aos(const value_type* src, size_type count)
+                            {{
+                                {append_body}
+                                return *this;
+                            }}
+
+                            {
+                                    doxygen(r"""
+                            @brief Copies rows from the table out to an array of #value_type.
+
+                            @details The destination structs must already exist; their members are assigned.
+                                     See soagen::copy_to_aos().""")
+                                }
+                            void copy_to_aos(value_type* dest, size_type start, size_type count) const
+                            {{
+                                soagen::copy_to_aos(table_, dest, start, count, {member_ptrs});
+                            }}
+                            '''
+                            )
+
                 with DoxygenMemberGroup(
                     o,
                     'Inserting rows',
@@ -891,9 +1531,9 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T({self.name}&, sfinae) insert(size_type index_, {
                                 ", ".join(lvalue_param_list)
                             }) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(index_, {", ".join(lvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(index_, {", ".join(lvalue_forward_list)});{idx_insert_index}
                             return *this;
                         }}
 
@@ -907,9 +1547,9 @@ class Struct(Configurable):
                         {self.name}& insert(SOAGEN_ENABLE_IF_T(size_type, sfinae) index_, {
                                 ", ".join(rvalue_param_list)
                             }) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(index_, {", ".join(rvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(index_, {", ".join(rvalue_forward_list)});{idx_insert_index}
                             return *this;
                         }}
 
@@ -924,9 +1564,9 @@ class Struct(Configurable):
                         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
                         SOAGEN_CONSTEXPR_20
                         SOAGEN_ENABLE_IF_T(iterator, sfinae) insert(iterator iter_, {", ".join(lvalue_param_list)}) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(lvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(lvalue_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -940,9 +1580,9 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T(const_iterator, sfinae) insert(const_iterator iter_, {
                                 ", ".join(lvalue_param_list)
                             }) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(lvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(lvalue_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -954,9 +1594,9 @@ class Struct(Configurable):
                         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
                         SOAGEN_CONSTEXPR_20
                         iterator insert(SOAGEN_ENABLE_IF_T(iterator, sfinae) iter_, {", ".join(rvalue_param_list)}) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(rvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(rvalue_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -970,9 +1610,9 @@ class Struct(Configurable):
                         const_iterator insert(SOAGEN_ENABLE_IF_T(const_iterator, sfinae) iter_, {
                                 ", ".join(rvalue_param_list)
                             }) //
-                            noexcept(table_traits::insert_is_nothrow<table_type>)             //
+                            noexcept(table_traits::insert_is_nothrow<table_type>{idx_noexcept})             //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(rvalue_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(rvalue_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -991,9 +1631,9 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T({self.name}&, sfinae) emplace(size_type index_, {
                                 ", ".join(template_param_list)
                             }) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>{idx_noexcept}) //
                         {{
-                            table_.emplace(index_, {", ".join(template_forward_list)});
+                            {idx_grow_row}table_.emplace(index_, {", ".join(template_forward_list)});{idx_insert_index}
                             return *this;
                         }}
 
@@ -1006,9 +1646,9 @@ class Struct(Configurable):
                                                     SOAGEN_HIDDEN_PARAM(bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_)) //
                         SOAGEN_CONSTEXPR_20
                         {self.name}& emplace(SOAGEN_ENABLE_IF_T(size_type, sfinae) index_, Tuple&& tuple_) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>{idx_noexcept}) //
                         {{
-                            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+                            {idx_grow}table_.emplace(index_, static_cast<Tuple&&>(tuple_));{idx_insert_index}
                             return *this;
                         }}
 
@@ -1027,9 +1667,9 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T(iterator, sfinae) emplace(iterator iter_, {
                                 ", ".join(template_param_list)
                             }) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>{idx_noexcept}) //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(template_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(template_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -1042,9 +1682,9 @@ class Struct(Configurable):
                                                     SOAGEN_HIDDEN_PARAM(bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_)) //
                         SOAGEN_CONSTEXPR_20
                         iterator emplace(SOAGEN_ENABLE_IF_T(iterator, sfinae) iter_, Tuple&& tuple_) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>{idx_noexcept}) //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+                            {idx_grow}table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -1061,9 +1701,9 @@ class Struct(Configurable):
                         SOAGEN_ENABLE_IF_T(const_iterator, sfinae) emplace(const_iterator iter_, {
                                 ", ".join(template_param_list)
                             }) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, {", ".join(template_params)}>{idx_noexcept}) //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), {", ".join(template_forward_list)});
+                            {idx_grow_row}table_.emplace(static_cast<size_type>(iter_), {", ".join(template_forward_list)});{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -1076,9 +1716,9 @@ class Struct(Configurable):
                                                     SOAGEN_HIDDEN_PARAM(bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_)) //
                         SOAGEN_CONSTEXPR_20
                         const_iterator emplace(SOAGEN_ENABLE_IF_T(const_iterator, sfinae) iter_, Tuple&& tuple_) //
-                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>) //
+                            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>{idx_noexcept}) //
                         {{
-                            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+                            {idx_grow}table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));{idx_insert_iter}
                             return iter_;
                         }}
 
@@ -1121,6 +1761,8 @@ class Struct(Configurable):
                                     doxygen(r"""
                             @brief Returns a pointer to the raw byte backing array.
 
+                            @note Columns moved out of the main buffer by soagen::exchange_column() are not part of it.
+
                             @availability This method is only available when all the column types are trivially-copyable.""")
                                 }
                             constexpr std::byte* data() noexcept;
@@ -1129,6 +1771,8 @@ class Struct(Configurable):
                                     doxygen(r"""
                             @brief Returns a pointer to the raw byte backing array.
 
+                            @note Columns moved out of the main buffer by soagen::exchange_column() are not part of it.
+
                             @availability This method is only available when all the column types are trivially-copyable.""")
                                 }
                             constexpr const std::byte* data() const noexcept;
@@ -1200,7 +1844,8 @@ class Struct(Configurable):
 
                                 @warning This value is `capacity() * (sizeof() for every column) + (alignment padding)`.
                                         It is **not** based on `size()`! If you are using the value returned by this function
-                                        in conjunction with `data()` to do serialization, hashing, etc, use `shrink_to_fit()` first.""")
+                                        in conjunction with `data()` to do serialization, hashing, etc, use `shrink_to_fit()` first.
+                                        Columns moved out of the main buffer by soagen::exchange_column() are not included.""")
                                     }
                                 constexpr size_type allocation_size() const noexcept;
 
@@ -22,6 +22,7 @@ class Variable(Configurable):
     default: str
     alignment: int
     index: int
+    index_type: str
     pointer_type: str
     const_pointer_type: str
     columns: list[Column]
@@ -40,6 +41,7 @@ class Variable(Configurable):
                 lambda x: x <= 0 or utils.is_pow2(x),
                 error=r'alignment must be a power-of-two integer',
             ),
+            Optional(r'index', default=''): Or('', r'bitmap', r'hash', r'sorted', error=r"index must be one of 'bitmap', 'hash' or 'sorted'"),
         }
     )
 
@@ -49,6 +51,7 @@ class Variable(Configurable):
         self.index = -1  # set by the struct
 
         vals = Variable.__schema.validate(vals)
+        vals[r'index_type'] = vals.pop(r'index')  # 'index' is the variable's position in the struct
         self.__dict__.update(vals)
 
         valid = cpp.is_valid_identifier(self.name)
@@ -192,3 +192,63 @@ TEST_CASE("allocator - non-propagating move assignment with unequal allocators m
     for (int i = 0; i < 3; i++)
         CHECK(dst.column<1>()[i] == static_cast<unsigned long long>(i));
 }
+
+namespace
+{
+    // an allocator that counts its live allocations, to catch leaked buffers.
+    struct counting_allocator
+    {
+        using value_type      = std::byte;
+        using is_always_equal = std::true_type;
+
+        static constexpr std::size_t min_alignment = 64;
+
+        static inline int live = 0;
+
+        std::byte* allocate(std::size_t n, std::align_val_t = std::align_val_t{ min_alignment })
+        {
+            auto ptr = static_cast<std::byte*>(::operator new(n, std::align_val_t{ min_alignment }));
+            live++;
+            return ptr;
+        }
+
+        void deallocate(std::byte* p, std::size_t) noexcept
+        {
+            live--;
+            ::operator delete(p, std::align_val_t{ min_alignment });
+        }
+
+        [[maybe_unused]]
+        bool operator==(const counting_allocator&) const noexcept
+        {
+            return true;
+        }
+
+        [[maybe_unused]]
+        bool operator!=(const counting_allocator&) const noexcept
+        {
+            return false;
+        }
+    };
+}
+
+TEST_CASE("allocator - reserve on an empty table releases the previous allocation", "[allocator]")
+{
+    {
+        soagen::table<rich::table_traits, counting_allocator> t;
+        t.reserve(4);
+        CHECK(counting_allocator::live == 1);
+
+        // empty but with capacity; growing must still free the old buffer
+        t.reserve(100);
+        CHECK(t.capacity() >= 100u);
+        CHECK(counting_allocator::live == 1);
+
+        t.emplace_back(std::string("x"), 1ull, std::tuple{ 1, 2, 3 }, 10, nullptr);
+        t.clear();
+        t.reserve(1000);
+        CHECK(t.capacity() >= 1000u);
+        CHECK(counting_allocator::live == 1);
+    }
+    CHECK(counting_allocator::live == 0);
+}
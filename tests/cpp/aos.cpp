@@ -0,0 +1,138 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+static_assert(std::is_same_v<decltype(std::declval<rich::value_type&>().name), std::string>); // const stripped
+static_assert(std::is_same_v<decltype(std::declval<rich::value_type&>().tag), int*>);
+
+TEST_CASE("aos - trivial", "[aos]")
+{
+    // enough rows to span several blocks, plus a ragged tail
+    std::vector<trivial::value_type> src(1000);
+    for (std::size_t i = 0; i < src.size(); i++)
+    {
+        const auto f = static_cast<float>(i);
+        src[i]       = { f, f + 1.0f, f + 2.0f, static_cast<unsigned>(i) };
+    }
+
+    trivial t = make_trivial(3);
+    t.append_from_aos(src.data(), src.size());
+    REQUIRE(t.size() == 1003u);
+    for (std::size_t i = 0; i < src.size(); i++)
+    {
+        CHECK(t.x()[i + 3u] == src[i].x);
+        CHECK(t.z()[i + 3u] == src[i].z);
+        CHECK(t.flags()[i + 3u] == src[i].flags);
+    }
+
+    std::vector<trivial::value_type> dest(src.size() - 10u);
+    t.copy_to_aos(dest.data(), 8, dest.size());
+    for (std::size_t i = 0; i < dest.size(); i++)
+    {
+        CHECK(dest[i].x == src[i + 5u].x);
+        CHECK(dest[i].y == src[i + 5u].y);
+        CHECK(dest[i].flags == src[i + 5u].flags);
+    }
+
+    // zero-length is a no-op, even with null pointers
+    t.append_from_aos(nullptr, 0);
+    t.copy_to_aos(nullptr, 0, 0);
+    CHECK(t.size() == 1003u);
+}
+
+TEST_CASE("aos - float4", "[aos]")
+{
+    for (std::size_t count : { 1u, 4u, 7u, 256u, 259u, 1030u })
+    {
+        std::vector<vec4::value_type> src(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            src[i]       = { f, -f, f * 2.0f, f * 0.5f };
+        }
+
+        vec4 v;
+        v.append_from_aos(src.data(), count);
+        REQUIRE(v.size() == count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            CHECK(v.x()[i] == src[i].x);
+            CHECK(v.y()[i] == src[i].y);
+            CHECK(v.z()[i] == src[i].z);
+            CHECK(v.w()[i] == src[i].w);
+        }
+
+        std::vector<vec4::value_type> dest(count);
+        v.copy_to_aos(dest.data(), 0, count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            CHECK(dest[i].x == src[i].x);
+            CHECK(dest[i].y == src[i].y);
+            CHECK(dest[i].z == src[i].z);
+            CHECK(dest[i].w == src[i].w);
+        }
+    }
+}
+
+TEST_CASE("aos - rich", "[aos]")
+{
+    int tag = 0;
+    std::vector<rich::value_type> src(300);
+    for (std::size_t i = 0; i < src.size(); i++)
+    {
+        src[i].name          = "name " + std::to_string(i);
+        src[i].id            = i;
+        src[i].date_of_birth = { 1970 + static_cast<int>(i), 1, 1 };
+        src[i].salary        = static_cast<int>(i) * 1000;
+        src[i].tag           = i == 42u ? &tag : nullptr;
+    }
+    CHECK(rich::value_type{}.tag == nullptr); // column default
+
+    rich r;
+    r.append_from_aos(src.data(), src.size());
+    rich expected      = make_rich(300);
+    expected.tag()[42] = &tag;
+    CHECK(r == expected);
+
+    std::vector<rich::value_type> dest(2);
+    r.copy_to_aos(dest.data(), 41, 2);
+    CHECK(dest[0].name == "name 41");
+    CHECK(dest[0].tag == nullptr);
+    CHECK(dest[1].name == "name 42");
+    CHECK(dest[1].tag == &tag);
+}
+
+#if SOAGEN_HAS_EXCEPTIONS
+
+TEST_CASE("aos - strong exception guarantee", "[aos]")
+{
+    std::vector<fragile::value_type> src(600);
+    for (std::size_t i = 0; i < src.size(); i++)
+        src[i] = { throwing{ static_cast<int>(i) }, static_cast<int>(i) };
+
+    const int live = throwing::live;
+    {
+        fragile f;
+        f.push_back(throwing{ -1 }, -1);
+
+        throwing::arm(400); // throws part-way through the second block
+        CHECK_THROWS(f.append_from_aos(src.data(), src.size()));
+        throwing::disarm();
+
+        REQUIRE(f.size() == 1u);
+        CHECK(f.v()[0].value == -1);
+        CHECK(throwing::live == live + 1);
+
+        f.append_from_aos(src.data(), src.size());
+        CHECK(f.size() == 601u);
+        CHECK(f.v()[600].value == 599);
+    }
+    CHECK(throwing::live == live);
+}
+
+#endif
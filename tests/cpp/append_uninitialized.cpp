@@ -0,0 +1,128 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstring>
+
+using namespace tests;
+
+static_assert(std::is_same_v<decltype(std::declval<trivial&>().append_uninitialized(1)), soagen::span_type<trivial>>);
+static_assert(noexcept(std::declval<trivial&>().append_uninitialized(1))
+              == noexcept(std::declval<trivial&>().reserve(1)));
+
+TEST_CASE("append_uninitialized", "[append_uninitialized]")
+{
+    auto t = make_trivial(3);
+
+    // nothing to append
+    CHECK(t.append_uninitialized(0).empty());
+    CHECK(t.size() == 3u);
+
+    // trivial columns are written directly through the span's column pointers
+    auto s = t.append_uninitialized(100);
+    REQUIRE(s.size() == 100u);
+    REQUIRE(t.size() == 103u);
+    CHECK(s.column<trivial::columns::x>() == t.x() + 3);
+
+    const float xs[] = { 10.0f, 11.0f, 12.0f, 13.0f };
+    std::memcpy(s.column<trivial::columns::x>(), xs, sizeof(xs));
+    for (std::size_t i = 0; i < s.size(); i++)
+    {
+        s.column<trivial::columns::y>()[i]     = static_cast<float>(i);
+        s.column<trivial::columns::z>()[i]     = -static_cast<float>(i);
+        s.column<trivial::columns::flags>()[i] = static_cast<unsigned>(i) * 2u;
+    }
+    CHECK(t.x()[2] == 2.0f);
+    CHECK(t.x()[3] == 10.0f);
+    CHECK(t.x()[6] == 13.0f);
+    CHECK(t.y()[102] == 99.0f);
+    CHECK(t.z()[52] == -49.0f);
+    CHECK(t.flags()[3] == 0u);
+    CHECK(t.flags()[102] == 198u);
+
+    // repeated appends grow the table; earlier rows are preserved
+    for (int i = 0; i < 10; i++)
+    {
+        const auto start = t.size();
+        auto more        = t.append_uninitialized(37);
+        REQUIRE(more.size() == 37u);
+        REQUIRE(t.size() == start + 37u);
+        more.fill<trivial::columns::flags>(static_cast<unsigned>(i));
+    }
+    CHECK(t.size() == 473u);
+    CHECK(t.x()[5] == 12.0f);
+    CHECK(t.flags()[102] == 198u);
+    CHECK(t.flags()[103] == 0u);
+    CHECK(t.flags()[472] == 9u);
+
+    // tables directly; the choice is made per column, so only the string column is initialized
+    soagen::table<soagen::table_traits<int, std::string>> table;
+    table.resize(2, 7, "seven");
+    {
+        auto rows = table.append_uninitialized(5);
+        REQUIRE(rows.size() == 5u);
+        REQUIRE(table.size() == 7u);
+    }
+    CHECK(table.column<0>()[1] == 7);
+    CHECK(table.column<1>()[1] == "seven");
+    for (std::size_t i = 2; i < table.size(); i++)
+        CHECK(table.column<1>()[i].empty());
+}
+
+TEST_CASE("append_uninitialized - value-initialized columns", "[append_uninitialized]")
+{
+    auto r = make_rich(2);
+    auto s = r.append_uninitialized(3);
+    REQUIRE(s.size() == 3u);
+    REQUIRE(r.size() == 5u);
+    CHECK(r.name()[1] == "name 1");
+    for (std::size_t i = 2; i < r.size(); i++)
+    {
+        CHECK(r.name()[i].empty());
+        CHECK(r.date_of_birth()[i] == std::tuple{ 0, 0, 0 });
+    }
+    s.column<rich::columns::salary>()[0] = 1234;
+    CHECK(r.salary()[2] == 1234);
+
+    // handles are issued for the new rows
+    actors a;
+    a.emplace_back("first");
+    auto as = a.append_uninitialized(4);
+    REQUIRE(as.size() == 4u);
+    REQUIRE(a.size() == 5u);
+    for (std::size_t i = 0; i < as.size(); i++)
+    {
+        as.column<actors::columns::name>()[i] = "a" + std::to_string(i);
+        as.column<actors::columns::hp>()[i]   = static_cast<int>(i);
+    }
+    for (std::size_t i = 0; i < a.size(); i++)
+        CHECK(a.index_of(a.handle_of(i)) == i);
+    CHECK(a.name()[*a.index_of(a.handle_of(4))] == "a3");
+    CHECK(a.erase(a.handle_of(1)));
+    CHECK(a.size() == 4u);
+    CHECK(a.name()[1] == "a3");
+
+#if SOAGEN_HAS_EXCEPTIONS
+    // strong guarantee when growing the table throws
+    const int live = throwing::live;
+    {
+        auto f = make_fragile(4);
+        f.shrink_to_fit();
+        const auto cap = f.capacity();
+
+        throwing::arm(2);
+        CHECK_THROWS(f.append_uninitialized(cap + 1u));
+        throwing::disarm();
+        CHECK(f.size() == 4u);
+        CHECK(f.v()[3].value == 3);
+        CHECK(throwing::live == live + 4);
+
+        auto fs = f.append_uninitialized(cap + 1u);
+        CHECK(fs.size() == cap + 1u);
+        CHECK(f.v()[4].value == 0);
+    }
+    CHECK(throwing::live == live);
+#endif
+}
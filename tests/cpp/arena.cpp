@@ -0,0 +1,89 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstdint>
+
+using namespace tests;
+
+namespace
+{
+    using arena_table = soagen::table<rich::table_traits, soagen::arena_allocator>;
+
+    bool aligned_to(const void* ptr, std::size_t alignment) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0u;
+    }
+}
+
+TEST_CASE("arena - bump allocation", "[arena]")
+{
+    soagen::arena a{ 1024 };
+    CHECK(a.bytes_reserved() == 0u);
+
+    auto p1 = a.allocate(10);
+    auto p2 = a.allocate(10, 64);
+    CHECK(aligned_to(p1, soagen::arena::min_alignment));
+    CHECK(aligned_to(p2, 64));
+    CHECK(p2 > p1);
+    CHECK(a.bytes_used() == 20u);
+    const auto reserved = a.bytes_reserved();
+    CHECK(reserved > 1024u);
+
+    // overflowing the initial block chains a new one; reset returns it upstream and reuses the initial block
+    static_cast<void>(a.allocate(4096));
+    CHECK(a.bytes_reserved() > reserved);
+    a.reset();
+    CHECK(a.bytes_used() == 0u);
+    CHECK(a.bytes_reserved() == reserved);
+    CHECK(a.allocate(10) == p1);
+
+    a.release();
+    CHECK(a.bytes_reserved() == 0u);
+}
+
+TEST_CASE("arena - caller-supplied buffer", "[arena]")
+{
+    alignas(64) std::byte buf[512];
+    soagen::arena a{ buf, sizeof(buf) };
+
+    auto p = a.allocate(100);
+    CHECK(p >= buf);
+    CHECK(p + 100 <= buf + sizeof(buf));
+
+    static_cast<void>(a.allocate(1000)); // spills upstream
+    CHECK(a.bytes_reserved() > sizeof(buf));
+    a.reset();
+    CHECK(a.bytes_reserved() == sizeof(buf));
+    CHECK(a.allocate(100) == p);
+}
+
+TEST_CASE("arena - tables", "[arena]")
+{
+    soagen::arena a;
+    for (int frame = 0; frame < 3; frame++)
+    {
+        {
+            arena_table t{ soagen::arena_allocator{ a } };
+            for (int i = 0; i < 500; i++)
+                t.emplace_back("name " + std::to_string(i),
+                               static_cast<unsigned long long>(i),
+                               std::tuple{ i, i, i },
+                               i,
+                               nullptr);
+
+            REQUIRE(t.size() == 500u);
+            CHECK(t.column<1>()[499] == 499u);
+            CHECK(aligned_to(t.column<1>(), 32));
+            CHECK(t.get_allocator().get_arena().bytes_used() > 0u);
+
+            arena_table moved{ std::move(t) };
+            CHECK(moved.column<0>()[123] == "name 123");
+            CHECK(moved.get_allocator() == soagen::arena_allocator{ a });
+        }
+        a.reset();
+        CHECK(a.bytes_used() == 0u);
+    }
+}
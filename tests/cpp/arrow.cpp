@@ -0,0 +1,232 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+namespace
+{
+    using mixed = soagen::table<soagen::table_traits<std::int64_t, double, std::string, bool, std::int16_t>>;
+
+    mixed make_mixed(std::size_t count)
+    {
+        mixed m;
+        for (std::size_t i = 0; i < count; i++)
+            m.emplace_back(static_cast<std::int64_t>(i) * -3,
+                           static_cast<double>(i) * 0.5,
+                           "str" + std::to_string(i),
+                           i % 3u == 0u,
+                           static_cast<std::int16_t>(i % 26u));
+        return m;
+    }
+}
+
+static_assert(soagen::is_arrow_exportable<trivial>);
+static_assert(soagen::is_arrow_exportable<mixed>);
+static_assert(!soagen::is_arrow_exportable<rich>); // tuple + pointer columns
+
+TEST_CASE("arrow - export", "[arrow]")
+{
+    auto t              = std::make_shared<trivial>(make_trivial(10));
+    const float* x_data = t->x();
+
+    ArrowArray array;
+    ArrowSchema schema;
+    soagen::to_arrow(t, &array, &schema);
+
+    REQUIRE(schema.release);
+    CHECK(std::string_view{ schema.format } == "+s");
+    REQUIRE(schema.n_children == 4);
+    CHECK(std::string_view{ schema.children[0]->name } == "x");
+    CHECK(std::string_view{ schema.children[0]->format } == "f");
+    CHECK(std::string_view{ schema.children[3]->name } == "flags");
+    CHECK(std::string_view{ schema.children[3]->format } == "I");
+
+    REQUIRE(array.release);
+    CHECK(array.length == 10);
+    CHECK(array.null_count == 0);
+    REQUIRE(array.n_children == 4);
+    CHECK(array.children[0]->length == 10);
+    CHECK(array.children[0]->n_buffers == 2);
+    CHECK(array.children[0]->buffers[1] == x_data); // zero-copy
+
+    // children can be moved out and outlive the parent (and the caller's reference to the table)
+    ArrowArray flags = *array.children[3];
+    array.children[3]->release = nullptr;
+    array.release(&array);
+    CHECK(!array.release);
+    t.reset();
+
+    CHECK(static_cast<const unsigned*>(flags.buffers[1])[7] == 7u);
+    flags.release(&flags);
+    CHECK(!flags.release);
+
+    schema.release(&schema);
+    CHECK(!schema.release);
+}
+
+TEST_CASE("arrow - round-trip", "[arrow]")
+{
+    ArrowArray array;
+    ArrowSchema schema;
+    soagen::to_arrow(make_mixed(20), &array, &schema);
+
+    CHECK(std::string_view{ schema.children[1]->name } == "second");
+    CHECK(std::string_view{ schema.children[2]->format } == "U");
+    CHECK(std::string_view{ schema.children[3]->format } == "b");
+    CHECK(std::string_view{ schema.children[4]->format } == "s");
+
+    mixed m;
+    REQUIRE(soagen::from_arrow(m, &array, &schema));
+    CHECK(!array.release); // consumed
+    CHECK(m == make_mixed(20));
+
+    // import -> export -> import again
+    soagen::to_arrow(std::make_shared<const mixed>(m), &array, nullptr);
+    mixed m2 = make_mixed(2);
+    REQUIRE(soagen::from_arrow(m2, &array, &schema));
+    CHECK(m2 == m);
+
+    schema.release(&schema);
+}
+
+TEST_CASE("arrow - import rebuilds indexes and handles", "[arrow]")
+{
+    ArrowArray array;
+    ArrowSchema schema;
+
+    {
+        events src;
+        for (unsigned i = 0; i < 20u; i++)
+            src.push_back(static_cast<std::int64_t>(i) * 10, i * 7u);
+        soagen::to_arrow(std::move(src), &array, &schema);
+
+        events e;
+        e.push_back(5, 14u);
+        REQUIRE(soagen::from_arrow(e, &array, &schema));
+        REQUIRE(e.size() == 20u);
+        CHECK(e.find<events::columns::id>(14u) == 2u);
+        CHECK(e.find<events::columns::timestamp>(190) == 19u);
+        CHECK(!e.find<events::columns::timestamp>(5));
+        schema.release(&schema);
+    }
+
+    {
+        actors src;
+        for (int i = 0; i < 5; i++)
+            src.emplace_back("a" + std::to_string(i), i);
+        soagen::to_arrow(std::move(src), &array, &schema);
+
+        actors a;
+        const auto stale = a.emplace_back_handle("stale");
+        REQUIRE(soagen::from_arrow(a, &array, &schema));
+        REQUIRE(a.size() == 5u);
+        CHECK(!a.contains(stale));
+        for (std::size_t i = 0; i < a.size(); i++)
+            CHECK(a.index_of(a.handle_of(i)) == i);
+        CHECK(a.hp()[*a.index_of(a.handle_of(3))] == 3);
+        schema.release(&schema);
+    }
+}
+
+TEST_CASE("arrow - import utf8 + offsets", "[arrow]")
+{
+    using strings = soagen::table<soagen::table_traits<std::string, int>>;
+
+    // hand-built arrays, as another Arrow producer might emit them
+    const std::int32_t offsets[] = { 0, 3, 3, 8 };
+    const char chars[]           = "foohello";
+    const void* str_buffers[]    = { nullptr, offsets, chars };
+    const std::int32_t ints[]    = { 10, 20, 30, 40 };
+    const void* int_buffers[]    = { nullptr, ints };
+
+    ArrowArray str_child{ 2, 0, 1, 3, 0, str_buffers, nullptr, nullptr, [](ArrowArray* a) { a->release = nullptr; },
+                          nullptr };
+    ArrowArray int_child{ 2, 0, 2, 2, 0, int_buffers, nullptr, nullptr, [](ArrowArray* a) { a->release = nullptr; },
+                          nullptr };
+    ArrowArray* children[]    = { &str_child, &int_child };
+    const void* struct_bufs[] = { nullptr };
+    ArrowArray array{ 2, 0, 0, 1, 2, struct_bufs, children, nullptr,
+                      [](ArrowArray* a)
+                      {
+                          for (int64_t i = 0; i < a->n_children; i++)
+                              a->children[i]->release(a->children[i]);
+                          a->release = nullptr;
+                      },
+                      nullptr };
+
+    ArrowSchema str_schema{ "u", "s", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema int_schema{ "i", "i", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema* schema_children[] = { &str_schema, &int_schema };
+    ArrowSchema schema{ "+s", "", nullptr, 0, 2, schema_children, nullptr, nullptr, nullptr };
+
+    strings s;
+    REQUIRE(soagen::from_arrow(s, &array, &schema));
+    CHECK(!array.release);
+    REQUIRE(s.size() == 2u);
+    CHECK(s.column<0>()[0] == "");
+    CHECK(s.column<0>()[1] == "hello");
+    CHECK(s.column<1>()[0] == 30);
+    CHECK(s.column<1>()[1] == 40);
+}
+
+TEST_CASE("arrow - import rejects uncounted nulls", "[arrow]")
+{
+    using ints = soagen::table<soagen::table_traits<int>>;
+
+    // a null_count of -1 means "not computed", so a validity bitmap may be marking nulls
+    const std::uint8_t validity[] = { 0b101 };
+    const std::int32_t values[]   = { 10, 20, 30 };
+    const void* child_buffers[]   = { validity, values };
+    const void* struct_buffers[]  = { nullptr };
+    const auto release            = [](ArrowArray* a) { a->release = nullptr; };
+
+    ArrowSchema child_schema{ "i", "i", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema* schema_children[] = { &child_schema };
+    ArrowSchema schema{ "+s", "", nullptr, 0, 1, schema_children, nullptr, nullptr, nullptr };
+
+    ArrowArray child{ 3, -1, 0, 2, 0, child_buffers, nullptr, nullptr, release, nullptr };
+    ArrowArray* children[] = { &child };
+    ArrowArray array{ 3, 0, 0, 1, 1, struct_buffers, children, nullptr, release, nullptr };
+
+    ints t;
+    CHECK(!soagen::from_arrow(t, &array, &schema));
+    CHECK(t.empty());
+
+    // ...and the same at the struct level
+    child_buffers[0]  = nullptr;
+    struct_buffers[0] = validity;
+    array             = ArrowArray{ 3, -1, 0, 1, 1, struct_buffers, children, nullptr, release, nullptr };
+    CHECK(!soagen::from_arrow(t, &array, &schema));
+    CHECK(t.empty());
+
+    // without a validity bitmap there can't be any nulls
+    struct_buffers[0] = nullptr;
+    array             = ArrowArray{ 3, -1, 0, 1, 1, struct_buffers, children, nullptr, release, nullptr };
+    REQUIRE(soagen::from_arrow(t, &array, &schema));
+    REQUIRE(t.size() == 3u);
+    CHECK(t.column<0>()[1] == 20);
+}
+
+TEST_CASE("arrow - import rejects mismatches", "[arrow]")
+{
+    ArrowArray array;
+    ArrowSchema schema;
+    soagen::to_arrow(make_trivial(3), &array, &schema);
+
+    mixed m = make_mixed(1);
+    CHECK(!soagen::from_arrow(m, &array, &schema));
+    CHECK(!array.release); // released regardless
+    CHECK(m.empty());
+
+    // nulls can't be represented
+    soagen::to_arrow(make_trivial(3), &array, nullptr);
+    array.children[1]->null_count = 1;
+    trivial t;
+    CHECK(!soagen::from_arrow(t, &array, &schema));
+
+    schema.release(&schema);
+}
@@ -0,0 +1,140 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+namespace
+{
+    trivial make_trivial(unsigned rows, float x_offset)
+    {
+        trivial t;
+        t.reserve(rows);
+        for (unsigned i = 0; i < rows; i++)
+            t.push_back(static_cast<float>(i) + x_offset, 0.0f, 0.0f, i);
+        return t;
+    }
+}
+
+// ownership of exchanged columns is tracked out-of-line, so tables that never exchange one only carry a null pointer
+static_assert(sizeof(soagen::detail::table_allocation<4>)
+              == sizeof(std::byte*) * 5u + sizeof(std::size_t) + sizeof(std::size_t*));
+
+TEST_CASE("exchange_column - between tables", "[column_buffer]")
+{
+    auto a = make_trivial(100, 0.0f);
+    auto b = make_trivial(100, 1000.0f);
+    REQUIRE(a.capacity() == b.capacity());
+
+    soagen::exchange_column<trivial::columns::x>(a, b);
+    CHECK(a.x()[7] == 1007.0f);
+    CHECK(b.x()[7] == 7.0f);
+    CHECK(a.flags()[7] == 7u); // other columns untouched
+
+    // once separated, exchanges are pointer swaps
+    const auto* a_x = a.x();
+    const auto* b_x = b.x();
+    soagen::exchange_column<trivial::columns::x>(a, b);
+    CHECK(a.x() == b_x);
+    CHECK(b.x() == a_x);
+    CHECK(a.x()[7] == 7.0f);
+
+    // different columns with matching storage/alignment (y and z are both plain floats)
+    soagen::exchange_column<trivial::columns::y, trivial::columns::z>(a, b);
+
+    // a separated column survives the table reallocating (and is merged back into the main buffer)
+    a.push_back(-1.0f, 0.0f, 0.0f, 100u);
+    a.reserve(a.capacity() * 4u);
+    CHECK(a.x()[7] == 7.0f);
+    CHECK(a.x()[100] == -1.0f);
+
+    // ...and being moved, swapped and destroyed
+    trivial c = std::move(b);
+    CHECK(c.x()[7] == 1007.0f);
+    c.swap_columns<trivial::columns::y, trivial::columns::z>();
+    c.swap(a);
+    CHECK(a.x()[7] == 1007.0f);
+    CHECK(c.x()[100] == -1.0f);
+}
+
+TEST_CASE("exchange_column - non-trivial column", "[column_buffer]")
+{
+    rich a;
+    rich b;
+    a.reserve(10);
+    b.reserve(10);
+    for (int i = 0; i < 10; i++)
+    {
+        a.push_back("a" + std::to_string(i), 1u, std::tuple<int, int, int>{}, i);
+        b.push_back("b" + std::to_string(i), 2u, std::tuple<int, int, int>{}, i);
+    }
+
+    soagen::exchange_column<rich::columns::name>(a, b);
+    CHECK(a.name()[3] == "b3");
+    CHECK(b.name()[3] == "a3");
+
+    b.pop_back(5);
+    a.pop_back(5);
+    soagen::exchange_column<rich::columns::name>(a, b);
+    CHECK(a.name()[3] == "a3");
+    CHECK(b.name()[4] == "b4");
+}
+
+TEST_CASE("exchange_column - adopting a column_buffer", "[column_buffer]")
+{
+    auto t = make_trivial(64, 0.0f);
+
+    soagen::column_buffer<trivial, trivial::columns::x> computed{ t.capacity() };
+    for (unsigned i = 0; i < t.size(); i++)
+        computed.emplace_back(static_cast<float>(i) * 2.0f);
+
+    soagen::exchange_column<trivial::columns::x>(t, computed);
+    CHECK(t.x()[10] == 20.0f);
+    CHECK(computed[10] == 10.0f); // the buffer now holds the old column
+    CHECK(computed.size() == t.size());
+
+    // a buffer laid out like another type's column is fine as long as the storage matches
+    soagen::column_buffer<trivial, trivial::columns::y> ys{ t.capacity() };
+    for (unsigned i = 0; i < t.size(); i++)
+        ys.emplace_back(3.0f);
+    soagen::exchange_column<trivial::columns::z>(t, ys);
+    CHECK(t.z()[63] == 3.0f);
+
+    t.clear();
+    computed.clear();
+    CHECK(computed.empty());
+}
+
+TEST_CASE("exchange_column - rebuilds indexes", "[column_buffer]")
+{
+    events a;
+    events b;
+    for (int i = 0; i < 10; i++)
+    {
+        a.emplace_back(i, static_cast<unsigned>(i), 0.0f);
+        b.emplace_back(100 + i, static_cast<unsigned>(100 + i), 1.0f);
+    }
+    a.reserve(b.capacity());
+    b.reserve(a.capacity());
+    REQUIRE(a.capacity() == b.capacity());
+
+    soagen::exchange_column<events::columns::id>(a, b);
+    CHECK(a.find<events::columns::id>(105u) == 5u);
+    CHECK(!a.find<events::columns::id>(5u));
+    CHECK(b.find<events::columns::id>(5u) == 5u);
+    CHECK(a.equal_range<events::columns::timestamp>(5).size() == 1u); // untouched
+
+    soagen::exchange_column<events::columns::timestamp>(a, b);
+    CHECK(a.equal_range<events::columns::timestamp>(105).size() == 1u);
+    CHECK(a.equal_range<events::columns::timestamp>(5).empty());
+
+    soagen::column_buffer<events, events::columns::id> ids{ a.capacity() };
+    for (unsigned i = 0; i < a.size(); i++)
+        ids.emplace_back(1000u + i);
+    soagen::exchange_column<events::columns::id>(a, ids);
+    CHECK(a.find<events::columns::id>(1003u) == 3u);
+    CHECK(!a.find<events::columns::id>(103u));
+}
@@ -0,0 +1,99 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <algorithm>
+#include <thread>
+
+using namespace tests;
+
+namespace
+{
+    inline constexpr unsigned producers = 4;
+    inline constexpr unsigned per_producer = 5000;
+
+    void run_producers(soagen::concurrent_appender<trivial>& app)
+    {
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < producers; t++)
+        {
+            threads.emplace_back(
+                [&app, t]
+                {
+                    for (unsigned i = 0; i < per_producer; i++)
+                    {
+                        const unsigned id = t * per_producer + i;
+                        app.emplace_back(static_cast<float>(id), 1.0f, 2.0f, id);
+                    }
+                });
+        }
+        for (auto& th : threads)
+            th.join();
+    }
+
+    // every id must appear exactly once, with its x matching
+    void check_all_present(const trivial& tbl, std::size_t offset)
+    {
+        REQUIRE(tbl.size() == offset + producers * per_producer);
+
+        std::vector<bool> seen(producers * per_producer);
+        bool ok = true;
+        for (std::size_t i = offset; i < tbl.size(); i++)
+        {
+            const auto id = tbl.flags()[i];
+            ok            = ok && id < seen.size() && !seen[id] && tbl.x()[i] == static_cast<float>(id);
+            if (id < seen.size())
+                seen[id] = true;
+        }
+        CHECK(ok);
+        CHECK(std::all_of(seen.begin(), seen.end(), [](bool b) { return b; }));
+    }
+}
+
+TEST_CASE("concurrent_appender - growth", "[concurrent]")
+{
+    trivial tbl;
+    tbl.push_back(-1.0f, 0.0f, 0.0f, 0xFFFFFFFFu);
+
+    {
+        soagen::concurrent_appender<trivial> app{ tbl, 16 }; // far too small; forces several growths
+        run_producers(app);
+        CHECK(app.committed_size() == 1u + producers * per_producer);
+    }
+
+    CHECK(tbl.flags()[0] == 0xFFFFFFFFu);
+    check_all_present(tbl, 1);
+}
+
+TEST_CASE("concurrent_appender - concurrent readers", "[concurrent]")
+{
+    trivial tbl;
+    soagen::concurrent_appender<trivial> app{ tbl, producers * per_producer };
+    const auto capacity = app.capacity();
+
+    std::atomic<bool> done = false;
+    bool reader_ok         = true;
+    std::thread reader{ [&]
+                        {
+                            std::size_t last = 0;
+                            while (!done.load())
+                            {
+                                const auto committed = app.committed_size();
+                                reader_ok            = reader_ok && committed >= last;
+                                for (std::size_t i = last; i < committed; i++)
+                                    reader_ok = reader_ok && tbl.x()[i] == static_cast<float>(tbl.flags()[i]);
+                                last = committed;
+                            }
+                        } };
+
+    run_producers(app);
+    done.store(true);
+    reader.join();
+
+    CHECK(reader_ok);
+    CHECK(app.capacity() == capacity); // never left the lock-free path
+    app.commit();
+    check_all_present(tbl, 0);
+}
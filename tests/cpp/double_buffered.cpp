@@ -0,0 +1,77 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+TEST_CASE("double_buffered - selected columns", "[double_buffered]")
+{
+    using db = soagen::double_buffered<trivial, trivial::columns::x, trivial::columns::y>;
+    static_assert(db::is_buffered<trivial::columns::x>);
+    static_assert(db::is_buffered<trivial::columns::y>);
+    static_assert(!db::is_buffered<trivial::columns::z>);
+    static_assert(!db::is_buffered<trivial::columns::flags>);
+    static_assert(db::table_type::table_traits::column_count == 6u);
+
+    db state;
+    for (unsigned i = 0; i < 100; i++)
+        state.emplace_back(static_cast<float>(i), 1.0f, 2.0f, i);
+
+    REQUIRE(state.size() == 100u);
+    CHECK(state.back<trivial::columns::z>() == state.front<trivial::columns::z>());
+    CHECK(state.back<trivial::columns::x>() != state.front<trivial::columns::x>());
+    CHECK(state.back<trivial::columns::x>()[42] == 42.0f); // both buffers initialized
+
+    // a few simulation steps: read front, write back, swap
+    const auto* x_front = state.front<trivial::columns::x>();
+    const auto* x_back  = state.back<trivial::columns::x>();
+    for (int step = 0; step < 3; step++)
+    {
+        const auto* x = state.front<trivial::columns::x>();
+        auto* next_x  = state.back<trivial::columns::x>();
+        for (std::size_t i = 0; i < state.size(); i++)
+            next_x[i] = x[i] + 1.0f;
+        state.swap_buffers();
+    }
+    CHECK(state.front<trivial::columns::x>() == x_back); // odd number of swaps
+    CHECK(state.back<trivial::columns::x>() == x_front);
+    CHECK(state.front<trivial::columns::x>()[42] == 45.0f);
+    CHECK(state.front<trivial::columns::flags>()[42] == 42u);
+
+    state.sync_back();
+    CHECK(state.back<trivial::columns::x>()[42] == 45.0f);
+
+    // growing keeps both buffers in one allocation with identical capacity
+    const auto cap = state.capacity();
+    state.reserve(cap * 4u);
+    CHECK(state.capacity() >= cap * 4u);
+    CHECK(state.front<trivial::columns::x>()[99] == 102.0f);
+    CHECK(state.back<trivial::columns::x>()[99] == 102.0f);
+
+    state.pop_back(50);
+    CHECK(state.size() == 50u);
+    state.clear();
+    CHECK(state.empty());
+}
+
+TEST_CASE("double_buffered - every column", "[double_buffered]")
+{
+    soagen::double_buffered<rich> state;
+    static_assert(decltype(state)::table_type::table_traits::column_count == 10u);
+
+    std::string name = "name 0";
+    state.emplace_back(name, 1ull, std::tuple<int, int, int>{ 1, 2, 3 }, 100, nullptr);
+    state.emplace_back(std::string{ "name 1" }, 2ull, std::tuple<int, int, int>{ 4, 5, 6 }, 200, nullptr);
+
+    CHECK(state.front<rich::columns::name>()[1] == "name 1");
+    CHECK(state.back<rich::columns::name>()[1] == "name 1");
+
+    state.back<rich::columns::salary>()[0] = 150;
+    state.swap_buffers();
+    CHECK(state.front<rich::columns::salary>()[0] == 150);
+    CHECK(state.back<rich::columns::salary>()[0] == 100);
+    CHECK(state.front<rich::columns::name>()[0] == "name 0");
+}
@@ -0,0 +1,175 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <list>
+#include <vector>
+
+using namespace tests;
+
+TEST_CASE("fill - fill", "[fill]")
+{
+    auto t = make_trivial(100);
+
+    // all the bytes the same (memset)
+    t.fill<trivial::columns::x>(0.0f);
+    t.fill<trivial::columns::flags>(0xABABABABu);
+    for (std::size_t i = 0; i < t.size(); i++)
+    {
+        CHECK(t.x()[i] == 0.0f);
+        CHECK(t.flags()[i] == 0xABABABABu);
+        CHECK(t.y()[i] == static_cast<float>(i) + 1.0f);
+    }
+
+    // a sub-range, with an implicit conversion (int -> float)
+    t.fill<trivial::columns::y>(7, 10, 5);
+    CHECK(t.y()[9] == 10.0f);
+    CHECK(t.y()[10] == 7.0f);
+    CHECK(t.y()[14] == 7.0f);
+    CHECK(t.y()[15] == 16.0f);
+
+    // count is clamped to the end of the table
+    t.fill<trivial::columns::z>(-1.5f, 95, 1000);
+    CHECK(t.z()[94] == 96.0f);
+    CHECK(t.z()[95] == -1.5f);
+    CHECK(t.z()[99] == -1.5f);
+
+    // the value may be one of the column's own elements
+    t.fill<trivial::columns::z>(t.z()[50]);
+    for (std::size_t i = 0; i < t.size(); i++)
+        CHECK(t.z()[i] == 52.0f);
+
+    // spans are relative to their start
+    auto s = t.subspan(20, 10);
+    s.fill<trivial::columns::x>(3.0f);
+    s.fill<trivial::columns::flags>(1u, 8);
+    CHECK(t.x()[19] == 0.0f);
+    CHECK(t.x()[20] == 3.0f);
+    CHECK(t.x()[29] == 3.0f);
+    CHECK(t.x()[30] == 0.0f);
+    CHECK(t.flags()[27] == 0xABABABABu);
+    CHECK(t.flags()[28] == 1u);
+    CHECK(t.flags()[29] == 1u);
+    CHECK(t.flags()[30] == 0xABABABABu);
+
+    // non-trivial columns
+    auto r = make_rich(10);
+    r.fill<rich::columns::name>(std::string{ "anonymous" }, 5);
+    r.fill<rich::columns::date_of_birth>(std::tuple{ 2000, 2, 29 });
+    CHECK(r.name()[4] == "name 4");
+    CHECK(r.name()[5] == "anonymous");
+    CHECK(r.name()[9] == "anonymous");
+    CHECK(r.date_of_birth()[0] == std::tuple{ 2000, 2, 29 });
+    CHECK(r.date_of_birth()[9] == std::tuple{ 2000, 2, 29 });
+
+    // tables keep their indexes up-to-date
+    entities e;
+    for (unsigned i = 0; i < 10u; i++)
+        e.push_back(i, "e" + std::to_string(i));
+    e.fill<entities::columns::id>(42u, 8);
+    CHECK(e.find(7u) == 7u);
+    CHECK(!e.find(8u));
+    CHECK(e.find(42u));
+}
+
+TEST_CASE("fill - assign_column", "[fill]")
+{
+    auto t = make_trivial(10);
+
+    // contiguous (memmove)
+    const std::vector<float> xs{ 10.0f, 11.0f, 12.0f, 13.0f };
+    t.assign_column<trivial::columns::x>(xs);
+    t.assign_column<trivial::columns::y>(xs, 6);
+    CHECK(t.x()[0] == 10.0f);
+    CHECK(t.x()[3] == 13.0f);
+    CHECK(t.x()[4] == 4.0f);
+    CHECK(t.y()[5] == 6.0f);
+    CHECK(t.y()[6] == 10.0f);
+    CHECK(t.y()[9] == 13.0f);
+
+    // anything else iterable (element-wise)
+    const std::list<unsigned> flags{ 7u, 8u, 9u };
+    t.assign_column<trivial::columns::flags>(flags, 1);
+    CHECK(t.flags()[0] == 0u);
+    CHECK(t.flags()[1] == 7u);
+    CHECK(t.flags()[3] == 9u);
+    CHECK(t.flags()[4] == 4u);
+
+    const std::vector<int> ints{ 1, 2 };
+    t.assign_column<trivial::columns::z>(ints);
+    CHECK(t.z()[0] == 1.0f);
+    CHECK(t.z()[1] == 2.0f);
+    CHECK(t.z()[2] == 4.0f);
+
+    // spans
+    t.subspan(8).assign_column<trivial::columns::z>(std::vector<float>{ -1.0f, -2.0f });
+    CHECK(t.z()[7] == 9.0f);
+    CHECK(t.z()[8] == -1.0f);
+    CHECK(t.z()[9] == -2.0f);
+
+    // non-trivial columns
+    auto r = make_rich(3);
+    const std::vector<std::tuple<int, int, int>> dates{ { 1, 2, 3 }, { 4, 5, 6 } };
+    r.assign_column<rich::columns::date_of_birth>(dates, 1);
+    CHECK(r.date_of_birth()[0] == std::tuple{ 1970, 1, 1 });
+    CHECK(r.date_of_birth()[1] == std::tuple{ 1, 2, 3 });
+    CHECK(r.date_of_birth()[2] == std::tuple{ 4, 5, 6 });
+}
+
+TEST_CASE("fill - resize with values", "[fill]")
+{
+    auto t = make_trivial(3);
+    t.resize(100, 1.0f, 2.0f, 0.0f, 0x01010101u);
+    REQUIRE(t.size() == 100u);
+    CHECK(t.x()[2] == 2.0f);
+    for (std::size_t i = 3; i < t.size(); i++)
+    {
+        CHECK(t.x()[i] == 1.0f);
+        CHECK(t.y()[i] == 2.0f);
+        CHECK(t.z()[i] == 0.0f);
+        CHECK(t.flags()[i] == 0x01010101u);
+    }
+
+    // shrinking ignores the values
+    t.resize(10, 5.0f, 5.0f, 5.0f, 5u);
+    REQUIRE(t.size() == 10u);
+    CHECK(t.x()[9] == 1.0f);
+
+    // tables directly
+    soagen::table<soagen::table_traits<double, std::string>> table;
+    table.resize(5, 0.5, "five");
+    REQUIRE(table.size() == 5u);
+    CHECK(table.column<0>()[4] == 0.5);
+    CHECK(table.column<1>()[4] == "five");
+
+    // indexes
+    entities e;
+    e.resize(4, 9u, "nine", 1.0f);
+    CHECK(e.size() == 4u);
+    CHECK(e.find(9u));
+    CHECK(e.x()[3] == 1.0f);
+
+#if SOAGEN_HAS_EXCEPTIONS
+    // strong guarantee
+    const int live = throwing::live;
+    {
+        auto f = make_fragile(2);
+        f.reserve(20);
+
+        throwing::arm(5);
+        CHECK_THROWS(f.resize(10, throwing{ 3 }, 30));
+        throwing::disarm();
+        CHECK(f.size() == 2u);
+        CHECK(throwing::live == live + 2);
+
+        f.resize(10, throwing{ 3 }, 30);
+        CHECK(f.size() == 10u);
+        CHECK(f.v()[1].value == 1);
+        CHECK(f.v()[9].value == 3);
+        CHECK(f.tag()[9] == 30);
+    }
+    CHECK(throwing::live == live);
+#endif
+}
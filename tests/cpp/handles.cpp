@@ -0,0 +1,168 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <random>
+
+using namespace tests;
+
+namespace
+{
+    // every row's handle must resolve back to that row
+    void check_handles(const actors& a)
+    {
+        bool ok = true;
+        for (std::size_t i = 0; i < a.size(); i++)
+            ok = ok && a.index_of(a.handle_of(i)) == i;
+        CHECK(ok);
+    }
+}
+
+static_assert(std::is_same_v<actors::handle_type, soagen::row_handle<actors>>);
+static_assert(!noexcept(std::declval<actors&>().push_back("")));
+
+// rewriting values can't invalidate handles
+static_assert(noexcept(std::declval<actors&>().fill<actors::columns::hp>(1)));
+static_assert(noexcept(std::declval<actors&>().swap_columns<actors::columns::hp, actors::columns::hp>()));
+
+TEST_CASE("handles", "[handles]")
+{
+    actors a;
+    CHECK(!actors::handle_type{});
+    CHECK(!a.index_of(actors::handle_type{}));
+    CHECK(!a.erase(actors::handle_type{}));
+
+    std::vector<actors::handle_type> handles;
+    for (int i = 0; i < 10; i++)
+        handles.push_back(a.emplace_back_handle("a" + std::to_string(i), i));
+    check_handles(a);
+    CHECK(a.index_of(handles[3]) == 3u);
+    CHECK(a.hp()[*a.index_of(handles[7])] == 7);
+
+    SECTION("erase by handle")
+    {
+        CHECK(a.erase(handles[2]));
+        CHECK(!a.contains(handles[2]));
+        CHECK(!a.erase(handles[2]));
+        CHECK(a.size() == 9u);
+
+        // the last row was moved into the hole; its handle followed it
+        CHECK(a.index_of(handles[9]) == 2u);
+        CHECK(a.name()[*a.index_of(handles[9])] == "a9");
+        check_handles(a);
+
+        // freed slots are recycled with a new generation
+        const auto h = a.emplace_back_handle("new");
+        CHECK(h.slot == handles[2].slot);
+        CHECK(h != handles[2]);
+        CHECK(!a.contains(handles[2]));
+        CHECK(a.index_of(h) == 9u);
+        CHECK(a.hp()[9] == 100);
+    }
+
+    SECTION("erase + insert by index")
+    {
+        a.erase(0);
+        a.insert(5, "inserted");
+        a.emplace(a.begin(), "front", -1);
+        check_handles(a);
+        CHECK(!a.contains(handles[0]));
+        CHECK(a.index_of(handles[1]) == 1u);
+        CHECK(a.index_of(handles[5]) == 5u);
+        CHECK(a.index_of(handles[9]) == 10u);
+    }
+
+    SECTION("pop_back + resize + clear")
+    {
+        a.pop_back(2);
+        CHECK(!a.contains(handles[8]));
+        CHECK(!a.contains(handles[9]));
+
+        a.resize(12);
+        a.resize_for_overwrite(14);
+        check_handles(a);
+
+        a.resize(4);
+        CHECK(!a.contains(handles[4]));
+        CHECK(a.contains(handles[3]));
+
+        a.clear();
+        for (auto h : handles)
+            CHECK(!a.contains(h));
+    }
+
+    SECTION("reallocation")
+    {
+        for (int i = 0; i < 1000; i++)
+            a.push_back("more");
+        a.shrink_to_fit();
+        CHECK(a.index_of(handles[4]) == 4u);
+        check_handles(a);
+    }
+
+    SECTION("copy + swap")
+    {
+        actors copy = a;
+        CHECK(copy.index_of(handles[3]) == 3u);
+
+        actors other;
+        const auto h = other.emplace_back_handle("other");
+        copy.swap(other);
+        CHECK(copy.index_of(h) == 0u);
+        CHECK(other.index_of(handles[5]) == 5u);
+    }
+}
+
+TEST_CASE("handles - stress", "[handles]")
+{
+    std::mt19937 rng{ 99u };
+    actors a;
+    std::vector<std::pair<actors::handle_type, int>> live; // handle + the hp stored with it
+    std::vector<actors::handle_type> dead;
+
+    for (int step = 0; step < 5000; step++)
+    {
+        const auto op = rng() % 6u;
+        if (op < 3u || live.empty())
+        {
+            live.emplace_back(a.emplace_back_handle("", step), step);
+        }
+        else if (op == 3u)
+        {
+            const auto i = rng() % live.size();
+            CHECK(a.erase(live[i].first));
+            dead.push_back(live[i].first);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else if (op == 4u)
+        {
+            const auto row = rng() % a.size();
+            const auto it  = std::find_if(live.begin(),
+                                         live.end(),
+                                         [&](const auto& l) { return l.first == a.handle_of(row); });
+            dead.push_back(it->first);
+            live.erase(it);
+            a.erase(row);
+        }
+        else
+        {
+            const auto row = rng() % a.size();
+            a.insert(row, "", -step);
+            live.emplace_back(a.handle_of(row), -step);
+        }
+    }
+
+    bool ok = true;
+    for (const auto& [h, hp] : live)
+    {
+        const auto index = a.index_of(h);
+        ok               = ok && index && a.hp()[*index] == hp;
+    }
+    for (const auto& h : dead)
+        ok = ok && !a.contains(h);
+    CHECK(ok);
+    CHECK(live.size() == a.size());
+    check_handles(a);
+}
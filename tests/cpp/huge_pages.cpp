@@ -0,0 +1,69 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstdint>
+
+using namespace tests;
+
+namespace
+{
+    using huge_table = soagen::table<trivial::table_traits, soagen::huge_page_allocator>;
+
+    bool aligned_to(const void* ptr, std::size_t alignment) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0u;
+    }
+}
+
+TEST_CASE("huge_page_allocator - allocation", "[huge_pages]")
+{
+    soagen::huge_page_allocator alloc;
+    static_assert(soagen::allocator_traits<soagen::huge_page_allocator>::column_alignment == 4096u);
+    static_assert(soagen::allocator_traits<soagen::allocator>::column_alignment == 0u);
+
+    auto small = alloc.allocate(100);
+    CHECK(aligned_to(small, soagen::huge_page_allocator::min_alignment));
+    alloc.deallocate(small, 100);
+
+    auto medium = alloc.allocate(10000);
+    CHECK(aligned_to(medium, soagen::huge_page_allocator::page_size));
+    alloc.deallocate(medium, 10000);
+
+    const auto big_size = soagen::huge_page_allocator::threshold * 2u + 123u;
+    auto big            = alloc.allocate(big_size, std::align_val_t{ 64 });
+#if SOAGEN_UNIX
+    CHECK(aligned_to(big, soagen::huge_page_allocator::huge_page_size));
+#endif
+    big[0]            = std::byte{ 1 };
+    big[big_size - 1] = std::byte{ 2 };
+    alloc.deallocate(big, big_size);
+}
+
+TEST_CASE("huge_page_allocator - page-aligned columns", "[huge_pages]")
+{
+    huge_table tbl;
+
+    // small tables stay packed
+    for (unsigned i = 0; i < 10; i++)
+        tbl.emplace_back(1.0f, 2.0f, 3.0f, i);
+    CHECK(static_cast<std::size_t>(reinterpret_cast<std::byte*>(tbl.column<1>())
+                                   - reinterpret_cast<std::byte*>(tbl.column<0>()))
+          < 4096u);
+
+    // once a column spans a page, every column starts on one
+    tbl.reserve(100000);
+    for (unsigned i = 10; i < 5000; i++)
+        tbl.emplace_back(static_cast<float>(i), 2.0f, 3.0f, i);
+    CHECK(aligned_to(tbl.column<0>(), 4096u));
+    CHECK(aligned_to(tbl.column<1>(), 4096u));
+    CHECK(aligned_to(tbl.column<2>(), 4096u));
+    CHECK(aligned_to(tbl.column<3>(), 4096u));
+    CHECK(tbl.column<0>()[4999] == 4999.0f);
+    CHECK(tbl.column<3>()[7] == 7u);
+
+    tbl.shrink_to_fit();
+    CHECK(tbl.column<3>()[4999] == 4999u);
+}
@@ -0,0 +1,473 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <random>
+
+using namespace tests;
+
+namespace
+{
+    // every id in the table must be findable, and must be found at a row that actually has that id
+    void check_hash_index(const entities& e)
+    {
+        for (std::size_t i = 0; i < e.size(); i++)
+        {
+            const auto found = e.find(e.id()[i]);
+            REQUIRE(found);
+            CHECK(e.id()[*found] == e.id()[i]);
+        }
+    }
+
+    // the sorted index must list every row exactly once, in non-descending timestamp order, with equal timestamps
+    // in ascending row order
+    void check_sorted_index(const events& e)
+    {
+        const auto all = e.range<events::columns::timestamp>(INT64_MIN, INT64_MAX);
+        REQUIRE(all.size() == e.size());
+
+        std::vector<bool> seen(e.size());
+        bool unique  = true;
+        bool ordered = true;
+        for (std::size_t i = 0; i < all.size(); i++)
+        {
+            if (all[i] >= e.size())
+                FAIL("row index out of range");
+            unique = unique && !seen[all[i]];
+            seen[all[i]] = true;
+            if (i)
+                ordered = ordered
+                       && (e.timestamp()[all[i - 1u]] < e.timestamp()[all[i]]
+                           || (e.timestamp()[all[i - 1u]] == e.timestamp()[all[i]] && all[i - 1u] < all[i]));
+        }
+        CHECK(unique);
+        CHECK(ordered);
+    }
+
+    // brute-force equivalent of matching()
+    template <auto Column>
+    soagen::row_bitset brute_force_matching(const units& u, int key)
+    {
+        soagen::row_bitset result{ u.size() };
+        for (std::size_t i = 0; i < u.size(); i++)
+            if (u.column<Column>()[i] == key)
+                result.set(i);
+        return result;
+    }
+
+    void check_bitmap_indexes(const units& u)
+    {
+        bool ok = true;
+        for (int key = 0; key < 8; key++)
+        {
+            ok = ok && u.matching<units::columns::kind>(key) == brute_force_matching<units::columns::kind>(u, key);
+            ok = ok && u.matching<units::columns::team>(key) == brute_force_matching<units::columns::team>(u, key);
+        }
+        CHECK(ok);
+    }
+
+    // brute-force equivalent of range()
+    std::size_t count_in_range(const events& e, std::int64_t lo, std::int64_t hi)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < e.size(); i++)
+            count += e.timestamp()[i] >= lo && e.timestamp()[i] < hi;
+        return count;
+    }
+}
+
+static_assert(!noexcept(std::declval<entities&>().push_back(1u, "")));
+static_assert(noexcept(std::declval<entities&>().pop_back()));
+
+TEST_CASE("indexes - hash", "[indexes]")
+{
+    entities e;
+    CHECK(!e.find(0u));
+
+    for (unsigned i = 0; i < 100u; i++)
+        e.push_back(i * 7u, "e" + std::to_string(i));
+    check_hash_index(e);
+    CHECK(e.find(14u) == 2u);
+    CHECK(e.find<entities::columns::id>(693u) == 99u);
+    CHECK(!e.find(1u));
+
+    SECTION("erase")
+    {
+        e.erase(10);
+        CHECK(!e.find(70u));
+        CHECK(e.find(77u) == 10u);
+        CHECK(e.find(693u) == 98u);
+        check_hash_index(e);
+    }
+
+    SECTION("unordered_erase")
+    {
+        CHECK(e.unordered_erase(10) == 99u);
+        CHECK(!e.find(70u));
+        CHECK(e.find(693u) == 10u);
+        CHECK(e.find(77u) == 11u);
+
+        e.unordered_erase(e.size() - 1u);
+        CHECK(!e.find(686u));
+        check_hash_index(e);
+    }
+
+    SECTION("insert")
+    {
+        e.insert(5, 1u, "one");
+        e.emplace(e.begin(), 2u, "two");
+        CHECK(e.find(1u) == 6u);
+        CHECK(e.find(2u) == 0u);
+        CHECK(e.find(693u) == 101u);
+        check_hash_index(e);
+    }
+
+    SECTION("pop_back + resize")
+    {
+        e.pop_back(10);
+        CHECK(!e.find(693u));
+        CHECK(e.find(623u) == 89u);
+
+        e.resize(95); // default-constructed rows all have id 0, same as row 0
+        CHECK(e.size() == 95u);
+        CHECK(e.id()[*e.find(0u)] == 0u);
+        e.resize(50);
+        CHECK(!e.find(350u));
+        check_hash_index(e);
+    }
+
+    SECTION("clear")
+    {
+        e.clear();
+        CHECK(!e.find(0u));
+        e.push_back(5u, "five");
+        CHECK(e.find(5u) == 0u);
+    }
+
+    SECTION("copy + swap")
+    {
+        entities other;
+        other.push_back(1000u, "thousand");
+
+        entities copy = e;
+        copy.swap(other);
+        CHECK(copy.find(1000u) == 0u);
+        CHECK(!copy.find(7u));
+        CHECK(other.find(7u) == 1u);
+        check_hash_index(other);
+    }
+
+    SECTION("append_from_aos")
+    {
+        std::vector<entities::value_type> src(300);
+        for (std::size_t i = 0; i < src.size(); i++)
+            src[i] = { 10000u + static_cast<unsigned>(i), "aos", 0.0f };
+
+        e.append_from_aos(src.data(), src.size());
+        CHECK(e.find(10299u) == 399u);
+        check_hash_index(e);
+    }
+
+    SECTION("rebuild_indexes")
+    {
+        e.id()[3] = 12345u; // modified in-place; the index doesn't know
+        e.rebuild_indexes();
+        CHECK(e.find(12345u) == 3u);
+        CHECK(!e.find(21u));
+    }
+}
+
+TEST_CASE("indexes - hash stress", "[indexes]")
+{
+    std::mt19937 rng{ 42u };
+    entities e;
+
+    for (int step = 0; step < 5000; step++)
+    {
+        const auto op = rng() % 8u;
+        if (op < 4u || e.empty())
+            e.push_back(static_cast<unsigned>(rng() % 2000u), "");
+        else if (op == 4u)
+            e.erase(rng() % e.size());
+        else if (op == 5u)
+            e.unordered_erase(rng() % e.size());
+        else if (op == 6u)
+            e.insert(rng() % e.size(), static_cast<unsigned>(rng() % 2000u), "");
+        else
+            e.pop_back(rng() % 3u);
+
+        if (step % 250 == 0)
+            check_hash_index(e);
+    }
+    check_hash_index(e);
+
+    // every key that can't be found really isn't in the table
+    std::vector<bool> present(2000u);
+    for (std::size_t i = 0; i < e.size(); i++)
+        present[e.id()[i]] = true;
+    for (unsigned key = 0; key < 2000u; key++)
+        CHECK(static_cast<bool>(e.find(key)) == present[key]);
+}
+
+TEST_CASE("indexes - sorted", "[indexes]")
+{
+    events e;
+    CHECK(e.range<events::columns::timestamp>(0, 100).empty());
+    CHECK(e.equal_range<events::columns::timestamp>(0).empty());
+
+    // appended in order, like a time-series
+    for (unsigned i = 0; i < 100u; i++)
+        e.push_back(static_cast<std::int64_t>(i / 2u) * 10, i);
+    check_sorted_index(e);
+
+    auto r = e.range<events::columns::timestamp>(100, 130);
+    REQUIRE(r.size() == 6u);
+    CHECK(std::vector<std::size_t>(r.begin(), r.end()) == std::vector<std::size_t>{ 20, 21, 22, 23, 24, 25 });
+    CHECK(e.range<events::columns::timestamp>(130, 100).empty());
+    CHECK(e.range<events::columns::timestamp>(1000, 2000).empty());
+
+    r = e.equal_range<events::columns::timestamp>(490);
+    REQUIRE(r.size() == 2u);
+    CHECK(r[0] == 98u);
+    CHECK(r[1] == 99u);
+    CHECK(e.equal_range<events::columns::timestamp>(491).empty());
+
+    CHECK(e.find<events::columns::timestamp>(250) == 50u);
+    CHECK(!e.find<events::columns::timestamp>(251));
+    CHECK(e.find<events::columns::id>(51u) == 51u);
+
+    SECTION("selection")
+    {
+        auto sel = soagen::selection<events>{ e, e.range<events::columns::timestamp>(0, 20) };
+        REQUIRE(sel.size() == 4u);
+        CHECK(sel[3].id == 3u);
+    }
+
+    SECTION("out-of-order")
+    {
+        e.push_back(15, 1000u);
+        e.insert(0, 495, 1001u);
+        e.emplace(10, -5, 1002u);
+        check_sorted_index(e);
+        CHECK(e.equal_range<events::columns::timestamp>(15).size() == 1u);
+        CHECK(e.timestamp()[e.range<events::columns::timestamp>(INT64_MIN, 0)[0]] == -5);
+        CHECK(e.id()[*e.find<events::columns::timestamp>(495)] == 1001u);
+    }
+
+    SECTION("erase")
+    {
+        e.erase(10);
+        e.unordered_erase(0);
+        e.pop_back(3);
+        check_sorted_index(e);
+        CHECK(e.equal_range<events::columns::timestamp>(50).size() == 1u);
+        CHECK(e.equal_range<events::columns::timestamp>(0).size() == 1u);
+        CHECK(e.range<events::columns::timestamp>(480, 500).size() == 1u);
+        CHECK(e.find<events::columns::id>(99u) == 0u);
+        CHECK(!e.find<events::columns::id>(96u));
+    }
+}
+
+TEST_CASE("indexes - sorted duplicates", "[indexes]")
+{
+    // lots of rows sharing a handful of timestamps, so every removal has to find its row among equal keys
+    events e;
+    for (unsigned i = 0; i < 1000u; i++)
+        e.push_back(static_cast<std::int64_t>(i % 4u), i);
+    check_sorted_index(e);
+
+    e.insert(3, 2, 1000u);
+    check_sorted_index(e);
+    CHECK(e.find<events::columns::timestamp>(2) == 2u);
+
+    e.unordered_erase(1);
+    check_sorted_index(e);
+    CHECK(e.equal_range<events::columns::timestamp>(0)[0] == 0u);
+    CHECK(e.equal_range<events::columns::timestamp>(3)[0] == 1u);
+
+    e.erase(0);
+    e.pop_back(10);
+    check_sorted_index(e);
+    CHECK(e.size() == 989u);
+    CHECK(e.equal_range<events::columns::timestamp>(0).size() + e.equal_range<events::columns::timestamp>(1).size()
+              + e.equal_range<events::columns::timestamp>(2).size()
+              + e.equal_range<events::columns::timestamp>(3).size()
+          == e.size());
+}
+
+TEST_CASE("indexes - sorted stress", "[indexes]")
+{
+    std::mt19937 rng{ 1234u };
+    events e;
+
+    for (int step = 0; step < 5000; step++)
+    {
+        const auto op = rng() % 8u;
+        const auto ts = static_cast<std::int64_t>(rng() % 1000u) - 500;
+        if (op < 4u || e.empty())
+            e.push_back(ts, static_cast<unsigned>(step));
+        else if (op == 4u)
+            e.erase(rng() % e.size());
+        else if (op == 5u)
+            e.unordered_erase(rng() % e.size());
+        else if (op == 6u)
+            e.insert(rng() % e.size(), ts, static_cast<unsigned>(step));
+        else
+            e.pop_back(rng() % 3u);
+
+        if (step % 250 == 0)
+        {
+            check_sorted_index(e);
+            const auto lo = static_cast<std::int64_t>(rng() % 1000u) - 500;
+            const auto hi = lo + static_cast<std::int64_t>(rng() % 200u);
+            CHECK(e.range<events::columns::timestamp>(lo, hi).size() == count_in_range(e, lo, hi));
+        }
+    }
+    check_sorted_index(e);
+}
+
+TEST_CASE("indexes - bitmap", "[indexes]")
+{
+    units u;
+    CHECK(u.matching<units::columns::kind>(0).none());
+    CHECK(!u.find<units::columns::kind>(0));
+
+    for (int i = 0; i < 200; i++)
+        u.push_back(i % 4, i % 3);
+    check_bitmap_indexes(u);
+
+    const auto kind1 = u.matching<units::columns::kind>(1);
+    const auto team2 = u.matching<units::columns::team>(2);
+    CHECK(kind1.size() == 200u);
+    CHECK(kind1.count() == 50u);
+    CHECK(u.find<units::columns::team>(2) == 2u);
+    CHECK(u.matching<units::columns::kind>(7).none());
+
+    // rows with kind 1 and team 2 are those where i % 12 == 5
+    const auto both = kind1 & team2;
+    std::vector<std::size_t> rows(both.begin(), both.end());
+    REQUIRE(rows.size() == 17u);
+    for (std::size_t i = 0; i < rows.size(); i++)
+        CHECK(rows[i] == i * 12u + 5u);
+
+    CHECK((kind1 | team2).count() == 50u + 66u - 17u);
+    CHECK((~kind1).count() == 150u);
+    CHECK((kind1 ^ kind1).none());
+
+    auto sel = soagen::selection<units>{ u, both };
+    CHECK(sel.size() == 17u);
+    CHECK(soagen::selection<units>::from_bitmask(u, both.words()).size() == 17u);
+
+    SECTION("insert + erase")
+    {
+        u.insert(0, 5, 5);
+        u.insert(70, 5, 6);
+        u.emplace(u.end() - 1, 1, 2);
+        check_bitmap_indexes(u);
+        CHECK(u.find<units::columns::kind>(5) == 0u);
+        CHECK(u.matching<units::columns::kind>(5).count() == 2u);
+
+        u.erase(0);
+        u.erase(69);
+        check_bitmap_indexes(u);
+        CHECK(u.matching<units::columns::kind>(5).none());
+        CHECK(!u.find<units::columns::team>(6));
+    }
+
+    SECTION("unordered_erase + pop_back")
+    {
+        u.unordered_erase(1);
+        u.unordered_erase(u.size() - 1u);
+        u.pop_back(63);
+        check_bitmap_indexes(u);
+        CHECK(u.size() == 135u);
+        CHECK(u.matching<units::columns::kind>(3).test(1));
+    }
+
+    SECTION("clear + swap")
+    {
+        units other;
+        other.push_back(7, 7);
+        other.swap(u);
+        CHECK(u.matching<units::columns::kind>(7).count() == 1u);
+        CHECK(other.matching<units::columns::kind>(1).count() == 50u);
+
+        other.clear();
+        CHECK(other.matching<units::columns::kind>(1).none());
+        other.push_back(1, 1);
+        CHECK(other.find<units::columns::kind>(1) == 0u);
+    }
+}
+
+TEST_CASE("indexes - bitmap stress", "[indexes]")
+{
+    std::mt19937 rng{ 777u };
+    units u;
+
+    for (int step = 0; step < 3000; step++)
+    {
+        const auto op   = rng() % 8u;
+        const auto kind = static_cast<int>(rng() % 8u);
+        const auto team = static_cast<int>(rng() % 3u);
+        if (op < 4u || u.empty())
+            u.push_back(kind, team);
+        else if (op == 4u)
+            u.erase(rng() % u.size());
+        else if (op == 5u)
+            u.unordered_erase(rng() % u.size());
+        else if (op == 6u)
+            u.insert(rng() % u.size(), kind, team);
+        else
+            u.pop_back(rng() % 3u);
+
+        if (step % 100 == 0)
+            check_bitmap_indexes(u);
+    }
+    check_bitmap_indexes(u);
+}
+
+#if SOAGEN_HAS_EXCEPTIONS
+
+TEST_CASE("indexes - bitmap exception safety", "[indexes]")
+{
+    const std::vector<throwing> keys{ throwing{ 1 }, throwing{ 2 }, throwing{ 3 } };
+
+    soagen::bitmap_index<throwing> idx;
+    idx.reserve(1u);
+    idx.push_back(keys.data(), 0u);
+
+    // a new value that fails to copy leaves the index as it was
+    idx.reserve(2u);
+    throwing::arm(0);
+    CHECK_THROWS(idx.push_back(keys.data(), 1u));
+    throwing::disarm();
+    CHECK(idx.size() == 1u);
+    CHECK(idx.cardinality() == 1u);
+    CHECK(idx.count(keys[0]) == 1u);
+    CHECK(idx.matching(keys[0]).size() == 1u);
+
+    // handing the value to reserve() copies it there, before the table would be modified
+    throwing::arm(0);
+    CHECK_THROWS(idx.reserve(2u, keys[1]));
+    throwing::disarm();
+    CHECK(idx.cardinality() == 1u);
+
+    idx.reserve(2u, keys[1]);
+    throwing::arm(0);
+    idx.push_back(keys.data(), 1u); // doesn't copy
+    throwing::disarm();
+    CHECK(idx.size() == 2u);
+    CHECK(idx.count(keys[1]) == 1u);
+    CHECK(idx.find(keys.data(), keys[1]) == 1u);
+
+    // a value added ahead of a table modification that then failed is dropped again by the next reserve()
+    idx.reserve(3u, keys[2]);
+    CHECK(idx.count(keys[2]) == 0u);
+    CHECK(!idx.find(keys.data(), keys[2]));
+    idx.reserve(3u);
+    CHECK(idx.cardinality() == 2u);
+}
+
+#endif
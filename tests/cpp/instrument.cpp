@@ -0,0 +1,163 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+// exercises the SOAGEN_INSTRUMENT table hooks and memory accounting. built standalone because enabling
+// instrumentation changes the definition of every table, so it can't share an executable with the other tests.
+
+#define SOAGEN_INSTRUMENT 1
+#include "soa.hpp"
+#include <cstdio>
+#include <map>
+
+namespace
+{
+    std::size_t counts[5] = {};
+    std::size_t last_new_capacity;
+    std::size_t last_rows;
+    bool named;
+
+    void hook(const soagen::table_event_info& info) noexcept
+    {
+        counts[static_cast<std::size_t>(info.event)]++;
+        last_new_capacity = info.new_capacity;
+        last_rows         = info.rows;
+        named             = info.type_name.find("table<") != std::string_view::npos
+               && info.layout_hash == soagen::detail::table_layout_hash<tests::trivial::table_traits>();
+    }
+
+    std::size_t count(soagen::table_event ev) noexcept
+    {
+        return counts[static_cast<std::size_t>(ev)];
+    }
+
+    std::map<const void*, std::ptrdiff_t> live_bytes;
+
+    void balance_hook(const soagen::table_event_info& info) noexcept
+    {
+        live_bytes[info.table] +=
+            static_cast<std::ptrdiff_t>(info.new_bytes) - static_cast<std::ptrdiff_t>(info.old_bytes);
+    }
+}
+
+int main()
+{
+    int failures = 0;
+    const auto check = [&](bool ok, const char* what)
+    {
+        if (!ok)
+        {
+            std::printf("FAILED: %s\n", what);
+            failures++;
+        }
+    };
+
+    check(soagen::set_table_hook(hook) == nullptr, "no previous hook");
+    {
+        tests::trivial t;
+        t.reserve(10);
+        check(count(soagen::table_event::allocate) == 1u, "allocate");
+        check(named, "type name and layout hash");
+
+        for (unsigned i = 0; i < 100; i++)
+            t.emplace_back(1.0f, 2.0f, 3.0f, i);
+        check(count(soagen::table_event::reallocate) >= 1u, "reallocate");
+        check(last_new_capacity >= 100u, "new capacity");
+
+        t.erase(10u);
+        check(count(soagen::table_event::erase_shift) == 1u, "erase_shift");
+        check(last_rows == 89u, "rows shifted");
+
+        t.resize(5);
+        t.shrink_to_fit();
+        check(count(soagen::table_event::shrink) == 1u, "shrink");
+    }
+    check(count(soagen::table_event::deallocate) == 1u, "deallocate");
+
+    check(soagen::set_table_hook(nullptr) == hook, "previous hook");
+    {
+        tests::trivial t;
+        t.reserve(10);
+    }
+    check(count(soagen::table_event::allocate) == 1u, "hook removed");
+
+    // memory accounting
+    {
+        check(soagen::memory_stats<tests::trivial>().tables == 0u, "no live tables");
+
+        tests::trivial a;
+        tests::trivial b;
+        for (unsigned i = 0; i < 10; i++)
+            a.emplace_back(1.0f, 2.0f, 3.0f, i);
+        b.reserve(100);
+        auto c = a;
+        auto d = std::move(c);
+
+        const auto stats = soagen::memory_stats<tests::trivial>();
+        check(stats.tables == 4u, "live tables");
+        check(stats.rows == 20u, "rows");
+        check(stats.capacity == a.capacity() + b.capacity() + d.capacity(), "capacity");
+        check(stats.bytes == a.allocation_size() + b.allocation_size() + d.allocation_size(), "bytes");
+        check(stats.padding_bytes < stats.bytes, "padding");
+
+        const auto json = soagen::memory_report_json();
+        check(json.rfind("{\"tables\":[", 0) == 0u, "json prefix");
+        check(json.find("\"rows\":20") != std::string::npos, "json rows");
+    }
+    check(soagen::memory_stats<tests::trivial>().tables == 0u, "tables unregistered");
+
+    // buffers changing hands (copies, moves, swaps, exchanged columns) are reported too, so a running total kept
+    // per table from the events always matches the table's buffers
+    soagen::set_table_hook(balance_hook);
+    {
+        using table         = soagen::table_type<tests::trivial>;
+        const auto balanced = [](const tests::trivial& t)
+        {
+            const auto& tbl = static_cast<const table&>(t);
+            return live_bytes[&tbl] == static_cast<std::ptrdiff_t>(soagen::detail::table_allocation_bytes(tbl));
+        };
+
+        tests::trivial a;
+        tests::trivial b;
+        for (unsigned i = 0; i < 10; i++)
+            a.emplace_back(1.0f, 2.0f, 3.0f, i);
+        b.reserve(100);
+
+        auto c = a;
+        check(balanced(a) && balanced(c), "copy construction");
+
+        auto d = std::move(c);
+        check(balanced(c) && balanced(d), "move construction");
+
+        b = std::move(d);
+        check(balanced(b) && balanced(d), "move assignment");
+
+        c = a;
+        check(balanced(c), "copy assignment");
+
+        a.swap(b);
+        check(balanced(a) && balanced(b), "swap");
+
+        tests::trivial e;
+        e.reserve(a.capacity());
+        e.resize(a.size());
+        soagen::exchange_column<tests::trivial::columns::x>(a, e);
+        check(balanced(a) && balanced(e), "exchange_column");
+
+        std::size_t bytes = {};
+        for (const auto& [tbl, tbl_bytes] : live_bytes)
+            bytes += static_cast<std::size_t>(tbl_bytes);
+        const auto stats = soagen::memory_stats<tests::trivial>();
+        check(stats.bytes == bytes, "bytes include exchanged columns");
+        check(stats.bytes > a.allocation_size() + b.allocation_size() + c.allocation_size() + e.allocation_size(),
+              "exchanged columns counted");
+    }
+    bool all_freed = true;
+    for (const auto& [tbl, bytes] : live_bytes)
+        all_freed = all_freed && !bytes;
+    check(all_freed, "all buffers freed");
+    soagen::set_table_hook(nullptr);
+
+    return failures ? 1 : 0;
+}
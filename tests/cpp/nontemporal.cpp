@@ -0,0 +1,108 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <vector>
+
+using namespace tests;
+
+namespace
+{
+    // trivially-copyable, but with a non-trivial default constructor
+    struct initialized
+    {
+        int a     = 7;
+        short b   = -3;
+        char c[6] = { 'a', 'b', 'c', 'd', 'e', 'f' };
+    };
+    static_assert(std::is_trivially_copyable_v<initialized>);
+    static_assert(!std::is_trivially_default_constructible_v<initialized>);
+    static_assert(sizeof(initialized) == 12u);
+
+    template <std::size_t Size>
+    void check_fill(std::size_t count)
+    {
+        std::vector<std::byte> value(Size);
+        for (std::size_t i = 0; i < Size; i++)
+            value[i] = static_cast<std::byte>(i * 7u + 1u);
+
+        // every misalignment of the destination relative to a 16-byte store
+        for (std::size_t offset = 0; offset < 16u; offset++)
+        {
+            std::vector<std::byte> buf(offset + Size * count + 16u, std::byte{ 0xFF });
+            soagen::detail::nontemporal_fill<Size>(buf.data() + offset, value.data(), count);
+
+            std::size_t mismatches = 0;
+            for (std::size_t i = 0; i < buf.size(); i++)
+            {
+                const auto in_range = i >= offset && i < offset + Size * count;
+                if (buf[i] != (in_range ? value[(i - offset) % Size] : std::byte{ 0xFF }))
+                    mismatches++;
+            }
+            CHECK(mismatches == 0u);
+        }
+    }
+}
+
+TEST_CASE("nontemporal - kernels", "[nontemporal]")
+{
+    for (std::size_t bytes : { 0u, 1u, 15u, 16u, 63u, 64u, 65u, 1000u, 4099u })
+    {
+        INFO("bytes " << bytes);
+        std::vector<std::byte> src(bytes + 16u);
+        for (std::size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<std::byte>(i * 13u);
+
+        for (std::size_t offset = 0; offset < 16u; offset += 3u)
+        {
+            std::vector<std::byte> dest(bytes + 32u, std::byte{ 0xFF });
+            soagen::detail::nontemporal_copy(dest.data() + offset, src.data() + (offset + 5u) % 16u, bytes);
+            CHECK(std::memcmp(dest.data() + offset, src.data() + (offset + 5u) % 16u, bytes) == 0);
+            CHECK(dest[offset + bytes] == std::byte{ 0xFF });
+        }
+    }
+
+    for (std::size_t count : { 0u, 1u, 2u, 5u, 64u, 333u })
+    {
+        INFO("count " << count);
+        check_fill<1>(count);
+        check_fill<2>(count);
+        check_fill<3>(count);
+        check_fill<8>(count);
+        check_fill<12>(count);
+        check_fill<16>(count);
+        check_fill<24>(count);
+    }
+}
+
+TEST_CASE("nontemporal - tables", "[nontemporal]")
+{
+    // big enough that every column crosses the threshold when it reallocates
+    constexpr std::size_t rows = soagen::detail::nontemporal_threshold / sizeof(float) + 1000u;
+
+    auto t = make_trivial(rows);
+    t.reserve(rows * 2u);
+    REQUIRE(t.size() == rows);
+    for (std::size_t i = 0; i < rows; i += 997u)
+    {
+        CHECK(t.x()[i] == static_cast<float>(i));
+        CHECK(t.flags()[i] == static_cast<unsigned>(i));
+    }
+    CHECK(t.z()[rows - 1u] == static_cast<float>(rows - 1u) + 2.0f);
+
+    using table_type = soagen::table<soagen::table_traits<initialized, double>>;
+    table_type init;
+    init.emplace_back(initialized{ 1, 2, { 'x' } }, 1.0);
+    init.resize(soagen::detail::nontemporal_threshold / sizeof(initialized) + 101u);
+    CHECK(init.column<0>()[0].a == 1);
+    for (std::size_t i = 1; i < init.size(); i += 331u)
+    {
+        CHECK(init.column<0>()[i].a == 7);
+        CHECK(init.column<0>()[i].b == -3);
+        CHECK(init.column<0>()[i].c[5] == 'f');
+    }
+    CHECK(init.column<0>()[init.size() - 1u].a == 7);
+    CHECK(init.column<0>()[init.size() - 1u].c[0] == 'a');
+}
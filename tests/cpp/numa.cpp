@@ -0,0 +1,93 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstdint>
+
+using namespace tests;
+
+TEST_CASE("numa_allocator", "[numa]")
+{
+    REQUIRE(soagen::numa_node_count() >= 1u);
+
+    soagen::numa_allocator none;
+    soagen::numa_allocator node0{ 0 };
+    CHECK(none.node() == -1);
+    CHECK(node0.node() == 0);
+    CHECK(none != node0);
+    CHECK(node0 == soagen::numa_allocator{ 0 });
+
+    for (auto size : { std::size_t{ 100 }, std::size_t{ 100000 } })
+    {
+        auto ptr = node0.allocate(size, std::align_val_t{ 64 });
+        CHECK(reinterpret_cast<std::uintptr_t>(ptr) % 64u == 0u);
+        ptr[0]        = std::byte{ 1 };
+        ptr[size - 1] = std::byte{ 2 };
+        node0.deallocate(ptr, size);
+    }
+
+    soagen::table<trivial::table_traits, soagen::numa_allocator> tbl{ soagen::numa_allocator{ 0 } };
+    for (unsigned i = 0; i < 10000; i++)
+        tbl.emplace_back(static_cast<float>(i), 0.0f, 0.0f, i);
+    CHECK(tbl.get_allocator().node() == 0);
+    CHECK(tbl.column<3>()[9999] == 9999u);
+}
+
+TEST_CASE("sharded_table", "[numa]")
+{
+    using sharded = soagen::sharded_table<trivial, 3, 4>;
+    static_assert(sharded::locate(0).shard == 0u);
+    static_assert(sharded::locate(4).shard == 1u);
+    static_assert(sharded::locate(13).shard == 0u);
+    static_assert(sharded::locate(13).index == 5u);
+    static_assert(sharded::row_index(0, 5) == 13u);
+
+    sharded tbl;
+    for (std::size_t s = 0; s < sharded::shard_count; s++)
+        CHECK(tbl.shard(s).get_allocator().node() == static_cast<int>(s % soagen::numa_node_count()));
+
+    tbl.reserve(50);
+    for (unsigned i = 0; i < 50; i++)
+        tbl.emplace_back(static_cast<float>(i), 0.0f, 0.0f, i);
+    REQUIRE(tbl.size() == 50u);
+    CHECK(tbl.shard(0).size() == 18u);
+    CHECK(tbl.shard(1).size() == 16u);
+    CHECK(tbl.shard(2).size() == 16u);
+
+    for (unsigned i = 0; i < 50; i++)
+        REQUIRE(tbl.get<trivial::columns::flags>(i) == i);
+
+    // per-shard scans see every row exactly once
+    unsigned sum = 0;
+    tbl.for_each_shard(
+        [&](std::size_t s, auto& shard)
+        {
+            for (std::size_t i = 0; i < shard.size(); i++)
+            {
+                CHECK(sharded::row_index(s, i) == shard.template column<3>()[i]);
+                sum += shard.template column<3>()[i];
+            }
+        });
+    CHECK(sum == 49u * 50u / 2u);
+
+    tbl.pop_back(10);
+    CHECK(tbl.size() == 40u);
+    CHECK(tbl.shard(0).size() == 16u);
+    CHECK(tbl.shard(1).size() == 12u);
+    CHECK(tbl.shard(2).size() == 12u);
+    CHECK(tbl.get<trivial::columns::flags>(39) == 39u);
+
+    // popping more rows than there are empties the table
+    tbl.pop_back(100);
+    CHECK(tbl.empty());
+    CHECK(tbl.shard(0).empty());
+    CHECK(tbl.shard(1).empty());
+    CHECK(tbl.shard(2).empty());
+    tbl.pop_back();
+    CHECK(tbl.empty());
+
+    tbl.clear();
+    CHECK(tbl.empty());
+}
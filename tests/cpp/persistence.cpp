@@ -0,0 +1,222 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+SOAGEN_DISABLE_WARNINGS;
+#include <cstddef>
+#include <cstdio>
+SOAGEN_ENABLE_WARNINGS;
+
+using namespace tests;
+
+namespace
+{
+    struct temp_file
+    {
+        const char* path;
+
+        ~temp_file() noexcept
+        {
+            std::remove(path);
+        }
+    };
+
+    // overwrites the row count and capacity in a saved file's header
+    void patch_row_count(const char* path, std::uint64_t row_count, std::uint64_t capacity)
+    {
+        auto f = std::fopen(path, "r+b");
+        REQUIRE(f);
+        REQUIRE(std::fseek(f, static_cast<long>(offsetof(soagen::persisted_header, row_count)), SEEK_SET) == 0);
+        REQUIRE(std::fwrite(&row_count, sizeof(row_count), 1u, f) == 1u);
+        REQUIRE(std::fseek(f, static_cast<long>(offsetof(soagen::persisted_header, capacity)), SEEK_SET) == 0);
+        REQUIRE(std::fwrite(&capacity, sizeof(capacity), 1u, f) == 1u);
+        std::fclose(f);
+    }
+
+    void check_trivial_rows(const trivial& t, std::size_t count)
+    {
+        REQUIRE(t.size() == count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            CHECK(t.x()[i] == f);
+            CHECK(t.y()[i] == f + 1.0f);
+            CHECK(t.z()[i] == f + 2.0f);
+            CHECK(t.flags()[i] == static_cast<unsigned>(i));
+        }
+    }
+}
+
+static_assert(soagen::schema_hash<trivial> == soagen::schema_hash<const trivial&>);
+static_assert(soagen::schema_hash<soagen::table<soagen::table_traits<int, double>>>
+              != soagen::schema_hash<soagen::table<soagen::table_traits<double, int>>>);
+
+TEST_CASE("persistence - save + map", "[persistence]")
+{
+    const temp_file file{ "soagen_test_persistence_map.bin" };
+
+    auto t = make_trivial(100);
+    t.reserve(1000); // capacity is not persisted
+    REQUIRE(soagen::save(t, file.path));
+
+    auto m = soagen::map<trivial>(file.path);
+    REQUIRE(m);
+    CHECK(!m.writable());
+    CHECK(m.size() == 100u);
+    check_trivial_rows(*m, 100u);
+    CHECK(m.get() == t);
+    CHECK(m->capacity() == 100u);
+
+    // moving keeps the rows alive
+    auto m2 = std::move(m);
+    CHECK(!m);
+    CHECK(m.empty());
+    REQUIRE(m2);
+    check_trivial_rows(m2.get(), 100u);
+    CHECK(m2.const_span().size() == 100u);
+
+    m2.close();
+    CHECK(!m2);
+    CHECK(m2.empty());
+}
+
+TEST_CASE("persistence - copy-on-write", "[persistence]")
+{
+    const temp_file file{ "soagen_test_persistence_cow.bin" };
+
+    REQUIRE(soagen::save(make_trivial(10), file.path));
+    {
+        auto m = soagen::map<trivial>(file.path, soagen::map_mode::copy_on_write);
+        REQUIRE(m);
+        CHECK(m.writable());
+        auto span = m.span();
+        span.flags()[3] = 42u;
+        CHECK(m->flags()[3] == 42u);
+    }
+
+    // changes are never written back
+    auto m = soagen::map<trivial>(file.path);
+    REQUIRE(m);
+    check_trivial_rows(*m, 10u);
+}
+
+TEST_CASE("persistence - load", "[persistence]")
+{
+    const temp_file file{ "soagen_test_persistence_load.bin" };
+
+    REQUIRE(soagen::save(make_trivial(33), file.path));
+
+    auto t = make_trivial(5);
+    REQUIRE(soagen::load(t, file.path));
+    check_trivial_rows(t, 33u);
+
+    // t is a regular table again; it can grow
+    t.push_back(1.0f, 2.0f, 3.0f, 4u);
+    CHECK(t.size() == 34u);
+}
+
+TEST_CASE("persistence - load rebuilds indexes", "[persistence]")
+{
+    const temp_file file{ "soagen_test_persistence_indexes.bin" };
+
+    events src;
+    for (unsigned i = 0; i < 10u; i++)
+        src.push_back(static_cast<std::int64_t>(i) * 10, i * 7u);
+    REQUIRE(soagen::save(src, file.path));
+
+    events e;
+    e.push_back(5, 14u); // must not survive the load
+    REQUIRE(soagen::load(e, file.path));
+    REQUIRE(e.size() == 10u);
+    CHECK(e.find<events::columns::id>(14u) == 2u);
+    CHECK(e.find<events::columns::id>(63u) == 9u);
+    CHECK(e.find<events::columns::timestamp>(90) == 9u);
+    CHECK(!e.find<events::columns::timestamp>(5));
+
+    // and are kept up-to-date afterwards
+    e.push_back(100, 1000u);
+    CHECK(e.find<events::columns::id>(1000u) == 10u);
+    CHECK(e.find<events::columns::timestamp>(100) == 10u);
+}
+
+TEST_CASE("persistence - empty tables", "[persistence]")
+{
+    const temp_file file{ "soagen_test_persistence_empty.bin" };
+
+    REQUIRE(soagen::save(trivial{}, file.path));
+
+    auto m = soagen::map<trivial>(file.path);
+    REQUIRE(m);
+    CHECK(m.empty());
+    CHECK(m.const_span().empty());
+
+    auto t = make_trivial(5);
+    REQUIRE(soagen::load(t, file.path));
+    CHECK(t.empty());
+}
+
+TEST_CASE("persistence - rejects incompatible files", "[persistence]")
+{
+    using table_a = soagen::table<soagen::table_traits<int, double>>;
+    using table_b = soagen::table<soagen::table_traits<double, int>>;
+
+    const temp_file file{ "soagen_test_persistence_reject.bin" };
+
+    table_a a;
+    a.emplace_back(1, 2.0);
+    REQUIRE(soagen::save(a, file.path));
+
+    CHECK(soagen::map<table_a>(file.path));
+    CHECK(!soagen::map<table_b>(file.path));
+
+    table_b b;
+    b.emplace_back(3.0, 4);
+    CHECK(!soagen::load(b, file.path));
+    CHECK(b.empty());
+
+    CHECK(!soagen::map<table_a>("soagen_test_persistence_does_not_exist.bin"));
+
+    // truncated
+    if (auto f = std::fopen(file.path, "wb"))
+    {
+        std::fputs("soagen", f);
+        std::fclose(f);
+    }
+    CHECK(!soagen::map<table_a>(file.path));
+    CHECK(!soagen::load(a, file.path));
+}
+
+TEST_CASE("persistence - rejects corrupted headers", "[persistence]")
+{
+    using table_type = soagen::table<soagen::table_traits<int, double>>;
+
+    const temp_file file{ "soagen_test_persistence_corrupt.bin" };
+
+    table_type a;
+    a.emplace_back(1, 2.0);
+    a.emplace_back(3, 4.0);
+    REQUIRE(soagen::save(a, file.path));
+    REQUIRE(soagen::map<table_type>(file.path));
+
+    // a row count that wraps around when multiplied by the column sizes
+    patch_row_count(file.path, (std::uint64_t{ 1 } << 61) + 1u, (std::uint64_t{ 1 } << 61) + 1u);
+    CHECK(!soagen::map<table_type>(file.path));
+    CHECK(!soagen::load(a, file.path));
+
+    // more rows than the data holds
+    patch_row_count(file.path, 1000u, 1000u);
+    CHECK(!soagen::map<table_type>(file.path));
+    CHECK(!soagen::load(a, file.path));
+
+    // capacity is always written equal to the row count
+    patch_row_count(file.path, 1u, 2u);
+    CHECK(!soagen::map<table_type>(file.path));
+    CHECK(!soagen::load(a, file.path));
+
+    patch_row_count(file.path, 2u, 2u);
+    CHECK(soagen::map<table_type>(file.path));
+    CHECK(soagen::load(a, file.path));
+    CHECK(a.size() == 2u);
+}
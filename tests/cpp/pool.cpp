@@ -0,0 +1,96 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstdint>
+#include <thread>
+
+using namespace tests;
+
+namespace
+{
+    using pool_table = soagen::table<trivial::table_traits, soagen::pool_allocator>;
+
+    bool aligned_to(const void* ptr, std::size_t alignment) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0u;
+    }
+}
+
+TEST_CASE("pool_allocator - recycling", "[pool]")
+{
+    soagen::pool_allocator alloc;
+    alloc.trim();
+    alloc.reset_stats();
+
+    auto p = alloc.allocate(100, std::align_val_t{ 64 });
+    CHECK(aligned_to(p, 64));
+    alloc.deallocate(p, 100);
+    CHECK(alloc.cached_bytes() == 128u); // rounded up to the size class
+
+    // same size class and a compatible alignment reuses the buffer
+    CHECK(alloc.allocate(120, std::align_val_t{ 32 }) == p);
+    CHECK(alloc.cached_bytes() == 0u);
+    alloc.deallocate(p, 120);
+
+    // a stricter alignment than the cached buffer has is a miss
+    auto q = alloc.allocate(100, std::align_val_t{ 8192 });
+    CHECK(aligned_to(q, 8192));
+    alloc.deallocate(q, 100);
+
+    auto stats = alloc.stats();
+    CHECK(stats.allocations == 3u);
+    CHECK(stats.deallocations == 3u);
+    CHECK(stats.hits >= 1u);
+    CHECK(stats.releases == 0u);
+
+    // alignments beyond the largest class never reuse a cached buffer, even one in that class
+    auto page = alloc.allocate(100, std::align_val_t{ 4096 });
+    alloc.deallocate(page, 100);
+    const auto hits = alloc.stats().hits;
+    auto strict     = alloc.allocate(100, std::align_val_t{ 16384 });
+    CHECK(strict != page);
+    CHECK(aligned_to(strict, 16384));
+    CHECK(alloc.stats().hits == hits);
+    alloc.deallocate(strict, 100);
+
+    // oversized buffers bypass the cache
+    auto big = alloc.allocate(size_t{ 4 } * 1024u * 1024u);
+    alloc.deallocate(big, size_t{ 4 } * 1024u * 1024u);
+    CHECK(alloc.stats().releases == 1u);
+
+    alloc.trim();
+    CHECK(alloc.cached_bytes() == 0u);
+}
+
+TEST_CASE("pool_allocator - table churn", "[pool]")
+{
+    soagen::pool_allocator::trim();
+    soagen::pool_allocator::reset_stats();
+
+    for (unsigned i = 0; i < 1000; i++)
+    {
+        pool_table tbl;
+        for (unsigned j = 0; j < 20; j++)
+            tbl.emplace_back(1.0f, 2.0f, 3.0f, j);
+        REQUIRE(aligned_to(tbl.data(), soagen::buffer_alignment<pool_table>));
+        REQUIRE(tbl.column<3>()[19] == 19u);
+    }
+
+    const auto stats = soagen::pool_allocator::stats();
+    CHECK(stats.allocations == stats.deallocations);
+    CHECK(stats.hit_rate() > 0.9);
+
+    // buffers freed by other threads land in their caches and are released when the thread exits
+    std::thread worker{ []
+                        {
+                            pool_table tbl;
+                            tbl.emplace_back(1.0f, 2.0f, 3.0f, 4u);
+                        } };
+    worker.join();
+    CHECK(soagen::pool_allocator::stats().releases >= 1u);
+
+    soagen::pool_allocator::trim();
+}
@@ -0,0 +1,74 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <vector>
+
+using namespace tests;
+
+TEST_CASE("prefetch - rows", "[prefetch]")
+{
+    auto t = make_trivial(100);
+
+    // every distance visits the same rows in the same order, including ones past the end and zero (disabled)
+    for (std::size_t distance : { 0u, 1u, 16u, 99u, 100u, 1000u })
+    {
+        INFO("distance " << distance);
+        unsigned i = 0;
+        for (auto&& row : soagen::prefetched(t, distance))
+        {
+            CHECK(row.x == static_cast<float>(i));
+            CHECK(row.flags == i);
+            i++;
+        }
+        CHECK(i == 100u);
+    }
+
+    // writes go through
+    for (auto&& row : soagen::prefetched(t, 8))
+        row.flags += 1u;
+    CHECK(t.flags()[0] == 1u);
+    CHECK(t.flags()[99] == 100u);
+
+    // a subset of columns
+    using subset = decltype(soagen::prefetched<trivial::columns::y, trivial::columns::z>(t, 4));
+    static_assert(std::is_same_v<subset::iterator::iterator_type, decltype(t.begin<1, 2>())>);
+    float sum = 0.0f;
+    for (auto&& row : soagen::prefetched<trivial::columns::y, trivial::columns::z>(t, 4))
+        sum += row.z - row.y;
+    CHECK(sum == 100.0f);
+
+    // empty
+    trivial empty;
+    auto range = soagen::prefetched(empty, 16);
+    CHECK(range.begin() == range.end());
+}
+
+TEST_CASE("prefetch - selections", "[prefetch]")
+{
+    auto t = make_trivial(100);
+    auto s = soagen::select<trivial::columns::flags>(t, [](unsigned f) { return f % 3u == 0u; });
+    REQUIRE(s.size() == 34u);
+
+    unsigned i = 0;
+    for (auto&& row : soagen::prefetched(s, 8))
+    {
+        CHECK(row.flags == i * 3u);
+        i++;
+    }
+    CHECK(i == 34u);
+
+    for (std::size_t distance : { 0u, 1u, 8u, 33u, 34u, 1000u })
+    {
+        INFO("distance " << distance);
+        std::vector<float> plain(s.size());
+        std::vector<float> prefetched(s.size());
+        const auto plain_end      = s.gather<trivial::columns::z>(plain.data());
+        const auto prefetched_end = s.gather<trivial::columns::z>(prefetched.data(), distance);
+        CHECK(plain_end == plain.data() + plain.size());
+        CHECK(prefetched_end == prefetched.data() + prefetched.size());
+        CHECK(plain == prefetched);
+    }
+}
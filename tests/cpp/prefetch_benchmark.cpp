@@ -0,0 +1,106 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+// compares plain and prefetching scans of a wide (10-column) table, and plain and prefetching selection gathers.
+// run with 'meson test --benchmark' (ideally in a release build); pass a row count to override the default.
+
+#include <soagen.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using wide = soagen::table<soagen::table_traits<double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double,
+                                                    double>>;
+
+    template <typename Func>
+    double best_of(int runs, Func&& func)
+    {
+        double best = 1e300;
+        for (int i = 0; i < runs; i++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            best           = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+    volatile double sink;
+
+    template <typename Row, std::size_t... Columns>
+    double row_sum(const Row& row, std::index_sequence<Columns...>)
+    {
+        return (row.template column<Columns>() + ...);
+    }
+
+    template <typename Range>
+    void sum_all(Range&& range)
+    {
+        double sum = 0.0;
+        for (auto&& row : range)
+            sum += row_sum(row, std::make_index_sequence<wide::table_traits::column_count>{});
+        sink = sum;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t rows = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 2000000u;
+    constexpr int runs     = 5;
+
+    wide table;
+    table.reserve(rows);
+    for (std::size_t i = 0; i < rows; i++)
+    {
+        const auto v = static_cast<double>(i);
+        table.emplace_back(v, v, v, v, v, v, v, v, v, v);
+    }
+
+    std::printf("%zu rows x %zu columns (%zu MiB)\n",
+                rows,
+                wide::table_traits::column_count,
+                table.allocation_size() / (1024u * 1024u));
+
+    std::printf("\nsequential scan of every column:\n");
+    std::printf("  %-12s %8.2f ms\n", "plain", best_of(runs, [&] { sum_all(table); }));
+    for (std::size_t distance : { 4u, 8u, 16u, 32u, 64u })
+    {
+        std::printf("  distance %-3zu %8.2f ms\n",
+                    distance,
+                    best_of(runs, [&] { sum_all(soagen::prefetched(table, distance)); }));
+    }
+
+    std::vector<std::size_t> indices(rows);
+    std::iota(indices.begin(), indices.end(), std::size_t{});
+    std::shuffle(indices.begin(), indices.end(), std::mt19937_64{ 42u });
+    const soagen::selection<wide> shuffled{ table, std::move(indices) };
+    std::vector<double> out(rows);
+
+    std::printf("\nrandom gather of one column:\n");
+    std::printf("  %-12s %8.2f ms\n", "plain", best_of(runs, [&] { shuffled.gather<3>(out.data()); }));
+    for (std::size_t distance : { 4u, 8u, 16u, 32u, 64u })
+    {
+        std::printf("  distance %-3zu %8.2f ms\n",
+                    distance,
+                    best_of(runs, [&] { shuffled.gather<3>(out.data(), distance); }));
+    }
+
+    return 0;
+}
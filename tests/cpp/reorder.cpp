@@ -0,0 +1,100 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <cstdint>
+
+using namespace tests;
+
+namespace
+{
+    using packed_traits = soagen::table_traits_type<packed>;
+
+    template <template <typename...> typename Traits>
+    using packed_layout = Traits<soagen::column_traits<bool>,
+                                 soagen::column_traits<float, 32>,
+                                 soagen::column_traits<std::uint16_t>,
+                                 soagen::column_traits<double>>;
+
+    using declared_traits = packed_layout<soagen::table_traits>;
+
+    static_assert(std::is_same_v<packed_traits, packed_layout<soagen::reordered_table_traits>>);
+    static_assert(soagen::is_table_traits<packed_traits>);
+
+    // most-aligned first, ties in declared order
+    static_assert(packed_traits::storage_order[0] == 1u);
+    static_assert(packed_traits::storage_order[1] == 3u);
+    static_assert(packed_traits::storage_order[2] == 2u);
+    static_assert(packed_traits::storage_order[3] == 0u);
+    static_assert(declared_traits::storage_order[0] == 0u);
+    static_assert(declared_traits::storage_order[3] == 3u);
+
+    // column indices are unaffected
+    static_assert(static_cast<std::size_t>(packed::columns::flag) == 0u);
+    static_assert(static_cast<std::size_t>(packed::columns::pos) == 1u);
+    static_assert(static_cast<std::size_t>(packed::columns::id) == 2u);
+    static_assert(static_cast<std::size_t>(packed::columns::mass) == 3u);
+    static_assert(std::is_same_v<packed::column_type<packed::columns::pos>, float>);
+
+    // the file format stays in declared order, so the layout hash doesn't change
+    static_assert(soagen::detail::table_layout_hash<packed_traits>()
+                  == soagen::detail::table_layout_hash<declared_traits>());
+
+    std::uintptr_t address(const void* ptr) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr);
+    }
+}
+
+TEST_CASE("reorder_storage - layout", "[reorder]")
+{
+    packed p;
+    for (unsigned i = 0; i < 100; i++)
+        p.emplace_back(i % 2u == 0u, static_cast<float>(i), static_cast<std::uint16_t>(i), i * 0.5);
+
+    // columns are stored most-aligned first
+    CHECK(address(p.pos()) == address(p.data()));
+    CHECK(address(p.pos()) < address(p.mass()));
+    CHECK(address(p.mass()) < address(p.id()));
+    CHECK(address(p.id()) < address(p.flag()));
+    CHECK(address(p.pos()) % 32u == 0u);
+    CHECK(address(p.mass()) % alignof(double) == 0u);
+
+    // ...but read back in declared order
+    for (unsigned i = 0; i < 100; i++)
+    {
+        CHECK(p.flag()[i] == (i % 2u == 0u));
+        CHECK(p.pos()[i] == static_cast<float>(i));
+        CHECK(p.id()[i] == static_cast<std::uint16_t>(i));
+        CHECK(p[i].mass == i * 0.5);
+    }
+
+    // and the buffer needs less padding than the declared order would
+    soagen::table<declared_traits> declared;
+    declared.reserve(p.capacity());
+    CHECK(declared.capacity() == p.capacity());
+    CHECK(p.allocation_size() < declared.allocation_size());
+}
+
+TEST_CASE("reorder_storage - growth and erasure", "[reorder]")
+{
+    packed p;
+    for (unsigned i = 0; i < 1000; i++)
+        p.push_back(false, static_cast<float>(i), static_cast<std::uint16_t>(i), static_cast<double>(i));
+    p.erase(0);
+    p.shrink_to_fit();
+
+    REQUIRE(p.size() == 999u);
+    for (unsigned i = 0; i < p.size(); i++)
+    {
+        CHECK(p.pos()[i] == static_cast<float>(i + 1u));
+        CHECK(p.id()[i] == static_cast<std::uint16_t>(i + 1u));
+        CHECK(p.mass()[i] == static_cast<double>(i + 1u));
+    }
+
+    packed copy = p;
+    CHECK(copy == p);
+    CHECK(address(copy.pos()) == address(copy.data()));
+}
@@ -0,0 +1,144 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+TEST_CASE("selection - index list", "[selection]")
+{
+    auto r = make_rich(5);
+    auto s = soagen::selection<rich>{ r, { 4u, 1u, 3u } };
+    static_assert(soagen::is_selection<decltype(s)>);
+    static_assert(std::is_same_v<soagen::soa_type<decltype(s)>, rich>);
+
+    REQUIRE(s.size() == 3u);
+    CHECK(!s.empty());
+    CHECK(s.source() == &r);
+    CHECK(s.source_index(1) == 1u);
+    CHECK_RICH_ROW(s.front(), "name 4", 4, (1974, 1, 1), 4000, nullptr);
+    CHECK_RICH_ROW(s[1], "name 1", 1, (1971, 1, 1), 1000, nullptr);
+    CHECK_RICH_ROW(s.back(), "name 3", 3, (1973, 1, 1), 3000, nullptr);
+    CHECK(s.row<rich::columns::salary>(0).salary == 4000);
+#if SOAGEN_HAS_EXCEPTIONS
+    CHECK_RICH_ROW(s.at(2), "name 3", 3, (1973, 1, 1), 3000, nullptr);
+    CHECK_THROWS_AS(s.at(3), std::out_of_range);
+#endif
+
+    // writes go through to the source
+    s[0].salary = 42;
+    CHECK(r.salary()[4] == 42);
+
+    // empty
+    soagen::selection<rich> e;
+    CHECK(e.empty());
+    CHECK(e.begin() == e.end());
+    CHECK(e.reduce<rich::columns::salary>(7, std::plus<>{}) == 7);
+
+    // selecting from an empty table
+    rich none;
+    CHECK(soagen::select(none, [](auto&&) { return true; }).empty());
+    CHECK(soagen::select<rich::columns::id>(none, [](auto) { return true; }).empty());
+    CHECK(soagen::selection<rich>::from_bitmask(none, nullptr).empty());
+}
+
+TEST_CASE("selection - iteration", "[selection]")
+{
+    auto r = make_rich(5);
+    auto s = soagen::selection<rich>{ r, std::vector<std::size_t>{ 0u, 2u, 4u } };
+
+    std::vector<std::string> names;
+    for (auto&& row : s)
+        names.push_back(row.name);
+    REQUIRE(names.size() == 3u);
+    CHECK(names[0] == "name 0");
+    CHECK(names[1] == "name 2");
+    CHECK(names[2] == "name 4");
+
+    CHECK(s.end() - s.begin() == 3);
+    CHECK(s.begin()[2].salary == 4000);
+    CHECK((s.begin() + 1)->salary == 2000);
+    CHECK((s.begin() + 1).source_index() == 2u);
+    CHECK(s.cbegin<rich::columns::id>()->id == 0u);
+
+    auto it = s.begin<rich::columns::salary, rich::columns::name>();
+    CHECK(it->salary == 0);
+    ++it;
+    CHECK(it->name == "name 2");
+}
+
+TEST_CASE("selection - from span", "[selection]")
+{
+    auto r    = make_rich(6);
+    auto span = r.subspan(2u, 3u);
+    auto s    = soagen::selection<rich>{ span, { 0u, 2u } };
+    REQUIRE(s.size() == 2u);
+    CHECK(s.source_index(0) == 2u);
+    CHECK(s.source_index(1) == 4u);
+    CHECK_RICH_ROW(s.back(), "name 4", 4, (1974, 1, 1), 4000, nullptr);
+}
+
+TEST_CASE("selection - bitmask", "[selection]")
+{
+    auto r = make_trivial(130);
+
+    std::uint64_t mask[3] = { 0b1011u, 0u, ~std::uint64_t{} };
+    mask[1]               = std::uint64_t{ 1 } << 63;
+    auto s                = soagen::selection<trivial>::from_bitmask(r, mask);
+    REQUIRE(s.size() == 3u + 1u + 2u); // bits past the end of the table are ignored
+    CHECK(s.source_index(0) == 0u);
+    CHECK(s.source_index(1) == 1u);
+    CHECK(s.source_index(2) == 3u);
+    CHECK(s.source_index(3) == 127u);
+    CHECK(s.source_index(4) == 128u);
+    CHECK(s.source_index(5) == 129u);
+
+    auto span = r.subspan(64u);
+    auto s2   = soagen::selection<trivial>::from_bitmask(span, mask);
+    REQUIRE(s2.size() == 3u); // only the low 2 bits of mask[1] are within the span
+    CHECK(s2.source_index(0) == 64u);
+    CHECK(s2.source_index(2) == 67u);
+}
+
+TEST_CASE("selection - select, filter, gather, reduce", "[selection]")
+{
+    auto t = make_trivial(10);
+
+    auto even = soagen::select<trivial::columns::flags>(t, [](unsigned f) { return f % 2u == 0u; });
+    REQUIRE(even.size() == 5u);
+    CHECK(even.back().flags == 8u);
+
+    auto big = even.filter<trivial::columns::x>([](float x) { return x > 3.0f; });
+    REQUIRE(big.size() == 3u);
+    CHECK(big.front().flags == 4u);
+    CHECK(even.size() == 5u);
+
+    auto not_six = big.filter([](auto&& row) { return row.flags != 6u; });
+    REQUIRE(not_six.size() == 2u);
+    CHECK(not_six.source_index(1) == 8u);
+
+    float ys[3] = {};
+    auto end    = big.gather<trivial::columns::y>(ys);
+    CHECK(end == ys + 3);
+    CHECK(ys[0] == 5.0f);
+    CHECK(ys[1] == 7.0f);
+    CHECK(ys[2] == 9.0f);
+
+    CHECK(big.reduce<trivial::columns::flags>(0u, std::plus<>{}) == 4u + 6u + 8u);
+
+    auto rows = soagen::select(t, [](auto&& row) { return row.x < 2.0f; });
+    CHECK(rows.size() == 2u);
+
+    auto span    = t.subspan(5u);
+    auto in_span = soagen::select<trivial::columns::flags>(span, [](unsigned f) { return f < 7u; });
+    REQUIRE(in_span.size() == 2u);
+    CHECK(in_span.source_index(0) == 5u);
+    CHECK(in_span.source_index(1) == 6u);
+
+    const auto& ct = t;
+    auto cs        = soagen::select(ct, [](auto&&) { return true; });
+    static_assert(std::is_same_v<decltype(cs), soagen::selection<const trivial>>);
+    CHECK(cs.size() == 10u);
+}
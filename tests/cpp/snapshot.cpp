@@ -0,0 +1,146 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+#include <thread>
+
+using namespace tests;
+
+namespace
+{
+    using cow = soagen::cow_table<trivial, 4>; // tiny chunks so the tests cross chunk boundaries
+
+    void push_rows(cow& t, unsigned first, unsigned count)
+    {
+        for (unsigned i = first; i < first + count; i++)
+            t.emplace_back(static_cast<float>(i), 0.0f, 0.0f, i);
+    }
+
+    template <typename T>
+    bool holds_sequence(const T& t, unsigned count)
+    {
+        bool ok = t.size() == count;
+        for (unsigned i = 0; ok && i < count; i++)
+            ok = t.template get<trivial::columns::flags>(i) == i
+              && t.template get<trivial::columns::x>(i) == static_cast<float>(i);
+        return ok;
+    }
+}
+
+TEST_CASE("cow_table - basic operations", "[snapshot]")
+{
+    cow t;
+    CHECK(t.empty());
+
+    push_rows(t, 0, 10);
+    CHECK(holds_sequence(t, 10));
+
+    t.set<trivial::columns::y>(5, 2.5f);
+    CHECK(t.get<trivial::columns::y>(5) == 2.5f);
+
+    t.pop_back(3);
+    CHECK(holds_sequence(t, 7));
+    push_rows(t, 7, 2);
+    CHECK(holds_sequence(t, 9));
+
+    t.clear();
+    CHECK(t.empty());
+
+    trivial src;
+    for (unsigned i = 0; i < 6; i++)
+        src.push_back(static_cast<float>(i), 0.0f, 0.0f, i);
+    CHECK(holds_sequence(cow{ src }, 6));
+}
+
+TEST_CASE("cow_table - snapshots are isolated from later writes", "[snapshot]")
+{
+    cow t;
+    push_rows(t, 0, 6);
+
+    const auto snap = t.snapshot();
+    CHECK(snap.chunk_count() == 2u);
+    CHECK(snap.chunk_size(1) == 2u);
+    CHECK(snap.chunk<trivial::columns::flags>(1)[1] == 5u);
+
+    t.set<trivial::columns::x>(1, -1.0f); // shared chunk -> copied
+    push_rows(t, 6, 5);                   // appends into the shared partial chunk
+    t.pop_back(9);                        // destroys rows the snapshot can see
+
+    CHECK(holds_sequence(snap, 6));
+    CHECK(t.size() == 2u);
+    CHECK(t.get<trivial::columns::x>(1) == -1.0f);
+
+    // the original table isn't affected by the snapshot going away, and vice-versa
+    auto snap2 = t.snapshot();
+    t.clear();
+    CHECK(snap2.size() == 2u);
+    CHECK(snap2.get<trivial::columns::x>(1) == -1.0f);
+}
+
+TEST_CASE("cow_table - strong exception guarantee", "[snapshot]")
+{
+    const int live_before = throwing::live;
+    {
+        soagen::cow_table<fragile, 4> t;
+        for (int i = 0; i < 6; i++)
+            t.emplace_back(throwing{ i }, i);
+
+        const auto snap = t.snapshot();
+
+        throwing::arm(1); // the copy of the shared chunk fails partway through
+        CHECK_THROWS(t.set<fragile::columns::v>(2, throwing{ 100 }));
+        throwing::disarm();
+
+        CHECK(t.get<fragile::columns::v>(2).value == 2);
+        CHECK(snap.get<fragile::columns::v>(2).value == 2);
+
+        t.set<fragile::columns::v>(2, throwing{ 100 });
+        CHECK(t.get<fragile::columns::v>(2).value == 100);
+        CHECK(snap.get<fragile::columns::v>(2).value == 2);
+        CHECK(snap.get<fragile::columns::v>(5).value == 5);
+    }
+    CHECK(throwing::live == live_before);
+}
+
+TEST_CASE("cow_table - concurrent readers", "[snapshot]")
+{
+    cow t;
+    soagen::cow_snapshot<trivial, 4> shared_snap = t.snapshot();
+    std::atomic<bool> done = false;
+    std::atomic<unsigned> published = 0;
+    bool reader_ok = true;
+
+    // the writer hands snapshots to the reader through an atomic counter; each one must hold exactly that many rows,
+    // no matter what the writer did to the table afterwards
+    std::vector<soagen::cow_snapshot<trivial, 4>> snaps(64);
+    std::thread reader{ [&]
+                        {
+                            unsigned seen = 0;
+                            while (!done.load() || seen < published.load())
+                            {
+                                while (seen < published.load())
+                                {
+                                    const auto& s = snaps[seen];
+                                    reader_ok     = reader_ok && holds_sequence(s, seen * 8u);
+                                    seen++;
+                                }
+                            }
+                        } };
+
+    for (unsigned i = 0; i < 64; i++)
+    {
+        snaps[i] = t.snapshot();
+        published.store(i + 1u);
+        push_rows(t, i * 8u, 8);
+        for (unsigned row = 0; row < t.size(); row += 3)
+            t.set<trivial::columns::z>(row, static_cast<float>(i));
+    }
+    done.store(true);
+    reader.join();
+
+    CHECK(reader_ok);
+    CHECK(holds_sequence(t, 64u * 8u));
+    CHECK(shared_snap.empty());
+}
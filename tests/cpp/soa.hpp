@@ -41,12 +41,18 @@ SOAGEN_DISABLE_SPAM_WARNINGS;
 
 namespace tests
 {
+	class actors;
 	class collide;
+	class entities;
+	class events;
 	class fragile;
 	class fragile2;
 	class move_only;
+	class packed;
 	class rich;
 	class trivial;
+	class units;
+	class vec4;
 }
 
 namespace soagen::detail
@@ -71,6 +77,11 @@ namespace soagen::detail
 		SOAGEN_MAKE_NAME(date_of_birth);
 	#endif
 
+	#ifndef SOAGEN_NAME_flag
+		#define SOAGEN_NAME_flag
+		SOAGEN_MAKE_NAME(flag);
+	#endif
+
 	#ifndef SOAGEN_NAME_flags
 		#define SOAGEN_NAME_flags
 		SOAGEN_MAKE_NAME(flags);
@@ -86,16 +97,36 @@ namespace soagen::detail
 		SOAGEN_MAKE_NAME(foo_bar);
 	#endif
 
+	#ifndef SOAGEN_NAME_hp
+		#define SOAGEN_NAME_hp
+		SOAGEN_MAKE_NAME(hp);
+	#endif
+
 	#ifndef SOAGEN_NAME_id
 		#define SOAGEN_NAME_id
 		SOAGEN_MAKE_NAME(id);
 	#endif
 
+	#ifndef SOAGEN_NAME_kind
+		#define SOAGEN_NAME_kind
+		SOAGEN_MAKE_NAME(kind);
+	#endif
+
+	#ifndef SOAGEN_NAME_mass
+		#define SOAGEN_NAME_mass
+		SOAGEN_MAKE_NAME(mass);
+	#endif
+
 	#ifndef SOAGEN_NAME_name
 		#define SOAGEN_NAME_name
 		SOAGEN_MAKE_NAME(name);
 	#endif
 
+	#ifndef SOAGEN_NAME_pos
+		#define SOAGEN_NAME_pos
+		SOAGEN_MAKE_NAME(pos);
+	#endif
+
 	#ifndef SOAGEN_NAME_ptr
 		#define SOAGEN_NAME_ptr
 		SOAGEN_MAKE_NAME(ptr);
@@ -111,11 +142,31 @@ namespace soagen::detail
 		SOAGEN_MAKE_NAME(tag);
 	#endif
 
+	#ifndef SOAGEN_NAME_team
+		#define SOAGEN_NAME_team
+		SOAGEN_MAKE_NAME(team);
+	#endif
+
+	#ifndef SOAGEN_NAME_timestamp
+		#define SOAGEN_NAME_timestamp
+		SOAGEN_MAKE_NAME(timestamp);
+	#endif
+
 	#ifndef SOAGEN_NAME_v
 		#define SOAGEN_NAME_v
 		SOAGEN_MAKE_NAME(v);
 	#endif
 
+	#ifndef SOAGEN_NAME_value
+		#define SOAGEN_NAME_value
+		SOAGEN_MAKE_NAME(value);
+	#endif
+
+	#ifndef SOAGEN_NAME_w
+		#define SOAGEN_NAME_w
+		SOAGEN_MAKE_NAME(w);
+	#endif
+
 	#ifndef SOAGEN_NAME_x
 		#define SOAGEN_NAME_x
 		SOAGEN_MAKE_NAME(x);
@@ -132,6 +183,18 @@ namespace soagen::detail
 	#endif
 }
 
+namespace soagen_struct_impl_tests_actors
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::table_traits<
+						  /* name */ soagen::column_traits<std::string>,
+						  /*   hp */ soagen::column_traits<int>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
 namespace soagen_struct_impl_tests_collide
 {
 	SOAGEN_DISABLE_WARNINGS;
@@ -144,6 +207,32 @@ namespace soagen_struct_impl_tests_collide
 
 	using soagen_allocator_type = soagen::allocator;
 }
+namespace soagen_struct_impl_tests_entities
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::table_traits<
+						  /*   id */ soagen::column_traits<unsigned>,
+						  /* name */ soagen::column_traits<std::string>,
+						  /*	x */ soagen::column_traits<float>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
+namespace soagen_struct_impl_tests_events
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::table_traits<
+					 /* timestamp */ soagen::column_traits<std::int64_t>,
+					 /* 	   id */ soagen::column_traits<unsigned>,
+					 /* 	value */ soagen::column_traits<float>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
 namespace soagen_struct_impl_tests_fragile
 {
 	SOAGEN_DISABLE_WARNINGS;
@@ -180,6 +269,20 @@ namespace soagen_struct_impl_tests_move_only
 
 	using soagen_allocator_type = soagen::allocator;
 }
+namespace soagen_struct_impl_tests_packed
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::reordered_table_traits<
+						  /* flag */ soagen::column_traits<bool>,
+						  /*  pos */ soagen::column_traits<float, soagen::max(std::size_t{ 32u }, alignof(float))>,
+						  /*   id */ soagen::column_traits<std::uint16_t>,
+						  /* mass */ soagen::column_traits<double>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
 namespace soagen_struct_impl_tests_rich
 {
 	SOAGEN_DISABLE_WARNINGS;
@@ -209,9 +312,66 @@ namespace soagen_struct_impl_tests_trivial
 
 	using soagen_allocator_type = soagen::allocator;
 }
+namespace soagen_struct_impl_tests_units
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::table_traits<
+						  /* kind */ soagen::column_traits<int>,
+						  /* team */ soagen::column_traits<int>,
+						  /*   hp */ soagen::column_traits<float>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
+namespace soagen_struct_impl_tests_vec4
+{
+	SOAGEN_DISABLE_WARNINGS;
+	using namespace tests;
+	SOAGEN_ENABLE_WARNINGS;
+
+	using soagen_table_traits_type = soagen::table_traits<
+							 /* x */ soagen::column_traits<float>,
+							 /* y */ soagen::column_traits<float>,
+							 /* z */ soagen::column_traits<float>,
+							 /* w */ soagen::column_traits<float>>;
+
+	using soagen_allocator_type = soagen::allocator;
+}
 
 namespace soagen::detail
 {
+	SOAGEN_MAKE_NAMED_COLUMN(tests::actors, 0, name);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::actors, 1, hp);
+
+	template <>
+	struct is_soa_<tests::actors> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::actors>
+	{
+		using type = soagen_struct_impl_tests_actors::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::actors>
+	{
+		using type = soagen_struct_impl_tests_actors::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::actors>
+	{
+		using type = table<table_traits_type<tests::actors>, allocator_type<tests::actors>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::actors>
+		: std::integral_constant<std::uint64_t, 0x618A8D641A1BDCCEull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::collide, 0, foo_bar);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::collide, 1, fooBar);
 
@@ -237,6 +397,73 @@ namespace soagen::detail
 		using type = table<table_traits_type<tests::collide>, allocator_type<tests::collide>>;
 	};
 
+	template <>
+	struct schema_hash_<tests::collide>
+		: std::integral_constant<std::uint64_t, 0x529BFF0A16ED3AB2ull>
+	{};
+
+	SOAGEN_MAKE_NAMED_COLUMN(tests::entities, 0, id);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::entities, 1, name);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::entities, 2, x);
+
+	template <>
+	struct is_soa_<tests::entities> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::entities>
+	{
+		using type = soagen_struct_impl_tests_entities::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::entities>
+	{
+		using type = soagen_struct_impl_tests_entities::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::entities>
+	{
+		using type = table<table_traits_type<tests::entities>, allocator_type<tests::entities>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::entities>
+		: std::integral_constant<std::uint64_t, 0x6D52A367F9A621C9ull>
+	{};
+
+	SOAGEN_MAKE_NAMED_COLUMN(tests::events, 0, timestamp);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::events, 1, id);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::events, 2, value);
+
+	template <>
+	struct is_soa_<tests::events> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::events>
+	{
+		using type = soagen_struct_impl_tests_events::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::events>
+	{
+		using type = soagen_struct_impl_tests_events::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::events>
+	{
+		using type = table<table_traits_type<tests::events>, allocator_type<tests::events>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::events>
+		: std::integral_constant<std::uint64_t, 0x7D7D89CEEADBC900ull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::fragile, 0, v);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::fragile, 1, tag);
 
@@ -262,6 +489,11 @@ namespace soagen::detail
 		using type = table<table_traits_type<tests::fragile>, allocator_type<tests::fragile>>;
 	};
 
+	template <>
+	struct schema_hash_<tests::fragile>
+		: std::integral_constant<std::uint64_t, 0x886CEAE996E287CCull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::fragile2, 0, a);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::fragile2, 1, b);
 
@@ -287,6 +519,11 @@ namespace soagen::detail
 		using type = table<table_traits_type<tests::fragile2>, allocator_type<tests::fragile2>>;
 	};
 
+	template <>
+	struct schema_hash_<tests::fragile2>
+		: std::integral_constant<std::uint64_t, 0x514E0EA71164BD8Dull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::move_only, 0, ptr);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::move_only, 1, count);
 
@@ -312,6 +549,43 @@ namespace soagen::detail
 		using type = table<table_traits_type<tests::move_only>, allocator_type<tests::move_only>>;
 	};
 
+	template <>
+	struct schema_hash_<tests::move_only>
+		: std::integral_constant<std::uint64_t, 0xAABF63B019D5ACEEull>
+	{};
+
+	SOAGEN_MAKE_NAMED_COLUMN(tests::packed, 0, flag);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::packed, 1, pos);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::packed, 2, id);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::packed, 3, mass);
+
+	template <>
+	struct is_soa_<tests::packed> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::packed>
+	{
+		using type = soagen_struct_impl_tests_packed::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::packed>
+	{
+		using type = soagen_struct_impl_tests_packed::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::packed>
+	{
+		using type = table<table_traits_type<tests::packed>, allocator_type<tests::packed>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::packed>
+		: std::integral_constant<std::uint64_t, 0x8722C8A1591E6868ull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::rich, 0, name);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::rich, 1, id);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::rich, 2, date_of_birth);
@@ -340,6 +614,11 @@ namespace soagen::detail
 		using type = table<table_traits_type<tests::rich>, allocator_type<tests::rich>>;
 	};
 
+	template <>
+	struct schema_hash_<tests::rich>
+		: std::integral_constant<std::uint64_t, 0xF326DDD77B3C9A9Cull>
+	{};
+
 	SOAGEN_MAKE_NAMED_COLUMN(tests::trivial, 0, x);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::trivial, 1, y);
 	SOAGEN_MAKE_NAMED_COLUMN(tests::trivial, 2, z);
@@ -366,38 +645,106 @@ namespace soagen::detail
 	{
 		using type = table<table_traits_type<tests::trivial>, allocator_type<tests::trivial>>;
 	};
+
+	template <>
+	struct schema_hash_<tests::trivial>
+		: std::integral_constant<std::uint64_t, 0xCA55D82BDF4417CBull>
+	{};
+
+	SOAGEN_MAKE_NAMED_COLUMN(tests::units, 0, kind);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::units, 1, team);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::units, 2, hp);
+
+	template <>
+	struct is_soa_<tests::units> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::units>
+	{
+		using type = soagen_struct_impl_tests_units::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::units>
+	{
+		using type = soagen_struct_impl_tests_units::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::units>
+	{
+		using type = table<table_traits_type<tests::units>, allocator_type<tests::units>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::units>
+		: std::integral_constant<std::uint64_t, 0x6218270A06210DD1ull>
+	{};
+
+	SOAGEN_MAKE_NAMED_COLUMN(tests::vec4, 0, x);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::vec4, 1, y);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::vec4, 2, z);
+	SOAGEN_MAKE_NAMED_COLUMN(tests::vec4, 3, w);
+
+	template <>
+	struct is_soa_<tests::vec4> : std::true_type
+	{};
+
+	template <>
+	struct table_traits_type_<tests::vec4>
+	{
+		using type = soagen_struct_impl_tests_vec4::soagen_table_traits_type;
+	};
+
+	template <>
+	struct allocator_type_<tests::vec4>
+	{
+		using type = soagen_struct_impl_tests_vec4::soagen_allocator_type;
+	};
+
+	template <>
+	struct table_type_<tests::vec4>
+	{
+		using type = table<table_traits_type<tests::vec4>, allocator_type<tests::vec4>>;
+	};
+
+	template <>
+	struct schema_hash_<tests::vec4>
+		: std::integral_constant<std::uint64_t, 0xD29699A1C8FD40DCull>
+	{};
 }
 
 // clang-format on
 
 //----------------------------------------------------------------------------------------------------------------------
-// collide
+// actors
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES collide //
-        : public soagen::mixins::size_and_capacity<collide>,
-          public soagen::mixins::resizable<collide>,
-          public soagen::mixins::equality_comparable<collide>,
-          public soagen::mixins::less_than_comparable<collide>,
-          public soagen::mixins::data_ptr<collide>,
-          public soagen::mixins::columns<collide>,
-          public soagen::mixins::rows<collide>,
-          public soagen::mixins::iterators<collide>,
-          public soagen::mixins::spans<collide>,
-          public soagen::mixins::swappable<collide>
+    class SOAGEN_EMPTY_BASES actors //
+        : public soagen::mixins::size_and_capacity<actors>,
+          public soagen::mixins::resizable<actors>,
+          public soagen::mixins::equality_comparable<actors>,
+          public soagen::mixins::less_than_comparable<actors>,
+          public soagen::mixins::data_ptr<actors>,
+          public soagen::mixins::columns<actors>,
+          public soagen::mixins::rows<actors>,
+          public soagen::mixins::iterators<actors>,
+          public soagen::mixins::spans<actors>,
+          public soagen::mixins::swappable<actors>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<collide>;
+        using allocator_type = soagen::allocator_type<actors>;
 
-        using table_type = soagen::table_type<collide>;
+        using table_type = soagen::table_type<actors>;
 
-        using table_traits = soagen::table_traits_type<collide>;
+        using table_traits = soagen::table_traits_type<actors>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -407,63 +754,67 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<collide>;
+        using iterator = soagen::iterator_type<actors>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<collide>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<actors>;
 
-        using const_iterator = soagen::const_iterator_type<collide>;
+        using const_iterator = soagen::const_iterator_type<actors>;
 
-        using span_type = soagen::span_type<collide>;
+        using span_type = soagen::span_type<actors>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<collide>;
+        using rvalue_span_type = soagen::rvalue_span_type<actors>;
 
-        using const_span_type = soagen::const_span_type<collide>;
+        using const_span_type = soagen::const_span_type<actors>;
 
-        using row_type = soagen::row_type<collide>;
+        using row_type = soagen::row_type<actors>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<collide>;
+        using rvalue_row_type = soagen::rvalue_row_type<actors>;
 
-        using const_row_type = soagen::const_row_type<collide>;
+        using const_row_type = soagen::const_row_type<actors>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            foo_bar = 0,
-            fooBar  = 1,
+            name = 0,
+            hp   = 1,
         };
 
         template <auto Column>
-        static constexpr auto& column_name =
-            soagen::detail::column_name<collide, static_cast<size_type>(Column)>::value;
+        static constexpr auto& column_name = soagen::detail::column_name<actors, static_cast<size_type>(Column)>::value;
 
       private:
         table_type table_;
 
+        soagen::handle_table<actors> handles_;
+
+        // growing an index or the handle table may allocate
+        static constexpr bool indexes_are_nothrow_ = false;
+
       public:
         SOAGEN_NODISCARD_CTOR
-        collide() = default;
+        actors() = default;
 
         SOAGEN_NODISCARD_CTOR
-        collide(collide&&) = default;
+        actors(actors&&) = default;
 
-        collide& operator=(collide&&) = default;
+        actors& operator=(actors&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        collide(const collide&) = default;
+        actors(const actors&) = default;
 
-        collide& operator=(const collide&) = default;
+        actors& operator=(const actors&) = default;
 
-        ~collide() = default;
+        ~actors() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit collide(const allocator_type& alloc) noexcept //
+        explicit actors(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit collide(allocator_type&& alloc) noexcept //
+        explicit actors(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -514,9 +865,10 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, collide&> erase(size_type pos)                   //
+        std::enable_if_t<sfinae, actors&> erase(size_type pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            handles_.erase(pos, table_.size());
             table_.erase(pos);
             return *this;
         }
@@ -527,6 +879,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
         {
+            handles_.unordered_erase(pos, table_.size());
             return table_.unordered_erase(pos);
         }
 
@@ -536,6 +889,7 @@ namespace tests
         std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            handles_.erase(static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -546,6 +900,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
         {
+            handles_.unordered_erase(static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -557,6 +912,7 @@ namespace tests
         std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            handles_.erase(static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -567,6 +923,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
         {
+            handles_.unordered_erase(static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -575,7 +932,7 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        collide& swap_columns() //
+        actors& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
                                   .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
         {
@@ -583,46 +940,211 @@ namespace tests
             return *this;
         }
 
-        // ------ push_back() --------------------------------------------------------------------------
-
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        collide& push_back(column_traits<0>::param_type foo_bar, column_traits<1>::param_type fooBar) //
-            noexcept(table_traits::push_back_is_nothrow<table_type>)                                  //
+        actors& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
         {
-            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(foo_bar),
-                                static_cast<column_traits<1>::param_forward_type>(fooBar));
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
             return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        collide& push_back(column_traits<0>::rvalue_type foo_bar, column_traits<1>::rvalue_type fooBar) //
-            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                             //
+        actors& assign_column(const Range& values, size_type first = 0)
         {
-            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
-                                static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        actors& pop_back(size_type num = 1) noexcept
+        {
+            if (table_.empty())
+                return *this;
+
+            handles_.pop_back(num, table_.size());
+            table_.pop_back(num);
+            return *this;
+        }
+
+        SOAGEN_RESETTER
+        actors& clear() noexcept
+        {
+            table_.clear();
+            handles_.clear();
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, actors&> resize(size_type new_size)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            handles_.reserve(new_size);
+            table_.resize(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                handles_.push_back(i);
+            }
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::template rows_fillable_from<Values...>, typename... Values)
+        actors& resize(size_type new_size, const Values&... values)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            handles_.reserve(new_size);
+            table_.resize(new_size, values...);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                handles_.push_back(i);
+            }
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, actors&> resize_for_overwrite(size_type new_size)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            handles_.reserve(new_size);
+            table_.resize_for_overwrite(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                handles_.push_back(i);
+            }
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, span_type> append_uninitialized(size_type count)
+        {
+            if (!count)
+                return {};
+
+            const size_type old_size = table_.size();
+            handles_.reserve(old_size + count);
+            table_.append_uninitialized(count);
+            for (size_type i = old_size; i < old_size + count; i++)
+            {
+                handles_.push_back(i);
+            }
+            return { *this, old_size, count };
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_swap_member<table_type>::value)
+        std::enable_if_t<sfinae, void> swap(actors& other) //
+            noexcept(soagen::detail::has_nothrow_swap_member<table_type>::value)
+        {
+            table_.swap(other.table_);
+            handles_.swap(other.handles_);
+        }
+
+        using handle_type = soagen::row_handle<actors>;
+
+        SOAGEN_PURE_INLINE_GETTER
+        handle_type handle_of(size_type index) const noexcept
+        {
+            return handles_.handle_of(index);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        soagen::optional<size_type> index_of(const handle_type& handle) const noexcept
+        {
+            return handles_.index_of(handle);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        bool contains(const handle_type& handle) const noexcept
+        {
+            return static_cast<bool>(handles_.index_of(handle));
+        }
+
+        void rebuild_handles()
+        {
+            handles_.clear();
+            handles_.reserve(table_.size());
+            for (size_type i = 0, e = table_.size(); i < e; i++)
+                handles_.push_back(i);
+        }
+
+        template <typename... Args>
+        handle_type emplace_back_handle(Args&&... args)
+        {
+            emplace_back(static_cast<Args&&>(args)...);
+            return handles_.handle_of(table_.size() - 1u);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        std::enable_if_t<sfinae, bool> erase(const handle_type& handle) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)
+        {
+            const auto index = handles_.index_of(handle);
+            if (!index)
+                return false;
+
+            unordered_erase(*index);
+            return true;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        actors& push_back(column_traits<0>::param_type name, column_traits<1>::param_type hp = 100) //
+            noexcept(table_traits::push_back_is_nothrow<table_type>&& indexes_are_nothrow_)         //
+        {
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(name),
+                                static_cast<column_traits<1>::param_forward_type>(hp));
+            handles_.push_back(table_.size() - 1u);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        actors& push_back(column_traits<0>::rvalue_type name, column_traits<1>::rvalue_type hp = 100) //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>&& indexes_are_nothrow_)    //
+        {
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(name),
+                                static_cast<column_traits<1>::rvalue_forward_type>(hp));
+            handles_.push_back(table_.size() - 1u);
             return *this;
         }
 
         // ------ emplace_back() -----------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<FooBar&&, FooBar2&&>), //
-                                    typename FooBar,
-                                    typename FooBar2) //
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Name&&, Hp&&>), //
+                                    typename Name,
+                                    typename Hp = column_traits<1>::default_emplace_type) //
         SOAGEN_CONSTEXPR_20
-        collide& emplace_back(FooBar&& foo_bar, FooBar2&& fooBar)                            //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, FooBar&&, FooBar2&&>) //
+        actors& emplace_back(Name&& name, Hp&& hp = 100)                                                     //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Name&&, Hp&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace_back(static_cast<FooBar&&>(foo_bar), static_cast<FooBar2&&>(fooBar));
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<Name&&>(name), static_cast<Hp&&>(hp));
+            handles_.push_back(table_.size() - 1u);
             return *this;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
         SOAGEN_CONSTEXPR_20
-        collide& emplace_back(Tuple&& tuple_)                                    //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        actors& emplace_back(Tuple&& tuple_)                                                            //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            handles_.push_back(table_.size() - 1u);
             return *this;
         }
 
@@ -637,27 +1159,31 @@ namespace tests
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, collide&> insert(size_type index_,
-                                                  column_traits<0>::param_type foo_bar,
-                                                  column_traits<1>::param_type fooBar) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                      //
+        std::enable_if_t<sfinae, actors&> insert(size_type index_,
+                                                 column_traits<0>::param_type name,
+                                                 column_traits<1>::param_type hp = 100)  //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(index_,
-                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::param_forward_type>(fooBar));
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(hp));
+            handles_.insert(index_, table_.size());
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
-        collide& insert(std::enable_if_t<sfinae, size_type> index_,
-                        column_traits<0>::rvalue_type foo_bar,
-                        column_traits<1>::rvalue_type fooBar)     //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        actors& insert(std::enable_if_t<sfinae, size_type> index_,
+                       column_traits<0>::rvalue_type name,
+                       column_traits<1>::rvalue_type hp = 100)                           //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(index_,
-                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(hp));
+            handles_.insert(index_, table_.size());
             return *this;
         }
 
@@ -666,67 +1192,76 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, iterator> insert(iterator iter_,
-                                                  column_traits<0>::param_type foo_bar,
-                                                  column_traits<1>::param_type fooBar) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                      //
+                                                  column_traits<0>::param_type name,
+                                                  column_traits<1>::param_type hp = 100) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::param_forward_type>(fooBar));
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
-                                                        column_traits<0>::param_type foo_bar,
-                                                        column_traits<1>::param_type fooBar) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                            //
+                                                        column_traits<0>::param_type name,
+                                                        column_traits<1>::param_type hp = 100) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_)       //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::param_forward_type>(fooBar));
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         iterator insert(std::enable_if_t<sfinae, iterator> iter_,
-                        column_traits<0>::rvalue_type foo_bar,
-                        column_traits<1>::rvalue_type fooBar)     //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+                        column_traits<0>::rvalue_type name,
+                        column_traits<1>::rvalue_type hp = 100)                          //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
-                              column_traits<0>::rvalue_type foo_bar,
-                              column_traits<1>::rvalue_type fooBar) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)   //
+                              column_traits<0>::rvalue_type name,
+                              column_traits<1>::rvalue_type hp = 100)                    //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
-                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         // ------ emplace(size_type) -------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename FooBar,
-                                    typename FooBar2,
-                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
-                                               && can_insert_) //
+                                    typename Name,
+                                    typename Hp = column_traits<1>::default_emplace_type,
+                                    bool sfinae = table_traits::row_constructible_from<Name&&, Hp&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, collide&> emplace(size_type index_, FooBar&& foo_bar, FooBar2&& fooBar) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                  //
+        std::enable_if_t<sfinae, actors&> emplace(size_type index_, Name&& name, Hp&& hp = 100)         //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Hp&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace(index_, static_cast<FooBar&&>(foo_bar), static_cast<FooBar2&&>(fooBar));
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace(index_, static_cast<Name&&>(name), static_cast<Hp&&>(hp));
+            handles_.insert(index_, table_.size());
             return *this;
         }
 
@@ -734,27 +1269,28 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        collide& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)          //
+        actors& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_)                //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            handles_.insert(index_, table_.size());
             return *this;
         }
 
         // ------ emplace(iterator) --------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename FooBar,
-                                    typename FooBar2,
-                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
-                                               && can_insert_) //
+                                    typename Name,
+                                    typename Hp = column_traits<1>::default_emplace_type,
+                                    bool sfinae = table_traits::row_constructible_from<Name&&, Hp&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, FooBar&& foo_bar, FooBar2&& fooBar) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Name&& name, Hp&& hp = 100)          //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Hp&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<FooBar&&>(foo_bar),
-                           static_cast<FooBar2&&>(fooBar));
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Name&&>(name), static_cast<Hp&&>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -762,25 +1298,26 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_)                 //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename FooBar,
-                                    typename FooBar2,
-                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
-                                               && can_insert_) //
+                                    typename Name,
+                                    typename Hp = column_traits<1>::default_emplace_type,
+                                    bool sfinae = table_traits::row_constructible_from<Name&&, Hp&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, FooBar&& foo_bar, FooBar2&& fooBar) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                            //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, Name&& name, Hp&& hp = 100) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Hp&&>&& indexes_are_nothrow_)    //
         {
-            table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<FooBar&&>(foo_bar),
-                           static_cast<FooBar2&&>(fooBar));
+            handles_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Name&&>(name), static_cast<Hp&&>(hp));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -788,69 +1325,71 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_)     //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            handles_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            handles_.insert(static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(collide, Column)
+        SOAGEN_COLUMN(actors, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<collide, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<actors, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(collide, Column)
+        SOAGEN_COLUMN(actors, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<collide, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<actors, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<collide>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<actors>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(collide& lhs, collide& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<collide>::value)
+    constexpr void swap(actors& lhs, actors& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<actors>::value)
     {
         lhs.swap(rhs);
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-// fragile
+// collide
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES fragile //
-        : public soagen::mixins::size_and_capacity<fragile>,
-          public soagen::mixins::resizable<fragile>,
-          public soagen::mixins::equality_comparable<fragile>,
-          public soagen::mixins::less_than_comparable<fragile>,
-          public soagen::mixins::data_ptr<fragile>,
-          public soagen::mixins::columns<fragile>,
-          public soagen::mixins::rows<fragile>,
-          public soagen::mixins::iterators<fragile>,
-          public soagen::mixins::spans<fragile>,
-          public soagen::mixins::swappable<fragile>
+    class SOAGEN_EMPTY_BASES collide //
+        : public soagen::mixins::size_and_capacity<collide>,
+          public soagen::mixins::resizable<collide>,
+          public soagen::mixins::equality_comparable<collide>,
+          public soagen::mixins::less_than_comparable<collide>,
+          public soagen::mixins::data_ptr<collide>,
+          public soagen::mixins::columns<collide>,
+          public soagen::mixins::rows<collide>,
+          public soagen::mixins::iterators<collide>,
+          public soagen::mixins::spans<collide>,
+          public soagen::mixins::swappable<collide>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<fragile>;
+        using allocator_type = soagen::allocator_type<collide>;
 
-        using table_type = soagen::table_type<fragile>;
+        using table_type = soagen::table_type<collide>;
 
-        using table_traits = soagen::table_traits_type<fragile>;
+        using table_traits = soagen::table_traits_type<collide>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -860,63 +1399,63 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<fragile>;
+        using iterator = soagen::iterator_type<collide>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<fragile>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<collide>;
 
-        using const_iterator = soagen::const_iterator_type<fragile>;
+        using const_iterator = soagen::const_iterator_type<collide>;
 
-        using span_type = soagen::span_type<fragile>;
+        using span_type = soagen::span_type<collide>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<fragile>;
+        using rvalue_span_type = soagen::rvalue_span_type<collide>;
 
-        using const_span_type = soagen::const_span_type<fragile>;
+        using const_span_type = soagen::const_span_type<collide>;
 
-        using row_type = soagen::row_type<fragile>;
+        using row_type = soagen::row_type<collide>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<fragile>;
+        using rvalue_row_type = soagen::rvalue_row_type<collide>;
 
-        using const_row_type = soagen::const_row_type<fragile>;
+        using const_row_type = soagen::const_row_type<collide>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            v   = 0,
-            tag = 1,
+            foo_bar = 0,
+            fooBar  = 1,
         };
 
         template <auto Column>
         static constexpr auto& column_name =
-            soagen::detail::column_name<fragile, static_cast<size_type>(Column)>::value;
+            soagen::detail::column_name<collide, static_cast<size_type>(Column)>::value;
 
       private:
         table_type table_;
 
       public:
         SOAGEN_NODISCARD_CTOR
-        fragile() = default;
+        collide() = default;
 
         SOAGEN_NODISCARD_CTOR
-        fragile(fragile&&) = default;
+        collide(collide&&) = default;
 
-        fragile& operator=(fragile&&) = default;
+        collide& operator=(collide&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        fragile(const fragile&) = default;
+        collide(const collide&) = default;
 
-        fragile& operator=(const fragile&) = default;
+        collide& operator=(const collide&) = default;
 
-        ~fragile() = default;
+        ~collide() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit fragile(const allocator_type& alloc) noexcept //
+        constexpr explicit collide(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit fragile(allocator_type&& alloc) noexcept //
+        constexpr explicit collide(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -967,7 +1506,7 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, fragile&> erase(size_type pos)                   //
+        std::enable_if_t<sfinae, collide&> erase(size_type pos)                   //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
             table_.erase(pos);
@@ -1028,7 +1567,7 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile& swap_columns() //
+        collide& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
                                   .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
         {
@@ -1036,43 +1575,63 @@ namespace tests
             return *this;
         }
 
-        // ------ push_back() --------------------------------------------------------------------------
-
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile& push_back(column_traits<0>::param_type v, column_traits<1>::param_type tag) //
-            noexcept(table_traits::push_back_is_nothrow<table_type>)                         //
+        collide& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
         {
-            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(v),
-                                static_cast<column_traits<1>::param_forward_type>(tag));
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
             return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile& push_back(column_traits<0>::rvalue_type v, column_traits<1>::rvalue_type tag) //
-            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                    //
+        collide& assign_column(const Range& values, size_type first = 0)
         {
-            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(v),
-                                static_cast<column_traits<1>::rvalue_forward_type>(tag));
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
             return *this;
         }
 
-        // ------ emplace_back() -----------------------------------------------------------------------
+        // ------ push_back() --------------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<V&&, Tag&&>), //
-                                    typename V,
-                                    typename Tag) //
         SOAGEN_CONSTEXPR_20
-        fragile& emplace_back(V&& v, Tag&& tag)                                     //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, V&&, Tag&&>) //
+        collide& push_back(column_traits<0>::param_type foo_bar, column_traits<1>::param_type fooBar) //
+            noexcept(table_traits::push_back_is_nothrow<table_type>)                                  //
         {
-            table_.emplace_back(static_cast<V&&>(v), static_cast<Tag&&>(tag));
-            return *this;
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(foo_bar),
+                                static_cast<column_traits<1>::param_forward_type>(fooBar));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        collide& push_back(column_traits<0>::rvalue_type foo_bar, column_traits<1>::rvalue_type fooBar) //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                             //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
+                                static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<FooBar&&, FooBar2&&>), //
+                                    typename FooBar,
+                                    typename FooBar2) //
+        SOAGEN_CONSTEXPR_20
+        collide& emplace_back(FooBar&& foo_bar, FooBar2&& fooBar)                            //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, FooBar&&, FooBar2&&>) //
+        {
+            table_.emplace_back(static_cast<FooBar&&>(foo_bar), static_cast<FooBar2&&>(fooBar));
+            return *this;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
         SOAGEN_CONSTEXPR_20
-        fragile& emplace_back(Tuple&& tuple_)                                    //
+        collide& emplace_back(Tuple&& tuple_)                                    //
             noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
         {
             table_.emplace_back(static_cast<Tuple&&>(tuple_));
@@ -1090,27 +1649,27 @@ namespace tests
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, fragile&> insert(size_type index_,
-                                                  column_traits<0>::param_type v,
-                                                  column_traits<1>::param_type tag) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                   //
+        std::enable_if_t<sfinae, collide&> insert(size_type index_,
+                                                  column_traits<0>::param_type foo_bar,
+                                                  column_traits<1>::param_type fooBar) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                      //
         {
             table_.emplace(index_,
-                           static_cast<column_traits<0>::param_forward_type>(v),
-                           static_cast<column_traits<1>::param_forward_type>(tag));
+                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::param_forward_type>(fooBar));
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
-        fragile& insert(std::enable_if_t<sfinae, size_type> index_,
-                        column_traits<0>::rvalue_type v,
-                        column_traits<1>::rvalue_type tag)        //
+        collide& insert(std::enable_if_t<sfinae, size_type> index_,
+                        column_traits<0>::rvalue_type foo_bar,
+                        column_traits<1>::rvalue_type fooBar)     //
             noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(index_,
-                           static_cast<column_traits<0>::rvalue_forward_type>(v),
-                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
             return *this;
         }
 
@@ -1119,66 +1678,67 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, iterator> insert(iterator iter_,
-                                                  column_traits<0>::param_type v,
-                                                  column_traits<1>::param_type tag) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                   //
+                                                  column_traits<0>::param_type foo_bar,
+                                                  column_traits<1>::param_type fooBar) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                      //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(v),
-                           static_cast<column_traits<1>::param_forward_type>(tag));
+                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::param_forward_type>(fooBar));
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
-                                                        column_traits<0>::param_type v,
-                                                        column_traits<1>::param_type tag) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                         //
+                                                        column_traits<0>::param_type foo_bar,
+                                                        column_traits<1>::param_type fooBar) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                            //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(v),
-                           static_cast<column_traits<1>::param_forward_type>(tag));
+                           static_cast<column_traits<0>::param_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::param_forward_type>(fooBar));
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         iterator insert(std::enable_if_t<sfinae, iterator> iter_,
-                        column_traits<0>::rvalue_type v,
-                        column_traits<1>::rvalue_type tag)        //
+                        column_traits<0>::rvalue_type foo_bar,
+                        column_traits<1>::rvalue_type fooBar)     //
             noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(v),
-                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
-                              column_traits<0>::rvalue_type v,
-                              column_traits<1>::rvalue_type tag)  //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+                              column_traits<0>::rvalue_type foo_bar,
+                              column_traits<1>::rvalue_type fooBar) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)   //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(v),
-                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(foo_bar),
+                           static_cast<column_traits<1>::rvalue_forward_type>(fooBar));
             return iter_;
         }
 
         // ------ emplace(size_type) -------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename V,
-                                    typename Tag,
-                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+                                    typename FooBar,
+                                    typename FooBar2,
+                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
+                                               && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, fragile&> emplace(size_type index_, V&& v, Tag&& tag) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)         //
+        std::enable_if_t<sfinae, collide&> emplace(size_type index_, FooBar&& foo_bar, FooBar2&& fooBar) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                  //
         {
-            table_.emplace(index_, static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            table_.emplace(index_, static_cast<FooBar&&>(foo_bar), static_cast<FooBar2&&>(fooBar));
             return *this;
         }
 
@@ -1186,7 +1746,7 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        fragile& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+        collide& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
             noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)          //
         {
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
@@ -1196,14 +1756,17 @@ namespace tests
         // ------ emplace(iterator) --------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename V,
-                                    typename Tag,
-                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+                                    typename FooBar,
+                                    typename FooBar2,
+                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
+                                               && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, V&& v, Tag&& tag) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)       //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, FooBar&& foo_bar, FooBar2&& fooBar) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<FooBar&&>(foo_bar),
+                           static_cast<FooBar2&&>(fooBar));
             return iter_;
         }
 
@@ -1219,14 +1782,17 @@ namespace tests
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename V,
-                                    typename Tag,
-                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+                                    typename FooBar,
+                                    typename FooBar2,
+                                    bool sfinae = table_traits::row_constructible_from<FooBar&&, FooBar2&&>
+                                               && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, V&& v, Tag&& tag) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)                   //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, FooBar&& foo_bar, FooBar2&& fooBar) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, FooBar&&, FooBar2&&>)                            //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<FooBar&&>(foo_bar),
+                           static_cast<FooBar2&&>(fooBar));
             return iter_;
         }
 
@@ -1242,61 +1808,61 @@ namespace tests
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(fragile, Column)
+        SOAGEN_COLUMN(collide, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<fragile, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<collide, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(fragile, Column)
+        SOAGEN_COLUMN(collide, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<fragile, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<collide, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<fragile>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<collide>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(fragile& lhs, fragile& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<fragile>::value)
+    constexpr void swap(collide& lhs, collide& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<collide>::value)
     {
         lhs.swap(rhs);
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-// fragile2
+// entities
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES fragile2 //
-        : public soagen::mixins::size_and_capacity<fragile2>,
-          public soagen::mixins::resizable<fragile2>,
-          public soagen::mixins::equality_comparable<fragile2>,
-          public soagen::mixins::less_than_comparable<fragile2>,
-          public soagen::mixins::data_ptr<fragile2>,
-          public soagen::mixins::columns<fragile2>,
-          public soagen::mixins::rows<fragile2>,
-          public soagen::mixins::iterators<fragile2>,
-          public soagen::mixins::spans<fragile2>,
-          public soagen::mixins::swappable<fragile2>
+    class SOAGEN_EMPTY_BASES entities //
+        : public soagen::mixins::size_and_capacity<entities>,
+          public soagen::mixins::resizable<entities>,
+          public soagen::mixins::equality_comparable<entities>,
+          public soagen::mixins::less_than_comparable<entities>,
+          public soagen::mixins::data_ptr<entities>,
+          public soagen::mixins::columns<entities>,
+          public soagen::mixins::rows<entities>,
+          public soagen::mixins::iterators<entities>,
+          public soagen::mixins::spans<entities>,
+          public soagen::mixins::swappable<entities>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<fragile2>;
+        using allocator_type = soagen::allocator_type<entities>;
 
-        using table_type = soagen::table_type<fragile2>;
+        using table_type = soagen::table_type<entities>;
 
-        using table_traits = soagen::table_traits_type<fragile2>;
+        using table_traits = soagen::table_traits_type<entities>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -1306,63 +1872,76 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<fragile2>;
+        using iterator = soagen::iterator_type<entities>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<fragile2>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<entities>;
 
-        using const_iterator = soagen::const_iterator_type<fragile2>;
+        using const_iterator = soagen::const_iterator_type<entities>;
 
-        using span_type = soagen::span_type<fragile2>;
+        using span_type = soagen::span_type<entities>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<fragile2>;
+        using rvalue_span_type = soagen::rvalue_span_type<entities>;
 
-        using const_span_type = soagen::const_span_type<fragile2>;
+        using const_span_type = soagen::const_span_type<entities>;
 
-        using row_type = soagen::row_type<fragile2>;
+        using row_type = soagen::row_type<entities>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<fragile2>;
+        using rvalue_row_type = soagen::rvalue_row_type<entities>;
 
-        using const_row_type = soagen::const_row_type<fragile2>;
+        using const_row_type = soagen::const_row_type<entities>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            a = 0,
-            b = 1,
+            id   = 0,
+            name = 1,
+            x    = 2,
         };
 
         template <auto Column>
         static constexpr auto& column_name =
-            soagen::detail::column_name<fragile2, static_cast<size_type>(Column)>::value;
+            soagen::detail::column_name<entities, static_cast<size_type>(Column)>::value;
+
+        struct value_type
+        {
+            unsigned id;
+            std::string name;
+            float x = 0;
+        };
 
       private:
         table_type table_;
 
+        soagen::hash_index<std::remove_cv_t<column_type<0>>> id_index_;
+
+        // growing an index or the handle table may allocate
+        static constexpr bool indexes_are_nothrow_ = false;
+
       public:
         SOAGEN_NODISCARD_CTOR
-        fragile2() = default;
+        entities() = default;
 
         SOAGEN_NODISCARD_CTOR
-        fragile2(fragile2&&) = default;
+        entities(entities&&) = default;
 
-        fragile2& operator=(fragile2&&) = default;
+        entities& operator=(entities&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        fragile2(const fragile2&) = default;
+        entities(const entities&) = default;
 
-        fragile2& operator=(const fragile2&) = default;
+        entities& operator=(const entities&) = default;
 
-        ~fragile2() = default;
+        ~entities() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit fragile2(const allocator_type& alloc) noexcept //
+        explicit entities(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit fragile2(allocator_type&& alloc) noexcept //
+        explicit entities(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -1413,9 +1992,10 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, fragile2&> erase(size_type pos)                  //
+        std::enable_if_t<sfinae, entities&> erase(size_type pos)                  //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            id_index_.erase(table_.template column<0>(), pos, table_.size());
             table_.erase(pos);
             return *this;
         }
@@ -1426,6 +2006,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
         {
+            id_index_.unordered_erase(table_.template column<0>(), pos, table_.size());
             return table_.unordered_erase(pos);
         }
 
@@ -1435,6 +2016,7 @@ namespace tests
         std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            id_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -1445,6 +2027,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
         {
+            id_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -1456,6 +2039,7 @@ namespace tests
         std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            id_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -1466,6 +2050,7 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
         {
+            id_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -1474,157 +2059,334 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile2& swap_columns() //
+        entities& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
-                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>())
+                     && indexes_are_nothrow_)
         {
             table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            rebuild_indexes();
             return *this;
         }
 
-        // ------ push_back() --------------------------------------------------------------------------
-
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile2& push_back(column_traits<0>::param_type a, column_traits<1>::param_type b) //
-            noexcept(table_traits::push_back_is_nothrow<table_type>)                        //
+        entities& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(
+                noexcept(std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count))
+                && indexes_are_nothrow_)
         {
-            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(a),
-                                static_cast<column_traits<1>::param_forward_type>(b));
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            rebuild_indexes();
             return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        fragile2& push_back(column_traits<0>::rvalue_type a, column_traits<1>::rvalue_type b) //
-            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                   //
+        entities& assign_column(const Range& values, size_type first = 0)
         {
-            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(a),
-                                static_cast<column_traits<1>::rvalue_forward_type>(b));
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            rebuild_indexes();
             return *this;
         }
 
-        // ------ emplace_back() -----------------------------------------------------------------------
+        entities& pop_back(size_type num = 1) noexcept
+        {
+            if (table_.empty())
+                return *this;
 
-        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<A&&, B&&>), //
-                                    typename A,
-                                    typename B) //
-        SOAGEN_CONSTEXPR_20
-        fragile2& emplace_back(A&& a, B&& b)                                      //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, A&&, B&&>) //
+            id_index_.pop_back(table_.template column<0>(), num, table_.size());
+            table_.pop_back(num);
+            return *this;
+        }
+
+        SOAGEN_RESETTER
+        entities& clear() noexcept
         {
-            table_.emplace_back(static_cast<A&&>(a), static_cast<B&&>(b));
+            table_.clear();
+            id_index_.clear();
             return *this;
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
-        SOAGEN_CONSTEXPR_20
-        fragile2& emplace_back(Tuple&& tuple_)                                   //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, entities&> resize(size_type new_size)
         {
-            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            id_index_.reserve(new_size);
+            table_.resize(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                id_index_.push_back(table_.template column<0>(), i);
+            }
             return *this;
         }
 
-      private:
-        static constexpr bool can_insert_ =
-            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::template rows_fillable_from<Values...>, typename... Values)
+        entities& resize(size_type new_size, const Values&... values)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
 
-        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+            id_index_.reserve(new_size);
+            table_.resize(new_size, values...);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                id_index_.push_back(table_.template column<0>(), i);
+            }
+            return *this;
+        }
 
-      public:
-        // ------ insert(size_type) --------------------------------------------------------------------
+        entities& resize_for_overwrite(size_type) = delete;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
-        SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, fragile2&> insert(size_type index_,
-                                                   column_traits<0>::param_type a,
-                                                   column_traits<1>::param_type b) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                  //
+        span_type append_uninitialized(size_type) = delete;
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_swap_member<table_type>::value)
+        std::enable_if_t<sfinae, void> swap(entities& other) //
+            noexcept(soagen::detail::has_nothrow_swap_member<table_type>::value)
         {
-            table_.emplace(index_,
-                           static_cast<column_traits<0>::param_forward_type>(a),
-                           static_cast<column_traits<1>::param_forward_type>(b));
-            return *this;
+            table_.swap(other.table_);
+            id_index_.swap(other.id_index_);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
-        SOAGEN_CONSTEXPR_20
-        fragile2& insert(std::enable_if_t<sfinae, size_type> index_,
-                         column_traits<0>::rvalue_type a,
-                         column_traits<1>::rvalue_type b)         //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        void rebuild_indexes()
         {
-            table_.emplace(index_,
-                           static_cast<column_traits<0>::rvalue_forward_type>(a),
-                           static_cast<column_traits<1>::rvalue_forward_type>(b));
-            return *this;
+            if (table_.empty())
+            {
+                id_index_.clear();
+                return;
+            }
+
+            id_index_.rebuild(table_.template column<0>(), table_.size());
         }
 
-        // ------ insert(iterator) ---------------------------------------------------------------------
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::optional<size_type> find(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+        {
+            if (table_.empty())
+                return {};
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return id_index_.find(table_.template column<0>(), key);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have an index");
+        }
+
+        SOAGEN_NODISCARD
+        soagen::optional<size_type> find(const std::remove_cv_t<column_type<0>>& key) const noexcept
+        {
+            return find<0>(key);
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        entities& push_back(column_traits<0>::param_type id,
+                            column_traits<1>::param_type name,
+                            column_traits<2>::param_type x = 0)                             //
+            noexcept(table_traits::push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(id),
+                                static_cast<column_traits<1>::param_forward_type>(name),
+                                static_cast<column_traits<2>::param_forward_type>(x));
+            id_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        entities& push_back(column_traits<0>::rvalue_type id,
+                            column_traits<1>::rvalue_type name,
+                            column_traits<2>::rvalue_type x = 0)                                   //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(id),
+                                static_cast<column_traits<1>::rvalue_forward_type>(name),
+                                static_cast<column_traits<2>::rvalue_forward_type>(x));
+            id_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Id&&, Name&&, X&&>), //
+                                    typename Id,
+                                    typename Name,
+                                    typename X = column_traits<2>::default_emplace_type) //
+        SOAGEN_CONSTEXPR_20
+        entities& emplace_back(Id&& id, Name&& name, X&& x = 0)                                                   //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Id&&, Name&&, X&&>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<Id&&>(id), static_cast<Name&&>(name), static_cast<X&&>(x));
+            id_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        entities& emplace_back(Tuple&& tuple_)                                                          //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            id_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            return *this;
+        }
+
+        entities& append_from_aos(const value_type* src, size_type count)
+        {
+            id_index_.reserve(table_.size() + count);
+            const size_type first = table_.size();
+            soagen::append_from_aos(table_, src, count, &value_type::id, &value_type::name, &value_type::x);
+            for (size_type i = first; i < table_.size(); i++)
+            {
+                id_index_.push_back(table_.template column<0>(), i);
+            }
+            return *this;
+        }
+
+        void copy_to_aos(value_type* dest, size_type start, size_type count) const
+        {
+            soagen::copy_to_aos(table_, dest, start, count, &value_type::id, &value_type::name, &value_type::x);
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, entities&> insert(size_type index_,
+                                                   column_traits<0>::param_type id,
+                                                   column_traits<1>::param_type name,
+                                                   column_traits<2>::param_type x = 0)   //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(id),
+                           static_cast<column_traits<1>::param_forward_type>(name),
+                           static_cast<column_traits<2>::param_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), index_, table_.size());
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        entities& insert(std::enable_if_t<sfinae, size_type> index_,
+                         column_traits<0>::rvalue_type id,
+                         column_traits<1>::rvalue_type name,
+                         column_traits<2>::rvalue_type x = 0)                            //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(id),
+                           static_cast<column_traits<1>::rvalue_forward_type>(name),
+                           static_cast<column_traits<2>::rvalue_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), index_, table_.size());
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, iterator> insert(iterator iter_,
-                                                  column_traits<0>::param_type a,
-                                                  column_traits<1>::param_type b) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                 //
+                                                  column_traits<0>::param_type id,
+                                                  column_traits<1>::param_type name,
+                                                  column_traits<2>::param_type x = 0)    //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(a),
-                           static_cast<column_traits<1>::param_forward_type>(b));
+                           static_cast<column_traits<0>::param_forward_type>(id),
+                           static_cast<column_traits<1>::param_forward_type>(name),
+                           static_cast<column_traits<2>::param_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
-                                                        column_traits<0>::param_type a,
-                                                        column_traits<1>::param_type b) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                       //
+                                                        column_traits<0>::param_type id,
+                                                        column_traits<1>::param_type name,
+                                                        column_traits<2>::param_type x = 0) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_)    //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(a),
-                           static_cast<column_traits<1>::param_forward_type>(b));
+                           static_cast<column_traits<0>::param_forward_type>(id),
+                           static_cast<column_traits<1>::param_forward_type>(name),
+                           static_cast<column_traits<2>::param_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         iterator insert(std::enable_if_t<sfinae, iterator> iter_,
-                        column_traits<0>::rvalue_type a,
-                        column_traits<1>::rvalue_type b)          //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+                        column_traits<0>::rvalue_type id,
+                        column_traits<1>::rvalue_type name,
+                        column_traits<2>::rvalue_type x = 0)                             //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(a),
-                           static_cast<column_traits<1>::rvalue_forward_type>(b));
+                           static_cast<column_traits<0>::rvalue_forward_type>(id),
+                           static_cast<column_traits<1>::rvalue_forward_type>(name),
+                           static_cast<column_traits<2>::rvalue_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
-                              column_traits<0>::rvalue_type a,
-                              column_traits<1>::rvalue_type b)    //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+                              column_traits<0>::rvalue_type id,
+                              column_traits<1>::rvalue_type name,
+                              column_traits<2>::rvalue_type x = 0)                       //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(a),
-                           static_cast<column_traits<1>::rvalue_forward_type>(b));
+                           static_cast<column_traits<0>::rvalue_forward_type>(id),
+                           static_cast<column_traits<1>::rvalue_forward_type>(name),
+                           static_cast<column_traits<2>::rvalue_forward_type>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         // ------ emplace(size_type) -------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename A,
-                                    typename B,
-                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Id,
+            typename Name,
+            typename X  = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Id&&, Name&&, X&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, fragile2&> emplace(size_type index_, A&& a, B&& b) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)        //
+        std::enable_if_t<sfinae, entities&> emplace(size_type index_, Id&& id, Name&& name, X&& x = 0)       //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Id&&, Name&&, X&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace(index_, static_cast<A&&>(a), static_cast<B&&>(b));
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_, static_cast<Id&&>(id), static_cast<Name&&>(name), static_cast<X&&>(x));
+            id_index_.insert(table_.template column<0>(), index_, table_.size());
             return *this;
         }
 
@@ -1632,24 +2394,33 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        fragile2& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)           //
+        entities& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_)              //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            id_index_.insert(table_.template column<0>(), index_, table_.size());
             return *this;
         }
 
         // ------ emplace(iterator) --------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename A,
-                                    typename B,
-                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Id,
+            typename Name,
+            typename X  = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Id&&, Name&&, X&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, A&& a, B&& b) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)     //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Id&& id, Name&& name, X&& x = 0)          //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Id&&, Name&&, X&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<A&&>(a), static_cast<B&&>(b));
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Id&&>(id),
+                           static_cast<Name&&>(name),
+                           static_cast<X&&>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -1657,22 +2428,31 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_)                 //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename A,
-                                    typename B,
-                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Id,
+            typename Name,
+            typename X  = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Id&&, Name&&, X&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, A&& a, B&& b) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)                 //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, Id&& id, Name&& name, X&& x = 0) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Id&&, Name&&, X&&>&& indexes_are_nothrow_)    //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<A&&>(a), static_cast<B&&>(b));
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Id&&>(id),
+                           static_cast<Name&&>(name),
+                           static_cast<X&&>(x));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -1680,69 +2460,71 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_)     //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            id_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            id_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(fragile2, Column)
+        SOAGEN_COLUMN(entities, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<fragile2, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<entities, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(fragile2, Column)
+        SOAGEN_COLUMN(entities, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<fragile2, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<entities, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<fragile2>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<entities>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(fragile2& lhs, fragile2& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<fragile2>::value)
+    constexpr void swap(entities& lhs, entities& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<entities>::value)
     {
         lhs.swap(rhs);
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-// move_only
+// events
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES move_only //
-        : public soagen::mixins::size_and_capacity<move_only>,
-          public soagen::mixins::resizable<move_only>,
-          public soagen::mixins::equality_comparable<move_only>,
-          public soagen::mixins::less_than_comparable<move_only>,
-          public soagen::mixins::data_ptr<move_only>,
-          public soagen::mixins::columns<move_only>,
-          public soagen::mixins::rows<move_only>,
-          public soagen::mixins::iterators<move_only>,
-          public soagen::mixins::spans<move_only>,
-          public soagen::mixins::swappable<move_only>
+    class SOAGEN_EMPTY_BASES events //
+        : public soagen::mixins::size_and_capacity<events>,
+          public soagen::mixins::resizable<events>,
+          public soagen::mixins::equality_comparable<events>,
+          public soagen::mixins::less_than_comparable<events>,
+          public soagen::mixins::data_ptr<events>,
+          public soagen::mixins::columns<events>,
+          public soagen::mixins::rows<events>,
+          public soagen::mixins::iterators<events>,
+          public soagen::mixins::spans<events>,
+          public soagen::mixins::swappable<events>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<move_only>;
+        using allocator_type = soagen::allocator_type<events>;
 
-        using table_type = soagen::table_type<move_only>;
+        using table_type = soagen::table_type<events>;
 
-        using table_traits = soagen::table_traits_type<move_only>;
+        using table_traits = soagen::table_traits_type<events>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -1752,63 +2534,69 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<move_only>;
+        using iterator = soagen::iterator_type<events>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<move_only>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<events>;
 
-        using const_iterator = soagen::const_iterator_type<move_only>;
+        using const_iterator = soagen::const_iterator_type<events>;
 
-        using span_type = soagen::span_type<move_only>;
+        using span_type = soagen::span_type<events>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<move_only>;
+        using rvalue_span_type = soagen::rvalue_span_type<events>;
 
-        using const_span_type = soagen::const_span_type<move_only>;
+        using const_span_type = soagen::const_span_type<events>;
 
-        using row_type = soagen::row_type<move_only>;
+        using row_type = soagen::row_type<events>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<move_only>;
+        using rvalue_row_type = soagen::rvalue_row_type<events>;
 
-        using const_row_type = soagen::const_row_type<move_only>;
+        using const_row_type = soagen::const_row_type<events>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            ptr   = 0,
-            count = 1,
+            timestamp = 0,
+            id        = 1,
+            value     = 2,
         };
 
         template <auto Column>
-        static constexpr auto& column_name =
-            soagen::detail::column_name<move_only, static_cast<size_type>(Column)>::value;
+        static constexpr auto& column_name = soagen::detail::column_name<events, static_cast<size_type>(Column)>::value;
 
       private:
         table_type table_;
 
+        soagen::sorted_index<std::remove_cv_t<column_type<0>>> timestamp_index_;
+        soagen::hash_index<std::remove_cv_t<column_type<1>>> id_index_;
+
+        // growing an index or the handle table may allocate
+        static constexpr bool indexes_are_nothrow_ = false;
+
       public:
         SOAGEN_NODISCARD_CTOR
-        move_only() = default;
+        events() = default;
 
         SOAGEN_NODISCARD_CTOR
-        move_only(move_only&&) = default;
+        events(events&&) = default;
 
-        move_only& operator=(move_only&&) = default;
+        events& operator=(events&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        move_only(const move_only&) = default;
+        events(const events&) = default;
 
-        move_only& operator=(const move_only&) = default;
+        events& operator=(const events&) = default;
 
-        ~move_only() = default;
+        ~events() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit move_only(const allocator_type& alloc) noexcept //
+        explicit events(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit move_only(allocator_type&& alloc) noexcept //
+        explicit events(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -1859,9 +2647,11 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, move_only&> erase(size_type pos)                 //
+        std::enable_if_t<sfinae, events&> erase(size_type pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            timestamp_index_.erase(table_.template column<0>(), pos, table_.size());
+            id_index_.erase(table_.template column<1>(), pos, table_.size());
             table_.erase(pos);
             return *this;
         }
@@ -1872,6 +2662,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
         {
+            timestamp_index_.unordered_erase(table_.template column<0>(), pos, table_.size());
+            id_index_.unordered_erase(table_.template column<1>(), pos, table_.size());
             return table_.unordered_erase(pos);
         }
 
@@ -1881,6 +2673,8 @@ namespace tests
         std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            timestamp_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            id_index_.erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -1891,6 +2685,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
         {
+            timestamp_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            id_index_.unordered_erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -1902,6 +2698,8 @@ namespace tests
         std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            timestamp_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            id_index_.erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -1912,6 +2710,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
         {
+            timestamp_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            id_index_.unordered_erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -1920,158 +2720,3529 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        move_only& swap_columns() //
+        events& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
-                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>())
+                     && indexes_are_nothrow_)
         {
             table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            rebuild_indexes();
             return *this;
         }
 
-        // ------ push_back() --------------------------------------------------------------------------
-
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        move_only& push_back(column_traits<0>::param_type ptr, column_traits<1>::param_type count) //
-            noexcept(table_traits::push_back_is_nothrow<table_type>)                               //
+        events& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(
+                noexcept(std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count))
+                && indexes_are_nothrow_)
         {
-            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(ptr),
-                                static_cast<column_traits<1>::param_forward_type>(count));
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            rebuild_indexes();
             return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        move_only& push_back(column_traits<0>::rvalue_type ptr, column_traits<1>::rvalue_type count) //
-            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                          //
+        events& assign_column(const Range& values, size_type first = 0)
         {
-            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(ptr),
-                                static_cast<column_traits<1>::rvalue_forward_type>(count));
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            rebuild_indexes();
             return *this;
         }
 
-        // ------ emplace_back() -----------------------------------------------------------------------
-
-        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Ptr&&, Count&&>), //
-                                    typename Ptr,
-                                    typename Count) //
-        SOAGEN_CONSTEXPR_20
-        move_only& emplace_back(Ptr&& ptr, Count&& count)                               //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Ptr&&, Count&&>) //
+        events& pop_back(size_type num = 1) noexcept
         {
-            table_.emplace_back(static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            if (table_.empty())
+                return *this;
+
+            timestamp_index_.pop_back(table_.template column<0>(), num, table_.size());
+            id_index_.pop_back(table_.template column<1>(), num, table_.size());
+            table_.pop_back(num);
             return *this;
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
-        SOAGEN_CONSTEXPR_20
-        move_only& emplace_back(Tuple&& tuple_)                                  //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        SOAGEN_RESETTER
+        events& clear() noexcept
         {
-            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            table_.clear();
+            timestamp_index_.clear();
+            id_index_.clear();
             return *this;
         }
 
-      private:
-        static constexpr bool can_insert_ =
-            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
-
-        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
-
-      public:
-        // ------ insert(size_type) --------------------------------------------------------------------
-
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
-        SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, move_only&> insert(size_type index_,
-                                                    column_traits<0>::param_type ptr,
-                                                    column_traits<1>::param_type count) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                       //
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, events&> resize(size_type new_size)
         {
-            table_.emplace(index_,
-                           static_cast<column_traits<0>::param_forward_type>(ptr),
-                           static_cast<column_traits<1>::param_forward_type>(count));
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            timestamp_index_.reserve(new_size);
+            id_index_.reserve(new_size);
+            table_.resize(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                timestamp_index_.push_back(table_.template column<0>(), i);
+                id_index_.push_back(table_.template column<1>(), i);
+            }
             return *this;
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
-        SOAGEN_CONSTEXPR_20
-        move_only& insert(std::enable_if_t<sfinae, size_type> index_,
-                          column_traits<0>::rvalue_type ptr,
-                          column_traits<1>::rvalue_type count)    //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::template rows_fillable_from<Values...>, typename... Values)
+        events& resize(size_type new_size, const Values&... values)
         {
-            table_.emplace(index_,
-                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
-                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            timestamp_index_.reserve(new_size);
+            id_index_.reserve(new_size);
+            table_.resize(new_size, values...);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                timestamp_index_.push_back(table_.template column<0>(), i);
+                id_index_.push_back(table_.template column<1>(), i);
+            }
             return *this;
         }
 
-        // ------ insert(iterator) ---------------------------------------------------------------------
+        events& resize_for_overwrite(size_type) = delete;
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
-        SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
-                                                  column_traits<0>::param_type ptr,
-                                                  column_traits<1>::param_type count) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+        span_type append_uninitialized(size_type) = delete;
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_swap_member<table_type>::value)
+        std::enable_if_t<sfinae, void> swap(events& other) //
+            noexcept(soagen::detail::has_nothrow_swap_member<table_type>::value)
         {
-            table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(ptr),
-                           static_cast<column_traits<1>::param_forward_type>(count));
-            return iter_;
+            table_.swap(other.table_);
+            timestamp_index_.swap(other.timestamp_index_);
+            id_index_.swap(other.id_index_);
         }
 
-        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
-        SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
-                                                        column_traits<0>::param_type ptr,
-                                                        column_traits<1>::param_type count) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                           //
+        void rebuild_indexes()
         {
-            table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(ptr),
-                           static_cast<column_traits<1>::param_forward_type>(count));
+            if (table_.empty())
+            {
+                timestamp_index_.clear();
+                id_index_.clear();
+                return;
+            }
+
+            timestamp_index_.rebuild(table_.template column<0>(), table_.size());
+            id_index_.rebuild(table_.template column<1>(), table_.size());
+        }
+
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::optional<size_type> find(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+        {
+            if (table_.empty())
+                return {};
+
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return timestamp_index_.find(table_.template column<0>(), key);
+            else if constexpr (static_cast<size_type>(Column) == 1)
+                return id_index_.find(table_.template column<1>(), key);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have an index");
+        }
+
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::row_indices equal_range(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+        {
+            if (table_.empty())
+                return {};
+
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return timestamp_index_.equal_range(table_.template column<0>(), key);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have a sorted index");
+        }
+
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::row_indices range(const std::remove_cv_t<column_type<Column>>& lo,
+                                  const std::remove_cv_t<column_type<Column>>& hi) const noexcept
+        {
+            if (table_.empty())
+                return {};
+
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return timestamp_index_.range(table_.template column<0>(), lo, hi);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have a sorted index");
+        }
+
+        SOAGEN_NODISCARD
+        soagen::row_indices equal_range(const std::remove_cv_t<column_type<0>>& key) const noexcept
+        {
+            return equal_range<0>(key);
+        }
+
+        SOAGEN_NODISCARD
+        soagen::row_indices range(const std::remove_cv_t<column_type<0>>& lo,
+                                  const std::remove_cv_t<column_type<0>>& hi) const noexcept
+        {
+            return range<0>(lo, hi);
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        events& push_back(column_traits<0>::param_type timestamp,
+                          column_traits<1>::param_type id,
+                          column_traits<2>::param_type value = 0)                           //
+            noexcept(table_traits::push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(timestamp),
+                                static_cast<column_traits<1>::param_forward_type>(id),
+                                static_cast<column_traits<2>::param_forward_type>(value));
+            timestamp_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            id_index_.push_back(table_.template column<1>(), table_.size() - 1u);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        events& push_back(column_traits<0>::rvalue_type timestamp,
+                          column_traits<1>::rvalue_type id,
+                          column_traits<2>::rvalue_type value = 0)                                 //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(timestamp),
+                                static_cast<column_traits<1>::rvalue_forward_type>(id),
+                                static_cast<column_traits<2>::rvalue_forward_type>(value));
+            timestamp_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            id_index_.push_back(table_.template column<1>(), table_.size() - 1u);
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Timestamp&&, Id&&, Value&&>), //
+                                    typename Timestamp,
+                                    typename Id,
+                                    typename Value = column_traits<2>::default_emplace_type) //
+        SOAGEN_CONSTEXPR_20
+        events& emplace_back(Timestamp&& timestamp, Id&& id, Value&& value = 0) //
+            noexcept(
+                table_traits::emplace_back_is_nothrow<table_type, Timestamp&&, Id&&, Value&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<Timestamp&&>(timestamp),
+                                static_cast<Id&&>(id),
+                                static_cast<Value&&>(value));
+            timestamp_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            id_index_.push_back(table_.template column<1>(), table_.size() - 1u);
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        events& emplace_back(Tuple&& tuple_)                                                            //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            timestamp_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            id_index_.push_back(table_.template column<1>(), table_.size() - 1u);
+            return *this;
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, events&> insert(size_type index_,
+                                                 column_traits<0>::param_type timestamp,
+                                                 column_traits<1>::param_type id,
+                                                 column_traits<2>::param_type value = 0) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(timestamp),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), index_, table_.size());
+            id_index_.insert(table_.template column<1>(), index_, table_.size());
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        events& insert(std::enable_if_t<sfinae, size_type> index_,
+                       column_traits<0>::rvalue_type timestamp,
+                       column_traits<1>::rvalue_type id,
+                       column_traits<2>::rvalue_type value = 0)                          //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(timestamp),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), index_, table_.size());
+            id_index_.insert(table_.template column<1>(), index_, table_.size());
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type timestamp,
+                                                  column_traits<1>::param_type id,
+                                                  column_traits<2>::param_type value = 0) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_)  //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(timestamp),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type timestamp,
+                                                        column_traits<1>::param_type id,
+                                                        column_traits<2>::param_type value = 0) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_)        //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(timestamp),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type timestamp,
+                        column_traits<1>::rvalue_type id,
+                        column_traits<2>::rvalue_type value = 0)                         //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(timestamp),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type timestamp,
+                              column_traits<1>::rvalue_type id,
+                              column_traits<2>::rvalue_type value = 0)                   //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(timestamp),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Timestamp,
+            typename Id,
+            typename Value = column_traits<2>::default_emplace_type,
+            bool sfinae    = table_traits::row_constructible_from<Timestamp&&, Id&&, Value&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, events&> emplace(size_type index_,
+                                                  Timestamp&& timestamp,
+                                                  Id&& id,
+                                                  Value&& value = 0)                                                  //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Timestamp&&, Id&&, Value&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_,
+                           static_cast<Timestamp&&>(timestamp),
+                           static_cast<Id&&>(id),
+                           static_cast<Value&&>(value));
+            timestamp_index_.insert(table_.template column<0>(), index_, table_.size());
+            id_index_.insert(table_.template column<1>(), index_, table_.size());
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        events& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_)                //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            timestamp_index_.insert(table_.template column<0>(), index_, table_.size());
+            id_index_.insert(table_.template column<1>(), index_, table_.size());
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Timestamp,
+            typename Id,
+            typename Value = column_traits<2>::default_emplace_type,
+            bool sfinae    = table_traits::row_constructible_from<Timestamp&&, Id&&, Value&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Timestamp&& timestamp, Id&& id, Value&& value = 0) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Timestamp&&, Id&&, Value&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Timestamp&&>(timestamp),
+                           static_cast<Id&&>(id),
+                           static_cast<Value&&>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_)                 //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Timestamp,
+            typename Id,
+            typename Value = column_traits<2>::default_emplace_type,
+            bool sfinae    = table_traits::row_constructible_from<Timestamp&&, Id&&, Value&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_,
+                                                         Timestamp&& timestamp,
+                                                         Id&& id,
+                                                         Value&& value = 0)                                           //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Timestamp&&, Id&&, Value&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Timestamp&&>(timestamp),
+                           static_cast<Id&&>(id),
+                           static_cast<Value&&>(value));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_)     //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
+        {
+            timestamp_index_.reserve(table_.size() + 1u);
+            id_index_.reserve(table_.size() + 1u);
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            timestamp_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            id_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(events, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<events, Column>>(table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(events, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<events, Column>>(table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<events>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(events& lhs, events& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<events>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// fragile
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES fragile //
+        : public soagen::mixins::size_and_capacity<fragile>,
+          public soagen::mixins::resizable<fragile>,
+          public soagen::mixins::equality_comparable<fragile>,
+          public soagen::mixins::less_than_comparable<fragile>,
+          public soagen::mixins::data_ptr<fragile>,
+          public soagen::mixins::columns<fragile>,
+          public soagen::mixins::rows<fragile>,
+          public soagen::mixins::iterators<fragile>,
+          public soagen::mixins::spans<fragile>,
+          public soagen::mixins::swappable<fragile>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<fragile>;
+
+        using table_type = soagen::table_type<fragile>;
+
+        using table_traits = soagen::table_traits_type<fragile>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<fragile>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<fragile>;
+
+        using const_iterator = soagen::const_iterator_type<fragile>;
+
+        using span_type = soagen::span_type<fragile>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<fragile>;
+
+        using const_span_type = soagen::const_span_type<fragile>;
+
+        using row_type = soagen::row_type<fragile>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<fragile>;
+
+        using const_row_type = soagen::const_row_type<fragile>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            v   = 0,
+            tag = 1,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name =
+            soagen::detail::column_name<fragile, static_cast<size_type>(Column)>::value;
+
+        struct value_type
+        {
+            tests::throwing v;
+            int tag;
+        };
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        fragile() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        fragile(fragile&&) = default;
+
+        fragile& operator=(fragile&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        fragile(const fragile&) = default;
+
+        fragile& operator=(const fragile&) = default;
+
+        ~fragile() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit fragile(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit fragile(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, fragile&> erase(size_type pos)                   //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        fragile& push_back(column_traits<0>::param_type v, column_traits<1>::param_type tag) //
+            noexcept(table_traits::push_back_is_nothrow<table_type>)                         //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(v),
+                                static_cast<column_traits<1>::param_forward_type>(tag));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        fragile& push_back(column_traits<0>::rvalue_type v, column_traits<1>::rvalue_type tag) //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                    //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(v),
+                                static_cast<column_traits<1>::rvalue_forward_type>(tag));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<V&&, Tag&&>), //
+                                    typename V,
+                                    typename Tag) //
+        SOAGEN_CONSTEXPR_20
+        fragile& emplace_back(V&& v, Tag&& tag)                                     //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, V&&, Tag&&>) //
+        {
+            table_.emplace_back(static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        fragile& emplace_back(Tuple&& tuple_)                                    //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        fragile& append_from_aos(const value_type* src, size_type count)
+        {
+            soagen::append_from_aos(table_, src, count, &value_type::v, &value_type::tag);
+            return *this;
+        }
+
+        void copy_to_aos(value_type* dest, size_type start, size_type count) const
+        {
+            soagen::copy_to_aos(table_, dest, start, count, &value_type::v, &value_type::tag);
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, fragile&> insert(size_type index_,
+                                                  column_traits<0>::param_type v,
+                                                  column_traits<1>::param_type tag) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                   //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(v),
+                           static_cast<column_traits<1>::param_forward_type>(tag));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        fragile& insert(std::enable_if_t<sfinae, size_type> index_,
+                        column_traits<0>::rvalue_type v,
+                        column_traits<1>::rvalue_type tag)        //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(v),
+                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type v,
+                                                  column_traits<1>::param_type tag) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                   //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(v),
+                           static_cast<column_traits<1>::param_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type v,
+                                                        column_traits<1>::param_type tag) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                         //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(v),
+                           static_cast<column_traits<1>::param_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type v,
+                        column_traits<1>::rvalue_type tag)        //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(v),
+                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type v,
+                              column_traits<1>::rvalue_type tag)  //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(v),
+                           static_cast<column_traits<1>::rvalue_forward_type>(tag));
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename V,
+                                    typename Tag,
+                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, fragile&> emplace(size_type index_, V&& v, Tag&& tag) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)         //
+        {
+            table_.emplace(index_, static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        fragile& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)          //
+        {
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename V,
+                                    typename Tag,
+                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, V&& v, Tag&& tag) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)       //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename V,
+                                    typename Tag,
+                                    bool sfinae = table_traits::row_constructible_from<V&&, Tag&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, V&& v, Tag&& tag) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, V&&, Tag&&>)                   //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<V&&>(v), static_cast<Tag&&>(tag));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(fragile, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<fragile, Column>>(table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(fragile, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<fragile, Column>>(table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<fragile>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(fragile& lhs, fragile& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<fragile>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// fragile2
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES fragile2 //
+        : public soagen::mixins::size_and_capacity<fragile2>,
+          public soagen::mixins::resizable<fragile2>,
+          public soagen::mixins::equality_comparable<fragile2>,
+          public soagen::mixins::less_than_comparable<fragile2>,
+          public soagen::mixins::data_ptr<fragile2>,
+          public soagen::mixins::columns<fragile2>,
+          public soagen::mixins::rows<fragile2>,
+          public soagen::mixins::iterators<fragile2>,
+          public soagen::mixins::spans<fragile2>,
+          public soagen::mixins::swappable<fragile2>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<fragile2>;
+
+        using table_type = soagen::table_type<fragile2>;
+
+        using table_traits = soagen::table_traits_type<fragile2>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<fragile2>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<fragile2>;
+
+        using const_iterator = soagen::const_iterator_type<fragile2>;
+
+        using span_type = soagen::span_type<fragile2>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<fragile2>;
+
+        using const_span_type = soagen::const_span_type<fragile2>;
+
+        using row_type = soagen::row_type<fragile2>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<fragile2>;
+
+        using const_row_type = soagen::const_row_type<fragile2>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            a = 0,
+            b = 1,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name =
+            soagen::detail::column_name<fragile2, static_cast<size_type>(Column)>::value;
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        fragile2() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        fragile2(fragile2&&) = default;
+
+        fragile2& operator=(fragile2&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        fragile2(const fragile2&) = default;
+
+        fragile2& operator=(const fragile2&) = default;
+
+        ~fragile2() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit fragile2(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit fragile2(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, fragile2&> erase(size_type pos)                  //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile2& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile2& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        fragile2& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        fragile2& push_back(column_traits<0>::param_type a, column_traits<1>::param_type b) //
+            noexcept(table_traits::push_back_is_nothrow<table_type>)                        //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(a),
+                                static_cast<column_traits<1>::param_forward_type>(b));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        fragile2& push_back(column_traits<0>::rvalue_type a, column_traits<1>::rvalue_type b) //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                   //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(a),
+                                static_cast<column_traits<1>::rvalue_forward_type>(b));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<A&&, B&&>), //
+                                    typename A,
+                                    typename B) //
+        SOAGEN_CONSTEXPR_20
+        fragile2& emplace_back(A&& a, B&& b)                                      //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, A&&, B&&>) //
+        {
+            table_.emplace_back(static_cast<A&&>(a), static_cast<B&&>(b));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        fragile2& emplace_back(Tuple&& tuple_)                                   //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, fragile2&> insert(size_type index_,
+                                                   column_traits<0>::param_type a,
+                                                   column_traits<1>::param_type b) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                  //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(a),
+                           static_cast<column_traits<1>::param_forward_type>(b));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        fragile2& insert(std::enable_if_t<sfinae, size_type> index_,
+                         column_traits<0>::rvalue_type a,
+                         column_traits<1>::rvalue_type b)         //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(a),
+                           static_cast<column_traits<1>::rvalue_forward_type>(b));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type a,
+                                                  column_traits<1>::param_type b) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                 //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(a),
+                           static_cast<column_traits<1>::param_forward_type>(b));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type a,
+                                                        column_traits<1>::param_type b) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                       //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(a),
+                           static_cast<column_traits<1>::param_forward_type>(b));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type a,
+                        column_traits<1>::rvalue_type b)          //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(a),
+                           static_cast<column_traits<1>::rvalue_forward_type>(b));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type a,
+                              column_traits<1>::rvalue_type b)    //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(a),
+                           static_cast<column_traits<1>::rvalue_forward_type>(b));
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename A,
+                                    typename B,
+                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, fragile2&> emplace(size_type index_, A&& a, B&& b) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)        //
+        {
+            table_.emplace(index_, static_cast<A&&>(a), static_cast<B&&>(b));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        fragile2& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)           //
+        {
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename A,
+                                    typename B,
+                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, A&& a, B&& b) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)     //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<A&&>(a), static_cast<B&&>(b));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename A,
+                                    typename B,
+                                    bool sfinae = table_traits::row_constructible_from<A&&, B&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, A&& a, B&& b) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, A&&, B&&>)                 //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<A&&>(a), static_cast<B&&>(b));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(fragile2, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<fragile2, Column>>(table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(fragile2, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<fragile2, Column>>(table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<fragile2>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(fragile2& lhs, fragile2& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<fragile2>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// move_only
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES move_only //
+        : public soagen::mixins::size_and_capacity<move_only>,
+          public soagen::mixins::resizable<move_only>,
+          public soagen::mixins::equality_comparable<move_only>,
+          public soagen::mixins::less_than_comparable<move_only>,
+          public soagen::mixins::data_ptr<move_only>,
+          public soagen::mixins::columns<move_only>,
+          public soagen::mixins::rows<move_only>,
+          public soagen::mixins::iterators<move_only>,
+          public soagen::mixins::spans<move_only>,
+          public soagen::mixins::swappable<move_only>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<move_only>;
+
+        using table_type = soagen::table_type<move_only>;
+
+        using table_traits = soagen::table_traits_type<move_only>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<move_only>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<move_only>;
+
+        using const_iterator = soagen::const_iterator_type<move_only>;
+
+        using span_type = soagen::span_type<move_only>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<move_only>;
+
+        using const_span_type = soagen::const_span_type<move_only>;
+
+        using row_type = soagen::row_type<move_only>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<move_only>;
+
+        using const_row_type = soagen::const_row_type<move_only>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            ptr   = 0,
+            count = 1,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name =
+            soagen::detail::column_name<move_only, static_cast<size_type>(Column)>::value;
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        move_only() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        move_only(move_only&&) = default;
+
+        move_only& operator=(move_only&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        move_only(const move_only&) = default;
+
+        move_only& operator=(const move_only&) = default;
+
+        ~move_only() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit move_only(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit move_only(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, move_only&> erase(size_type pos)                 //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        move_only& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        move_only& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        move_only& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        move_only& push_back(column_traits<0>::param_type ptr, column_traits<1>::param_type count) //
+            noexcept(table_traits::push_back_is_nothrow<table_type>)                               //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(ptr),
+                                static_cast<column_traits<1>::param_forward_type>(count));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        move_only& push_back(column_traits<0>::rvalue_type ptr, column_traits<1>::rvalue_type count) //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>)                          //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(ptr),
+                                static_cast<column_traits<1>::rvalue_forward_type>(count));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Ptr&&, Count&&>), //
+                                    typename Ptr,
+                                    typename Count) //
+        SOAGEN_CONSTEXPR_20
+        move_only& emplace_back(Ptr&& ptr, Count&& count)                               //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Ptr&&, Count&&>) //
+        {
+            table_.emplace_back(static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        move_only& emplace_back(Tuple&& tuple_)                                  //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, move_only&> insert(size_type index_,
+                                                    column_traits<0>::param_type ptr,
+                                                    column_traits<1>::param_type count) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                       //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(ptr),
+                           static_cast<column_traits<1>::param_forward_type>(count));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        move_only& insert(std::enable_if_t<sfinae, size_type> index_,
+                          column_traits<0>::rvalue_type ptr,
+                          column_traits<1>::rvalue_type count)    //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
+                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type ptr,
+                                                  column_traits<1>::param_type count) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(ptr),
+                           static_cast<column_traits<1>::param_forward_type>(count));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type ptr,
+                                                        column_traits<1>::param_type count) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                           //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(ptr),
+                           static_cast<column_traits<1>::param_forward_type>(count));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type ptr,
+                        column_traits<1>::rvalue_type count)      //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
+                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type ptr,
+                              column_traits<1>::rvalue_type count) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)  //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
+                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Ptr,
+                                    typename Count,
+                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                               && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, move_only&> emplace(size_type index_, Ptr&& ptr, Count&& count) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)               //
+        {
+            table_.emplace(index_, static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        move_only& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)            //
+        {
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Ptr,
+                                    typename Count,
+                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                               && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Ptr&& ptr, Count&& count) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)           //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Ptr,
+                                    typename Count,
+                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                               && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, Ptr&& ptr, Count&& count) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)                       //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(move_only, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<move_only, Column>>(
+                table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(move_only, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<move_only, Column>>(
+                table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<move_only>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(move_only& lhs, move_only& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<move_only>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// packed
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES packed //
+        : public soagen::mixins::size_and_capacity<packed>,
+          public soagen::mixins::resizable<packed>,
+          public soagen::mixins::equality_comparable<packed>,
+          public soagen::mixins::less_than_comparable<packed>,
+          public soagen::mixins::data_ptr<packed>,
+          public soagen::mixins::columns<packed>,
+          public soagen::mixins::rows<packed>,
+          public soagen::mixins::iterators<packed>,
+          public soagen::mixins::spans<packed>,
+          public soagen::mixins::swappable<packed>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<packed>;
+
+        using table_type = soagen::table_type<packed>;
+
+        using table_traits = soagen::table_traits_type<packed>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<packed>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<packed>;
+
+        using const_iterator = soagen::const_iterator_type<packed>;
+
+        using span_type = soagen::span_type<packed>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<packed>;
+
+        using const_span_type = soagen::const_span_type<packed>;
+
+        using row_type = soagen::row_type<packed>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<packed>;
+
+        using const_row_type = soagen::const_row_type<packed>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            flag = 0,
+            pos  = 1,
+            id   = 2,
+            mass = 3,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name = soagen::detail::column_name<packed, static_cast<size_type>(Column)>::value;
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        packed() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        packed(packed&&) = default;
+
+        packed& operator=(packed&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        packed(const packed&) = default;
+
+        packed& operator=(const packed&) = default;
+
+        ~packed() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit packed(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit packed(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, packed&> erase(size_type pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        packed& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        packed& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        packed& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        packed& push_back(column_traits<0>::param_type flag,
+                          column_traits<1>::param_type pos,
+                          column_traits<2>::param_type id,
+                          column_traits<3>::param_type mass)         //
+            noexcept(table_traits::push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(flag),
+                                static_cast<column_traits<1>::param_forward_type>(pos),
+                                static_cast<column_traits<2>::param_forward_type>(id),
+                                static_cast<column_traits<3>::param_forward_type>(mass));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        packed& push_back(column_traits<0>::rvalue_type flag,
+                          column_traits<1>::rvalue_type pos,
+                          column_traits<2>::rvalue_type id,
+                          column_traits<3>::rvalue_type mass)               //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(flag),
+                                static_cast<column_traits<1>::rvalue_forward_type>(pos),
+                                static_cast<column_traits<2>::rvalue_forward_type>(id),
+                                static_cast<column_traits<3>::rvalue_forward_type>(mass));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Flag&&, Pos&&, Id&&, Mass&&>), //
+                                    typename Flag,
+                                    typename Pos,
+                                    typename Id,
+                                    typename Mass) //
+        SOAGEN_CONSTEXPR_20
+        packed& emplace_back(Flag&& flag, Pos&& pos, Id&& id, Mass&& mass)                           //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Flag&&, Pos&&, Id&&, Mass&&>) //
+        {
+            table_.emplace_back(static_cast<Flag&&>(flag),
+                                static_cast<Pos&&>(pos),
+                                static_cast<Id&&>(id),
+                                static_cast<Mass&&>(mass));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        packed& emplace_back(Tuple&& tuple_)                                     //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, packed&> insert(size_type index_,
+                                                 column_traits<0>::param_type flag,
+                                                 column_traits<1>::param_type pos,
+                                                 column_traits<2>::param_type id,
+                                                 column_traits<3>::param_type mass) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                   //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(flag),
+                           static_cast<column_traits<1>::param_forward_type>(pos),
+                           static_cast<column_traits<2>::param_forward_type>(id),
+                           static_cast<column_traits<3>::param_forward_type>(mass));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        packed& insert(std::enable_if_t<sfinae, size_type> index_,
+                       column_traits<0>::rvalue_type flag,
+                       column_traits<1>::rvalue_type pos,
+                       column_traits<2>::rvalue_type id,
+                       column_traits<3>::rvalue_type mass)        //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(flag),
+                           static_cast<column_traits<1>::rvalue_forward_type>(pos),
+                           static_cast<column_traits<2>::rvalue_forward_type>(id),
+                           static_cast<column_traits<3>::rvalue_forward_type>(mass));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type flag,
+                                                  column_traits<1>::param_type pos,
+                                                  column_traits<2>::param_type id,
+                                                  column_traits<3>::param_type mass) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(flag),
+                           static_cast<column_traits<1>::param_forward_type>(pos),
+                           static_cast<column_traits<2>::param_forward_type>(id),
+                           static_cast<column_traits<3>::param_forward_type>(mass));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type flag,
+                                                        column_traits<1>::param_type pos,
+                                                        column_traits<2>::param_type id,
+                                                        column_traits<3>::param_type mass) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                          //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(flag),
+                           static_cast<column_traits<1>::param_forward_type>(pos),
+                           static_cast<column_traits<2>::param_forward_type>(id),
+                           static_cast<column_traits<3>::param_forward_type>(mass));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type flag,
+                        column_traits<1>::rvalue_type pos,
+                        column_traits<2>::rvalue_type id,
+                        column_traits<3>::rvalue_type mass)       //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(flag),
+                           static_cast<column_traits<1>::rvalue_forward_type>(pos),
+                           static_cast<column_traits<2>::rvalue_forward_type>(id),
+                           static_cast<column_traits<3>::rvalue_forward_type>(mass));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type flag,
+                              column_traits<1>::rvalue_type pos,
+                              column_traits<2>::rvalue_type id,
+                              column_traits<3>::rvalue_type mass) //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(flag),
+                           static_cast<column_traits<1>::rvalue_forward_type>(pos),
+                           static_cast<column_traits<2>::rvalue_forward_type>(id),
+                           static_cast<column_traits<3>::rvalue_forward_type>(mass));
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Flag,
+            typename Pos,
+            typename Id,
+            typename Mass,
+            bool sfinae = table_traits::row_constructible_from<Flag&&, Pos&&, Id&&, Mass&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, packed&> emplace(size_type index_, Flag&& flag, Pos&& pos, Id&& id, Mass&& mass) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Flag&&, Pos&&, Id&&, Mass&&>)                   //
+        {
+            table_.emplace(index_,
+                           static_cast<Flag&&>(flag),
+                           static_cast<Pos&&>(pos),
+                           static_cast<Id&&>(id),
+                           static_cast<Mass&&>(mass));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        packed& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)         //
+        {
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Flag,
+            typename Pos,
+            typename Id,
+            typename Mass,
+            bool sfinae = table_traits::row_constructible_from<Flag&&, Pos&&, Id&&, Mass&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Flag&& flag, Pos&& pos, Id&& id, Mass&& mass) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Flag&&, Pos&&, Id&&, Mass&&>)                  //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Flag&&>(flag),
+                           static_cast<Pos&&>(pos),
+                           static_cast<Id&&>(id),
+                           static_cast<Mass&&>(mass));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Flag,
+            typename Pos,
+            typename Id,
+            typename Mass,
+            bool sfinae = table_traits::row_constructible_from<Flag&&, Pos&&, Id&&, Mass&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_,
+                                                         Flag&& flag,
+                                                         Pos&& pos,
+                                                         Id&& id,
+                                                         Mass&& mass)                           //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Flag&&, Pos&&, Id&&, Mass&&>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Flag&&>(flag),
+                           static_cast<Pos&&>(pos),
+                           static_cast<Id&&>(id),
+                           static_cast<Mass&&>(mass));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(packed, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<packed, Column>>(table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(packed, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<packed, Column>>(table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<packed>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(packed& lhs, packed& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<packed>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// rich
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES rich //
+        : public soagen::mixins::size_and_capacity<rich>,
+          public soagen::mixins::resizable<rich>,
+          public soagen::mixins::equality_comparable<rich>,
+          public soagen::mixins::less_than_comparable<rich>,
+          public soagen::mixins::data_ptr<rich>,
+          public soagen::mixins::columns<rich>,
+          public soagen::mixins::rows<rich>,
+          public soagen::mixins::iterators<rich>,
+          public soagen::mixins::spans<rich>,
+          public soagen::mixins::swappable<rich>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<rich>;
+
+        using table_type = soagen::table_type<rich>;
+
+        using table_traits = soagen::table_traits_type<rich>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<rich>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<rich>;
+
+        using const_iterator = soagen::const_iterator_type<rich>;
+
+        using span_type = soagen::span_type<rich>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<rich>;
+
+        using const_span_type = soagen::const_span_type<rich>;
+
+        using row_type = soagen::row_type<rich>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<rich>;
+
+        using const_row_type = soagen::const_row_type<rich>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            name          = 0,
+            id            = 1,
+            date_of_birth = 2,
+            salary        = 3,
+            tag           = 4,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name = soagen::detail::column_name<rich, static_cast<size_type>(Column)>::value;
+
+        struct value_type
+        {
+            std::remove_cv_t<const std::string> name;
+            unsigned long long id;
+            std::tuple<int, int, int> date_of_birth;
+            int salary;
+            int* tag = nullptr;
+        };
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        rich() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        rich(rich&&) = default;
+
+        rich& operator=(rich&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        rich(const rich&) = default;
+
+        rich& operator=(const rich&) = default;
+
+        ~rich() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit rich(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit rich(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, rich&> erase(size_type pos)                      //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        rich& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        rich& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        rich& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        rich& push_back(column_traits<0>::param_type name,
+                        column_traits<1>::param_type id,
+                        column_traits<2>::param_type date_of_birth,
+                        column_traits<3>::param_type salary,
+                        column_traits<4>::param_type tag = nullptr)  //
+            noexcept(table_traits::push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(name),
+                                static_cast<column_traits<1>::param_forward_type>(id),
+                                static_cast<column_traits<2>::param_forward_type>(date_of_birth),
+                                static_cast<column_traits<3>::param_forward_type>(salary),
+                                static_cast<column_traits<4>::param_forward_type>(tag));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        rich& push_back(column_traits<0>::rvalue_type name,
+                        column_traits<1>::rvalue_type id,
+                        column_traits<2>::rvalue_type date_of_birth,
+                        column_traits<3>::rvalue_type salary,
+                        column_traits<4>::rvalue_type tag = nullptr)        //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(name),
+                                static_cast<column_traits<1>::rvalue_forward_type>(id),
+                                static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
+                                static_cast<column_traits<3>::rvalue_forward_type>(salary),
+                                static_cast<column_traits<4>::rvalue_forward_type>(tag));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            (table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>), //
+            typename Name,
+            typename Id,
+            typename DateOfBirth,
+            typename Salary,
+            typename Tag = column_traits<4>::default_emplace_type) //
+        SOAGEN_CONSTEXPR_20
+        rich& emplace_back(Name&& name, Id&& id, DateOfBirth&& date_of_birth, Salary&& salary, Tag&& tag = nullptr)   //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        {
+            table_.emplace_back(static_cast<Name&&>(name),
+                                static_cast<Id&&>(id),
+                                static_cast<DateOfBirth&&>(date_of_birth),
+                                static_cast<Salary&&>(salary),
+                                static_cast<Tag&&>(tag));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        rich& emplace_back(Tuple&& tuple_)                                       //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        rich& append_from_aos(const value_type* src, size_type count)
+        {
+            soagen::append_from_aos(table_,
+                                    src,
+                                    count,
+                                    &value_type::name,
+                                    &value_type::id,
+                                    &value_type::date_of_birth,
+                                    &value_type::salary,
+                                    &value_type::tag);
+            return *this;
+        }
+
+        void copy_to_aos(value_type* dest, size_type start, size_type count) const
+        {
+            soagen::copy_to_aos(table_,
+                                dest,
+                                start,
+                                count,
+                                &value_type::name,
+                                &value_type::id,
+                                &value_type::date_of_birth,
+                                &value_type::salary,
+                                &value_type::tag);
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, rich&> insert(size_type index_,
+                                               column_traits<0>::param_type name,
+                                               column_traits<1>::param_type id,
+                                               column_traits<2>::param_type date_of_birth,
+                                               column_traits<3>::param_type salary,
+                                               column_traits<4>::param_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                          //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::param_forward_type>(salary),
+                           static_cast<column_traits<4>::param_forward_type>(tag));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        rich& insert(std::enable_if_t<sfinae, size_type> index_,
+                     column_traits<0>::rvalue_type name,
+                     column_traits<1>::rvalue_type id,
+                     column_traits<2>::rvalue_type date_of_birth,
+                     column_traits<3>::rvalue_type salary,
+                     column_traits<4>::rvalue_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
+                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type name,
+                                                  column_traits<1>::param_type id,
+                                                  column_traits<2>::param_type date_of_birth,
+                                                  column_traits<3>::param_type salary,
+                                                  column_traits<4>::param_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                             //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::param_forward_type>(salary),
+                           static_cast<column_traits<4>::param_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type name,
+                                                        column_traits<1>::param_type id,
+                                                        column_traits<2>::param_type date_of_birth,
+                                                        column_traits<3>::param_type salary,
+                                                        column_traits<4>::param_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                                   //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(name),
+                           static_cast<column_traits<1>::param_forward_type>(id),
+                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::param_forward_type>(salary),
+                           static_cast<column_traits<4>::param_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        iterator insert(std::enable_if_t<sfinae, iterator> iter_,
+                        column_traits<0>::rvalue_type name,
+                        column_traits<1>::rvalue_type id,
+                        column_traits<2>::rvalue_type date_of_birth,
+                        column_traits<3>::rvalue_type salary,
+                        column_traits<4>::rvalue_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)    //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
+                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
+                              column_traits<0>::rvalue_type name,
+                              column_traits<1>::rvalue_type id,
+                              column_traits<2>::rvalue_type date_of_birth,
+                              column_traits<3>::rvalue_type salary,
+                              column_traits<4>::rvalue_type tag = nullptr) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)          //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::rvalue_forward_type>(name),
+                           static_cast<column_traits<1>::rvalue_forward_type>(id),
+                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
+                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
+                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+            return iter_;
+        }
+
+        // ------ emplace(size_type) -------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Name,
+            typename Id,
+            typename DateOfBirth,
+            typename Salary,
+            typename Tag = column_traits<4>::default_emplace_type,
+            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
+                        && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, rich&> emplace(size_type index_,
+                                                Name&& name,
+                                                Id&& id,
+                                                DateOfBirth&& date_of_birth,
+                                                Salary&& salary,
+                                                Tag&& tag = nullptr)                                             //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        {
+            table_.emplace(index_,
+                           static_cast<Name&&>(name),
+                           static_cast<Id&&>(id),
+                           static_cast<DateOfBirth&&>(date_of_birth),
+                           static_cast<Salary&&>(salary),
+                           static_cast<Tag&&>(tag));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        rich& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)       //
+        {
+            table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        // ------ emplace(iterator) --------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Name,
+            typename Id,
+            typename DateOfBirth,
+            typename Salary,
+            typename Tag = column_traits<4>::default_emplace_type,
+            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
+                        && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_,
+                                                   Name&& name,
+                                                   Id&& id,
+                                                   DateOfBirth&& date_of_birth,
+                                                   Salary&& salary,
+                                                   Tag&& tag = nullptr)                                          //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Name&&>(name),
+                           static_cast<Id&&>(id),
+                           static_cast<DateOfBirth&&>(date_of_birth),
+                           static_cast<Salary&&>(salary),
+                           static_cast<Tag&&>(tag));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename Name,
+            typename Id,
+            typename DateOfBirth,
+            typename Salary,
+            typename Tag = column_traits<4>::default_emplace_type,
+            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
+                        && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_,
+                                                         Name&& name,
+                                                         Id&& id,
+                                                         DateOfBirth&& date_of_birth,
+                                                         Salary&& salary,
+                                                         Tag&& tag = nullptr)                                    //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<Name&&>(name),
+                           static_cast<Id&&>(id),
+                           static_cast<DateOfBirth&&>(date_of_birth),
+                           static_cast<Salary&&>(salary),
+                           static_cast<Tag&&>(tag));
+            return iter_;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
+                                    typename Tuple,
+                                    bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        {
+            table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            return iter_;
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(rich, Column)
+        constexpr column_type<Column>* column() noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<rich, Column>>(table_.template column<Column>());
+        }
+
+        template <auto Column>
+        SOAGEN_COLUMN(rich, Column)
+        constexpr std::add_const_t<column_type<Column>>* column() const noexcept
+        {
+            static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
+
+            return soagen::assume_aligned<soagen::actual_alignment<rich, Column>>(table_.template column<Column>());
+        }
+    };
+
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<rich>::value)
+    SOAGEN_ALWAYS_INLINE
+    constexpr void swap(rich& lhs, rich& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<rich>::value)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// trivial
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace tests
+{
+    class SOAGEN_EMPTY_BASES trivial //
+        : public soagen::mixins::size_and_capacity<trivial>,
+          public soagen::mixins::resizable<trivial>,
+          public soagen::mixins::equality_comparable<trivial>,
+          public soagen::mixins::less_than_comparable<trivial>,
+          public soagen::mixins::data_ptr<trivial>,
+          public soagen::mixins::columns<trivial>,
+          public soagen::mixins::rows<trivial>,
+          public soagen::mixins::iterators<trivial>,
+          public soagen::mixins::spans<trivial>,
+          public soagen::mixins::swappable<trivial>
+    {
+      public:
+        using size_type = std::size_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        using allocator_type = soagen::allocator_type<trivial>;
+
+        using table_type = soagen::table_type<trivial>;
+
+        using table_traits = soagen::table_traits_type<trivial>;
+
+        static constexpr size_type column_count = table_traits::column_count;
+
+        template <auto Column>
+        using column_traits = typename table_traits::template column<static_cast<size_type>(Column)>;
+
+        template <auto Column>
+        using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
+
+        using iterator = soagen::iterator_type<trivial>;
+
+        using rvalue_iterator = soagen::rvalue_iterator_type<trivial>;
+
+        using const_iterator = soagen::const_iterator_type<trivial>;
+
+        using span_type = soagen::span_type<trivial>;
+
+        using rvalue_span_type = soagen::rvalue_span_type<trivial>;
+
+        using const_span_type = soagen::const_span_type<trivial>;
+
+        using row_type = soagen::row_type<trivial>;
+
+        using rvalue_row_type = soagen::rvalue_row_type<trivial>;
+
+        using const_row_type = soagen::const_row_type<trivial>;
+
+        static constexpr size_type aligned_stride = table_traits::aligned_stride;
+
+        enum class columns : size_type
+        {
+            x     = 0,
+            y     = 1,
+            z     = 2,
+            flags = 3,
+        };
+
+        template <auto Column>
+        static constexpr auto& column_name =
+            soagen::detail::column_name<trivial, static_cast<size_type>(Column)>::value;
+
+        struct value_type
+        {
+            float x;
+            float y;
+            float z;
+            unsigned flags;
+        };
+
+      private:
+        table_type table_;
+
+      public:
+        SOAGEN_NODISCARD_CTOR
+        trivial() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        trivial(trivial&&) = default;
+
+        trivial& operator=(trivial&&) = default;
+
+        SOAGEN_NODISCARD_CTOR
+        trivial(const trivial&) = default;
+
+        trivial& operator=(const trivial&) = default;
+
+        ~trivial() = default;
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit trivial(const allocator_type& alloc) noexcept //
+            : table_{ alloc }
+        {
+        }
+
+        SOAGEN_NODISCARD_CTOR
+        constexpr explicit trivial(allocator_type&& alloc) noexcept //
+            : table_{ static_cast<allocator_type&&>(alloc) }
+        {
+        }
+
+        SOAGEN_INLINE_GETTER
+        SOAGEN_CONSTEXPR_20
+        allocator_type get_allocator() const noexcept
+        {
+            return table_.get_allocator();
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type& table() & noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr table_type&& table() && noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        constexpr const table_type& table() const& noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&() noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator table_type&&() noexcept
+        {
+            return static_cast<table_type&&>(table_);
+        }
+
+        SOAGEN_PURE_INLINE_GETTER
+        explicit constexpr operator const table_type&() const noexcept
+        {
+            return table_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                       //
+        std::enable_if_t<sfinae, trivial&> erase(size_type pos)                   //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(pos);
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20                                                                  //
+        std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
+        {
+            return table_.unordered_erase(pos);
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
+            noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
+        {
+            table_.erase(static_cast<size_type>(pos));
+            return pos;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_unordered_erase_member<table_type>::value)
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
+            noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
+        {
+            if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
+                return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
+            return {};
+        }
+
+        template <auto A, auto B>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        trivial& swap_columns() //
+            noexcept(noexcept(std::declval<table_type&>()
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+        {
+            table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        trivial& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        trivial& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
+        // ------ push_back() --------------------------------------------------------------------------
+
+        SOAGEN_CONSTEXPR_20
+        trivial& push_back(column_traits<0>::param_type x,
+                           column_traits<1>::param_type y,
+                           column_traits<2>::param_type z,
+                           column_traits<3>::param_type flags)       //
+            noexcept(table_traits::push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(x),
+                                static_cast<column_traits<1>::param_forward_type>(y),
+                                static_cast<column_traits<2>::param_forward_type>(z),
+                                static_cast<column_traits<3>::param_forward_type>(flags));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
+        SOAGEN_CONSTEXPR_20
+        trivial& push_back(column_traits<0>::rvalue_type x,
+                           column_traits<1>::rvalue_type y,
+                           column_traits<2>::rvalue_type z,
+                           column_traits<3>::rvalue_type flags)             //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>) //
+        {
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(x),
+                                static_cast<column_traits<1>::rvalue_forward_type>(y),
+                                static_cast<column_traits<2>::rvalue_forward_type>(z),
+                                static_cast<column_traits<3>::rvalue_forward_type>(flags));
+            return *this;
+        }
+
+        // ------ emplace_back() -----------------------------------------------------------------------
+
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>), //
+                                    typename X,
+                                    typename Y,
+                                    typename Z,
+                                    typename Flags) //
+        SOAGEN_CONSTEXPR_20
+        trivial& emplace_back(X&& x, Y&& y, Z&& z, Flags&& flags)                               //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>) //
+        {
+            table_.emplace_back(static_cast<X&&>(x),
+                                static_cast<Y&&>(y),
+                                static_cast<Z&&>(z),
+                                static_cast<Flags&&>(flags));
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
+        SOAGEN_CONSTEXPR_20
+        trivial& emplace_back(Tuple&& tuple_)                                    //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        {
+            table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            return *this;
+        }
+
+        trivial& append_from_aos(const value_type* src, size_type count)
+        {
+            soagen::append_from_aos(table_,
+                                    src,
+                                    count,
+                                    &value_type::x,
+                                    &value_type::y,
+                                    &value_type::z,
+                                    &value_type::flags);
+            return *this;
+        }
+
+        void copy_to_aos(value_type* dest, size_type start, size_type count) const
+        {
+            soagen::copy_to_aos(table_,
+                                dest,
+                                start,
+                                count,
+                                &value_type::x,
+                                &value_type::y,
+                                &value_type::z,
+                                &value_type::flags);
+        }
+
+      private:
+        static constexpr bool can_insert_ =
+            table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
+
+        static constexpr bool can_insert_rvalues_ = can_insert_ && table_traits::rvalues_are_distinct;
+
+      public:
+        // ------ insert(size_type) --------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, trivial&> insert(size_type index_,
+                                                  column_traits<0>::param_type x,
+                                                  column_traits<1>::param_type y,
+                                                  column_traits<2>::param_type z,
+                                                  column_traits<3>::param_type flags) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::param_forward_type>(x),
+                           static_cast<column_traits<1>::param_forward_type>(y),
+                           static_cast<column_traits<2>::param_forward_type>(z),
+                           static_cast<column_traits<3>::param_forward_type>(flags));
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
+        SOAGEN_CONSTEXPR_20
+        trivial& insert(std::enable_if_t<sfinae, size_type> index_,
+                        column_traits<0>::rvalue_type x,
+                        column_traits<1>::rvalue_type y,
+                        column_traits<2>::rvalue_type z,
+                        column_traits<3>::rvalue_type flags)      //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        {
+            table_.emplace(index_,
+                           static_cast<column_traits<0>::rvalue_forward_type>(x),
+                           static_cast<column_traits<1>::rvalue_forward_type>(y),
+                           static_cast<column_traits<2>::rvalue_forward_type>(z),
+                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
+            return *this;
+        }
+
+        // ------ insert(iterator) ---------------------------------------------------------------------
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, iterator> insert(iterator iter_,
+                                                  column_traits<0>::param_type x,
+                                                  column_traits<1>::param_type y,
+                                                  column_traits<2>::param_type z,
+                                                  column_traits<3>::param_type flags) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(x),
+                           static_cast<column_traits<1>::param_forward_type>(y),
+                           static_cast<column_traits<2>::param_forward_type>(z),
+                           static_cast<column_traits<3>::param_forward_type>(flags));
+            return iter_;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
+                                                        column_traits<0>::param_type x,
+                                                        column_traits<1>::param_type y,
+                                                        column_traits<2>::param_type z,
+                                                        column_traits<3>::param_type flags) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                           //
+        {
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(x),
+                           static_cast<column_traits<1>::param_forward_type>(y),
+                           static_cast<column_traits<2>::param_forward_type>(z),
+                           static_cast<column_traits<3>::param_forward_type>(flags));
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         iterator insert(std::enable_if_t<sfinae, iterator> iter_,
-                        column_traits<0>::rvalue_type ptr,
-                        column_traits<1>::rvalue_type count)      //
+                        column_traits<0>::rvalue_type x,
+                        column_traits<1>::rvalue_type y,
+                        column_traits<2>::rvalue_type z,
+                        column_traits<3>::rvalue_type flags)      //
             noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
-                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+                           static_cast<column_traits<0>::rvalue_forward_type>(x),
+                           static_cast<column_traits<1>::rvalue_forward_type>(y),
+                           static_cast<column_traits<2>::rvalue_forward_type>(z),
+                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
-                              column_traits<0>::rvalue_type ptr,
-                              column_traits<1>::rvalue_type count) //
+                              column_traits<0>::rvalue_type x,
+                              column_traits<1>::rvalue_type y,
+                              column_traits<2>::rvalue_type z,
+                              column_traits<3>::rvalue_type flags) //
             noexcept(table_traits::insert_is_nothrow<table_type>)  //
         {
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(ptr),
-                           static_cast<column_traits<1>::rvalue_forward_type>(count));
+                           static_cast<column_traits<0>::rvalue_forward_type>(x),
+                           static_cast<column_traits<1>::rvalue_forward_type>(y),
+                           static_cast<column_traits<2>::rvalue_forward_type>(z),
+                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
             return iter_;
         }
 
         // ------ emplace(size_type) -------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename Ptr,
-                                    typename Count,
-                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                    typename X,
+                                    typename Y,
+                                    typename Z,
+                                    typename Flags,
+                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
                                                && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, move_only&> emplace(size_type index_, Ptr&& ptr, Count&& count) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)               //
+        std::enable_if_t<sfinae, trivial&> emplace(size_type index_, X&& x, Y&& y, Z&& z, Flags&& flags) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)               //
         {
-            table_.emplace(index_, static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            table_.emplace(index_,
+                           static_cast<X&&>(x),
+                           static_cast<Y&&>(y),
+                           static_cast<Z&&>(z),
+                           static_cast<Flags&&>(flags));
             return *this;
         }
 
@@ -2079,8 +6250,8 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        move_only& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)            //
+        trivial& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)          //
         {
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
             return *this;
@@ -2089,15 +6260,21 @@ namespace tests
         // ------ emplace(iterator) --------------------------------------------------------------------
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename Ptr,
-                                    typename Count,
-                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                    typename X,
+                                    typename Y,
+                                    typename Z,
+                                    typename Flags,
+                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
                                                && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Ptr&& ptr, Count&& count) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)           //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, X&& x, Y&& y, Z&& z, Flags&& flags) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)             //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<X&&>(x),
+                           static_cast<Y&&>(y),
+                           static_cast<Z&&>(z),
+                           static_cast<Flags&&>(flags));
             return iter_;
         }
 
@@ -2113,15 +6290,21 @@ namespace tests
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename Ptr,
-                                    typename Count,
-                                    bool sfinae = table_traits::row_constructible_from<Ptr&&, Count&&>
+                                    typename X,
+                                    typename Y,
+                                    typename Z,
+                                    typename Flags,
+                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
                                                && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, Ptr&& ptr, Count&& count) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Ptr&&, Count&&>)                       //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, X&& x, Y&& y, Z&& z, Flags&& flags) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)                         //
         {
-            table_.emplace(static_cast<size_type>(iter_), static_cast<Ptr&&>(ptr), static_cast<Count&&>(count));
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<X&&>(x),
+                           static_cast<Y&&>(y),
+                           static_cast<Z&&>(z),
+                           static_cast<Flags&&>(flags));
             return iter_;
         }
 
@@ -2137,63 +6320,61 @@ namespace tests
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(move_only, Column)
+        SOAGEN_COLUMN(trivial, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<move_only, Column>>(
-                table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<trivial, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(move_only, Column)
+        SOAGEN_COLUMN(trivial, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<move_only, Column>>(
-                table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<trivial, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<move_only>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<trivial>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(move_only& lhs, move_only& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<move_only>::value)
+    constexpr void swap(trivial& lhs, trivial& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<trivial>::value)
     {
         lhs.swap(rhs);
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-// rich
+// units
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES rich //
-        : public soagen::mixins::size_and_capacity<rich>,
-          public soagen::mixins::resizable<rich>,
-          public soagen::mixins::equality_comparable<rich>,
-          public soagen::mixins::less_than_comparable<rich>,
-          public soagen::mixins::data_ptr<rich>,
-          public soagen::mixins::columns<rich>,
-          public soagen::mixins::rows<rich>,
-          public soagen::mixins::iterators<rich>,
-          public soagen::mixins::spans<rich>,
-          public soagen::mixins::swappable<rich>
+    class SOAGEN_EMPTY_BASES units //
+        : public soagen::mixins::size_and_capacity<units>,
+          public soagen::mixins::resizable<units>,
+          public soagen::mixins::equality_comparable<units>,
+          public soagen::mixins::less_than_comparable<units>,
+          public soagen::mixins::data_ptr<units>,
+          public soagen::mixins::columns<units>,
+          public soagen::mixins::rows<units>,
+          public soagen::mixins::iterators<units>,
+          public soagen::mixins::spans<units>,
+          public soagen::mixins::swappable<units>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<rich>;
+        using allocator_type = soagen::allocator_type<units>;
 
-        using table_type = soagen::table_type<rich>;
+        using table_type = soagen::table_type<units>;
 
-        using table_traits = soagen::table_traits_type<rich>;
+        using table_traits = soagen::table_traits_type<units>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -2203,65 +6384,69 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<rich>;
+        using iterator = soagen::iterator_type<units>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<rich>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<units>;
 
-        using const_iterator = soagen::const_iterator_type<rich>;
+        using const_iterator = soagen::const_iterator_type<units>;
 
-        using span_type = soagen::span_type<rich>;
+        using span_type = soagen::span_type<units>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<rich>;
+        using rvalue_span_type = soagen::rvalue_span_type<units>;
 
-        using const_span_type = soagen::const_span_type<rich>;
+        using const_span_type = soagen::const_span_type<units>;
 
-        using row_type = soagen::row_type<rich>;
+        using row_type = soagen::row_type<units>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<rich>;
+        using rvalue_row_type = soagen::rvalue_row_type<units>;
 
-        using const_row_type = soagen::const_row_type<rich>;
+        using const_row_type = soagen::const_row_type<units>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            name          = 0,
-            id            = 1,
-            date_of_birth = 2,
-            salary        = 3,
-            tag           = 4,
+            kind = 0,
+            team = 1,
+            hp   = 2,
         };
 
         template <auto Column>
-        static constexpr auto& column_name = soagen::detail::column_name<rich, static_cast<size_type>(Column)>::value;
+        static constexpr auto& column_name = soagen::detail::column_name<units, static_cast<size_type>(Column)>::value;
 
       private:
         table_type table_;
 
+        soagen::bitmap_index<std::remove_cv_t<column_type<0>>> kind_index_;
+        soagen::bitmap_index<std::remove_cv_t<column_type<1>>> team_index_;
+
+        // growing an index or the handle table may allocate
+        static constexpr bool indexes_are_nothrow_ = false;
+
       public:
         SOAGEN_NODISCARD_CTOR
-        rich() = default;
+        units() = default;
 
         SOAGEN_NODISCARD_CTOR
-        rich(rich&&) = default;
+        units(units&&) = default;
 
-        rich& operator=(rich&&) = default;
+        units& operator=(units&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        rich(const rich&) = default;
+        units(const units&) = default;
 
-        rich& operator=(const rich&) = default;
+        units& operator=(const units&) = default;
 
-        ~rich() = default;
+        ~units() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit rich(const allocator_type& alloc) noexcept //
+        explicit units(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit rich(allocator_type&& alloc) noexcept //
+        explicit units(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -2312,9 +6497,11 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, rich&> erase(size_type pos)                      //
+        std::enable_if_t<sfinae, units&> erase(size_type pos)                     //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            kind_index_.erase(table_.template column<0>(), pos, table_.size());
+            team_index_.erase(table_.template column<1>(), pos, table_.size());
             table_.erase(pos);
             return *this;
         }
@@ -2325,6 +6512,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<size_type>> unordered_erase(size_type pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)  //
         {
+            kind_index_.unordered_erase(table_.template column<0>(), pos, table_.size());
+            team_index_.unordered_erase(table_.template column<1>(), pos, table_.size());
             return table_.unordered_erase(pos);
         }
 
@@ -2334,6 +6523,8 @@ namespace tests
         std::enable_if_t<sfinae, iterator> erase(iterator pos)                    //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            kind_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            team_index_.erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -2344,6 +6535,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<iterator>> unordered_erase(iterator pos)  //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value) //
         {
+            kind_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            team_index_.unordered_erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -2355,6 +6548,8 @@ namespace tests
         std::enable_if_t<sfinae, const_iterator> erase(const_iterator pos)        //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
+            kind_index_.erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            team_index_.erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             table_.erase(static_cast<size_type>(pos));
             return pos;
         }
@@ -2365,6 +6560,8 @@ namespace tests
         std::enable_if_t<sfinae, soagen::optional<const_iterator>> unordered_erase(const_iterator pos) //
             noexcept(soagen::detail::has_nothrow_unordered_erase_member<table_type>::value)            //
         {
+            kind_index_.unordered_erase(table_.template column<0>(), static_cast<size_type>(pos), table_.size());
+            team_index_.unordered_erase(table_.template column<1>(), static_cast<size_type>(pos), table_.size());
             if (auto moved_pos = table_.unordered_erase(static_cast<size_type>(pos)); moved_pos)
                 return const_iterator{ *this, static_cast<difference_type>(*moved_pos) };
             return {};
@@ -2373,76 +6570,211 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        rich& swap_columns() //
+        units& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
-                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
+                                  .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>())
+                     && indexes_are_nothrow_)
         {
             table_.template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>();
+            rebuild_indexes();
+            return *this;
+        }
+
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        units& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(
+                noexcept(std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count))
+                && indexes_are_nothrow_)
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            rebuild_indexes();
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        units& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            rebuild_indexes();
+            return *this;
+        }
+
+        units& pop_back(size_type num = 1) noexcept
+        {
+            if (table_.empty())
+                return *this;
+
+            kind_index_.pop_back(table_.template column<0>(), num, table_.size());
+            team_index_.pop_back(table_.template column<1>(), num, table_.size());
+            table_.pop_back(num);
+            return *this;
+        }
+
+        SOAGEN_RESETTER
+        units& clear() noexcept
+        {
+            table_.clear();
+            kind_index_.clear();
+            team_index_.clear();
+            return *this;
+        }
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_resize_member<table_type>::value)
+        std::enable_if_t<sfinae, units&> resize(size_type new_size)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            kind_index_.reserve(new_size);
+            team_index_.reserve(new_size);
+            table_.resize(new_size);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                kind_index_.push_back(table_.template column<0>(), i);
+                team_index_.push_back(table_.template column<1>(), i);
+            }
+            return *this;
+        }
+
+        SOAGEN_CONSTRAINED_TEMPLATE(table_traits::template rows_fillable_from<Values...>, typename... Values)
+        units& resize(size_type new_size, const Values&... values)
+        {
+            const size_type old_size = table_.size();
+            if (new_size < old_size)
+                return pop_back(old_size - new_size);
+
+            kind_index_.reserve(new_size);
+            team_index_.reserve(new_size);
+            table_.resize(new_size, values...);
+            for (size_type i = old_size; i < new_size; i++)
+            {
+                kind_index_.push_back(table_.template column<0>(), i);
+                team_index_.push_back(table_.template column<1>(), i);
+            }
             return *this;
         }
 
+        units& resize_for_overwrite(size_type) = delete;
+
+        span_type append_uninitialized(size_type) = delete;
+
+        SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_swap_member<table_type>::value)
+        std::enable_if_t<sfinae, void> swap(units& other) //
+            noexcept(soagen::detail::has_nothrow_swap_member<table_type>::value)
+        {
+            table_.swap(other.table_);
+            kind_index_.swap(other.kind_index_);
+            team_index_.swap(other.team_index_);
+        }
+
+        void rebuild_indexes()
+        {
+            if (table_.empty())
+            {
+                kind_index_.clear();
+                team_index_.clear();
+                return;
+            }
+
+            kind_index_.rebuild(table_.template column<0>(), table_.size());
+            team_index_.rebuild(table_.template column<1>(), table_.size());
+        }
+
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::optional<size_type> find(const std::remove_cv_t<column_type<Column>>& key) const noexcept
+        {
+            if (table_.empty())
+                return {};
+
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return kind_index_.find(table_.template column<0>(), key);
+            else if constexpr (static_cast<size_type>(Column) == 1)
+                return team_index_.find(table_.template column<1>(), key);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have an index");
+        }
+
+        template <auto Column>
+        SOAGEN_NODISCARD
+        soagen::row_bitset matching(const std::remove_cv_t<column_type<Column>>& key) const
+        {
+            if constexpr (static_cast<size_type>(Column) == 0)
+                return kind_index_.matching(key);
+            else if constexpr (static_cast<size_type>(Column) == 1)
+                return team_index_.matching(key);
+            else
+                static_assert(sizeof(column_type<Column>) == 0, "column does not have a bitmap index");
+        }
+
         // ------ push_back() --------------------------------------------------------------------------
 
         SOAGEN_CONSTEXPR_20
-        rich& push_back(column_traits<0>::param_type name,
-                        column_traits<1>::param_type id,
-                        column_traits<2>::param_type date_of_birth,
-                        column_traits<3>::param_type salary,
-                        column_traits<4>::param_type tag = nullptr)  //
-            noexcept(table_traits::push_back_is_nothrow<table_type>) //
+        units& push_back(column_traits<0>::param_type kind,
+                         column_traits<1>::param_type team,
+                         column_traits<2>::param_type hp = 0)                               //
+            noexcept(table_traits::push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
-            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(name),
-                                static_cast<column_traits<1>::param_forward_type>(id),
-                                static_cast<column_traits<2>::param_forward_type>(date_of_birth),
-                                static_cast<column_traits<3>::param_forward_type>(salary),
-                                static_cast<column_traits<4>::param_forward_type>(tag));
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
+            table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(kind),
+                                static_cast<column_traits<1>::param_forward_type>(team),
+                                static_cast<column_traits<2>::param_forward_type>(hp));
+            kind_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            team_index_.push_back(table_.template column<1>(), table_.size() - 1u);
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
         SOAGEN_CONSTEXPR_20
-        rich& push_back(column_traits<0>::rvalue_type name,
-                        column_traits<1>::rvalue_type id,
-                        column_traits<2>::rvalue_type date_of_birth,
-                        column_traits<3>::rvalue_type salary,
-                        column_traits<4>::rvalue_type tag = nullptr)        //
-            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>) //
-        {
-            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(name),
-                                static_cast<column_traits<1>::rvalue_forward_type>(id),
-                                static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
-                                static_cast<column_traits<3>::rvalue_forward_type>(salary),
-                                static_cast<column_traits<4>::rvalue_forward_type>(tag));
+        units& push_back(column_traits<0>::rvalue_type kind,
+                         column_traits<1>::rvalue_type team,
+                         column_traits<2>::rvalue_type hp = 0)                                     //
+            noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>&& indexes_are_nothrow_) //
+        {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
+            table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(kind),
+                                static_cast<column_traits<1>::rvalue_forward_type>(team),
+                                static_cast<column_traits<2>::rvalue_forward_type>(hp));
+            kind_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            team_index_.push_back(table_.template column<1>(), table_.size() - 1u);
             return *this;
         }
 
         // ------ emplace_back() -----------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE(
-            (table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>), //
-            typename Name,
-            typename Id,
-            typename DateOfBirth,
-            typename Salary,
-            typename Tag = column_traits<4>::default_emplace_type) //
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<Kind&&, Team&&, Hp&&>), //
+                                    typename Kind,
+                                    typename Team,
+                                    typename Hp = column_traits<2>::default_emplace_type) //
         SOAGEN_CONSTEXPR_20
-        rich& emplace_back(Name&& name, Id&& id, DateOfBirth&& date_of_birth, Salary&& salary, Tag&& tag = nullptr)   //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        units& emplace_back(Kind&& kind, Team&& team, Hp&& hp = 0)                                                   //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Kind&&, Team&&, Hp&&>&& indexes_are_nothrow_) //
         {
-            table_.emplace_back(static_cast<Name&&>(name),
-                                static_cast<Id&&>(id),
-                                static_cast<DateOfBirth&&>(date_of_birth),
-                                static_cast<Salary&&>(salary),
-                                static_cast<Tag&&>(tag));
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
+            table_.emplace_back(static_cast<Kind&&>(kind), static_cast<Team&&>(team), static_cast<Hp&&>(hp));
+            kind_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            team_index_.push_back(table_.template column<1>(), table_.size() - 1u);
             return *this;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
         SOAGEN_CONSTEXPR_20
-        rich& emplace_back(Tuple&& tuple_)                                       //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
+        units& emplace_back(Tuple&& tuple_)                                                             //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u);
+            team_index_.reserve(table_.size() + 1u);
             table_.emplace_back(static_cast<Tuple&&>(tuple_));
+            kind_index_.push_back(table_.template column<0>(), table_.size() - 1u);
+            team_index_.push_back(table_.template column<1>(), table_.size() - 1u);
             return *this;
         }
 
@@ -2457,39 +6789,39 @@ namespace tests
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, rich&> insert(size_type index_,
-                                               column_traits<0>::param_type name,
-                                               column_traits<1>::param_type id,
-                                               column_traits<2>::param_type date_of_birth,
-                                               column_traits<3>::param_type salary,
-                                               column_traits<4>::param_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                          //
+        std::enable_if_t<sfinae, units&> insert(size_type index_,
+                                                column_traits<0>::param_type kind,
+                                                column_traits<1>::param_type team,
+                                                column_traits<2>::param_type hp = 0)     //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(index_,
-                           static_cast<column_traits<0>::param_forward_type>(name),
-                           static_cast<column_traits<1>::param_forward_type>(id),
-                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::param_forward_type>(salary),
-                           static_cast<column_traits<4>::param_forward_type>(tag));
+                           static_cast<column_traits<0>::param_forward_type>(kind),
+                           static_cast<column_traits<1>::param_forward_type>(team),
+                           static_cast<column_traits<2>::param_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), index_, table_.size());
+            team_index_.insert(table_.template column<1>(), index_, table_.size());
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
-        rich& insert(std::enable_if_t<sfinae, size_type> index_,
-                     column_traits<0>::rvalue_type name,
-                     column_traits<1>::rvalue_type id,
-                     column_traits<2>::rvalue_type date_of_birth,
-                     column_traits<3>::rvalue_type salary,
-                     column_traits<4>::rvalue_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>) //
+        units& insert(std::enable_if_t<sfinae, size_type> index_,
+                      column_traits<0>::rvalue_type kind,
+                      column_traits<1>::rvalue_type team,
+                      column_traits<2>::rvalue_type hp = 0)                              //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(index_,
-                           static_cast<column_traits<0>::rvalue_forward_type>(name),
-                           static_cast<column_traits<1>::rvalue_forward_type>(id),
-                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
-                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(kind),
+                           static_cast<column_traits<1>::rvalue_forward_type>(team),
+                           static_cast<column_traits<2>::rvalue_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), index_, table_.size());
+            team_index_.insert(table_.template column<1>(), index_, table_.size());
             return *this;
         }
 
@@ -2498,76 +6830,76 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, iterator> insert(iterator iter_,
-                                                  column_traits<0>::param_type name,
-                                                  column_traits<1>::param_type id,
-                                                  column_traits<2>::param_type date_of_birth,
-                                                  column_traits<3>::param_type salary,
-                                                  column_traits<4>::param_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                             //
+                                                  column_traits<0>::param_type kind,
+                                                  column_traits<1>::param_type team,
+                                                  column_traits<2>::param_type hp = 0)   //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(name),
-                           static_cast<column_traits<1>::param_forward_type>(id),
-                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::param_forward_type>(salary),
-                           static_cast<column_traits<4>::param_forward_type>(tag));
+                           static_cast<column_traits<0>::param_forward_type>(kind),
+                           static_cast<column_traits<1>::param_forward_type>(team),
+                           static_cast<column_traits<2>::param_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
         std::enable_if_t<sfinae, const_iterator> insert(const_iterator iter_,
-                                                        column_traits<0>::param_type name,
-                                                        column_traits<1>::param_type id,
-                                                        column_traits<2>::param_type date_of_birth,
-                                                        column_traits<3>::param_type salary,
-                                                        column_traits<4>::param_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                                   //
+                                                        column_traits<0>::param_type kind,
+                                                        column_traits<1>::param_type team,
+                                                        column_traits<2>::param_type hp = 0) //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_)     //
         {
-            table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::param_forward_type>(name),
-                           static_cast<column_traits<1>::param_forward_type>(id),
-                           static_cast<column_traits<2>::param_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::param_forward_type>(salary),
-                           static_cast<column_traits<4>::param_forward_type>(tag));
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
+            table_.emplace(static_cast<size_type>(iter_),
+                           static_cast<column_traits<0>::param_forward_type>(kind),
+                           static_cast<column_traits<1>::param_forward_type>(team),
+                           static_cast<column_traits<2>::param_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         iterator insert(std::enable_if_t<sfinae, iterator> iter_,
-                        column_traits<0>::rvalue_type name,
-                        column_traits<1>::rvalue_type id,
-                        column_traits<2>::rvalue_type date_of_birth,
-                        column_traits<3>::rvalue_type salary,
-                        column_traits<4>::rvalue_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)    //
+                        column_traits<0>::rvalue_type kind,
+                        column_traits<1>::rvalue_type team,
+                        column_traits<2>::rvalue_type hp = 0)                            //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(name),
-                           static_cast<column_traits<1>::rvalue_forward_type>(id),
-                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
-                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(kind),
+                           static_cast<column_traits<1>::rvalue_forward_type>(team),
+                           static_cast<column_traits<2>::rvalue_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
         const_iterator insert(std::enable_if_t<sfinae, const_iterator> iter_,
-                              column_traits<0>::rvalue_type name,
-                              column_traits<1>::rvalue_type id,
-                              column_traits<2>::rvalue_type date_of_birth,
-                              column_traits<3>::rvalue_type salary,
-                              column_traits<4>::rvalue_type tag = nullptr) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)          //
+                              column_traits<0>::rvalue_type kind,
+                              column_traits<1>::rvalue_type team,
+                              column_traits<2>::rvalue_type hp = 0)                      //
+            noexcept(table_traits::insert_is_nothrow<table_type>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<column_traits<0>::rvalue_forward_type>(name),
-                           static_cast<column_traits<1>::rvalue_forward_type>(id),
-                           static_cast<column_traits<2>::rvalue_forward_type>(date_of_birth),
-                           static_cast<column_traits<3>::rvalue_forward_type>(salary),
-                           static_cast<column_traits<4>::rvalue_forward_type>(tag));
+                           static_cast<column_traits<0>::rvalue_forward_type>(kind),
+                           static_cast<column_traits<1>::rvalue_forward_type>(team),
+                           static_cast<column_traits<2>::rvalue_forward_type>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -2575,28 +6907,19 @@ namespace tests
 
         SOAGEN_CONSTRAINED_TEMPLATE(
             sfinae,
-            typename Name,
-            typename Id,
-            typename DateOfBirth,
-            typename Salary,
-            typename Tag = column_traits<4>::default_emplace_type,
-            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
-                        && can_insert_) //
-        SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, rich&> emplace(size_type index_,
-                                                Name&& name,
-                                                Id&& id,
-                                                DateOfBirth&& date_of_birth,
-                                                Salary&& salary,
-                                                Tag&& tag = nullptr)                                             //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
-        {
-            table_.emplace(index_,
-                           static_cast<Name&&>(name),
-                           static_cast<Id&&>(id),
-                           static_cast<DateOfBirth&&>(date_of_birth),
-                           static_cast<Salary&&>(salary),
-                           static_cast<Tag&&>(tag));
+            typename Kind,
+            typename Team,
+            typename Hp = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Kind&&, Team&&, Hp&&> && can_insert_) //
+        SOAGEN_CONSTEXPR_20
+        std::enable_if_t<sfinae, units&> emplace(size_type index_, Kind&& kind, Team&& team, Hp&& hp = 0)       //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Kind&&, Team&&, Hp&&>&& indexes_are_nothrow_) //
+        {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
+            table_.emplace(index_, static_cast<Kind&&>(kind), static_cast<Team&&>(team), static_cast<Hp&&>(hp));
+            kind_index_.insert(table_.template column<0>(), index_, table_.size());
+            team_index_.insert(table_.template column<1>(), index_, table_.size());
             return *this;
         }
 
@@ -2604,10 +6927,14 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        rich& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)       //
+        units& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_)                 //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u);
+            team_index_.reserve(table_.size() + 1u);
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
+            kind_index_.insert(table_.template column<0>(), index_, table_.size());
+            team_index_.insert(table_.template column<1>(), index_, table_.size());
             return *this;
         }
 
@@ -2615,28 +6942,22 @@ namespace tests
 
         SOAGEN_CONSTRAINED_TEMPLATE(
             sfinae,
-            typename Name,
-            typename Id,
-            typename DateOfBirth,
-            typename Salary,
-            typename Tag = column_traits<4>::default_emplace_type,
-            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
-                        && can_insert_) //
+            typename Kind,
+            typename Team,
+            typename Hp = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Kind&&, Team&&, Hp&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_,
-                                                   Name&& name,
-                                                   Id&& id,
-                                                   DateOfBirth&& date_of_birth,
-                                                   Salary&& salary,
-                                                   Tag&& tag = nullptr)                                          //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, Kind&& kind, Team&& team, Hp&& hp = 0)       //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Kind&&, Team&&, Hp&&>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<Name&&>(name),
-                           static_cast<Id&&>(id),
-                           static_cast<DateOfBirth&&>(date_of_birth),
-                           static_cast<Salary&&>(salary),
-                           static_cast<Tag&&>(tag));
+                           static_cast<Kind&&>(kind),
+                           static_cast<Team&&>(team),
+                           static_cast<Hp&&>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -2644,37 +6965,35 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)        //
+        iterator emplace(std::enable_if_t<sfinae, iterator> iter_, Tuple&& tuple_)                 //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u);
+            team_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(
             sfinae,
-            typename Name,
-            typename Id,
-            typename DateOfBirth,
-            typename Salary,
-            typename Tag = column_traits<4>::default_emplace_type,
-            bool sfinae  = table_traits::row_constructible_from<Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>
-                        && can_insert_) //
+            typename Kind,
+            typename Team,
+            typename Hp = column_traits<2>::default_emplace_type,
+            bool sfinae = table_traits::row_constructible_from<Kind&&, Team&&, Hp&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_,
-                                                         Name&& name,
-                                                         Id&& id,
-                                                         DateOfBirth&& date_of_birth,
-                                                         Salary&& salary,
-                                                         Tag&& tag = nullptr)                                    //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Name&&, Id&&, DateOfBirth&&, Salary&&, Tag&&>) //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, Kind&& kind, Team&& team, Hp&& hp = 0) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Kind&&, Team&&, Hp&&>&& indexes_are_nothrow_)       //
         {
+            kind_index_.reserve(table_.size() + 1u, kind);
+            team_index_.reserve(table_.size() + 1u, team);
             table_.emplace(static_cast<size_type>(iter_),
-                           static_cast<Name&&>(name),
-                           static_cast<Id&&>(id),
-                           static_cast<DateOfBirth&&>(date_of_birth),
-                           static_cast<Salary&&>(salary),
-                           static_cast<Tag&&>(tag));
+                           static_cast<Kind&&>(kind),
+                           static_cast<Team&&>(team),
+                           static_cast<Hp&&>(hp));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
@@ -2682,69 +7001,73 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)                    //
+        const_iterator emplace(std::enable_if_t<sfinae, const_iterator> iter_, Tuple&& tuple_)     //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>&& indexes_are_nothrow_) //
         {
+            kind_index_.reserve(table_.size() + 1u);
+            team_index_.reserve(table_.size() + 1u);
             table_.emplace(static_cast<size_type>(iter_), static_cast<Tuple&&>(tuple_));
+            kind_index_.insert(table_.template column<0>(), static_cast<size_type>(iter_), table_.size());
+            team_index_.insert(table_.template column<1>(), static_cast<size_type>(iter_), table_.size());
             return iter_;
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(rich, Column)
+        SOAGEN_COLUMN(units, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<rich, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<units, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(rich, Column)
+        SOAGEN_COLUMN(units, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<rich, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<units, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<rich>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<units>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(rich& lhs, rich& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<rich>::value)
+    constexpr void swap(units& lhs, units& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<units>::value)
     {
         lhs.swap(rhs);
     }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-// trivial
+// vec4
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace tests
 {
-    class SOAGEN_EMPTY_BASES trivial //
-        : public soagen::mixins::size_and_capacity<trivial>,
-          public soagen::mixins::resizable<trivial>,
-          public soagen::mixins::equality_comparable<trivial>,
-          public soagen::mixins::less_than_comparable<trivial>,
-          public soagen::mixins::data_ptr<trivial>,
-          public soagen::mixins::columns<trivial>,
-          public soagen::mixins::rows<trivial>,
-          public soagen::mixins::iterators<trivial>,
-          public soagen::mixins::spans<trivial>,
-          public soagen::mixins::swappable<trivial>
+    class SOAGEN_EMPTY_BASES vec4 //
+        : public soagen::mixins::size_and_capacity<vec4>,
+          public soagen::mixins::resizable<vec4>,
+          public soagen::mixins::equality_comparable<vec4>,
+          public soagen::mixins::less_than_comparable<vec4>,
+          public soagen::mixins::data_ptr<vec4>,
+          public soagen::mixins::columns<vec4>,
+          public soagen::mixins::rows<vec4>,
+          public soagen::mixins::iterators<vec4>,
+          public soagen::mixins::spans<vec4>,
+          public soagen::mixins::swappable<vec4>
     {
       public:
         using size_type = std::size_t;
 
         using difference_type = std::ptrdiff_t;
 
-        using allocator_type = soagen::allocator_type<trivial>;
+        using allocator_type = soagen::allocator_type<vec4>;
 
-        using table_type = soagen::table_type<trivial>;
+        using table_type = soagen::table_type<vec4>;
 
-        using table_traits = soagen::table_traits_type<trivial>;
+        using table_traits = soagen::table_traits_type<vec4>;
 
         static constexpr size_type column_count = table_traits::column_count;
 
@@ -2754,65 +7077,72 @@ namespace tests
         template <auto Column>
         using column_type = typename column_traits<static_cast<size_type>(Column)>::value_type;
 
-        using iterator = soagen::iterator_type<trivial>;
+        using iterator = soagen::iterator_type<vec4>;
 
-        using rvalue_iterator = soagen::rvalue_iterator_type<trivial>;
+        using rvalue_iterator = soagen::rvalue_iterator_type<vec4>;
 
-        using const_iterator = soagen::const_iterator_type<trivial>;
+        using const_iterator = soagen::const_iterator_type<vec4>;
 
-        using span_type = soagen::span_type<trivial>;
+        using span_type = soagen::span_type<vec4>;
 
-        using rvalue_span_type = soagen::rvalue_span_type<trivial>;
+        using rvalue_span_type = soagen::rvalue_span_type<vec4>;
 
-        using const_span_type = soagen::const_span_type<trivial>;
+        using const_span_type = soagen::const_span_type<vec4>;
 
-        using row_type = soagen::row_type<trivial>;
+        using row_type = soagen::row_type<vec4>;
 
-        using rvalue_row_type = soagen::rvalue_row_type<trivial>;
+        using rvalue_row_type = soagen::rvalue_row_type<vec4>;
 
-        using const_row_type = soagen::const_row_type<trivial>;
+        using const_row_type = soagen::const_row_type<vec4>;
 
         static constexpr size_type aligned_stride = table_traits::aligned_stride;
 
         enum class columns : size_type
         {
-            x     = 0,
-            y     = 1,
-            z     = 2,
-            flags = 3,
+            x = 0,
+            y = 1,
+            z = 2,
+            w = 3,
         };
 
         template <auto Column>
-        static constexpr auto& column_name =
-            soagen::detail::column_name<trivial, static_cast<size_type>(Column)>::value;
+        static constexpr auto& column_name = soagen::detail::column_name<vec4, static_cast<size_type>(Column)>::value;
+
+        struct value_type
+        {
+            float x;
+            float y;
+            float z;
+            float w;
+        };
 
       private:
         table_type table_;
 
       public:
         SOAGEN_NODISCARD_CTOR
-        trivial() = default;
+        vec4() = default;
 
         SOAGEN_NODISCARD_CTOR
-        trivial(trivial&&) = default;
+        vec4(vec4&&) = default;
 
-        trivial& operator=(trivial&&) = default;
+        vec4& operator=(vec4&&) = default;
 
         SOAGEN_NODISCARD_CTOR
-        trivial(const trivial&) = default;
+        vec4(const vec4&) = default;
 
-        trivial& operator=(const trivial&) = default;
+        vec4& operator=(const vec4&) = default;
 
-        ~trivial() = default;
+        ~vec4() = default;
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit trivial(const allocator_type& alloc) noexcept //
+        constexpr explicit vec4(const allocator_type& alloc) noexcept //
             : table_{ alloc }
         {
         }
 
         SOAGEN_NODISCARD_CTOR
-        constexpr explicit trivial(allocator_type&& alloc) noexcept //
+        constexpr explicit vec4(allocator_type&& alloc) noexcept //
             : table_{ static_cast<allocator_type&&>(alloc) }
         {
         }
@@ -2863,7 +7193,7 @@ namespace tests
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = soagen::detail::has_erase_member<table_type>::value)
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20                                                       //
-        std::enable_if_t<sfinae, trivial&> erase(size_type pos)                   //
+        std::enable_if_t<sfinae, vec4&> erase(size_type pos)                      //
             noexcept(soagen::detail::has_nothrow_erase_member<table_type>::value) //
         {
             table_.erase(pos);
@@ -2924,7 +7254,7 @@ namespace tests
         template <auto A, auto B>
         SOAGEN_ALWAYS_INLINE
         SOAGEN_CONSTEXPR_20
-        trivial& swap_columns() //
+        vec4& swap_columns() //
             noexcept(noexcept(std::declval<table_type&>()
                                   .template swap_columns<static_cast<size_type>(A), static_cast<size_type>(B)>()))
         {
@@ -2932,64 +7262,99 @@ namespace tests
             return *this;
         }
 
+        template <auto Column, typename Value>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        vec4& fill(const Value& value, size_type first = 0, size_type count = static_cast<size_type>(-1)) //
+            noexcept(noexcept(
+                std::declval<table_type&>().template fill<static_cast<size_type>(Column)>(value, first, count)))
+        {
+            table_.template fill<static_cast<size_type>(Column)>(value, first, count);
+            return *this;
+        }
+
+        template <auto Column, typename Range>
+        SOAGEN_ALWAYS_INLINE
+        SOAGEN_CONSTEXPR_20
+        vec4& assign_column(const Range& values, size_type first = 0)
+        {
+            table_.template assign_column<static_cast<size_type>(Column)>(values, first);
+            return *this;
+        }
+
         // ------ push_back() --------------------------------------------------------------------------
 
         SOAGEN_CONSTEXPR_20
-        trivial& push_back(column_traits<0>::param_type x,
-                           column_traits<1>::param_type y,
-                           column_traits<2>::param_type z,
-                           column_traits<3>::param_type flags)       //
+        vec4& push_back(column_traits<0>::param_type x,
+                        column_traits<1>::param_type y,
+                        column_traits<2>::param_type z,
+                        column_traits<3>::param_type w)              //
             noexcept(table_traits::push_back_is_nothrow<table_type>) //
         {
             table_.emplace_back(static_cast<column_traits<0>::param_forward_type>(x),
                                 static_cast<column_traits<1>::param_forward_type>(y),
                                 static_cast<column_traits<2>::param_forward_type>(z),
-                                static_cast<column_traits<3>::param_forward_type>(flags));
+                                static_cast<column_traits<3>::param_forward_type>(w));
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = table_traits::rvalues_are_distinct)
         SOAGEN_CONSTEXPR_20
-        trivial& push_back(column_traits<0>::rvalue_type x,
-                           column_traits<1>::rvalue_type y,
-                           column_traits<2>::rvalue_type z,
-                           column_traits<3>::rvalue_type flags)             //
+        vec4& push_back(column_traits<0>::rvalue_type x,
+                        column_traits<1>::rvalue_type y,
+                        column_traits<2>::rvalue_type z,
+                        column_traits<3>::rvalue_type w)                    //
             noexcept(table_traits::rvalue_push_back_is_nothrow<table_type>) //
         {
             table_.emplace_back(static_cast<column_traits<0>::rvalue_forward_type>(x),
                                 static_cast<column_traits<1>::rvalue_forward_type>(y),
                                 static_cast<column_traits<2>::rvalue_forward_type>(z),
-                                static_cast<column_traits<3>::rvalue_forward_type>(flags));
+                                static_cast<column_traits<3>::rvalue_forward_type>(w));
             return *this;
         }
 
         // ------ emplace_back() -----------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>), //
+        SOAGEN_CONSTRAINED_TEMPLATE((table_traits::row_constructible_from<X&&, Y&&, Z&&, W&&>), //
                                     typename X,
                                     typename Y,
                                     typename Z,
-                                    typename Flags) //
+                                    typename W) //
         SOAGEN_CONSTEXPR_20
-        trivial& emplace_back(X&& x, Y&& y, Z&& z, Flags&& flags)                               //
-            noexcept(table_traits::emplace_back_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>) //
+        vec4& emplace_back(X&& x, Y&& y, Z&& z, W&& w)                                      //
+            noexcept(table_traits::emplace_back_is_nothrow<table_type, X&&, Y&&, Z&&, W&&>) //
         {
-            table_.emplace_back(static_cast<X&&>(x),
-                                static_cast<Y&&>(y),
-                                static_cast<Z&&>(z),
-                                static_cast<Flags&&>(flags));
+            table_.emplace_back(static_cast<X&&>(x), static_cast<Y&&>(y), static_cast<Z&&>(z), static_cast<W&&>(w));
             return *this;
         }
 
         SOAGEN_CONSTRAINED_TEMPLATE(table_traits::row_constructible_from<Tuple>, typename Tuple)
         SOAGEN_CONSTEXPR_20
-        trivial& emplace_back(Tuple&& tuple_)                                    //
+        vec4& emplace_back(Tuple&& tuple_)                                       //
             noexcept(table_traits::emplace_back_is_nothrow<table_type, Tuple&&>) //
         {
             table_.emplace_back(static_cast<Tuple&&>(tuple_));
             return *this;
         }
 
+        vec4& append_from_aos(const value_type* src, size_type count)
+        {
+            soagen::append_from_aos(table_, src, count, &value_type::x, &value_type::y, &value_type::z, &value_type::w);
+            return *this;
+        }
+
+        void copy_to_aos(value_type* dest, size_type start, size_type count) const
+        {
+            soagen::copy_to_aos(table_,
+                                dest,
+                                start,
+                                count,
+                                &value_type::x,
+                                &value_type::y,
+                                &value_type::z,
+                                &value_type::w);
+        }
+
       private:
         static constexpr bool can_insert_ =
             table_traits::all_move_or_copy_constructible && table_traits::all_move_or_copy_assignable;
@@ -3001,35 +7366,35 @@ namespace tests
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, trivial&> insert(size_type index_,
-                                                  column_traits<0>::param_type x,
-                                                  column_traits<1>::param_type y,
-                                                  column_traits<2>::param_type z,
-                                                  column_traits<3>::param_type flags) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+        std::enable_if_t<sfinae, vec4&> insert(size_type index_,
+                                               column_traits<0>::param_type x,
+                                               column_traits<1>::param_type y,
+                                               column_traits<2>::param_type z,
+                                               column_traits<3>::param_type w) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)              //
         {
             table_.emplace(index_,
                            static_cast<column_traits<0>::param_forward_type>(x),
                            static_cast<column_traits<1>::param_forward_type>(y),
                            static_cast<column_traits<2>::param_forward_type>(z),
-                           static_cast<column_traits<3>::param_forward_type>(flags));
+                           static_cast<column_traits<3>::param_forward_type>(w));
             return *this;
         }
 
         SOAGEN_HIDDEN_CONSTRAINT(sfinae, bool sfinae = can_insert_rvalues_) //
         SOAGEN_CONSTEXPR_20
-        trivial& insert(std::enable_if_t<sfinae, size_type> index_,
-                        column_traits<0>::rvalue_type x,
-                        column_traits<1>::rvalue_type y,
-                        column_traits<2>::rvalue_type z,
-                        column_traits<3>::rvalue_type flags)      //
+        vec4& insert(std::enable_if_t<sfinae, size_type> index_,
+                     column_traits<0>::rvalue_type x,
+                     column_traits<1>::rvalue_type y,
+                     column_traits<2>::rvalue_type z,
+                     column_traits<3>::rvalue_type w)             //
             noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(index_,
                            static_cast<column_traits<0>::rvalue_forward_type>(x),
                            static_cast<column_traits<1>::rvalue_forward_type>(y),
                            static_cast<column_traits<2>::rvalue_forward_type>(z),
-                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
+                           static_cast<column_traits<3>::rvalue_forward_type>(w));
             return *this;
         }
 
@@ -3041,14 +7406,14 @@ namespace tests
                                                   column_traits<0>::param_type x,
                                                   column_traits<1>::param_type y,
                                                   column_traits<2>::param_type z,
-                                                  column_traits<3>::param_type flags) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                     //
+                                                  column_traits<3>::param_type w) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                 //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<column_traits<0>::param_forward_type>(x),
                            static_cast<column_traits<1>::param_forward_type>(y),
                            static_cast<column_traits<2>::param_forward_type>(z),
-                           static_cast<column_traits<3>::param_forward_type>(flags));
+                           static_cast<column_traits<3>::param_forward_type>(w));
             return iter_;
         }
 
@@ -3058,14 +7423,14 @@ namespace tests
                                                         column_traits<0>::param_type x,
                                                         column_traits<1>::param_type y,
                                                         column_traits<2>::param_type z,
-                                                        column_traits<3>::param_type flags) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)                           //
+                                                        column_traits<3>::param_type w) //
+            noexcept(table_traits::insert_is_nothrow<table_type>)                       //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<column_traits<0>::param_forward_type>(x),
                            static_cast<column_traits<1>::param_forward_type>(y),
                            static_cast<column_traits<2>::param_forward_type>(z),
-                           static_cast<column_traits<3>::param_forward_type>(flags));
+                           static_cast<column_traits<3>::param_forward_type>(w));
             return iter_;
         }
 
@@ -3075,14 +7440,14 @@ namespace tests
                         column_traits<0>::rvalue_type x,
                         column_traits<1>::rvalue_type y,
                         column_traits<2>::rvalue_type z,
-                        column_traits<3>::rvalue_type flags)      //
+                        column_traits<3>::rvalue_type w)          //
             noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<column_traits<0>::rvalue_forward_type>(x),
                            static_cast<column_traits<1>::rvalue_forward_type>(y),
                            static_cast<column_traits<2>::rvalue_forward_type>(z),
-                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
+                           static_cast<column_traits<3>::rvalue_forward_type>(w));
             return iter_;
         }
 
@@ -3092,35 +7457,31 @@ namespace tests
                               column_traits<0>::rvalue_type x,
                               column_traits<1>::rvalue_type y,
                               column_traits<2>::rvalue_type z,
-                              column_traits<3>::rvalue_type flags) //
-            noexcept(table_traits::insert_is_nothrow<table_type>)  //
+                              column_traits<3>::rvalue_type w)    //
+            noexcept(table_traits::insert_is_nothrow<table_type>) //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<column_traits<0>::rvalue_forward_type>(x),
                            static_cast<column_traits<1>::rvalue_forward_type>(y),
                            static_cast<column_traits<2>::rvalue_forward_type>(z),
-                           static_cast<column_traits<3>::rvalue_forward_type>(flags));
+                           static_cast<column_traits<3>::rvalue_forward_type>(w));
             return iter_;
         }
 
         // ------ emplace(size_type) -------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename X,
-                                    typename Y,
-                                    typename Z,
-                                    typename Flags,
-                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
-                                               && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename X,
+            typename Y,
+            typename Z,
+            typename W,
+            bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, W&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, trivial&> emplace(size_type index_, X&& x, Y&& y, Z&& z, Flags&& flags) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)               //
+        std::enable_if_t<sfinae, vec4&> emplace(size_type index_, X&& x, Y&& y, Z&& z, W&& w) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, W&&>)        //
         {
-            table_.emplace(index_,
-                           static_cast<X&&>(x),
-                           static_cast<Y&&>(y),
-                           static_cast<Z&&>(z),
-                           static_cast<Flags&&>(flags));
+            table_.emplace(index_, static_cast<X&&>(x), static_cast<Y&&>(y), static_cast<Z&&>(z), static_cast<W&&>(w));
             return *this;
         }
 
@@ -3128,8 +7489,8 @@ namespace tests
                                     typename Tuple,
                                     bool sfinae = table_traits::row_constructible_from<Tuple&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        trivial& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)          //
+        vec4& emplace(std::enable_if_t<sfinae, size_type> index_, Tuple&& tuple_) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, Tuple&&>)       //
         {
             table_.emplace(index_, static_cast<Tuple&&>(tuple_));
             return *this;
@@ -3137,22 +7498,22 @@ namespace tests
 
         // ------ emplace(iterator) --------------------------------------------------------------------
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename X,
-                                    typename Y,
-                                    typename Z,
-                                    typename Flags,
-                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
-                                               && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename X,
+            typename Y,
+            typename Z,
+            typename W,
+            bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, W&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, X&& x, Y&& y, Z&& z, Flags&& flags) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)             //
+        std::enable_if_t<sfinae, iterator> emplace(iterator iter_, X&& x, Y&& y, Z&& z, W&& w) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, W&&>)         //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<X&&>(x),
                            static_cast<Y&&>(y),
                            static_cast<Z&&>(z),
-                           static_cast<Flags&&>(flags));
+                           static_cast<W&&>(w));
             return iter_;
         }
 
@@ -3167,22 +7528,22 @@ namespace tests
             return iter_;
         }
 
-        SOAGEN_CONSTRAINED_TEMPLATE(sfinae,
-                                    typename X,
-                                    typename Y,
-                                    typename Z,
-                                    typename Flags,
-                                    bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, Flags&&>
-                                               && can_insert_) //
+        SOAGEN_CONSTRAINED_TEMPLATE(
+            sfinae,
+            typename X,
+            typename Y,
+            typename Z,
+            typename W,
+            bool sfinae = table_traits::row_constructible_from<X&&, Y&&, Z&&, W&&> && can_insert_) //
         SOAGEN_CONSTEXPR_20
-        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, X&& x, Y&& y, Z&& z, Flags&& flags) //
-            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, Flags&&>)                         //
+        std::enable_if_t<sfinae, const_iterator> emplace(const_iterator iter_, X&& x, Y&& y, Z&& z, W&& w) //
+            noexcept(table_traits::emplace_is_nothrow<table_type, X&&, Y&&, Z&&, W&&>)                     //
         {
             table_.emplace(static_cast<size_type>(iter_),
                            static_cast<X&&>(x),
                            static_cast<Y&&>(y),
                            static_cast<Z&&>(z),
-                           static_cast<Flags&&>(flags));
+                           static_cast<W&&>(w));
             return iter_;
         }
 
@@ -3198,28 +7559,28 @@ namespace tests
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(trivial, Column)
+        SOAGEN_COLUMN(vec4, Column)
         constexpr column_type<Column>* column() noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<trivial, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<vec4, Column>>(table_.template column<Column>());
         }
 
         template <auto Column>
-        SOAGEN_COLUMN(trivial, Column)
+        SOAGEN_COLUMN(vec4, Column)
         constexpr std::add_const_t<column_type<Column>>* column() const noexcept
         {
             static_assert(static_cast<size_type>(Column) < table_traits::column_count, "column index out of range");
 
-            return soagen::assume_aligned<soagen::actual_alignment<trivial, Column>>(table_.template column<Column>());
+            return soagen::assume_aligned<soagen::actual_alignment<vec4, Column>>(table_.template column<Column>());
         }
     };
 
-    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<trivial>::value)
+    SOAGEN_HIDDEN_CONSTRAINT(sfinae, auto sfinae = soagen::detail::has_swap_member<vec4>::value)
     SOAGEN_ALWAYS_INLINE
-    constexpr void swap(trivial& lhs, trivial& rhs) //
-        noexcept(soagen::detail::has_nothrow_swap_member<trivial>::value)
+    constexpr void swap(vec4& lhs, vec4& rhs) //
+        noexcept(soagen::detail::has_nothrow_swap_member<vec4>::value)
     {
         lhs.swap(rhs);
     }
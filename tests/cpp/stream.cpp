@@ -0,0 +1,184 @@
+// This file is a part of marzer/soagen and is subject to the terms of the MIT license.
+// Copyright (c) Mark Gillard <mark.gillard@outlook.com.au>
+// See https://github.com/marzer/soagen/blob/master/LICENSE for the full license text.
+// SPDX-License-Identifier: MIT
+
+#include "fixtures.hpp"
+
+using namespace tests;
+
+namespace
+{
+    struct memory_stream
+    {
+        std::vector<std::byte> bytes;
+        std::size_t read_pos = {};
+        std::size_t writes   = {};
+
+        auto sink()
+        {
+            return [this](const void* data, std::size_t size)
+            {
+                writes++;
+                const auto b = static_cast<const std::byte*>(data);
+                bytes.insert(bytes.end(), b, b + size);
+            };
+        }
+
+        auto source()
+        {
+            return [this](void* data, std::size_t size)
+            {
+                if (bytes.size() - read_pos < size)
+                    return false;
+                std::memcpy(data, bytes.data() + read_pos, size);
+                read_pos += size;
+                return true;
+            };
+        }
+    };
+}
+
+TEST_CASE("stream - round-trip", "[stream]")
+{
+    auto src = make_rich(50);
+    src.emplace_back("", 999u, std::tuple{ 1, 2, 3 }, -1, nullptr);
+
+    memory_stream stream;
+    REQUIRE(soagen::serialize(src, stream.sink()));
+
+    rich dest = make_rich(3);
+    REQUIRE(soagen::deserialize(dest, stream.source()));
+    CHECK(stream.read_pos == stream.bytes.size());
+    CHECK(dest.size() == 51u);
+    CHECK(dest == src);
+    CHECK_RICH_ROW(dest[10], "name 10", 10, (1980, 1, 1), 10000, nullptr);
+    CHECK_RICH_ROW(dest.back(), "", 999, (1, 2, 3), -1, nullptr);
+
+    // the result is a normal table
+    dest.push_back("more", 1000u, { 2000, 1, 1 }, 5, nullptr);
+    CHECK(dest.size() == 52u);
+}
+
+TEST_CASE("stream - deserialize rebuilds indexes and handles", "[stream]")
+{
+    {
+        entities src;
+        for (unsigned i = 0; i < 20u; i++)
+            src.push_back(i * 7u, "e" + std::to_string(i));
+
+        memory_stream stream;
+        REQUIRE(soagen::serialize(src, stream.sink()));
+
+        entities e;
+        e.push_back(1u, "stale");
+        REQUIRE(soagen::deserialize(e, stream.source()));
+        REQUIRE(e.size() == 20u);
+        CHECK(e.find(14u) == 2u);
+        CHECK(e.find(133u) == 19u);
+        CHECK(!e.find(1u));
+    }
+
+    {
+        actors src;
+        for (int i = 0; i < 5; i++)
+            src.emplace_back("a" + std::to_string(i), i);
+
+        memory_stream stream;
+        REQUIRE(soagen::serialize(src, stream.sink()));
+
+        actors a;
+        const auto stale = a.emplace_back_handle("stale");
+        REQUIRE(soagen::deserialize(a, stream.source()));
+        REQUIRE(a.size() == 5u);
+        CHECK(!a.contains(stale));
+        for (std::size_t i = 0; i < a.size(); i++)
+            CHECK(a.index_of(a.handle_of(i)) == i);
+
+        const auto last = a.handle_of(4);
+        CHECK(a.erase(a.handle_of(1)));
+        CHECK(a.size() == 4u);
+        CHECK(a.name()[*a.index_of(last)] == "a4");
+    }
+}
+
+TEST_CASE("stream - trivial columns are written as one block each", "[stream]")
+{
+    auto src = make_trivial(1000);
+
+    memory_stream stream;
+    REQUIRE(soagen::serialize(src, stream.sink()));
+    CHECK(stream.writes == 1u + trivial::table_traits::column_count);
+    CHECK(stream.bytes.size() == sizeof(soagen::stream_header) + 1000u * (sizeof(float) * 3u + sizeof(unsigned)));
+
+    trivial dest;
+    REQUIRE(soagen::deserialize(dest, stream.source()));
+    CHECK(dest == src);
+}
+
+TEST_CASE("stream - tuple columns are written as one block per member", "[stream]")
+{
+    using tuples = soagen::table<soagen::table_traits<std::tuple<int, float, unsigned>, int>>;
+    static_assert(!std::is_trivially_copyable_v<std::tuple<int, float, unsigned>>);
+
+    tuples src;
+    for (int i = 0; i < 2500; i++)
+        src.emplace_back(std::tuple{ i, static_cast<float>(i) * 0.5f, static_cast<unsigned>(i * 3) }, -i);
+
+    // the header, three batches of rows with one block per member, then the trivial column
+    memory_stream stream;
+    REQUIRE(soagen::serialize(src, stream.sink()));
+    CHECK(stream.writes == 1u + 3u * 3u + 1u);
+
+    tuples dest;
+    REQUIRE(soagen::deserialize(dest, stream.source()));
+    CHECK(stream.read_pos == stream.bytes.size());
+    REQUIRE(dest.size() == src.size());
+    for (std::size_t i = 0; i < dest.size(); i++)
+    {
+        REQUIRE(dest.column<0>()[i] == src.column<0>()[i]);
+        REQUIRE(dest.column<1>()[i] == src.column<1>()[i]);
+    }
+
+    // a stream truncated part-way through a batch fails cleanly
+    stream.bytes.resize(stream.bytes.size() / 2u);
+    stream.read_pos = 0u;
+    tuples partial;
+    CHECK(!soagen::deserialize(partial, stream.source()));
+    CHECK(partial.empty());
+}
+
+TEST_CASE("stream - empty tables", "[stream]")
+{
+    memory_stream stream;
+    REQUIRE(soagen::serialize(rich{}, stream.sink()));
+    CHECK(stream.bytes.size() == sizeof(soagen::stream_header));
+
+    auto dest = make_rich(2);
+    REQUIRE(soagen::deserialize(dest, stream.source()));
+    CHECK(dest.empty());
+}
+
+TEST_CASE("stream - failures", "[stream]")
+{
+    memory_stream stream;
+    REQUIRE(soagen::serialize(make_rich(20), stream.sink()));
+
+    // truncated part-way through a non-trivial column; nothing may leak (checked by sanitizers)
+    for (auto cut : { std::size_t{ 10 }, sizeof(soagen::stream_header) + 8u, stream.bytes.size() - 1u })
+    {
+        memory_stream truncated;
+        truncated.bytes.assign(stream.bytes.begin(), stream.bytes.begin() + static_cast<std::ptrdiff_t>(cut));
+        auto dest = make_rich(2);
+        CHECK(!soagen::deserialize(dest, truncated.source()));
+        CHECK(dest.empty());
+    }
+
+    // wrong schema
+    trivial t;
+    stream.read_pos = 0;
+    CHECK(!soagen::deserialize(t, stream.source()));
+
+    // sinks can abort
+    CHECK(!soagen::serialize(make_rich(5), [](const void*, std::size_t) { return false; }));
+}
@@ -9,11 +9,12 @@ Fast, deterministic unit tests for soagen's pure helpers and config validation.
 toolchain nor network access, so they run across the full python matrix as the project's primary safety net.
 """
 
+import re
 from pathlib import Path
 
 import pytest
 
-from soagen import cpp, preprocessor, utils
+from soagen import cpp, layout, preprocessor, utils
 from soagen.config import Config
 from soagen.errors import Error
 from soagen.main import check_for_output_collisions
@@ -63,6 +64,37 @@ def test_invalid_identifiers_are_rejected(name):
     assert rest and isinstance(rest[0], str) and rest[0]
 
 
+def _generated_member_names(hpp: str) -> set[str]:
+    # names declared at class scope by each generated class, minus its column accessors and constructors
+    names = set()
+    for cls in re.finditer(r'^    class SOAGEN_EMPTY_BASES (\w+) //\n(.*?)^    };', hpp, re.M | re.S):
+        name, body = cls.group(1), cls.group(2)
+        columns = re.search(r'enum class columns : size_type\n\s*\{(.*?)\}', body, re.S)
+        accessors = set(re.findall(r'^\s*(\w+)\s*=\s*\d+,', columns.group(1), re.M))
+        for line in body.split('\n'):
+            if not line.startswith(' ' * 8) or line.startswith(' ' * 9):
+                continue
+            line = line.strip()
+            if line.startswith(('//', 'SOAGEN_', 'template', 'return', 'friend', '{', '}')):
+                continue
+            decl = (
+                re.match(r'(?:using|enum class) (\w+)', line)
+                or re.match(r'(?:static |constexpr )*[\w:<>,&* ]+? (\w+)\s*(?:=|;|\{)', line)
+                or re.match(r'(?:[\w:<>,&* ]+? )?(\w+)\s*\(', line)
+            )
+            if decl and decl.group(1) not in accessors and decl.group(1) not in (name, 'operator', 'explicit'):
+                names.add(decl.group(1))
+    return names
+
+
+def test_generated_member_names_are_rejected_as_column_names():
+    # a column named after a generated member would clash with it in the generated class
+    hpp = (Path(__file__).parent.parent / 'cpp' / 'soa.hpp').read_text(encoding='utf-8')
+    names = _generated_member_names(hpp)
+    assert {'fill', 'assign_column', 'append_uninitialized', 'rebuild_handles', 'swap_columns'} <= names
+    assert sorted(n for n in names if cpp.is_valid_identifier(n)[0]) == []
+
+
 # ----------------------------------------------------------------------------------------------------------------------
 # cpp includes helpers
 # ----------------------------------------------------------------------------------------------------------------------
@@ -285,3 +317,49 @@ def test_internal_macros_keeps_token_paste_prefix_family():
         '#define SOAGEN_UNUSED 1\n'
     )
     assert preprocessor.internal_macros(text, keep={'SOAGEN_PUBLIC'}) == ['SOAGEN_UNUSED']
+
+
+# ----------------------------------------------------------------------------------------------------------------------
+# layout report
+# ----------------------------------------------------------------------------------------------------------------------
+
+
+def test_type_sizes_ignore_cv_and_whitespace():
+    assert layout.type_size_and_alignment('const  unsigned int') == (4, 4)
+    assert layout.type_size_and_alignment('std::uint16_t') == (2, 2)
+    assert layout.type_size_and_alignment('const char*') == (8, 8)
+    assert layout.type_size_and_alignment('std::string') is None
+
+
+def test_layout_matches_calc_column_ends():
+    # char, then a float over-aligned to 32: the float column starts at the next 32-byte boundary
+    cols = [layout.ColumnShape('a', 'char', 0), layout.ColumnShape('b', 'float', 32)]
+    assert layout.aligned_stride(cols) == 8
+    assert layout.buffer_layout(cols, 8) == (64, 24)
+    assert layout.buffer_layout(cols[::-1], 8) == (40, 0)
+    assert [c.name for c in layout.best_order(cols, [8, 16])] == ['b', 'a']
+
+
+def test_layout_report_suggests_a_better_order(tmp_path):
+    cfg = _config(
+        tmp_path,
+        "[structs.foo]\nvariables = [ {name='a', type='char'}, {name='b', type='double', alignment=64},"
+        " {name='c', type='std::string'} ]\n[structs.bar]\nvariables = [ {name='a', type='char'},"
+        " {name='b', type='double', alignment=64} ]\n",
+    )
+    bar, foo = cfg.structs
+    assert 'suggested column order: b, a' in layout.layout_report(bar)
+    assert 'sizes of c are not known' in layout.layout_report(foo)
+
+
+def test_reorder_storage_keeps_declared_order(tmp_path):
+    cfg = _config(
+        tmp_path,
+        "[structs.foo]\nreorder_storage = true\nvariables = [ {name='a', type='char'},"
+        " {name='b', type='double', alignment=64}, {name='c', type='int'} ]\n",
+    )
+    foo = cfg.structs[0]
+    assert [c.name for c in foo.columns] == ['a', 'b', 'c']  # declared order is untouched
+    report = layout.layout_report(foo)
+    assert 'storage order (reorder_storage): b, c, a' in report
+    assert 'suggested column order' not in report